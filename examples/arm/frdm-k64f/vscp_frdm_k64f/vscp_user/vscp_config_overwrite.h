@@ -67,6 +67,9 @@ extern "C"
 
 /* ---------- Define here your preferred configuration setup. ---------- */
 
+/* Acceptance filters in the receive message buffers, see vscp_tp_adapter.c */
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_ENABLED
+
 /*
 #define VSCP_CONFIG_ENABLE_LOGGER               VSCP_CONFIG_BASE_DISABLED
 
@@ -108,6 +111,9 @@ extern "C"
 
 /* ---------- Define here your preferred configuration setup. ---------- */
 
+/* One filter per rx FIFO identifier filter element, see VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM */
+#define VSCP_CONFIG_ACCEPTANCE_FILTER_NUM       8
+
 /*
 
 #define VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT   ((uint16_t)5000)
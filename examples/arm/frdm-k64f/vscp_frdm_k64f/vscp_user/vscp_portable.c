@@ -42,6 +42,7 @@
 *******************************************************************************/
 #include "vscp_portable.h"
 #include "vscp_core.h"
+#include "fsl_device_registers.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -83,7 +84,14 @@ static VSCP_LAMP_STATE  vscp_portable_lampState = VSCP_LAMP_STATE_OFF;
  */
 extern void vscp_portable_init(void)
 {
-    /* Implement your code here ... */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+    /* Enable the DWT cycle counter for the performance probes. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
 
     return;
 }
@@ -285,6 +293,23 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent() {
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/**
+ * Get the current value of a free running cycle counter, which is used by the
+ * performance probes. It shall have the highest available resolution and may
+ * overflow.
+ *
+ * @return Cycle counter value
+ */
+extern uint32_t vscp_portable_getCycleCount(void)
+{
+    /* DWT cycle counter of the Cortex-M4 core */
+    return DWT->CYCCNT;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -229,6 +229,19 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent();
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/**
+ * Get the current value of a free running cycle counter, which is used by the
+ * performance probes. It shall have the highest available resolution and may
+ * overflow.
+ *
+ * @return Cycle counter value
+ */
+extern uint32_t vscp_portable_getCycleCount(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,7 +41,9 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_tp_adapter.h"
+#include <string.h>
 #include "fsl_flexcan.h"
+#include "vscp_stats.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -54,30 +56,71 @@
 /** Used CAN peripheral */
 #define VSCP_TP_ADAPTER_CAN						CAN0
 
+/** Message buffer interrupt of the used CAN peripheral */
+#define VSCP_TP_ADAPTER_CAN_MB_IRQN				CAN0_ORed_Message_buffer_IRQn
+
 /** CAN clock source */
 #define VSCP_TP_ADAPTER_CAN_CLKSRC				kCLOCK_BusClk
 
 /** CAN clock frequency */
 #define VSCP_TP_ADAPTER_CAN_CLK_FREQ			CLOCK_GetFreq(VSCP_TP_ADAPTER_CAN_CLKSRC)
 
-/** Number of CAN receive message buffers */
-#define VSCP_TP_ADAPTER_CAN_RX_MB_COUNT			15
+/** Number of rx FIFO identifier filter elements, every element has its own mask. */
+#define VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM	8
+
+/** Number of message buffers, which are occupied by the rx FIFO and its
+ * identifier filter table.
+ */
+#define VSCP_TP_ADAPTER_CAN_RX_FIFO_MB_COUNT	8
+
+/** Number of CAN transmit message buffers, all message buffers after the rx FIFO */
+#define VSCP_TP_ADAPTER_CAN_TX_MB_COUNT			8
 
-/** Number of CAN receive message buffers */
-#define VSCP_TP_ADAPTER_CAN_TX_MB_COUNT			1
+/** Index of the first CAN transmit message buffer, right after the rx FIFO */
+#define VSCP_TP_ADAPTER_CAN_TX_MB_FIRST			VSCP_TP_ADAPTER_CAN_RX_FIFO_MB_COUNT
+
+/** Number of frames in the receive queue. The rx FIFO holds only 6 frames,
+ * which are received in less than 1 ms at 1 Mbit/s. The receive queue is
+ * filled by the interrupt and shall hold the frames of a whole
+ * vscp_core_process() cycle.
+ */
+#define VSCP_TP_ADAPTER_RX_QUEUE_SIZE			64
+
+/** Number of frames in the transmit queue, which wait for a free transmit
+ * message buffer.
+ */
+#define VSCP_TP_ADAPTER_TX_QUEUE_SIZE			16
 
-#if (16 < (VSCP_TP_ADAPTER_CAN_RX_MB_COUNT + VSCP_TP_ADAPTER_CAN_TX_MB_COUNT))
+#if (16 < (VSCP_TP_ADAPTER_CAN_RX_FIFO_MB_COUNT + VSCP_TP_ADAPTER_CAN_TX_MB_COUNT))
 	#error Max. number of CAN message buffers exceeded!
 #endif
 
-#if (1 != VSCP_TP_ADAPTER_CAN_TX_MB_COUNT)
-	#error Only one CAN transmit message buffer is supported!
+#if (8 < VSCP_TP_ADAPTER_CAN_TX_MB_COUNT)
+	#error Max. 8 CAN transmit message buffers are supported!
+#endif
+
+#if (0 != (VSCP_TP_ADAPTER_RX_QUEUE_SIZE & (VSCP_TP_ADAPTER_RX_QUEUE_SIZE - 1))) || (128 < VSCP_TP_ADAPTER_RX_QUEUE_SIZE)
+	#error The receive queue size shall be a power of two and max. 128!
+#endif
+
+#if (0 != (VSCP_TP_ADAPTER_TX_QUEUE_SIZE & (VSCP_TP_ADAPTER_TX_QUEUE_SIZE - 1))) || (128 < VSCP_TP_ADAPTER_TX_QUEUE_SIZE)
+	#error The transmit queue size shall be a power of two and max. 128!
+#endif
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) && (VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM < VSCP_CONFIG_ACCEPTANCE_FILTER_NUM)
+	#error The number of acceptance filters exceeds the rx FIFO identifier filter elements!
 #endif
 
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Get the VSCP priority from the 29 bit identifier, 0 is the highest priority. */
+#define VSCP_TP_ADAPTER_GET_PRIORITY(__id)		(((__id) >> 26) & 0x07)
+
+/** Interrupt flags of the transmit message buffers */
+#define VSCP_TP_ADAPTER_CAN_TX_MB_FLAGS			(((1u << VSCP_TP_ADAPTER_CAN_TX_MB_COUNT) - 1u) << VSCP_TP_ADAPTER_CAN_TX_MB_FIRST)
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -86,10 +129,58 @@
     PROTOTYPES
 *******************************************************************************/
 
+static void vscp_tp_adapter_setRxFifoFilter(uint8_t idx, uint32_t id, uint32_t mask);
+static void vscp_tp_adapter_enableRxFifo(void);
+static void vscp_tp_adapter_insertTxQueue(flexcan_frame_t const * const txFrame);
+static uint8_t vscp_tp_adapter_getFreeTxMb(uint32_t id);
+static void vscp_tp_adapter_loadTxMbs(void);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
+/** Identifier filter table of the rx FIFO */
+static uint32_t			vscp_tp_adapter_rxFifoFilterTable[VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM];
+
+/** Receive queue, which is filled by the interrupt */
+static flexcan_frame_t	vscp_tp_adapter_rxQueue[VSCP_TP_ADAPTER_RX_QUEUE_SIZE];
+
+/** Receive queue write index, which is only changed by the interrupt.
+ * The indices run over the whole value range, the difference is the number of
+ * frames in the receive queue.
+ */
+static volatile uint8_t	vscp_tp_adapter_rxQueueWrIdx	= 0;
+
+/** Receive queue read index, which is only changed by vscp_tp_adapter_readMessage(). */
+static volatile uint8_t	vscp_tp_adapter_rxQueueRdIdx	= 0;
+
+/** Number of dropped frames, counted by the interrupt */
+static volatile uint32_t	vscp_tp_adapter_rxDrops			= 0;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+/** Number of dropped frames, which are already added to the statistics */
+static uint32_t			vscp_tp_adapter_rxDropsCounted	= 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+/** Transmit queue, ordered by priority. It is shared with the interrupt and
+ * only accessed with disabled interrupt in thread context.
+ */
+static flexcan_frame_t	vscp_tp_adapter_txQueue[VSCP_TP_ADAPTER_TX_QUEUE_SIZE];
+
+/** Transmit queue read index */
+static uint8_t			vscp_tp_adapter_txQueueRdIdx	= 0;
+
+/** Number of frames in the transmit queue */
+static uint8_t			vscp_tp_adapter_txQueueCount	= 0;
+
+/** Transmit message buffers, which are loaded and not transmitted yet (bit per message buffer) */
+static uint8_t			vscp_tp_adapter_txMbBusy		= 0;
+
+/** Identifier of the frame in every transmit message buffer */
+static uint32_t			vscp_tp_adapter_txMbId[VSCP_TP_ADAPTER_CAN_TX_MB_COUNT];
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -104,7 +195,6 @@
 extern void vscp_tp_adapter_init(void)
 {
     flexcan_config_t		flexcanConfig	= { 0 };
-    flexcan_rx_mb_config_t	mbConfig		= { 0 };
     uint8_t					index			= 0;
 
     /* Init FlexCAN module. */
@@ -119,30 +209,38 @@ extern void vscp_tp_adapter_init(void)
      */
     FLEXCAN_GetDefaultConfig(&flexcanConfig);
 
+    /* Every rx FIFO identifier filter element has its own acceptance mask. */
+    flexcanConfig.enableIndividMask = true;
+
 #if (!defined(FSL_FEATURE_FLEXCAN_SUPPORT_ENGINE_CLK_SEL_REMOVE)) || !FSL_FEATURE_FLEXCAN_SUPPORT_ENGINE_CLK_SEL_REMOVE
     flexcanConfig.clkSrc = kFLEXCAN_ClkSrcPeri;
 #endif /* FSL_FEATURE_FLEXCAN_SUPPORT_ENGINE_CLK_SEL_REMOVE */
 
     FLEXCAN_Init(VSCP_TP_ADAPTER_CAN, &flexcanConfig, VSCP_TP_ADAPTER_CAN_CLK_FREQ);
 
-    /* Setup all rx message buffer. */
-    for(index = 0; index < VSCP_TP_ADAPTER_CAN_RX_MB_COUNT; ++index)
+    /* Setup the rx FIFO, which receives all extended data frames until the
+     * acceptance filters are programmed.
+     */
+    for(index = 0; index < VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM; ++index)
     {
-		mbConfig.format = kFLEXCAN_FrameFormatExtend;
-		mbConfig.type = kFLEXCAN_FrameTypeData;
-		mbConfig.id = FLEXCAN_ID_EXT(0);
-
-		/* Use lower message buffers */
-		FLEXCAN_SetRxMbConfig(VSCP_TP_ADAPTER_CAN, index, &mbConfig, true);
+		vscp_tp_adapter_setRxFifoFilter(index, 0, 0);
     }
 
+    vscp_tp_adapter_enableRxFifo();
+
     /* Setup all tx message buffer. */
     for(index = 0; index < VSCP_TP_ADAPTER_CAN_TX_MB_COUNT; ++index)
     {
-		/* Use upper message buffers */
-		FLEXCAN_SetTxMbConfig(VSCP_TP_ADAPTER_CAN, (VSCP_TP_ADAPTER_CAN_RX_MB_COUNT + index - 1), true);
+		/* Use the message buffers right after the rx FIFO */
+		FLEXCAN_SetTxMbConfig(VSCP_TP_ADAPTER_CAN, VSCP_TP_ADAPTER_CAN_TX_MB_FIRST + index, true);
     }
 
+    /* The interrupt moves the received frames from the rx FIFO to the receive
+     * queue and loads the transmit message buffers from the transmit queue.
+     */
+    FLEXCAN_EnableMbInterrupts(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoFrameAvlFlag | kFLEXCAN_RxFifoOverflowFlag | VSCP_TP_ADAPTER_CAN_TX_MB_FLAGS);
+    EnableIRQ(VSCP_TP_ADAPTER_CAN_MB_IRQN);
+
     return;
 }
 
@@ -156,65 +254,60 @@ extern void vscp_tp_adapter_init(void)
  */
 extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
 {
-    BOOL    		status  = FALSE;
-    static uint8_t	mbIdx	= 0;
+    BOOL    status  = FALSE;
 
     if (NULL != msg)
     {
-    	/* Walk through the receive message buffers and check whether a single message was received? */
-    	do
-    	{
-    		/* Receive message buffer signaled? */
-			if (FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, 1 << mbIdx))
-			{
-				uint8_t 		index   = 0;
-				flexcan_frame_t	rxFrame	= { 0 };
-
-				/* Read CAN message from receive message buffer*/
-				FLEXCAN_ReadRxMb(VSCP_TP_ADAPTER_CAN, mbIdx, &rxFrame);
-
-				/* Build VSCP message */
-	            msg->vscpClass  = (uint16_t)((rxFrame.id >> 16) & 0x01ff);
-	            msg->vscpType   = (uint8_t)((rxFrame.id >> 8) & 0x00ff);
-	            msg->oAddr      = (uint8_t)((rxFrame.id >> 0) & 0x00ff);
-	            msg->hardCoded  = (uint8_t)((rxFrame.id >> 25) & 0x0001);
-	            msg->priority   = (VSCP_PRIORITY)((rxFrame.id >> 26) & 0x0007);
-	            msg->dataSize   = rxFrame.length;
-
-	            for(index = 0; index < msg->dataSize; ++index)
-	            {
-	            	/* Byte 0 - 3 */
-	            	if (4 < index)
-	            	{
-	            		msg->data[index] = (uint8_t)((rxFrame.dataWord0 >> (24 - index * 8)) & 0xff);
-	            	}
-	            	/* Byte 4 - 7 */
-	            	else
-	            	{
-	            		msg->data[index] = (uint8_t)((rxFrame.dataWord0 >> (48 - index * 8)) & 0xff);
-	            	}
-	            }
-
-	            /* Release receive message buffer */
-				FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, 1 << mbIdx);
-
-				status = TRUE;
-			}
-			else
-			{
-				++mbIdx;
-			}
-    	}
-    	while((VSCP_TP_ADAPTER_CAN_RX_MB_COUNT < mbIdx) && (FALSE == status));
+		uint8_t	rdIdx	= vscp_tp_adapter_rxQueueRdIdx;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+		/* The interrupt counts the dropped frames, but the statistics are
+		 * updated here, because they are not interrupt safe.
+		 */
+		uint32_t	rxDrops	= vscp_tp_adapter_rxDrops;
+
+		VSCP_STATS_ADD(VSCP_STATS_CNT_RX_DROPS, rxDrops - vscp_tp_adapter_rxDropsCounted);
+		vscp_tp_adapter_rxDropsCounted = rxDrops;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+		/* Any frame in the receive queue? */
+		if (rdIdx != vscp_tp_adapter_rxQueueWrIdx)
+		{
+			flexcan_frame_t const * const	rxFrame	= &vscp_tp_adapter_rxQueue[rdIdx & (VSCP_TP_ADAPTER_RX_QUEUE_SIZE - 1)];
+			uint32_t						data[2];
 
-    	mbIdx %= VSCP_TP_ADAPTER_CAN_RX_MB_COUNT;
+			/* Read the frame not before the write index. */
+			__DMB();
+
+			/* Build VSCP message */
+			msg->vscpClass  = (uint16_t)((rxFrame->id >> 16) & 0x01ff);
+			msg->vscpType   = (uint8_t)((rxFrame->id >> 8) & 0x00ff);
+			msg->oAddr      = (uint8_t)((rxFrame->id >> 0) & 0x00ff);
+			msg->hardCoded  = (uint8_t)((rxFrame->id >> 25) & 0x0001);
+			msg->priority   = (VSCP_PRIORITY)((rxFrame->id >> 26) & 0x0007);
+			msg->dataSize   = (VSCP_L1_DATA_SIZE < rxFrame->length) ? VSCP_L1_DATA_SIZE : rxFrame->length;
+
+			/* The first data byte is the most significant byte of the data word. */
+			data[0] = __REV(rxFrame->dataWord0);
+			data[1] = __REV(rxFrame->dataWord1);
+			memcpy(msg->data, data, msg->dataSize);
+
+			/* Release the frame not before it is read. */
+			__DMB();
+			vscp_tp_adapter_rxQueueRdIdx = rdIdx + 1;
+
+			status = TRUE;
+		}
     }
 
     return status;
 }
 
 /**
- * This function writes a message to the transport layer.
+ * This function writes a message to the transport layer. The message is
+ * queued and transmitted by interrupt.
  *
  * @param[in]   msg Message storage
  * @return  Message sent or not
@@ -228,9 +321,8 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
     if ((NULL != msg) &&                        /* Message shall exists */
         (VSCP_L1_DATA_SIZE >= msg->dataSize))    /* Number of data bytes is limited */
     {
-    	uint8_t			index	= 0;
     	flexcan_frame_t	txFrame = { 0 };
-    	uint8_t			mbIdx	= VSCP_TP_ADAPTER_CAN_RX_MB_COUNT;	/* Right after the receive message buffers */
+    	uint32_t		data[2]	= { 0, 0 };
 
         txFrame.format = kFLEXCAN_FrameFormatExtend;
         txFrame.type = kFLEXCAN_FrameTypeData;
@@ -241,30 +333,269 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
 									((uint32_t)msg->oAddr));
         txFrame.length = msg->dataSize;
 
-        for(index = 0; index < msg->dataSize; ++index)
-        {
-        	/* Byte 0 - 3 */
-        	if (4 < index)
-        	{
-        		txFrame.dataWord0 |= msg->data[index] << (24 - index * 8);
-        	}
-        	/* Byte 4 - 7 */
-        	else
-        	{
-        		txFrame.dataWord1 |= msg->data[index] << (48 - index * 8);
-        	}
-        }
+        /* The first data byte is the most significant byte of the data word. */
+        memcpy(data, msg->data, msg->dataSize);
+        txFrame.dataWord0 = __REV(data[0]);
+        txFrame.dataWord1 = __REV(data[1]);
 
-        /* Send data through Tx Message Buffer using polling function. */
-        if (kStatus_Success == FLEXCAN_TransferSendBlocking(VSCP_TP_ADAPTER_CAN, mbIdx, &txFrame))
+        /* The transmit queue is shared with the interrupt. */
+        DisableIRQ(VSCP_TP_ADAPTER_CAN_MB_IRQN);
+        __DSB();
+        __ISB();
+
+        if (VSCP_TP_ADAPTER_TX_QUEUE_SIZE > vscp_tp_adapter_txQueueCount)
         {
+        	vscp_tp_adapter_insertTxQueue(&txFrame);
+        	vscp_tp_adapter_loadTxMbs();
+
         	status = TRUE;
         }
+
+        __DSB();
+        EnableIRQ(VSCP_TP_ADAPTER_CAN_MB_IRQN);
     }
 
     return status;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the identifier filter
+ * table of the rx FIFO. Every filter element has its own mask, the filters
+ * are distributed over them. If there are more filters than filter elements,
+ * all frames are received.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_tp_adapter_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+	uint8_t	index	= 0;
+
+	for(index = 0; index < VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM; ++index)
+	{
+		/* No filter or too many filters, receive all extended data frames. */
+		if ((NULL == filters) || (0 == num) || (VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM < num))
+		{
+			vscp_tp_adapter_setRxFifoFilter(index, 0, 0);
+		}
+		/* More filter elements than filters, the filters are used several times. */
+		else
+		{
+			vscp_tp_adapter_setRxFifoFilter(index, filters[index % num].id, filters[index % num].mask);
+		}
+	}
+
+	vscp_tp_adapter_enableRxFifo();
+
+	return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+/**
+ * This function handles the message buffer interrupt of the CAN peripheral
+ * and overrides the weak handler of the startup code. It moves all frames
+ * from the rx FIFO to the receive queue, so the rx FIFO doesn't overflow
+ * even on a fully loaded bus. Transmit message buffers are loaded again from
+ * the transmit queue, as soon as their frame is transmitted.
+ */
+extern void CAN0_ORed_Message_buffer_IRQHandler(void)
+{
+	uint32_t	txFlags	= FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, VSCP_TP_ADAPTER_CAN_TX_MB_FLAGS);
+
+	/* Move all received frames to the receive queue. */
+	while(0 != FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoFrameAvlFlag))
+	{
+		uint8_t	wrIdx	= vscp_tp_adapter_rxQueueWrIdx;
+
+		/* Receive queue full? */
+		if (VSCP_TP_ADAPTER_RX_QUEUE_SIZE <= (uint8_t)(wrIdx - vscp_tp_adapter_rxQueueRdIdx))
+		{
+			flexcan_frame_t	rxFrame;
+
+			/* Drop the frame, but it must be read to release the rx FIFO output. */
+			(void)FLEXCAN_ReadRxFifo(VSCP_TP_ADAPTER_CAN, &rxFrame);
+
+			++vscp_tp_adapter_rxDrops;
+		}
+		else
+		{
+			(void)FLEXCAN_ReadRxFifo(VSCP_TP_ADAPTER_CAN, &vscp_tp_adapter_rxQueue[wrIdx & (VSCP_TP_ADAPTER_RX_QUEUE_SIZE - 1)]);
+
+			/* Publish the frame not before it is written. */
+			__DMB();
+			vscp_tp_adapter_rxQueueWrIdx = wrIdx + 1;
+		}
+
+		/* Clearing the flag moves the next frame to the rx FIFO output. */
+		FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoFrameAvlFlag);
+	}
+
+	/* Frames lost, because the rx FIFO was full? */
+	if (0 != FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoOverflowFlag))
+	{
+		FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoOverflowFlag);
+
+		++vscp_tp_adapter_rxDrops;
+	}
+
+	/* Any frame transmitted? */
+	if (0 != txFlags)
+	{
+		FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, txFlags);
+
+		vscp_tp_adapter_txMbBusy &= (uint8_t)~(txFlags >> VSCP_TP_ADAPTER_CAN_TX_MB_FIRST);
+
+		vscp_tp_adapter_loadTxMbs();
+	}
+
+	/* Complete the flag writes, before the interrupt returns. Otherwise the
+	 * interrupt may be entered again (ARM errata 838869).
+	 */
+	__DSB();
+
+	return;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+/**
+ * This function sets a rx FIFO identifier filter element for extended data
+ * frames. A frame is received, if (identifier & mask) == (id & mask).
+ * It takes effect with the next call of vscp_tp_adapter_enableRxFifo().
+ *
+ * @param[in]   idx     Identifier filter element index
+ * @param[in]   id      29 bit identifier
+ * @param[in]   mask    29 bit mask
+ */
+static void vscp_tp_adapter_setRxFifoFilter(uint8_t idx, uint32_t id, uint32_t mask)
+{
+	vscp_tp_adapter_rxFifoFilterTable[idx] = FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(id & mask, 0, 1);
+
+	/* The frame type and format shall always match. */
+	FLEXCAN_SetRxIndividualMask(VSCP_TP_ADAPTER_CAN, idx, FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(mask, 1, 1));
+
+	return;
+}
+
+/**
+ * This function enables the rx FIFO with the identifier filter table.
+ */
+static void vscp_tp_adapter_enableRxFifo(void)
+{
+	flexcan_rx_fifo_config_t	rxFifoConfig	= { 0 };
+
+	rxFifoConfig.idFilterTable = vscp_tp_adapter_rxFifoFilterTable;
+	rxFifoConfig.idFilterNum = VSCP_TP_ADAPTER_CAN_RX_FIFO_FILTER_NUM;
+	rxFifoConfig.idFilterType = kFLEXCAN_RxFifoFilterTypeA;
+	rxFifoConfig.priority = kFLEXCAN_RxFifoPrioHigh;
+
+	FLEXCAN_SetRxFifoConfig(VSCP_TP_ADAPTER_CAN, &rxFifoConfig, true);
+
+	return;
+}
+
+/**
+ * This function inserts a frame into the transmit queue, behind all frames
+ * with the same or a higher priority. Frames with the same priority keep
+ * their order. The transmit queue shall not be full.
+ *
+ * @param[in]   txFrame Frame
+ */
+static void vscp_tp_adapter_insertTxQueue(flexcan_frame_t const * const txFrame)
+{
+	uint8_t	pos		= vscp_tp_adapter_txQueueCount;
+	uint8_t	prevIdx	= (vscp_tp_adapter_txQueueRdIdx + pos - 1) & (VSCP_TP_ADAPTER_TX_QUEUE_SIZE - 1);
+
+	/* Move all frames with a lower priority one position back. */
+	while((0 < pos) &&
+		  (VSCP_TP_ADAPTER_GET_PRIORITY(txFrame->id) < VSCP_TP_ADAPTER_GET_PRIORITY(vscp_tp_adapter_txQueue[prevIdx].id)))
+	{
+		vscp_tp_adapter_txQueue[(prevIdx + 1) & (VSCP_TP_ADAPTER_TX_QUEUE_SIZE - 1)] = vscp_tp_adapter_txQueue[prevIdx];
+
+		--pos;
+		prevIdx = (prevIdx - 1) & (VSCP_TP_ADAPTER_TX_QUEUE_SIZE - 1);
+	}
+
+	vscp_tp_adapter_txQueue[(vscp_tp_adapter_txQueueRdIdx + pos) & (VSCP_TP_ADAPTER_TX_QUEUE_SIZE - 1)] = *txFrame;
+	++vscp_tp_adapter_txQueueCount;
+
+	return;
+}
+
+/**
+ * This function searches for a free transmit message buffer. The FlexCAN
+ * transmits the frame with the lowest identifier first, but frames with the
+ * same identifier in the order of the message buffer index. Therefore no
+ * message buffer is provided, as long as a frame with the same identifier is
+ * pending, e.g. the previous frame of a multi-frame response.
+ *
+ * @param[in]   id  29 bit identifier of the frame, which shall be loaded
+ * @return  Transmit message buffer index, relative to the first transmit
+ *          message buffer. If none is available,
+ *          VSCP_TP_ADAPTER_CAN_TX_MB_COUNT is returned.
+ */
+static uint8_t vscp_tp_adapter_getFreeTxMb(uint32_t id)
+{
+	uint8_t	freeIdx		= VSCP_TP_ADAPTER_CAN_TX_MB_COUNT;
+	uint8_t	index		= 0;
+	BOOL	isBlocked	= FALSE;
+
+	for(index = 0; (index < VSCP_TP_ADAPTER_CAN_TX_MB_COUNT) && (FALSE == isBlocked); ++index)
+	{
+		if (0 == (vscp_tp_adapter_txMbBusy & (1u << index)))
+		{
+			if (VSCP_TP_ADAPTER_CAN_TX_MB_COUNT == freeIdx)
+			{
+				freeIdx = index;
+			}
+		}
+		else if (id == vscp_tp_adapter_txMbId[index])
+		{
+			isBlocked = TRUE;
+		}
+	}
+
+	if (FALSE != isBlocked)
+	{
+		freeIdx = VSCP_TP_ADAPTER_CAN_TX_MB_COUNT;
+	}
+
+	return freeIdx;
+}
+
+/**
+ * This function loads the frames from the transmit queue into the free
+ * transmit message buffers, in the order of the transmit queue. It is called
+ * by the interrupt or with disabled interrupt.
+ */
+static void vscp_tp_adapter_loadTxMbs(void)
+{
+	BOOL	isLoaded	= TRUE;
+
+	while((0 < vscp_tp_adapter_txQueueCount) && (FALSE != isLoaded))
+	{
+		flexcan_frame_t const * const	txFrame	= &vscp_tp_adapter_txQueue[vscp_tp_adapter_txQueueRdIdx];
+		uint8_t							txMbIdx	= vscp_tp_adapter_getFreeTxMb(txFrame->id);
+
+		isLoaded = FALSE;
+
+		if ((VSCP_TP_ADAPTER_CAN_TX_MB_COUNT > txMbIdx) &&
+			(kStatus_Success == FLEXCAN_WriteTxMb(VSCP_TP_ADAPTER_CAN, VSCP_TP_ADAPTER_CAN_TX_MB_FIRST + txMbIdx, txFrame)))
+		{
+			vscp_tp_adapter_txMbId[txMbIdx] = txFrame->id;
+			vscp_tp_adapter_txMbBusy |= (uint8_t)(1u << txMbIdx);
+
+			vscp_tp_adapter_txQueueRdIdx = (vscp_tp_adapter_txQueueRdIdx + 1) & (VSCP_TP_ADAPTER_TX_QUEUE_SIZE - 1);
+			--vscp_tp_adapter_txQueueCount;
+
+			isLoaded = TRUE;
+		}
+	}
+
+	return;
+}
@@ -30,8 +30,277 @@
 */
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
 #include "canDrv.h"
 
+// Error flags of a transmit MOB
+#define CAN_TXMOB_ERRORS  ( ( 1 << BERR ) | ( 1 << SERR ) | ( 1 << CERR ) | ( 1 << FERR ) | ( 1 << AERR ) )
+
+// Identifier filter of every receive MOB, which is overwritten by a received frame
+static unsigned long canRxMobId[ CAN_RX_MOB_NUM ];
+
+// Receive MOBs, which receive only extended data frames (bit per MOB)
+static unsigned char canRxMobExtended = 0;
+
+// Receive MOB, which is checked first for a received frame
+static unsigned char canRxMobNext = 0;
+
+// Frames, which wait for a free transmit MOB, ordered by priority
+static CANMsg canTxQueue[ CAN_TX_QUEUE_SIZE ];
+
+// Index of the first frame in the transmit queue
+static unsigned char canTxQueueRead = 0;
+
+// Number of frames in the transmit queue
+static unsigned char canTxQueueCount = 0;
+
+// Identifier of the frame in every transmit MOB
+static unsigned long canTxMobId[ CAN_MOB_NUM - CAN_RX_MOB_NUM ];
+
+// Transmit MOBs, which are loaded and not transmitted yet (bit per MOB)
+static unsigned int canTxMobBusy = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// getTxPriority
+//
+// Get the priority of a frame, which are the 3 most significant bits of the
+// identifier. 0 is the highest priority.
+//
+
+static unsigned char getTxPriority( CANMsg *pmsg )
+{
+    if ( pmsg->flags & CAN_IDFLAG_EXTENDED ) {
+        return ( ( pmsg->id >> 26 ) & 0x07 );
+    }
+
+    return ( ( pmsg->id >> 8 ) & 0x07 );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// insertTxQueue
+//
+// Insert a frame into the transmit queue, behind all frames with the same
+// or a higher priority. Frames with the same priority keep their order.
+// The transmit queue shall not be full.
+//
+
+static void insertTxQueue( CANMsg *pmsg )
+{
+    unsigned char pos = canTxQueueCount;
+    unsigned char prio = getTxPriority( pmsg );
+    unsigned char idx = ( canTxQueueRead + pos + CAN_TX_QUEUE_SIZE - 1 ) % CAN_TX_QUEUE_SIZE;
+
+    // Move all frames with a lower priority one position back
+    while ( ( 0 < pos ) && ( prio < getTxPriority( &canTxQueue[ idx ] ) ) ) {
+        canTxQueue[ ( idx + 1 ) % CAN_TX_QUEUE_SIZE ] = canTxQueue[ idx ];
+        pos--;
+        idx = ( idx + CAN_TX_QUEUE_SIZE - 1 ) % CAN_TX_QUEUE_SIZE;
+    }
+
+    canTxQueue[ ( canTxQueueRead + pos ) % CAN_TX_QUEUE_SIZE ] = *pmsg;
+    canTxQueueCount++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// removeTxQueue
+//
+// Remove a frame from the transmit queue. The following frames keep their
+// order.
+//
+
+static void removeTxQueue( unsigned char pos )
+{
+    unsigned char idx = ( canTxQueueRead + pos ) % CAN_TX_QUEUE_SIZE;
+
+    if ( 0 == pos ) {
+        canTxQueueRead = ( canTxQueueRead + 1 ) % CAN_TX_QUEUE_SIZE;
+    }
+    else {
+        // Move all following frames one position forward
+        for ( pos++; pos < canTxQueueCount; pos++ ) {
+            canTxQueue[ idx ] = canTxQueue[ ( idx + 1 ) % CAN_TX_QUEUE_SIZE ];
+            idx = ( idx + 1 ) % CAN_TX_QUEUE_SIZE;
+        }
+    }
+
+    canTxQueueCount--;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// isTxIdPending
+//
+// Check whether a frame with the given identifier is loaded into a transmit
+// MOB and not transmitted yet.
+//
+
+static unsigned char isTxIdPending( unsigned long id )
+{
+    unsigned char i;
+
+    for ( i = 0; i < ( CAN_MOB_NUM - CAN_RX_MOB_NUM ); i++ ) {
+        if ( ( canTxMobBusy & ( 1u << i ) ) && ( id == canTxMobId[ i ] ) ) {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getFreeTxMob
+//
+// Returns the index of a free transmit MOB or CAN_MOB_NUM if all of them
+// are busy.
+//
+
+static unsigned char getFreeTxMob( void )
+{
+    unsigned char i;
+
+    for ( i = 0; i < ( CAN_MOB_NUM - CAN_RX_MOB_NUM ); i++ ) {
+        if ( 0 == ( canTxMobBusy & ( 1u << i ) ) ) {
+            return ( CAN_RX_MOB_NUM + i );
+        }
+    }
+
+    return CAN_MOB_NUM;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// releaseTxMob
+//
+// Disable a transmit MOB and make it free for the next frame.
+//
+
+static void releaseTxMob( unsigned char idx )
+{
+    setMob( idx );
+    CANSTMOB = 0;
+    CANCDMOB = 0;
+
+    canTxMobBusy &= ~( 1u << ( idx - CAN_RX_MOB_NUM ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writeTxMob
+//
+// Write a frame into a transmit MOB and start the transmission.
+//
+
+static void writeTxMob( unsigned char idx, CANMsg *pmsg )
+{
+    unsigned char i;
+
+    // Clear the MOB
+    clrMob( idx );
+
+    // Set Extended flag if needed
+    if ( pmsg->flags & CAN_IDFLAG_EXTENDED ) {
+
+        // Extended frame
+        CANCDMOB = CAN_MASK_EXTENDED + ( pmsg->len & CAN_MASK_SIZE );
+
+        // RTR + id
+        if ( pmsg->flags & CAN_MASK_RTR ) {
+            CANIDT4 =  ( ( pmsg->id & 0x1F ) << 3 ) | CAN_MASK_RTR;
+        }
+        else {
+            CANIDT4 = ( ( pmsg->id & 0x1F ) << 3 );
+        }
+
+        // Set id
+        CANIDT3 =  ( ( pmsg->id >> 5 ) & 0xff );
+        CANIDT2 =  ( ( pmsg->id >> 13 ) & 0xff );
+        CANIDT1 =  ( ( pmsg->id >> 21 ) & 0xff );
+    }
+    else {
+        // Standard frame
+        CANCDMOB = ( pmsg->len & CAN_MASK_SIZE );
+        if ( pmsg->flags & CAN_IDFLAG_RTR ) {
+            CANIDT4 = CAN_MASK_RTR;
+        }
+
+        // Set id
+        CANIDT2 = ( pmsg->id & 0x07 ) << 5;
+        CANIDT1  = pmsg->id >> 3;
+    }
+
+    // Write data
+    for ( i=0; i<pmsg->len; i++ ) {
+        CANMSG = pmsg->byte[ i ];
+    }
+
+    // Send frame
+    CANCDMOB |=  0x40;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// loadTxMobs
+//
+// Load the frames from the transmit queue into the free transmit MOBs. If
+// several MOBs are ready to transmit, the one with the lowest index is
+// transmitted first, independent of the identifier. Therefore a frame is held
+// back, as long as a frame with the same identifier is pending, e.g. the
+// previous frame of a multi-frame response. All other frames are loaded as
+// soon as a transmit MOB is free.
+// Call it only from the CAN interrupt or with disabled interrupts.
+//
+
+static void loadTxMobs( void )
+{
+    unsigned char pos = 0;
+    unsigned char idx;
+    unsigned char mob;
+
+    while ( pos < canTxQueueCount ) {
+        idx = ( canTxQueueRead + pos ) % CAN_TX_QUEUE_SIZE;
+
+        // Keep the order of frames with the same identifier
+        if ( isTxIdPending( canTxQueue[ idx ].id ) ) {
+            pos++;
+        }
+        else {
+            mob = getFreeTxMob();
+
+            if ( CAN_MOB_NUM <= mob ) {
+                break;
+            }
+
+            writeTxMob( mob, &canTxQueue[ idx ] );
+
+            canTxMobId[ mob - CAN_RX_MOB_NUM ] = canTxQueue[ idx ].id;
+            canTxMobBusy |= ( 1u << ( mob - CAN_RX_MOB_NUM ) );
+
+            removeTxQueue( pos );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// enableRxMob
+//
+// Make a receive MOB ready to receive again, the identifier filter is
+// restored.
+//
+
+static void enableRxMob( unsigned char idx )
+{
+    setMob( idx );
+    CANSTMOB = 0;
+
+    if ( canRxMobExtended & ( 1 << idx ) ) {
+        CANIDT4 = ( ( canRxMobId[ idx ] & 0x1F ) << 3 );
+        CANIDT3 = ( ( canRxMobId[ idx ] >> 5 ) & 0xff );
+        CANIDT2 = ( ( canRxMobId[ idx ] >> 13 ) & 0xff );
+        CANIDT1 = ( ( canRxMobId[ idx ] >> 21 ) & 0xff );
+        CANCDMOB = 0x80 | CAN_MASK_EXTENDED;
+    }
+    else {
+        CANCDMOB = 0x80;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // clrMob
 //
@@ -73,8 +342,8 @@ void clrAllMob( void )
 ///////////////////////////////////////////////////////////////////////////////
 // getFreeMob
 //
-// We use the first MOB for reciption so the search is
-// started from MOB == 1
+// We use the first MOBs for reciption so the search is
+// started from MOB == CAN_RX_MOB_NUM
 //
 // Returns ERROR_BUFFER_FULL if no free Mob available.
 //
@@ -85,7 +354,7 @@ int getFreeMob( void )
     int i;
 
     Save_page = CANPAGE;
-    for ( i = 1; i < 15; i++ ) {
+    for ( i = CAN_RX_MOB_NUM; i < 15; i++ ) {
         setMob( i );
         if ( !( CANCDMOB & 0xC0 ) ) { // Disabled?
             CANPAGE = Save_page;
@@ -114,6 +383,7 @@ int can_Open( unsigned char StdSpeed,
                 unsigned char Btr2 )
 {
      unsigned char set_btr0, set_btr1, set_btr2;
+     unsigned char i;
 
      // Timing
      switch ( StdSpeed ) {
@@ -190,9 +460,20 @@ int can_Open( unsigned char StdSpeed,
      // Clear all MOB's
      clrAllMob();
 
-     // MOB 0 is for reception - enable it for receive
-     setMob( 0 );
-     CANCDMOB |= 0x80;
+     // The first MOBs are for reception - enable them for receive
+     canRxMobExtended = 0;
+     canRxMobNext = 0;
+     for ( i = 0; i < CAN_RX_MOB_NUM; i++ ) {
+        enableRxMob( i );
+     }
+
+     // The transmit MOBs are loaded by the transmit interrupt
+     canTxQueueRead = 0;
+     canTxQueueCount = 0;
+     canTxMobBusy = 0;
+     CANIE2 = ( 0xff << CAN_RX_MOB_NUM ) & 0xff;
+     CANIE1 = 0x7f;
+     CANGIE = ( 1 << ENIT ) | ( 1 << ENBOFF ) | ( 1 << ENTX ) | ( 1 << ENERR );
 
      CANGCON |= 2;
 
@@ -209,6 +490,7 @@ int can_Open( unsigned char StdSpeed,
 
 int can_Close( void )
 {
+     CANGIE = 0;
      CANGCON &= 0xfd;
      return ERROR_OK;
 }
@@ -216,65 +498,26 @@ int can_Close( void )
 ///////////////////////////////////////////////////////////////////////////////
 // can_SendFrame
 //
+// The frame is put into the transmit queue and transmitted by interrupt.
+//
 // Return value:
-
+// ERROR_BUFFER_FULL if the transmit queue is full.
 //
 
 int can_SendFrame( CANMsg *pmsg )
 {
-    int mobIdx;
-    int i;
-
-    if ( ERROR_BUFFER_FULL == ( mobIdx = getFreeMob() ) ) {
-        return ERROR_BUFFER_FULL;
-    }
-
-    // Select the free MOB
-    setMob( mobIdx ); // Not needed done is clrMob below
-
-    // Clear the MOB
-    clrMob( mobIdx );
-
-    // Set Extended flag if needed
-    if ( pmsg->flags & CAN_IDFLAG_EXTENDED ) {
-
-        // Extended frame
-        CANCDMOB = CAN_MASK_EXTENDED + ( pmsg->len & CAN_MASK_SIZE );
-
-        // RTR + id
-        if ( pmsg->flags & CAN_MASK_RTR ) {
-            CANIDT4 =  ( ( pmsg->id & 0x1F ) << 3 ) | CAN_MASK_RTR;
-        }
-        else {
-            CANIDT4 = ( ( pmsg->id & 0x1F ) << 3 );
-        }
-
-        // Set id
-        CANIDT3 =  ( ( pmsg->id >> 5 ) & 0xff );
-        CANIDT2 =  ( ( pmsg->id >> 13 ) & 0xff );
-        CANIDT1 =  ( ( pmsg->id >> 21 ) & 0xff );
-    }
-    else {
-        // Standard frame
-        CANCDMOB = ( pmsg->len & CAN_MASK_SIZE );
-        if ( pmsg->flags & CAN_IDFLAG_RTR ) {
-            CANIDT4 = CAN_MASK_RTR;
+    int rv = ERROR_BUFFER_FULL;
+
+    // The transmit queue is shared with the CAN interrupt
+    ATOMIC_BLOCK( ATOMIC_RESTORESTATE ) {
+        if ( CAN_TX_QUEUE_SIZE > canTxQueueCount ) {
+            insertTxQueue( pmsg );
+            loadTxMobs();
+            rv = ERROR_OK;
         }
-
-        // Set id
-        CANIDT2 = ( pmsg->id & 0x07 ) << 5;
-        CANIDT1  = pmsg->id >> 3;
-    }
-
-    // Write data
-    for ( i=0; i<pmsg->len; i++ ) {
-        CANMSG = pmsg->byte[ i ];
     }
 
-    // Send frame
-    CANCDMOB |=  0x40;
-
-    return ERROR_OK;
+    return rv;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -285,15 +528,25 @@ int can_readFrame( CANMsg *pmsg )
 {
     int rv = ERROR_OK;
     unsigned char i;
+    unsigned char idx;
+    unsigned char cnt;
+
+    // Check the receive MOBs for a frame, starting behind the last one read
+    idx = canRxMobNext;
+    for ( cnt = 0; cnt < CAN_RX_MOB_NUM; cnt++ ) {
+        setMob( idx );
+        if ( CANSTMOB & 0x20 ) {
+            break;
+        }
+        idx = ( idx + 1 ) % CAN_RX_MOB_NUM;
+    }
 
-    // Select receive MOB
-    setMob( 0 );
-
-    // Check for frame
-    if ( !( CANSTMOB & 0x20 ) ) {
+    if ( CAN_RX_MOB_NUM <= cnt ) {
         return ERROR_BUFFER_EMPTY;
     }
 
+    canRxMobNext = ( idx + 1 ) % CAN_RX_MOB_NUM;
+
     pmsg->flags = 0;
     pmsg->id = 0;
     pmsg->len = 0;
@@ -322,9 +575,8 @@ int can_readFrame( CANMsg *pmsg )
         pmsg->byte[ i ] = CANMSG;
     }
 
-    // Make the MOB ready to receive again
-    clrMob( 0 );
-    CANCDMOB |= 0x80;
+    // Make the MOB ready to receive again, without losing its filter
+    enableRxMob( idx );
 
     return rv;
 }
@@ -382,3 +634,72 @@ int can_setMask( unsigned char Mask0,
 
     return rv;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// can_setMobFilter
+//
+// Set the filter of a receive MOB for extended data frames. A frame is
+// received, if ( frame id & mask ) == ( id & mask ).
+//
+
+int can_setMobFilter( unsigned char idx,
+                        unsigned long id,
+                        unsigned long mask )
+{
+    if ( CAN_RX_MOB_NUM <= idx ) {
+        return ERROR_BUFFER_FULL;
+    }
+
+    // Disable the MOB while it is changed
+    setMob( idx );
+    CANCDMOB = 0;
+
+    canRxMobId[ idx ] = id & mask;
+    canRxMobExtended |= ( 1 << idx );
+
+    // RTR and IDE flag shall always match
+    CANIDM4 = ( ( mask & 0x1F ) << 3 ) | CAN_MASK_RTR | 0x01;
+    CANIDM3 = ( ( mask >> 5 ) & 0xff );
+    CANIDM2 = ( ( mask >> 13 ) & 0xff );
+    CANIDM1 = ( ( mask >> 21 ) & 0xff );
+
+    enableRxMob( idx );
+
+    return ERROR_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CAN interrupt
+//
+// Release the transmitted MOBs and load them again from the transmit queue.
+// A MOB with a transmit error is aborted and its frame is dropped, because
+// otherwise it would block the frames with the same identifier. After bus off
+// all pending MOBs are aborted.
+//
+
+ISR( CANIT_vect )
+{
+    unsigned char savePage = CANPAGE;
+    unsigned char busOff = FALSE;
+    unsigned char i;
+
+    if ( CANGIT & ( 1 << BOFFIT ) ) {
+        CANGIT = ( 1 << BOFFIT );
+        busOff = TRUE;
+    }
+
+    for ( i = CAN_RX_MOB_NUM; i < CAN_MOB_NUM; i++ ) {
+        if ( canTxMobBusy & ( 1u << ( i - CAN_RX_MOB_NUM ) ) ) {
+            setMob( i );
+
+            // Transmitted or failed?
+            if ( busOff || ( CANSTMOB & ( ( 1 << TXOK ) | CAN_TXMOB_ERRORS ) ) ) {
+                releaseTxMob( i );
+            }
+        }
+    }
+
+    loadTxMobs();
+
+    CANPAGE = savePage;
+}
@@ -30,8 +30,9 @@
 */
 
 /*
- *  MOB = 0 is used for receiption.
- *  MOB = 1-14 is used for transmission.
+ *  MOB = 0 - (CAN_RX_MOB_NUM - 1) is used for receiption.
+ *  MOB = CAN_RX_MOB_NUM - 14 is used for transmission. The transmit MOBs
+ *  are loaded from a transmit queue by the CAN interrupt.
  */
 
 
@@ -203,6 +204,27 @@
 
 #define MOB_RECEIVE     0   // MOB used to receive frames
 
+// Number of MOBs used to receive frames, every MOB has its own filter
+#ifndef CAN_RX_MOB_NUM
+#define CAN_RX_MOB_NUM  4
+#endif
+
+#if ( 1 > CAN_RX_MOB_NUM ) || ( 8 < CAN_RX_MOB_NUM )
+#error CAN_RX_MOB_NUM shall be in the range of 1 - 8
+#endif
+
+// Number of MOBs
+#define CAN_MOB_NUM     15
+
+// Number of frames in the transmit queue, which wait for a free transmit MOB
+#ifndef CAN_TX_QUEUE_SIZE
+#define CAN_TX_QUEUE_SIZE   8
+#endif
+
+#if ( 1 > CAN_TX_QUEUE_SIZE ) || ( 255 < CAN_TX_QUEUE_SIZE )
+#error CAN_TX_QUEUE_SIZE shall be in the range of 1 - 255
+#endif
+
 // Masks for AT90CAN128
 #define CAN_MASK_RTR        0x04
 #define CAN_MASK_EXTENDED   0x10
@@ -264,6 +286,9 @@ int can_setMask( unsigned char Mask0,
                     unsigned char Mask1,
                     unsigned char Mask2,
                     unsigned char Mask3 );
+int can_setMobFilter( unsigned char idx,
+                        unsigned long id,
+                        unsigned long mask );
 
 
 #endif // CAN_AT90CAN1238
@@ -67,6 +67,9 @@ extern "C"
 
 #define VSCP_CONFIG_HEARTBEAT_NODE              VSCP_CONFIG_BASE_ENABLED
 
+/* Acceptance filters in the receive MOBs, see vscp_tp_adapter.c */
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_ENABLED
+
 /* ---------- Define here your preferred configuration setup. ---------- */
 
 /*
@@ -110,6 +113,9 @@ extern "C"
 
 /* ---------- Define here your preferred configuration setup. ---------- */
 
+/* One filter per receive MOB, see CAN_RX_MOB_NUM */
+#define VSCP_CONFIG_ACCEPTANCE_FILTER_NUM       4
+
 #define VSCP_CONFIG_DM_PAGE                     1
 
 #define VSCP_CONFIG_DM_OFFSET                   0
@@ -48,6 +48,15 @@
     COMPILER SWITCHES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/* Every receive MOB has only one filter, therefore more filters can't be programmed. */
+#if (CAN_RX_MOB_NUM < VSCP_CONFIG_ACCEPTANCE_FILTER_NUM)
+#error The number of acceptance filters exceeds the number of receive MOBs (CAN_RX_MOB_NUM).
+#endif  /* (CAN_RX_MOB_NUM < VSCP_CONFIG_ACCEPTANCE_FILTER_NUM) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
@@ -194,6 +203,39 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
     return status;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the receive MOBs.
+ * Every receive MOB has its own mask, the filters are distributed over them.
+ * If there are more filters than receive MOBs, all frames are received.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_tp_adapter_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < CAN_RX_MOB_NUM; ++index)
+    {
+        /* No filter or too many filters, receive all extended data frames. */
+        if ((NULL == filters) || (0 == num) || (CAN_RX_MOB_NUM < num))
+        {
+            (void)can_setMobFilter(index, 0, 0);
+        }
+        /* More MOBs than filters, the filters are used several times. */
+        else
+        {
+            (void)can_setMobFilter(index, filters[index % num].id, filters[index % num].mask);
+        }
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -121,6 +121,19 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg);
  */
 extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the receive MOBs.
+ * Every receive MOB has its own mask, the filters are distributed over them.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_tp_adapter_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,226 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Main entry point
+@file   main.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the main entry point of the Linux SocketCAN example.
+
+Usage: vscpSocketCan [interface]
+
+The interface is e.g. can0 or vcan0 (default). SIGUSR1 starts the node
+segment initialization, like the segment initialization button.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <signal.h>
+#include <poll.h>
+#include <time.h>
+#include "vscp_core.h"
+#include "vscp_timer.h"
+#include "vscp_tp_adapter.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. time in ms to wait for received frames */
+#define MAIN_POLL_TIMEOUT   10
+
+/** Max. number of processed events per cycle, before the timers are processed */
+#define MAIN_PROCESS_MAX    64
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void main_signalHandler(int signalId);
+static uint32_t main_getMillis(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Main loop runs as long as this flag is set */
+static volatile sig_atomic_t    main_isRunning      = 1;
+
+/** Segment initialization requested */
+static volatile sig_atomic_t    main_isSegInitReq   = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Main entry point.
+ *
+ * @param[in] argc  Number of arguments
+ * @param[in] argv  Arguments
+ * @return Exit code
+ */
+int main(int argc, char* argv[])
+{
+    uint32_t    lastMillis  = 0;
+
+    if (1 < argc)
+    {
+        vscp_tp_adapter_setInterface(argv[1]);
+    }
+
+    (void)signal(SIGINT, main_signalHandler);
+    (void)signal(SIGTERM, main_signalHandler);
+    (void)signal(SIGUSR1, main_signalHandler);
+
+    printf("VSCP framework %s\n", VSCP_CORE_FRAMEWORK_VERSION);
+    printf("VSCP %s\n\n", VSCP_CORE_VERSION_STR);
+
+    /* Initialize VSCP framework, which initializes the transport adapter too. */
+    if (VSCP_CORE_RET_OK != vscp_core_init())
+    {
+        fprintf(stderr, "Failed to initialize the VSCP framework.\n");
+        return 1;
+    }
+
+    if (0 > vscp_tp_adapter_getFd())
+    {
+        return 1;
+    }
+
+    lastMillis = main_getMillis();
+
+    while(0 != main_isRunning)
+    {
+        struct pollfd   pfd;
+        uint32_t        now     = 0;
+        uint8_t         count   = 0;
+
+        pfd.fd      = vscp_tp_adapter_getFd();
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+
+        /* Pending frames to send? Wait until the socket is writeable again. */
+        if (FALSE == vscp_tp_adapter_flush())
+        {
+            pfd.events |= POLLOUT;
+        }
+
+        (void)poll(&pfd, 1, MAIN_POLL_TIMEOUT);
+
+        /* Process all received events, but limited to keep the timers running. */
+        while((MAIN_PROCESS_MAX > count) &&
+              (TRUE == vscp_core_process()))
+        {
+            (void)vscp_tp_adapter_flush();
+            ++count;
+        }
+
+        (void)vscp_tp_adapter_flush();
+
+        /* Initialize the VSCP segment, because the user requested it? */
+        if (0 != main_isSegInitReq)
+        {
+            main_isSegInitReq = 0;
+            vscp_core_startNodeSegmentInit();
+        }
+
+        /* Process VSCP timers */
+        now = main_getMillis();
+
+        if (now != lastMillis)
+        {
+            vscp_timer_process((uint16_t)(now - lastMillis));
+            lastMillis = now;
+        }
+    }
+
+    (void)vscp_tp_adapter_flush();
+
+    return 0;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Signal handler.
+ *
+ * @param[in] signalId  Signal id
+ */
+static void main_signalHandler(int signalId)
+{
+    if (SIGUSR1 == signalId)
+    {
+        main_isSegInitReq = 1;
+    }
+    else
+    {
+        main_isRunning = 0;
+    }
+
+    return;
+}
+
+/**
+ * Get the monotonic time in ms.
+ *
+ * @return Time in ms
+ */
+static uint32_t main_getMillis(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)now.tv_sec * 1000u + (uint32_t)(now.tv_nsec / 1000000);
+}
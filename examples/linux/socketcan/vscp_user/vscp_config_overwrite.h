@@ -0,0 +1,248 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP configuration overwrite
+@file   vscp_config_overwrite.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the configuration preferred by the user. It overwrites the
+default configuration in vscp_config.h
+
+*******************************************************************************/
+/** @defgroup vscp_config_overwrite VSCP configuration overwrite
+ * This module contains the configuration preferred by the user. It overwrites the
+ * default configuration in vscp_config.h
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CONFIG_OVERWRITE_H__
+#define __VSCP_CONFIG_OVERWRITE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/* ---------- Define here your preferred configuration setup. ---------- */
+
+/* Receive timestamps of the kernel, see vscp_tp_adapter.c */
+#define VSCP_CONFIG_ENABLE_RX_TIMESTAMP         VSCP_CONFIG_BASE_ENABLED
+
+/* Acceptance filters in the kernel, see vscp_tp_adapter.c */
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_ENABLED
+
+/*
+#define VSCP_CONFIG_ENABLE_LOGGER               VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_SILENT_NODE                 VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_HARD_CODED_NODE             VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_HEARTBEAT_NODE              VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER     VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_IDLE_CALLOUT                VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ERROR_CALLOUT               VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_BOOT_LOADER_SUPPORTED       VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_BOOT_LOADER_ENGINE          VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_DM                   VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_DM_PAGED_FEATURE            VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_DM_EXTENSION         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOOPBACK             VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT     VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_BULK_WRITE           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_GUID_START  VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE_GUID      VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_TIME_SERVICE         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_L2                   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_EMBEDDED_MDF         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_BUFFER        VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_TRACE         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_PERF_PROBES          VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_STATS                VSCP_CONFIG_BASE_DISABLED
+
+*/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/* ---------- Define here your preferred configuration setup. ---------- */
+
+/* Number of kernel acceptance filters, see VSCP_TP_ADAPTER_FILTER_NUM */
+#define VSCP_CONFIG_ACCEPTANCE_FILTER_NUM       16
+
+/*
+
+#define VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT   ((uint16_t)5000)
+
+#define VSCP_CONFIG_PROBE_ACK_TIMEOUT           ((uint16_t)2000)
+
+#define VSCP_CONFIG_MULTI_MSG_TIMEOUT           ((uint16_t)1000)
+
+#define VSCP_CONFIG_MULTI_FRAME_RSP_BURST       8
+
+#define VSCP_CONFIG_MULTI_FRAME_RSP_PACING      ((uint16_t)0)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_JITTER       ((uint16_t)3000)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX 3
+
+#define VSCP_CONFIG_BOOT_BLOCK_SIZE             ((uint16_t)256)
+
+#define VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW       8
+
+#define VSCP_CONFIG_BULK_WRITE_SIZE             ((uint16_t)128)
+
+#define VSCP_CONFIG_BULK_WRITE_ACK_WINDOW       8
+
+#define VSCP_CONFIG_BULK_WRITE_TIMEOUT          ((uint8_t)5)
+
+#define VSCP_CONFIG_LOGGER_BUFFER_NUM           16
+
+#define VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE     2
+
+#define VSCP_CONFIG_LOGGER_RATE_LIMIT           ((uint8_t)10)
+
+#define VSCP_CONFIG_LOGGER_RATE_BURST           ((uint8_t)20)
+
+#define VSCP_CONFIG_LOGGER_TRACE_ID             ((uint8_t)0xFF)
+
+#define VSCP_CONFIG_PERF_PAGE                   ((uint16_t)0xFFF1)
+
+#define VSCP_CONFIG_PERF_HIST_SHIFT             6
+
+#define VSCP_CONFIG_STATS_PAGE                  ((uint16_t)0xFFF0)
+
+#define VSCP_CONFIG_STATS_LATENCY_SHIFT         8
+
+#define VSCP_CONFIG_NODE_TABLE_EXPIRY           ((uint16_t)180)
+
+#define VSCP_CONFIG_NODE_TABLE_SWEEP_NUM        4
+
+#define VSCP_CONFIG_L2_DATA_SIZE                512
+
+#define VSCP_CONFIG_TIME_REF_LATENCY            1
+
+#define VSCP_CONFIG_TIME_STEP_THRESHOLD         1000
+
+#define VSCP_CONFIG_TIME_SLEW_DIV               20
+
+#define VSCP_CONFIG_TIME_DRIFT_WINDOW           60
+
+#define VSCP_CONFIG_TIME_DRIFT_MAX              500
+
+#define VSCP_CONFIG_DM_PAGE                     1
+
+#define VSCP_CONFIG_DM_OFFSET                   0
+
+#define VSCP_CONFIG_DM_ROWS                     10
+
+#define VSCP_CONFIG_DM_NG_PAGE                  2
+
+#define VSCP_CONFIG_DM_NG_RULE_SET_SIZE         80
+
+#define VSCP_CONFIG_LOOPBACK_STORAGE_NUM        4
+
+#define VSCP_CONFIG_START_NODE_PROBE_NICKNAME   1
+
+*/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CONFIG_OVERWRITE_H__ */
+
+/** @} */
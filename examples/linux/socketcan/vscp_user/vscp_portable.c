@@ -0,0 +1,403 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP portable support package
+@file   vscp_portable.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_portable.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_portable.h"
+#include "vscp_core.h"
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes this module.
+ */
+extern void vscp_portable_init(void)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+/**
+ * Restore the application specific factory default settings.
+ */
+extern void vscp_portable_restoreFactoryDefaultSettings(void)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+/**
+ * This function set the current lamp state.
+ *
+ * @param[in]   state   Lamp state to set
+ */
+extern void vscp_portable_setLampState(VSCP_LAMP_STATE state)
+{
+    switch(state)
+    {
+    case VSCP_LAMP_STATE_OFF:
+        printf("Lamp: off\n");
+        break;
+
+    case VSCP_LAMP_STATE_ON:
+        printf("Lamp: on\n");
+        break;
+
+    case VSCP_LAMP_STATE_BLINK_SLOW:
+        printf("Lamp: blink slow\n");
+        break;
+
+    case VSCP_LAMP_STATE_BLINK_FAST:
+        printf("Lamp: blink fast\n");
+        break;
+
+    default:
+        break;
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT )
+
+/**
+ * If VSCP stops its work and enters idle state, this function will be called.
+ */
+extern void vscp_portable_idleStateEntered(void)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ERROR_CALLOUT )
+
+/**
+ * If VSCP stops its work and enters error state, this function will be called.
+ */
+extern void vscp_portable_errorStateEntered(void)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ERROR_CALLOUT ) */
+
+/**
+ * This function requests a reset.
+ * It requests it and doesn't expect that it will be immediately.
+ * Because the application needs time to change to a safe state before.
+ */
+extern void vscp_portable_resetRequest(void)
+{
+    printf("Reset requested.\n");
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
+
+/**
+ * This function returns the supported boot loader algorithm.
+ *
+ * @return  Boot loader algorithm
+ * @retval  0xFF    No boot loader supported
+ */
+extern uint8_t  vscp_portable_getBootLoaderAlgorithm(void)
+{
+    uint8_t algorithm   = 0xFF;
+
+    /* Implement your code here ... */
+
+    return algorithm;
+}
+
+/**
+ * This function requests a jump to the bootloader.
+ * It requests it and doesn't expect that it will be immediately.
+ * Because the application needs time to change to a safe state before.
+ */
+extern void vscp_portable_bootLoaderRequest(void)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+
+/**
+ * This function provides received VSCP events, except the PROTOCOL class.
+ *
+ * @param[in]   msg Message
+ */
+extern void vscp_portable_provideEvent(vscp_RxMessage const * const msg)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/**
+ * This function provides received level 2 events, which are not handled by
+ * the core, e.g. because they are not level 1 events over level 2 addressed
+ * to this node.
+ *
+ * @param[in]   msg Level 2 message
+ */
+extern void vscp_portable_provideL2Event(vscp_L2RxMessage const * const msg)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION )
+
+/**
+ * This function provides received VSCP PROTOCOL class events.
+ *
+ * Attention: Handling events which the core is waiting for can cause bad
+ * behaviour.
+ * 
+ * @param[in]   msg Message
+ * 
+ * @return Event handled or not. If application handles event, the core won't handle it.
+ * @retval FALSE    Event not handled
+ * @retval TRUE     Event handled
+ */
+extern BOOL vscp_portable_provideProtocolEvent(vscp_RxMessage const * const msg)
+{
+    BOOL isEventHandled = FALSE;
+
+    /* Implement your code here ... */
+
+    return isEventHandled;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT )
+
+/**
+ * This function is called for every received segment master heartbeat event,
+ * in case it contains a new time since epoch.
+ * 
+ * @param timestamp Unix timestamp
+ */
+extern void vscp_portable_updateTimeSinceEpoch(uint32_t timestamp)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT )
+
+/**
+ * This function returns one byte of the GUID, which is selected by the index.
+ * Index 0 corresponds with the GUID LSB byte, index 15 with the GUID MSB byte.
+ * 
+ * Note, this function can be used to get the MCU stored GUID.
+ *
+ * @param[in]   index   Index in the GUID [0-15]
+ * @return  GUID byte
+ */
+extern uint8_t  vscp_portable_readGUID(uint8_t index)
+{
+    uint8_t value = 0;
+
+    /* Implement your code here ... */
+
+    return value;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT )
+
+/**
+ * Custom node heartbeat event function implementation.
+ *
+ * @return Status
+ * @retval FALSE Failed to send the event
+ * @retval TRUE  Event successul sent
+ */
+extern BOOL vscp_portable_sendNodeHeartbeatEvent() {
+   
+    /* Implement your version of vscp_information_sendNodeHeartbeatEvent() */
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/**
+ * Get the current value of a free running cycle counter, which is used by the
+ * performance probes. It shall have the highest available resolution and may
+ * overflow.
+ *
+ * @return Cycle counter value
+ */
+extern uint32_t vscp_portable_getCycleCount(void)
+{
+    uint32_t    count   = 0;
+
+    /* Implement your code here ... */
+
+    return count;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+/**
+ * Get the current value of a free running millisecond counter, which drives
+ * the time service. It may overflow.
+ *
+ * @return Millisecond counter value
+ */
+extern uint32_t vscp_portable_getMillis(void)
+{
+    uint32_t    millis  = 0;
+
+    /* Implement your code here ... */
+
+    return millis;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+/**
+ * Get the current value of a free running microsecond counter, which is used
+ * for the receive timestamps. It may overflow.
+ *
+ * @return Microsecond counter value
+ */
+extern uint32_t vscp_portable_getMicros(void)
+{
+    uint32_t        micros  = 0;
+    struct timespec now;
+
+    /* Same clock as the kernel receive timestamps, see vscp_tp_adapter.c */
+    if (0 == clock_gettime(CLOCK_REALTIME, &now))
+    {
+        micros = (uint32_t)now.tv_sec * 1000000u + (uint32_t)(now.tv_nsec / 1000);
+    }
+
+    return micros;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
+/**
+ * Read a byte of the embedded MDF blob, which is generated by
+ * tools/scripts/vscp_mdf_compress.py and usually stored in flash.
+ * If no embedded MDF is available, 0 shall be returned.
+ *
+ * @param[in] index Index in the blob
+ *
+ * @return Value
+ */
+extern uint8_t vscp_portable_readEmbeddedMdf(uint16_t index)
+{
+    uint8_t value   = 0;
+
+    /* Implement your code here, e.g. value = pgm_read_byte(&vscp_mdf_blob[index]); */
+
+    return value;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
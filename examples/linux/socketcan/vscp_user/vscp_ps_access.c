@@ -0,0 +1,224 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP persistent memory access driver
+@file   vscp_ps_access.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_ps_access.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_ps_access.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Size of the persistent memory in byte */
+#define VSCP_PS_ACCESS_SIZE     1024
+
+/** File, which contains the persistent memory image */
+#ifndef VSCP_PS_ACCESS_FILE
+#define VSCP_PS_ACCESS_FILE     "vscp_ps.bin"
+#endif  /* VSCP_PS_ACCESS_FILE */
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_ps_access_save(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Persistent memory image, an erased EEPROM contains 0xFF */
+static uint8_t  vscp_ps_access_memory[VSCP_PS_ACCESS_SIZE];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the persistent memory access driver.
+ * It doesn't write anything in the persistent memory! It only initializes
+ * the module that read/write access is possible.
+ */
+extern void vscp_ps_access_init(void)
+{
+    FILE*   file    = fopen(VSCP_PS_ACCESS_FILE, "rb");
+
+    memset(vscp_ps_access_memory, 0xFF, sizeof(vscp_ps_access_memory));
+
+    if (NULL != file)
+    {
+        (void)fread(vscp_ps_access_memory, 1, sizeof(vscp_ps_access_memory), file);
+        (void)fclose(file);
+    }
+
+    return;
+}
+
+/**
+ * Read a single byte from the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @return  Value
+ */
+extern uint8_t  vscp_ps_access_read8(uint16_t addr)
+{
+    uint8_t data    = 0xFF;
+
+    if (VSCP_PS_ACCESS_SIZE > addr)
+    {
+        data = vscp_ps_access_memory[addr];
+    }
+
+    return data;
+}
+
+/**
+ * Write a single byte to the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   value   Value to write
+ */
+extern void vscp_ps_access_write8(uint16_t addr, uint8_t value)
+{
+    if ((VSCP_PS_ACCESS_SIZE > addr) &&
+        (value != vscp_ps_access_memory[addr]))
+    {
+        vscp_ps_access_memory[addr] = value;
+        vscp_ps_access_save();
+    }
+
+    return;
+}
+
+/**
+ * Read several bytes from the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   buffer  Buffer which to read in
+ * @param[in]   size    Buffer size in byte (Number of data to read)
+ */
+extern void vscp_ps_access_readMultiple(uint16_t addr, uint8_t* const buffer, uint8_t size)
+{
+    /* Note, this function uses single byte access by default.
+     * If necessary, adapt this for optimized access according to your needs.
+     */
+    if ((NULL != buffer) &&
+        (0 < size))
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < size; ++index)
+        {
+            buffer[index] = vscp_ps_access_read8(addr + index);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Write several bytes to the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   buffer  Buffer which to write
+ * @param[in]   size    Bufer size in byte (Number of data to write)
+ */
+extern void vscp_ps_access_writeMultiple(uint16_t addr, const uint8_t* const buffer, uint8_t size)
+{
+    /* Note, this function uses single byte access by default.
+     * If necessary, adapt this for optimized access according to your needs.
+     */
+    if ((NULL != buffer) &&
+        (0 < size))
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < size; ++index)
+        {
+            vscp_ps_access_write8(addr + index, buffer[index]);
+        }
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Write the persistent memory image to the file.
+ */
+static void vscp_ps_access_save(void)
+{
+    FILE*   file    = fopen(VSCP_PS_ACCESS_FILE, "wb");
+
+    if (NULL == file)
+    {
+        perror(VSCP_PS_ACCESS_FILE);
+    }
+    else
+    {
+        (void)fwrite(vscp_ps_access_memory, 1, sizeof(vscp_ps_access_memory), file);
+        (void)fclose(file);
+    }
+
+    return;
+}
@@ -0,0 +1,602 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP transport layer adapter
+@file   vscp_tp_adapter.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_tp_adapter.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+
+/* recvmmsg() and sendmmsg() are GNU extensions. */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  /* _GNU_SOURCE */
+
+#include "vscp_tp_adapter.h"
+#include "vscp_config.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/** Use the raw hardware receive timestamp of the CAN controller instead of
+ * the kernel timestamp. Enable it only, if vscp_portable_getMicros() is based
+ * on the clock of the CAN controller.
+ */
+#ifndef VSCP_TP_ADAPTER_HW_TIMESTAMP
+#define VSCP_TP_ADAPTER_HW_TIMESTAMP    0
+#endif  /* VSCP_TP_ADAPTER_HW_TIMESTAMP */
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Default SocketCAN interface */
+#define VSCP_TP_ADAPTER_IFNAME_DEFAULT  "vcan0"
+
+/** Max. number of frames, which are received at once */
+#define VSCP_TP_ADAPTER_RX_BATCH        32
+
+/** Max. number of frames, which are sent at once */
+#define VSCP_TP_ADAPTER_TX_BATCH        32
+
+/** Socket receive buffer size in byte, which buffers bursts of a saturated bus */
+#define VSCP_TP_ADAPTER_RCVBUF_SIZE     (256 * 1024)
+
+/** Size of the ancillary data (timestamps) of a received frame */
+#define VSCP_TP_ADAPTER_CTRL_SIZE       (CMSG_SPACE(sizeof(struct scm_timestamping)) + CMSG_SPACE(sizeof(struct timespec)))
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the ancillary data storage of a received frame. */
+typedef union
+{
+    struct cmsghdr  align;                              /**< Alignment */
+    uint8_t         buffer[VSCP_TP_ADAPTER_CTRL_SIZE];  /**< Ancillary data */
+
+} vscp_tp_adapter_Ctrl;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL vscp_tp_adapter_receive(void);
+static BOOL vscp_tp_adapter_applyFilters(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+static BOOL vscp_tp_adapter_getTimestamp(struct msghdr const * const hdr, uint32_t * const timestamp);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** CAN socket */
+static int                  vscp_tp_adapter_fd          = -1;
+
+/** SocketCAN interface name */
+static char                 vscp_tp_adapter_ifName[IFNAMSIZ]    = VSCP_TP_ADAPTER_IFNAME_DEFAULT;
+
+/** Received frames */
+static struct can_frame     vscp_tp_adapter_rxFrames[VSCP_TP_ADAPTER_RX_BATCH];
+
+/** Received frame buffers */
+static struct iovec         vscp_tp_adapter_rxIov[VSCP_TP_ADAPTER_RX_BATCH];
+
+/** Ancillary data of the received frames */
+static vscp_tp_adapter_Ctrl vscp_tp_adapter_rxCtrl[VSCP_TP_ADAPTER_RX_BATCH];
+
+/** Received frame message headers */
+static struct mmsghdr       vscp_tp_adapter_rxMsgs[VSCP_TP_ADAPTER_RX_BATCH];
+
+/** Number of received frames */
+static unsigned int         vscp_tp_adapter_rxNum       = 0;
+
+/** Index of the next received frame, which is not read by the core yet */
+static unsigned int         vscp_tp_adapter_rxIndex     = 0;
+
+/** Frames, which are not sent yet */
+static struct can_frame     vscp_tp_adapter_txFrames[VSCP_TP_ADAPTER_TX_BATCH];
+
+/** Frame buffers to send */
+static struct iovec         vscp_tp_adapter_txIov[VSCP_TP_ADAPTER_TX_BATCH];
+
+/** Frame message headers to send */
+static struct mmsghdr       vscp_tp_adapter_txMsgs[VSCP_TP_ADAPTER_TX_BATCH];
+
+/** Number of frames, which are not sent yet */
+static unsigned int         vscp_tp_adapter_txNum       = 0;
+
+/** Kernel acceptance filters */
+static struct can_filter    vscp_tp_adapter_filters[VSCP_TP_ADAPTER_FILTER_NUM];
+
+/** Number of kernel acceptance filters */
+static uint8_t              vscp_tp_adapter_filterNum   = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the transport layer.
+ */
+extern void vscp_tp_adapter_init(void)
+{
+    struct sockaddr_can addr;
+    int                 value   = 0;
+    unsigned int        index   = 0;
+
+    if (0 <= vscp_tp_adapter_fd)
+    {
+        (void)close(vscp_tp_adapter_fd);
+        vscp_tp_adapter_fd = -1;
+    }
+
+    vscp_tp_adapter_rxNum   = 0;
+    vscp_tp_adapter_rxIndex = 0;
+    vscp_tp_adapter_txNum   = 0;
+
+    /* The frame buffers are assigned once, only the ancillary data size has
+     * to be set before every receive.
+     */
+    memset(vscp_tp_adapter_rxMsgs, 0, sizeof(vscp_tp_adapter_rxMsgs));
+    memset(vscp_tp_adapter_txMsgs, 0, sizeof(vscp_tp_adapter_txMsgs));
+
+    for(index = 0; index < VSCP_TP_ADAPTER_RX_BATCH; ++index)
+    {
+        vscp_tp_adapter_rxIov[index].iov_base                   = &vscp_tp_adapter_rxFrames[index];
+        vscp_tp_adapter_rxIov[index].iov_len                    = sizeof(struct can_frame);
+        vscp_tp_adapter_rxMsgs[index].msg_hdr.msg_iov           = &vscp_tp_adapter_rxIov[index];
+        vscp_tp_adapter_rxMsgs[index].msg_hdr.msg_iovlen        = 1;
+        vscp_tp_adapter_rxMsgs[index].msg_hdr.msg_control       = vscp_tp_adapter_rxCtrl[index].buffer;
+    }
+
+    for(index = 0; index < VSCP_TP_ADAPTER_TX_BATCH; ++index)
+    {
+        vscp_tp_adapter_txIov[index].iov_base                   = &vscp_tp_adapter_txFrames[index];
+        vscp_tp_adapter_txIov[index].iov_len                    = sizeof(struct can_frame);
+        vscp_tp_adapter_txMsgs[index].msg_hdr.msg_iov           = &vscp_tp_adapter_txIov[index];
+        vscp_tp_adapter_txMsgs[index].msg_hdr.msg_iovlen        = 1;
+    }
+
+    vscp_tp_adapter_fd = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK, CAN_RAW);
+
+    if (0 > vscp_tp_adapter_fd)
+    {
+        perror("CAN socket");
+        return;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.can_family     = AF_CAN;
+    addr.can_ifindex    = (int)if_nametoindex(vscp_tp_adapter_ifName);
+
+    if ((0 == addr.can_ifindex) ||
+        (0 != bind(vscp_tp_adapter_fd, (struct sockaddr*)&addr, sizeof(addr))))
+    {
+        fprintf(stderr, "CAN interface %s: %s\n", vscp_tp_adapter_ifName, strerror(errno));
+        (void)close(vscp_tp_adapter_fd);
+        vscp_tp_adapter_fd = -1;
+        return;
+    }
+
+    /* Larger receive buffer for bursts, the kernel may limit it. */
+    value = VSCP_TP_ADAPTER_RCVBUF_SIZE;
+    (void)setsockopt(vscp_tp_adapter_fd, SOL_SOCKET, SO_RCVBUF, &value, sizeof(value));
+
+    /* Error frames are not interesting. */
+    value = 0;
+    (void)setsockopt(vscp_tp_adapter_fd, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &value, sizeof(value));
+
+    (void)vscp_tp_adapter_applyFilters();
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+    /* Hardware and kernel receive timestamps, if not supported, at least
+     * the kernel timestamp in ns.
+     */
+    value = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+            SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+
+    if (0 != setsockopt(vscp_tp_adapter_fd, SOL_SOCKET, SO_TIMESTAMPING, &value, sizeof(value)))
+    {
+        value = 1;
+        (void)setsockopt(vscp_tp_adapter_fd, SOL_SOCKET, SO_TIMESTAMPNS, &value, sizeof(value));
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+    return;
+}
+
+/**
+ * This function reads a message from the transport layer.
+ *
+ * If receive timestamps are enabled (VSCP_CONFIG_ENABLE_RX_TIMESTAMP), the
+ * timestamp of the message storage is already set to the current time.
+ * Overwrite it, if the message was received earlier, e.g. with the timestamp
+ * taken in the receive interrupt (see vscp_portable_getMicros()).
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL != msg)
+    {
+        while((FALSE == status) &&
+              ((vscp_tp_adapter_rxNum > vscp_tp_adapter_rxIndex) ||
+               (TRUE == vscp_tp_adapter_receive())))
+        {
+            struct can_frame const *    frame   = &vscp_tp_adapter_rxFrames[vscp_tp_adapter_rxIndex];
+
+            /* Only extended data frames are VSCP events. */
+            if ((0 != (CAN_EFF_FLAG & frame->can_id)) &&
+                (0 == ((CAN_RTR_FLAG | CAN_ERR_FLAG) & frame->can_id)) &&
+                (VSCP_L1_DATA_SIZE >= frame->can_dlc))
+            {
+                msg->vscpClass  = (uint16_t)((frame->can_id >> 16) & 0x01ff);
+                msg->vscpType   = (uint8_t)((frame->can_id >> 8) & 0x00ff);
+                msg->oAddr      = (uint8_t)((frame->can_id >> 0) & 0x00ff);
+                msg->hardCoded  = (uint8_t)((frame->can_id >> 25) & 0x0001);
+                msg->priority   = (VSCP_PRIORITY)((frame->can_id >> 26) & 0x0007);
+                msg->dataSize   = frame->can_dlc;
+
+                memcpy(msg->data, frame->data, frame->can_dlc);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+                (void)vscp_tp_adapter_getTimestamp(&vscp_tp_adapter_rxMsgs[vscp_tp_adapter_rxIndex].msg_hdr, &msg->timestamp);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+                status = TRUE;
+            }
+
+            ++vscp_tp_adapter_rxIndex;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a message to the transport layer.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&                        /* Message shall exists */
+        (VSCP_L1_DATA_SIZE >= msg->dataSize) &&  /* Number of data bytes is limited */
+        (0 <= vscp_tp_adapter_fd))              /* Socket shall be open */
+    {
+        /* Send the collected frames, if no space is left. */
+        if (VSCP_TP_ADAPTER_TX_BATCH <= vscp_tp_adapter_txNum)
+        {
+            (void)vscp_tp_adapter_flush();
+        }
+
+        if (VSCP_TP_ADAPTER_TX_BATCH > vscp_tp_adapter_txNum)
+        {
+            struct can_frame *  frame   = &vscp_tp_adapter_txFrames[vscp_tp_adapter_txNum];
+
+            memset(frame, 0, sizeof(*frame));
+
+            frame->can_id   = CAN_EFF_FLAG |
+                              ((uint32_t)msg->priority << 26) |
+                              ((uint32_t)msg->hardCoded << 25) |
+                              ((uint32_t)msg->vscpClass << 16) |
+                              ((uint32_t)msg->vscpType << 8) |
+                              ((uint32_t)msg->oAddr);
+            frame->can_dlc  = msg->dataSize;
+
+            memcpy(frame->data, msg->data, msg->dataSize);
+
+            ++vscp_tp_adapter_txNum;
+
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function selects the SocketCAN interface, e.g. "can0". It shall be
+ * called before the VSCP core is initialized. Default is "vcan0".
+ *
+ * @param[in]   name    Interface name
+ */
+extern void vscp_tp_adapter_setInterface(char const * const name)
+{
+    if (NULL != name)
+    {
+        strncpy(vscp_tp_adapter_ifName, name, sizeof(vscp_tp_adapter_ifName) - 1);
+        vscp_tp_adapter_ifName[sizeof(vscp_tp_adapter_ifName) - 1] = '\0';
+    }
+
+    return;
+}
+
+/**
+ * This function returns the file descriptor of the CAN socket, e.g. to wait
+ * with poll() for received frames.
+ *
+ * @return File descriptor (-1: No socket open)
+ */
+extern int vscp_tp_adapter_getFd(void)
+{
+    return vscp_tp_adapter_fd;
+}
+
+/**
+ * This function sends all written messages, which are not sent yet.
+ *
+ * @return All messages sent or not
+ * @retval  FALSE   Messages are pending, because the transmit queue is full
+ * @retval  TRUE    All messages sent
+ */
+extern BOOL vscp_tp_adapter_flush(void)
+{
+    if ((0 < vscp_tp_adapter_txNum) &&
+        (0 <= vscp_tp_adapter_fd))
+    {
+        int sent    = sendmmsg(vscp_tp_adapter_fd, vscp_tp_adapter_txMsgs, vscp_tp_adapter_txNum, MSG_DONTWAIT);
+
+        if (0 < sent)
+        {
+            vscp_tp_adapter_txNum -= (unsigned int)sent;
+
+            /* Keep the frames, which are not sent yet, in order. */
+            memmove(vscp_tp_adapter_txFrames, &vscp_tp_adapter_txFrames[sent], vscp_tp_adapter_txNum * sizeof(struct can_frame));
+        }
+        /* Transmit queue full? Try it again later. */
+        else if ((EAGAIN == errno) ||
+                 (EWOULDBLOCK == errno) ||
+                 (ENOBUFS == errno))
+        {
+            ;
+        }
+        /* Interface down or similar, the frames are lost. */
+        else
+        {
+            perror("CAN send");
+            vscp_tp_adapter_txNum = 0;
+        }
+    }
+
+    return (0 == vscp_tp_adapter_txNum) ? TRUE : FALSE;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the kernel. A frame is
+ * received, if its identifier matches any filter: (frameId & mask) == id.
+ * Without filters, all extended data frames are received.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters (max. VSCP_TP_ADAPTER_FILTER_NUM)
+ */
+extern void vscp_tp_adapter_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    if ((VSCP_TP_ADAPTER_FILTER_NUM < num) ||
+        ((0 < num) && (NULL == filters)))
+    {
+        return;
+    }
+
+    for(index = 0; index < num; ++index)
+    {
+        /* Only extended data frames */
+        vscp_tp_adapter_filters[index].can_id   = CAN_EFF_FLAG | (filters[index].id & CAN_EFF_MASK);
+        vscp_tp_adapter_filters[index].can_mask = CAN_EFF_FLAG | CAN_RTR_FLAG | (filters[index].mask & CAN_EFF_MASK);
+    }
+
+    vscp_tp_adapter_filterNum = num;
+
+    (void)vscp_tp_adapter_applyFilters();
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function receives the next batch of frames.
+ *
+ * @return Frames received or not
+ * @retval  FALSE   No frame received
+ * @retval  TRUE    At least one frame received
+ */
+static BOOL vscp_tp_adapter_receive(void)
+{
+    unsigned int    index   = 0;
+    int             num     = 0;
+
+    vscp_tp_adapter_rxNum   = 0;
+    vscp_tp_adapter_rxIndex = 0;
+
+    if (0 > vscp_tp_adapter_fd)
+    {
+        return FALSE;
+    }
+
+    /* The kernel overwrites the ancillary data size. */
+    for(index = 0; index < VSCP_TP_ADAPTER_RX_BATCH; ++index)
+    {
+        vscp_tp_adapter_rxMsgs[index].msg_hdr.msg_controllen    = sizeof(vscp_tp_adapter_rxCtrl[index].buffer);
+        vscp_tp_adapter_rxMsgs[index].msg_hdr.msg_flags         = 0;
+    }
+
+    num = recvmmsg(vscp_tp_adapter_fd, vscp_tp_adapter_rxMsgs, VSCP_TP_ADAPTER_RX_BATCH, MSG_DONTWAIT, NULL);
+
+    if (0 < num)
+    {
+        vscp_tp_adapter_rxNum = (unsigned int)num;
+    }
+
+    return (0 < vscp_tp_adapter_rxNum) ? TRUE : FALSE;
+}
+
+/**
+ * This function programs the acceptance filters into the kernel.
+ *
+ * @return  Filters programmed or not
+ * @retval  FALSE   The kernel refused the filters
+ * @retval  TRUE    Filters programmed
+ */
+static BOOL vscp_tp_adapter_applyFilters(void)
+{
+    BOOL                status  = TRUE;
+    struct can_filter   all;
+    struct can_filter*  filters = vscp_tp_adapter_filters;
+    uint8_t             num     = vscp_tp_adapter_filterNum;
+
+    /* No filter, all extended data frames. */
+    if (0 == num)
+    {
+        all.can_id      = CAN_EFF_FLAG;
+        all.can_mask    = CAN_EFF_FLAG | CAN_RTR_FLAG;
+        filters         = &all;
+        num             = 1;
+    }
+
+    if (0 <= vscp_tp_adapter_fd)
+    {
+        if (0 != setsockopt(vscp_tp_adapter_fd, SOL_CAN_RAW, CAN_RAW_FILTER, filters, num * sizeof(struct can_filter)))
+        {
+            perror("CAN filter");
+            status = FALSE;
+        }
+    }
+
+    return status;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+/**
+ * This function gets the receive timestamp of a frame from its ancillary data.
+ *
+ * @param[in]   hdr         Message header of the received frame
+ * @param[out]  timestamp   Timestamp in us
+ * @return  Timestamp available or not
+ * @retval  FALSE   No timestamp available
+ * @retval  TRUE    Timestamp available
+ */
+static BOOL vscp_tp_adapter_getTimestamp(struct msghdr const * const hdr, uint32_t * const timestamp)
+{
+    struct timespec const * ts      = NULL;
+    struct cmsghdr *        cmsg    = NULL;
+
+    for(cmsg = CMSG_FIRSTHDR((struct msghdr*)hdr); NULL != cmsg; cmsg = CMSG_NXTHDR((struct msghdr*)hdr, cmsg))
+    {
+        if (SOL_SOCKET != cmsg->cmsg_level)
+        {
+            ;
+        }
+        else if (SO_TIMESTAMPING == cmsg->cmsg_type)
+        {
+            struct scm_timestamping const * tss = (struct scm_timestamping const *)CMSG_DATA(cmsg);
+
+            /* 0: Kernel timestamp, 2: Raw hardware timestamp */
+            ts = &tss->ts[0];
+
+#if (0 != VSCP_TP_ADAPTER_HW_TIMESTAMP)
+            if ((0 != tss->ts[2].tv_sec) || (0 != tss->ts[2].tv_nsec))
+            {
+                ts = &tss->ts[2];
+            }
+#endif  /* (0 != VSCP_TP_ADAPTER_HW_TIMESTAMP) */
+        }
+        else if (SO_TIMESTAMPNS == cmsg->cmsg_type)
+        {
+            ts = (struct timespec const *)CMSG_DATA(cmsg);
+        }
+    }
+
+    if ((NULL == ts) ||
+        ((0 == ts->tv_sec) && (0 == ts->tv_nsec)))
+    {
+        return FALSE;
+    }
+
+    *timestamp = (uint32_t)ts->tv_sec * 1000000u + (uint32_t)(ts->tv_nsec / 1000);
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
@@ -0,0 +1,183 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP transport layer adapter
+@file   vscp_tp_adapter.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module adapts the Linux SocketCAN interface to the transport layer of VSCP.
+
+*******************************************************************************/
+/** @defgroup vscp_tp_adapter Transport driver adapter
+ * The transport layer adapter adapts the transport layer of VSCP to a Linux
+ * SocketCAN interface, e.g. can0 or the virtual interface vcan0.
+ *
+ * The 29 bit CAN identifier contains the priority (bit 26-28), the hard-coded
+ * flag (bit 25), the class (bit 16-24), the type (bit 8-15) and the nickname
+ * of the originator (bit 0-7).
+ *
+ * The socket is non-blocking. Received frames are read in batches with
+ * recvmmsg() and the core gets them one by one. Written frames are collected
+ * and sent in batches with sendmmsg() by vscp_tp_adapter_flush(), which shall
+ * be called after every vscp_core_process() call. Acceptance filters are
+ * calculated by the core (VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER) and programmed
+ * into the kernel, so frames, which are not interesting for the node, never
+ * reach the process.
+ *
+ * If receive timestamps are enabled (VSCP_CONFIG_ENABLE_RX_TIMESTAMP), the
+ * kernel receive timestamp of every frame is used. It is based on
+ * CLOCK_REALTIME, like vscp_portable_getMicros().
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_TP_ADAPTER_H__
+#define __VSCP_TP_ADAPTER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. number of acceptance filters */
+#define VSCP_TP_ADAPTER_FILTER_NUM  16
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the transport layer.
+ */
+extern void vscp_tp_adapter_init(void);
+
+/**
+ * This function reads a message from the transport layer.
+ *
+ * If receive timestamps are enabled (VSCP_CONFIG_ENABLE_RX_TIMESTAMP), the
+ * timestamp of the message storage is already set to the current time.
+ * Overwrite it, if the message was received earlier, e.g. with the timestamp
+ * taken in the receive interrupt (see vscp_portable_getMicros()).
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg);
+
+/**
+ * This function writes a message to the transport layer.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg);
+
+/**
+ * This function selects the SocketCAN interface, e.g. "can0". It shall be
+ * called before the VSCP core is initialized. Default is "vcan0".
+ *
+ * @param[in]   name    Interface name
+ */
+extern void vscp_tp_adapter_setInterface(char const * const name);
+
+/**
+ * This function returns the file descriptor of the CAN socket, e.g. to wait
+ * with poll() for received frames.
+ *
+ * @return File descriptor (-1: No socket open)
+ */
+extern int vscp_tp_adapter_getFd(void);
+
+/**
+ * This function sends all written messages, which are not sent yet.
+ *
+ * @return All messages sent or not
+ * @retval  FALSE   Messages are pending, because the transmit queue is full
+ * @retval  TRUE    All messages sent
+ */
+extern BOOL vscp_tp_adapter_flush(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the kernel. A frame is
+ * received, if its identifier matches any filter: (frameId & mask) == id.
+ * Without filters, all extended data frames are received.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters (max. VSCP_TP_ADAPTER_FILTER_NUM)
+ */
+extern void vscp_tp_adapter_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_TP_ADAPTER_H__ */
+
+/** @} */
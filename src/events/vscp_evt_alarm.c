@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_alarm.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -479,3 +480,470 @@ extern BOOL vscp_evt_alarm_sendAlarmReset(uint8_t alarmRegister, uint8_t zone, u
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseWarning(vscp_RxMessage const * const msg, vscp_evt_alarm_Warning * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_WARNING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Alarm occurred" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm occurred" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmOccurred(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmOccurred * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_ALARM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->alarmRegister = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Alarm sound on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm sound on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmSoundOnOff(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmSoundOnOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_SOUND != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Alarm light on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm light on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmLightOnOff(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmLightOnOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_LIGHT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Power on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Power on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parsePowerOnOff(vscp_RxMessage const * const msg, vscp_evt_alarm_PowerOnOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_POWER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Emergency Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyStop(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyStop * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_EMERGENCY_STOP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Emergency Pause" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Pause" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyPause(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyPause * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_EMERGENCY_PAUSE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Emergency Reset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Reset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyReset(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyReset * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_EMERGENCY_RESET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Emergency Resume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Resume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyResume(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyResume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_EMERGENCY_RESUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Arm" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Arm" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseArm(vscp_RxMessage const * const msg, vscp_evt_alarm_Arm * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_ARM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Disarm" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Disarm" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseDisarm(vscp_RxMessage const * const msg, vscp_evt_alarm_Disarm * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_DISARM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->onOff = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Watchdog" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Watchdog" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseWatchdog(vscp_RxMessage const * const msg, vscp_evt_alarm_Watchdog * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_WATCHDOG != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Alarm reset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm reset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmReset(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmReset * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_ALARM != msg->vscpClass) || (VSCP_TYPE_ALARM_RESET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->alarmRegister = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Alarm functionality" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parse(vscp_RxMessage const * const msg, vscp_evt_alarm_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_ALARM != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_ALARM_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_ALARM_WARNING:
+        status = vscp_evt_alarm_parseWarning(msg, &evt->data.warning);
+        break;
+
+    case VSCP_TYPE_ALARM_ALARM:
+        status = vscp_evt_alarm_parseAlarmOccurred(msg, &evt->data.alarmOccurred);
+        break;
+
+    case VSCP_TYPE_ALARM_SOUND:
+        status = vscp_evt_alarm_parseAlarmSoundOnOff(msg, &evt->data.alarmSoundOnOff);
+        break;
+
+    case VSCP_TYPE_ALARM_LIGHT:
+        status = vscp_evt_alarm_parseAlarmLightOnOff(msg, &evt->data.alarmLightOnOff);
+        break;
+
+    case VSCP_TYPE_ALARM_POWER:
+        status = vscp_evt_alarm_parsePowerOnOff(msg, &evt->data.powerOnOff);
+        break;
+
+    case VSCP_TYPE_ALARM_EMERGENCY_STOP:
+        status = vscp_evt_alarm_parseEmergencyStop(msg, &evt->data.emergencyStop);
+        break;
+
+    case VSCP_TYPE_ALARM_EMERGENCY_PAUSE:
+        status = vscp_evt_alarm_parseEmergencyPause(msg, &evt->data.emergencyPause);
+        break;
+
+    case VSCP_TYPE_ALARM_EMERGENCY_RESET:
+        status = vscp_evt_alarm_parseEmergencyReset(msg, &evt->data.emergencyReset);
+        break;
+
+    case VSCP_TYPE_ALARM_EMERGENCY_RESUME:
+        status = vscp_evt_alarm_parseEmergencyResume(msg, &evt->data.emergencyResume);
+        break;
+
+    case VSCP_TYPE_ALARM_ARM:
+        status = vscp_evt_alarm_parseArm(msg, &evt->data.arm);
+        break;
+
+    case VSCP_TYPE_ALARM_DISARM:
+        status = vscp_evt_alarm_parseDisarm(msg, &evt->data.disarm);
+        break;
+
+    case VSCP_TYPE_ALARM_WATCHDOG:
+        status = vscp_evt_alarm_parseWatchdog(msg, &evt->data.watchdog);
+        break;
+
+    case VSCP_TYPE_ALARM_RESET:
+        status = vscp_evt_alarm_parseAlarmReset(msg, &evt->data.alarmReset);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -48,6 +48,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -70,6 +71,148 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Warning" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_Warning;
+
+/** Parameters of the "Alarm occurred" event. */
+typedef struct
+{
+    uint8_t alarmRegister; /**< Alarm register */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_AlarmOccurred;
+
+/** Parameters of the "Alarm sound on/off" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_AlarmSoundOnOff;
+
+/** Parameters of the "Alarm light on/off" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_AlarmLightOnOff;
+
+/** Parameters of the "Power on/off" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_PowerOnOff;
+
+/** Parameters of the "Emergency Stop" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_EmergencyStop;
+
+/** Parameters of the "Emergency Pause" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_EmergencyPause;
+
+/** Parameters of the "Emergency Reset" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_EmergencyReset;
+
+/** Parameters of the "Emergency Resume" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_EmergencyResume;
+
+/** Parameters of the "Arm" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_Arm;
+
+/** Parameters of the "Disarm" event. */
+typedef struct
+{
+    uint8_t onOff; /**< On/Off */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_Disarm;
+
+/** Parameters of the "Watchdog" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_Watchdog;
+
+/** Parameters of the "Alarm reset" event. */
+typedef struct
+{
+    uint8_t alarmRegister; /**< Alarm register */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_alarm_AlarmReset;
+
+/** Parsed event of the "Alarm functionality" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_alarm_Warning warning; /**< Parameters of the "Warning" event */
+        vscp_evt_alarm_AlarmOccurred alarmOccurred; /**< Parameters of the "Alarm occurred" event */
+        vscp_evt_alarm_AlarmSoundOnOff alarmSoundOnOff; /**< Parameters of the "Alarm sound on/off" event */
+        vscp_evt_alarm_AlarmLightOnOff alarmLightOnOff; /**< Parameters of the "Alarm light on/off" event */
+        vscp_evt_alarm_PowerOnOff powerOnOff; /**< Parameters of the "Power on/off" event */
+        vscp_evt_alarm_EmergencyStop emergencyStop; /**< Parameters of the "Emergency Stop" event */
+        vscp_evt_alarm_EmergencyPause emergencyPause; /**< Parameters of the "Emergency Pause" event */
+        vscp_evt_alarm_EmergencyReset emergencyReset; /**< Parameters of the "Emergency Reset" event */
+        vscp_evt_alarm_EmergencyResume emergencyResume; /**< Parameters of the "Emergency Resume" event */
+        vscp_evt_alarm_Arm arm; /**< Parameters of the "Arm" event */
+        vscp_evt_alarm_Disarm disarm; /**< Parameters of the "Disarm" event */
+        vscp_evt_alarm_Watchdog watchdog; /**< Parameters of the "Watchdog" event */
+        vscp_evt_alarm_AlarmReset alarmReset; /**< Parameters of the "Alarm reset" event */
+    } data;
+
+} vscp_evt_alarm_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -230,6 +373,147 @@ extern BOOL vscp_evt_alarm_sendWatchdog(uint8_t index, uint8_t zone, uint8_t sub
  */
 extern BOOL vscp_evt_alarm_sendAlarmReset(uint8_t alarmRegister, uint8_t zone, uint8_t subZone);
 
+/**
+ * Parse the "Warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseWarning(vscp_RxMessage const * const msg, vscp_evt_alarm_Warning * const evt);
+
+/**
+ * Parse the "Alarm occurred" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm occurred" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmOccurred(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmOccurred * const evt);
+
+/**
+ * Parse the "Alarm sound on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm sound on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmSoundOnOff(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmSoundOnOff * const evt);
+
+/**
+ * Parse the "Alarm light on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm light on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmLightOnOff(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmLightOnOff * const evt);
+
+/**
+ * Parse the "Power on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Power on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parsePowerOnOff(vscp_RxMessage const * const msg, vscp_evt_alarm_PowerOnOff * const evt);
+
+/**
+ * Parse the "Emergency Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyStop(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyStop * const evt);
+
+/**
+ * Parse the "Emergency Pause" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Pause" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyPause(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyPause * const evt);
+
+/**
+ * Parse the "Emergency Reset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Reset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyReset(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyReset * const evt);
+
+/**
+ * Parse the "Emergency Resume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Emergency Resume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseEmergencyResume(vscp_RxMessage const * const msg, vscp_evt_alarm_EmergencyResume * const evt);
+
+/**
+ * Parse the "Arm" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Arm" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseArm(vscp_RxMessage const * const msg, vscp_evt_alarm_Arm * const evt);
+
+/**
+ * Parse the "Disarm" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Disarm" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseDisarm(vscp_RxMessage const * const msg, vscp_evt_alarm_Disarm * const evt);
+
+/**
+ * Parse the "Watchdog" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Watchdog" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseWatchdog(vscp_RxMessage const * const msg, vscp_evt_alarm_Watchdog * const evt);
+
+/**
+ * Parse the "Alarm reset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alarm reset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parseAlarmReset(vscp_RxMessage const * const msg, vscp_evt_alarm_AlarmReset * const evt);
+
+/**
+ * Parse a received event of the "Alarm functionality" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_alarm_parse(vscp_RxMessage const * const msg, vscp_evt_alarm_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
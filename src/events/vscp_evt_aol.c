@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_aol.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,126 +73,21 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * System unplugged from power source
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendSystemUnpluggedFromPowerSource(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_UNPLUGGED_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * System unplugged from network
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendSystemUnpluggedFromNetwork(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_UNPLUGGED_LAN, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Chassis intrusion
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendChassisIntrusion(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_CHASSIS_INTRUSION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Processor removal
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for record.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendProcessorRemoval(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_aol_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_PROCESSOR_REMOVAL, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = index;
     size += 1;
@@ -208,362 +104,104 @@ extern BOOL vscp_evt_aol_sendProcessorRemoval(uint8_t index, uint8_t zone, uint8
 }
 
 /**
- * System environmental errors
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendSystemEnvironmentalErrors(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_ENVIRONMENT_ERROR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * High temperature
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendHighTemperature(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_HIGH_TEMPERATURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Fan speed problem
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendFanSpeedProblem(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_FAN_SPEED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Voltage fluctuations
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendVoltageFluctuations(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_VOLTAGE_FLUCTUATIONS, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Operating system errors
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendOperatingSystemErrors(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_OS_ERROR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * System power-on error
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendSystemPowerOnError(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_POWER_ON_ERROR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * System is hung
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendSystemIsHung(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_SYSTEM_HUNG, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Component failure
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendComponentFailure(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_COMPONENT_FAILURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Remote system reboot upon report of a critical failure
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendRemoteSystemRebootUponReportOfACriticalFailure(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_aol_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_REBOOT_UPON_FAILURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = size;
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Repair Operating System
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
  * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendRepairOperatingSystem(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_aol_parseCommon(vscp_RxMessage const * const msg, vscp_evt_aol_Common * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_REPAIR_OPERATING_SYSTEM, VSCP_PRIORITY_3_NORMAL);
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[0] = index;
-    size += 1;
+    if ((VSCP_CLASS_L1_AOL != msg->vscpClass) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[1] = zone;
-    size += 1;
+    evt->index = msg->data[0];
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->zone = msg->data[1];
 
-    txMsg.dataSize = size;
+    evt->subZone = msg->data[2];
 
-    return vscp_core_sendEvent(&txMsg);
+    return TRUE;
 }
 
 /**
- * Update BIOS image
+ * Parse a received event of the "Alert On LAN" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
  * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendUpdateBiosImage(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_aol_parse(vscp_RxMessage const * const msg, vscp_evt_aol_Event * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_UPDATE_BIOS_IMAGE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
+    BOOL    status  = FALSE;
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Update Perform other diagnostic procedures
- * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_aol_sendUpdatePerformOtherDiagnosticProcedures(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_AOL, VSCP_TYPE_AOL_UPDATE_DIAGNOSTIC_PROCEDURE, VSCP_PRIORITY_3_NORMAL);
+    if (VSCP_CLASS_L1_AOL != msg->vscpClass)
+    {
+        return FALSE;
+    }
 
-    txMsg.data[0] = index;
-    size += 1;
+    evt->vscpType = msg->vscpType;
 
-    txMsg.data[1] = zone;
-    size += 1;
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_AOL_GENERAL:
+        status = TRUE;
+        break;
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    case VSCP_TYPE_AOL_UNPLUGGED_POWER:
+    case VSCP_TYPE_AOL_UNPLUGGED_LAN:
+    case VSCP_TYPE_AOL_CHASSIS_INTRUSION:
+    case VSCP_TYPE_AOL_PROCESSOR_REMOVAL:
+    case VSCP_TYPE_AOL_ENVIRONMENT_ERROR:
+    case VSCP_TYPE_AOL_HIGH_TEMPERATURE:
+    case VSCP_TYPE_AOL_FAN_SPEED:
+    case VSCP_TYPE_AOL_VOLTAGE_FLUCTUATIONS:
+    case VSCP_TYPE_AOL_OS_ERROR:
+    case VSCP_TYPE_AOL_POWER_ON_ERROR:
+    case VSCP_TYPE_AOL_SYSTEM_HUNG:
+    case VSCP_TYPE_AOL_COMPONENT_FAILURE:
+    case VSCP_TYPE_AOL_REBOOT_UPON_FAILURE:
+    case VSCP_TYPE_AOL_REPAIR_OPERATING_SYSTEM:
+    case VSCP_TYPE_AOL_UPDATE_BIOS_IMAGE:
+    case VSCP_TYPE_AOL_UPDATE_DIAGNOSTIC_PROCEDURE:
+        status = vscp_evt_aol_parseCommon(msg, &evt->data.common);
+        break;
 
-    txMsg.dataSize = size;
+    default:
+        break;
+    }
 
-    return vscp_core_sendEvent(&txMsg);
+    return status;
 }
 
@@ -48,6 +48,8 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_type_aol.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -70,6 +72,28 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_aol_Common;
+
+/** Parsed event of the "Alert On LAN" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_aol_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_aol_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -78,6 +102,18 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index for record.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_aol_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone);
+
 /**
  * General event
  * 
@@ -94,7 +130,10 @@ extern BOOL vscp_evt_aol_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendSystemUnpluggedFromPowerSource(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendSystemUnpluggedFromPowerSource(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_UNPLUGGED_POWER, index, zone, subZone);
+}
 
 /**
  * System unplugged from network
@@ -105,7 +144,10 @@ extern BOOL vscp_evt_aol_sendSystemUnpluggedFromPowerSource(uint8_t index, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendSystemUnpluggedFromNetwork(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendSystemUnpluggedFromNetwork(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_UNPLUGGED_LAN, index, zone, subZone);
+}
 
 /**
  * Chassis intrusion
@@ -116,7 +158,10 @@ extern BOOL vscp_evt_aol_sendSystemUnpluggedFromNetwork(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendChassisIntrusion(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendChassisIntrusion(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_CHASSIS_INTRUSION, index, zone, subZone);
+}
 
 /**
  * Processor removal
@@ -127,7 +172,10 @@ extern BOOL vscp_evt_aol_sendChassisIntrusion(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendProcessorRemoval(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendProcessorRemoval(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_PROCESSOR_REMOVAL, index, zone, subZone);
+}
 
 /**
  * System environmental errors
@@ -138,7 +186,10 @@ extern BOOL vscp_evt_aol_sendProcessorRemoval(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendSystemEnvironmentalErrors(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendSystemEnvironmentalErrors(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_ENVIRONMENT_ERROR, index, zone, subZone);
+}
 
 /**
  * High temperature
@@ -149,7 +200,10 @@ extern BOOL vscp_evt_aol_sendSystemEnvironmentalErrors(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendHighTemperature(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendHighTemperature(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_HIGH_TEMPERATURE, index, zone, subZone);
+}
 
 /**
  * Fan speed problem
@@ -160,7 +214,10 @@ extern BOOL vscp_evt_aol_sendHighTemperature(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendFanSpeedProblem(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendFanSpeedProblem(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_FAN_SPEED, index, zone, subZone);
+}
 
 /**
  * Voltage fluctuations
@@ -171,7 +228,10 @@ extern BOOL vscp_evt_aol_sendFanSpeedProblem(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendVoltageFluctuations(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendVoltageFluctuations(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_VOLTAGE_FLUCTUATIONS, index, zone, subZone);
+}
 
 /**
  * Operating system errors
@@ -182,7 +242,10 @@ extern BOOL vscp_evt_aol_sendVoltageFluctuations(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendOperatingSystemErrors(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendOperatingSystemErrors(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_OS_ERROR, index, zone, subZone);
+}
 
 /**
  * System power-on error
@@ -193,7 +256,10 @@ extern BOOL vscp_evt_aol_sendOperatingSystemErrors(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendSystemPowerOnError(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendSystemPowerOnError(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_POWER_ON_ERROR, index, zone, subZone);
+}
 
 /**
  * System is hung
@@ -204,7 +270,10 @@ extern BOOL vscp_evt_aol_sendSystemPowerOnError(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendSystemIsHung(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendSystemIsHung(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_SYSTEM_HUNG, index, zone, subZone);
+}
 
 /**
  * Component failure
@@ -215,7 +284,10 @@ extern BOOL vscp_evt_aol_sendSystemIsHung(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendComponentFailure(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendComponentFailure(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_COMPONENT_FAILURE, index, zone, subZone);
+}
 
 /**
  * Remote system reboot upon report of a critical failure
@@ -226,7 +298,10 @@ extern BOOL vscp_evt_aol_sendComponentFailure(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendRemoteSystemRebootUponReportOfACriticalFailure(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendRemoteSystemRebootUponReportOfACriticalFailure(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_REBOOT_UPON_FAILURE, index, zone, subZone);
+}
 
 /**
  * Repair Operating System
@@ -237,7 +312,10 @@ extern BOOL vscp_evt_aol_sendRemoteSystemRebootUponReportOfACriticalFailure(uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendRepairOperatingSystem(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendRepairOperatingSystem(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_REPAIR_OPERATING_SYSTEM, index, zone, subZone);
+}
 
 /**
  * Update BIOS image
@@ -248,7 +326,10 @@ extern BOOL vscp_evt_aol_sendRepairOperatingSystem(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendUpdateBiosImage(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendUpdateBiosImage(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_UPDATE_BIOS_IMAGE, index, zone, subZone);
+}
 
 /**
  * Update Perform other diagnostic procedures
@@ -259,7 +340,31 @@ extern BOOL vscp_evt_aol_sendUpdateBiosImage(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_aol_sendUpdatePerformOtherDiagnosticProcedures(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_aol_sendUpdatePerformOtherDiagnosticProcedures(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_aol_sendByType(VSCP_TYPE_AOL_UPDATE_DIAGNOSTIC_PROCEDURE, index, zone, subZone);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_aol_parseCommon(vscp_RxMessage const * const msg, vscp_evt_aol_Common * const evt);
+
+/**
+ * Parse a received event of the "Alert On LAN" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_aol_parse(vscp_RxMessage const * const msg, vscp_evt_aol_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_configuration.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -658,3 +659,691 @@ extern BOOL vscp_evt_configuration_sendSetParamterNegativeAcknowledge(uint16_t p
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Load configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Load configuration" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseLoadConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_LoadConfiguration * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_LOAD != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->controlAvailable = FALSE;
+    if (6 <= msg->dataSize)
+    {
+        evt->controlAvailable = TRUE;
+        evt->control = msg->data[5];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Load configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Load configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseLoadConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_LoadConfigurationAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_LOAD_ACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Load configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Load configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseLoadConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_LoadConfigurationNegativeAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_LOAD_NACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Save configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save configuration" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSaveConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_SaveConfiguration * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SAVE != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->controlAvailable = FALSE;
+    if (6 <= msg->dataSize)
+    {
+        evt->controlAvailable = TRUE;
+        evt->control = msg->data[5];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Save configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSaveConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SaveConfigurationAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SAVE_ACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Save configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSaveConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SaveConfigurationNegativeAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SAVE_NACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Commit configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Commit configuration" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseCommitConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_CommitConfiguration * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_COMMIT != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->controlAvailable = FALSE;
+    if (6 <= msg->dataSize)
+    {
+        evt->controlAvailable = TRUE;
+        evt->control = msg->data[5];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Commit configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Commit configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseCommitConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_CommitConfigurationAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_COMMIT_ACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Commit configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Commit configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseCommitConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_CommitConfigurationNegativeAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_COMMIT_NACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Reload configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reload configuration" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseReloadConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_ReloadConfiguration * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_RELOAD != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->controlAvailable = FALSE;
+    if (6 <= msg->dataSize)
+    {
+        evt->controlAvailable = TRUE;
+        evt->control = msg->data[5];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Reload configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reload configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseReloadConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_ReloadConfigurationAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_REALOD_ACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Reload configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reload configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseReloadConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_ReloadConfigurationNegativeAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_RELOAD_NACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Restore configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Restore configuration" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseRestoreConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_RestoreConfiguration * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_RESTORE != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->controlAvailable = FALSE;
+    if (6 <= msg->dataSize)
+    {
+        evt->controlAvailable = TRUE;
+        evt->control = msg->data[5];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Restore configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Restore configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseRestoreConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_RestoreConfigurationAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_RESTORE_ACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Restore configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Restore configuration negative acknowledge" event, it will
+ * return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseRestoreConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_RestoreConfigurationNegativeAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_RESTORE_NACK != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->configurationid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set parameter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set parameter" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParameter(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParameter * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SET_PARAMETER != msg->vscpType) || (7 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->parameterid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->parametervalue = VSCP_UTIL_READ_UINT16_BE(&msg->data[5]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set parameter to default" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set parameter to default" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParameterToDefault(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParameterToDefault * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SET_PARAMETER_DEFAULT != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->parameterid = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set parameter acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set parameter acknowledge" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParameterAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParameterAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SET_PARAMETER_ACK != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->parameterid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    evt->parametervalue = VSCP_UTIL_READ_UINT16_BE(&msg->data[2]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set paramter negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set paramter negative acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParamterNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParamterNegativeAcknowledge * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass) || (VSCP_TYPE_CONFIGURATION_SET_PARAMETER_NACK != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->parameterid = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    evt->parametervalue = VSCP_UTIL_READ_UINT16_BE(&msg->data[2]);
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Configuration" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parse(vscp_RxMessage const * const msg, vscp_evt_configuration_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_CONFIGURATION != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_CONFIGURATION_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_LOAD:
+        status = vscp_evt_configuration_parseLoadConfiguration(msg, &evt->data.loadConfiguration);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_LOAD_ACK:
+        status = vscp_evt_configuration_parseLoadConfigurationAcknowledge(msg, &evt->data.loadConfigurationAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_LOAD_NACK:
+        status = vscp_evt_configuration_parseLoadConfigurationNegativeAcknowledge(msg, &evt->data.loadConfigurationNegativeAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SAVE:
+        status = vscp_evt_configuration_parseSaveConfiguration(msg, &evt->data.saveConfiguration);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SAVE_ACK:
+        status = vscp_evt_configuration_parseSaveConfigurationAcknowledge(msg, &evt->data.saveConfigurationAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SAVE_NACK:
+        status = vscp_evt_configuration_parseSaveConfigurationNegativeAcknowledge(msg, &evt->data.saveConfigurationNegativeAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_COMMIT:
+        status = vscp_evt_configuration_parseCommitConfiguration(msg, &evt->data.commitConfiguration);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_COMMIT_ACK:
+        status = vscp_evt_configuration_parseCommitConfigurationAcknowledge(msg, &evt->data.commitConfigurationAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_COMMIT_NACK:
+        status = vscp_evt_configuration_parseCommitConfigurationNegativeAcknowledge(msg, &evt->data.commitConfigurationNegativeAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_RELOAD:
+        status = vscp_evt_configuration_parseReloadConfiguration(msg, &evt->data.reloadConfiguration);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_REALOD_ACK:
+        status = vscp_evt_configuration_parseReloadConfigurationAcknowledge(msg, &evt->data.reloadConfigurationAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_RELOAD_NACK:
+        status = vscp_evt_configuration_parseReloadConfigurationNegativeAcknowledge(msg, &evt->data.reloadConfigurationNegativeAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_RESTORE:
+        status = vscp_evt_configuration_parseRestoreConfiguration(msg, &evt->data.restoreConfiguration);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_RESTORE_ACK:
+        status = vscp_evt_configuration_parseRestoreConfigurationAcknowledge(msg, &evt->data.restoreConfigurationAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_RESTORE_NACK:
+        status = vscp_evt_configuration_parseRestoreConfigurationNegativeAcknowledge(msg, &evt->data.restoreConfigurationNegativeAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SET_PARAMETER:
+        status = vscp_evt_configuration_parseSetParameter(msg, &evt->data.setParameter);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SET_PARAMETER_DEFAULT:
+        status = vscp_evt_configuration_parseSetParameterToDefault(msg, &evt->data.setParameterToDefault);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SET_PARAMETER_ACK:
+        status = vscp_evt_configuration_parseSetParameterAcknowledge(msg, &evt->data.setParameterAcknowledge);
+        break;
+
+    case VSCP_TYPE_CONFIGURATION_SET_PARAMETER_NACK:
+        status = vscp_evt_configuration_parseSetParamterNegativeAcknowledge(msg, &evt->data.setParamterNegativeAcknowledge);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -47,6 +47,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,204 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Load configuration" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t configurationid; /**< ConfigurationId */
+    uint8_t control; /**< Control */
+    BOOL controlAvailable; /**< Control available */
+
+} vscp_evt_configuration_LoadConfiguration;
+
+/** Parameters of the "Load configuration acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_LoadConfigurationAcknowledge;
+
+/** Parameters of the "Load configuration negative acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_LoadConfigurationNegativeAcknowledge;
+
+/** Parameters of the "Save configuration" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t configurationid; /**< ConfigurationId */
+    uint8_t control; /**< Control */
+    BOOL controlAvailable; /**< Control available */
+
+} vscp_evt_configuration_SaveConfiguration;
+
+/** Parameters of the "Save configuration acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_SaveConfigurationAcknowledge;
+
+/** Parameters of the "Save configuration negative acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_SaveConfigurationNegativeAcknowledge;
+
+/** Parameters of the "Commit configuration" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t configurationid; /**< ConfigurationId */
+    uint8_t control; /**< Control */
+    BOOL controlAvailable; /**< Control available */
+
+} vscp_evt_configuration_CommitConfiguration;
+
+/** Parameters of the "Commit configuration acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_CommitConfigurationAcknowledge;
+
+/** Parameters of the "Commit configuration negative acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_CommitConfigurationNegativeAcknowledge;
+
+/** Parameters of the "Reload configuration" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t configurationid; /**< ConfigurationId */
+    uint8_t control; /**< Control */
+    BOOL controlAvailable; /**< Control available */
+
+} vscp_evt_configuration_ReloadConfiguration;
+
+/** Parameters of the "Reload configuration acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_ReloadConfigurationAcknowledge;
+
+/** Parameters of the "Reload configuration negative acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_ReloadConfigurationNegativeAcknowledge;
+
+/** Parameters of the "Restore configuration" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t configurationid; /**< ConfigurationId */
+    uint8_t control; /**< Control */
+    BOOL controlAvailable; /**< Control available */
+
+} vscp_evt_configuration_RestoreConfiguration;
+
+/** Parameters of the "Restore configuration acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_RestoreConfigurationAcknowledge;
+
+/** Parameters of the "Restore configuration negative acknowledge" event. */
+typedef struct
+{
+    uint16_t configurationid; /**< ConfigurationId */
+
+} vscp_evt_configuration_RestoreConfigurationNegativeAcknowledge;
+
+/** Parameters of the "Set parameter" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t parameterid; /**< ParameterId */
+    uint16_t parametervalue; /**< ParameterValue */
+
+} vscp_evt_configuration_SetParameter;
+
+/** Parameters of the "Set parameter to default" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t parameterid; /**< ParameterId */
+
+} vscp_evt_configuration_SetParameterToDefault;
+
+/** Parameters of the "Set parameter acknowledge" event. */
+typedef struct
+{
+    uint16_t parameterid; /**< ParameterId */
+    uint16_t parametervalue; /**< ParameterValue */
+
+} vscp_evt_configuration_SetParameterAcknowledge;
+
+/** Parameters of the "Set paramter negative acknowledge" event. */
+typedef struct
+{
+    uint16_t parameterid; /**< ParameterId */
+    uint16_t parametervalue; /**< ParameterValue */
+
+} vscp_evt_configuration_SetParamterNegativeAcknowledge;
+
+/** Parsed event of the "Configuration" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_configuration_LoadConfiguration loadConfiguration; /**< Parameters of the "Load configuration" event */
+        vscp_evt_configuration_LoadConfigurationAcknowledge loadConfigurationAcknowledge; /**< Parameters of the "Load configuration acknowledge" event */
+        vscp_evt_configuration_LoadConfigurationNegativeAcknowledge loadConfigurationNegativeAcknowledge; /**< Parameters of the "Load configuration negative acknowledge" event */
+        vscp_evt_configuration_SaveConfiguration saveConfiguration; /**< Parameters of the "Save configuration" event */
+        vscp_evt_configuration_SaveConfigurationAcknowledge saveConfigurationAcknowledge; /**< Parameters of the "Save configuration acknowledge" event */
+        vscp_evt_configuration_SaveConfigurationNegativeAcknowledge saveConfigurationNegativeAcknowledge; /**< Parameters of the "Save configuration negative acknowledge" event */
+        vscp_evt_configuration_CommitConfiguration commitConfiguration; /**< Parameters of the "Commit configuration" event */
+        vscp_evt_configuration_CommitConfigurationAcknowledge commitConfigurationAcknowledge; /**< Parameters of the "Commit configuration acknowledge" event */
+        vscp_evt_configuration_CommitConfigurationNegativeAcknowledge commitConfigurationNegativeAcknowledge; /**< Parameters of the "Commit configuration negative acknowledge" event */
+        vscp_evt_configuration_ReloadConfiguration reloadConfiguration; /**< Parameters of the "Reload configuration" event */
+        vscp_evt_configuration_ReloadConfigurationAcknowledge reloadConfigurationAcknowledge; /**< Parameters of the "Reload configuration acknowledge" event */
+        vscp_evt_configuration_ReloadConfigurationNegativeAcknowledge reloadConfigurationNegativeAcknowledge; /**< Parameters of the "Reload configuration negative acknowledge" event */
+        vscp_evt_configuration_RestoreConfiguration restoreConfiguration; /**< Parameters of the "Restore configuration" event */
+        vscp_evt_configuration_RestoreConfigurationAcknowledge restoreConfigurationAcknowledge; /**< Parameters of the "Restore configuration acknowledge" event */
+        vscp_evt_configuration_RestoreConfigurationNegativeAcknowledge restoreConfigurationNegativeAcknowledge; /**< Parameters of the "Restore configuration negative acknowledge" event */
+        vscp_evt_configuration_SetParameter setParameter; /**< Parameters of the "Set parameter" event */
+        vscp_evt_configuration_SetParameterToDefault setParameterToDefault; /**< Parameters of the "Set parameter to default" event */
+        vscp_evt_configuration_SetParameterAcknowledge setParameterAcknowledge; /**< Parameters of the "Set parameter acknowledge" event */
+        vscp_evt_configuration_SetParamterNegativeAcknowledge setParamterNegativeAcknowledge; /**< Parameters of the "Set paramter negative acknowledge" event */
+    } data;
+
+} vscp_evt_configuration_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -284,6 +483,223 @@ extern BOOL vscp_evt_configuration_sendSetParameterAcknowledge(uint16_t paramete
  */
 extern BOOL vscp_evt_configuration_sendSetParamterNegativeAcknowledge(uint16_t parameterid, uint16_t parametervalue);
 
+/**
+ * Parse the "Load configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Load configuration" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseLoadConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_LoadConfiguration * const evt);
+
+/**
+ * Parse the "Load configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Load configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseLoadConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_LoadConfigurationAcknowledge * const evt);
+
+/**
+ * Parse the "Load configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Load configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseLoadConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_LoadConfigurationNegativeAcknowledge * const evt);
+
+/**
+ * Parse the "Save configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save configuration" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSaveConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_SaveConfiguration * const evt);
+
+/**
+ * Parse the "Save configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSaveConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SaveConfigurationAcknowledge * const evt);
+
+/**
+ * Parse the "Save configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSaveConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SaveConfigurationNegativeAcknowledge * const evt);
+
+/**
+ * Parse the "Commit configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Commit configuration" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseCommitConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_CommitConfiguration * const evt);
+
+/**
+ * Parse the "Commit configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Commit configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseCommitConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_CommitConfigurationAcknowledge * const evt);
+
+/**
+ * Parse the "Commit configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Commit configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseCommitConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_CommitConfigurationNegativeAcknowledge * const evt);
+
+/**
+ * Parse the "Reload configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reload configuration" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseReloadConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_ReloadConfiguration * const evt);
+
+/**
+ * Parse the "Reload configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reload configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseReloadConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_ReloadConfigurationAcknowledge * const evt);
+
+/**
+ * Parse the "Reload configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reload configuration negative acknowledge" event, it will return
+ * TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseReloadConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_ReloadConfigurationNegativeAcknowledge * const evt);
+
+/**
+ * Parse the "Restore configuration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Restore configuration" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseRestoreConfiguration(vscp_RxMessage const * const msg, vscp_evt_configuration_RestoreConfiguration * const evt);
+
+/**
+ * Parse the "Restore configuration acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Restore configuration acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseRestoreConfigurationAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_RestoreConfigurationAcknowledge * const evt);
+
+/**
+ * Parse the "Restore configuration negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Restore configuration negative acknowledge" event, it will
+ * return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseRestoreConfigurationNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_RestoreConfigurationNegativeAcknowledge * const evt);
+
+/**
+ * Parse the "Set parameter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set parameter" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParameter(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParameter * const evt);
+
+/**
+ * Parse the "Set parameter to default" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set parameter to default" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParameterToDefault(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParameterToDefault * const evt);
+
+/**
+ * Parse the "Set parameter acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set parameter acknowledge" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParameterAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParameterAcknowledge * const evt);
+
+/**
+ * Parse the "Set paramter negative acknowledge" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set paramter negative acknowledge" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parseSetParamterNegativeAcknowledge(vscp_RxMessage const * const msg, vscp_evt_configuration_SetParamterNegativeAcknowledge * const evt);
+
+/**
+ * Parse a received event of the "Configuration" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_configuration_parse(vscp_RxMessage const * const msg, vscp_evt_configuration_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_control.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -1936,3 +1937,1892 @@ extern BOOL vscp_evt_control_sendDecrement(uint8_t userSpecific, uint8_t zone, u
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Mute on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Mute on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMuteOnOff(vscp_RxMessage const * const msg, vscp_evt_control_MuteOnOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_MUTE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->command = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "(All) Lamp(s) on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "(All) Lamp(s) on/off" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseAllLampSOnOff(vscp_RxMessage const * const msg, vscp_evt_control_AllLampSOnOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_ALL_LAMPS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->state = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Open" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Open" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseOpen(vscp_RxMessage const * const msg, vscp_evt_control_Open * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_OPEN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Close" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Close" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseClose(vscp_RxMessage const * const msg, vscp_evt_control_Close * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_CLOSE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "TurnOn" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "TurnOn" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTurnon(vscp_RxMessage const * const msg, vscp_evt_control_Turnon * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TURNON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "TurnOff" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "TurnOff" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTurnoff(vscp_RxMessage const * const msg, vscp_evt_control_Turnoff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TURNOFF != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Start" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Start" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseStart(vscp_RxMessage const * const msg, vscp_evt_control_Start * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseStop(vscp_RxMessage const * const msg, vscp_evt_control_Stop * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_STOP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Reset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseReset(vscp_RxMessage const * const msg, vscp_evt_control_Reset * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_RESET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Interrupt" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Interrupt" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseInterrupt(vscp_RxMessage const * const msg, vscp_evt_control_Interrupt * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_INTERRUPT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->interruptLevel = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Sleep" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sleep" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSleep(vscp_RxMessage const * const msg, vscp_evt_control_Sleep * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SLEEP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Wakeup" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Wakeup" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseWakeup(vscp_RxMessage const * const msg, vscp_evt_control_Wakeup * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_WAKEUP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Resume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Resume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseResume(vscp_RxMessage const * const msg, vscp_evt_control_Resume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_RESUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Pause" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pause" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parsePause(vscp_RxMessage const * const msg, vscp_evt_control_Pause * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_PAUSE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Activate" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Activate" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseActivate(vscp_RxMessage const * const msg, vscp_evt_control_Activate * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_ACTIVATE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Deactivate" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Deactivate" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseDeactivate(vscp_RxMessage const * const msg, vscp_evt_control_Deactivate * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_DEACTIVATE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set all devices off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set all devices off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetAllDevicesOff(vscp_RxMessage const * const msg, vscp_evt_control_SetAllDevicesOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TURN_ALL_OFF != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set all devices on" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set all devices on" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetAllDevicesOn(vscp_RxMessage const * const msg, vscp_evt_control_SetAllDevicesOn * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TURN_ALL_ON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set all device on/off as of argument" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set all device on/off as of argument" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetAllDeviceOnOffAsOfArgument(vscp_RxMessage const * const msg, vscp_evt_control_SetAllDeviceOnOffAsOfArgument * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TURN_ALL_X != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->state = msg->data[3];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Dim lamp(s)" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Dim lamp(s)" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseDimLampS(vscp_RxMessage const * const msg, vscp_evt_control_DimLampS * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_DIM_LAMPS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->value = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Change Channel" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Change Channel" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseChangeChannel(vscp_RxMessage const * const msg, vscp_evt_control_ChangeChannel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_CHANGE_CHANNEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->channel = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Change Level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Change Level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseChangeLevel(vscp_RxMessage const * const msg, vscp_evt_control_ChangeLevel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_CHANGE_LEVEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->level = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Relative Change Level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Relative Change Level" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseRelativeChangeLevel(vscp_RxMessage const * const msg, vscp_evt_control_RelativeChangeLevel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_RELATIVE_CHANGE_LEVEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->level = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Measurement Request" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Measurement Request" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMeasurementRequest(vscp_RxMessage const * const msg, vscp_evt_control_MeasurementRequest * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_MEASUREMENT_REQUEST != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Stream Data" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stream Data" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseStreamData(vscp_RxMessage const * const msg, vscp_evt_control_StreamData * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_STREAM_DATA != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    for(byteIndex = 0; (byteIndex < 7) && ((1 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[1 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Sync" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sync" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSync(vscp_RxMessage const * const msg, vscp_evt_control_Sync * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SYNC != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Zoned Stream Data" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Zoned Stream Data" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseZonedStreamData(vscp_RxMessage const * const msg, vscp_evt_control_ZonedStreamData * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_ZONED_STREAM_DATA != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set Pre-set" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set Pre-set" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetPreSet(vscp_RxMessage const * const msg, vscp_evt_control_SetPreSet * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SET_PRESET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->presetCode = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Toggle state" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Toggle state" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseToggleState(vscp_RxMessage const * const msg, vscp_evt_control_ToggleState * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TOGGLE_STATE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Timed pulse on" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Timed pulse on" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTimedPulseOn(vscp_RxMessage const * const msg, vscp_evt_control_TimedPulseOn * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TIMED_PULSE_ON != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->control = msg->data[3];
+
+    evt->time = VSCP_UTIL_READ_UINT32_BE(&msg->data[4]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Timed pulse off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Timed pulse off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTimedPulseOff(vscp_RxMessage const * const msg, vscp_evt_control_TimedPulseOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TIMED_PULSE_OFF != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->control = msg->data[3];
+
+    evt->time = VSCP_UTIL_READ_UINT32_BE(&msg->data[4]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set country/language" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set country/language" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetCountryLanguage(vscp_RxMessage const * const msg, vscp_evt_control_SetCountryLanguage * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SET_COUNTRY_LANGUAGE != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->code = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 4) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->codeSpecific[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->codeSpecificSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Big Change level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Big Change level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseBigChangeLevel(vscp_RxMessage const * const msg, vscp_evt_control_BigChangeLevel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_BIG_CHANGE_LEVEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    /* level not supported! */
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Move shutter up" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter up" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterUp(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterUp * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SHUTTER_UP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Move shutter down" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter down" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterDown(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterDown * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SHUTTER_DOWN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Move shutter left" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter left" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterLeft(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterLeft * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SHUTTER_LEFT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Move shutter right" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter right" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterRight(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterRight * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SHUTTER_RIGHT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Move shutter to middle position" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter to middle position" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterToMiddlePosition(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterToMiddlePosition * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SHUTTER_MIDDLE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Move shutter to preset position" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter to preset position" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterToPresetPosition(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterToPresetPosition * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SHUTTER_PRESET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "(All) Lamp(s) on" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "(All) Lamp(s) on" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseAllLampSOn(vscp_RxMessage const * const msg, vscp_evt_control_AllLampSOn * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_ALL_LAMPS_ON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "(All) Lamp(s) off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "(All) Lamp(s) off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseAllLampSOff(vscp_RxMessage const * const msg, vscp_evt_control_AllLampSOff * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_ALL_LAMPS_OFF != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Lock" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Lock" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseLock(vscp_RxMessage const * const msg, vscp_evt_control_Lock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_LOCK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Unlock" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unlock" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseUnlock(vscp_RxMessage const * const msg, vscp_evt_control_Unlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_UNLOCK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "PWM set" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "PWM set" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parsePwmSet(vscp_RxMessage const * const msg, vscp_evt_control_PwmSet * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_PWM != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->repeats = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->control = msg->data[3];
+
+    evt->timeOn = VSCP_UTIL_READ_UINT16_BE(&msg->data[4]);
+
+    evt->timeOff = VSCP_UTIL_READ_UINT16_BE(&msg->data[6]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Lock with token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Lock with token" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseLockWithToken(vscp_RxMessage const * const msg, vscp_evt_control_LockWithToken * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TOKEN_LOCK != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->token[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->tokenSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Unlock with token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unlock with token" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseUnlockWithToken(vscp_RxMessage const * const msg, vscp_evt_control_UnlockWithToken * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_TOKEN_UNLOCK != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->token[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->tokenSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set security level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityLevel(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityLevel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SET_SECURITY_LEVEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->securityLevel = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set security pin" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security pin" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityPin(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityPin * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SET_SECURITY_PIN != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->securityPin[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->securityPinSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set security password" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security password" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityPassword(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityPassword * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SET_SECURITY_PASSWORD != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->securityPassword[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->securityPasswordSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set security token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security token" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityToken(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityToken * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_SET_SECURITY_TOKEN != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->token[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->tokenSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Request new security token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Request new security token" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseRequestNewSecurityToken(vscp_RxMessage const * const msg, vscp_evt_control_RequestNewSecurityToken * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_REQUEST_SECURITY_TOKEN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Increment" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Increment" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseIncrement(vscp_RxMessage const * const msg, vscp_evt_control_Increment * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_INCREMENT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->incrementValue[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->incrementValueSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Decrement" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decrement" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseDecrement(vscp_RxMessage const * const msg, vscp_evt_control_Decrement * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_CONTROL != msg->vscpClass) || (VSCP_TYPE_CONTROL_DECREMENT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->decrementValue[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->decrementValueSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Control" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parse(vscp_RxMessage const * const msg, vscp_evt_control_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_CONTROL != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_CONTROL_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_CONTROL_MUTE:
+        status = vscp_evt_control_parseMuteOnOff(msg, &evt->data.muteOnOff);
+        break;
+
+    case VSCP_TYPE_CONTROL_ALL_LAMPS:
+        status = vscp_evt_control_parseAllLampSOnOff(msg, &evt->data.allLampSOnOff);
+        break;
+
+    case VSCP_TYPE_CONTROL_OPEN:
+        status = vscp_evt_control_parseOpen(msg, &evt->data.open);
+        break;
+
+    case VSCP_TYPE_CONTROL_CLOSE:
+        status = vscp_evt_control_parseClose(msg, &evt->data.close);
+        break;
+
+    case VSCP_TYPE_CONTROL_TURNON:
+        status = vscp_evt_control_parseTurnon(msg, &evt->data.turnon);
+        break;
+
+    case VSCP_TYPE_CONTROL_TURNOFF:
+        status = vscp_evt_control_parseTurnoff(msg, &evt->data.turnoff);
+        break;
+
+    case VSCP_TYPE_CONTROL_START:
+        status = vscp_evt_control_parseStart(msg, &evt->data.start);
+        break;
+
+    case VSCP_TYPE_CONTROL_STOP:
+        status = vscp_evt_control_parseStop(msg, &evt->data.stop);
+        break;
+
+    case VSCP_TYPE_CONTROL_RESET:
+        status = vscp_evt_control_parseReset(msg, &evt->data.reset);
+        break;
+
+    case VSCP_TYPE_CONTROL_INTERRUPT:
+        status = vscp_evt_control_parseInterrupt(msg, &evt->data.interrupt);
+        break;
+
+    case VSCP_TYPE_CONTROL_SLEEP:
+        status = vscp_evt_control_parseSleep(msg, &evt->data.sleep);
+        break;
+
+    case VSCP_TYPE_CONTROL_WAKEUP:
+        status = vscp_evt_control_parseWakeup(msg, &evt->data.wakeup);
+        break;
+
+    case VSCP_TYPE_CONTROL_RESUME:
+        status = vscp_evt_control_parseResume(msg, &evt->data.resume);
+        break;
+
+    case VSCP_TYPE_CONTROL_PAUSE:
+        status = vscp_evt_control_parsePause(msg, &evt->data.pause);
+        break;
+
+    case VSCP_TYPE_CONTROL_ACTIVATE:
+        status = vscp_evt_control_parseActivate(msg, &evt->data.activate);
+        break;
+
+    case VSCP_TYPE_CONTROL_DEACTIVATE:
+        status = vscp_evt_control_parseDeactivate(msg, &evt->data.deactivate);
+        break;
+
+    case VSCP_TYPE_CONTROL_TURN_ALL_OFF:
+        status = vscp_evt_control_parseSetAllDevicesOff(msg, &evt->data.setAllDevicesOff);
+        break;
+
+    case VSCP_TYPE_CONTROL_TURN_ALL_ON:
+        status = vscp_evt_control_parseSetAllDevicesOn(msg, &evt->data.setAllDevicesOn);
+        break;
+
+    case VSCP_TYPE_CONTROL_TURN_ALL_X:
+        status = vscp_evt_control_parseSetAllDeviceOnOffAsOfArgument(msg, &evt->data.setAllDeviceOnOffAsOfArgument);
+        break;
+
+    case VSCP_TYPE_CONTROL_DIM_LAMPS:
+        status = vscp_evt_control_parseDimLampS(msg, &evt->data.dimLampS);
+        break;
+
+    case VSCP_TYPE_CONTROL_CHANGE_CHANNEL:
+        status = vscp_evt_control_parseChangeChannel(msg, &evt->data.changeChannel);
+        break;
+
+    case VSCP_TYPE_CONTROL_CHANGE_LEVEL:
+        status = vscp_evt_control_parseChangeLevel(msg, &evt->data.changeLevel);
+        break;
+
+    case VSCP_TYPE_CONTROL_RELATIVE_CHANGE_LEVEL:
+        status = vscp_evt_control_parseRelativeChangeLevel(msg, &evt->data.relativeChangeLevel);
+        break;
+
+    case VSCP_TYPE_CONTROL_MEASUREMENT_REQUEST:
+        status = vscp_evt_control_parseMeasurementRequest(msg, &evt->data.measurementRequest);
+        break;
+
+    case VSCP_TYPE_CONTROL_STREAM_DATA:
+        status = vscp_evt_control_parseStreamData(msg, &evt->data.streamData);
+        break;
+
+    case VSCP_TYPE_CONTROL_SYNC:
+        status = vscp_evt_control_parseSync(msg, &evt->data.sync);
+        break;
+
+    case VSCP_TYPE_CONTROL_ZONED_STREAM_DATA:
+        status = vscp_evt_control_parseZonedStreamData(msg, &evt->data.zonedStreamData);
+        break;
+
+    case VSCP_TYPE_CONTROL_SET_PRESET:
+        status = vscp_evt_control_parseSetPreSet(msg, &evt->data.setPreSet);
+        break;
+
+    case VSCP_TYPE_CONTROL_TOGGLE_STATE:
+        status = vscp_evt_control_parseToggleState(msg, &evt->data.toggleState);
+        break;
+
+    case VSCP_TYPE_CONTROL_TIMED_PULSE_ON:
+        status = vscp_evt_control_parseTimedPulseOn(msg, &evt->data.timedPulseOn);
+        break;
+
+    case VSCP_TYPE_CONTROL_TIMED_PULSE_OFF:
+        status = vscp_evt_control_parseTimedPulseOff(msg, &evt->data.timedPulseOff);
+        break;
+
+    case VSCP_TYPE_CONTROL_SET_COUNTRY_LANGUAGE:
+        status = vscp_evt_control_parseSetCountryLanguage(msg, &evt->data.setCountryLanguage);
+        break;
+
+    case VSCP_TYPE_CONTROL_BIG_CHANGE_LEVEL:
+        status = vscp_evt_control_parseBigChangeLevel(msg, &evt->data.bigChangeLevel);
+        break;
+
+    case VSCP_TYPE_CONTROL_SHUTTER_UP:
+        status = vscp_evt_control_parseMoveShutterUp(msg, &evt->data.moveShutterUp);
+        break;
+
+    case VSCP_TYPE_CONTROL_SHUTTER_DOWN:
+        status = vscp_evt_control_parseMoveShutterDown(msg, &evt->data.moveShutterDown);
+        break;
+
+    case VSCP_TYPE_CONTROL_SHUTTER_LEFT:
+        status = vscp_evt_control_parseMoveShutterLeft(msg, &evt->data.moveShutterLeft);
+        break;
+
+    case VSCP_TYPE_CONTROL_SHUTTER_RIGHT:
+        status = vscp_evt_control_parseMoveShutterRight(msg, &evt->data.moveShutterRight);
+        break;
+
+    case VSCP_TYPE_CONTROL_SHUTTER_MIDDLE:
+        status = vscp_evt_control_parseMoveShutterToMiddlePosition(msg, &evt->data.moveShutterToMiddlePosition);
+        break;
+
+    case VSCP_TYPE_CONTROL_SHUTTER_PRESET:
+        status = vscp_evt_control_parseMoveShutterToPresetPosition(msg, &evt->data.moveShutterToPresetPosition);
+        break;
+
+    case VSCP_TYPE_CONTROL_ALL_LAMPS_ON:
+        status = vscp_evt_control_parseAllLampSOn(msg, &evt->data.allLampSOn);
+        break;
+
+    case VSCP_TYPE_CONTROL_ALL_LAMPS_OFF:
+        status = vscp_evt_control_parseAllLampSOff(msg, &evt->data.allLampSOff);
+        break;
+
+    case VSCP_TYPE_CONTROL_LOCK:
+        status = vscp_evt_control_parseLock(msg, &evt->data.lock);
+        break;
+
+    case VSCP_TYPE_CONTROL_UNLOCK:
+        status = vscp_evt_control_parseUnlock(msg, &evt->data.unlock);
+        break;
+
+    case VSCP_TYPE_CONTROL_PWM:
+        status = vscp_evt_control_parsePwmSet(msg, &evt->data.pwmSet);
+        break;
+
+    case VSCP_TYPE_CONTROL_TOKEN_LOCK:
+        status = vscp_evt_control_parseLockWithToken(msg, &evt->data.lockWithToken);
+        break;
+
+    case VSCP_TYPE_CONTROL_TOKEN_UNLOCK:
+        status = vscp_evt_control_parseUnlockWithToken(msg, &evt->data.unlockWithToken);
+        break;
+
+    case VSCP_TYPE_CONTROL_SET_SECURITY_LEVEL:
+        status = vscp_evt_control_parseSetSecurityLevel(msg, &evt->data.setSecurityLevel);
+        break;
+
+    case VSCP_TYPE_CONTROL_SET_SECURITY_PIN:
+        status = vscp_evt_control_parseSetSecurityPin(msg, &evt->data.setSecurityPin);
+        break;
+
+    case VSCP_TYPE_CONTROL_SET_SECURITY_PASSWORD:
+        status = vscp_evt_control_parseSetSecurityPassword(msg, &evt->data.setSecurityPassword);
+        break;
+
+    case VSCP_TYPE_CONTROL_SET_SECURITY_TOKEN:
+        status = vscp_evt_control_parseSetSecurityToken(msg, &evt->data.setSecurityToken);
+        break;
+
+    case VSCP_TYPE_CONTROL_REQUEST_SECURITY_TOKEN:
+        status = vscp_evt_control_parseRequestNewSecurityToken(msg, &evt->data.requestNewSecurityToken);
+        break;
+
+    case VSCP_TYPE_CONTROL_INCREMENT:
+        status = vscp_evt_control_parseIncrement(msg, &evt->data.increment);
+        break;
+
+    case VSCP_TYPE_CONTROL_DECREMENT:
+        status = vscp_evt_control_parseDecrement(msg, &evt->data.decrement);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -51,6 +51,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -73,6 +74,575 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Mute on/off" event. */
+typedef struct
+{
+    uint8_t command; /**< Command */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MuteOnOff;
+
+/** Parameters of the "(All) Lamp(s) on/off" event. */
+typedef struct
+{
+    uint8_t state; /**< State */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_AllLampSOnOff;
+
+/** Parameters of the "Open" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Open;
+
+/** Parameters of the "Close" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Close;
+
+/** Parameters of the "TurnOn" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Turnon;
+
+/** Parameters of the "TurnOff" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Turnoff;
+
+/** Parameters of the "Start" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Start;
+
+/** Parameters of the "Stop" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Stop;
+
+/** Parameters of the "Reset" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Reset;
+
+/** Parameters of the "Interrupt" event. */
+typedef struct
+{
+    uint8_t interruptLevel; /**< Interrupt level */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Interrupt;
+
+/** Parameters of the "Sleep" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Sleep;
+
+/** Parameters of the "Wakeup" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Wakeup;
+
+/** Parameters of the "Resume" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Resume;
+
+/** Parameters of the "Pause" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Pause;
+
+/** Parameters of the "Activate" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Activate;
+
+/** Parameters of the "Deactivate" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Deactivate;
+
+/** Parameters of the "Set all devices off" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_SetAllDevicesOff;
+
+/** Parameters of the "Set all devices on" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_SetAllDevicesOn;
+
+/** Parameters of the "Set all device on/off as of argument" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t state; /**< State */
+
+} vscp_evt_control_SetAllDeviceOnOffAsOfArgument;
+
+/** Parameters of the "Dim lamp(s)" event. */
+typedef struct
+{
+    uint8_t value; /**< Value */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_DimLampS;
+
+/** Parameters of the "Change Channel" event. */
+typedef struct
+{
+    uint8_t channel; /**< Channel */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_ChangeChannel;
+
+/** Parameters of the "Change Level" event. */
+typedef struct
+{
+    uint8_t level; /**< Level */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_ChangeLevel;
+
+/** Parameters of the "Relative Change Level" event. */
+typedef struct
+{
+    uint8_t level; /**< Level */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_RelativeChangeLevel;
+
+/** Parameters of the "Measurement Request" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MeasurementRequest;
+
+/** Parameters of the "Stream Data" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t data[7]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_control_StreamData;
+
+/** Parameters of the "Sync" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Sync;
+
+/** Parameters of the "Zoned Stream Data" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t data[5]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_control_ZonedStreamData;
+
+/** Parameters of the "Set Pre-set" event. */
+typedef struct
+{
+    uint8_t presetCode; /**< Preset code */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_SetPreSet;
+
+/** Parameters of the "Toggle state" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_ToggleState;
+
+/** Parameters of the "Timed pulse on" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t control; /**< Control */
+    uint32_t time; /**< Time */
+
+} vscp_evt_control_TimedPulseOn;
+
+/** Parameters of the "Timed pulse off" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t control; /**< Control */
+    uint32_t time; /**< Time */
+
+} vscp_evt_control_TimedPulseOff;
+
+/** Parameters of the "Set country/language" event. */
+typedef struct
+{
+    uint8_t code; /**< Code */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t codeSpecific[4]; /**< Code specific */
+    uint8_t codeSpecificSize; /**< Code specific size */
+
+} vscp_evt_control_SetCountryLanguage;
+
+/** Parameters of the "Big Change level" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    int32_t level; /**< Level */
+
+} vscp_evt_control_BigChangeLevel;
+
+/** Parameters of the "Move shutter up" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MoveShutterUp;
+
+/** Parameters of the "Move shutter down" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MoveShutterDown;
+
+/** Parameters of the "Move shutter left" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MoveShutterLeft;
+
+/** Parameters of the "Move shutter right" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MoveShutterRight;
+
+/** Parameters of the "Move shutter to middle position" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MoveShutterToMiddlePosition;
+
+/** Parameters of the "Move shutter to preset position" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_MoveShutterToPresetPosition;
+
+/** Parameters of the "(All) Lamp(s) on" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_AllLampSOn;
+
+/** Parameters of the "(All) Lamp(s) off" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_AllLampSOff;
+
+/** Parameters of the "Lock" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Lock;
+
+/** Parameters of the "Unlock" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_control_Unlock;
+
+/** Parameters of the "PWM set" event. */
+typedef struct
+{
+    uint8_t repeats; /**< Repeats */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t control; /**< Control */
+    uint16_t timeOn; /**< Time-On */
+    uint16_t timeOff; /**< Time-Off */
+
+} vscp_evt_control_PwmSet;
+
+/** Parameters of the "Lock with token" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t token[5]; /**< Token */
+    uint8_t tokenSize; /**< Token size */
+
+} vscp_evt_control_LockWithToken;
+
+/** Parameters of the "Unlock with token" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t token[5]; /**< Token */
+    uint8_t tokenSize; /**< Token size */
+
+} vscp_evt_control_UnlockWithToken;
+
+/** Parameters of the "Set security level" event. */
+typedef struct
+{
+    uint8_t securityLevel; /**< Security Level */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_control_SetSecurityLevel;
+
+/** Parameters of the "Set security pin" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t securityPin[5]; /**< Security pin */
+    uint8_t securityPinSize; /**< Security pin size */
+
+} vscp_evt_control_SetSecurityPin;
+
+/** Parameters of the "Set security password" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t securityPassword[5]; /**< Security password */
+    uint8_t securityPasswordSize; /**< Security password size */
+
+} vscp_evt_control_SetSecurityPassword;
+
+/** Parameters of the "Set security token" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t token[5]; /**< Token */
+    uint8_t tokenSize; /**< Token size */
+
+} vscp_evt_control_SetSecurityToken;
+
+/** Parameters of the "Request new security token" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_control_RequestNewSecurityToken;
+
+/** Parameters of the "Increment" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint8_t incrementValue[5]; /**< Increment value */
+    uint8_t incrementValueSize; /**< Increment value size */
+
+} vscp_evt_control_Increment;
+
+/** Parameters of the "Decrement" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint8_t decrementValue[5]; /**< Decrement value */
+    uint8_t decrementValueSize; /**< Decrement value size */
+
+} vscp_evt_control_Decrement;
+
+/** Parsed event of the "Control" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_control_MuteOnOff muteOnOff; /**< Parameters of the "Mute on/off" event */
+        vscp_evt_control_AllLampSOnOff allLampSOnOff; /**< Parameters of the "(All) Lamp(s) on/off" event */
+        vscp_evt_control_Open open; /**< Parameters of the "Open" event */
+        vscp_evt_control_Close close; /**< Parameters of the "Close" event */
+        vscp_evt_control_Turnon turnon; /**< Parameters of the "TurnOn" event */
+        vscp_evt_control_Turnoff turnoff; /**< Parameters of the "TurnOff" event */
+        vscp_evt_control_Start start; /**< Parameters of the "Start" event */
+        vscp_evt_control_Stop stop; /**< Parameters of the "Stop" event */
+        vscp_evt_control_Reset reset; /**< Parameters of the "Reset" event */
+        vscp_evt_control_Interrupt interrupt; /**< Parameters of the "Interrupt" event */
+        vscp_evt_control_Sleep sleep; /**< Parameters of the "Sleep" event */
+        vscp_evt_control_Wakeup wakeup; /**< Parameters of the "Wakeup" event */
+        vscp_evt_control_Resume resume; /**< Parameters of the "Resume" event */
+        vscp_evt_control_Pause pause; /**< Parameters of the "Pause" event */
+        vscp_evt_control_Activate activate; /**< Parameters of the "Activate" event */
+        vscp_evt_control_Deactivate deactivate; /**< Parameters of the "Deactivate" event */
+        vscp_evt_control_SetAllDevicesOff setAllDevicesOff; /**< Parameters of the "Set all devices off" event */
+        vscp_evt_control_SetAllDevicesOn setAllDevicesOn; /**< Parameters of the "Set all devices on" event */
+        vscp_evt_control_SetAllDeviceOnOffAsOfArgument setAllDeviceOnOffAsOfArgument; /**< Parameters of the "Set all device on/off as of argument" event */
+        vscp_evt_control_DimLampS dimLampS; /**< Parameters of the "Dim lamp(s)" event */
+        vscp_evt_control_ChangeChannel changeChannel; /**< Parameters of the "Change Channel" event */
+        vscp_evt_control_ChangeLevel changeLevel; /**< Parameters of the "Change Level" event */
+        vscp_evt_control_RelativeChangeLevel relativeChangeLevel; /**< Parameters of the "Relative Change Level" event */
+        vscp_evt_control_MeasurementRequest measurementRequest; /**< Parameters of the "Measurement Request" event */
+        vscp_evt_control_StreamData streamData; /**< Parameters of the "Stream Data" event */
+        vscp_evt_control_Sync sync; /**< Parameters of the "Sync" event */
+        vscp_evt_control_ZonedStreamData zonedStreamData; /**< Parameters of the "Zoned Stream Data" event */
+        vscp_evt_control_SetPreSet setPreSet; /**< Parameters of the "Set Pre-set" event */
+        vscp_evt_control_ToggleState toggleState; /**< Parameters of the "Toggle state" event */
+        vscp_evt_control_TimedPulseOn timedPulseOn; /**< Parameters of the "Timed pulse on" event */
+        vscp_evt_control_TimedPulseOff timedPulseOff; /**< Parameters of the "Timed pulse off" event */
+        vscp_evt_control_SetCountryLanguage setCountryLanguage; /**< Parameters of the "Set country/language" event */
+        vscp_evt_control_BigChangeLevel bigChangeLevel; /**< Parameters of the "Big Change level" event */
+        vscp_evt_control_MoveShutterUp moveShutterUp; /**< Parameters of the "Move shutter up" event */
+        vscp_evt_control_MoveShutterDown moveShutterDown; /**< Parameters of the "Move shutter down" event */
+        vscp_evt_control_MoveShutterLeft moveShutterLeft; /**< Parameters of the "Move shutter left" event */
+        vscp_evt_control_MoveShutterRight moveShutterRight; /**< Parameters of the "Move shutter right" event */
+        vscp_evt_control_MoveShutterToMiddlePosition moveShutterToMiddlePosition; /**< Parameters of the "Move shutter to middle position" event */
+        vscp_evt_control_MoveShutterToPresetPosition moveShutterToPresetPosition; /**< Parameters of the "Move shutter to preset position" event */
+        vscp_evt_control_AllLampSOn allLampSOn; /**< Parameters of the "(All) Lamp(s) on" event */
+        vscp_evt_control_AllLampSOff allLampSOff; /**< Parameters of the "(All) Lamp(s) off" event */
+        vscp_evt_control_Lock lock; /**< Parameters of the "Lock" event */
+        vscp_evt_control_Unlock unlock; /**< Parameters of the "Unlock" event */
+        vscp_evt_control_PwmSet pwmSet; /**< Parameters of the "PWM set" event */
+        vscp_evt_control_LockWithToken lockWithToken; /**< Parameters of the "Lock with token" event */
+        vscp_evt_control_UnlockWithToken unlockWithToken; /**< Parameters of the "Unlock with token" event */
+        vscp_evt_control_SetSecurityLevel setSecurityLevel; /**< Parameters of the "Set security level" event */
+        vscp_evt_control_SetSecurityPin setSecurityPin; /**< Parameters of the "Set security pin" event */
+        vscp_evt_control_SetSecurityPassword setSecurityPassword; /**< Parameters of the "Set security password" event */
+        vscp_evt_control_SetSecurityToken setSecurityToken; /**< Parameters of the "Set security token" event */
+        vscp_evt_control_RequestNewSecurityToken requestNewSecurityToken; /**< Parameters of the "Request new security token" event */
+        vscp_evt_control_Increment increment; /**< Parameters of the "Increment" event */
+        vscp_evt_control_Decrement decrement; /**< Parameters of the "Decrement" event */
+    } data;
+
+} vscp_evt_control_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -740,6 +1310,555 @@ extern BOOL vscp_evt_control_sendIncrement(uint8_t userSpecific, uint8_t zone, u
  */
 extern BOOL vscp_evt_control_sendDecrement(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint8_t const * const decrementValue, uint8_t decrementValueSize);
 
+/**
+ * Parse the "Mute on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Mute on/off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMuteOnOff(vscp_RxMessage const * const msg, vscp_evt_control_MuteOnOff * const evt);
+
+/**
+ * Parse the "(All) Lamp(s) on/off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "(All) Lamp(s) on/off" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseAllLampSOnOff(vscp_RxMessage const * const msg, vscp_evt_control_AllLampSOnOff * const evt);
+
+/**
+ * Parse the "Open" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Open" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseOpen(vscp_RxMessage const * const msg, vscp_evt_control_Open * const evt);
+
+/**
+ * Parse the "Close" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Close" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseClose(vscp_RxMessage const * const msg, vscp_evt_control_Close * const evt);
+
+/**
+ * Parse the "TurnOn" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "TurnOn" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTurnon(vscp_RxMessage const * const msg, vscp_evt_control_Turnon * const evt);
+
+/**
+ * Parse the "TurnOff" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "TurnOff" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTurnoff(vscp_RxMessage const * const msg, vscp_evt_control_Turnoff * const evt);
+
+/**
+ * Parse the "Start" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Start" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseStart(vscp_RxMessage const * const msg, vscp_evt_control_Start * const evt);
+
+/**
+ * Parse the "Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseStop(vscp_RxMessage const * const msg, vscp_evt_control_Stop * const evt);
+
+/**
+ * Parse the "Reset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseReset(vscp_RxMessage const * const msg, vscp_evt_control_Reset * const evt);
+
+/**
+ * Parse the "Interrupt" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Interrupt" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseInterrupt(vscp_RxMessage const * const msg, vscp_evt_control_Interrupt * const evt);
+
+/**
+ * Parse the "Sleep" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sleep" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSleep(vscp_RxMessage const * const msg, vscp_evt_control_Sleep * const evt);
+
+/**
+ * Parse the "Wakeup" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Wakeup" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseWakeup(vscp_RxMessage const * const msg, vscp_evt_control_Wakeup * const evt);
+
+/**
+ * Parse the "Resume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Resume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseResume(vscp_RxMessage const * const msg, vscp_evt_control_Resume * const evt);
+
+/**
+ * Parse the "Pause" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pause" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parsePause(vscp_RxMessage const * const msg, vscp_evt_control_Pause * const evt);
+
+/**
+ * Parse the "Activate" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Activate" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseActivate(vscp_RxMessage const * const msg, vscp_evt_control_Activate * const evt);
+
+/**
+ * Parse the "Deactivate" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Deactivate" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseDeactivate(vscp_RxMessage const * const msg, vscp_evt_control_Deactivate * const evt);
+
+/**
+ * Parse the "Set all devices off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set all devices off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetAllDevicesOff(vscp_RxMessage const * const msg, vscp_evt_control_SetAllDevicesOff * const evt);
+
+/**
+ * Parse the "Set all devices on" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set all devices on" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetAllDevicesOn(vscp_RxMessage const * const msg, vscp_evt_control_SetAllDevicesOn * const evt);
+
+/**
+ * Parse the "Set all device on/off as of argument" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set all device on/off as of argument" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetAllDeviceOnOffAsOfArgument(vscp_RxMessage const * const msg, vscp_evt_control_SetAllDeviceOnOffAsOfArgument * const evt);
+
+/**
+ * Parse the "Dim lamp(s)" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Dim lamp(s)" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseDimLampS(vscp_RxMessage const * const msg, vscp_evt_control_DimLampS * const evt);
+
+/**
+ * Parse the "Change Channel" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Change Channel" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseChangeChannel(vscp_RxMessage const * const msg, vscp_evt_control_ChangeChannel * const evt);
+
+/**
+ * Parse the "Change Level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Change Level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseChangeLevel(vscp_RxMessage const * const msg, vscp_evt_control_ChangeLevel * const evt);
+
+/**
+ * Parse the "Relative Change Level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Relative Change Level" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseRelativeChangeLevel(vscp_RxMessage const * const msg, vscp_evt_control_RelativeChangeLevel * const evt);
+
+/**
+ * Parse the "Measurement Request" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Measurement Request" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMeasurementRequest(vscp_RxMessage const * const msg, vscp_evt_control_MeasurementRequest * const evt);
+
+/**
+ * Parse the "Stream Data" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stream Data" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseStreamData(vscp_RxMessage const * const msg, vscp_evt_control_StreamData * const evt);
+
+/**
+ * Parse the "Sync" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sync" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSync(vscp_RxMessage const * const msg, vscp_evt_control_Sync * const evt);
+
+/**
+ * Parse the "Zoned Stream Data" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Zoned Stream Data" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseZonedStreamData(vscp_RxMessage const * const msg, vscp_evt_control_ZonedStreamData * const evt);
+
+/**
+ * Parse the "Set Pre-set" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set Pre-set" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetPreSet(vscp_RxMessage const * const msg, vscp_evt_control_SetPreSet * const evt);
+
+/**
+ * Parse the "Toggle state" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Toggle state" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseToggleState(vscp_RxMessage const * const msg, vscp_evt_control_ToggleState * const evt);
+
+/**
+ * Parse the "Timed pulse on" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Timed pulse on" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTimedPulseOn(vscp_RxMessage const * const msg, vscp_evt_control_TimedPulseOn * const evt);
+
+/**
+ * Parse the "Timed pulse off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Timed pulse off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseTimedPulseOff(vscp_RxMessage const * const msg, vscp_evt_control_TimedPulseOff * const evt);
+
+/**
+ * Parse the "Set country/language" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set country/language" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetCountryLanguage(vscp_RxMessage const * const msg, vscp_evt_control_SetCountryLanguage * const evt);
+
+/**
+ * Parse the "Big Change level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Big Change level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseBigChangeLevel(vscp_RxMessage const * const msg, vscp_evt_control_BigChangeLevel * const evt);
+
+/**
+ * Parse the "Move shutter up" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter up" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterUp(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterUp * const evt);
+
+/**
+ * Parse the "Move shutter down" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter down" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterDown(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterDown * const evt);
+
+/**
+ * Parse the "Move shutter left" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter left" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterLeft(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterLeft * const evt);
+
+/**
+ * Parse the "Move shutter right" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter right" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterRight(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterRight * const evt);
+
+/**
+ * Parse the "Move shutter to middle position" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter to middle position" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterToMiddlePosition(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterToMiddlePosition * const evt);
+
+/**
+ * Parse the "Move shutter to preset position" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Move shutter to preset position" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseMoveShutterToPresetPosition(vscp_RxMessage const * const msg, vscp_evt_control_MoveShutterToPresetPosition * const evt);
+
+/**
+ * Parse the "(All) Lamp(s) on" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "(All) Lamp(s) on" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseAllLampSOn(vscp_RxMessage const * const msg, vscp_evt_control_AllLampSOn * const evt);
+
+/**
+ * Parse the "(All) Lamp(s) off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "(All) Lamp(s) off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseAllLampSOff(vscp_RxMessage const * const msg, vscp_evt_control_AllLampSOff * const evt);
+
+/**
+ * Parse the "Lock" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Lock" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseLock(vscp_RxMessage const * const msg, vscp_evt_control_Lock * const evt);
+
+/**
+ * Parse the "Unlock" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unlock" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseUnlock(vscp_RxMessage const * const msg, vscp_evt_control_Unlock * const evt);
+
+/**
+ * Parse the "PWM set" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "PWM set" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parsePwmSet(vscp_RxMessage const * const msg, vscp_evt_control_PwmSet * const evt);
+
+/**
+ * Parse the "Lock with token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Lock with token" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseLockWithToken(vscp_RxMessage const * const msg, vscp_evt_control_LockWithToken * const evt);
+
+/**
+ * Parse the "Unlock with token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unlock with token" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseUnlockWithToken(vscp_RxMessage const * const msg, vscp_evt_control_UnlockWithToken * const evt);
+
+/**
+ * Parse the "Set security level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityLevel(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityLevel * const evt);
+
+/**
+ * Parse the "Set security pin" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security pin" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityPin(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityPin * const evt);
+
+/**
+ * Parse the "Set security password" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security password" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityPassword(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityPassword * const evt);
+
+/**
+ * Parse the "Set security token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set security token" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseSetSecurityToken(vscp_RxMessage const * const msg, vscp_evt_control_SetSecurityToken * const evt);
+
+/**
+ * Parse the "Request new security token" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Request new security token" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_control_parseRequestNewSecurityToken(vscp_RxMessage const * const msg, vscp_evt_control_RequestNewSecurityToken * const evt);
+
+/**
+ * Parse the "Increment" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Increment" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseIncrement(vscp_RxMessage const * const msg, vscp_evt_control_Increment * const evt);
+
+/**
+ * Parse the "Decrement" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decrement" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parseDecrement(vscp_RxMessage const * const msg, vscp_evt_control_Decrement * const evt);
+
+/**
+ * Parse a received event of the "Control" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_control_parse(vscp_RxMessage const * const msg, vscp_evt_control_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_data.h"
+#include "vscp_util.h"
 #include "vscp_data_coding.h"
 
 /*******************************************************************************
@@ -73,24 +74,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_data_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * I/O value
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -98,11 +84,11 @@ extern BOOL vscp_evt_data_sendGeneralEvent(void)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendIOValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_data_sendByType(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp)
 {
     vscp_TxMessage  txMsg;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_IO, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.dataSize = 1;
     txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
@@ -113,32 +99,11 @@ extern BOOL vscp_evt_data_sendIOValue(uint8_t index, uint8_t unit, int32_t data,
 }
 
 /**
- * A/D value
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * Generic sender for all types, which share the same frame layout.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_data_sendADValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_AD, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * D/A value
+ * The data is sent in the most compact data coding representation.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -146,89 +111,100 @@ extern BOOL vscp_evt_data_sendADValue(uint8_t index, uint8_t unit, int32_t data,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendDAValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_data_sendByTypeCompact(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp)
 {
     vscp_TxMessage  txMsg;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_DA, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, vscpType, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
+    txMsg.dataSize = vscp_data_coding_encodeCompact(data, exp, unit, index, &txMsg.data[0], VSCP_L1_DATA_SIZE);
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Relative strength
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendRelativeStrength(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_data_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_RELATIVE_STRENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Signal Level
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
  * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendSignalLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_data_parseCommon(vscp_RxMessage const * const msg, vscp_evt_data_Common * const evt)
 {
-    vscp_TxMessage  txMsg;
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_SIGNAL_LEVEL, VSCP_PRIORITY_3_NORMAL);
+    if (VSCP_CLASS_L1_DATA != msg->vscpClass)
+    {
+        return FALSE;
+    }
 
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
+    return vscp_data_coding_decode(&msg->data[0], msg->dataSize, evt);
 }
 
 /**
- * Signal Quality
+ * Parse a received event of the "Data" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
  * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendSignalQuality(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_data_parse(vscp_RxMessage const * const msg, vscp_evt_data_Event * const evt)
 {
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_DATA, VSCP_TYPE_DATA_SIGNAL_QUALITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_DATA != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_DATA_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_DATA_IO:
+    case VSCP_TYPE_DATA_AD:
+    case VSCP_TYPE_DATA_DA:
+    case VSCP_TYPE_DATA_RELATIVE_STRENGTH:
+    case VSCP_TYPE_DATA_SIGNAL_LEVEL:
+    case VSCP_TYPE_DATA_SIGNAL_QUALITY:
+        status = vscp_evt_data_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
@@ -48,6 +48,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_data_coding.h"
+#include "vscp_type_data.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -70,6 +73,22 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef vscp_data_coding_Value vscp_evt_data_Common;
+
+/** Parsed event of the "Data" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_data_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_data_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -78,6 +97,34 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_data_sendByType(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_data_sendByTypeCompact(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+
 /**
  * General event
  * 
@@ -95,7 +142,27 @@ extern BOOL vscp_evt_data_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendIOValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_data_sendIOValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByType(VSCP_TYPE_DATA_IO, index, unit, data, exp);
+}
+
+/**
+ * I/O value
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_data_sendIOValueCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByTypeCompact(VSCP_TYPE_DATA_IO, index, unit, data, exp);
+}
 
 /**
  * A/D value
@@ -107,11 +174,48 @@ extern BOOL vscp_evt_data_sendIOValue(uint8_t index, uint8_t unit, int32_t data,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendADValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_data_sendADValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByType(VSCP_TYPE_DATA_AD, index, unit, data, exp);
+}
+
+/**
+ * A/D value
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_data_sendADValueCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByTypeCompact(VSCP_TYPE_DATA_AD, index, unit, data, exp);
+}
+
+/**
+ * D/A value
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_data_sendDAValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByType(VSCP_TYPE_DATA_DA, index, unit, data, exp);
+}
 
 /**
  * D/A value
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -119,7 +223,10 @@ extern BOOL vscp_evt_data_sendADValue(uint8_t index, uint8_t unit, int32_t data,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendDAValue(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_data_sendDAValueCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByTypeCompact(VSCP_TYPE_DATA_DA, index, unit, data, exp);
+}
 
 /**
  * Relative strength
@@ -131,11 +238,48 @@ extern BOOL vscp_evt_data_sendDAValue(uint8_t index, uint8_t unit, int32_t data,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendRelativeStrength(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_data_sendRelativeStrength(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByType(VSCP_TYPE_DATA_RELATIVE_STRENGTH, index, unit, data, exp);
+}
+
+/**
+ * Relative strength
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_data_sendRelativeStrengthCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByTypeCompact(VSCP_TYPE_DATA_RELATIVE_STRENGTH, index, unit, data, exp);
+}
+
+/**
+ * Signal Level
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_data_sendSignalLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByType(VSCP_TYPE_DATA_SIGNAL_LEVEL, index, unit, data, exp);
+}
 
 /**
  * Signal Level
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -143,7 +287,10 @@ extern BOOL vscp_evt_data_sendRelativeStrength(uint8_t index, uint8_t unit, int3
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendSignalLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_data_sendSignalLevelCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByTypeCompact(VSCP_TYPE_DATA_SIGNAL_LEVEL, index, unit, data, exp);
+}
 
 /**
  * Signal Quality
@@ -155,7 +302,48 @@ extern BOOL vscp_evt_data_sendSignalLevel(uint8_t index, uint8_t unit, int32_t d
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_data_sendSignalQuality(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_data_sendSignalQuality(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByType(VSCP_TYPE_DATA_SIGNAL_QUALITY, index, unit, data, exp);
+}
+
+/**
+ * Signal Quality
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_data_sendSignalQualityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_data_sendByTypeCompact(VSCP_TYPE_DATA_SIGNAL_QUALITY, index, unit, data, exp);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_data_parseCommon(vscp_RxMessage const * const msg, vscp_evt_data_Common * const evt);
+
+/**
+ * Parse a received event of the "Data" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_data_parse(vscp_RxMessage const * const msg, vscp_evt_data_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -47,6 +47,8 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_type_diagnostic.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +71,30 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t user[5]; /**< User */
+    uint8_t userSize; /**< User size */
+
+} vscp_evt_diagnostic_Common;
+
+/** Parsed event of the "Diagnostic" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_diagnostic_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_diagnostic_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -77,6 +103,21 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index. Often used as an index for channels/subdevices within a module.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] user Can be present or not be present. If present the bytes give additional user
+ * specific information. (optional) (array[5])
+ * @param[in] usersize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_diagnostic_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+
 /**
  * General event
  * 
@@ -96,7 +137,10 @@ extern BOOL vscp_evt_diagnostic_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendOvervoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendOvervoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_OVERVOLTAGE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Undervoltage
@@ -110,7 +154,10 @@ extern BOOL vscp_evt_diagnostic_sendOvervoltage(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendUndervoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendUndervoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_UNDERVOLTAGE, index, zone, subZone, user, userSize);
+}
 
 /**
  * USB VBUS low
@@ -124,7 +171,10 @@ extern BOOL vscp_evt_diagnostic_sendUndervoltage(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendUsbVbusLow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendUsbVbusLow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_VBUS_LOW, index, zone, subZone, user, userSize);
+}
 
 /**
  * Battery voltage low
@@ -138,7 +188,10 @@ extern BOOL vscp_evt_diagnostic_sendUsbVbusLow(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendBatteryVoltageLow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendBatteryVoltageLow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_BATTERY_LOW, index, zone, subZone, user, userSize);
+}
 
 /**
  * Battery full voltage
@@ -152,7 +205,10 @@ extern BOOL vscp_evt_diagnostic_sendBatteryVoltageLow(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendBatteryFullVoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendBatteryFullVoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_BATTERY_FULL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Battery error
@@ -166,7 +222,10 @@ extern BOOL vscp_evt_diagnostic_sendBatteryFullVoltage(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendBatteryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendBatteryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_BATTERY_ERROR, index, zone, subZone, user, userSize);
+}
 
 /**
  * Battery OK
@@ -180,7 +239,10 @@ extern BOOL vscp_evt_diagnostic_sendBatteryError(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendBatteryOk(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendBatteryOk(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_BATTERY_OK, index, zone, subZone, user, userSize);
+}
 
 /**
  * Over current
@@ -194,7 +256,10 @@ extern BOOL vscp_evt_diagnostic_sendBatteryOk(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendOverCurrent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendOverCurrent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_OVERCURRENT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Circuit error
@@ -208,7 +273,10 @@ extern BOOL vscp_evt_diagnostic_sendOverCurrent(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendCircuitError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendCircuitError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_CIRCUIT_ERROR, index, zone, subZone, user, userSize);
+}
 
 /**
  * Short circuit
@@ -222,7 +290,10 @@ extern BOOL vscp_evt_diagnostic_sendCircuitError(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendShortCircuit(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendShortCircuit(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SHORT_CIRCUIT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Open Circuit
@@ -236,7 +307,10 @@ extern BOOL vscp_evt_diagnostic_sendShortCircuit(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendOpenCircuit(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendOpenCircuit(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_OPEN_CIRCUIT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Moist
@@ -250,7 +324,10 @@ extern BOOL vscp_evt_diagnostic_sendOpenCircuit(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendMoist(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendMoist(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_MOIST, index, zone, subZone, user, userSize);
+}
 
 /**
  * Wire failure
@@ -264,7 +341,10 @@ extern BOOL vscp_evt_diagnostic_sendMoist(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendWireFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendWireFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_WIRE_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Wireless faliure
@@ -278,7 +358,10 @@ extern BOOL vscp_evt_diagnostic_sendWireFailure(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendWirelessFaliure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendWirelessFaliure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_WIRELESS_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * IR failure
@@ -292,7 +375,10 @@ extern BOOL vscp_evt_diagnostic_sendWirelessFaliure(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendIrFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendIrFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_IR_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * 1-wire failure
@@ -306,7 +392,10 @@ extern BOOL vscp_evt_diagnostic_sendIrFailure(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_send1WireFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_send1WireFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_1WIRE_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * RS-222 failure
@@ -320,7 +409,10 @@ extern BOOL vscp_evt_diagnostic_send1WireFailure(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRs222Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRs222Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RS222_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * RS-232 failure
@@ -334,7 +426,10 @@ extern BOOL vscp_evt_diagnostic_sendRs222Failure(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRs232Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRs232Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RS232_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * RS-423 failure
@@ -348,7 +443,10 @@ extern BOOL vscp_evt_diagnostic_sendRs232Failure(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRs423Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRs423Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RS423_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * RS-485 failure
@@ -362,7 +460,10 @@ extern BOOL vscp_evt_diagnostic_sendRs423Failure(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRs485Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRs485Failure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RS485_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * CAN failure
@@ -376,7 +477,10 @@ extern BOOL vscp_evt_diagnostic_sendRs485Failure(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendCanFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendCanFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_CAN_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * LAN failure
@@ -390,7 +494,10 @@ extern BOOL vscp_evt_diagnostic_sendCanFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendLanFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendLanFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_LAN_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * USB failure
@@ -404,7 +511,10 @@ extern BOOL vscp_evt_diagnostic_sendLanFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendUsbFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendUsbFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_USB_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Wifi failure
@@ -418,7 +528,10 @@ extern BOOL vscp_evt_diagnostic_sendUsbFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendWifiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendWifiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_WIFI_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * NFC/RFID failure
@@ -432,7 +545,10 @@ extern BOOL vscp_evt_diagnostic_sendWifiFailure(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendNfcRfidFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendNfcRfidFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_NFC_RFID_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Low signal
@@ -446,7 +562,10 @@ extern BOOL vscp_evt_diagnostic_sendNfcRfidFailure(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendLowSignal(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendLowSignal(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_LOW_SIGNAL, index, zone, subZone, user, userSize);
+}
 
 /**
  * High signal
@@ -460,7 +579,10 @@ extern BOOL vscp_evt_diagnostic_sendLowSignal(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendHighSignal(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendHighSignal(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_HIGH_SIGNAL, index, zone, subZone, user, userSize);
+}
 
 /**
  * ADC failure
@@ -474,7 +596,10 @@ extern BOOL vscp_evt_diagnostic_sendHighSignal(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendAdcFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendAdcFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ADC_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * ALU failure
@@ -488,7 +613,10 @@ extern BOOL vscp_evt_diagnostic_sendAdcFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendAluFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendAluFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ALU_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Assert
@@ -502,7 +630,10 @@ extern BOOL vscp_evt_diagnostic_sendAluFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendAssert(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendAssert(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ASSERT, index, zone, subZone, user, userSize);
+}
 
 /**
  * DAC failure
@@ -516,7 +647,10 @@ extern BOOL vscp_evt_diagnostic_sendAssert(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendDacFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendDacFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_DAC_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * DMA failure
@@ -530,7 +664,10 @@ extern BOOL vscp_evt_diagnostic_sendDacFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendDmaFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendDmaFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_DMA_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Ethernet failure
@@ -544,7 +681,10 @@ extern BOOL vscp_evt_diagnostic_sendDmaFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendEthernetFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendEthernetFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ETH_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Exception
@@ -558,7 +698,10 @@ extern BOOL vscp_evt_diagnostic_sendEthernetFailure(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendException(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendException(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_EXCEPTION, index, zone, subZone, user, userSize);
+}
 
 /**
  * FPU failure
@@ -572,7 +715,10 @@ extern BOOL vscp_evt_diagnostic_sendException(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendFpuFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendFpuFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_FPU_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * GPIO failure
@@ -586,7 +732,10 @@ extern BOOL vscp_evt_diagnostic_sendFpuFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendGpioFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendGpioFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_GPIO_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * I2C failure
@@ -600,7 +749,10 @@ extern BOOL vscp_evt_diagnostic_sendGpioFailure(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendI2cFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendI2cFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_I2C_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * I2S failure
@@ -614,7 +766,10 @@ extern BOOL vscp_evt_diagnostic_sendI2cFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendI2sFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendI2sFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_I2S_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Invalid configuration
@@ -628,7 +783,10 @@ extern BOOL vscp_evt_diagnostic_sendI2sFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendInvalidConfiguration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendInvalidConfiguration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_INVALID_CONFIG, index, zone, subZone, user, userSize);
+}
 
 /**
  * MMU failure
@@ -642,7 +800,10 @@ extern BOOL vscp_evt_diagnostic_sendInvalidConfiguration(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendMmuFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendMmuFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_MMU_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * NMI failure
@@ -656,7 +817,10 @@ extern BOOL vscp_evt_diagnostic_sendMmuFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendNmiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendNmiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_NMI, index, zone, subZone, user, userSize);
+}
 
 /**
  * Overheat
@@ -670,7 +834,10 @@ extern BOOL vscp_evt_diagnostic_sendNmiFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendOverheat(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendOverheat(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_OVERHEAT, index, zone, subZone, user, userSize);
+}
 
 /**
  * PLL fail
@@ -684,7 +851,10 @@ extern BOOL vscp_evt_diagnostic_sendOverheat(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendPllFail(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendPllFail(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_PLL_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * POR failure
@@ -698,7 +868,10 @@ extern BOOL vscp_evt_diagnostic_sendPllFail(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendPorFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendPorFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_POR_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * PWM failure
@@ -712,7 +885,10 @@ extern BOOL vscp_evt_diagnostic_sendPorFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendPwmFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendPwmFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_PWM_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * RAM failure
@@ -726,7 +902,10 @@ extern BOOL vscp_evt_diagnostic_sendPwmFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRamFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRamFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RAM_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * ROM failure
@@ -740,7 +919,10 @@ extern BOOL vscp_evt_diagnostic_sendRamFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRomFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRomFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ROM_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * SPI failure
@@ -754,7 +936,10 @@ extern BOOL vscp_evt_diagnostic_sendRomFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendSpiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendSpiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SPI_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Stack failure
@@ -768,7 +953,10 @@ extern BOOL vscp_evt_diagnostic_sendSpiFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendStackFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendStackFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_STACK_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * LIN bus failure
@@ -782,7 +970,10 @@ extern BOOL vscp_evt_diagnostic_sendStackFailure(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendLinBusFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendLinBusFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_LIN_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * UART failure
@@ -796,7 +987,10 @@ extern BOOL vscp_evt_diagnostic_sendLinBusFailure(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendUartFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendUartFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_UART_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Unhandled interrupt
@@ -810,7 +1004,10 @@ extern BOOL vscp_evt_diagnostic_sendUartFailure(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendUnhandledInterrupt(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendUnhandledInterrupt(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_UNHANDLED_INT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Memory failure
@@ -824,7 +1021,10 @@ extern BOOL vscp_evt_diagnostic_sendUnhandledInterrupt(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendMemoryFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendMemoryFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_MEMORY_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Variable range failure
@@ -838,7 +1038,10 @@ extern BOOL vscp_evt_diagnostic_sendMemoryFailure(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendVariableRangeFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendVariableRangeFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_VARIABLE_RANGE, index, zone, subZone, user, userSize);
+}
 
 /**
  * WDT failure
@@ -852,7 +1055,10 @@ extern BOOL vscp_evt_diagnostic_sendVariableRangeFailure(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendWdtFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendWdtFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_WDT, index, zone, subZone, user, userSize);
+}
 
 /**
  * EEPROM failure
@@ -866,7 +1072,10 @@ extern BOOL vscp_evt_diagnostic_sendWdtFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendEepromFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendEepromFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_EEPROM_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Encryption failure
@@ -880,7 +1089,10 @@ extern BOOL vscp_evt_diagnostic_sendEepromFailure(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendEncryptionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendEncryptionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ENCRYPTION_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Bad user input failure
@@ -894,7 +1106,10 @@ extern BOOL vscp_evt_diagnostic_sendEncryptionFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendBadUserInputFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendBadUserInputFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_BAD_USER_INPUT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Decryption failure
@@ -908,7 +1123,10 @@ extern BOOL vscp_evt_diagnostic_sendBadUserInputFailure(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendDecryptionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendDecryptionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_DECRYPTION_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Noise
@@ -922,7 +1140,10 @@ extern BOOL vscp_evt_diagnostic_sendDecryptionFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendNoise(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendNoise(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_NOISE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Boot loader failure
@@ -936,7 +1157,10 @@ extern BOOL vscp_evt_diagnostic_sendNoise(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendBootLoaderFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendBootLoaderFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_BOOTLOADER_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Program flow failure
@@ -950,7 +1174,10 @@ extern BOOL vscp_evt_diagnostic_sendBootLoaderFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendProgramFlowFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendProgramFlowFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_PROGRAMFLOW_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * RTC faiure
@@ -964,7 +1191,10 @@ extern BOOL vscp_evt_diagnostic_sendProgramFlowFailure(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendRtcFaiure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendRtcFaiure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RTC_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * System test failure
@@ -978,7 +1208,10 @@ extern BOOL vscp_evt_diagnostic_sendRtcFaiure(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendSystemTestFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendSystemTestFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SYSTEM_TEST_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Sensor failure
@@ -992,7 +1225,10 @@ extern BOOL vscp_evt_diagnostic_sendSystemTestFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendSensorFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendSensorFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SENSOR_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Safe state entered
@@ -1006,7 +1242,10 @@ extern BOOL vscp_evt_diagnostic_sendSensorFailure(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendSafeStateEntered(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendSafeStateEntered(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SAFESTATE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Signal implausible
@@ -1020,7 +1259,10 @@ extern BOOL vscp_evt_diagnostic_sendSafeStateEntered(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendSignalImplausible(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendSignalImplausible(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SIGNAL_IMPLAUSIBLE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Storage fail
@@ -1034,7 +1276,10 @@ extern BOOL vscp_evt_diagnostic_sendSignalImplausible(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendStorageFail(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendStorageFail(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_STORAGE_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Self test OK
@@ -1048,7 +1293,10 @@ extern BOOL vscp_evt_diagnostic_sendStorageFail(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendSelfTestOk(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendSelfTestOk(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_SELFTEST_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * ESD/EMC/EMI failure
@@ -1062,7 +1310,10 @@ extern BOOL vscp_evt_diagnostic_sendSelfTestOk(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendEsdEmcEmiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendEsdEmcEmiFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_ESD_EMC_EMI, index, zone, subZone, user, userSize);
+}
 
 /**
  * Timeout
@@ -1076,7 +1327,10 @@ extern BOOL vscp_evt_diagnostic_sendEsdEmcEmiFailure(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendTimeout(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendTimeout(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_TIMEOUT, index, zone, subZone, user, userSize);
+}
 
 /**
  * LCD failure
@@ -1090,7 +1344,10 @@ extern BOOL vscp_evt_diagnostic_sendTimeout(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendLcdFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendLcdFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_LCD_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Touch panel failure
@@ -1104,7 +1361,10 @@ extern BOOL vscp_evt_diagnostic_sendLcdFailure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendTouchPanelFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendTouchPanelFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_TOUCHPANEL_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * No load
@@ -1118,7 +1378,10 @@ extern BOOL vscp_evt_diagnostic_sendTouchPanelFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendNoLoad(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendNoLoad(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_NOLOAD, index, zone, subZone, user, userSize);
+}
 
 /**
  * Cooling failure
@@ -1132,7 +1395,10 @@ extern BOOL vscp_evt_diagnostic_sendNoLoad(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendCoolingFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendCoolingFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_COOLING_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Heating failure
@@ -1146,7 +1412,10 @@ extern BOOL vscp_evt_diagnostic_sendCoolingFailure(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendHeatingFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendHeatingFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_HEATING_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Transmission failure
@@ -1160,7 +1429,10 @@ extern BOOL vscp_evt_diagnostic_sendHeatingFailure(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendTransmissionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendTransmissionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_TX_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Receiption failure
@@ -1174,7 +1446,10 @@ extern BOOL vscp_evt_diagnostic_sendTransmissionFailure(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendReceiptionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendReceiptionFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_RX_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * External IC failure
@@ -1188,7 +1463,10 @@ extern BOOL vscp_evt_diagnostic_sendReceiptionFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendExternalIcFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendExternalIcFailure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_EXT_IC_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Charging on
@@ -1202,7 +1480,10 @@ extern BOOL vscp_evt_diagnostic_sendExternalIcFailure(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendChargingOn(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendChargingOn(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_CHARGING_ON, index, zone, subZone, user, userSize);
+}
 
 /**
  * Charging off
@@ -1216,7 +1497,31 @@ extern BOOL vscp_evt_diagnostic_sendChargingOn(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_diagnostic_sendChargingOff(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_diagnostic_sendChargingOff(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_diagnostic_sendByType(VSCP_TYPE_DIAGNOSTIC_CHARGING_OFF, index, zone, subZone, user, userSize);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_diagnostic_parseCommon(vscp_RxMessage const * const msg, vscp_evt_diagnostic_Common * const evt);
+
+/**
+ * Parse a received event of the "Diagnostic" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_diagnostic_parse(vscp_RxMessage const * const msg, vscp_evt_diagnostic_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_display.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -463,3 +464,386 @@ extern BOOL vscp_evt_display_sendSetRgbColor(uint8_t index, uint8_t zone, uint8_
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Clear Display" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Clear Display" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseClearDisplay(vscp_RxMessage const * const msg, vscp_evt_display_ClearDisplay * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_CLEAR_DISPLAY != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->code = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Position cursor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Position cursor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parsePositionCursor(vscp_RxMessage const * const msg, vscp_evt_display_PositionCursor * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_POSITION_CURSOR != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->row = msg->data[3];
+
+    evt->column = msg->data[4];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Write Display" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Write Display" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseWriteDisplay(vscp_RxMessage const * const msg, vscp_evt_display_WriteDisplay * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_WRITE_DISPLAY != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Write Display buffer" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Write Display buffer" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_display_parseWriteDisplayBuffer(vscp_RxMessage const * const msg, vscp_evt_display_WriteDisplayBuffer * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_WRITE_DISPLAY_BUFFER != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Show Display Buffer" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Show Display Buffer" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseShowDisplayBuffer(vscp_RxMessage const * const msg, vscp_evt_display_ShowDisplayBuffer * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_SHOW_DISPLAY_BUFFER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set Display Buffer Parameter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set Display Buffer Parameter" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseSetDisplayBufferParameter(vscp_RxMessage const * const msg, vscp_evt_display_SetDisplayBufferParameter * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_SET_DISPLAY_BUFFER_PARAM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->coding = msg->data[1];
+
+    for(byteIndex = 0; (byteIndex < 6) && ((2 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[2 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Show Text" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Show Text" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseShowText(vscp_RxMessage const * const msg, vscp_evt_display_ShowText * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_SHOW_TEXT != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->event[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->eventSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set LED" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set LED" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseSetLed(vscp_RxMessage const * const msg, vscp_evt_display_SetLed * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_SET_LED != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->state = msg->data[3];
+
+    evt->blinkOnPeriod = VSCP_UTIL_READ_UINT16_BE(&msg->data[4]);
+
+    evt->blinkOffPeriod = VSCP_UTIL_READ_UINT16_BE(&msg->data[6]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set RGB Color" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set RGB Color" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseSetRgbColor(vscp_RxMessage const * const msg, vscp_evt_display_SetRgbColor * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_DISPLAY != msg->vscpClass) || (VSCP_TYPE_DISPLAY_SET_COLOR != msg->vscpType) || (6 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->red = msg->data[3];
+
+    evt->green = msg->data[4];
+
+    evt->blue = msg->data[5];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Display" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parse(vscp_RxMessage const * const msg, vscp_evt_display_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_DISPLAY != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_DISPLAY_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_DISPLAY_CLEAR_DISPLAY:
+        status = vscp_evt_display_parseClearDisplay(msg, &evt->data.clearDisplay);
+        break;
+
+    case VSCP_TYPE_DISPLAY_POSITION_CURSOR:
+        status = vscp_evt_display_parsePositionCursor(msg, &evt->data.positionCursor);
+        break;
+
+    case VSCP_TYPE_DISPLAY_WRITE_DISPLAY:
+        status = vscp_evt_display_parseWriteDisplay(msg, &evt->data.writeDisplay);
+        break;
+
+    case VSCP_TYPE_DISPLAY_WRITE_DISPLAY_BUFFER:
+        status = vscp_evt_display_parseWriteDisplayBuffer(msg, &evt->data.writeDisplayBuffer);
+        break;
+
+    case VSCP_TYPE_DISPLAY_SHOW_DISPLAY_BUFFER:
+        status = vscp_evt_display_parseShowDisplayBuffer(msg, &evt->data.showDisplayBuffer);
+        break;
+
+    case VSCP_TYPE_DISPLAY_SET_DISPLAY_BUFFER_PARAM:
+        status = vscp_evt_display_parseSetDisplayBufferParameter(msg, &evt->data.setDisplayBufferParameter);
+        break;
+
+    case VSCP_TYPE_DISPLAY_SHOW_TEXT:
+        status = vscp_evt_display_parseShowText(msg, &evt->data.showText);
+        break;
+
+    case VSCP_TYPE_DISPLAY_SET_LED:
+        status = vscp_evt_display_parseSetLed(msg, &evt->data.setLed);
+        break;
+
+    case VSCP_TYPE_DISPLAY_SET_COLOR:
+        status = vscp_evt_display_parseSetRgbColor(msg, &evt->data.setRgbColor);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
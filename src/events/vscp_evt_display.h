@@ -47,6 +47,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,123 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Clear Display" event. */
+typedef struct
+{
+    uint8_t code; /**< Code */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_display_ClearDisplay;
+
+/** Parameters of the "Position cursor" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t row; /**< Row */
+    uint8_t column; /**< Column */
+
+} vscp_evt_display_PositionCursor;
+
+/** Parameters of the "Write Display" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t data[5]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_display_WriteDisplay;
+
+/** Parameters of the "Write Display buffer" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t data[5]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_display_WriteDisplayBuffer;
+
+/** Parameters of the "Show Display Buffer" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_display_ShowDisplayBuffer;
+
+/** Parameters of the "Set Display Buffer Parameter" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t coding; /**< Coding */
+    uint8_t data[6]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_display_SetDisplayBufferParameter;
+
+/** Parameters of the "Show Text" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t event[5]; /**< Event */
+    uint8_t eventSize; /**< Event size */
+
+} vscp_evt_display_ShowText;
+
+/** Parameters of the "Set LED" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t state; /**< State */
+    uint16_t blinkOnPeriod; /**< Blink On period */
+    uint16_t blinkOffPeriod; /**< Blink Off period */
+
+} vscp_evt_display_SetLed;
+
+/** Parameters of the "Set RGB Color" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t red; /**< Red */
+    uint8_t green; /**< Green */
+    uint8_t blue; /**< Blue */
+
+} vscp_evt_display_SetRgbColor;
+
+/** Parsed event of the "Display" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_display_ClearDisplay clearDisplay; /**< Parameters of the "Clear Display" event */
+        vscp_evt_display_PositionCursor positionCursor; /**< Parameters of the "Position cursor" event */
+        vscp_evt_display_WriteDisplay writeDisplay; /**< Parameters of the "Write Display" event */
+        vscp_evt_display_WriteDisplayBuffer writeDisplayBuffer; /**< Parameters of the "Write Display buffer" event */
+        vscp_evt_display_ShowDisplayBuffer showDisplayBuffer; /**< Parameters of the "Show Display Buffer" event */
+        vscp_evt_display_SetDisplayBufferParameter setDisplayBufferParameter; /**< Parameters of the "Set Display Buffer Parameter" event */
+        vscp_evt_display_ShowText showText; /**< Parameters of the "Show Text" event */
+        vscp_evt_display_SetLed setLed; /**< Parameters of the "Set LED" event */
+        vscp_evt_display_SetRgbColor setRgbColor; /**< Parameters of the "Set RGB Color" event */
+    } data;
+
+} vscp_evt_display_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -198,6 +316,109 @@ extern BOOL vscp_evt_display_sendSetLed(uint8_t index, uint8_t zone, uint8_t sub
  */
 extern BOOL vscp_evt_display_sendSetRgbColor(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t red, uint8_t green, uint8_t blue);
 
+/**
+ * Parse the "Clear Display" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Clear Display" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseClearDisplay(vscp_RxMessage const * const msg, vscp_evt_display_ClearDisplay * const evt);
+
+/**
+ * Parse the "Position cursor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Position cursor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parsePositionCursor(vscp_RxMessage const * const msg, vscp_evt_display_PositionCursor * const evt);
+
+/**
+ * Parse the "Write Display" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Write Display" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseWriteDisplay(vscp_RxMessage const * const msg, vscp_evt_display_WriteDisplay * const evt);
+
+/**
+ * Parse the "Write Display buffer" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Write Display buffer" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_display_parseWriteDisplayBuffer(vscp_RxMessage const * const msg, vscp_evt_display_WriteDisplayBuffer * const evt);
+
+/**
+ * Parse the "Show Display Buffer" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Show Display Buffer" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseShowDisplayBuffer(vscp_RxMessage const * const msg, vscp_evt_display_ShowDisplayBuffer * const evt);
+
+/**
+ * Parse the "Set Display Buffer Parameter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set Display Buffer Parameter" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseSetDisplayBufferParameter(vscp_RxMessage const * const msg, vscp_evt_display_SetDisplayBufferParameter * const evt);
+
+/**
+ * Parse the "Show Text" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Show Text" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseShowText(vscp_RxMessage const * const msg, vscp_evt_display_ShowText * const evt);
+
+/**
+ * Parse the "Set LED" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set LED" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseSetLed(vscp_RxMessage const * const msg, vscp_evt_display_SetLed * const evt);
+
+/**
+ * Parse the "Set RGB Color" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set RGB Color" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parseSetRgbColor(vscp_RxMessage const * const msg, vscp_evt_display_SetRgbColor * const evt);
+
+/**
+ * Parse a received event of the "Display" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_display_parse(vscp_RxMessage const * const msg, vscp_evt_display_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
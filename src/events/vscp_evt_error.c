@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_error.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,8 +73,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * Success
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index. Often used as an index for channels/subdevices within a module.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
@@ -83,13 +85,13 @@ This file is automatically generated. Don't change it manually.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendSuccess(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+extern BOOL vscp_evt_error_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
     uint8_t         byteIndex   = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_SUCCESS, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = index;
     size += 1;
@@ -120,1778 +122,114 @@ extern BOOL vscp_evt_error_sendSuccess(uint8_t index, uint8_t zone, uint8_t subZ
 }
 
 /**
- * Error
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
  * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_ERROR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Channel error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendChannelError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_CHANNEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Fifo empty error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendFifoEmptyError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_FIFO_EMPTY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Fifo full error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendFifoFullError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_FIFO_FULL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Fifo size error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendFifoSizeError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_FIFO_SIZE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Fifo wait error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendFifoWaitError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_FIFO_WAIT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Generic error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendGenericError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_GENERIC, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Hardware error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendHardwareError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_HARDWARE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * initialization error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendInitializationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_INIT_FAIL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Missing initialization error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendMissingInitializationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_INIT_MISSING, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Initialization ready
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendInitializationReady(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_INIT_READY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Not supported
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendNotSupported(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_NOT_SUPPORTED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Overrun error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendOverrunError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_OVERRUN, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Receiver empty error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendReceiverEmptyError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_RCV_EMPTY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Register error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendRegisterError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_REGISTER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Transmitter full error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendTransmitterFullError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_TRM_FULL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Library error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendLibraryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_LIBRARY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Procedural address error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendProceduralAddressError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_PROCADDRESS, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Only one instance error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendOnlyOneInstanceError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_ONLY_ONE_INSTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sub driver error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendSubDriverError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_SUB_DRIVER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Timeout error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendTimeoutError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_TIMEOUT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Not open error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendNotOpenError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_NOT_OPEN, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Parameter error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendParameterError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_PARAMETER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Memory error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendMemoryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_MEMORY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Internal error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendInternalError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_INTERNAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Communication error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendCommunicationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_COMMUNICATION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * User error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendUserError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_USER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Password error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendPasswordError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_PASSWORD, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Connection error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendConnectionError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_CONNECTION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Invalid handle error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendInvalidHandleError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_INVALID_HANDLE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Operation failed error
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendOperationFailedError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_OPERATION_FAILED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
-    {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Supplied buffer is to small to fit content
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendSuppliedBufferIsToSmallToFitContent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+extern BOOL vscp_evt_error_parseCommon(vscp_RxMessage const * const msg, vscp_evt_error_Common * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_BUFFER_SMALL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
+    uint8_t byteIndex   = 0;
 
-    if (NULL != user)
+    if ((NULL == msg) || (NULL == evt))
     {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
+        return FALSE;
     }
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Requested item is unknown
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendRequestedItemIsUnknown(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_ITEM_UNKNOWN, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
+    if ((VSCP_CLASS_L1_ERROR != msg->vscpClass) || (3 > msg->dataSize))
     {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
+        return FALSE;
     }
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Name is already in use
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendNameIsAlreadyInUse(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_NAME_USED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
+    evt->index = msg->data[0];
 
-    txMsg.data[1] = zone;
-    size += 1;
+    evt->zone = msg->data[1];
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->subZone = msg->data[2];
 
-    if (NULL != user)
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
     {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
+        evt->user[byteIndex] = msg->data[3 + byteIndex];
     }
+    evt->userSize = byteIndex;
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
+    return TRUE;
 }
 
 /**
- * Error when writing data
+ * Parse a received event of the "Error" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
  * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendErrorWhenWritingData(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+extern BOOL vscp_evt_error_parse(vscp_RxMessage const * const msg, vscp_evt_error_Event * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_DATA_WRITE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
+    BOOL    status  = FALSE;
 
-    if (NULL != user)
+    if ((NULL == msg) || (NULL == evt))
     {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
+        return FALSE;
     }
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Operation stopped or aborted
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendOperationStoppedOrAborted(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_ABORTED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    if (NULL != user)
+    if (VSCP_CLASS_L1_ERROR != msg->vscpClass)
     {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
-
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
+        return FALSE;
     }
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pointer with invalid value
- * 
- * @param[in] index Index. Often used as an index for channels/subdevices within a module.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] user Can be present or not be present. If present the bytes give additional user
- * specific information. (optional) (array[5])
- * @param[in] usersize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_error_sendPointerWithInvalidValue(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_ERROR, VSCP_TYPE_ERROR_INVALID_POINTER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->vscpType = msg->vscpType;
 
-    if (NULL != user)
+    switch(msg->vscpType)
     {
-        for(byteIndex = 0; byteIndex < userSize; ++byteIndex)
-        {
-            txMsg.data[3 + byteIndex] = user[byteIndex];
-            size += 1;
+    case VSCP_TYPE_ERROR_SUCCESS:
+    case VSCP_TYPE_ERROR_ERROR:
+    case VSCP_TYPE_ERROR_CHANNEL:
+    case VSCP_TYPE_ERROR_FIFO_EMPTY:
+    case VSCP_TYPE_ERROR_FIFO_FULL:
+    case VSCP_TYPE_ERROR_FIFO_SIZE:
+    case VSCP_TYPE_ERROR_FIFO_WAIT:
+    case VSCP_TYPE_ERROR_GENERIC:
+    case VSCP_TYPE_ERROR_HARDWARE:
+    case VSCP_TYPE_ERROR_INIT_FAIL:
+    case VSCP_TYPE_ERROR_INIT_MISSING:
+    case VSCP_TYPE_ERROR_INIT_READY:
+    case VSCP_TYPE_ERROR_NOT_SUPPORTED:
+    case VSCP_TYPE_ERROR_OVERRUN:
+    case VSCP_TYPE_ERROR_RCV_EMPTY:
+    case VSCP_TYPE_ERROR_REGISTER:
+    case VSCP_TYPE_ERROR_TRM_FULL:
+    case VSCP_TYPE_ERROR_LIBRARY:
+    case VSCP_TYPE_ERROR_PROCADDRESS:
+    case VSCP_TYPE_ERROR_ONLY_ONE_INSTANCE:
+    case VSCP_TYPE_ERROR_SUB_DRIVER:
+    case VSCP_TYPE_ERROR_TIMEOUT:
+    case VSCP_TYPE_ERROR_NOT_OPEN:
+    case VSCP_TYPE_ERROR_PARAMETER:
+    case VSCP_TYPE_ERROR_MEMORY:
+    case VSCP_TYPE_ERROR_INTERNAL:
+    case VSCP_TYPE_ERROR_COMMUNICATION:
+    case VSCP_TYPE_ERROR_USER:
+    case VSCP_TYPE_ERROR_PASSWORD:
+    case VSCP_TYPE_ERROR_CONNECTION:
+    case VSCP_TYPE_ERROR_INVALID_HANDLE:
+    case VSCP_TYPE_ERROR_OPERATION_FAILED:
+    case VSCP_TYPE_ERROR_BUFFER_SMALL:
+    case VSCP_TYPE_ERROR_ITEM_UNKNOWN:
+    case VSCP_TYPE_ERROR_NAME_USED:
+    case VSCP_TYPE_ERROR_DATA_WRITE:
+    case VSCP_TYPE_ERROR_ABORTED:
+    case VSCP_TYPE_ERROR_INVALID_POINTER:
+        status = vscp_evt_error_parseCommon(msg, &evt->data.common);
+        break;
 
-            if (VSCP_L1_DATA_SIZE <= size)
-            {
-                break;
-            }
-        }
+    default:
+        break;
     }
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
+    return status;
 }
 
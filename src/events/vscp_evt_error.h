@@ -47,6 +47,8 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_type_error.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +71,30 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t user[5]; /**< User */
+    uint8_t userSize; /**< User size */
+
+} vscp_evt_error_Common;
+
+/** Parsed event of the "Error" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_error_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_error_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -77,6 +103,21 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index. Often used as an index for channels/subdevices within a module.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] user Can be present or not be present. If present the bytes give additional user
+ * specific information. (optional) (array[5])
+ * @param[in] usersize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_error_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+
 /**
  * Success
  * 
@@ -89,7 +130,10 @@ extern "C"
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendSuccess(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendSuccess(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_SUCCESS, index, zone, subZone, user, userSize);
+}
 
 /**
  * Error
@@ -103,7 +147,10 @@ extern BOOL vscp_evt_error_sendSuccess(uint8_t index, uint8_t zone, uint8_t subZ
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_ERROR, index, zone, subZone, user, userSize);
+}
 
 /**
  * Channel error
@@ -117,7 +164,10 @@ extern BOOL vscp_evt_error_sendError(uint8_t index, uint8_t zone, uint8_t subZon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendChannelError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendChannelError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_CHANNEL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Fifo empty error
@@ -131,7 +181,10 @@ extern BOOL vscp_evt_error_sendChannelError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendFifoEmptyError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendFifoEmptyError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_FIFO_EMPTY, index, zone, subZone, user, userSize);
+}
 
 /**
  * Fifo full error
@@ -145,7 +198,10 @@ extern BOOL vscp_evt_error_sendFifoEmptyError(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendFifoFullError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendFifoFullError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_FIFO_FULL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Fifo size error
@@ -159,7 +215,10 @@ extern BOOL vscp_evt_error_sendFifoFullError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendFifoSizeError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendFifoSizeError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_FIFO_SIZE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Fifo wait error
@@ -173,7 +232,10 @@ extern BOOL vscp_evt_error_sendFifoSizeError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendFifoWaitError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendFifoWaitError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_FIFO_WAIT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Generic error
@@ -187,7 +249,10 @@ extern BOOL vscp_evt_error_sendFifoWaitError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendGenericError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendGenericError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_GENERIC, index, zone, subZone, user, userSize);
+}
 
 /**
  * Hardware error
@@ -201,7 +266,10 @@ extern BOOL vscp_evt_error_sendGenericError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendHardwareError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendHardwareError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_HARDWARE, index, zone, subZone, user, userSize);
+}
 
 /**
  * initialization error
@@ -215,7 +283,10 @@ extern BOOL vscp_evt_error_sendHardwareError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendInitializationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendInitializationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_INIT_FAIL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Missing initialization error
@@ -229,7 +300,10 @@ extern BOOL vscp_evt_error_sendInitializationError(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendMissingInitializationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendMissingInitializationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_INIT_MISSING, index, zone, subZone, user, userSize);
+}
 
 /**
  * Initialization ready
@@ -243,7 +317,10 @@ extern BOOL vscp_evt_error_sendMissingInitializationError(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendInitializationReady(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendInitializationReady(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_INIT_READY, index, zone, subZone, user, userSize);
+}
 
 /**
  * Not supported
@@ -257,7 +334,10 @@ extern BOOL vscp_evt_error_sendInitializationReady(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendNotSupported(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendNotSupported(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_NOT_SUPPORTED, index, zone, subZone, user, userSize);
+}
 
 /**
  * Overrun error
@@ -271,7 +351,10 @@ extern BOOL vscp_evt_error_sendNotSupported(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendOverrunError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendOverrunError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_OVERRUN, index, zone, subZone, user, userSize);
+}
 
 /**
  * Receiver empty error
@@ -285,7 +368,10 @@ extern BOOL vscp_evt_error_sendOverrunError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendReceiverEmptyError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendReceiverEmptyError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_RCV_EMPTY, index, zone, subZone, user, userSize);
+}
 
 /**
  * Register error
@@ -299,7 +385,10 @@ extern BOOL vscp_evt_error_sendReceiverEmptyError(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendRegisterError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendRegisterError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_REGISTER, index, zone, subZone, user, userSize);
+}
 
 /**
  * Transmitter full error
@@ -313,7 +402,10 @@ extern BOOL vscp_evt_error_sendRegisterError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendTransmitterFullError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendTransmitterFullError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_TRM_FULL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Library error
@@ -327,7 +419,10 @@ extern BOOL vscp_evt_error_sendTransmitterFullError(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendLibraryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendLibraryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_LIBRARY, index, zone, subZone, user, userSize);
+}
 
 /**
  * Procedural address error
@@ -341,7 +436,10 @@ extern BOOL vscp_evt_error_sendLibraryError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendProceduralAddressError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendProceduralAddressError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_PROCADDRESS, index, zone, subZone, user, userSize);
+}
 
 /**
  * Only one instance error
@@ -355,7 +453,10 @@ extern BOOL vscp_evt_error_sendProceduralAddressError(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendOnlyOneInstanceError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendOnlyOneInstanceError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_ONLY_ONE_INSTANCE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Sub driver error
@@ -369,7 +470,10 @@ extern BOOL vscp_evt_error_sendOnlyOneInstanceError(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendSubDriverError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendSubDriverError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_SUB_DRIVER, index, zone, subZone, user, userSize);
+}
 
 /**
  * Timeout error
@@ -383,7 +487,10 @@ extern BOOL vscp_evt_error_sendSubDriverError(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendTimeoutError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendTimeoutError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_TIMEOUT, index, zone, subZone, user, userSize);
+}
 
 /**
  * Not open error
@@ -397,7 +504,10 @@ extern BOOL vscp_evt_error_sendTimeoutError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendNotOpenError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendNotOpenError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_NOT_OPEN, index, zone, subZone, user, userSize);
+}
 
 /**
  * Parameter error
@@ -411,7 +521,10 @@ extern BOOL vscp_evt_error_sendNotOpenError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendParameterError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendParameterError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_PARAMETER, index, zone, subZone, user, userSize);
+}
 
 /**
  * Memory error
@@ -425,7 +538,10 @@ extern BOOL vscp_evt_error_sendParameterError(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendMemoryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendMemoryError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_MEMORY, index, zone, subZone, user, userSize);
+}
 
 /**
  * Internal error
@@ -439,7 +555,10 @@ extern BOOL vscp_evt_error_sendMemoryError(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendInternalError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendInternalError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_INTERNAL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Communication error
@@ -453,7 +572,10 @@ extern BOOL vscp_evt_error_sendInternalError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendCommunicationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendCommunicationError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_COMMUNICATION, index, zone, subZone, user, userSize);
+}
 
 /**
  * User error
@@ -467,7 +589,10 @@ extern BOOL vscp_evt_error_sendCommunicationError(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendUserError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendUserError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_USER, index, zone, subZone, user, userSize);
+}
 
 /**
  * Password error
@@ -481,7 +606,10 @@ extern BOOL vscp_evt_error_sendUserError(uint8_t index, uint8_t zone, uint8_t su
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendPasswordError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendPasswordError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_PASSWORD, index, zone, subZone, user, userSize);
+}
 
 /**
  * Connection error
@@ -495,7 +623,10 @@ extern BOOL vscp_evt_error_sendPasswordError(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendConnectionError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendConnectionError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_CONNECTION, index, zone, subZone, user, userSize);
+}
 
 /**
  * Invalid handle error
@@ -509,7 +640,10 @@ extern BOOL vscp_evt_error_sendConnectionError(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendInvalidHandleError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendInvalidHandleError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_INVALID_HANDLE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Operation failed error
@@ -523,7 +657,10 @@ extern BOOL vscp_evt_error_sendInvalidHandleError(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendOperationFailedError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendOperationFailedError(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_OPERATION_FAILED, index, zone, subZone, user, userSize);
+}
 
 /**
  * Supplied buffer is to small to fit content
@@ -537,7 +674,10 @@ extern BOOL vscp_evt_error_sendOperationFailedError(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendSuppliedBufferIsToSmallToFitContent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendSuppliedBufferIsToSmallToFitContent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_BUFFER_SMALL, index, zone, subZone, user, userSize);
+}
 
 /**
  * Requested item is unknown
@@ -551,7 +691,10 @@ extern BOOL vscp_evt_error_sendSuppliedBufferIsToSmallToFitContent(uint8_t index
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendRequestedItemIsUnknown(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendRequestedItemIsUnknown(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_ITEM_UNKNOWN, index, zone, subZone, user, userSize);
+}
 
 /**
  * Name is already in use
@@ -565,7 +708,10 @@ extern BOOL vscp_evt_error_sendRequestedItemIsUnknown(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendNameIsAlreadyInUse(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendNameIsAlreadyInUse(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_NAME_USED, index, zone, subZone, user, userSize);
+}
 
 /**
  * Error when writing data
@@ -579,7 +725,10 @@ extern BOOL vscp_evt_error_sendNameIsAlreadyInUse(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendErrorWhenWritingData(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendErrorWhenWritingData(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_DATA_WRITE, index, zone, subZone, user, userSize);
+}
 
 /**
  * Operation stopped or aborted
@@ -593,7 +742,10 @@ extern BOOL vscp_evt_error_sendErrorWhenWritingData(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendOperationStoppedOrAborted(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendOperationStoppedOrAborted(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_ABORTED, index, zone, subZone, user, userSize);
+}
 
 /**
  * Pointer with invalid value
@@ -607,7 +759,31 @@ extern BOOL vscp_evt_error_sendOperationStoppedOrAborted(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_error_sendPointerWithInvalidValue(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize);
+static inline BOOL vscp_evt_error_sendPointerWithInvalidValue(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const user, uint8_t userSize)
+{
+    return vscp_evt_error_sendByType(VSCP_TYPE_ERROR_INVALID_POINTER, index, zone, subZone, user, userSize);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_error_parseCommon(vscp_RxMessage const * const msg, vscp_evt_error_Common * const evt);
+
+/**
+ * Parse a received event of the "Error" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_error_parse(vscp_RxMessage const * const msg, vscp_evt_error_Event * const evt);
 
 #ifdef __cplusplus
 }
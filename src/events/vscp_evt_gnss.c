@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_gnss.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -141,3 +142,107 @@ extern BOOL vscp_evt_gnss_sendSatellites(uint8_t count)
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Position" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Position" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_gnss_parsePosition(vscp_RxMessage const * const msg, vscp_evt_gnss_Position * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_GNSS != msg->vscpClass) || (VSCP_TYPE_GNSS_POSITION != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    ((uint8_t*)&evt->latitude)[3] = msg->data[0];
+    ((uint8_t*)&evt->latitude)[2] = msg->data[1];
+    ((uint8_t*)&evt->latitude)[1] = msg->data[2];
+    ((uint8_t*)&evt->latitude)[0] = msg->data[3];
+
+    ((uint8_t*)&evt->longitude)[3] = msg->data[4];
+    ((uint8_t*)&evt->longitude)[2] = msg->data[5];
+    ((uint8_t*)&evt->longitude)[1] = msg->data[6];
+    ((uint8_t*)&evt->longitude)[0] = msg->data[7];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Satellites" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Satellites" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_gnss_parseSatellites(vscp_RxMessage const * const msg, vscp_evt_gnss_Satellites * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_GNSS != msg->vscpClass) || (VSCP_TYPE_GNSS_SATELLITES != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->count = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Position (GNSS)" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_gnss_parse(vscp_RxMessage const * const msg, vscp_evt_gnss_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_GNSS != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_GNSS_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_GNSS_POSITION:
+        status = vscp_evt_gnss_parsePosition(msg, &evt->data.position);
+        break;
+
+    case VSCP_TYPE_GNSS_SATELLITES:
+        status = vscp_evt_gnss_parseSatellites(msg, &evt->data.satellites);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -48,6 +48,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 #include <math.h>
 
 #ifdef __cplusplus
@@ -71,6 +72,35 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Position" event. */
+typedef struct
+{
+    float_t latitude; /**< Latitude */
+    float_t longitude; /**< Longitude */
+
+} vscp_evt_gnss_Position;
+
+/** Parameters of the "Satellites" event. */
+typedef struct
+{
+    uint8_t count; /**< Count */
+
+} vscp_evt_gnss_Satellites;
+
+/** Parsed event of the "Position (GNSS)" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_gnss_Position position; /**< Parameters of the "Position" event */
+        vscp_evt_gnss_Satellites satellites; /**< Parameters of the "Satellites" event */
+    } data;
+
+} vscp_evt_gnss_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -105,6 +135,37 @@ extern BOOL vscp_evt_gnss_sendPosition(float_t latitude, float_t longitude);
  */
 extern BOOL vscp_evt_gnss_sendSatellites(uint8_t count);
 
+/**
+ * Parse the "Position" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Position" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_gnss_parsePosition(vscp_RxMessage const * const msg, vscp_evt_gnss_Position * const evt);
+
+/**
+ * Parse the "Satellites" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Satellites" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_gnss_parseSatellites(vscp_RxMessage const * const msg, vscp_evt_gnss_Satellites * const evt);
+
+/**
+ * Parse a received event of the "Position (GNSS)" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_gnss_parse(vscp_RxMessage const * const msg, vscp_evt_gnss_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
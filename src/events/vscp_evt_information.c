@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_information.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -2975,3 +2976,3070 @@ extern BOOL vscp_evt_information_sendProximityDetected(uint8_t userSpecific, uin
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Button" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Button" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseButton(vscp_RxMessage const * const msg, vscp_evt_information_Button * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_BUTTON != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->buttonState = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->buttonCode = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->codePageAvailable = FALSE;
+    if (7 <= msg->dataSize)
+    {
+        evt->codePageAvailable = TRUE;
+        evt->codePage = VSCP_UTIL_READ_UINT16_BE(&msg->data[5]);
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Mouse" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Mouse" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseMouse(vscp_RxMessage const * const msg, vscp_evt_information_Mouse * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_MOUSE != msg->vscpType) || (7 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->kindOfCoordinates = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->normalizedXCoordinate = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->normalizedYCoordinate = VSCP_UTIL_READ_UINT16_BE(&msg->data[5]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "On" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "On" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOn(vscp_RxMessage const * const msg, vscp_evt_information_On * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOff(vscp_RxMessage const * const msg, vscp_evt_information_Off * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_OFF != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Alive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alive" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseAlive(vscp_RxMessage const * const msg, vscp_evt_information_Alive * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ALIVE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Terminating" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Terminating" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseTerminating(vscp_RxMessage const * const msg, vscp_evt_information_Terminating * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_TERMINATING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Opened" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Opened" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOpened(vscp_RxMessage const * const msg, vscp_evt_information_Opened * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_OPENED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Closed" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Closed" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseClosed(vscp_RxMessage const * const msg, vscp_evt_information_Closed * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_CLOSED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Node Heartbeat" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Node Heartbeat" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseNodeHeartbeat(vscp_RxMessage const * const msg, vscp_evt_information_NodeHeartbeat * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_NODE_HEARTBEAT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->userData[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->userDataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Below limit" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Below limit" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseBelowLimit(vscp_RxMessage const * const msg, vscp_evt_information_BelowLimit * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_BELOW_LIMIT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Above limit" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Above limit" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseAboveLimit(vscp_RxMessage const * const msg, vscp_evt_information_AboveLimit * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ABOVE_LIMIT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Pulse" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pulse" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parsePulse(vscp_RxMessage const * const msg, vscp_evt_information_Pulse * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_PULSE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Error" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Error" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseError(vscp_RxMessage const * const msg, vscp_evt_information_Error * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ERROR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Resumed" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Resumed" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseResumed(vscp_RxMessage const * const msg, vscp_evt_information_Resumed * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_RESUMED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Paused" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Paused" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parsePaused(vscp_RxMessage const * const msg, vscp_evt_information_Paused * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_PAUSED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Sleeping" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sleeping" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseSleeping(vscp_RxMessage const * const msg, vscp_evt_information_Sleeping * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SLEEP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Good morning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Good morning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseGoodMorning(vscp_RxMessage const * const msg, vscp_evt_information_GoodMorning * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_GOOD_MORNING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Good day" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Good day" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseGoodDay(vscp_RxMessage const * const msg, vscp_evt_information_GoodDay * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_GOOD_DAY != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Good afternoon" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Good afternoon" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseGoodAfternoon(vscp_RxMessage const * const msg, vscp_evt_information_GoodAfternoon * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_GOOD_AFTERNOON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Good evening" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Good evening" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseGoodEvening(vscp_RxMessage const * const msg, vscp_evt_information_GoodEvening * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_GOOD_EVENING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Good night" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Good night" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseGoodNight(vscp_RxMessage const * const msg, vscp_evt_information_GoodNight * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_GOOD_NIGHT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "See you soon" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "See you soon" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseSeeYouSoon(vscp_RxMessage const * const msg, vscp_evt_information_SeeYouSoon * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SEE_YOU_SOON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Goodbye" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Goodbye" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseGoodbye(vscp_RxMessage const * const msg, vscp_evt_information_Goodbye * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_GOODBYE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseStop(vscp_RxMessage const * const msg, vscp_evt_information_Stop * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_STOP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Start" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Start" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseStart(vscp_RxMessage const * const msg, vscp_evt_information_Start * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "ResetCompleted" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ResetCompleted" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseResetcompleted(vscp_RxMessage const * const msg, vscp_evt_information_Resetcompleted * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_RESET_COMPLETED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Interrupted" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Interrupted" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseInterrupted(vscp_RxMessage const * const msg, vscp_evt_information_Interrupted * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_INTERRUPTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "PreparingToSleep" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "PreparingToSleep" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parsePreparingtosleep(vscp_RxMessage const * const msg, vscp_evt_information_Preparingtosleep * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_PREPARING_TO_SLEEP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "WokenUp" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "WokenUp" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseWokenup(vscp_RxMessage const * const msg, vscp_evt_information_Wokenup * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_WOKEN_UP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Dusk" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Dusk" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDusk(vscp_RxMessage const * const msg, vscp_evt_information_Dusk * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DUSK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Dawn" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Dawn" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDawn(vscp_RxMessage const * const msg, vscp_evt_information_Dawn * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DAWN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Active" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Active" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseActive(vscp_RxMessage const * const msg, vscp_evt_information_Active * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ACTIVE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Inactive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Inactive" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseInactive(vscp_RxMessage const * const msg, vscp_evt_information_Inactive * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_INACTIVE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Busy" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Busy" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseBusy(vscp_RxMessage const * const msg, vscp_evt_information_Busy * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_BUSY != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Idle" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Idle" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseIdle(vscp_RxMessage const * const msg, vscp_evt_information_Idle * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_IDLE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Stream Data" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stream Data" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseStreamData(vscp_RxMessage const * const msg, vscp_evt_information_StreamData * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_STREAM_DATA != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->sequenceNumber = msg->data[0];
+
+    for(byteIndex = 0; (byteIndex < 7) && ((1 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->streamData[byteIndex] = msg->data[1 + byteIndex];
+    }
+    evt->streamDataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Token Activity" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Token Activity" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseTokenActivity(vscp_RxMessage const * const msg, vscp_evt_information_TokenActivity * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_TOKEN_ACTIVITY != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->tokenType = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->frameIndex = msg->data[3];
+
+    for(byteIndex = 0; (byteIndex < 4) && ((4 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->tokenData[byteIndex] = msg->data[4 + byteIndex];
+    }
+    evt->tokenDataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Stream Data with zone" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Stream Data with zone" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_information_parseStreamDataWithZone(vscp_RxMessage const * const msg, vscp_evt_information_StreamDataWithZone * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_STREAM_DATA_WITH_ZONE != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->zone = msg->data[0];
+
+    evt->subZone = msg->data[1];
+
+    evt->sequenceNumber = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 4) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->streamData[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->streamDataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Confirm" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Confirm" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseConfirm(vscp_RxMessage const * const msg, vscp_evt_information_Confirm * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_CONFIRM != msg->vscpType) || (7 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->zone = msg->data[0];
+
+    evt->subZone = msg->data[1];
+
+    evt->sequenceNumber = msg->data[2];
+
+    evt->vscpClass = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    evt->vscpType = VSCP_UTIL_READ_UINT16_BE(&msg->data[5]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Level Changed" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Level Changed" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseLevelChanged(vscp_RxMessage const * const msg, vscp_evt_information_LevelChanged * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_LEVEL_CHANGED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->level = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseWarning(vscp_RxMessage const * const msg, vscp_evt_information_Warning * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_WARNING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->level = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "State" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "State" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseState(vscp_RxMessage const * const msg, vscp_evt_information_State * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_STATE != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->from = msg->data[3];
+
+    evt->to = msg->data[4];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Action Trigger" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Action Trigger" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseActionTrigger(vscp_RxMessage const * const msg, vscp_evt_information_ActionTrigger * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ACTION_TRIGGER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->actionId = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Sunrise" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sunrise" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseSunrise(vscp_RxMessage const * const msg, vscp_evt_information_Sunrise * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SUNRISE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Sunset" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sunset" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseSunset(vscp_RxMessage const * const msg, vscp_evt_information_Sunset * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SUNSET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Start of record" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Start of record" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseStartOfRecord(vscp_RxMessage const * const msg, vscp_evt_information_StartOfRecord * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_START_OF_RECORD != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->remainingFrames = msg->data[3];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "End of record" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "End of record" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseEndOfRecord(vscp_RxMessage const * const msg, vscp_evt_information_EndOfRecord * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_END_OF_RECORD != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Pre-set active" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pre-set active" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parsePreSetActive(vscp_RxMessage const * const msg, vscp_evt_information_PreSetActive * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_PRESET_ACTIVE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->user = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->preSetCode = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Detect" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Detect" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDetect(vscp_RxMessage const * const msg, vscp_evt_information_Detect * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DETECT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Overflow" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Overflow" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOverflow(vscp_RxMessage const * const msg, vscp_evt_information_Overflow * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_OVERFLOW != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Big level changed" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Big level changed" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseBigLevelChanged(vscp_RxMessage const * const msg, vscp_evt_information_BigLevelChanged * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_BIG_LEVEL_CHANGED != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->level[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->levelSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Civil sunrise twilight time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Civil sunrise twilight time" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseCivilSunriseTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_CivilSunriseTwilightTime * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SUNRISE_TWILIGHT_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Civil sunset twilight time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Civil sunset twilight time" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_information_parseCivilSunsetTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_CivilSunsetTwilightTime * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SUNSET_TWILIGHT_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Nautical sunrise twilight time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Nautical sunrise twilight time" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseNauticalSunriseTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_NauticalSunriseTwilightTime * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_NAUTICAL_SUNRISE_TWILIGHT_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Nautical sunset twilight time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Nautical sunset twilight time" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseNauticalSunsetTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_NauticalSunsetTwilightTime * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_NAUTICAL_SUNSET_TWILIGHT_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Astronomical sunrise twilight time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Astronomical sunrise twilight time" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseAstronomicalSunriseTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_AstronomicalSunriseTwilightTime * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNRISE_TWILIGHT_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Astronomical sunset twilight time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Astronomical sunset twilight time" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseAstronomicalSunsetTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_AstronomicalSunsetTwilightTime * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNSET_TWILIGHT_START != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Calculated Noon" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Calculated Noon" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseCalculatedNoon(vscp_RxMessage const * const msg, vscp_evt_information_CalculatedNoon * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_CALCULATED_NOON != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter up" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter up" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterUp(vscp_RxMessage const * const msg, vscp_evt_information_ShutterUp * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_UP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter down" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter down" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterDown(vscp_RxMessage const * const msg, vscp_evt_information_ShutterDown * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_DOWN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter left" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter left" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterLeft(vscp_RxMessage const * const msg, vscp_evt_information_ShutterLeft * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_LEFT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter right" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter right" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterRight(vscp_RxMessage const * const msg, vscp_evt_information_ShutterRight * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_RIGHT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter reached top end" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter reached top end" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterReachedTopEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedTopEnd * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_END_TOP != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter reached bottom end" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter reached bottom end" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterReachedBottomEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedBottomEnd * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_END_BOTTOM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter reached middle end" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter reached middle end" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterReachedMiddleEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedMiddleEnd * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_END_MIDDLE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter reached preset end" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter reached preset end" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterReachedPresetEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedPresetEnd * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_END_PRESET != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter reached preset left" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter reached preset left" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterReachedPresetLeft(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedPresetLeft * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_END_LEFT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shutter reached preset right" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shutter reached preset right" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseShutterReachedPresetRight(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedPresetRight * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SHUTTER_END_RIGHT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Long click" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Long click" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseLongClick(vscp_RxMessage const * const msg, vscp_evt_information_LongClick * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_LONG_CLICK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Single click" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Single click" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseSingleClick(vscp_RxMessage const * const msg, vscp_evt_information_SingleClick * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_SINGLE_CLICK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Double click" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Double click" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDoubleClick(vscp_RxMessage const * const msg, vscp_evt_information_DoubleClick * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DOUBLE_CLICK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Date" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Date" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDate(vscp_RxMessage const * const msg, vscp_evt_information_Date * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DATE != msg->vscpType) || (7 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->yearCentury = msg->data[3];
+
+    evt->year = msg->data[4];
+
+    evt->month = msg->data[5];
+
+    evt->day = msg->data[6];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Time" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Time" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseTime(vscp_RxMessage const * const msg, vscp_evt_information_Time * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_TIME != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->hour = msg->data[3];
+
+    evt->minutes = msg->data[4];
+
+    evt->seconds = msg->data[5];
+
+    evt->milliseconds = VSCP_UTIL_READ_UINT16_BE(&msg->data[6]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Weekday" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Weekday" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseWeekday(vscp_RxMessage const * const msg, vscp_evt_information_Weekday * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_WEEKDAY != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->weekday = msg->data[3];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Lock" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Lock" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseLock(vscp_RxMessage const * const msg, vscp_evt_information_Lock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_LOCK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Unlock" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unlock" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseUnlock(vscp_RxMessage const * const msg, vscp_evt_information_Unlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_UNLOCK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "DateTime" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "DateTime" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDatetime(vscp_RxMessage const * const msg, vscp_evt_information_Datetime * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DATETIME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((2 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->dateTime[byteIndex] = msg->data[2 + byteIndex];
+    }
+    evt->dateTimeSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Rising" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Rising" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseRising(vscp_RxMessage const * const msg, vscp_evt_information_Rising * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_RISING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Falling" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Falling" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseFalling(vscp_RxMessage const * const msg, vscp_evt_information_Falling * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_FALLING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Updated" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Updated" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseUpdated(vscp_RxMessage const * const msg, vscp_evt_information_Updated * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_UPDATED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Connect" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Connect" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseConnect(vscp_RxMessage const * const msg, vscp_evt_information_Connect * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_CONNECT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Disconnect" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Disconnect" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDisconnect(vscp_RxMessage const * const msg, vscp_evt_information_Disconnect * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DISCONNECT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Reconnect" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Reconnect" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseReconnect(vscp_RxMessage const * const msg, vscp_evt_information_Reconnect * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_RECONNECT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Enter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Enter" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseEnter(vscp_RxMessage const * const msg, vscp_evt_information_Enter * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_ENTER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Exit" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Exit" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseExit(vscp_RxMessage const * const msg, vscp_evt_information_Exit * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_EXIT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Incremented" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Incremented" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseIncremented(vscp_RxMessage const * const msg, vscp_evt_information_Incremented * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_INCREMENTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->incrementedValue[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->incrementedValueSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Decremented" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decremented" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseDecremented(vscp_RxMessage const * const msg, vscp_evt_information_Decremented * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_DECREMENTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->decrementedValue[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->decrementedValueSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Proximity detected" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Proximity detected" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseProximityDetected(vscp_RxMessage const * const msg, vscp_evt_information_ProximityDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_INFORMATION != msg->vscpClass) || (VSCP_TYPE_INFORMATION_PROXIMITY_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userSpecific = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subzone = msg->data[2];
+
+    evt->proximityLevelAvailable = FALSE;
+    if (5 <= msg->dataSize)
+    {
+        evt->proximityLevelAvailable = TRUE;
+        evt->proximityLevel = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Information" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parse(vscp_RxMessage const * const msg, vscp_evt_information_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_INFORMATION != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_INFORMATION_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_INFORMATION_BUTTON:
+        status = vscp_evt_information_parseButton(msg, &evt->data.button);
+        break;
+
+    case VSCP_TYPE_INFORMATION_MOUSE:
+        status = vscp_evt_information_parseMouse(msg, &evt->data.mouse);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ON:
+        status = vscp_evt_information_parseOn(msg, &evt->data.on);
+        break;
+
+    case VSCP_TYPE_INFORMATION_OFF:
+        status = vscp_evt_information_parseOff(msg, &evt->data.off);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ALIVE:
+        status = vscp_evt_information_parseAlive(msg, &evt->data.alive);
+        break;
+
+    case VSCP_TYPE_INFORMATION_TERMINATING:
+        status = vscp_evt_information_parseTerminating(msg, &evt->data.terminating);
+        break;
+
+    case VSCP_TYPE_INFORMATION_OPENED:
+        status = vscp_evt_information_parseOpened(msg, &evt->data.opened);
+        break;
+
+    case VSCP_TYPE_INFORMATION_CLOSED:
+        status = vscp_evt_information_parseClosed(msg, &evt->data.closed);
+        break;
+
+    case VSCP_TYPE_INFORMATION_NODE_HEARTBEAT:
+        status = vscp_evt_information_parseNodeHeartbeat(msg, &evt->data.nodeHeartbeat);
+        break;
+
+    case VSCP_TYPE_INFORMATION_BELOW_LIMIT:
+        status = vscp_evt_information_parseBelowLimit(msg, &evt->data.belowLimit);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ABOVE_LIMIT:
+        status = vscp_evt_information_parseAboveLimit(msg, &evt->data.aboveLimit);
+        break;
+
+    case VSCP_TYPE_INFORMATION_PULSE:
+        status = vscp_evt_information_parsePulse(msg, &evt->data.pulse);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ERROR:
+        status = vscp_evt_information_parseError(msg, &evt->data.error);
+        break;
+
+    case VSCP_TYPE_INFORMATION_RESUMED:
+        status = vscp_evt_information_parseResumed(msg, &evt->data.resumed);
+        break;
+
+    case VSCP_TYPE_INFORMATION_PAUSED:
+        status = vscp_evt_information_parsePaused(msg, &evt->data.paused);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SLEEP:
+        status = vscp_evt_information_parseSleeping(msg, &evt->data.sleeping);
+        break;
+
+    case VSCP_TYPE_INFORMATION_GOOD_MORNING:
+        status = vscp_evt_information_parseGoodMorning(msg, &evt->data.goodMorning);
+        break;
+
+    case VSCP_TYPE_INFORMATION_GOOD_DAY:
+        status = vscp_evt_information_parseGoodDay(msg, &evt->data.goodDay);
+        break;
+
+    case VSCP_TYPE_INFORMATION_GOOD_AFTERNOON:
+        status = vscp_evt_information_parseGoodAfternoon(msg, &evt->data.goodAfternoon);
+        break;
+
+    case VSCP_TYPE_INFORMATION_GOOD_EVENING:
+        status = vscp_evt_information_parseGoodEvening(msg, &evt->data.goodEvening);
+        break;
+
+    case VSCP_TYPE_INFORMATION_GOOD_NIGHT:
+        status = vscp_evt_information_parseGoodNight(msg, &evt->data.goodNight);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SEE_YOU_SOON:
+        status = vscp_evt_information_parseSeeYouSoon(msg, &evt->data.seeYouSoon);
+        break;
+
+    case VSCP_TYPE_INFORMATION_GOODBYE:
+        status = vscp_evt_information_parseGoodbye(msg, &evt->data.goodbye);
+        break;
+
+    case VSCP_TYPE_INFORMATION_STOP:
+        status = vscp_evt_information_parseStop(msg, &evt->data.stop);
+        break;
+
+    case VSCP_TYPE_INFORMATION_START:
+        status = vscp_evt_information_parseStart(msg, &evt->data.start);
+        break;
+
+    case VSCP_TYPE_INFORMATION_RESET_COMPLETED:
+        status = vscp_evt_information_parseResetcompleted(msg, &evt->data.resetcompleted);
+        break;
+
+    case VSCP_TYPE_INFORMATION_INTERRUPTED:
+        status = vscp_evt_information_parseInterrupted(msg, &evt->data.interrupted);
+        break;
+
+    case VSCP_TYPE_INFORMATION_PREPARING_TO_SLEEP:
+        status = vscp_evt_information_parsePreparingtosleep(msg, &evt->data.preparingtosleep);
+        break;
+
+    case VSCP_TYPE_INFORMATION_WOKEN_UP:
+        status = vscp_evt_information_parseWokenup(msg, &evt->data.wokenup);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DUSK:
+        status = vscp_evt_information_parseDusk(msg, &evt->data.dusk);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DAWN:
+        status = vscp_evt_information_parseDawn(msg, &evt->data.dawn);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ACTIVE:
+        status = vscp_evt_information_parseActive(msg, &evt->data.active);
+        break;
+
+    case VSCP_TYPE_INFORMATION_INACTIVE:
+        status = vscp_evt_information_parseInactive(msg, &evt->data.inactive);
+        break;
+
+    case VSCP_TYPE_INFORMATION_BUSY:
+        status = vscp_evt_information_parseBusy(msg, &evt->data.busy);
+        break;
+
+    case VSCP_TYPE_INFORMATION_IDLE:
+        status = vscp_evt_information_parseIdle(msg, &evt->data.idle);
+        break;
+
+    case VSCP_TYPE_INFORMATION_STREAM_DATA:
+        status = vscp_evt_information_parseStreamData(msg, &evt->data.streamData);
+        break;
+
+    case VSCP_TYPE_INFORMATION_TOKEN_ACTIVITY:
+        status = vscp_evt_information_parseTokenActivity(msg, &evt->data.tokenActivity);
+        break;
+
+    case VSCP_TYPE_INFORMATION_STREAM_DATA_WITH_ZONE:
+        status = vscp_evt_information_parseStreamDataWithZone(msg, &evt->data.streamDataWithZone);
+        break;
+
+    case VSCP_TYPE_INFORMATION_CONFIRM:
+        status = vscp_evt_information_parseConfirm(msg, &evt->data.confirm);
+        break;
+
+    case VSCP_TYPE_INFORMATION_LEVEL_CHANGED:
+        status = vscp_evt_information_parseLevelChanged(msg, &evt->data.levelChanged);
+        break;
+
+    case VSCP_TYPE_INFORMATION_WARNING:
+        status = vscp_evt_information_parseWarning(msg, &evt->data.warning);
+        break;
+
+    case VSCP_TYPE_INFORMATION_STATE:
+        status = vscp_evt_information_parseState(msg, &evt->data.state);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ACTION_TRIGGER:
+        status = vscp_evt_information_parseActionTrigger(msg, &evt->data.actionTrigger);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SUNRISE:
+        status = vscp_evt_information_parseSunrise(msg, &evt->data.sunrise);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SUNSET:
+        status = vscp_evt_information_parseSunset(msg, &evt->data.sunset);
+        break;
+
+    case VSCP_TYPE_INFORMATION_START_OF_RECORD:
+        status = vscp_evt_information_parseStartOfRecord(msg, &evt->data.startOfRecord);
+        break;
+
+    case VSCP_TYPE_INFORMATION_END_OF_RECORD:
+        status = vscp_evt_information_parseEndOfRecord(msg, &evt->data.endOfRecord);
+        break;
+
+    case VSCP_TYPE_INFORMATION_PRESET_ACTIVE:
+        status = vscp_evt_information_parsePreSetActive(msg, &evt->data.preSetActive);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DETECT:
+        status = vscp_evt_information_parseDetect(msg, &evt->data.detect);
+        break;
+
+    case VSCP_TYPE_INFORMATION_OVERFLOW:
+        status = vscp_evt_information_parseOverflow(msg, &evt->data.overflow);
+        break;
+
+    case VSCP_TYPE_INFORMATION_BIG_LEVEL_CHANGED:
+        status = vscp_evt_information_parseBigLevelChanged(msg, &evt->data.bigLevelChanged);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SUNRISE_TWILIGHT_START:
+        status = vscp_evt_information_parseCivilSunriseTwilightTime(msg, &evt->data.civilSunriseTwilightTime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SUNSET_TWILIGHT_START:
+        status = vscp_evt_information_parseCivilSunsetTwilightTime(msg, &evt->data.civilSunsetTwilightTime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_NAUTICAL_SUNRISE_TWILIGHT_START:
+        status = vscp_evt_information_parseNauticalSunriseTwilightTime(msg, &evt->data.nauticalSunriseTwilightTime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_NAUTICAL_SUNSET_TWILIGHT_START:
+        status = vscp_evt_information_parseNauticalSunsetTwilightTime(msg, &evt->data.nauticalSunsetTwilightTime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNRISE_TWILIGHT_START:
+        status = vscp_evt_information_parseAstronomicalSunriseTwilightTime(msg, &evt->data.astronomicalSunriseTwilightTime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNSET_TWILIGHT_START:
+        status = vscp_evt_information_parseAstronomicalSunsetTwilightTime(msg, &evt->data.astronomicalSunsetTwilightTime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_CALCULATED_NOON:
+        status = vscp_evt_information_parseCalculatedNoon(msg, &evt->data.calculatedNoon);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_UP:
+        status = vscp_evt_information_parseShutterUp(msg, &evt->data.shutterUp);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_DOWN:
+        status = vscp_evt_information_parseShutterDown(msg, &evt->data.shutterDown);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_LEFT:
+        status = vscp_evt_information_parseShutterLeft(msg, &evt->data.shutterLeft);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_RIGHT:
+        status = vscp_evt_information_parseShutterRight(msg, &evt->data.shutterRight);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_END_TOP:
+        status = vscp_evt_information_parseShutterReachedTopEnd(msg, &evt->data.shutterReachedTopEnd);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_END_BOTTOM:
+        status = vscp_evt_information_parseShutterReachedBottomEnd(msg, &evt->data.shutterReachedBottomEnd);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_END_MIDDLE:
+        status = vscp_evt_information_parseShutterReachedMiddleEnd(msg, &evt->data.shutterReachedMiddleEnd);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_END_PRESET:
+        status = vscp_evt_information_parseShutterReachedPresetEnd(msg, &evt->data.shutterReachedPresetEnd);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_END_LEFT:
+        status = vscp_evt_information_parseShutterReachedPresetLeft(msg, &evt->data.shutterReachedPresetLeft);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SHUTTER_END_RIGHT:
+        status = vscp_evt_information_parseShutterReachedPresetRight(msg, &evt->data.shutterReachedPresetRight);
+        break;
+
+    case VSCP_TYPE_INFORMATION_LONG_CLICK:
+        status = vscp_evt_information_parseLongClick(msg, &evt->data.longClick);
+        break;
+
+    case VSCP_TYPE_INFORMATION_SINGLE_CLICK:
+        status = vscp_evt_information_parseSingleClick(msg, &evt->data.singleClick);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DOUBLE_CLICK:
+        status = vscp_evt_information_parseDoubleClick(msg, &evt->data.doubleClick);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DATE:
+        status = vscp_evt_information_parseDate(msg, &evt->data.date);
+        break;
+
+    case VSCP_TYPE_INFORMATION_TIME:
+        status = vscp_evt_information_parseTime(msg, &evt->data.time);
+        break;
+
+    case VSCP_TYPE_INFORMATION_WEEKDAY:
+        status = vscp_evt_information_parseWeekday(msg, &evt->data.weekday);
+        break;
+
+    case VSCP_TYPE_INFORMATION_LOCK:
+        status = vscp_evt_information_parseLock(msg, &evt->data.lock);
+        break;
+
+    case VSCP_TYPE_INFORMATION_UNLOCK:
+        status = vscp_evt_information_parseUnlock(msg, &evt->data.unlock);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DATETIME:
+        status = vscp_evt_information_parseDatetime(msg, &evt->data.datetime);
+        break;
+
+    case VSCP_TYPE_INFORMATION_RISING:
+        status = vscp_evt_information_parseRising(msg, &evt->data.rising);
+        break;
+
+    case VSCP_TYPE_INFORMATION_FALLING:
+        status = vscp_evt_information_parseFalling(msg, &evt->data.falling);
+        break;
+
+    case VSCP_TYPE_INFORMATION_UPDATED:
+        status = vscp_evt_information_parseUpdated(msg, &evt->data.updated);
+        break;
+
+    case VSCP_TYPE_INFORMATION_CONNECT:
+        status = vscp_evt_information_parseConnect(msg, &evt->data.connect);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DISCONNECT:
+        status = vscp_evt_information_parseDisconnect(msg, &evt->data.disconnect);
+        break;
+
+    case VSCP_TYPE_INFORMATION_RECONNECT:
+        status = vscp_evt_information_parseReconnect(msg, &evt->data.reconnect);
+        break;
+
+    case VSCP_TYPE_INFORMATION_ENTER:
+        status = vscp_evt_information_parseEnter(msg, &evt->data.enter);
+        break;
+
+    case VSCP_TYPE_INFORMATION_EXIT:
+        status = vscp_evt_information_parseExit(msg, &evt->data.exit);
+        break;
+
+    case VSCP_TYPE_INFORMATION_INCREMENTED:
+        status = vscp_evt_information_parseIncremented(msg, &evt->data.incremented);
+        break;
+
+    case VSCP_TYPE_INFORMATION_DECREMENTED:
+        status = vscp_evt_information_parseDecremented(msg, &evt->data.decremented);
+        break;
+
+    case VSCP_TYPE_INFORMATION_PROXIMITY_DETECTED:
+        status = vscp_evt_information_parseProximityDetected(msg, &evt->data.proximityDetected);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -49,6 +49,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -71,1035 +72,2868 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Button" event. */
+typedef struct
+{
+    uint8_t buttonState; /**< Button state */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint16_t buttonCode; /**< Button code */
+    uint16_t codePage; /**< Code page */
+    BOOL codePageAvailable; /**< Code page available */
+
+} vscp_evt_information_Button;
+
+/** Parameters of the "Mouse" event. */
+typedef struct
+{
+    uint8_t kindOfCoordinates; /**< Kind of coordinates */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint16_t normalizedXCoordinate; /**< Normalized x-coordinate */
+    uint16_t normalizedYCoordinate; /**< Normalized y-coordinate */
+
+} vscp_evt_information_Mouse;
+
+/** Parameters of the "On" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_On;
+
+/** Parameters of the "Off" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Off;
+
+/** Parameters of the "Alive" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Alive;
+
+/** Parameters of the "Terminating" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Terminating;
+
+/** Parameters of the "Opened" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Opened;
+
+/** Parameters of the "Closed" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Closed;
+
+/** Parameters of the "Node Heartbeat" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t userData[5]; /**< User data */
+    uint8_t userDataSize; /**< User data size */
+
+} vscp_evt_information_NodeHeartbeat;
+
+/** Parameters of the "Below limit" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_BelowLimit;
+
+/** Parameters of the "Above limit" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_AboveLimit;
+
+/** Parameters of the "Pulse" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Pulse;
+
+/** Parameters of the "Error" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Error;
+
+/** Parameters of the "Resumed" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Resumed;
+
+/** Parameters of the "Paused" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Paused;
+
+/** Parameters of the "Sleeping" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Sleeping;
+
+/** Parameters of the "Good morning" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_GoodMorning;
+
+/** Parameters of the "Good day" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_GoodDay;
+
+/** Parameters of the "Good afternoon" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_GoodAfternoon;
+
+/** Parameters of the "Good evening" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_GoodEvening;
+
+/** Parameters of the "Good night" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_GoodNight;
+
+/** Parameters of the "See you soon" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_SeeYouSoon;
+
+/** Parameters of the "Goodbye" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Goodbye;
+
+/** Parameters of the "Stop" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Stop;
+
+/** Parameters of the "Start" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Start;
+
+/** Parameters of the "ResetCompleted" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Resetcompleted;
+
+/** Parameters of the "Interrupted" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Interrupted;
+
+/** Parameters of the "PreparingToSleep" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Preparingtosleep;
+
+/** Parameters of the "WokenUp" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Wokenup;
+
+/** Parameters of the "Dusk" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Dusk;
+
+/** Parameters of the "Dawn" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Dawn;
+
+/** Parameters of the "Active" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Active;
+
+/** Parameters of the "Inactive" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Inactive;
+
+/** Parameters of the "Busy" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Busy;
+
+/** Parameters of the "Idle" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Idle;
+
+/** Parameters of the "Stream Data" event. */
+typedef struct
+{
+    uint8_t sequenceNumber; /**< Sequence number */
+    uint8_t streamData[7]; /**< Stream data */
+    uint8_t streamDataSize; /**< Stream data size */
+
+} vscp_evt_information_StreamData;
+
+/** Parameters of the "Token Activity" event. */
+typedef struct
+{
+    uint8_t tokenType; /**< Token Type */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t frameIndex; /**< Frame index */
+    uint8_t tokenData[4]; /**< Token data */
+    uint8_t tokenDataSize; /**< Token data size */
+
+} vscp_evt_information_TokenActivity;
+
+/** Parameters of the "Stream Data with zone" event. */
+typedef struct
+{
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t sequenceNumber; /**< Sequence number */
+    uint8_t streamData[4]; /**< Stream data */
+    uint8_t streamDataSize; /**< Stream data size */
+
+} vscp_evt_information_StreamDataWithZone;
+
+/** Parameters of the "Confirm" event. */
+typedef struct
+{
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t sequenceNumber; /**< Sequence number */
+    uint16_t vscpClass; /**< VSCP class */
+    uint16_t vscpType; /**< VSCP type */
+
+} vscp_evt_information_Confirm;
+
+/** Parameters of the "Level Changed" event. */
+typedef struct
+{
+    uint8_t level; /**< Level */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_LevelChanged;
+
+/** Parameters of the "Warning" event. */
+typedef struct
+{
+    uint8_t level; /**< Level */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Warning;
+
+/** Parameters of the "State" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t from; /**< From */
+    uint8_t to; /**< To */
+
+} vscp_evt_information_State;
+
+/** Parameters of the "Action Trigger" event. */
+typedef struct
+{
+    uint8_t actionId; /**< Action id */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ActionTrigger;
+
+/** Parameters of the "Sunrise" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Sunrise;
+
+/** Parameters of the "Sunset" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Sunset;
+
+/** Parameters of the "Start of record" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t remainingFrames; /**< Remaining frames */
+
+} vscp_evt_information_StartOfRecord;
+
+/** Parameters of the "End of record" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_EndOfRecord;
+
+/** Parameters of the "Pre-set active" event. */
+typedef struct
+{
+    uint8_t user; /**< User */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t preSetCode; /**< Pre-Set code */
+
+} vscp_evt_information_PreSetActive;
+
+/** Parameters of the "Detect" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Detect;
+
+/** Parameters of the "Overflow" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Overflow;
+
+/** Parameters of the "Big level changed" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t level[5]; /**< Level */
+    uint8_t levelSize; /**< Level size */
+
+} vscp_evt_information_BigLevelChanged;
+
+/** Parameters of the "Civil sunrise twilight time" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_CivilSunriseTwilightTime;
+
+/** Parameters of the "Civil sunset twilight time" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_CivilSunsetTwilightTime;
+
+/** Parameters of the "Nautical sunrise twilight time" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_NauticalSunriseTwilightTime;
+
+/** Parameters of the "Nautical sunset twilight time" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_NauticalSunsetTwilightTime;
+
+/** Parameters of the "Astronomical sunrise twilight time" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_AstronomicalSunriseTwilightTime;
+
+/** Parameters of the "Astronomical sunset twilight time" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_AstronomicalSunsetTwilightTime;
+
+/** Parameters of the "Calculated Noon" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_CalculatedNoon;
+
+/** Parameters of the "Shutter up" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterUp;
+
+/** Parameters of the "Shutter down" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterDown;
+
+/** Parameters of the "Shutter left" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterLeft;
+
+/** Parameters of the "Shutter right" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterRight;
+
+/** Parameters of the "Shutter reached top end" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterReachedTopEnd;
+
+/** Parameters of the "Shutter reached bottom end" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterReachedBottomEnd;
+
+/** Parameters of the "Shutter reached middle end" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterReachedMiddleEnd;
+
+/** Parameters of the "Shutter reached preset end" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterReachedPresetEnd;
+
+/** Parameters of the "Shutter reached preset left" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterReachedPresetLeft;
+
+/** Parameters of the "Shutter reached preset right" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_ShutterReachedPresetRight;
+
+/** Parameters of the "Long click" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_LongClick;
+
+/** Parameters of the "Single click" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_SingleClick;
+
+/** Parameters of the "Double click" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_DoubleClick;
+
+/** Parameters of the "Date" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t yearCentury; /**< Year century */
+    uint8_t year; /**< Year */
+    uint8_t month; /**< Month */
+    uint8_t day; /**< Day */
+
+} vscp_evt_information_Date;
+
+/** Parameters of the "Time" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t hour; /**< Hour */
+    uint8_t minutes; /**< Minutes */
+    uint8_t seconds; /**< Seconds */
+    uint16_t milliseconds; /**< Milliseconds */
+
+} vscp_evt_information_Time;
+
+/** Parameters of the "Weekday" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t weekday; /**< Weekday */
+
+} vscp_evt_information_Weekday;
+
+/** Parameters of the "Lock" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Lock;
+
+/** Parameters of the "Unlock" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Unlock;
+
+/** Parameters of the "DateTime" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+    uint8_t dateTime[5]; /**< Date/Time */
+    uint8_t dateTimeSize; /**< Date/Time size */
+
+} vscp_evt_information_Datetime;
+
+/** Parameters of the "Rising" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Rising;
+
+/** Parameters of the "Falling" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Falling;
+
+/** Parameters of the "Updated" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Updated;
+
+/** Parameters of the "Connect" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Connect;
+
+/** Parameters of the "Disconnect" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Disconnect;
+
+/** Parameters of the "Reconnect" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Reconnect;
+
+/** Parameters of the "Enter" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Enter;
+
+/** Parameters of the "Exit" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-Zone */
+
+} vscp_evt_information_Exit;
+
+/** Parameters of the "Incremented" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint8_t incrementedValue[5]; /**< Incremented value */
+    uint8_t incrementedValueSize; /**< Incremented value size */
+
+} vscp_evt_information_Incremented;
+
+/** Parameters of the "Decremented" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint8_t decrementedValue[5]; /**< Decremented value */
+    uint8_t decrementedValueSize; /**< Decremented value size */
+
+} vscp_evt_information_Decremented;
+
+/** Parameters of the "Proximity detected" event. */
+typedef struct
+{
+    uint8_t userSpecific; /**< User specific */
+    uint8_t zone; /**< Zone */
+    uint8_t subzone; /**< Subzone */
+    uint16_t proximityLevel; /**< Proximity Level */
+    BOOL proximityLevelAvailable; /**< Proximity Level available */
+
+} vscp_evt_information_ProximityDetected;
+
+/** Parsed event of the "Information" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_information_Button button; /**< Parameters of the "Button" event */
+        vscp_evt_information_Mouse mouse; /**< Parameters of the "Mouse" event */
+        vscp_evt_information_On on; /**< Parameters of the "On" event */
+        vscp_evt_information_Off off; /**< Parameters of the "Off" event */
+        vscp_evt_information_Alive alive; /**< Parameters of the "Alive" event */
+        vscp_evt_information_Terminating terminating; /**< Parameters of the "Terminating" event */
+        vscp_evt_information_Opened opened; /**< Parameters of the "Opened" event */
+        vscp_evt_information_Closed closed; /**< Parameters of the "Closed" event */
+        vscp_evt_information_NodeHeartbeat nodeHeartbeat; /**< Parameters of the "Node Heartbeat" event */
+        vscp_evt_information_BelowLimit belowLimit; /**< Parameters of the "Below limit" event */
+        vscp_evt_information_AboveLimit aboveLimit; /**< Parameters of the "Above limit" event */
+        vscp_evt_information_Pulse pulse; /**< Parameters of the "Pulse" event */
+        vscp_evt_information_Error error; /**< Parameters of the "Error" event */
+        vscp_evt_information_Resumed resumed; /**< Parameters of the "Resumed" event */
+        vscp_evt_information_Paused paused; /**< Parameters of the "Paused" event */
+        vscp_evt_information_Sleeping sleeping; /**< Parameters of the "Sleeping" event */
+        vscp_evt_information_GoodMorning goodMorning; /**< Parameters of the "Good morning" event */
+        vscp_evt_information_GoodDay goodDay; /**< Parameters of the "Good day" event */
+        vscp_evt_information_GoodAfternoon goodAfternoon; /**< Parameters of the "Good afternoon" event */
+        vscp_evt_information_GoodEvening goodEvening; /**< Parameters of the "Good evening" event */
+        vscp_evt_information_GoodNight goodNight; /**< Parameters of the "Good night" event */
+        vscp_evt_information_SeeYouSoon seeYouSoon; /**< Parameters of the "See you soon" event */
+        vscp_evt_information_Goodbye goodbye; /**< Parameters of the "Goodbye" event */
+        vscp_evt_information_Stop stop; /**< Parameters of the "Stop" event */
+        vscp_evt_information_Start start; /**< Parameters of the "Start" event */
+        vscp_evt_information_Resetcompleted resetcompleted; /**< Parameters of the "ResetCompleted" event */
+        vscp_evt_information_Interrupted interrupted; /**< Parameters of the "Interrupted" event */
+        vscp_evt_information_Preparingtosleep preparingtosleep; /**< Parameters of the "PreparingToSleep" event */
+        vscp_evt_information_Wokenup wokenup; /**< Parameters of the "WokenUp" event */
+        vscp_evt_information_Dusk dusk; /**< Parameters of the "Dusk" event */
+        vscp_evt_information_Dawn dawn; /**< Parameters of the "Dawn" event */
+        vscp_evt_information_Active active; /**< Parameters of the "Active" event */
+        vscp_evt_information_Inactive inactive; /**< Parameters of the "Inactive" event */
+        vscp_evt_information_Busy busy; /**< Parameters of the "Busy" event */
+        vscp_evt_information_Idle idle; /**< Parameters of the "Idle" event */
+        vscp_evt_information_StreamData streamData; /**< Parameters of the "Stream Data" event */
+        vscp_evt_information_TokenActivity tokenActivity; /**< Parameters of the "Token Activity" event */
+        vscp_evt_information_StreamDataWithZone streamDataWithZone; /**< Parameters of the "Stream Data with zone" event */
+        vscp_evt_information_Confirm confirm; /**< Parameters of the "Confirm" event */
+        vscp_evt_information_LevelChanged levelChanged; /**< Parameters of the "Level Changed" event */
+        vscp_evt_information_Warning warning; /**< Parameters of the "Warning" event */
+        vscp_evt_information_State state; /**< Parameters of the "State" event */
+        vscp_evt_information_ActionTrigger actionTrigger; /**< Parameters of the "Action Trigger" event */
+        vscp_evt_information_Sunrise sunrise; /**< Parameters of the "Sunrise" event */
+        vscp_evt_information_Sunset sunset; /**< Parameters of the "Sunset" event */
+        vscp_evt_information_StartOfRecord startOfRecord; /**< Parameters of the "Start of record" event */
+        vscp_evt_information_EndOfRecord endOfRecord; /**< Parameters of the "End of record" event */
+        vscp_evt_information_PreSetActive preSetActive; /**< Parameters of the "Pre-set active" event */
+        vscp_evt_information_Detect detect; /**< Parameters of the "Detect" event */
+        vscp_evt_information_Overflow overflow; /**< Parameters of the "Overflow" event */
+        vscp_evt_information_BigLevelChanged bigLevelChanged; /**< Parameters of the "Big level changed" event */
+        vscp_evt_information_CivilSunriseTwilightTime civilSunriseTwilightTime; /**< Parameters of the "Civil sunrise twilight time" event */
+        vscp_evt_information_CivilSunsetTwilightTime civilSunsetTwilightTime; /**< Parameters of the "Civil sunset twilight time" event */
+        vscp_evt_information_NauticalSunriseTwilightTime nauticalSunriseTwilightTime; /**< Parameters of the "Nautical sunrise twilight time" event */
+        vscp_evt_information_NauticalSunsetTwilightTime nauticalSunsetTwilightTime; /**< Parameters of the "Nautical sunset twilight time" event */
+        vscp_evt_information_AstronomicalSunriseTwilightTime astronomicalSunriseTwilightTime; /**< Parameters of the "Astronomical sunrise twilight time" event */
+        vscp_evt_information_AstronomicalSunsetTwilightTime astronomicalSunsetTwilightTime; /**< Parameters of the "Astronomical sunset twilight time" event */
+        vscp_evt_information_CalculatedNoon calculatedNoon; /**< Parameters of the "Calculated Noon" event */
+        vscp_evt_information_ShutterUp shutterUp; /**< Parameters of the "Shutter up" event */
+        vscp_evt_information_ShutterDown shutterDown; /**< Parameters of the "Shutter down" event */
+        vscp_evt_information_ShutterLeft shutterLeft; /**< Parameters of the "Shutter left" event */
+        vscp_evt_information_ShutterRight shutterRight; /**< Parameters of the "Shutter right" event */
+        vscp_evt_information_ShutterReachedTopEnd shutterReachedTopEnd; /**< Parameters of the "Shutter reached top end" event */
+        vscp_evt_information_ShutterReachedBottomEnd shutterReachedBottomEnd; /**< Parameters of the "Shutter reached bottom end" event */
+        vscp_evt_information_ShutterReachedMiddleEnd shutterReachedMiddleEnd; /**< Parameters of the "Shutter reached middle end" event */
+        vscp_evt_information_ShutterReachedPresetEnd shutterReachedPresetEnd; /**< Parameters of the "Shutter reached preset end" event */
+        vscp_evt_information_ShutterReachedPresetLeft shutterReachedPresetLeft; /**< Parameters of the "Shutter reached preset left" event */
+        vscp_evt_information_ShutterReachedPresetRight shutterReachedPresetRight; /**< Parameters of the "Shutter reached preset right" event */
+        vscp_evt_information_LongClick longClick; /**< Parameters of the "Long click" event */
+        vscp_evt_information_SingleClick singleClick; /**< Parameters of the "Single click" event */
+        vscp_evt_information_DoubleClick doubleClick; /**< Parameters of the "Double click" event */
+        vscp_evt_information_Date date; /**< Parameters of the "Date" event */
+        vscp_evt_information_Time time; /**< Parameters of the "Time" event */
+        vscp_evt_information_Weekday weekday; /**< Parameters of the "Weekday" event */
+        vscp_evt_information_Lock lock; /**< Parameters of the "Lock" event */
+        vscp_evt_information_Unlock unlock; /**< Parameters of the "Unlock" event */
+        vscp_evt_information_Datetime datetime; /**< Parameters of the "DateTime" event */
+        vscp_evt_information_Rising rising; /**< Parameters of the "Rising" event */
+        vscp_evt_information_Falling falling; /**< Parameters of the "Falling" event */
+        vscp_evt_information_Updated updated; /**< Parameters of the "Updated" event */
+        vscp_evt_information_Connect connect; /**< Parameters of the "Connect" event */
+        vscp_evt_information_Disconnect disconnect; /**< Parameters of the "Disconnect" event */
+        vscp_evt_information_Reconnect reconnect; /**< Parameters of the "Reconnect" event */
+        vscp_evt_information_Enter enter; /**< Parameters of the "Enter" event */
+        vscp_evt_information_Exit exit; /**< Parameters of the "Exit" event */
+        vscp_evt_information_Incremented incremented; /**< Parameters of the "Incremented" event */
+        vscp_evt_information_Decremented decremented; /**< Parameters of the "Decremented" event */
+        vscp_evt_information_ProximityDetected proximityDetected; /**< Parameters of the "Proximity detected" event */
+    } data;
+
+} vscp_evt_information_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
 
-/*******************************************************************************
-    FUNCTIONS
-*******************************************************************************/
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * General event
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGeneralEvent(void);
+
+/**
+ * Button
+ * 
+ * @param[in] buttonState Button state.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] buttonCode Button code.
+ * @param[in] codePage Code page. (optional)
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendButton(uint8_t buttonState, uint8_t zone, uint8_t subZone, uint16_t buttonCode, uint16_t const * const codePage);
+
+/**
+ * Mouse
+ * 
+ * @param[in] kindOfCoordinates If zero absolute coordinates follow. If equal to one relative
+ * coordinates follow.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] normalizedXCoordinate Normalized x-coordinate.
+ * @param[in] normalizedYCoordinate Normalized y-coordinate.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendMouse(uint8_t kindOfCoordinates, uint8_t zone, uint8_t subZone, uint16_t normalizedXCoordinate, uint16_t normalizedYCoordinate);
+
+/**
+ * On
+ * 
+ * @param[in] index Index, often used as an index for channels within a module.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendOn(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Off
+ * 
+ * @param[in] index Index, often used as an index for channels within a module.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendOff(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Alive
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendAlive(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Terminating
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendTerminating(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Opened
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendOpened(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Closed
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendClosed(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Node Heartbeat
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] userData Optional user provided data. (optional) (array[5])
+ * @param[in] userDatasize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendNodeHeartbeat(uint8_t userSpecific, uint8_t zone, uint8_t subZone, uint8_t const * const userData, uint8_t userDataSize);
+
+/**
+ * Below limit
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendBelowLimit(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Above limit
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendAboveLimit(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Pulse
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendPulse(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Error
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendError(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Resumed
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendResumed(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Paused
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendPaused(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Sleeping
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendSleeping(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Good morning
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGoodMorning(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Good day
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGoodDay(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Good afternoon
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGoodAfternoon(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Good evening
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGoodEvening(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Good night
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGoodNight(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * See you soon
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendSeeYouSoon(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Goodbye
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendGoodbye(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Stop
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendStop(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Start
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendStart(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * ResetCompleted
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendResetcompleted(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Interrupted
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendInterrupted(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * PreparingToSleep
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendPreparingtosleep(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * WokenUp
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendWokenup(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Dusk
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendDusk(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Dawn
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendDawn(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Active
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendActive(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Inactive
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendInactive(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Busy
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendBusy(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Idle
+ * 
+ * @param[in] reserved Reserved for future use.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendIdle(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Stream Data
+ * 
+ * @param[in] sequenceNumber Sequence number which is increased by one for every new event with stream
+ * data. The sequence number is increased for every frame sent going from 0 - 255 and back to 0 and so
+ * on if needed. A new stream starts with a sequence number of 0.
+ * @param[in] streamData Stream data. (array[7])
+ * @param[in] streamDatasize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendStreamData(uint8_t sequenceNumber, uint8_t const * const streamData, uint8_t streamDataSize);
+
+/**
+ * Token Activity
+ * 
+ * @param[in] tokenType Bit 0,1 - Event code. Bit 2-7 - Token device type code.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] frameIndex Frame index (Increase by one for every frame sent out for one token activity.
+ * Start with zero ).
+ * @param[in] tokenData Token data. (array[4])
+ * @param[in] tokenDatasize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendTokenActivity(uint8_t tokenType, uint8_t zone, uint8_t subZone, uint8_t frameIndex, uint8_t const * const tokenData, uint8_t tokenDataSize);
+
+/**
+ * Stream Data with zone
+ * 
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] sequenceNumber Sequence number which is increased by one for every new event with stream
+ * data. The sequence number is increased for every frame sent going from 0 - 255 and back to 0 and so
+ * on if needed. A new stream starts with a sequence number of 0.
+ * @param[in] streamData Stream data. (array[4])
+ * @param[in] streamDatasize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendStreamDataWithZone(uint8_t zone, uint8_t subZone, uint8_t sequenceNumber, uint8_t const * const streamData, uint8_t streamDataSize);
+
+/**
+ * Confirm
+ * 
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] sequenceNumber Sequence number.
+ * @param[in] vscpClass VSCP class.
+ * @param[in] vscpType VSCP type.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendConfirm(uint8_t zone, uint8_t subZone, uint8_t sequenceNumber, uint16_t vscpClass, uint16_t vscpType);
+
+/**
+ * Level Changed
+ * 
+ * @param[in] level Relative or absolute level.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendLevelChanged(uint8_t level, uint8_t zone, uint8_t subZone);
+
+/**
+ * Warning
+ * 
+ * @param[in] level Relative or absolute level.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendWarning(uint8_t level, uint8_t zone, uint8_t subZone);
+
+/**
+ * State
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] from State changed from (old state).
+ * @param[in] to State changed to (new state).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendState(uint8_t userSpecific, uint8_t zone, uint8_t subZone, uint8_t from, uint8_t to);
+
+/**
+ * Action Trigger
+ * 
+ * @param[in] actionId Action id.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendActionTrigger(uint8_t actionId, uint8_t zone, uint8_t subZone);
+
+/**
+ * Sunrise
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendSunrise(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Sunset
+ * 
+ * @param[in] userSpecific User specific value.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendSunset(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Start of record
+ * 
+ * @param[in] index Index for record.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] remainingFrames Number of frames to follow or zero for not used.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendStartOfRecord(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t remainingFrames);
+
+/**
+ * End of record
+ * 
+ * @param[in] index Index for record.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendEndOfRecord(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Pre-set active
+ * 
+ * @param[in] user User specified.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] preSetCode Code for pre-set that has been set.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendPreSetActive(uint8_t user, uint8_t zone, uint8_t subZone, uint8_t preSetCode);
+
+/**
+ * Detect
+ * 
+ * @param[in] index Index.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendDetect(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Overflow
+ * 
+ * @param[in] index Index.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendOverflow(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Big level changed
+ * 
+ * @param[in] index Index.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] level Level as signed Integer. The range can be adjusted by the user by sending the
+ * needed number of bytes 1-5. (array[5])
+ * @param[in] levelsize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendBigLevelChanged(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const level, uint8_t levelSize);
+
+/**
+ * Civil sunrise twilight time
+ * 
+ * @param[in] userSpecific User specific.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendCivilSunriseTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Civil sunset twilight time
+ * 
+ * @param[in] userSpecific User specific.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendCivilSunsetTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Nautical sunrise twilight time
+ * 
+ * @param[in] userSpecific User specific.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendNauticalSunriseTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Nautical sunset twilight time
+ * 
+ * @param[in] userSpecific User specific.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendNauticalSunsetTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Astronomical sunrise twilight time
+ * 
+ * @param[in] userSpecific User specific.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendAstronomicalSunriseTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Astronomical sunset twilight time
+ * 
+ * @param[in] userSpecific User specific.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendAstronomicalSunsetTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+
+/**
+ * Calculated Noon
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendCalculatedNoon(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter up
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterUp(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter down
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterDown(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter left
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterLeft(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter right
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterRight(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter reached top end
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterReachedTopEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter reached bottom end
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterReachedBottomEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter reached middle end
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterReachedMiddleEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter reached preset end
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterReachedPresetEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter reached preset left
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterReachedPresetLeft(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Shutter reached preset right
+ * 
+ * @param[in] reserved Reserved.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendShutterReachedPresetRight(uint8_t reserved, uint8_t zone, uint8_t subZone);
+
+/**
+ * Long click
+ * 
+ * @param[in] index Index for device generating long click. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendLongClick(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * General event
+ * Single click
+ * 
+ * @param[in] index Index for device generating single click. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGeneralEvent(void);
+extern BOOL vscp_evt_information_sendSingleClick(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Button
+ * Double click
  * 
- * @param[in] buttonState Button state.
+ * @param[in] index Index for device generating double click. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] buttonCode Button code.
- * @param[in] codePage Code page. (optional)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendButton(uint8_t buttonState, uint8_t zone, uint8_t subZone, uint16_t buttonCode, uint16_t const * const codePage);
+extern BOOL vscp_evt_information_sendDoubleClick(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Mouse
+ * Date
  * 
- * @param[in] kindOfCoordinates If zero absolute coordinates follow. If equal to one relative
- * coordinates follow.
+ * @param[in] index Index for device generating date. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] normalizedXCoordinate Normalized x-coordinate.
- * @param[in] normalizedYCoordinate Normalized y-coordinate.
+ * @param[in] yearCentury Year century.
+ * @param[in] year Year.
+ * @param[in] month Month (1-12).
+ * @param[in] day Day.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendMouse(uint8_t kindOfCoordinates, uint8_t zone, uint8_t subZone, uint16_t normalizedXCoordinate, uint16_t normalizedYCoordinate);
+extern BOOL vscp_evt_information_sendDate(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t yearCentury, uint8_t year, uint8_t month, uint8_t day);
 
 /**
- * On
+ * Time
  * 
- * @param[in] index Index, often used as an index for channels within a module.
+ * @param[in] index Index for device generating time. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] hour Hour (0-23).
+ * @param[in] minutes Minutes (0-59).
+ * @param[in] seconds Seconds (0-59).
+ * @param[in] milliseconds Milliseconds (0-999).
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendOn(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t hour, uint8_t minutes, uint8_t seconds, uint16_t milliseconds);
 
 /**
- * Off
+ * Weekday
  * 
- * @param[in] index Index, often used as an index for channels within a module.
+ * @param[in] index Index for device generating weekday info. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] weekday Weekday ( 0 (Monday) - 6 (Sunday)).
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendOff(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendWeekday(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t weekday);
 
 /**
- * Alive
+ * Lock
  * 
- * @param[in] userSpecific User specific value.
+ * @param[in] index Index for device. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendAlive(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendLock(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Terminating
+ * Unlock
  * 
- * @param[in] userSpecific User specific value.
+ * @param[in] index Index for device. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendTerminating(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendUnlock(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Opened
+ * DateTime
  * 
- * @param[in] userSpecific User specific value.
+ * @param[in] index Index for device. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] dateTime Date/time in five byte bit array. (array[5])
+ * @param[in] dateTimesize Size in byte.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendOpened(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendDatetime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const dateTime, uint8_t dateTimeSize);
 
 /**
- * Closed
+ * Rising
  * 
- * @param[in] userSpecific User specific value.
+ * @param[in] index Index for device. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendClosed(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendRising(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Node Heartbeat
+ * Falling
  * 
- * @param[in] userSpecific User specific value.
+ * @param[in] index Index for device. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] userData Optional user provided data. (optional) (array[5])
- * @param[in] userDatasize Size in byte.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendNodeHeartbeat(uint8_t userSpecific, uint8_t zone, uint8_t subZone, uint8_t const * const userData, uint8_t userDataSize);
+extern BOOL vscp_evt_information_sendFalling(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Below limit
+ * Updated
  * 
- * @param[in] reserved Reserved for future use.
+ * @param[in] index Index for device. Set to zero if not used.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendBelowLimit(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_sendUpdated(uint8_t index, uint8_t zone, uint8_t subZone);
 
 /**
- * Above limit
+ * Connect
+ * 
+ * @param[in] index Index for device. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendConnect(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Disconnect
+ * 
+ * @param[in] index Index for device. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendDisconnect(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Reconnect
+ * 
+ * @param[in] index Index for device. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendReconnect(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Enter
+ * 
+ * @param[in] index Index for device. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendEnter(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Exit
+ * 
+ * @param[in] index Index for device. Set to zero if not used.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendExit(uint8_t index, uint8_t zone, uint8_t subZone);
+
+/**
+ * Incremented
+ * 
+ * @param[in] userSpecific Optional byte that have a meaning given by the issuer of the event.
+ * Prefered use is _index_ for compability.
+ * @param[in] zone Zone for which event applies to (0-255). 255 is all zones
+ * @param[in] subzone Sub-zone for which event applies to (0-255). 255 is all sub-zones
+ * @param[in] incrementedValue Incremented value. The range can be adjusted by the user by sending
+ * just the needed number of bytes 1-5 (optional) (array[5])
+ * @param[in] incrementedValuesize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendIncremented(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint8_t const * const incrementedValue, uint8_t incrementedValueSize);
+
+/**
+ * Decremented
+ * 
+ * @param[in] userSpecific Optional byte that have a meaning given by the issuer of the event.
+ * Prefered use is _index_ for compability.
+ * @param[in] zone Zone for which event applies to (0-255). 255 is all zones
+ * @param[in] subzone Sub-zone for which event applies to (0-255). 255 is all sub-zones
+ * @param[in] decrementedValue Decremented value. The range can be adjusted by the user by sending
+ * just the needed number of bytes 1-5 (optional) (array[5])
+ * @param[in] decrementedValuesize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendDecremented(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint8_t const * const decrementedValue, uint8_t decrementedValueSize);
+
+/**
+ * Proximity detected
+ * 
+ * @param[in] userSpecific Optional byte that have a meaning given by the issuer of the event.
+ * Prefered use is _index_ for compability.
+ * @param[in] zone Zone for which event applies to (0-255). 255 is all zones
+ * @param[in] subzone Sub-zone for which event applies to (0-255). 255 is all sub-zones
+ * @param[in] proximityLevel Optional uint16 that sets proximity level if present. (optional)
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_sendProximityDetected(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint16_t const * const proximityLevel);
+
+/**
+ * Parse the "Button" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Button" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseButton(vscp_RxMessage const * const msg, vscp_evt_information_Button * const evt);
+
+/**
+ * Parse the "Mouse" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Mouse" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseMouse(vscp_RxMessage const * const msg, vscp_evt_information_Mouse * const evt);
+
+/**
+ * Parse the "On" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "On" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOn(vscp_RxMessage const * const msg, vscp_evt_information_On * const evt);
+
+/**
+ * Parse the "Off" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Off" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOff(vscp_RxMessage const * const msg, vscp_evt_information_Off * const evt);
+
+/**
+ * Parse the "Alive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Alive" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseAlive(vscp_RxMessage const * const msg, vscp_evt_information_Alive * const evt);
+
+/**
+ * Parse the "Terminating" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Terminating" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseTerminating(vscp_RxMessage const * const msg, vscp_evt_information_Terminating * const evt);
+
+/**
+ * Parse the "Opened" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Opened" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOpened(vscp_RxMessage const * const msg, vscp_evt_information_Opened * const evt);
+
+/**
+ * Parse the "Closed" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Closed" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseClosed(vscp_RxMessage const * const msg, vscp_evt_information_Closed * const evt);
+
+/**
+ * Parse the "Node Heartbeat" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Node Heartbeat" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseNodeHeartbeat(vscp_RxMessage const * const msg, vscp_evt_information_NodeHeartbeat * const evt);
+
+/**
+ * Parse the "Below limit" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Below limit" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseBelowLimit(vscp_RxMessage const * const msg, vscp_evt_information_BelowLimit * const evt);
+
+/**
+ * Parse the "Above limit" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Above limit" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendAboveLimit(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseAboveLimit(vscp_RxMessage const * const msg, vscp_evt_information_AboveLimit * const evt);
 
 /**
- * Pulse
+ * Parse the "Pulse" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Pulse" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendPulse(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parsePulse(vscp_RxMessage const * const msg, vscp_evt_information_Pulse * const evt);
 
 /**
- * Error
+ * Parse the "Error" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Error" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendError(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseError(vscp_RxMessage const * const msg, vscp_evt_information_Error * const evt);
 
 /**
- * Resumed
+ * Parse the "Resumed" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Resumed" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendResumed(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseResumed(vscp_RxMessage const * const msg, vscp_evt_information_Resumed * const evt);
 
 /**
- * Paused
+ * Parse the "Paused" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Paused" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendPaused(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parsePaused(vscp_RxMessage const * const msg, vscp_evt_information_Paused * const evt);
 
 /**
- * Sleeping
+ * Parse the "Sleeping" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Sleeping" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendSleeping(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseSleeping(vscp_RxMessage const * const msg, vscp_evt_information_Sleeping * const evt);
 
 /**
- * Good morning
+ * Parse the "Good morning" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Good morning" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGoodMorning(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseGoodMorning(vscp_RxMessage const * const msg, vscp_evt_information_GoodMorning * const evt);
 
 /**
- * Good day
+ * Parse the "Good day" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Good day" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGoodDay(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseGoodDay(vscp_RxMessage const * const msg, vscp_evt_information_GoodDay * const evt);
 
 /**
- * Good afternoon
+ * Parse the "Good afternoon" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Good afternoon" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGoodAfternoon(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseGoodAfternoon(vscp_RxMessage const * const msg, vscp_evt_information_GoodAfternoon * const evt);
 
 /**
- * Good evening
+ * Parse the "Good evening" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Good evening" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGoodEvening(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseGoodEvening(vscp_RxMessage const * const msg, vscp_evt_information_GoodEvening * const evt);
 
 /**
- * Good night
+ * Parse the "Good night" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Good night" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGoodNight(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseGoodNight(vscp_RxMessage const * const msg, vscp_evt_information_GoodNight * const evt);
 
 /**
- * See you soon
+ * Parse the "See you soon" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "See you soon" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendSeeYouSoon(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseSeeYouSoon(vscp_RxMessage const * const msg, vscp_evt_information_SeeYouSoon * const evt);
 
 /**
- * Goodbye
+ * Parse the "Goodbye" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Goodbye" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendGoodbye(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseGoodbye(vscp_RxMessage const * const msg, vscp_evt_information_Goodbye * const evt);
 
 /**
- * Stop
+ * Parse the "Stop" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Stop" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendStop(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseStop(vscp_RxMessage const * const msg, vscp_evt_information_Stop * const evt);
 
 /**
- * Start
+ * Parse the "Start" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Start" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendStart(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseStart(vscp_RxMessage const * const msg, vscp_evt_information_Start * const evt);
 
 /**
- * ResetCompleted
+ * Parse the "ResetCompleted" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "ResetCompleted" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendResetcompleted(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseResetcompleted(vscp_RxMessage const * const msg, vscp_evt_information_Resetcompleted * const evt);
 
 /**
- * Interrupted
+ * Parse the "Interrupted" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Interrupted" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendInterrupted(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseInterrupted(vscp_RxMessage const * const msg, vscp_evt_information_Interrupted * const evt);
 
 /**
- * PreparingToSleep
+ * Parse the "PreparingToSleep" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "PreparingToSleep" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendPreparingtosleep(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parsePreparingtosleep(vscp_RxMessage const * const msg, vscp_evt_information_Preparingtosleep * const evt);
 
 /**
- * WokenUp
+ * Parse the "WokenUp" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "WokenUp" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendWokenup(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseWokenup(vscp_RxMessage const * const msg, vscp_evt_information_Wokenup * const evt);
 
 /**
- * Dusk
+ * Parse the "Dusk" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Dusk" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDusk(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDusk(vscp_RxMessage const * const msg, vscp_evt_information_Dusk * const evt);
 
 /**
- * Dawn
+ * Parse the "Dawn" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Dawn" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDawn(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDawn(vscp_RxMessage const * const msg, vscp_evt_information_Dawn * const evt);
 
 /**
- * Active
+ * Parse the "Active" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Active" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendActive(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseActive(vscp_RxMessage const * const msg, vscp_evt_information_Active * const evt);
 
 /**
- * Inactive
+ * Parse the "Inactive" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Inactive" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendInactive(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseInactive(vscp_RxMessage const * const msg, vscp_evt_information_Inactive * const evt);
 
 /**
- * Busy
+ * Parse the "Busy" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Busy" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendBusy(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseBusy(vscp_RxMessage const * const msg, vscp_evt_information_Busy * const evt);
 
 /**
- * Idle
+ * Parse the "Idle" event.
  * 
- * @param[in] reserved Reserved for future use.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Idle" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendIdle(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseIdle(vscp_RxMessage const * const msg, vscp_evt_information_Idle * const evt);
 
 /**
- * Stream Data
+ * Parse the "Stream Data" event.
  * 
- * @param[in] sequenceNumber Sequence number which is increased by one for every new event with stream
- * data. The sequence number is increased for every frame sent going from 0 - 255 and back to 0 and so
- * on if needed. A new stream starts with a sequence number of 0.
- * @param[in] streamData Stream data. (array[7])
- * @param[in] streamDatasize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Stream Data" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendStreamData(uint8_t sequenceNumber, uint8_t const * const streamData, uint8_t streamDataSize);
+extern BOOL vscp_evt_information_parseStreamData(vscp_RxMessage const * const msg, vscp_evt_information_StreamData * const evt);
 
 /**
- * Token Activity
+ * Parse the "Token Activity" event.
  * 
- * @param[in] tokenType Bit 0,1 - Event code. Bit 2-7 - Token device type code.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] frameIndex Frame index (Increase by one for every frame sent out for one token activity.
- * Start with zero ).
- * @param[in] tokenData Token data. (array[4])
- * @param[in] tokenDatasize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Token Activity" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendTokenActivity(uint8_t tokenType, uint8_t zone, uint8_t subZone, uint8_t frameIndex, uint8_t const * const tokenData, uint8_t tokenDataSize);
+extern BOOL vscp_evt_information_parseTokenActivity(vscp_RxMessage const * const msg, vscp_evt_information_TokenActivity * const evt);
 
 /**
- * Stream Data with zone
+ * Parse the "Stream Data with zone" event.
  * 
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] sequenceNumber Sequence number which is increased by one for every new event with stream
- * data. The sequence number is increased for every frame sent going from 0 - 255 and back to 0 and so
- * on if needed. A new stream starts with a sequence number of 0.
- * @param[in] streamData Stream data. (array[4])
- * @param[in] streamDatasize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Stream Data with zone" event, it will return TRUE otherwise
+ * FALSE.
  */
-extern BOOL vscp_evt_information_sendStreamDataWithZone(uint8_t zone, uint8_t subZone, uint8_t sequenceNumber, uint8_t const * const streamData, uint8_t streamDataSize);
+extern BOOL vscp_evt_information_parseStreamDataWithZone(vscp_RxMessage const * const msg, vscp_evt_information_StreamDataWithZone * const evt);
 
 /**
- * Confirm
+ * Parse the "Confirm" event.
  * 
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] sequenceNumber Sequence number.
- * @param[in] vscpClass VSCP class.
- * @param[in] vscpType VSCP type.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Confirm" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendConfirm(uint8_t zone, uint8_t subZone, uint8_t sequenceNumber, uint16_t vscpClass, uint16_t vscpType);
+extern BOOL vscp_evt_information_parseConfirm(vscp_RxMessage const * const msg, vscp_evt_information_Confirm * const evt);
 
 /**
- * Level Changed
+ * Parse the "Level Changed" event.
  * 
- * @param[in] level Relative or absolute level.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Level Changed" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendLevelChanged(uint8_t level, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseLevelChanged(vscp_RxMessage const * const msg, vscp_evt_information_LevelChanged * const evt);
 
 /**
- * Warning
+ * Parse the "Warning" event.
  * 
- * @param[in] level Relative or absolute level.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Warning" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendWarning(uint8_t level, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseWarning(vscp_RxMessage const * const msg, vscp_evt_information_Warning * const evt);
 
 /**
- * State
+ * Parse the "State" event.
  * 
- * @param[in] userSpecific User specific value.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] from State changed from (old state).
- * @param[in] to State changed to (new state).
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "State" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendState(uint8_t userSpecific, uint8_t zone, uint8_t subZone, uint8_t from, uint8_t to);
+extern BOOL vscp_evt_information_parseState(vscp_RxMessage const * const msg, vscp_evt_information_State * const evt);
 
 /**
- * Action Trigger
+ * Parse the "Action Trigger" event.
  * 
- * @param[in] actionId Action id.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Action Trigger" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendActionTrigger(uint8_t actionId, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseActionTrigger(vscp_RxMessage const * const msg, vscp_evt_information_ActionTrigger * const evt);
 
 /**
- * Sunrise
+ * Parse the "Sunrise" event.
  * 
- * @param[in] userSpecific User specific value.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Sunrise" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendSunrise(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseSunrise(vscp_RxMessage const * const msg, vscp_evt_information_Sunrise * const evt);
 
 /**
- * Sunset
+ * Parse the "Sunset" event.
  * 
- * @param[in] userSpecific User specific value.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Sunset" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendSunset(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseSunset(vscp_RxMessage const * const msg, vscp_evt_information_Sunset * const evt);
 
 /**
- * Start of record
+ * Parse the "Start of record" event.
  * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] remainingFrames Number of frames to follow or zero for not used.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Start of record" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendStartOfRecord(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t remainingFrames);
+extern BOOL vscp_evt_information_parseStartOfRecord(vscp_RxMessage const * const msg, vscp_evt_information_StartOfRecord * const evt);
 
 /**
- * End of record
+ * Parse the "End of record" event.
  * 
- * @param[in] index Index for record.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "End of record" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendEndOfRecord(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseEndOfRecord(vscp_RxMessage const * const msg, vscp_evt_information_EndOfRecord * const evt);
 
 /**
- * Pre-set active
+ * Parse the "Pre-set active" event.
  * 
- * @param[in] user User specified.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] preSetCode Code for pre-set that has been set.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Pre-set active" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendPreSetActive(uint8_t user, uint8_t zone, uint8_t subZone, uint8_t preSetCode);
+extern BOOL vscp_evt_information_parsePreSetActive(vscp_RxMessage const * const msg, vscp_evt_information_PreSetActive * const evt);
 
 /**
- * Detect
+ * Parse the "Detect" event.
  * 
- * @param[in] index Index.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Detect" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDetect(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDetect(vscp_RxMessage const * const msg, vscp_evt_information_Detect * const evt);
 
 /**
- * Overflow
+ * Parse the "Overflow" event.
  * 
- * @param[in] index Index.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Overflow" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_information_parseOverflow(vscp_RxMessage const * const msg, vscp_evt_information_Overflow * const evt);
+
+/**
+ * Parse the "Big level changed" event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Big level changed" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendOverflow(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseBigLevelChanged(vscp_RxMessage const * const msg, vscp_evt_information_BigLevelChanged * const evt);
 
 /**
- * Big level changed
+ * Parse the "Civil sunrise twilight time" event.
  * 
- * @param[in] index Index.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] level Level as signed Integer. The range can be adjusted by the user by sending the
- * needed number of bytes 1-5. (array[5])
- * @param[in] levelsize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Civil sunrise twilight time" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendBigLevelChanged(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const level, uint8_t levelSize);
+extern BOOL vscp_evt_information_parseCivilSunriseTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_CivilSunriseTwilightTime * const evt);
 
 /**
- * Civil sunrise twilight time
+ * Parse the "Civil sunset twilight time" event.
  * 
- * @param[in] userSpecific User specific.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Civil sunset twilight time" event, it will return TRUE otherwise
+ * FALSE.
  */
-extern BOOL vscp_evt_information_sendCivilSunriseTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseCivilSunsetTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_CivilSunsetTwilightTime * const evt);
 
 /**
- * Civil sunset twilight time
+ * Parse the "Nautical sunrise twilight time" event.
  * 
- * @param[in] userSpecific User specific.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Nautical sunrise twilight time" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendCivilSunsetTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseNauticalSunriseTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_NauticalSunriseTwilightTime * const evt);
 
 /**
- * Nautical sunrise twilight time
+ * Parse the "Nautical sunset twilight time" event.
  * 
- * @param[in] userSpecific User specific.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Nautical sunset twilight time" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendNauticalSunriseTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseNauticalSunsetTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_NauticalSunsetTwilightTime * const evt);
 
 /**
- * Nautical sunset twilight time
+ * Parse the "Astronomical sunrise twilight time" event.
  * 
- * @param[in] userSpecific User specific.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Astronomical sunrise twilight time" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendNauticalSunsetTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseAstronomicalSunriseTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_AstronomicalSunriseTwilightTime * const evt);
 
 /**
- * Astronomical sunrise twilight time
+ * Parse the "Astronomical sunset twilight time" event.
  * 
- * @param[in] userSpecific User specific.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Astronomical sunset twilight time" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendAstronomicalSunriseTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseAstronomicalSunsetTwilightTime(vscp_RxMessage const * const msg, vscp_evt_information_AstronomicalSunsetTwilightTime * const evt);
 
 /**
- * Astronomical sunset twilight time
+ * Parse the "Calculated Noon" event.
  * 
- * @param[in] userSpecific User specific.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Calculated Noon" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendAstronomicalSunsetTwilightTime(uint8_t userSpecific, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseCalculatedNoon(vscp_RxMessage const * const msg, vscp_evt_information_CalculatedNoon * const evt);
 
 /**
- * Calculated Noon
+ * Parse the "Shutter up" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter up" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendCalculatedNoon(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterUp(vscp_RxMessage const * const msg, vscp_evt_information_ShutterUp * const evt);
 
 /**
- * Shutter up
+ * Parse the "Shutter down" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter down" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterUp(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterDown(vscp_RxMessage const * const msg, vscp_evt_information_ShutterDown * const evt);
 
 /**
- * Shutter down
+ * Parse the "Shutter left" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter left" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterDown(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterLeft(vscp_RxMessage const * const msg, vscp_evt_information_ShutterLeft * const evt);
 
 /**
- * Shutter left
+ * Parse the "Shutter right" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter right" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterLeft(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterRight(vscp_RxMessage const * const msg, vscp_evt_information_ShutterRight * const evt);
 
 /**
- * Shutter right
+ * Parse the "Shutter reached top end" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter reached top end" event, it will return TRUE otherwise
+ * FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterRight(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterReachedTopEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedTopEnd * const evt);
 
 /**
- * Shutter reached top end
+ * Parse the "Shutter reached bottom end" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter reached bottom end" event, it will return TRUE otherwise
+ * FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterReachedTopEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterReachedBottomEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedBottomEnd * const evt);
 
 /**
- * Shutter reached bottom end
+ * Parse the "Shutter reached middle end" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter reached middle end" event, it will return TRUE otherwise
+ * FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterReachedBottomEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterReachedMiddleEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedMiddleEnd * const evt);
 
 /**
- * Shutter reached middle end
+ * Parse the "Shutter reached preset end" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter reached preset end" event, it will return TRUE otherwise
+ * FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterReachedMiddleEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterReachedPresetEnd(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedPresetEnd * const evt);
 
 /**
- * Shutter reached preset end
+ * Parse the "Shutter reached preset left" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter reached preset left" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterReachedPresetEnd(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterReachedPresetLeft(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedPresetLeft * const evt);
 
 /**
- * Shutter reached preset left
+ * Parse the "Shutter reached preset right" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Shutter reached preset right" event, it will return TRUE
+ * otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterReachedPresetLeft(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseShutterReachedPresetRight(vscp_RxMessage const * const msg, vscp_evt_information_ShutterReachedPresetRight * const evt);
 
 /**
- * Shutter reached preset right
+ * Parse the "Long click" event.
  * 
- * @param[in] reserved Reserved.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Long click" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendShutterReachedPresetRight(uint8_t reserved, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseLongClick(vscp_RxMessage const * const msg, vscp_evt_information_LongClick * const evt);
 
 /**
- * Long click
+ * Parse the "Single click" event.
  * 
- * @param[in] index Index for device generating long click. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Single click" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendLongClick(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseSingleClick(vscp_RxMessage const * const msg, vscp_evt_information_SingleClick * const evt);
 
 /**
- * Single click
+ * Parse the "Double click" event.
  * 
- * @param[in] index Index for device generating single click. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Double click" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendSingleClick(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDoubleClick(vscp_RxMessage const * const msg, vscp_evt_information_DoubleClick * const evt);
 
 /**
- * Double click
+ * Parse the "Date" event.
  * 
- * @param[in] index Index for device generating double click. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Date" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDoubleClick(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDate(vscp_RxMessage const * const msg, vscp_evt_information_Date * const evt);
 
 /**
- * Date
+ * Parse the "Time" event.
  * 
- * @param[in] index Index for device generating date. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] yearCentury Year century.
- * @param[in] year Year.
- * @param[in] month Month (1-12).
- * @param[in] day Day.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Time" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDate(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t yearCentury, uint8_t year, uint8_t month, uint8_t day);
+extern BOOL vscp_evt_information_parseTime(vscp_RxMessage const * const msg, vscp_evt_information_Time * const evt);
 
 /**
- * Time
+ * Parse the "Weekday" event.
  * 
- * @param[in] index Index for device generating time. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] hour Hour (0-23).
- * @param[in] minutes Minutes (0-59).
- * @param[in] seconds Seconds (0-59).
- * @param[in] milliseconds Milliseconds (0-999).
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Weekday" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t hour, uint8_t minutes, uint8_t seconds, uint16_t milliseconds);
+extern BOOL vscp_evt_information_parseWeekday(vscp_RxMessage const * const msg, vscp_evt_information_Weekday * const evt);
 
 /**
- * Weekday
+ * Parse the "Lock" event.
  * 
- * @param[in] index Index for device generating weekday info. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] weekday Weekday ( 0 (Monday) - 6 (Sunday)).
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Lock" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendWeekday(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t weekday);
+extern BOOL vscp_evt_information_parseLock(vscp_RxMessage const * const msg, vscp_evt_information_Lock * const evt);
 
 /**
- * Lock
+ * Parse the "Unlock" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Unlock" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendLock(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseUnlock(vscp_RxMessage const * const msg, vscp_evt_information_Unlock * const evt);
 
 /**
- * Unlock
+ * Parse the "DateTime" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "DateTime" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendUnlock(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDatetime(vscp_RxMessage const * const msg, vscp_evt_information_Datetime * const evt);
 
 /**
- * DateTime
+ * Parse the "Rising" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dateTime Date/time in five byte bit array. (array[5])
- * @param[in] dateTimesize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Rising" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDatetime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t const * const dateTime, uint8_t dateTimeSize);
+extern BOOL vscp_evt_information_parseRising(vscp_RxMessage const * const msg, vscp_evt_information_Rising * const evt);
 
 /**
- * Rising
+ * Parse the "Falling" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Falling" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendRising(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseFalling(vscp_RxMessage const * const msg, vscp_evt_information_Falling * const evt);
 
 /**
- * Falling
+ * Parse the "Updated" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Updated" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendFalling(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseUpdated(vscp_RxMessage const * const msg, vscp_evt_information_Updated * const evt);
 
 /**
- * Updated
+ * Parse the "Connect" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Connect" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendUpdated(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseConnect(vscp_RxMessage const * const msg, vscp_evt_information_Connect * const evt);
 
 /**
- * Connect
+ * Parse the "Disconnect" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Disconnect" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendConnect(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseDisconnect(vscp_RxMessage const * const msg, vscp_evt_information_Disconnect * const evt);
 
 /**
- * Disconnect
+ * Parse the "Reconnect" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Reconnect" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDisconnect(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseReconnect(vscp_RxMessage const * const msg, vscp_evt_information_Reconnect * const evt);
 
 /**
- * Reconnect
+ * Parse the "Enter" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Enter" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendReconnect(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseEnter(vscp_RxMessage const * const msg, vscp_evt_information_Enter * const evt);
 
 /**
- * Enter
+ * Parse the "Exit" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Exit" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendEnter(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseExit(vscp_RxMessage const * const msg, vscp_evt_information_Exit * const evt);
 
 /**
- * Exit
+ * Parse the "Incremented" event.
  * 
- * @param[in] index Index for device. Set to zero if not used.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Incremented" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendExit(uint8_t index, uint8_t zone, uint8_t subZone);
+extern BOOL vscp_evt_information_parseIncremented(vscp_RxMessage const * const msg, vscp_evt_information_Incremented * const evt);
 
 /**
- * Incremented
+ * Parse the "Decremented" event.
  * 
- * @param[in] userSpecific Optional byte that have a meaning given by the issuer of the event.
- * Prefered use is _index_ for compability.
- * @param[in] zone Zone for which event applies to (0-255). 255 is all zones
- * @param[in] subzone Sub-zone for which event applies to (0-255). 255 is all sub-zones
- * @param[in] incrementedValue Incremented value. The range can be adjusted by the user by sending
- * just the needed number of bytes 1-5 (optional) (array[5])
- * @param[in] incrementedValuesize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Decremented" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendIncremented(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint8_t const * const incrementedValue, uint8_t incrementedValueSize);
+extern BOOL vscp_evt_information_parseDecremented(vscp_RxMessage const * const msg, vscp_evt_information_Decremented * const evt);
 
 /**
- * Decremented
+ * Parse the "Proximity detected" event.
  * 
- * @param[in] userSpecific Optional byte that have a meaning given by the issuer of the event.
- * Prefered use is _index_ for compability.
- * @param[in] zone Zone for which event applies to (0-255). 255 is all zones
- * @param[in] subzone Sub-zone for which event applies to (0-255). 255 is all sub-zones
- * @param[in] decrementedValue Decremented value. The range can be adjusted by the user by sending
- * just the needed number of bytes 1-5 (optional) (array[5])
- * @param[in] decrementedValuesize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Proximity detected" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendDecremented(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint8_t const * const decrementedValue, uint8_t decrementedValueSize);
+extern BOOL vscp_evt_information_parseProximityDetected(vscp_RxMessage const * const msg, vscp_evt_information_ProximityDetected * const evt);
 
 /**
- * Proximity detected
+ * Parse a received event of the "Information" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
  * 
- * @param[in] userSpecific Optional byte that have a meaning given by the issuer of the event.
- * Prefered use is _index_ for compability.
- * @param[in] zone Zone for which event applies to (0-255). 255 is all zones
- * @param[in] subzone Sub-zone for which event applies to (0-255). 255 is all sub-zones
- * @param[in] proximityLevel Optional uint16 that sets proximity level if present. (optional)
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_information_sendProximityDetected(uint8_t userSpecific, uint8_t zone, uint8_t subzone, uint16_t const * const proximityLevel);
+extern BOOL vscp_evt_information_parse(vscp_RxMessage const * const msg, vscp_evt_information_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_ir.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -273,3 +274,226 @@ extern BOOL vscp_evt_ir_sendMapitoRemoteFormat(uint8_t repeat, uint8_t zone, uin
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "RC5 Send/Receive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "RC5 Send/Receive" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parseRc5SendReceive(vscp_RxMessage const * const msg, vscp_evt_ir_Rc5SendReceive * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_IR != msg->vscpClass) || (VSCP_TYPE_REMOTE_RC5 != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->code = msg->data[0];
+
+    evt->adress = msg->data[1];
+
+    evt->repeat = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "SONY 12-bit Send/Receive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "SONY 12-bit Send/Receive" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_ir_parseSony12BitSendReceive(vscp_RxMessage const * const msg, vscp_evt_ir_Sony12BitSendReceive * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_IR != msg->vscpClass) || (VSCP_TYPE_REMOTE_SONY12 != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->code = msg->data[0];
+
+    evt->adress = msg->data[1];
+
+    evt->repeat = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "LIRC (Linux Infrared Remote Control)" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "LIRC (Linux Infrared Remote Control)" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parseLircLinuxInfraredRemoteControl(vscp_RxMessage const * const msg, vscp_evt_ir_LircLinuxInfraredRemoteControl * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_IR != msg->vscpClass) || (VSCP_TYPE_REMOTE_LIRC != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->code6 = msg->data[0];
+
+    evt->code5 = msg->data[1];
+
+    evt->code4 = msg->data[2];
+
+    evt->code3 = msg->data[3];
+
+    evt->code2 = msg->data[4];
+
+    evt->code1 = msg->data[5];
+
+    evt->code0 = msg->data[6];
+
+    evt->repeat = msg->data[7];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "VSCP Abstract Remote Format" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "VSCP Abstract Remote Format" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parseVscpAbstractRemoteFormat(vscp_RxMessage const * const msg, vscp_evt_ir_VscpAbstractRemoteFormat * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_IR != msg->vscpClass) || (VSCP_TYPE_REMOTE_VSCP != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->code = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    evt->zone = msg->data[2];
+
+    evt->subZone = msg->data[3];
+
+    evt->repeat = msg->data[4];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "MAPito Remote Format" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "MAPito Remote Format" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_ir_parseMapitoRemoteFormat(vscp_RxMessage const * const msg, vscp_evt_ir_MapitoRemoteFormat * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_IR != msg->vscpClass) || (VSCP_TYPE_REMOTE_MAPITO != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->repeat = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->address = VSCP_UTIL_READ_UINT32_BE(&msg->data[3]);
+
+    evt->keyCode = msg->data[7];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "IR Remote I/f" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parse(vscp_RxMessage const * const msg, vscp_evt_ir_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_IR != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_REMOTE_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_REMOTE_RC5:
+        status = vscp_evt_ir_parseRc5SendReceive(msg, &evt->data.rc5SendReceive);
+        break;
+
+    case VSCP_TYPE_REMOTE_SONY12:
+        status = vscp_evt_ir_parseSony12BitSendReceive(msg, &evt->data.sony12BitSendReceive);
+        break;
+
+    case VSCP_TYPE_REMOTE_LIRC:
+        status = vscp_evt_ir_parseLircLinuxInfraredRemoteControl(msg, &evt->data.lircLinuxInfraredRemoteControl);
+        break;
+
+    case VSCP_TYPE_REMOTE_VSCP:
+        status = vscp_evt_ir_parseVscpAbstractRemoteFormat(msg, &evt->data.vscpAbstractRemoteFormat);
+        break;
+
+    case VSCP_TYPE_REMOTE_MAPITO:
+        status = vscp_evt_ir_parseMapitoRemoteFormat(msg, &evt->data.mapitoRemoteFormat);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
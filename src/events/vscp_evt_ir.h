@@ -47,6 +47,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,76 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "RC5 Send/Receive" event. */
+typedef struct
+{
+    uint8_t code; /**< Code */
+    uint8_t adress; /**< Adress */
+    uint8_t repeat; /**< Repeat */
+
+} vscp_evt_ir_Rc5SendReceive;
+
+/** Parameters of the "SONY 12-bit Send/Receive" event. */
+typedef struct
+{
+    uint8_t code; /**< Code */
+    uint8_t adress; /**< Adress */
+    uint8_t repeat; /**< Repeat */
+
+} vscp_evt_ir_Sony12BitSendReceive;
+
+/** Parameters of the "LIRC (Linux Infrared Remote Control)" event. */
+typedef struct
+{
+    uint8_t code6; /**< Code6 */
+    uint8_t code5; /**< Code5 */
+    uint8_t code4; /**< Code4 */
+    uint8_t code3; /**< Code3 */
+    uint8_t code2; /**< Code2 */
+    uint8_t code1; /**< Code1 */
+    uint8_t code0; /**< Code0 */
+    uint8_t repeat; /**< Repeat */
+
+} vscp_evt_ir_LircLinuxInfraredRemoteControl;
+
+/** Parameters of the "VSCP Abstract Remote Format" event. */
+typedef struct
+{
+    uint16_t code; /**< Code */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t repeat; /**< Repeat */
+
+} vscp_evt_ir_VscpAbstractRemoteFormat;
+
+/** Parameters of the "MAPito Remote Format" event. */
+typedef struct
+{
+    uint8_t repeat; /**< Repeat */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint32_t address; /**< Address */
+    uint8_t keyCode; /**< Key-code */
+
+} vscp_evt_ir_MapitoRemoteFormat;
+
+/** Parsed event of the "IR Remote I/f" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_ir_Rc5SendReceive rc5SendReceive; /**< Parameters of the "RC5 Send/Receive" event */
+        vscp_evt_ir_Sony12BitSendReceive sony12BitSendReceive; /**< Parameters of the "SONY 12-bit Send/Receive" event */
+        vscp_evt_ir_LircLinuxInfraredRemoteControl lircLinuxInfraredRemoteControl; /**< Parameters of the "LIRC (Linux Infrared Remote Control)" event */
+        vscp_evt_ir_VscpAbstractRemoteFormat vscpAbstractRemoteFormat; /**< Parameters of the "VSCP Abstract Remote Format" event */
+        vscp_evt_ir_MapitoRemoteFormat mapitoRemoteFormat; /**< Parameters of the "MAPito Remote Format" event */
+    } data;
+
+} vscp_evt_ir_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -147,6 +218,71 @@ extern BOOL vscp_evt_ir_sendVscpAbstractRemoteFormat(uint16_t code, uint8_t zone
  */
 extern BOOL vscp_evt_ir_sendMapitoRemoteFormat(uint8_t repeat, uint8_t zone, uint8_t subZone, uint32_t address, uint8_t keyCode);
 
+/**
+ * Parse the "RC5 Send/Receive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "RC5 Send/Receive" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parseRc5SendReceive(vscp_RxMessage const * const msg, vscp_evt_ir_Rc5SendReceive * const evt);
+
+/**
+ * Parse the "SONY 12-bit Send/Receive" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "SONY 12-bit Send/Receive" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_ir_parseSony12BitSendReceive(vscp_RxMessage const * const msg, vscp_evt_ir_Sony12BitSendReceive * const evt);
+
+/**
+ * Parse the "LIRC (Linux Infrared Remote Control)" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "LIRC (Linux Infrared Remote Control)" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parseLircLinuxInfraredRemoteControl(vscp_RxMessage const * const msg, vscp_evt_ir_LircLinuxInfraredRemoteControl * const evt);
+
+/**
+ * Parse the "VSCP Abstract Remote Format" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "VSCP Abstract Remote Format" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parseVscpAbstractRemoteFormat(vscp_RxMessage const * const msg, vscp_evt_ir_VscpAbstractRemoteFormat * const evt);
+
+/**
+ * Parse the "MAPito Remote Format" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "MAPito Remote Format" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_ir_parseMapitoRemoteFormat(vscp_RxMessage const * const msg, vscp_evt_ir_MapitoRemoteFormat * const evt);
+
+/**
+ * Parse a received event of the "IR Remote I/f" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_ir_parse(vscp_RxMessage const * const msg, vscp_evt_ir_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_log.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -202,3 +203,169 @@ extern BOOL vscp_evt_log_sendLogLevel(uint8_t level)
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Log event" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log event" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogEvent(vscp_RxMessage const * const msg, vscp_evt_log_LogEvent * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_LOG != msg->vscpClass) || (VSCP_TYPE_LOG_MESSAGE != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->id = msg->data[0];
+
+    evt->logLevel = msg->data[1];
+
+    evt->index = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->msg[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->msgSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Log Start" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log Start" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogStart(vscp_RxMessage const * const msg, vscp_evt_log_LogStart * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_LOG != msg->vscpClass) || (VSCP_TYPE_LOG_START != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->id = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Log Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogStop(vscp_RxMessage const * const msg, vscp_evt_log_LogStop * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_LOG != msg->vscpClass) || (VSCP_TYPE_LOG_STOP != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->id = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Log Level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log Level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogLevel(vscp_RxMessage const * const msg, vscp_evt_log_LogLevel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_LOG != msg->vscpClass) || (VSCP_TYPE_LOG_LEVEL != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->level = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Logging" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parse(vscp_RxMessage const * const msg, vscp_evt_log_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_LOG != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_LOG_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_LOG_MESSAGE:
+        status = vscp_evt_log_parseLogEvent(msg, &evt->data.logEvent);
+        break;
+
+    case VSCP_TYPE_LOG_START:
+        status = vscp_evt_log_parseLogStart(msg, &evt->data.logStart);
+        break;
+
+    case VSCP_TYPE_LOG_STOP:
+        status = vscp_evt_log_parseLogStop(msg, &evt->data.logStop);
+        break;
+
+    case VSCP_TYPE_LOG_LEVEL:
+        status = vscp_evt_log_parseLogLevel(msg, &evt->data.logLevel);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
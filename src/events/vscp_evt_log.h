@@ -47,6 +47,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,54 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Log event" event. */
+typedef struct
+{
+    uint8_t id; /**< Id */
+    uint8_t logLevel; /**< Log level */
+    uint8_t index; /**< Index */
+    uint8_t msg[5]; /**< Msg */
+    uint8_t msgSize; /**< Msg size */
+
+} vscp_evt_log_LogEvent;
+
+/** Parameters of the "Log Start" event. */
+typedef struct
+{
+    uint8_t id; /**< Id */
+
+} vscp_evt_log_LogStart;
+
+/** Parameters of the "Log Stop" event. */
+typedef struct
+{
+    uint8_t id; /**< Id */
+
+} vscp_evt_log_LogStop;
+
+/** Parameters of the "Log Level" event. */
+typedef struct
+{
+    uint8_t level; /**< Level */
+
+} vscp_evt_log_LogLevel;
+
+/** Parsed event of the "Logging" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_log_LogEvent logEvent; /**< Parameters of the "Log event" event */
+        vscp_evt_log_LogStart logStart; /**< Parameters of the "Log Start" event */
+        vscp_evt_log_LogStop logStop; /**< Parameters of the "Log Stop" event */
+        vscp_evt_log_LogLevel logLevel; /**< Parameters of the "Log Level" event */
+    } data;
+
+} vscp_evt_log_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -124,6 +173,57 @@ extern BOOL vscp_evt_log_sendLogStop(uint8_t id);
  */
 extern BOOL vscp_evt_log_sendLogLevel(uint8_t level);
 
+/**
+ * Parse the "Log event" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log event" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogEvent(vscp_RxMessage const * const msg, vscp_evt_log_LogEvent * const evt);
+
+/**
+ * Parse the "Log Start" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log Start" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogStart(vscp_RxMessage const * const msg, vscp_evt_log_LogStart * const evt);
+
+/**
+ * Parse the "Log Stop" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log Stop" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogStop(vscp_RxMessage const * const msg, vscp_evt_log_LogStop * const evt);
+
+/**
+ * Parse the "Log Level" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Log Level" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parseLogLevel(vscp_RxMessage const * const msg, vscp_evt_log_LogLevel * const evt);
+
+/**
+ * Parse a received event of the "Logging" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_log_parse(vscp_RxMessage const * const msg, vscp_evt_log_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
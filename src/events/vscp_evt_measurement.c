@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_measurement.h"
+#include "vscp_util.h"
 #include "vscp_data_coding.h"
 
 /*******************************************************************************
@@ -73,1420 +74,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Count
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendCount(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_COUNT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Length/Distance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendLengthDistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Mass
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendMass(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MASS, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Time
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendTime(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TIME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric Current
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricCurrent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Temperature
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendTemperature(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Amount of substance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendAmountOfSubstance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Intensity (Intensity of light)
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Frequency
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendFrequency(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FREQUENCY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radioactivity and other random events
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIOACTIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Force
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendForce(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FORCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pressure
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Energy
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendPower(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Charge
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricalCharge(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Potential (Voltage)
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricalPotentialVoltage(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Capacitance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricalCapacitance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Resistance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricalResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Conductance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricalConductance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Field Strength
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendMagneticFieldStrength(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendMagneticFlux(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux Density
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendMagneticFluxDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Inductance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendInductance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_INDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Flux
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendLuminousFlux(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Illuminance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendIlluminance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ILLUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (absorbed)
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRadiationDoseAbsorbed(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Catalytic activity
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendCatalyticActivity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Volume
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendVolume(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_VOLUME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound intensity
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSoundIntensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Angle, direction or similar
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendAngleDirectionOrSimilar(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ANGLE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Position WGS 84
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendPositionWgs84(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_POSITION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Speed
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSpeed(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SPEED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Acceleration
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendAcceleration(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ACCELERATION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Tension
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendTension(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TENSION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Damp/moist (Hygrometer reading)
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendDampMoistHygrometerReading(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_HUMIDITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Flow
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendFlow(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FLOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Thermal resistance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendThermalResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Refractive (optical) power
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRefractiveOpticalPower(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Dynamic viscosity
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendDynamicViscosity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound impedance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSoundImpedance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound resistance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSoundResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric elastance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendElectricElastance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous energy
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendLuminousEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendLuminance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Chemical (molar) concentration
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendChemicalMolarConcentration(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Chemical (mass) concentration" not supported. No frame defined. */
-
-/**
- * Reserved
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendReserved(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RESERVED47, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Reserved" not supported. No frame defined. */
-
-/**
- * Dew Point
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendDewPoint(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DEWPOINT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Relative Level
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRelativeLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Altitude
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendAltitude(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ALTITUDE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Area
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendArea(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_AREA, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiant intensity
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRadiantIntensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRadiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Irradiance, Exitance, Radiosity
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Spectral radiance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSpectralRadiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Spectral irradiance
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSpectralIrradiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound pressure (acoustic pressure)
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSoundPressureAcousticPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound energy density
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound level
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (equivalent)
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -1494,11 +84,11 @@ extern BOOL vscp_evt_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadiationDoseEquivalent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_measurement_sendByType(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp)
 {
     vscp_TxMessage  txMsg;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DOSE_EQUIVALENT, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.dataSize = 1;
     txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
@@ -1509,32 +99,11 @@ extern BOOL vscp_evt_measurement_sendRadiationDoseEquivalent(uint8_t index, uint
 }
 
 /**
- * Radiation dose (exposure)
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * Generic sender for all types, which share the same frame layout.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendRadiationDoseExposure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power factor
+ * The data is sent in the most compact data coding representation.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -1542,65 +111,157 @@ extern BOOL vscp_evt_measurement_sendRadiationDoseExposure(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendPowerFactor(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_measurement_sendByTypeCompact(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp)
 {
     vscp_TxMessage  txMsg;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_POWER_FACTOR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, vscpType, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
+    txMsg.dataSize = vscp_data_coding_encodeCompact(data, exp, unit, index, &txMsg.data[0], VSCP_L1_DATA_SIZE);
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Reactive Power
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendReactivePower(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+extern BOOL vscp_evt_measurement_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_REACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Reactive Energy
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendReactiveEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 1;
-    txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, unit, index);
-
-    txMsg.dataSize += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataSize);
-
-    return vscp_core_sendEvent(&txMsg);
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurement_Common * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_MEASUREMENT != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    return vscp_data_coding_decode(&msg->data[0], msg->dataSize, evt);
+}
+
+/**
+ * Parse a received event of the "Measurement" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement_parse(vscp_RxMessage const * const msg, vscp_evt_measurement_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_MEASUREMENT != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_MEASUREMENT_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_MEASUREMENT_COUNT:
+    case VSCP_TYPE_MEASUREMENT_LENGTH:
+    case VSCP_TYPE_MEASUREMENT_MASS:
+    case VSCP_TYPE_MEASUREMENT_TIME:
+    case VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT:
+    case VSCP_TYPE_MEASUREMENT_TEMPERATURE:
+    case VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE:
+    case VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT:
+    case VSCP_TYPE_MEASUREMENT_FREQUENCY:
+    case VSCP_TYPE_MEASUREMENT_RADIOACTIVITY:
+    case VSCP_TYPE_MEASUREMENT_FORCE:
+    case VSCP_TYPE_MEASUREMENT_PRESSURE:
+    case VSCP_TYPE_MEASUREMENT_ENERGY:
+    case VSCP_TYPE_MEASUREMENT_POWER:
+    case VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE:
+    case VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL:
+    case VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE:
+    case VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE:
+    case VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH:
+    case VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX:
+    case VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY:
+    case VSCP_TYPE_MEASUREMENT_INDUCTANCE:
+    case VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT:
+    case VSCP_TYPE_MEASUREMENT_ILLUMINANCE:
+    case VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED:
+    case VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY:
+    case VSCP_TYPE_MEASUREMENT_VOLUME:
+    case VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY:
+    case VSCP_TYPE_MEASUREMENT_ANGLE:
+    case VSCP_TYPE_MEASUREMENT_POSITION:
+    case VSCP_TYPE_MEASUREMENT_SPEED:
+    case VSCP_TYPE_MEASUREMENT_ACCELERATION:
+    case VSCP_TYPE_MEASUREMENT_TENSION:
+    case VSCP_TYPE_MEASUREMENT_HUMIDITY:
+    case VSCP_TYPE_MEASUREMENT_FLOW:
+    case VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER:
+    case VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY:
+    case VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE:
+    case VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE:
+    case VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY:
+    case VSCP_TYPE_MEASUREMENT_LUMINANCE:
+    case VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR:
+    case VSCP_TYPE_MEASUREMENT_RESERVED47:
+    case VSCP_TYPE_MEASUREMENT_DEWPOINT:
+    case VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL:
+    case VSCP_TYPE_MEASUREMENT_ALTITUDE:
+    case VSCP_TYPE_MEASUREMENT_AREA:
+    case VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY:
+    case VSCP_TYPE_MEASUREMENT_RADIANCE:
+    case VSCP_TYPE_MEASUREMENT_IRRADIANCE:
+    case VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE:
+    case VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE:
+    case VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE:
+    case VSCP_TYPE_MEASUREMENT_SOUND_DENSITY:
+    case VSCP_TYPE_MEASUREMENT_SOUND_LEVEL:
+    case VSCP_TYPE_MEASUREMENT_DOSE_EQUIVALENT:
+    case VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE:
+    case VSCP_TYPE_MEASUREMENT_POWER_FACTOR:
+    case VSCP_TYPE_MEASUREMENT_REACTIVE_POWER:
+    case VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY:
+        status = vscp_evt_measurement_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
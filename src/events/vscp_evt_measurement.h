@@ -49,6 +49,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_data_coding.h"
+#include "vscp_type_measurement.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -71,6 +74,22 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef vscp_data_coding_Value vscp_evt_measurement_Common;
+
+/** Parsed event of the "Measurement" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_measurement_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_measurement_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -80,15 +99,9 @@ extern "C"
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement_sendGeneralEvent(void);
-
-/**
- * Count
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -96,11 +109,14 @@ extern BOOL vscp_evt_measurement_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendCount(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+extern BOOL vscp_evt_measurement_sendByType(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp);
 
 /**
- * Length/Distance
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -108,22 +124,17 @@ extern BOOL vscp_evt_measurement_sendCount(uint8_t index, uint8_t unit, int32_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendLengthDistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+extern BOOL vscp_evt_measurement_sendByTypeCompact(uint8_t vscpType, uint8_t index, uint8_t unit, int32_t data, int8_t exp);
 
 /**
- * Mass
- * 
- * @param[in] index Index for sensor.
- * @param[in] unit The unit of the data.
- * @param[in] data The data as signed integer.
- * @param[in] exp The exponent of the data (10^exponent).
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendMass(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+extern BOOL vscp_evt_measurement_sendGeneralEvent(void);
 
 /**
- * Time
+ * Count
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -132,10 +143,15 @@ extern BOOL vscp_evt_measurement_sendMass(uint8_t index, uint8_t unit, int32_t d
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendTime(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendCount(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_COUNT, index, unit, data, exp);
+}
 
 /**
- * Electric Current
+ * Count
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -144,10 +160,13 @@ extern BOOL vscp_evt_measurement_sendTime(uint8_t index, uint8_t unit, int32_t d
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricCurrent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendCountCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_COUNT, index, unit, data, exp);
+}
 
 /**
- * Temperature
+ * Length/Distance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -156,10 +175,15 @@ extern BOOL vscp_evt_measurement_sendElectricCurrent(uint8_t index, uint8_t unit
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendTemperature(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendLengthDistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_LENGTH, index, unit, data, exp);
+}
 
 /**
- * Amount of substance
+ * Length/Distance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -168,10 +192,13 @@ extern BOOL vscp_evt_measurement_sendTemperature(uint8_t index, uint8_t unit, in
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendAmountOfSubstance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendLengthDistanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_LENGTH, index, unit, data, exp);
+}
 
 /**
- * Luminous Intensity (Intensity of light)
+ * Mass
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -180,10 +207,15 @@ extern BOOL vscp_evt_measurement_sendAmountOfSubstance(uint8_t index, uint8_t un
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendMass(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_MASS, index, unit, data, exp);
+}
 
 /**
- * Frequency
+ * Mass
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -192,10 +224,13 @@ extern BOOL vscp_evt_measurement_sendLuminousIntensityIntensityOfLight(uint8_t i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendFrequency(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendMassCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_MASS, index, unit, data, exp);
+}
 
 /**
- * Radioactivity and other random events
+ * Time
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -204,10 +239,15 @@ extern BOOL vscp_evt_measurement_sendFrequency(uint8_t index, uint8_t unit, int3
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendTime(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_TIME, index, unit, data, exp);
+}
 
 /**
- * Force
+ * Time
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -216,10 +256,13 @@ extern BOOL vscp_evt_measurement_sendRadioactivityAndOtherRandomEvents(uint8_t i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendForce(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendTimeCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_TIME, index, unit, data, exp);
+}
 
 /**
- * Pressure
+ * Electric Current
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -228,10 +271,15 @@ extern BOOL vscp_evt_measurement_sendForce(uint8_t index, uint8_t unit, int32_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricCurrent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT, index, unit, data, exp);
+}
 
 /**
- * Energy
+ * Electric Current
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -240,10 +288,13 @@ extern BOOL vscp_evt_measurement_sendPressure(uint8_t index, uint8_t unit, int32
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricCurrentCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT, index, unit, data, exp);
+}
 
 /**
- * Power
+ * Temperature
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -252,10 +303,15 @@ extern BOOL vscp_evt_measurement_sendEnergy(uint8_t index, uint8_t unit, int32_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendPower(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendTemperature(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_TEMPERATURE, index, unit, data, exp);
+}
 
 /**
- * Electrical Charge
+ * Temperature
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -264,10 +320,13 @@ extern BOOL vscp_evt_measurement_sendPower(uint8_t index, uint8_t unit, int32_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricalCharge(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendTemperatureCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_TEMPERATURE, index, unit, data, exp);
+}
 
 /**
- * Electrical Potential (Voltage)
+ * Amount of substance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -276,10 +335,15 @@ extern BOOL vscp_evt_measurement_sendElectricalCharge(uint8_t index, uint8_t uni
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricalPotentialVoltage(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendAmountOfSubstance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE, index, unit, data, exp);
+}
 
 /**
- * Electrical Capacitance
+ * Amount of substance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -288,10 +352,13 @@ extern BOOL vscp_evt_measurement_sendElectricalPotentialVoltage(uint8_t index, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricalCapacitance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendAmountOfSubstanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE, index, unit, data, exp);
+}
 
 /**
- * Electrical Resistance
+ * Luminous Intensity (Intensity of light)
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -300,10 +367,15 @@ extern BOOL vscp_evt_measurement_sendElectricalCapacitance(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricalResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT, index, unit, data, exp);
+}
 
 /**
- * Electrical Conductance
+ * Luminous Intensity (Intensity of light)
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -312,10 +384,13 @@ extern BOOL vscp_evt_measurement_sendElectricalResistance(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricalConductance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendLuminousIntensityIntensityOfLightCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT, index, unit, data, exp);
+}
 
 /**
- * Magnetic Field Strength
+ * Frequency
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -324,10 +399,15 @@ extern BOOL vscp_evt_measurement_sendElectricalConductance(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendMagneticFieldStrength(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendFrequency(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_FREQUENCY, index, unit, data, exp);
+}
 
 /**
- * Magnetic Flux
+ * Frequency
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -336,10 +416,13 @@ extern BOOL vscp_evt_measurement_sendMagneticFieldStrength(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendMagneticFlux(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendFrequencyCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_FREQUENCY, index, unit, data, exp);
+}
 
 /**
- * Magnetic Flux Density
+ * Radioactivity and other random events
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -348,10 +431,15 @@ extern BOOL vscp_evt_measurement_sendMagneticFlux(uint8_t index, uint8_t unit, i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendMagneticFluxDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RADIOACTIVITY, index, unit, data, exp);
+}
 
 /**
- * Inductance
+ * Radioactivity and other random events
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -360,10 +448,13 @@ extern BOOL vscp_evt_measurement_sendMagneticFluxDensity(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendInductance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendRadioactivityAndOtherRandomEventsCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RADIOACTIVITY, index, unit, data, exp);
+}
 
 /**
- * Luminous Flux
+ * Force
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -372,10 +463,15 @@ extern BOOL vscp_evt_measurement_sendInductance(uint8_t index, uint8_t unit, int
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendLuminousFlux(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendForce(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_FORCE, index, unit, data, exp);
+}
 
 /**
- * Illuminance
+ * Force
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -384,10 +480,13 @@ extern BOOL vscp_evt_measurement_sendLuminousFlux(uint8_t index, uint8_t unit, i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendIlluminance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendForceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_FORCE, index, unit, data, exp);
+}
 
 /**
- * Radiation dose (absorbed)
+ * Pressure
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -396,10 +495,15 @@ extern BOOL vscp_evt_measurement_sendIlluminance(uint8_t index, uint8_t unit, in
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadiationDoseAbsorbed(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_PRESSURE, index, unit, data, exp);
+}
 
 /**
- * Catalytic activity
+ * Pressure
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -408,10 +512,13 @@ extern BOOL vscp_evt_measurement_sendRadiationDoseAbsorbed(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendCatalyticActivity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendPressureCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_PRESSURE, index, unit, data, exp);
+}
 
 /**
- * Volume
+ * Energy
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -420,10 +527,15 @@ extern BOOL vscp_evt_measurement_sendCatalyticActivity(uint8_t index, uint8_t un
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendVolume(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ENERGY, index, unit, data, exp);
+}
 
 /**
- * Sound intensity
+ * Energy
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -432,10 +544,13 @@ extern BOOL vscp_evt_measurement_sendVolume(uint8_t index, uint8_t unit, int32_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSoundIntensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendEnergyCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ENERGY, index, unit, data, exp);
+}
 
 /**
- * Angle, direction or similar
+ * Power
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -444,10 +559,15 @@ extern BOOL vscp_evt_measurement_sendSoundIntensity(uint8_t index, uint8_t unit,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendAngleDirectionOrSimilar(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendPower(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_POWER, index, unit, data, exp);
+}
 
 /**
- * Position WGS 84
+ * Power
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -456,10 +576,13 @@ extern BOOL vscp_evt_measurement_sendAngleDirectionOrSimilar(uint8_t index, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendPositionWgs84(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendPowerCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_POWER, index, unit, data, exp);
+}
 
 /**
- * Speed
+ * Electrical Charge
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -468,10 +591,15 @@ extern BOOL vscp_evt_measurement_sendPositionWgs84(uint8_t index, uint8_t unit,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSpeed(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalCharge(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE, index, unit, data, exp);
+}
 
 /**
- * Acceleration
+ * Electrical Charge
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -480,10 +608,13 @@ extern BOOL vscp_evt_measurement_sendSpeed(uint8_t index, uint8_t unit, int32_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendAcceleration(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalChargeCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE, index, unit, data, exp);
+}
 
 /**
- * Tension
+ * Electrical Potential (Voltage)
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -492,10 +623,15 @@ extern BOOL vscp_evt_measurement_sendAcceleration(uint8_t index, uint8_t unit, i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendTension(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalPotentialVoltage(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL, index, unit, data, exp);
+}
 
 /**
- * Damp/moist (Hygrometer reading)
+ * Electrical Potential (Voltage)
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -504,10 +640,13 @@ extern BOOL vscp_evt_measurement_sendTension(uint8_t index, uint8_t unit, int32_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendDampMoistHygrometerReading(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalPotentialVoltageCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL, index, unit, data, exp);
+}
 
 /**
- * Flow
+ * Electrical Capacitance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -516,10 +655,15 @@ extern BOOL vscp_evt_measurement_sendDampMoistHygrometerReading(uint8_t index, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendFlow(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalCapacitance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE, index, unit, data, exp);
+}
 
 /**
- * Thermal resistance
+ * Electrical Capacitance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -528,10 +672,13 @@ extern BOOL vscp_evt_measurement_sendFlow(uint8_t index, uint8_t unit, int32_t d
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendThermalResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalCapacitanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE, index, unit, data, exp);
+}
 
 /**
- * Refractive (optical) power
+ * Electrical Resistance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -540,10 +687,15 @@ extern BOOL vscp_evt_measurement_sendThermalResistance(uint8_t index, uint8_t un
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRefractiveOpticalPower(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE, index, unit, data, exp);
+}
 
 /**
- * Dynamic viscosity
+ * Electrical Resistance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -552,10 +704,13 @@ extern BOOL vscp_evt_measurement_sendRefractiveOpticalPower(uint8_t index, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendDynamicViscosity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalResistanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE, index, unit, data, exp);
+}
 
 /**
- * Sound impedance
+ * Electrical Conductance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -564,10 +719,15 @@ extern BOOL vscp_evt_measurement_sendDynamicViscosity(uint8_t index, uint8_t uni
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSoundImpedance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalConductance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE, index, unit, data, exp);
+}
 
 /**
- * Sound resistance
+ * Electrical Conductance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -576,10 +736,13 @@ extern BOOL vscp_evt_measurement_sendSoundImpedance(uint8_t index, uint8_t unit,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSoundResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendElectricalConductanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE, index, unit, data, exp);
+}
 
 /**
- * Electric elastance
+ * Magnetic Field Strength
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -588,10 +751,15 @@ extern BOOL vscp_evt_measurement_sendSoundResistance(uint8_t index, uint8_t unit
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendElectricElastance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendMagneticFieldStrength(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH, index, unit, data, exp);
+}
 
 /**
- * Luminous energy
+ * Magnetic Field Strength
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -600,10 +768,13 @@ extern BOOL vscp_evt_measurement_sendElectricElastance(uint8_t index, uint8_t un
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendLuminousEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendMagneticFieldStrengthCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH, index, unit, data, exp);
+}
 
 /**
- * Luminance
+ * Magnetic Flux
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -612,10 +783,15 @@ extern BOOL vscp_evt_measurement_sendLuminousEnergy(uint8_t index, uint8_t unit,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendLuminance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendMagneticFlux(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX, index, unit, data, exp);
+}
 
 /**
- * Chemical (molar) concentration
+ * Magnetic Flux
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -624,12 +800,13 @@ extern BOOL vscp_evt_measurement_sendLuminance(uint8_t index, uint8_t unit, int3
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendChemicalMolarConcentration(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
-
-/* "Chemical (mass) concentration" not supported. No frame defined. */
+static inline BOOL vscp_evt_measurement_sendMagneticFluxCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX, index, unit, data, exp);
+}
 
 /**
- * Reserved
+ * Magnetic Flux Density
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -638,12 +815,15 @@ extern BOOL vscp_evt_measurement_sendChemicalMolarConcentration(uint8_t index, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendReserved(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
-
-/* "Reserved" not supported. No frame defined. */
+static inline BOOL vscp_evt_measurement_sendMagneticFluxDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY, index, unit, data, exp);
+}
 
 /**
- * Dew Point
+ * Magnetic Flux Density
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -652,10 +832,13 @@ extern BOOL vscp_evt_measurement_sendReserved(uint8_t index, uint8_t unit, int32
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendDewPoint(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendMagneticFluxDensityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY, index, unit, data, exp);
+}
 
 /**
- * Relative Level
+ * Inductance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -664,10 +847,15 @@ extern BOOL vscp_evt_measurement_sendDewPoint(uint8_t index, uint8_t unit, int32
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRelativeLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendInductance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_INDUCTANCE, index, unit, data, exp);
+}
 
 /**
- * Altitude
+ * Inductance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -676,10 +864,13 @@ extern BOOL vscp_evt_measurement_sendRelativeLevel(uint8_t index, uint8_t unit,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendAltitude(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendInductanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_INDUCTANCE, index, unit, data, exp);
+}
 
 /**
- * Area
+ * Luminous Flux
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -688,10 +879,15 @@ extern BOOL vscp_evt_measurement_sendAltitude(uint8_t index, uint8_t unit, int32
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendArea(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendLuminousFlux(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT, index, unit, data, exp);
+}
 
 /**
- * Radiant intensity
+ * Luminous Flux
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -700,10 +896,13 @@ extern BOOL vscp_evt_measurement_sendArea(uint8_t index, uint8_t unit, int32_t d
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadiantIntensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendLuminousFluxCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT, index, unit, data, exp);
+}
 
 /**
- * Radiance
+ * Illuminance
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -712,10 +911,15 @@ extern BOOL vscp_evt_measurement_sendRadiantIntensity(uint8_t index, uint8_t uni
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendIlluminance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ILLUMINANCE, index, unit, data, exp);
+}
 
 /**
- * Irradiance, Exitance, Radiosity
+ * Illuminance
+ * 
+ * The data is sent in the most compact data coding representation.
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -724,10 +928,13 @@ extern BOOL vscp_evt_measurement_sendRadiance(uint8_t index, uint8_t unit, int32
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendIlluminanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ILLUMINANCE, index, unit, data, exp);
+}
 
 /**
- * Spectral radiance
+ * Radiation dose (absorbed)
  * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
@@ -736,11 +943,963 @@ extern BOOL vscp_evt_measurement_sendIrradianceExitanceRadiosity(uint8_t index,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSpectralRadiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendRadiationDoseAbsorbed(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED, index, unit, data, exp);
+}
+
+/**
+ * Radiation dose (absorbed)
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadiationDoseAbsorbedCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED, index, unit, data, exp);
+}
+
+/**
+ * Catalytic activity
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendCatalyticActivity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY, index, unit, data, exp);
+}
+
+/**
+ * Catalytic activity
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendCatalyticActivityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY, index, unit, data, exp);
+}
+
+/**
+ * Volume
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendVolume(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_VOLUME, index, unit, data, exp);
+}
+
+/**
+ * Volume
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendVolumeCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_VOLUME, index, unit, data, exp);
+}
+
+/**
+ * Sound intensity
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundIntensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY, index, unit, data, exp);
+}
+
+/**
+ * Sound intensity
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundIntensityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY, index, unit, data, exp);
+}
+
+/**
+ * Angle, direction or similar
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAngleDirectionOrSimilar(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ANGLE, index, unit, data, exp);
+}
+
+/**
+ * Angle, direction or similar
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAngleDirectionOrSimilarCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ANGLE, index, unit, data, exp);
+}
+
+/**
+ * Position WGS 84
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendPositionWgs84(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_POSITION, index, unit, data, exp);
+}
+
+/**
+ * Position WGS 84
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendPositionWgs84Compact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_POSITION, index, unit, data, exp);
+}
+
+/**
+ * Speed
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSpeed(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SPEED, index, unit, data, exp);
+}
+
+/**
+ * Speed
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSpeedCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SPEED, index, unit, data, exp);
+}
+
+/**
+ * Acceleration
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAcceleration(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ACCELERATION, index, unit, data, exp);
+}
+
+/**
+ * Acceleration
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAccelerationCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ACCELERATION, index, unit, data, exp);
+}
+
+/**
+ * Tension
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendTension(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_TENSION, index, unit, data, exp);
+}
+
+/**
+ * Tension
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendTensionCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_TENSION, index, unit, data, exp);
+}
+
+/**
+ * Damp/moist (Hygrometer reading)
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendDampMoistHygrometerReading(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_HUMIDITY, index, unit, data, exp);
+}
+
+/**
+ * Damp/moist (Hygrometer reading)
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendDampMoistHygrometerReadingCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_HUMIDITY, index, unit, data, exp);
+}
+
+/**
+ * Flow
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendFlow(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_FLOW, index, unit, data, exp);
+}
+
+/**
+ * Flow
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendFlowCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_FLOW, index, unit, data, exp);
+}
+
+/**
+ * Thermal resistance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendThermalResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE, index, unit, data, exp);
+}
+
+/**
+ * Thermal resistance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendThermalResistanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE, index, unit, data, exp);
+}
+
+/**
+ * Refractive (optical) power
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRefractiveOpticalPower(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER, index, unit, data, exp);
+}
+
+/**
+ * Refractive (optical) power
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRefractiveOpticalPowerCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER, index, unit, data, exp);
+}
+
+/**
+ * Dynamic viscosity
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendDynamicViscosity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY, index, unit, data, exp);
+}
+
+/**
+ * Dynamic viscosity
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendDynamicViscosityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY, index, unit, data, exp);
+}
+
+/**
+ * Sound impedance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundImpedance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE, index, unit, data, exp);
+}
+
+/**
+ * Sound impedance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundImpedanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE, index, unit, data, exp);
+}
+
+/**
+ * Sound resistance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundResistance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE, index, unit, data, exp);
+}
+
+/**
+ * Sound resistance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundResistanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE, index, unit, data, exp);
+}
+
+/**
+ * Electric elastance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendElectricElastance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE, index, unit, data, exp);
+}
+
+/**
+ * Electric elastance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendElectricElastanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE, index, unit, data, exp);
+}
+
+/**
+ * Luminous energy
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendLuminousEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY, index, unit, data, exp);
+}
+
+/**
+ * Luminous energy
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendLuminousEnergyCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY, index, unit, data, exp);
+}
+
+/**
+ * Luminance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendLuminance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_LUMINANCE, index, unit, data, exp);
+}
+
+/**
+ * Luminance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendLuminanceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_LUMINANCE, index, unit, data, exp);
+}
+
+/**
+ * Chemical (molar) concentration
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendChemicalMolarConcentration(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR, index, unit, data, exp);
+}
+
+/**
+ * Chemical (molar) concentration
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendChemicalMolarConcentrationCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR, index, unit, data, exp);
+}
+
+/* "Chemical (mass) concentration" not supported. No frame defined. */
+
+/**
+ * Reserved
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendReserved(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RESERVED47, index, unit, data, exp);
+}
+
+/**
+ * Reserved
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendReservedCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RESERVED47, index, unit, data, exp);
+}
+
+/* "Reserved" not supported. No frame defined. */
+
+/**
+ * Dew Point
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendDewPoint(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_DEWPOINT, index, unit, data, exp);
+}
+
+/**
+ * Dew Point
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendDewPointCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_DEWPOINT, index, unit, data, exp);
+}
+
+/**
+ * Relative Level
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRelativeLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL, index, unit, data, exp);
+}
+
+/**
+ * Relative Level
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRelativeLevelCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL, index, unit, data, exp);
+}
+
+/**
+ * Altitude
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAltitude(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_ALTITUDE, index, unit, data, exp);
+}
+
+/**
+ * Altitude
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAltitudeCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_ALTITUDE, index, unit, data, exp);
+}
+
+/**
+ * Area
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendArea(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_AREA, index, unit, data, exp);
+}
+
+/**
+ * Area
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendAreaCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_AREA, index, unit, data, exp);
+}
+
+/**
+ * Radiant intensity
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadiantIntensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY, index, unit, data, exp);
+}
+
+/**
+ * Radiant intensity
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadiantIntensityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY, index, unit, data, exp);
+}
+
+/**
+ * Radiance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Radiance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadianceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Irradiance, Exitance, Radiosity
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_IRRADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Irradiance, Exitance, Radiosity
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendIrradianceExitanceRadiosityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_IRRADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Spectral radiance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSpectralRadiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Spectral radiance
+ * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSpectralRadianceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Spectral irradiance
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSpectralIrradiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE, index, unit, data, exp);
+}
 
 /**
  * Spectral irradiance
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSpectralIrradianceCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE, index, unit, data, exp);
+}
+
+/**
+ * Sound pressure (acoustic pressure)
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -748,11 +1907,31 @@ extern BOOL vscp_evt_measurement_sendSpectralRadiance(uint8_t index, uint8_t uni
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSpectralIrradiance(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendSoundPressureAcousticPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE, index, unit, data, exp);
+}
 
 /**
  * Sound pressure (acoustic pressure)
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundPressureAcousticPressureCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE, index, unit, data, exp);
+}
+
+/**
+ * Sound energy density
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -760,11 +1939,31 @@ extern BOOL vscp_evt_measurement_sendSpectralIrradiance(uint8_t index, uint8_t u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSoundPressureAcousticPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SOUND_DENSITY, index, unit, data, exp);
+}
 
 /**
  * Sound energy density
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundEnergyDensityCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SOUND_DENSITY, index, unit, data, exp);
+}
+
+/**
+ * Sound level
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -772,11 +1971,31 @@ extern BOOL vscp_evt_measurement_sendSoundPressureAcousticPressure(uint8_t index
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_SOUND_LEVEL, index, unit, data, exp);
+}
 
 /**
  * Sound level
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendSoundLevelCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_SOUND_LEVEL, index, unit, data, exp);
+}
+
+/**
+ * Radiation dose (equivalent)
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -784,11 +2003,31 @@ extern BOOL vscp_evt_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendRadiationDoseEquivalent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_DOSE_EQUIVALENT, index, unit, data, exp);
+}
 
 /**
  * Radiation dose (equivalent)
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadiationDoseEquivalentCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_DOSE_EQUIVALENT, index, unit, data, exp);
+}
+
+/**
+ * Radiation dose (exposure)
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -796,11 +2035,31 @@ extern BOOL vscp_evt_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadiationDoseEquivalent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendRadiationDoseExposure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE, index, unit, data, exp);
+}
 
 /**
  * Radiation dose (exposure)
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendRadiationDoseExposureCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE, index, unit, data, exp);
+}
+
+/**
+ * Power factor
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -808,11 +2067,31 @@ extern BOOL vscp_evt_measurement_sendRadiationDoseEquivalent(uint8_t index, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendRadiationDoseExposure(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendPowerFactor(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_POWER_FACTOR, index, unit, data, exp);
+}
 
 /**
  * Power factor
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendPowerFactorCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_POWER_FACTOR, index, unit, data, exp);
+}
+
+/**
+ * Reactive Power
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -820,11 +2099,31 @@ extern BOOL vscp_evt_measurement_sendRadiationDoseExposure(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendPowerFactor(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendReactivePower(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_REACTIVE_POWER, index, unit, data, exp);
+}
 
 /**
  * Reactive Power
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
+ * @param[in] index Index for sensor.
+ * @param[in] unit The unit of the data.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+static inline BOOL vscp_evt_measurement_sendReactivePowerCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_REACTIVE_POWER, index, unit, data, exp);
+}
+
+/**
+ * Reactive Energy
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -832,11 +2131,16 @@ extern BOOL vscp_evt_measurement_sendPowerFactor(uint8_t index, uint8_t unit, in
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendReactivePower(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendReactiveEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByType(VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY, index, unit, data, exp);
+}
 
 /**
  * Reactive Energy
  * 
+ * The data is sent in the most compact data coding representation.
+ * 
  * @param[in] index Index for sensor.
  * @param[in] unit The unit of the data.
  * @param[in] data The data as signed integer.
@@ -844,7 +2148,31 @@ extern BOOL vscp_evt_measurement_sendReactivePower(uint8_t index, uint8_t unit,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement_sendReactiveEnergy(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurement_sendReactiveEnergyCompact(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurement_sendByTypeCompact(VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY, index, unit, data, exp);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurement_Common * const evt);
+
+/**
+ * Parse a received event of the "Measurement" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement_parse(vscp_RxMessage const * const msg, vscp_evt_measurement_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_measurement32.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,1538 +73,19 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Count
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendCount(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_COUNT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Length/Distance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendLengthDistance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_LENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Mass
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendMass(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_MASS, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Time
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendTime(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_TIME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric Current
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricCurrent(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRIC_CURRENT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Temperature
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendTemperature(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_TEMPERATURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Amount of substance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendAmountOfSubstance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_AMOUNT_OF_SUBSTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Intensity (Intensity of light)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendLuminousIntensityIntensityOfLight(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_INTENSITY_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Frequency
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendFrequency(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_FREQUENCY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radioactivity and other random events
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRadioactivityAndOtherRandomEvents(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RADIOACTIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Force
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendForce(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_FORCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pressure
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendPressure(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Energy
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendEnergy(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendPower(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Charge
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricalCharge(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CHARGE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Potential (Voltage)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricalPotentialVoltage(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRICAL_POTENTIAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Capacitance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricalCapacitance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CAPACITANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Resistance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricalResistance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRICAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Conductance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricalConductance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CONDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Field Strength
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendMagneticFieldStrength(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_MAGNETIC_FIELD_STRENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendMagneticFlux(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_MAGNETIC_FLUX, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux Density
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendMagneticFluxDensity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_MAGNETIC_FLUX_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Inductance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendInductance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_INDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Flux
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendLuminousFlux(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_FLUX_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Illuminance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendIlluminance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ILLUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (absorbed)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRadiationDoseAbsorbed(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RADIATION_DOSE_ABSORBED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Catalytic activity
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendCatalyticActivity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_CATALYTIC_ACITIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Volume
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendVolume(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_VOLUME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound intensity
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSoundIntensity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SOUND_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Angle
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendAngle(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ANGLE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Position WGS 84
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendPositionWgs84(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_POSITION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Speed
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSpeed(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SPEED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Acceleration
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendAcceleration(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ACCELERATION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Tension
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendTension(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_TENSION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Damp/moist (Hygrometer reading)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendDampMoistHygrometerReading(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_HUMIDITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Flow
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendFlow(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_FLOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Thermal resistance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendThermalResistance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_THERMAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Refractive (optical) power
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRefractiveOpticalPower(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_REFRACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Dynamic viscosity
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendDynamicViscosity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_DYNAMIC_VISCOSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound impedance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSoundImpedance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SOUND_IMPEDANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound resistance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSoundResistance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SOUND_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric elastance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendElectricElastance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ELECTRIC_ELASTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous energy
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendLuminousEnergy(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_LUMINOUS_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendLuminance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_LUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Chemical (molar) concentration
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendChemicalMolarConcentration(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_CHEMICAL_CONCENTRATION_MOLAR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Chemical (mass) concentration" not supported. No frame defined. */
-
-/**
- * Reserved
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendReserved(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RESERVED47, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Reserved" not supported. No frame defined. */
-
-/**
- * Dew Point
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendDewPoint(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_DEWPOINT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Relative Level
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRelativeLevel(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RELATIVE_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Altitude
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendAltitude(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_ALTITUDE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Area
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendArea(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_AREA, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiant intensity
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRadiantIntensity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RADIANT_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRadiance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Irradiance, Exitance, Radiosity
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendIrradianceExitanceRadiosity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Spectral radiance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSpectralRadiance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SPECTRAL_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Spectral irradiance
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSpectralIrradiance(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SPECTRAL_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound pressure (acoustic pressure)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSoundPressureAcousticPressure(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SOUND_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound energy density
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSoundEnergyDensity(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SOUND_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound level
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendSoundLevel(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_SOUND_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (equivalent)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRadiationDoseEquivalent(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_DOSE_EQUIVALENT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (exposure)
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendRadiationDoseExposure(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_RADIATION_DOSE_EXPOSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power factor
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendPowerFactor(float_t value)
+extern BOOL vscp_evt_measurement32_sendByType(uint8_t vscpType, float_t value)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_POWER_FACTOR, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = ((uint8_t*)&value)[3];
     txMsg.data[1] = ((uint8_t*)&value)[2];
@@ -1617,52 +99,150 @@ extern BOOL vscp_evt_measurement32_sendPowerFactor(float_t value)
 }
 
 /**
- * Reactive Power
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendReactivePower(float_t value)
+extern BOOL vscp_evt_measurement32_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_REACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = size;
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Reactive Energy
- * 
- * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement32_sendReactiveEnergy(float_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT32, VSCP_TYPE_MEASUREMENT32_REACTIVE_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[3];
-    txMsg.data[1] = ((uint8_t*)&value)[2];
-    txMsg.data[2] = ((uint8_t*)&value)[1];
-    txMsg.data[3] = ((uint8_t*)&value)[0];
-    size += 4;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement32_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurement32_Common * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MEASUREMENT32 != msg->vscpClass) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    ((uint8_t*)&evt->value)[3] = msg->data[0];
+    ((uint8_t*)&evt->value)[2] = msg->data[1];
+    ((uint8_t*)&evt->value)[1] = msg->data[2];
+    ((uint8_t*)&evt->value)[0] = msg->data[3];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Single precision floating point measurement" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement32_parse(vscp_RxMessage const * const msg, vscp_evt_measurement32_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_MEASUREMENT32 != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_MEASUREMENT32_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_MEASUREMENT32_COUNT:
+    case VSCP_TYPE_MEASUREMENT32_LENGTH:
+    case VSCP_TYPE_MEASUREMENT32_MASS:
+    case VSCP_TYPE_MEASUREMENT32_TIME:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRIC_CURRENT:
+    case VSCP_TYPE_MEASUREMENT32_TEMPERATURE:
+    case VSCP_TYPE_MEASUREMENT32_AMOUNT_OF_SUBSTANCE:
+    case VSCP_TYPE_MEASUREMENT32_INTENSITY_OF_LIGHT:
+    case VSCP_TYPE_MEASUREMENT32_FREQUENCY:
+    case VSCP_TYPE_MEASUREMENT32_RADIOACTIVITY:
+    case VSCP_TYPE_MEASUREMENT32_FORCE:
+    case VSCP_TYPE_MEASUREMENT32_PRESSURE:
+    case VSCP_TYPE_MEASUREMENT32_ENERGY:
+    case VSCP_TYPE_MEASUREMENT32_POWER:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CHARGE:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRICAL_POTENTIAL:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CAPACITANCE:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRICAL_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CONDUCTANCE:
+    case VSCP_TYPE_MEASUREMENT32_MAGNETIC_FIELD_STRENGTH:
+    case VSCP_TYPE_MEASUREMENT32_MAGNETIC_FLUX:
+    case VSCP_TYPE_MEASUREMENT32_MAGNETIC_FLUX_DENSITY:
+    case VSCP_TYPE_MEASUREMENT32_INDUCTANCE:
+    case VSCP_TYPE_MEASUREMENT32_FLUX_OF_LIGHT:
+    case VSCP_TYPE_MEASUREMENT32_ILLUMINANCE:
+    case VSCP_TYPE_MEASUREMENT32_RADIATION_DOSE_ABSORBED:
+    case VSCP_TYPE_MEASUREMENT32_CATALYTIC_ACITIVITY:
+    case VSCP_TYPE_MEASUREMENT32_VOLUME:
+    case VSCP_TYPE_MEASUREMENT32_SOUND_INTENSITY:
+    case VSCP_TYPE_MEASUREMENT32_ANGLE:
+    case VSCP_TYPE_MEASUREMENT32_POSITION:
+    case VSCP_TYPE_MEASUREMENT32_SPEED:
+    case VSCP_TYPE_MEASUREMENT32_ACCELERATION:
+    case VSCP_TYPE_MEASUREMENT32_TENSION:
+    case VSCP_TYPE_MEASUREMENT32_HUMIDITY:
+    case VSCP_TYPE_MEASUREMENT32_FLOW:
+    case VSCP_TYPE_MEASUREMENT32_THERMAL_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT32_REFRACTIVE_POWER:
+    case VSCP_TYPE_MEASUREMENT32_DYNAMIC_VISCOSITY:
+    case VSCP_TYPE_MEASUREMENT32_SOUND_IMPEDANCE:
+    case VSCP_TYPE_MEASUREMENT32_SOUND_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT32_ELECTRIC_ELASTANCE:
+    case VSCP_TYPE_MEASUREMENT32_LUMINOUS_ENERGY:
+    case VSCP_TYPE_MEASUREMENT32_LUMINANCE:
+    case VSCP_TYPE_MEASUREMENT32_CHEMICAL_CONCENTRATION_MOLAR:
+    case VSCP_TYPE_MEASUREMENT32_RESERVED47:
+    case VSCP_TYPE_MEASUREMENT32_DEWPOINT:
+    case VSCP_TYPE_MEASUREMENT32_RELATIVE_LEVEL:
+    case VSCP_TYPE_MEASUREMENT32_ALTITUDE:
+    case VSCP_TYPE_MEASUREMENT32_AREA:
+    case VSCP_TYPE_MEASUREMENT32_RADIANT_INTENSITY:
+    case VSCP_TYPE_MEASUREMENT32_RADIANCE:
+    case VSCP_TYPE_MEASUREMENT32_IRRADIANCE:
+    case VSCP_TYPE_MEASUREMENT32_SPECTRAL_RADIANCE:
+    case VSCP_TYPE_MEASUREMENT32_SPECTRAL_IRRADIANCE:
+    case VSCP_TYPE_MEASUREMENT32_SOUND_PRESSURE:
+    case VSCP_TYPE_MEASUREMENT32_SOUND_DENSITY:
+    case VSCP_TYPE_MEASUREMENT32_SOUND_LEVEL:
+    case VSCP_TYPE_MEASUREMENT32_DOSE_EQUIVALENT:
+    case VSCP_TYPE_MEASUREMENT32_RADIATION_DOSE_EXPOSURE:
+    case VSCP_TYPE_MEASUREMENT32_POWER_FACTOR:
+    case VSCP_TYPE_MEASUREMENT32_REACTIVE_POWER:
+    case VSCP_TYPE_MEASUREMENT32_REACTIVE_ENERGY:
+        status = vscp_evt_measurement32_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
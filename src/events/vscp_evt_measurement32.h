@@ -48,7 +48,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 #include <math.h>
+#include "vscp_type_measurement32.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -71,6 +73,26 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    float_t value; /**< Value */
+
+} vscp_evt_measurement32_Common;
+
+/** Parsed event of the "Single precision floating point measurement" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_measurement32_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_measurement32_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -79,6 +101,16 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] value The value is a "float" - IEEE-754, 32 Bits, single precision.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement32_sendByType(uint8_t vscpType, float_t value);
+
 /**
  * General event
  * 
@@ -93,7 +125,10 @@ extern BOOL vscp_evt_measurement32_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendCount(float_t value);
+static inline BOOL vscp_evt_measurement32_sendCount(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_COUNT, value);
+}
 
 /**
  * Length/Distance
@@ -102,7 +137,10 @@ extern BOOL vscp_evt_measurement32_sendCount(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendLengthDistance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendLengthDistance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_LENGTH, value);
+}
 
 /**
  * Mass
@@ -111,7 +149,10 @@ extern BOOL vscp_evt_measurement32_sendLengthDistance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendMass(float_t value);
+static inline BOOL vscp_evt_measurement32_sendMass(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_MASS, value);
+}
 
 /**
  * Time
@@ -120,7 +161,10 @@ extern BOOL vscp_evt_measurement32_sendMass(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendTime(float_t value);
+static inline BOOL vscp_evt_measurement32_sendTime(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_TIME, value);
+}
 
 /**
  * Electric Current
@@ -129,7 +173,10 @@ extern BOOL vscp_evt_measurement32_sendTime(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricCurrent(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricCurrent(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRIC_CURRENT, value);
+}
 
 /**
  * Temperature
@@ -138,7 +185,10 @@ extern BOOL vscp_evt_measurement32_sendElectricCurrent(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendTemperature(float_t value);
+static inline BOOL vscp_evt_measurement32_sendTemperature(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_TEMPERATURE, value);
+}
 
 /**
  * Amount of substance
@@ -147,7 +197,10 @@ extern BOOL vscp_evt_measurement32_sendTemperature(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendAmountOfSubstance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendAmountOfSubstance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_AMOUNT_OF_SUBSTANCE, value);
+}
 
 /**
  * Luminous Intensity (Intensity of light)
@@ -156,7 +209,10 @@ extern BOOL vscp_evt_measurement32_sendAmountOfSubstance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendLuminousIntensityIntensityOfLight(float_t value);
+static inline BOOL vscp_evt_measurement32_sendLuminousIntensityIntensityOfLight(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_INTENSITY_OF_LIGHT, value);
+}
 
 /**
  * Frequency
@@ -165,7 +221,10 @@ extern BOOL vscp_evt_measurement32_sendLuminousIntensityIntensityOfLight(float_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendFrequency(float_t value);
+static inline BOOL vscp_evt_measurement32_sendFrequency(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_FREQUENCY, value);
+}
 
 /**
  * Radioactivity and other random events
@@ -174,7 +233,10 @@ extern BOOL vscp_evt_measurement32_sendFrequency(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRadioactivityAndOtherRandomEvents(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRadioactivityAndOtherRandomEvents(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RADIOACTIVITY, value);
+}
 
 /**
  * Force
@@ -183,7 +245,10 @@ extern BOOL vscp_evt_measurement32_sendRadioactivityAndOtherRandomEvents(float_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendForce(float_t value);
+static inline BOOL vscp_evt_measurement32_sendForce(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_FORCE, value);
+}
 
 /**
  * Pressure
@@ -192,7 +257,10 @@ extern BOOL vscp_evt_measurement32_sendForce(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendPressure(float_t value);
+static inline BOOL vscp_evt_measurement32_sendPressure(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_PRESSURE, value);
+}
 
 /**
  * Energy
@@ -201,7 +269,10 @@ extern BOOL vscp_evt_measurement32_sendPressure(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendEnergy(float_t value);
+static inline BOOL vscp_evt_measurement32_sendEnergy(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ENERGY, value);
+}
 
 /**
  * Power
@@ -210,7 +281,10 @@ extern BOOL vscp_evt_measurement32_sendEnergy(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendPower(float_t value);
+static inline BOOL vscp_evt_measurement32_sendPower(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_POWER, value);
+}
 
 /**
  * Electrical Charge
@@ -219,7 +293,10 @@ extern BOOL vscp_evt_measurement32_sendPower(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricalCharge(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricalCharge(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CHARGE, value);
+}
 
 /**
  * Electrical Potential (Voltage)
@@ -228,7 +305,10 @@ extern BOOL vscp_evt_measurement32_sendElectricalCharge(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricalPotentialVoltage(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricalPotentialVoltage(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRICAL_POTENTIAL, value);
+}
 
 /**
  * Electrical Capacitance
@@ -237,7 +317,10 @@ extern BOOL vscp_evt_measurement32_sendElectricalPotentialVoltage(float_t value)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricalCapacitance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricalCapacitance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CAPACITANCE, value);
+}
 
 /**
  * Electrical Resistance
@@ -246,7 +329,10 @@ extern BOOL vscp_evt_measurement32_sendElectricalCapacitance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricalResistance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricalResistance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRICAL_RESISTANCE, value);
+}
 
 /**
  * Electrical Conductance
@@ -255,7 +341,10 @@ extern BOOL vscp_evt_measurement32_sendElectricalResistance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricalConductance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricalConductance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRICAL_CONDUCTANCE, value);
+}
 
 /**
  * Magnetic Field Strength
@@ -264,7 +353,10 @@ extern BOOL vscp_evt_measurement32_sendElectricalConductance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendMagneticFieldStrength(float_t value);
+static inline BOOL vscp_evt_measurement32_sendMagneticFieldStrength(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_MAGNETIC_FIELD_STRENGTH, value);
+}
 
 /**
  * Magnetic Flux
@@ -273,7 +365,10 @@ extern BOOL vscp_evt_measurement32_sendMagneticFieldStrength(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendMagneticFlux(float_t value);
+static inline BOOL vscp_evt_measurement32_sendMagneticFlux(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_MAGNETIC_FLUX, value);
+}
 
 /**
  * Magnetic Flux Density
@@ -282,7 +377,10 @@ extern BOOL vscp_evt_measurement32_sendMagneticFlux(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendMagneticFluxDensity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendMagneticFluxDensity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_MAGNETIC_FLUX_DENSITY, value);
+}
 
 /**
  * Inductance
@@ -291,7 +389,10 @@ extern BOOL vscp_evt_measurement32_sendMagneticFluxDensity(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendInductance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendInductance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_INDUCTANCE, value);
+}
 
 /**
  * Luminous Flux
@@ -300,7 +401,10 @@ extern BOOL vscp_evt_measurement32_sendInductance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendLuminousFlux(float_t value);
+static inline BOOL vscp_evt_measurement32_sendLuminousFlux(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_FLUX_OF_LIGHT, value);
+}
 
 /**
  * Illuminance
@@ -309,7 +413,10 @@ extern BOOL vscp_evt_measurement32_sendLuminousFlux(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendIlluminance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendIlluminance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ILLUMINANCE, value);
+}
 
 /**
  * Radiation dose (absorbed)
@@ -318,7 +425,10 @@ extern BOOL vscp_evt_measurement32_sendIlluminance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRadiationDoseAbsorbed(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRadiationDoseAbsorbed(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RADIATION_DOSE_ABSORBED, value);
+}
 
 /**
  * Catalytic activity
@@ -327,7 +437,10 @@ extern BOOL vscp_evt_measurement32_sendRadiationDoseAbsorbed(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendCatalyticActivity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendCatalyticActivity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_CATALYTIC_ACITIVITY, value);
+}
 
 /**
  * Volume
@@ -336,7 +449,10 @@ extern BOOL vscp_evt_measurement32_sendCatalyticActivity(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendVolume(float_t value);
+static inline BOOL vscp_evt_measurement32_sendVolume(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_VOLUME, value);
+}
 
 /**
  * Sound intensity
@@ -345,7 +461,10 @@ extern BOOL vscp_evt_measurement32_sendVolume(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSoundIntensity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSoundIntensity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SOUND_INTENSITY, value);
+}
 
 /**
  * Angle
@@ -354,7 +473,10 @@ extern BOOL vscp_evt_measurement32_sendSoundIntensity(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendAngle(float_t value);
+static inline BOOL vscp_evt_measurement32_sendAngle(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ANGLE, value);
+}
 
 /**
  * Position WGS 84
@@ -363,7 +485,10 @@ extern BOOL vscp_evt_measurement32_sendAngle(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendPositionWgs84(float_t value);
+static inline BOOL vscp_evt_measurement32_sendPositionWgs84(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_POSITION, value);
+}
 
 /**
  * Speed
@@ -372,7 +497,10 @@ extern BOOL vscp_evt_measurement32_sendPositionWgs84(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSpeed(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSpeed(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SPEED, value);
+}
 
 /**
  * Acceleration
@@ -381,7 +509,10 @@ extern BOOL vscp_evt_measurement32_sendSpeed(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendAcceleration(float_t value);
+static inline BOOL vscp_evt_measurement32_sendAcceleration(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ACCELERATION, value);
+}
 
 /**
  * Tension
@@ -390,7 +521,10 @@ extern BOOL vscp_evt_measurement32_sendAcceleration(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendTension(float_t value);
+static inline BOOL vscp_evt_measurement32_sendTension(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_TENSION, value);
+}
 
 /**
  * Damp/moist (Hygrometer reading)
@@ -399,7 +533,10 @@ extern BOOL vscp_evt_measurement32_sendTension(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendDampMoistHygrometerReading(float_t value);
+static inline BOOL vscp_evt_measurement32_sendDampMoistHygrometerReading(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_HUMIDITY, value);
+}
 
 /**
  * Flow
@@ -408,7 +545,10 @@ extern BOOL vscp_evt_measurement32_sendDampMoistHygrometerReading(float_t value)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendFlow(float_t value);
+static inline BOOL vscp_evt_measurement32_sendFlow(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_FLOW, value);
+}
 
 /**
  * Thermal resistance
@@ -417,7 +557,10 @@ extern BOOL vscp_evt_measurement32_sendFlow(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendThermalResistance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendThermalResistance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_THERMAL_RESISTANCE, value);
+}
 
 /**
  * Refractive (optical) power
@@ -426,7 +569,10 @@ extern BOOL vscp_evt_measurement32_sendThermalResistance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRefractiveOpticalPower(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRefractiveOpticalPower(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_REFRACTIVE_POWER, value);
+}
 
 /**
  * Dynamic viscosity
@@ -435,7 +581,10 @@ extern BOOL vscp_evt_measurement32_sendRefractiveOpticalPower(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendDynamicViscosity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendDynamicViscosity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_DYNAMIC_VISCOSITY, value);
+}
 
 /**
  * Sound impedance
@@ -444,7 +593,10 @@ extern BOOL vscp_evt_measurement32_sendDynamicViscosity(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSoundImpedance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSoundImpedance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SOUND_IMPEDANCE, value);
+}
 
 /**
  * Sound resistance
@@ -453,7 +605,10 @@ extern BOOL vscp_evt_measurement32_sendSoundImpedance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSoundResistance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSoundResistance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SOUND_RESISTANCE, value);
+}
 
 /**
  * Electric elastance
@@ -462,7 +617,10 @@ extern BOOL vscp_evt_measurement32_sendSoundResistance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendElectricElastance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendElectricElastance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ELECTRIC_ELASTANCE, value);
+}
 
 /**
  * Luminous energy
@@ -471,7 +629,10 @@ extern BOOL vscp_evt_measurement32_sendElectricElastance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendLuminousEnergy(float_t value);
+static inline BOOL vscp_evt_measurement32_sendLuminousEnergy(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_LUMINOUS_ENERGY, value);
+}
 
 /**
  * Luminance
@@ -480,7 +641,10 @@ extern BOOL vscp_evt_measurement32_sendLuminousEnergy(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendLuminance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendLuminance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_LUMINANCE, value);
+}
 
 /**
  * Chemical (molar) concentration
@@ -489,7 +653,10 @@ extern BOOL vscp_evt_measurement32_sendLuminance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendChemicalMolarConcentration(float_t value);
+static inline BOOL vscp_evt_measurement32_sendChemicalMolarConcentration(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_CHEMICAL_CONCENTRATION_MOLAR, value);
+}
 
 /* "Chemical (mass) concentration" not supported. No frame defined. */
 
@@ -500,7 +667,10 @@ extern BOOL vscp_evt_measurement32_sendChemicalMolarConcentration(float_t value)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendReserved(float_t value);
+static inline BOOL vscp_evt_measurement32_sendReserved(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RESERVED47, value);
+}
 
 /* "Reserved" not supported. No frame defined. */
 
@@ -511,7 +681,10 @@ extern BOOL vscp_evt_measurement32_sendReserved(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendDewPoint(float_t value);
+static inline BOOL vscp_evt_measurement32_sendDewPoint(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_DEWPOINT, value);
+}
 
 /**
  * Relative Level
@@ -520,7 +693,10 @@ extern BOOL vscp_evt_measurement32_sendDewPoint(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRelativeLevel(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRelativeLevel(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RELATIVE_LEVEL, value);
+}
 
 /**
  * Altitude
@@ -529,7 +705,10 @@ extern BOOL vscp_evt_measurement32_sendRelativeLevel(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendAltitude(float_t value);
+static inline BOOL vscp_evt_measurement32_sendAltitude(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_ALTITUDE, value);
+}
 
 /**
  * Area
@@ -538,7 +717,10 @@ extern BOOL vscp_evt_measurement32_sendAltitude(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendArea(float_t value);
+static inline BOOL vscp_evt_measurement32_sendArea(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_AREA, value);
+}
 
 /**
  * Radiant intensity
@@ -547,7 +729,10 @@ extern BOOL vscp_evt_measurement32_sendArea(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRadiantIntensity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRadiantIntensity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RADIANT_INTENSITY, value);
+}
 
 /**
  * Radiance
@@ -556,7 +741,10 @@ extern BOOL vscp_evt_measurement32_sendRadiantIntensity(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRadiance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRadiance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RADIANCE, value);
+}
 
 /**
  * Irradiance, Exitance, Radiosity
@@ -565,7 +753,10 @@ extern BOOL vscp_evt_measurement32_sendRadiance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendIrradianceExitanceRadiosity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendIrradianceExitanceRadiosity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_IRRADIANCE, value);
+}
 
 /**
  * Spectral radiance
@@ -574,7 +765,10 @@ extern BOOL vscp_evt_measurement32_sendIrradianceExitanceRadiosity(float_t value
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSpectralRadiance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSpectralRadiance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SPECTRAL_RADIANCE, value);
+}
 
 /**
  * Spectral irradiance
@@ -583,7 +777,10 @@ extern BOOL vscp_evt_measurement32_sendSpectralRadiance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSpectralIrradiance(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSpectralIrradiance(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SPECTRAL_IRRADIANCE, value);
+}
 
 /**
  * Sound pressure (acoustic pressure)
@@ -592,7 +789,10 @@ extern BOOL vscp_evt_measurement32_sendSpectralIrradiance(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSoundPressureAcousticPressure(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSoundPressureAcousticPressure(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SOUND_PRESSURE, value);
+}
 
 /**
  * Sound energy density
@@ -601,7 +801,10 @@ extern BOOL vscp_evt_measurement32_sendSoundPressureAcousticPressure(float_t val
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSoundEnergyDensity(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSoundEnergyDensity(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SOUND_DENSITY, value);
+}
 
 /**
  * Sound level
@@ -610,7 +813,10 @@ extern BOOL vscp_evt_measurement32_sendSoundEnergyDensity(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendSoundLevel(float_t value);
+static inline BOOL vscp_evt_measurement32_sendSoundLevel(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_SOUND_LEVEL, value);
+}
 
 /**
  * Radiation dose (equivalent)
@@ -619,7 +825,10 @@ extern BOOL vscp_evt_measurement32_sendSoundLevel(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRadiationDoseEquivalent(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRadiationDoseEquivalent(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_DOSE_EQUIVALENT, value);
+}
 
 /**
  * Radiation dose (exposure)
@@ -628,7 +837,10 @@ extern BOOL vscp_evt_measurement32_sendRadiationDoseEquivalent(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendRadiationDoseExposure(float_t value);
+static inline BOOL vscp_evt_measurement32_sendRadiationDoseExposure(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_RADIATION_DOSE_EXPOSURE, value);
+}
 
 /**
  * Power factor
@@ -637,7 +849,10 @@ extern BOOL vscp_evt_measurement32_sendRadiationDoseExposure(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendPowerFactor(float_t value);
+static inline BOOL vscp_evt_measurement32_sendPowerFactor(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_POWER_FACTOR, value);
+}
 
 /**
  * Reactive Power
@@ -646,7 +861,10 @@ extern BOOL vscp_evt_measurement32_sendPowerFactor(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendReactivePower(float_t value);
+static inline BOOL vscp_evt_measurement32_sendReactivePower(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_REACTIVE_POWER, value);
+}
 
 /**
  * Reactive Energy
@@ -655,7 +873,31 @@ extern BOOL vscp_evt_measurement32_sendReactivePower(float_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement32_sendReactiveEnergy(float_t value);
+static inline BOOL vscp_evt_measurement32_sendReactiveEnergy(float_t value)
+{
+    return vscp_evt_measurement32_sendByType(VSCP_TYPE_MEASUREMENT32_REACTIVE_ENERGY, value);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement32_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurement32_Common * const evt);
+
+/**
+ * Parse a received event of the "Single precision floating point measurement" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement32_parse(vscp_RxMessage const * const msg, vscp_evt_measurement32_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_measurement64.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,1778 +73,19 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Count
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendCount(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_COUNT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Length/Distance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendLengthDistance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_LENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Mass
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendMass(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_MASS, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Time
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendTime(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_TIME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric Current
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricCurrent(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRIC_CURRENT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Temperature
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendTemperature(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_TEMPERATURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Amount of substance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendAmountOfSubstance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_AMOUNT_OF_SUBSTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Intensity (Intensity of light)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendLuminousIntensityIntensityOfLight(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_INTENSITY_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Frequency
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendFrequency(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_FREQUENCY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radioactivity and other random events
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRadioactivityAndOtherRandomEvents(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RADIOACTIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Force
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendForce(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_FORCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pressure
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendPressure(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Energy
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendEnergy(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendPower(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Charge
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricalCharge(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CHARGE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Potential (Voltage)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricalPotentialVoltage(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRICAL_POTENTIAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Capacitance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricalCapacitance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CAPACITANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Resistance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricalResistance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRICAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Conductance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricalConductance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CONDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Field Strength
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendMagneticFieldStrength(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_MAGNETIC_FIELD_STRENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendMagneticFlux(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_MAGNETIC_FLUX, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux Density
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendMagneticFluxDensity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_MAGNETIC_FLUX_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Inductance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendInductance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_INDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Flux
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendLuminousFlux(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_FLUX_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Illuminance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendIlluminance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ILLUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (absorbed)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRadiationDoseAbsorbed(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RADIATION_DOSE_ABSORBED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Catalytic activity
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendCatalyticActivity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_CATALYTIC_ACITIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Volume
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendVolume(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_VOLUME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound intensity
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSoundIntensity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SOUND_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Angle
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendAngle(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ANGLE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Position WGS 84
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendPositionWgs84(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_POSITION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Speed
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSpeed(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SPEED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Acceleration
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendAcceleration(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ACCELERATION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Tension
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendTension(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_TENSION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Damp/moist (Hygrometer reading)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendDampMoistHygrometerReading(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_HUMIDITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Flow
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendFlow(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_FLOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Thermal resistance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendThermalResistance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_THERMAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Refractive (optical) power
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRefractiveOpticalPower(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_REFRACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Dynamic viscosity
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendDynamicViscosity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_DYNAMIC_VISCOSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound impedance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSoundImpedance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SOUND_IMPEDANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound resistance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSoundResistance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SOUND_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric elastance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendElectricElastance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ELECTRIC_ELASTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous energy
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendLuminousEnergy(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_LUMINOUS_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendLuminance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_LUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Chemical (molar) concentration
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendChemicalMolarConcentration(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_CHEMICAL_CONCENTRATION_MOLAR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Chemical (mass) concentration" not supported. No frame defined. */
-
-/**
- * Reserved
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendReserved(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RESERVED47, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Reserved" not supported. No frame defined. */
-
-/**
- * Dew Point
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendDewPoint(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_DEWPOINT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Relative Level
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRelativeLevel(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RELATIVE_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Altitude
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendAltitude(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_ALTITUDE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Area
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendArea(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_AREA, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiant intensity
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRadiantIntensity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RADIANT_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRadiance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Irradiance, Exitance, Radiosity
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendIrradianceExitanceRadiosity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Spectral radiance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSpectralRadiance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SPECTRAL_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Spectral irradiance
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSpectralIrradiance(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SPECTRAL_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound pressure (acoustic pressure)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSoundPressureAcousticPressure(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SOUND_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound energy density
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSoundEnergyDensity(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SOUND_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound level
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendSoundLevel(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_SOUND_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (equivalent)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRadiationDoseEquivalent(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_DOSE_EQUIVALENT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose (exposure)
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendRadiationDoseExposure(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_RADIATION_DOSE_EXPOSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power factor
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendPowerFactor(double_t value)
+extern BOOL vscp_evt_measurement64_sendByType(uint8_t vscpType, double_t value)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_POWER_FACTOR, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = ((uint8_t*)&value)[7];
     txMsg.data[1] = ((uint8_t*)&value)[6];
@@ -1861,60 +103,154 @@ extern BOOL vscp_evt_measurement64_sendPowerFactor(double_t value)
 }
 
 /**
- * Reactive Power
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendReactivePower(double_t value)
+extern BOOL vscp_evt_measurement64_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_REACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = size;
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Reactive Energy
- * 
- * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_measurement64_sendReactiveEnergy(double_t value)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_MEASUREMENT64, VSCP_TYPE_MEASUREMENT64_REACTIVE_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = ((uint8_t*)&value)[7];
-    txMsg.data[1] = ((uint8_t*)&value)[6];
-    txMsg.data[2] = ((uint8_t*)&value)[5];
-    txMsg.data[3] = ((uint8_t*)&value)[4];
-    txMsg.data[4] = ((uint8_t*)&value)[3];
-    txMsg.data[5] = ((uint8_t*)&value)[2];
-    txMsg.data[6] = ((uint8_t*)&value)[1];
-    txMsg.data[7] = ((uint8_t*)&value)[0];
-    size += 8;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement64_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurement64_Common * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MEASUREMENT64 != msg->vscpClass) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    ((uint8_t*)&evt->value)[7] = msg->data[0];
+    ((uint8_t*)&evt->value)[6] = msg->data[1];
+    ((uint8_t*)&evt->value)[5] = msg->data[2];
+    ((uint8_t*)&evt->value)[4] = msg->data[3];
+    ((uint8_t*)&evt->value)[3] = msg->data[4];
+    ((uint8_t*)&evt->value)[2] = msg->data[5];
+    ((uint8_t*)&evt->value)[1] = msg->data[6];
+    ((uint8_t*)&evt->value)[0] = msg->data[7];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Double precision floating point measurement" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement64_parse(vscp_RxMessage const * const msg, vscp_evt_measurement64_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_MEASUREMENT64 != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_MEASUREMENT64_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_MEASUREMENT64_COUNT:
+    case VSCP_TYPE_MEASUREMENT64_LENGTH:
+    case VSCP_TYPE_MEASUREMENT64_MASS:
+    case VSCP_TYPE_MEASUREMENT64_TIME:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRIC_CURRENT:
+    case VSCP_TYPE_MEASUREMENT64_TEMPERATURE:
+    case VSCP_TYPE_MEASUREMENT64_AMOUNT_OF_SUBSTANCE:
+    case VSCP_TYPE_MEASUREMENT64_INTENSITY_OF_LIGHT:
+    case VSCP_TYPE_MEASUREMENT64_FREQUENCY:
+    case VSCP_TYPE_MEASUREMENT64_RADIOACTIVITY:
+    case VSCP_TYPE_MEASUREMENT64_FORCE:
+    case VSCP_TYPE_MEASUREMENT64_PRESSURE:
+    case VSCP_TYPE_MEASUREMENT64_ENERGY:
+    case VSCP_TYPE_MEASUREMENT64_POWER:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CHARGE:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRICAL_POTENTIAL:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CAPACITANCE:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRICAL_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CONDUCTANCE:
+    case VSCP_TYPE_MEASUREMENT64_MAGNETIC_FIELD_STRENGTH:
+    case VSCP_TYPE_MEASUREMENT64_MAGNETIC_FLUX:
+    case VSCP_TYPE_MEASUREMENT64_MAGNETIC_FLUX_DENSITY:
+    case VSCP_TYPE_MEASUREMENT64_INDUCTANCE:
+    case VSCP_TYPE_MEASUREMENT64_FLUX_OF_LIGHT:
+    case VSCP_TYPE_MEASUREMENT64_ILLUMINANCE:
+    case VSCP_TYPE_MEASUREMENT64_RADIATION_DOSE_ABSORBED:
+    case VSCP_TYPE_MEASUREMENT64_CATALYTIC_ACITIVITY:
+    case VSCP_TYPE_MEASUREMENT64_VOLUME:
+    case VSCP_TYPE_MEASUREMENT64_SOUND_INTENSITY:
+    case VSCP_TYPE_MEASUREMENT64_ANGLE:
+    case VSCP_TYPE_MEASUREMENT64_POSITION:
+    case VSCP_TYPE_MEASUREMENT64_SPEED:
+    case VSCP_TYPE_MEASUREMENT64_ACCELERATION:
+    case VSCP_TYPE_MEASUREMENT64_TENSION:
+    case VSCP_TYPE_MEASUREMENT64_HUMIDITY:
+    case VSCP_TYPE_MEASUREMENT64_FLOW:
+    case VSCP_TYPE_MEASUREMENT64_THERMAL_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT64_REFRACTIVE_POWER:
+    case VSCP_TYPE_MEASUREMENT64_DYNAMIC_VISCOSITY:
+    case VSCP_TYPE_MEASUREMENT64_SOUND_IMPEDANCE:
+    case VSCP_TYPE_MEASUREMENT64_SOUND_RESISTANCE:
+    case VSCP_TYPE_MEASUREMENT64_ELECTRIC_ELASTANCE:
+    case VSCP_TYPE_MEASUREMENT64_LUMINOUS_ENERGY:
+    case VSCP_TYPE_MEASUREMENT64_LUMINANCE:
+    case VSCP_TYPE_MEASUREMENT64_CHEMICAL_CONCENTRATION_MOLAR:
+    case VSCP_TYPE_MEASUREMENT64_RESERVED47:
+    case VSCP_TYPE_MEASUREMENT64_DEWPOINT:
+    case VSCP_TYPE_MEASUREMENT64_RELATIVE_LEVEL:
+    case VSCP_TYPE_MEASUREMENT64_ALTITUDE:
+    case VSCP_TYPE_MEASUREMENT64_AREA:
+    case VSCP_TYPE_MEASUREMENT64_RADIANT_INTENSITY:
+    case VSCP_TYPE_MEASUREMENT64_RADIANCE:
+    case VSCP_TYPE_MEASUREMENT64_IRRADIANCE:
+    case VSCP_TYPE_MEASUREMENT64_SPECTRAL_RADIANCE:
+    case VSCP_TYPE_MEASUREMENT64_SPECTRAL_IRRADIANCE:
+    case VSCP_TYPE_MEASUREMENT64_SOUND_PRESSURE:
+    case VSCP_TYPE_MEASUREMENT64_SOUND_DENSITY:
+    case VSCP_TYPE_MEASUREMENT64_SOUND_LEVEL:
+    case VSCP_TYPE_MEASUREMENT64_DOSE_EQUIVALENT:
+    case VSCP_TYPE_MEASUREMENT64_RADIATION_DOSE_EXPOSURE:
+    case VSCP_TYPE_MEASUREMENT64_POWER_FACTOR:
+    case VSCP_TYPE_MEASUREMENT64_REACTIVE_POWER:
+    case VSCP_TYPE_MEASUREMENT64_REACTIVE_ENERGY:
+        status = vscp_evt_measurement64_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
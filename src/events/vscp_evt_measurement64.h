@@ -48,7 +48,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 #include <math.h>
+#include "vscp_type_measurement64.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -71,6 +73,26 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    double_t value; /**< Value */
+
+} vscp_evt_measurement64_Common;
+
+/** Parsed event of the "Double precision floating point measurement" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_measurement64_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_measurement64_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -79,6 +101,16 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] value The value is a "double" - IEEE-754, 64 Bits, double precision.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement64_sendByType(uint8_t vscpType, double_t value);
+
 /**
  * General event
  * 
@@ -93,7 +125,10 @@ extern BOOL vscp_evt_measurement64_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendCount(double_t value);
+static inline BOOL vscp_evt_measurement64_sendCount(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_COUNT, value);
+}
 
 /**
  * Length/Distance
@@ -102,7 +137,10 @@ extern BOOL vscp_evt_measurement64_sendCount(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendLengthDistance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendLengthDistance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_LENGTH, value);
+}
 
 /**
  * Mass
@@ -111,7 +149,10 @@ extern BOOL vscp_evt_measurement64_sendLengthDistance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendMass(double_t value);
+static inline BOOL vscp_evt_measurement64_sendMass(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_MASS, value);
+}
 
 /**
  * Time
@@ -120,7 +161,10 @@ extern BOOL vscp_evt_measurement64_sendMass(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendTime(double_t value);
+static inline BOOL vscp_evt_measurement64_sendTime(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_TIME, value);
+}
 
 /**
  * Electric Current
@@ -129,7 +173,10 @@ extern BOOL vscp_evt_measurement64_sendTime(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricCurrent(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricCurrent(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRIC_CURRENT, value);
+}
 
 /**
  * Temperature
@@ -138,7 +185,10 @@ extern BOOL vscp_evt_measurement64_sendElectricCurrent(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendTemperature(double_t value);
+static inline BOOL vscp_evt_measurement64_sendTemperature(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_TEMPERATURE, value);
+}
 
 /**
  * Amount of substance
@@ -147,7 +197,10 @@ extern BOOL vscp_evt_measurement64_sendTemperature(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendAmountOfSubstance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendAmountOfSubstance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_AMOUNT_OF_SUBSTANCE, value);
+}
 
 /**
  * Luminous Intensity (Intensity of light)
@@ -156,7 +209,10 @@ extern BOOL vscp_evt_measurement64_sendAmountOfSubstance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendLuminousIntensityIntensityOfLight(double_t value);
+static inline BOOL vscp_evt_measurement64_sendLuminousIntensityIntensityOfLight(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_INTENSITY_OF_LIGHT, value);
+}
 
 /**
  * Frequency
@@ -165,7 +221,10 @@ extern BOOL vscp_evt_measurement64_sendLuminousIntensityIntensityOfLight(double_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendFrequency(double_t value);
+static inline BOOL vscp_evt_measurement64_sendFrequency(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_FREQUENCY, value);
+}
 
 /**
  * Radioactivity and other random events
@@ -174,7 +233,10 @@ extern BOOL vscp_evt_measurement64_sendFrequency(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRadioactivityAndOtherRandomEvents(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRadioactivityAndOtherRandomEvents(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RADIOACTIVITY, value);
+}
 
 /**
  * Force
@@ -183,7 +245,10 @@ extern BOOL vscp_evt_measurement64_sendRadioactivityAndOtherRandomEvents(double_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendForce(double_t value);
+static inline BOOL vscp_evt_measurement64_sendForce(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_FORCE, value);
+}
 
 /**
  * Pressure
@@ -192,7 +257,10 @@ extern BOOL vscp_evt_measurement64_sendForce(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendPressure(double_t value);
+static inline BOOL vscp_evt_measurement64_sendPressure(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_PRESSURE, value);
+}
 
 /**
  * Energy
@@ -201,7 +269,10 @@ extern BOOL vscp_evt_measurement64_sendPressure(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendEnergy(double_t value);
+static inline BOOL vscp_evt_measurement64_sendEnergy(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ENERGY, value);
+}
 
 /**
  * Power
@@ -210,7 +281,10 @@ extern BOOL vscp_evt_measurement64_sendEnergy(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendPower(double_t value);
+static inline BOOL vscp_evt_measurement64_sendPower(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_POWER, value);
+}
 
 /**
  * Electrical Charge
@@ -219,7 +293,10 @@ extern BOOL vscp_evt_measurement64_sendPower(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricalCharge(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricalCharge(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CHARGE, value);
+}
 
 /**
  * Electrical Potential (Voltage)
@@ -228,7 +305,10 @@ extern BOOL vscp_evt_measurement64_sendElectricalCharge(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricalPotentialVoltage(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricalPotentialVoltage(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRICAL_POTENTIAL, value);
+}
 
 /**
  * Electrical Capacitance
@@ -237,7 +317,10 @@ extern BOOL vscp_evt_measurement64_sendElectricalPotentialVoltage(double_t value
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricalCapacitance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricalCapacitance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CAPACITANCE, value);
+}
 
 /**
  * Electrical Resistance
@@ -246,7 +329,10 @@ extern BOOL vscp_evt_measurement64_sendElectricalCapacitance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricalResistance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricalResistance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRICAL_RESISTANCE, value);
+}
 
 /**
  * Electrical Conductance
@@ -255,7 +341,10 @@ extern BOOL vscp_evt_measurement64_sendElectricalResistance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricalConductance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricalConductance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRICAL_CONDUCTANCE, value);
+}
 
 /**
  * Magnetic Field Strength
@@ -264,7 +353,10 @@ extern BOOL vscp_evt_measurement64_sendElectricalConductance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendMagneticFieldStrength(double_t value);
+static inline BOOL vscp_evt_measurement64_sendMagneticFieldStrength(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_MAGNETIC_FIELD_STRENGTH, value);
+}
 
 /**
  * Magnetic Flux
@@ -273,7 +365,10 @@ extern BOOL vscp_evt_measurement64_sendMagneticFieldStrength(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendMagneticFlux(double_t value);
+static inline BOOL vscp_evt_measurement64_sendMagneticFlux(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_MAGNETIC_FLUX, value);
+}
 
 /**
  * Magnetic Flux Density
@@ -282,7 +377,10 @@ extern BOOL vscp_evt_measurement64_sendMagneticFlux(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendMagneticFluxDensity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendMagneticFluxDensity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_MAGNETIC_FLUX_DENSITY, value);
+}
 
 /**
  * Inductance
@@ -291,7 +389,10 @@ extern BOOL vscp_evt_measurement64_sendMagneticFluxDensity(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendInductance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendInductance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_INDUCTANCE, value);
+}
 
 /**
  * Luminous Flux
@@ -300,7 +401,10 @@ extern BOOL vscp_evt_measurement64_sendInductance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendLuminousFlux(double_t value);
+static inline BOOL vscp_evt_measurement64_sendLuminousFlux(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_FLUX_OF_LIGHT, value);
+}
 
 /**
  * Illuminance
@@ -309,7 +413,10 @@ extern BOOL vscp_evt_measurement64_sendLuminousFlux(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendIlluminance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendIlluminance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ILLUMINANCE, value);
+}
 
 /**
  * Radiation dose (absorbed)
@@ -318,7 +425,10 @@ extern BOOL vscp_evt_measurement64_sendIlluminance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRadiationDoseAbsorbed(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRadiationDoseAbsorbed(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RADIATION_DOSE_ABSORBED, value);
+}
 
 /**
  * Catalytic activity
@@ -327,7 +437,10 @@ extern BOOL vscp_evt_measurement64_sendRadiationDoseAbsorbed(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendCatalyticActivity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendCatalyticActivity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_CATALYTIC_ACITIVITY, value);
+}
 
 /**
  * Volume
@@ -336,7 +449,10 @@ extern BOOL vscp_evt_measurement64_sendCatalyticActivity(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendVolume(double_t value);
+static inline BOOL vscp_evt_measurement64_sendVolume(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_VOLUME, value);
+}
 
 /**
  * Sound intensity
@@ -345,7 +461,10 @@ extern BOOL vscp_evt_measurement64_sendVolume(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSoundIntensity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSoundIntensity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SOUND_INTENSITY, value);
+}
 
 /**
  * Angle
@@ -354,7 +473,10 @@ extern BOOL vscp_evt_measurement64_sendSoundIntensity(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendAngle(double_t value);
+static inline BOOL vscp_evt_measurement64_sendAngle(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ANGLE, value);
+}
 
 /**
  * Position WGS 84
@@ -363,7 +485,10 @@ extern BOOL vscp_evt_measurement64_sendAngle(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendPositionWgs84(double_t value);
+static inline BOOL vscp_evt_measurement64_sendPositionWgs84(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_POSITION, value);
+}
 
 /**
  * Speed
@@ -372,7 +497,10 @@ extern BOOL vscp_evt_measurement64_sendPositionWgs84(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSpeed(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSpeed(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SPEED, value);
+}
 
 /**
  * Acceleration
@@ -381,7 +509,10 @@ extern BOOL vscp_evt_measurement64_sendSpeed(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendAcceleration(double_t value);
+static inline BOOL vscp_evt_measurement64_sendAcceleration(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ACCELERATION, value);
+}
 
 /**
  * Tension
@@ -390,7 +521,10 @@ extern BOOL vscp_evt_measurement64_sendAcceleration(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendTension(double_t value);
+static inline BOOL vscp_evt_measurement64_sendTension(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_TENSION, value);
+}
 
 /**
  * Damp/moist (Hygrometer reading)
@@ -399,7 +533,10 @@ extern BOOL vscp_evt_measurement64_sendTension(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendDampMoistHygrometerReading(double_t value);
+static inline BOOL vscp_evt_measurement64_sendDampMoistHygrometerReading(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_HUMIDITY, value);
+}
 
 /**
  * Flow
@@ -408,7 +545,10 @@ extern BOOL vscp_evt_measurement64_sendDampMoistHygrometerReading(double_t value
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendFlow(double_t value);
+static inline BOOL vscp_evt_measurement64_sendFlow(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_FLOW, value);
+}
 
 /**
  * Thermal resistance
@@ -417,7 +557,10 @@ extern BOOL vscp_evt_measurement64_sendFlow(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendThermalResistance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendThermalResistance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_THERMAL_RESISTANCE, value);
+}
 
 /**
  * Refractive (optical) power
@@ -426,7 +569,10 @@ extern BOOL vscp_evt_measurement64_sendThermalResistance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRefractiveOpticalPower(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRefractiveOpticalPower(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_REFRACTIVE_POWER, value);
+}
 
 /**
  * Dynamic viscosity
@@ -435,7 +581,10 @@ extern BOOL vscp_evt_measurement64_sendRefractiveOpticalPower(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendDynamicViscosity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendDynamicViscosity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_DYNAMIC_VISCOSITY, value);
+}
 
 /**
  * Sound impedance
@@ -444,7 +593,10 @@ extern BOOL vscp_evt_measurement64_sendDynamicViscosity(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSoundImpedance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSoundImpedance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SOUND_IMPEDANCE, value);
+}
 
 /**
  * Sound resistance
@@ -453,7 +605,10 @@ extern BOOL vscp_evt_measurement64_sendSoundImpedance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSoundResistance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSoundResistance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SOUND_RESISTANCE, value);
+}
 
 /**
  * Electric elastance
@@ -462,7 +617,10 @@ extern BOOL vscp_evt_measurement64_sendSoundResistance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendElectricElastance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendElectricElastance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ELECTRIC_ELASTANCE, value);
+}
 
 /**
  * Luminous energy
@@ -471,7 +629,10 @@ extern BOOL vscp_evt_measurement64_sendElectricElastance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendLuminousEnergy(double_t value);
+static inline BOOL vscp_evt_measurement64_sendLuminousEnergy(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_LUMINOUS_ENERGY, value);
+}
 
 /**
  * Luminance
@@ -480,7 +641,10 @@ extern BOOL vscp_evt_measurement64_sendLuminousEnergy(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendLuminance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendLuminance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_LUMINANCE, value);
+}
 
 /**
  * Chemical (molar) concentration
@@ -489,7 +653,10 @@ extern BOOL vscp_evt_measurement64_sendLuminance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendChemicalMolarConcentration(double_t value);
+static inline BOOL vscp_evt_measurement64_sendChemicalMolarConcentration(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_CHEMICAL_CONCENTRATION_MOLAR, value);
+}
 
 /* "Chemical (mass) concentration" not supported. No frame defined. */
 
@@ -500,7 +667,10 @@ extern BOOL vscp_evt_measurement64_sendChemicalMolarConcentration(double_t value
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendReserved(double_t value);
+static inline BOOL vscp_evt_measurement64_sendReserved(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RESERVED47, value);
+}
 
 /* "Reserved" not supported. No frame defined. */
 
@@ -511,7 +681,10 @@ extern BOOL vscp_evt_measurement64_sendReserved(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendDewPoint(double_t value);
+static inline BOOL vscp_evt_measurement64_sendDewPoint(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_DEWPOINT, value);
+}
 
 /**
  * Relative Level
@@ -520,7 +693,10 @@ extern BOOL vscp_evt_measurement64_sendDewPoint(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRelativeLevel(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRelativeLevel(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RELATIVE_LEVEL, value);
+}
 
 /**
  * Altitude
@@ -529,7 +705,10 @@ extern BOOL vscp_evt_measurement64_sendRelativeLevel(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendAltitude(double_t value);
+static inline BOOL vscp_evt_measurement64_sendAltitude(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_ALTITUDE, value);
+}
 
 /**
  * Area
@@ -538,7 +717,10 @@ extern BOOL vscp_evt_measurement64_sendAltitude(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendArea(double_t value);
+static inline BOOL vscp_evt_measurement64_sendArea(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_AREA, value);
+}
 
 /**
  * Radiant intensity
@@ -547,7 +729,10 @@ extern BOOL vscp_evt_measurement64_sendArea(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRadiantIntensity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRadiantIntensity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RADIANT_INTENSITY, value);
+}
 
 /**
  * Radiance
@@ -556,7 +741,10 @@ extern BOOL vscp_evt_measurement64_sendRadiantIntensity(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRadiance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRadiance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RADIANCE, value);
+}
 
 /**
  * Irradiance, Exitance, Radiosity
@@ -565,7 +753,10 @@ extern BOOL vscp_evt_measurement64_sendRadiance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendIrradianceExitanceRadiosity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendIrradianceExitanceRadiosity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_IRRADIANCE, value);
+}
 
 /**
  * Spectral radiance
@@ -574,7 +765,10 @@ extern BOOL vscp_evt_measurement64_sendIrradianceExitanceRadiosity(double_t valu
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSpectralRadiance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSpectralRadiance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SPECTRAL_RADIANCE, value);
+}
 
 /**
  * Spectral irradiance
@@ -583,7 +777,10 @@ extern BOOL vscp_evt_measurement64_sendSpectralRadiance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSpectralIrradiance(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSpectralIrradiance(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SPECTRAL_IRRADIANCE, value);
+}
 
 /**
  * Sound pressure (acoustic pressure)
@@ -592,7 +789,10 @@ extern BOOL vscp_evt_measurement64_sendSpectralIrradiance(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSoundPressureAcousticPressure(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSoundPressureAcousticPressure(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SOUND_PRESSURE, value);
+}
 
 /**
  * Sound energy density
@@ -601,7 +801,10 @@ extern BOOL vscp_evt_measurement64_sendSoundPressureAcousticPressure(double_t va
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSoundEnergyDensity(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSoundEnergyDensity(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SOUND_DENSITY, value);
+}
 
 /**
  * Sound level
@@ -610,7 +813,10 @@ extern BOOL vscp_evt_measurement64_sendSoundEnergyDensity(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendSoundLevel(double_t value);
+static inline BOOL vscp_evt_measurement64_sendSoundLevel(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_SOUND_LEVEL, value);
+}
 
 /**
  * Radiation dose (equivalent)
@@ -619,7 +825,10 @@ extern BOOL vscp_evt_measurement64_sendSoundLevel(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRadiationDoseEquivalent(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRadiationDoseEquivalent(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_DOSE_EQUIVALENT, value);
+}
 
 /**
  * Radiation dose (exposure)
@@ -628,7 +837,10 @@ extern BOOL vscp_evt_measurement64_sendRadiationDoseEquivalent(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendRadiationDoseExposure(double_t value);
+static inline BOOL vscp_evt_measurement64_sendRadiationDoseExposure(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_RADIATION_DOSE_EXPOSURE, value);
+}
 
 /**
  * Power factor
@@ -637,7 +849,10 @@ extern BOOL vscp_evt_measurement64_sendRadiationDoseExposure(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendPowerFactor(double_t value);
+static inline BOOL vscp_evt_measurement64_sendPowerFactor(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_POWER_FACTOR, value);
+}
 
 /**
  * Reactive Power
@@ -646,7 +861,10 @@ extern BOOL vscp_evt_measurement64_sendPowerFactor(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendReactivePower(double_t value);
+static inline BOOL vscp_evt_measurement64_sendReactivePower(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_REACTIVE_POWER, value);
+}
 
 /**
  * Reactive Energy
@@ -655,7 +873,31 @@ extern BOOL vscp_evt_measurement64_sendReactivePower(double_t value);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurement64_sendReactiveEnergy(double_t value);
+static inline BOOL vscp_evt_measurement64_sendReactiveEnergy(double_t value)
+{
+    return vscp_evt_measurement64_sendByType(VSCP_TYPE_MEASUREMENT64_REACTIVE_ENERGY, value);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement64_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurement64_Common * const evt);
+
+/**
+ * Parse a received event of the "Double precision floating point measurement" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurement64_parse(vscp_RxMessage const * const msg, vscp_evt_measurement64_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -50,6 +50,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_data_coding.h"
+#include "vscp_type_measurezone.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -72,6 +75,29 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t index; /**< Index for sensor */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    vscp_data_coding_Value value; /**< Value */
+
+} vscp_evt_measurezone_Common;
+
+/** Parsed event of the "Measurement with zone" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_measurezone_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_measurezone_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -80,6 +106,20 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index for sensor.
+ * @param[in] zone Zone for which event applies to (0-255). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-255). 255 is all sub-zones.
+ * @param[in] data The data as signed integer.
+ * @param[in] exp The exponent of the data (10^exponent).
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurezone_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+
 /**
  * General event
  * 
@@ -98,7 +138,10 @@ extern BOOL vscp_evt_measurezone_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendCount(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendCount(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_COUNT, index, zone, subZone, data, exp);
+}
 
 /**
  * Length/Distance
@@ -111,7 +154,10 @@ extern BOOL vscp_evt_measurezone_sendCount(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendLengthDistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendLengthDistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_LENGTH, index, zone, subZone, data, exp);
+}
 
 /**
  * Mass
@@ -124,7 +170,10 @@ extern BOOL vscp_evt_measurezone_sendLengthDistance(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendMass(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendMass(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_MASS, index, zone, subZone, data, exp);
+}
 
 /**
  * Time
@@ -137,7 +186,10 @@ extern BOOL vscp_evt_measurezone_sendMass(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_TIME, index, zone, subZone, data, exp);
+}
 
 /**
  * Electric Current
@@ -150,7 +202,10 @@ extern BOOL vscp_evt_measurezone_sendTime(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricCurrent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricCurrent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRIC_CURRENT, index, zone, subZone, data, exp);
+}
 
 /**
  * Temperature
@@ -163,7 +218,10 @@ extern BOOL vscp_evt_measurezone_sendElectricCurrent(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendTemperature(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendTemperature(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_TEMPERATURE, index, zone, subZone, data, exp);
+}
 
 /**
  * Amount of substance
@@ -176,7 +234,10 @@ extern BOOL vscp_evt_measurezone_sendTemperature(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendAmountOfSubstance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendAmountOfSubstance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_AMOUNT_OF_SUBSTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Luminous Intensity (Intensity of light)
@@ -189,7 +250,10 @@ extern BOOL vscp_evt_measurezone_sendAmountOfSubstance(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_INTENSITY_OF_LIGHT, index, zone, subZone, data, exp);
+}
 
 /**
  * Frequency
@@ -202,7 +266,10 @@ extern BOOL vscp_evt_measurezone_sendLuminousIntensityIntensityOfLight(uint8_t i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendFrequency(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendFrequency(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_FREQUENCY, index, zone, subZone, data, exp);
+}
 
 /**
  * Radioactivity and other random events
@@ -215,7 +282,10 @@ extern BOOL vscp_evt_measurezone_sendFrequency(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RADIOACTIVITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Force
@@ -228,7 +298,10 @@ extern BOOL vscp_evt_measurezone_sendRadioactivityAndOtherRandomEvents(uint8_t i
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendForce(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendForce(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_FORCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Pressure
@@ -241,7 +314,10 @@ extern BOOL vscp_evt_measurezone_sendForce(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendPressure(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendPressure(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_PRESSURE, index, zone, subZone, data, exp);
+}
 
 /**
  * Energy
@@ -254,7 +330,10 @@ extern BOOL vscp_evt_measurezone_sendPressure(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendEnergy(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendEnergy(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ENERGY, index, zone, subZone, data, exp);
+}
 
 /**
  * Power
@@ -267,7 +346,10 @@ extern BOOL vscp_evt_measurezone_sendEnergy(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendPower(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendPower(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_POWER, index, zone, subZone, data, exp);
+}
 
 /**
  * Electrical Charge
@@ -280,7 +362,10 @@ extern BOOL vscp_evt_measurezone_sendPower(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricalCharge(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricalCharge(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRICAL_CHARGE, index, zone, subZone, data, exp);
+}
 
 /**
  * Electrical Potential (Voltage)
@@ -293,7 +378,10 @@ extern BOOL vscp_evt_measurezone_sendElectricalCharge(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricalPotentialVoltage(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricalPotentialVoltage(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRICAL_POTENTIAL, index, zone, subZone, data, exp);
+}
 
 /**
  * Electrical Capacitance
@@ -306,7 +394,10 @@ extern BOOL vscp_evt_measurezone_sendElectricalPotentialVoltage(uint8_t index, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricalCapacitance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricalCapacitance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRICAL_CAPACITANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Electrical Resistance
@@ -319,7 +410,10 @@ extern BOOL vscp_evt_measurezone_sendElectricalCapacitance(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricalResistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricalResistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRICAL_RESISTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Electrical Conductance
@@ -332,7 +426,10 @@ extern BOOL vscp_evt_measurezone_sendElectricalResistance(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricalConductance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricalConductance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRICAL_CONDUCTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Magnetic Field Strength
@@ -345,7 +442,10 @@ extern BOOL vscp_evt_measurezone_sendElectricalConductance(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendMagneticFieldStrength(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendMagneticFieldStrength(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_MAGNETIC_FIELD_STRENGTH, index, zone, subZone, data, exp);
+}
 
 /**
  * Magnetic Flux
@@ -358,7 +458,10 @@ extern BOOL vscp_evt_measurezone_sendMagneticFieldStrength(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendMagneticFlux(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendMagneticFlux(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_MAGNETIC_FLUX, index, zone, subZone, data, exp);
+}
 
 /**
  * Magnetic Flux Density
@@ -371,7 +474,10 @@ extern BOOL vscp_evt_measurezone_sendMagneticFlux(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendMagneticFluxDensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendMagneticFluxDensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_MAGNETIC_FLUX_DENSITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Inductance
@@ -384,7 +490,10 @@ extern BOOL vscp_evt_measurezone_sendMagneticFluxDensity(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendInductance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendInductance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_INDUCTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Luminous Flux
@@ -397,7 +506,10 @@ extern BOOL vscp_evt_measurezone_sendInductance(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendLuminousFlux(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendLuminousFlux(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_FLUX_OF_LIGHT, index, zone, subZone, data, exp);
+}
 
 /**
  * Illuminance
@@ -410,7 +522,10 @@ extern BOOL vscp_evt_measurezone_sendLuminousFlux(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendIlluminance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendIlluminance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ILLUMINANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Radiation dose (absorbed)
@@ -423,7 +538,10 @@ extern BOOL vscp_evt_measurezone_sendIlluminance(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRadiationDoseAbsorbed(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRadiationDoseAbsorbed(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RADIATION_DOSE_ABSORBED, index, zone, subZone, data, exp);
+}
 
 /**
  * Catalytic activity
@@ -436,7 +554,10 @@ extern BOOL vscp_evt_measurezone_sendRadiationDoseAbsorbed(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendCatalyticActivity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendCatalyticActivity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_CATALYTIC_ACITIVITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Volume
@@ -449,7 +570,10 @@ extern BOOL vscp_evt_measurezone_sendCatalyticActivity(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendVolume(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendVolume(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_VOLUME, index, zone, subZone, data, exp);
+}
 
 /**
  * Sound intensity
@@ -462,7 +586,10 @@ extern BOOL vscp_evt_measurezone_sendVolume(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSoundIntensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSoundIntensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SOUND_INTENSITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Angle
@@ -475,7 +602,10 @@ extern BOOL vscp_evt_measurezone_sendSoundIntensity(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendAngle(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendAngle(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ANGLE, index, zone, subZone, data, exp);
+}
 
 /**
  * Position WGS 84
@@ -488,7 +618,10 @@ extern BOOL vscp_evt_measurezone_sendAngle(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendPositionWgs84(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendPositionWgs84(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_POSITION, index, zone, subZone, data, exp);
+}
 
 /**
  * Speed
@@ -501,7 +634,10 @@ extern BOOL vscp_evt_measurezone_sendPositionWgs84(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SPEED, index, zone, subZone, data, exp);
+}
 
 /**
  * Acceleration
@@ -514,7 +650,10 @@ extern BOOL vscp_evt_measurezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendAcceleration(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendAcceleration(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ACCELERATION, index, zone, subZone, data, exp);
+}
 
 /**
  * Tension
@@ -527,7 +666,10 @@ extern BOOL vscp_evt_measurezone_sendAcceleration(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendTension(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendTension(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_TENSION, index, zone, subZone, data, exp);
+}
 
 /**
  * Damp/moist (Hygrometer reading)
@@ -540,7 +682,10 @@ extern BOOL vscp_evt_measurezone_sendTension(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendDampMoistHygrometerReading(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendDampMoistHygrometerReading(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_HUMIDITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Flow
@@ -553,7 +698,10 @@ extern BOOL vscp_evt_measurezone_sendDampMoistHygrometerReading(uint8_t index, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendFlow(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendFlow(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_FLOW, index, zone, subZone, data, exp);
+}
 
 /**
  * Thermal resistance
@@ -566,7 +714,10 @@ extern BOOL vscp_evt_measurezone_sendFlow(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendThermalResistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendThermalResistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_THERMAL_RESISTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Refractive (optical) power
@@ -579,7 +730,10 @@ extern BOOL vscp_evt_measurezone_sendThermalResistance(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRefractiveOpticalPower(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRefractiveOpticalPower(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_REFRACTIVE_POWER, index, zone, subZone, data, exp);
+}
 
 /**
  * Dynamic viscosity
@@ -592,7 +746,10 @@ extern BOOL vscp_evt_measurezone_sendRefractiveOpticalPower(uint8_t index, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendDynamicViscosity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendDynamicViscosity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_DYNAMIC_VISCOSITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Sound impedance
@@ -605,7 +762,10 @@ extern BOOL vscp_evt_measurezone_sendDynamicViscosity(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSoundImpedance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSoundImpedance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SOUND_IMPEDANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Sound resistance
@@ -618,7 +778,10 @@ extern BOOL vscp_evt_measurezone_sendSoundImpedance(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSoundResistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSoundResistance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SOUND_RESISTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Electric elastance
@@ -631,7 +794,10 @@ extern BOOL vscp_evt_measurezone_sendSoundResistance(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendElectricElastance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendElectricElastance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ELECTRIC_ELASTANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Luminous energy
@@ -644,7 +810,10 @@ extern BOOL vscp_evt_measurezone_sendElectricElastance(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendLuminousEnergy(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendLuminousEnergy(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_LUMINOUS_ENERGY, index, zone, subZone, data, exp);
+}
 
 /**
  * Luminance
@@ -657,7 +826,10 @@ extern BOOL vscp_evt_measurezone_sendLuminousEnergy(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendLuminance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendLuminance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_LUMINANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Chemical (molar) concentration
@@ -670,7 +842,10 @@ extern BOOL vscp_evt_measurezone_sendLuminance(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendChemicalMolarConcentration(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendChemicalMolarConcentration(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_CHEMICAL_CONCENTRATION_MOLAR, index, zone, subZone, data, exp);
+}
 
 /* "Chemical (mass) concentration" not supported. No frame defined. */
 
@@ -685,7 +860,10 @@ extern BOOL vscp_evt_measurezone_sendChemicalMolarConcentration(uint8_t index, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendReserved(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendReserved(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RESERVED47, index, zone, subZone, data, exp);
+}
 
 /* "Reserved" not supported. No frame defined. */
 
@@ -700,7 +878,10 @@ extern BOOL vscp_evt_measurezone_sendReserved(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_DEWPOINT, index, zone, subZone, data, exp);
+}
 
 /**
  * Relative Level
@@ -713,7 +894,10 @@ extern BOOL vscp_evt_measurezone_sendDewPoint(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRelativeLevel(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRelativeLevel(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RELATIVE_LEVEL, index, zone, subZone, data, exp);
+}
 
 /**
  * Altitude
@@ -726,7 +910,10 @@ extern BOOL vscp_evt_measurezone_sendRelativeLevel(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_ALTITUDE, index, zone, subZone, data, exp);
+}
 
 /**
  * Area
@@ -739,7 +926,10 @@ extern BOOL vscp_evt_measurezone_sendAltitude(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendArea(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendArea(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_AREA, index, zone, subZone, data, exp);
+}
 
 /**
  * Radiant intensity
@@ -752,7 +942,10 @@ extern BOOL vscp_evt_measurezone_sendArea(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRadiantIntensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRadiantIntensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RADIANT_INTENSITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Radiance
@@ -765,7 +958,10 @@ extern BOOL vscp_evt_measurezone_sendRadiantIntensity(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRadiance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRadiance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RADIANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Irradiance, Exitance, Radiosity
@@ -778,7 +974,10 @@ extern BOOL vscp_evt_measurezone_sendRadiance(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_IRRADIANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Spectral radiance
@@ -791,7 +990,10 @@ extern BOOL vscp_evt_measurezone_sendIrradianceExitanceRadiosity(uint8_t index,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSpectralRadiance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSpectralRadiance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SPECTRAL_RADIANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Spectral irradiance
@@ -804,7 +1006,10 @@ extern BOOL vscp_evt_measurezone_sendSpectralRadiance(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSpectralIrradiance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSpectralIrradiance(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SPECTRAL_IRRADIANCE, index, zone, subZone, data, exp);
+}
 
 /**
  * Sound pressure (acoustic pressure)
@@ -817,7 +1022,10 @@ extern BOOL vscp_evt_measurezone_sendSpectralIrradiance(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSoundPressureAcousticPressure(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSoundPressureAcousticPressure(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SOUND_PRESSURE, index, zone, subZone, data, exp);
+}
 
 /**
  * Sound energy density
@@ -830,7 +1038,10 @@ extern BOOL vscp_evt_measurezone_sendSoundPressureAcousticPressure(uint8_t index
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSoundEnergyDensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSoundEnergyDensity(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SOUND_DENSITY, index, zone, subZone, data, exp);
+}
 
 /**
  * Sound level
@@ -843,7 +1054,10 @@ extern BOOL vscp_evt_measurezone_sendSoundEnergyDensity(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendSoundLevel(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendSoundLevel(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_SOUND_LEVEL, index, zone, subZone, data, exp);
+}
 
 /**
  * Radiation dose (equivalent)
@@ -856,7 +1070,10 @@ extern BOOL vscp_evt_measurezone_sendSoundLevel(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRadiationDoseEquivalent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRadiationDoseEquivalent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_DOSE_EQUIVALENT, index, zone, subZone, data, exp);
+}
 
 /**
  * Radiation dose (exposure)
@@ -869,7 +1086,10 @@ extern BOOL vscp_evt_measurezone_sendRadiationDoseEquivalent(uint8_t index, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendRadiationDoseExposure(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendRadiationDoseExposure(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_RADIATION_DOSE_EXPOSURE, index, zone, subZone, data, exp);
+}
 
 /**
  * Power factor
@@ -882,7 +1102,10 @@ extern BOOL vscp_evt_measurezone_sendRadiationDoseExposure(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendPowerFactor(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendPowerFactor(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_POWER_FACTOR, index, zone, subZone, data, exp);
+}
 
 /**
  * Reactive Power
@@ -895,7 +1118,10 @@ extern BOOL vscp_evt_measurezone_sendPowerFactor(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendReactivePower(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendReactivePower(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_REACTIVE_POWER, index, zone, subZone, data, exp);
+}
 
 /**
  * Reactive Energy
@@ -908,7 +1134,31 @@ extern BOOL vscp_evt_measurezone_sendReactivePower(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_measurezone_sendReactiveEnergy(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_evt_measurezone_sendReactiveEnergy(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_evt_measurezone_sendByType(VSCP_TYPE_MEASUREZONE_REACTIVE_ENERGY, index, zone, subZone, data, exp);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurezone_parseCommon(vscp_RxMessage const * const msg, vscp_evt_measurezone_Common * const evt);
+
+/**
+ * Parse a received event of the "Measurement with zone" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_measurezone_parse(vscp_RxMessage const * const msg, vscp_evt_measurezone_Event * const evt);
 
 #ifdef __cplusplus
 }
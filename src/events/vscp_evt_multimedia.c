@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_multimedia.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -1221,3 +1222,1193 @@ extern BOOL vscp_evt_multimedia_sendMultimediaControl(uint8_t control, uint8_t z
 
 /* "Multimedia Control response" not supported. No frame defined. */
 
+/**
+ * Parse the "Playback" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Playback" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parsePlayback(vscp_RxMessage const * const msg, vscp_evt_multimedia_Playback * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_PLAYBACK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->function = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "NavigatorKey English" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NavigatorKey English" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseNavigatorkeyEnglish(vscp_RxMessage const * const msg, vscp_evt_multimedia_NavigatorkeyEnglish * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_NAVIGATOR_KEY_ENG != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->function = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Contrast" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Contrast" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustContrast(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustContrast * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_CONTRAST != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->contrast = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Focus" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Focus" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustFocus(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustFocus * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_FOCUS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->focus = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Tint" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Tint" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustTint(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustTint * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_TINT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->tint = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Color Balance" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Color Balance" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustColorBalance(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustColorBalance * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_COLOUR_BALANCE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Brightness" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Brightness" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustBrightness(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustBrightness * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_BRIGHTNESS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->brightness = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Hue" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Hue" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustHue(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustHue * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_HUE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->hue = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Bass" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Bass" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustBass(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustBass * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_BASS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->bass = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Treble" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Treble" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustTreble(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustTreble * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_TREBLE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->treble = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Master Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Master Volume" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustMasterVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustMasterVolume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_MASTER_VOLUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->volume = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Front Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Front Volume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustFrontVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustFrontVolume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_FRONT_VOLUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->volume = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Center Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Center Volume" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustCenterVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustCenterVolume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_CENTRE_VOLUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->volume = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Rear Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Rear Volume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustRearVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustRearVolume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_REAR_VOLUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->volume = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Adjust Side Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Side Volume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustSideVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustSideVolume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SIDE_VOLUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->volume = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Disk" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Disk" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectDisk(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectDisk * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_DISK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->discNo = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Track" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Track" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectTrack(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectTrack * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_TRACK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->track = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Album/Play list" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Album/Play list" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectAlbumPlayList(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectAlbumPlayList * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_ALBUM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->album = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Channel" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Channel" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectChannel(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectChannel * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHANNEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->channel = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Page" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Page" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectPage(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectPage * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_PAGE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->page = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Chapter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Chapter" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectChapter(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectChapter * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHAPTER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->chapter = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Screen Format" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Screen Format" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectScreenFormat(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectScreenFormat * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_SCREEN_FORMAT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->format = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Input Source" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Input Source" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectInputSource(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectInputSource * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_INPUT_SOURCE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->source = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Select Output" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Output" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectOutput(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectOutput * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_OUTPUT != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->output = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Record" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Record" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseRecord(vscp_RxMessage const * const msg, vscp_evt_multimedia_Record * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_RECORD != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->function = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set Recording Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set Recording Volume" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSetRecordingVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_SetRecordingVolume * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_SET_RECORDING_VOLUME != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->volume = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Tivo Function" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Tivo Function" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseTivoFunction(vscp_RxMessage const * const msg, vscp_evt_multimedia_TivoFunction * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_TIVO_FUNCTION != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->tivoCode = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Get Current Title" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get Current Title" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseGetCurrentTitle(vscp_RxMessage const * const msg, vscp_evt_multimedia_GetCurrentTitle * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_GET_CURRENT_TITLE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set media position in milliseconds" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set media position in milliseconds" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSetMediaPositionInMilliseconds(vscp_RxMessage const * const msg, vscp_evt_multimedia_SetMediaPositionInMilliseconds * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_SET_POSITION != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->pos[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->posSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Get media information" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get media information" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseGetMediaInformation(vscp_RxMessage const * const msg, vscp_evt_multimedia_GetMediaInformation * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_GET_MEDIA_INFO != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->type = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Remove Item from Album" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Remove Item from Album" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseRemoveItemFromAlbum(vscp_RxMessage const * const msg, vscp_evt_multimedia_RemoveItemFromAlbum * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_REMOVE_ITEM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->item = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Remove all Items from Album" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Remove all Items from Album" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseRemoveAllItemsFromAlbum(vscp_RxMessage const * const msg, vscp_evt_multimedia_RemoveAllItemsFromAlbum * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_REMOVE_ALL_ITEMS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->reserved = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Save Album/Play list" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save Album/Play list" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSaveAlbumPlayList(vscp_RxMessage const * const msg, vscp_evt_multimedia_SaveAlbumPlayList * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_SAVE_ALBUM != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->function = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Multimedia Control" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Multimedia Control" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseMultimediaControl(vscp_RxMessage const * const msg, vscp_evt_multimedia_MultimediaControl * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass) || (VSCP_TYPE_MULTIMEDIA_CONTROL != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->control = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->index = msg->data[3];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((4 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[4 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Multimedia" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parse(vscp_RxMessage const * const msg, vscp_evt_multimedia_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_MULTIMEDIA != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_MULTIMEDIA_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_PLAYBACK:
+        status = vscp_evt_multimedia_parsePlayback(msg, &evt->data.playback);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_NAVIGATOR_KEY_ENG:
+        status = vscp_evt_multimedia_parseNavigatorkeyEnglish(msg, &evt->data.navigatorkeyEnglish);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_CONTRAST:
+        status = vscp_evt_multimedia_parseAdjustContrast(msg, &evt->data.adjustContrast);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_FOCUS:
+        status = vscp_evt_multimedia_parseAdjustFocus(msg, &evt->data.adjustFocus);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_TINT:
+        status = vscp_evt_multimedia_parseAdjustTint(msg, &evt->data.adjustTint);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_COLOUR_BALANCE:
+        status = vscp_evt_multimedia_parseAdjustColorBalance(msg, &evt->data.adjustColorBalance);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_BRIGHTNESS:
+        status = vscp_evt_multimedia_parseAdjustBrightness(msg, &evt->data.adjustBrightness);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_HUE:
+        status = vscp_evt_multimedia_parseAdjustHue(msg, &evt->data.adjustHue);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_BASS:
+        status = vscp_evt_multimedia_parseAdjustBass(msg, &evt->data.adjustBass);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_TREBLE:
+        status = vscp_evt_multimedia_parseAdjustTreble(msg, &evt->data.adjustTreble);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_MASTER_VOLUME:
+        status = vscp_evt_multimedia_parseAdjustMasterVolume(msg, &evt->data.adjustMasterVolume);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_FRONT_VOLUME:
+        status = vscp_evt_multimedia_parseAdjustFrontVolume(msg, &evt->data.adjustFrontVolume);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_CENTRE_VOLUME:
+        status = vscp_evt_multimedia_parseAdjustCenterVolume(msg, &evt->data.adjustCenterVolume);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_REAR_VOLUME:
+        status = vscp_evt_multimedia_parseAdjustRearVolume(msg, &evt->data.adjustRearVolume);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SIDE_VOLUME:
+        status = vscp_evt_multimedia_parseAdjustSideVolume(msg, &evt->data.adjustSideVolume);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_DISK:
+        status = vscp_evt_multimedia_parseSelectDisk(msg, &evt->data.selectDisk);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_TRACK:
+        status = vscp_evt_multimedia_parseSelectTrack(msg, &evt->data.selectTrack);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_ALBUM:
+        status = vscp_evt_multimedia_parseSelectAlbumPlayList(msg, &evt->data.selectAlbumPlayList);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHANNEL:
+        status = vscp_evt_multimedia_parseSelectChannel(msg, &evt->data.selectChannel);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_PAGE:
+        status = vscp_evt_multimedia_parseSelectPage(msg, &evt->data.selectPage);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHAPTER:
+        status = vscp_evt_multimedia_parseSelectChapter(msg, &evt->data.selectChapter);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_SCREEN_FORMAT:
+        status = vscp_evt_multimedia_parseSelectScreenFormat(msg, &evt->data.selectScreenFormat);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_INPUT_SOURCE:
+        status = vscp_evt_multimedia_parseSelectInputSource(msg, &evt->data.selectInputSource);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_OUTPUT:
+        status = vscp_evt_multimedia_parseSelectOutput(msg, &evt->data.selectOutput);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_RECORD:
+        status = vscp_evt_multimedia_parseRecord(msg, &evt->data.record);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_SET_RECORDING_VOLUME:
+        status = vscp_evt_multimedia_parseSetRecordingVolume(msg, &evt->data.setRecordingVolume);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_TIVO_FUNCTION:
+        status = vscp_evt_multimedia_parseTivoFunction(msg, &evt->data.tivoFunction);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_GET_CURRENT_TITLE:
+        status = vscp_evt_multimedia_parseGetCurrentTitle(msg, &evt->data.getCurrentTitle);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_SET_POSITION:
+        status = vscp_evt_multimedia_parseSetMediaPositionInMilliseconds(msg, &evt->data.setMediaPositionInMilliseconds);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_GET_MEDIA_INFO:
+        status = vscp_evt_multimedia_parseGetMediaInformation(msg, &evt->data.getMediaInformation);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_REMOVE_ITEM:
+        status = vscp_evt_multimedia_parseRemoveItemFromAlbum(msg, &evt->data.removeItemFromAlbum);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_REMOVE_ALL_ITEMS:
+        status = vscp_evt_multimedia_parseRemoveAllItemsFromAlbum(msg, &evt->data.removeAllItemsFromAlbum);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_SAVE_ALBUM:
+        status = vscp_evt_multimedia_parseSaveAlbumPlayList(msg, &evt->data.saveAlbumPlayList);
+        break;
+
+    case VSCP_TYPE_MULTIMEDIA_CONTROL:
+        status = vscp_evt_multimedia_parseMultimediaControl(msg, &evt->data.multimediaControl);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -48,6 +48,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -70,6 +71,363 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Playback" event. */
+typedef struct
+{
+    uint8_t function; /**< Function */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_Playback;
+
+/** Parameters of the "NavigatorKey English" event. */
+typedef struct
+{
+    uint8_t function; /**< Function */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_NavigatorkeyEnglish;
+
+/** Parameters of the "Adjust Contrast" event. */
+typedef struct
+{
+    uint8_t contrast; /**< Contrast */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustContrast;
+
+/** Parameters of the "Adjust Focus" event. */
+typedef struct
+{
+    uint8_t focus; /**< Focus */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustFocus;
+
+/** Parameters of the "Adjust Tint" event. */
+typedef struct
+{
+    uint8_t tint; /**< Tint */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustTint;
+
+/** Parameters of the "Adjust Color Balance" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustColorBalance;
+
+/** Parameters of the "Adjust Brightness" event. */
+typedef struct
+{
+    uint8_t brightness; /**< Brightness */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustBrightness;
+
+/** Parameters of the "Adjust Hue" event. */
+typedef struct
+{
+    uint8_t hue; /**< Hue */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustHue;
+
+/** Parameters of the "Adjust Bass" event. */
+typedef struct
+{
+    uint8_t bass; /**< Bass */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustBass;
+
+/** Parameters of the "Adjust Treble" event. */
+typedef struct
+{
+    uint8_t treble; /**< Treble */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustTreble;
+
+/** Parameters of the "Adjust Master Volume" event. */
+typedef struct
+{
+    uint8_t volume; /**< Volume */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustMasterVolume;
+
+/** Parameters of the "Adjust Front Volume" event. */
+typedef struct
+{
+    uint8_t volume; /**< Volume */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustFrontVolume;
+
+/** Parameters of the "Adjust Center Volume" event. */
+typedef struct
+{
+    uint8_t volume; /**< Volume */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustCenterVolume;
+
+/** Parameters of the "Adjust Rear Volume" event. */
+typedef struct
+{
+    uint8_t volume; /**< Volume */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustRearVolume;
+
+/** Parameters of the "Adjust Side Volume" event. */
+typedef struct
+{
+    uint8_t volume; /**< Volume */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_AdjustSideVolume;
+
+/** Parameters of the "Select Disk" event. */
+typedef struct
+{
+    uint8_t discNo; /**< Disc No */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectDisk;
+
+/** Parameters of the "Select Track" event. */
+typedef struct
+{
+    uint8_t track; /**< Track */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectTrack;
+
+/** Parameters of the "Select Album/Play list" event. */
+typedef struct
+{
+    uint8_t album; /**< Album */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectAlbumPlayList;
+
+/** Parameters of the "Select Channel" event. */
+typedef struct
+{
+    uint8_t channel; /**< Channel */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectChannel;
+
+/** Parameters of the "Select Page" event. */
+typedef struct
+{
+    uint8_t page; /**< Page */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectPage;
+
+/** Parameters of the "Select Chapter" event. */
+typedef struct
+{
+    uint8_t chapter; /**< Chapter */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectChapter;
+
+/** Parameters of the "Select Screen Format" event. */
+typedef struct
+{
+    uint8_t format; /**< Format */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectScreenFormat;
+
+/** Parameters of the "Select Input Source" event. */
+typedef struct
+{
+    uint8_t source; /**< Source */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectInputSource;
+
+/** Parameters of the "Select Output" event. */
+typedef struct
+{
+    uint8_t output; /**< Output */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SelectOutput;
+
+/** Parameters of the "Record" event. */
+typedef struct
+{
+    uint8_t function; /**< Function */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_Record;
+
+/** Parameters of the "Set Recording Volume" event. */
+typedef struct
+{
+    uint8_t volume; /**< Volume */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SetRecordingVolume;
+
+/** Parameters of the "Tivo Function" event. */
+typedef struct
+{
+    uint8_t tivoCode; /**< Tivo Code */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_TivoFunction;
+
+/** Parameters of the "Get Current Title" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_GetCurrentTitle;
+
+/** Parameters of the "Set media position in milliseconds" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t pos[5]; /**< Pos */
+    uint8_t posSize; /**< Pos size */
+
+} vscp_evt_multimedia_SetMediaPositionInMilliseconds;
+
+/** Parameters of the "Get media information" event. */
+typedef struct
+{
+    uint8_t type; /**< Type */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_GetMediaInformation;
+
+/** Parameters of the "Remove Item from Album" event. */
+typedef struct
+{
+    uint8_t item; /**< Item */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_RemoveItemFromAlbum;
+
+/** Parameters of the "Remove all Items from Album" event. */
+typedef struct
+{
+    uint8_t reserved; /**< Reserved */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_RemoveAllItemsFromAlbum;
+
+/** Parameters of the "Save Album/Play list" event. */
+typedef struct
+{
+    uint8_t function; /**< Function */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_multimedia_SaveAlbumPlayList;
+
+/** Parameters of the "Multimedia Control" event. */
+typedef struct
+{
+    uint8_t control; /**< Control */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t index; /**< Index */
+    uint8_t data[5]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_multimedia_MultimediaControl;
+
+/** Parsed event of the "Multimedia" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_multimedia_Playback playback; /**< Parameters of the "Playback" event */
+        vscp_evt_multimedia_NavigatorkeyEnglish navigatorkeyEnglish; /**< Parameters of the "NavigatorKey English" event */
+        vscp_evt_multimedia_AdjustContrast adjustContrast; /**< Parameters of the "Adjust Contrast" event */
+        vscp_evt_multimedia_AdjustFocus adjustFocus; /**< Parameters of the "Adjust Focus" event */
+        vscp_evt_multimedia_AdjustTint adjustTint; /**< Parameters of the "Adjust Tint" event */
+        vscp_evt_multimedia_AdjustColorBalance adjustColorBalance; /**< Parameters of the "Adjust Color Balance" event */
+        vscp_evt_multimedia_AdjustBrightness adjustBrightness; /**< Parameters of the "Adjust Brightness" event */
+        vscp_evt_multimedia_AdjustHue adjustHue; /**< Parameters of the "Adjust Hue" event */
+        vscp_evt_multimedia_AdjustBass adjustBass; /**< Parameters of the "Adjust Bass" event */
+        vscp_evt_multimedia_AdjustTreble adjustTreble; /**< Parameters of the "Adjust Treble" event */
+        vscp_evt_multimedia_AdjustMasterVolume adjustMasterVolume; /**< Parameters of the "Adjust Master Volume" event */
+        vscp_evt_multimedia_AdjustFrontVolume adjustFrontVolume; /**< Parameters of the "Adjust Front Volume" event */
+        vscp_evt_multimedia_AdjustCenterVolume adjustCenterVolume; /**< Parameters of the "Adjust Center Volume" event */
+        vscp_evt_multimedia_AdjustRearVolume adjustRearVolume; /**< Parameters of the "Adjust Rear Volume" event */
+        vscp_evt_multimedia_AdjustSideVolume adjustSideVolume; /**< Parameters of the "Adjust Side Volume" event */
+        vscp_evt_multimedia_SelectDisk selectDisk; /**< Parameters of the "Select Disk" event */
+        vscp_evt_multimedia_SelectTrack selectTrack; /**< Parameters of the "Select Track" event */
+        vscp_evt_multimedia_SelectAlbumPlayList selectAlbumPlayList; /**< Parameters of the "Select Album/Play list" event */
+        vscp_evt_multimedia_SelectChannel selectChannel; /**< Parameters of the "Select Channel" event */
+        vscp_evt_multimedia_SelectPage selectPage; /**< Parameters of the "Select Page" event */
+        vscp_evt_multimedia_SelectChapter selectChapter; /**< Parameters of the "Select Chapter" event */
+        vscp_evt_multimedia_SelectScreenFormat selectScreenFormat; /**< Parameters of the "Select Screen Format" event */
+        vscp_evt_multimedia_SelectInputSource selectInputSource; /**< Parameters of the "Select Input Source" event */
+        vscp_evt_multimedia_SelectOutput selectOutput; /**< Parameters of the "Select Output" event */
+        vscp_evt_multimedia_Record record; /**< Parameters of the "Record" event */
+        vscp_evt_multimedia_SetRecordingVolume setRecordingVolume; /**< Parameters of the "Set Recording Volume" event */
+        vscp_evt_multimedia_TivoFunction tivoFunction; /**< Parameters of the "Tivo Function" event */
+        vscp_evt_multimedia_GetCurrentTitle getCurrentTitle; /**< Parameters of the "Get Current Title" event */
+        vscp_evt_multimedia_SetMediaPositionInMilliseconds setMediaPositionInMilliseconds; /**< Parameters of the "Set media position in milliseconds" event */
+        vscp_evt_multimedia_GetMediaInformation getMediaInformation; /**< Parameters of the "Get media information" event */
+        vscp_evt_multimedia_RemoveItemFromAlbum removeItemFromAlbum; /**< Parameters of the "Remove Item from Album" event */
+        vscp_evt_multimedia_RemoveAllItemsFromAlbum removeAllItemsFromAlbum; /**< Parameters of the "Remove all Items from Album" event */
+        vscp_evt_multimedia_SaveAlbumPlayList saveAlbumPlayList; /**< Parameters of the "Save Album/Play list" event */
+        vscp_evt_multimedia_MultimediaControl multimediaControl; /**< Parameters of the "Multimedia Control" event */
+    } data;
+
+} vscp_evt_multimedia_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -536,6 +894,369 @@ extern BOOL vscp_evt_multimedia_sendMultimediaControl(uint8_t control, uint8_t z
 
 /* "Multimedia Control response" not supported. No frame defined. */
 
+/**
+ * Parse the "Playback" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Playback" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parsePlayback(vscp_RxMessage const * const msg, vscp_evt_multimedia_Playback * const evt);
+
+/**
+ * Parse the "NavigatorKey English" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NavigatorKey English" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseNavigatorkeyEnglish(vscp_RxMessage const * const msg, vscp_evt_multimedia_NavigatorkeyEnglish * const evt);
+
+/**
+ * Parse the "Adjust Contrast" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Contrast" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustContrast(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustContrast * const evt);
+
+/**
+ * Parse the "Adjust Focus" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Focus" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustFocus(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustFocus * const evt);
+
+/**
+ * Parse the "Adjust Tint" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Tint" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustTint(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustTint * const evt);
+
+/**
+ * Parse the "Adjust Color Balance" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Color Balance" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustColorBalance(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustColorBalance * const evt);
+
+/**
+ * Parse the "Adjust Brightness" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Brightness" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustBrightness(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustBrightness * const evt);
+
+/**
+ * Parse the "Adjust Hue" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Hue" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustHue(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustHue * const evt);
+
+/**
+ * Parse the "Adjust Bass" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Bass" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustBass(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustBass * const evt);
+
+/**
+ * Parse the "Adjust Treble" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Treble" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustTreble(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustTreble * const evt);
+
+/**
+ * Parse the "Adjust Master Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Master Volume" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustMasterVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustMasterVolume * const evt);
+
+/**
+ * Parse the "Adjust Front Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Front Volume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustFrontVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustFrontVolume * const evt);
+
+/**
+ * Parse the "Adjust Center Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Center Volume" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustCenterVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustCenterVolume * const evt);
+
+/**
+ * Parse the "Adjust Rear Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Rear Volume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustRearVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustRearVolume * const evt);
+
+/**
+ * Parse the "Adjust Side Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Adjust Side Volume" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseAdjustSideVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_AdjustSideVolume * const evt);
+
+/**
+ * Parse the "Select Disk" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Disk" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectDisk(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectDisk * const evt);
+
+/**
+ * Parse the "Select Track" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Track" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectTrack(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectTrack * const evt);
+
+/**
+ * Parse the "Select Album/Play list" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Album/Play list" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectAlbumPlayList(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectAlbumPlayList * const evt);
+
+/**
+ * Parse the "Select Channel" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Channel" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectChannel(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectChannel * const evt);
+
+/**
+ * Parse the "Select Page" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Page" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectPage(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectPage * const evt);
+
+/**
+ * Parse the "Select Chapter" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Chapter" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectChapter(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectChapter * const evt);
+
+/**
+ * Parse the "Select Screen Format" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Screen Format" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectScreenFormat(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectScreenFormat * const evt);
+
+/**
+ * Parse the "Select Input Source" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Input Source" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectInputSource(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectInputSource * const evt);
+
+/**
+ * Parse the "Select Output" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Select Output" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSelectOutput(vscp_RxMessage const * const msg, vscp_evt_multimedia_SelectOutput * const evt);
+
+/**
+ * Parse the "Record" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Record" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseRecord(vscp_RxMessage const * const msg, vscp_evt_multimedia_Record * const evt);
+
+/**
+ * Parse the "Set Recording Volume" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set Recording Volume" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSetRecordingVolume(vscp_RxMessage const * const msg, vscp_evt_multimedia_SetRecordingVolume * const evt);
+
+/**
+ * Parse the "Tivo Function" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Tivo Function" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseTivoFunction(vscp_RxMessage const * const msg, vscp_evt_multimedia_TivoFunction * const evt);
+
+/**
+ * Parse the "Get Current Title" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get Current Title" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseGetCurrentTitle(vscp_RxMessage const * const msg, vscp_evt_multimedia_GetCurrentTitle * const evt);
+
+/**
+ * Parse the "Set media position in milliseconds" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set media position in milliseconds" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSetMediaPositionInMilliseconds(vscp_RxMessage const * const msg, vscp_evt_multimedia_SetMediaPositionInMilliseconds * const evt);
+
+/**
+ * Parse the "Get media information" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get media information" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseGetMediaInformation(vscp_RxMessage const * const msg, vscp_evt_multimedia_GetMediaInformation * const evt);
+
+/**
+ * Parse the "Remove Item from Album" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Remove Item from Album" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseRemoveItemFromAlbum(vscp_RxMessage const * const msg, vscp_evt_multimedia_RemoveItemFromAlbum * const evt);
+
+/**
+ * Parse the "Remove all Items from Album" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Remove all Items from Album" event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseRemoveAllItemsFromAlbum(vscp_RxMessage const * const msg, vscp_evt_multimedia_RemoveAllItemsFromAlbum * const evt);
+
+/**
+ * Parse the "Save Album/Play list" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Save Album/Play list" event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseSaveAlbumPlayList(vscp_RxMessage const * const msg, vscp_evt_multimedia_SaveAlbumPlayList * const evt);
+
+/**
+ * Parse the "Multimedia Control" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Multimedia Control" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parseMultimediaControl(vscp_RxMessage const * const msg, vscp_evt_multimedia_MultimediaControl * const evt);
+
+/**
+ * Parse a received event of the "Multimedia" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_multimedia_parse(vscp_RxMessage const * const msg, vscp_evt_multimedia_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_phone.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,24 +73,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_phone_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Incoming call
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] id Id for the call. This is an incremental identity number for each call.
  * @param[in] index Index of phone event (base = 0). Each call can be broken up into fragments. This
  * is the fragment number.
@@ -99,7 +85,7 @@ extern BOOL vscp_evt_phone_sendGeneralEvent(void)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendIncomingCall(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+extern BOOL vscp_evt_phone_sendByType(uint8_t vscpType, uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
@@ -110,7 +96,7 @@ extern BOOL vscp_evt_phone_sendIncomingCall(uint8_t id, uint8_t index, uint8_t t
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_INCOMING_CALL, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = id;
     size += 1;
@@ -138,51 +124,17 @@ extern BOOL vscp_evt_phone_sendIncomingCall(uint8_t id, uint8_t index, uint8_t t
 }
 
 /**
- * Outgoing call
- * 
- * @param[in] id Id for the call. This is an incremental identity number for each call.
- * @param[in] index Index of phone event (base = 0). Each call can be broken up into fragments. This
- * is the fragment number.
- * @param[in] total Total number of events (fragments) for this call information.
- * @param[in] info Caller information. Number or real text information. (array[5])
- * @param[in] infosize Size in byte.
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendOutgoingCall(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+extern BOOL vscp_evt_phone_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
 
-    if ((NULL == info) || (0 == infoSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_OUTGOING_CALL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = id;
-    size += 1;
-
-    txMsg.data[1] = index;
-    size += 1;
-
-    txMsg.data[2] = total;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < infoSize; ++byteIndex)
-    {
-        txMsg.data[3 + byteIndex] = info[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = size;
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
@@ -210,68 +162,40 @@ extern BOOL vscp_evt_phone_sendRing(uint8_t id)
 }
 
 /**
- * Answer
+ * Hangup
  * 
  * @param[in] id Id for the call. This is an incremental identity number for each call.
- * @param[in] index Index of phone event (base = 0). Each call can be broken up into fragments. This
- * is the fragment number.
- * @param[in] total Total number of events (fragments) for this call information.
- * @param[in] info Caller information. Number or real text information. (array[5])
- * @param[in] infosize Size in byte.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendAnswer(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+extern BOOL vscp_evt_phone_sendHangup(uint8_t id)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == info) || (0 == infoSize))
-    {
-        return FALSE;
-    }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_ANSWER, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_HANGUP, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = id;
     size += 1;
 
-    txMsg.data[1] = index;
-    size += 1;
-
-    txMsg.data[2] = total;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < infoSize; ++byteIndex)
-    {
-        txMsg.data[3 + byteIndex] = info[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
     txMsg.dataSize = size;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Hangup
+ * Giveup
  * 
  * @param[in] id Id for the call. This is an incremental identity number for each call.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendHangup(uint8_t id)
+extern BOOL vscp_evt_phone_sendGiveup(uint8_t id)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_HANGUP, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_GIVEUP, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = id;
     size += 1;
@@ -282,18 +206,18 @@ extern BOOL vscp_evt_phone_sendHangup(uint8_t id)
 }
 
 /**
- * Giveup
+ * Transfer
  * 
  * @param[in] id Id for the call. This is an incremental identity number for each call.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendGiveup(uint8_t id)
+extern BOOL vscp_evt_phone_sendTransfer(uint8_t id)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_GIVEUP, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_TRANSFER, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = id;
     size += 1;
@@ -304,74 +228,200 @@ extern BOOL vscp_evt_phone_sendGiveup(uint8_t id)
 }
 
 /**
- * Transfer
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
  * 
- * @param[in] id Id for the call. This is an incremental identity number for each call.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendTransfer(uint8_t id)
+extern BOOL vscp_evt_phone_parseCommon(vscp_RxMessage const * const msg, vscp_evt_phone_Common * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
+    uint8_t byteIndex   = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_TRANSFER, VSCP_PRIORITY_3_NORMAL);
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[0] = id;
-    size += 1;
+    if ((VSCP_CLASS_L1_PHONE != msg->vscpClass) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
 
-    txMsg.dataSize = size;
+    evt->id = msg->data[0];
 
-    return vscp_core_sendEvent(&txMsg);
+    evt->index = msg->data[1];
+
+    evt->total = msg->data[2];
+
+    for(byteIndex = 0; (byteIndex < 5) && ((3 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->info[byteIndex] = msg->data[3 + byteIndex];
+    }
+    evt->infoSize = byteIndex;
+
+    return TRUE;
 }
 
 /**
- * Database Info
+ * Parse the "Ring" event.
  * 
- * @param[in] id Id for the call. This is an incremental identity number for each call.
- * @param[in] index Index of phone event (base = 0). Each call can be broken up into fragments. This
- * is the fragment number.
- * @param[in] total Total number of events (fragments) for this call information.
- * @param[in] info Caller information. Number or real text information. (array[5])
- * @param[in] infosize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "Ring" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendDatabaseInfo(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+extern BOOL vscp_evt_phone_parseRing(vscp_RxMessage const * const msg, vscp_evt_phone_Ring * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    if ((NULL == info) || (0 == infoSize))
+    if ((VSCP_CLASS_L1_PHONE != msg->vscpClass) || (VSCP_TYPE_PHONE_RING != msg->vscpType) || (1 > msg->dataSize))
     {
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_PHONE, VSCP_TYPE_PHONE_DATABASE_INFO, VSCP_PRIORITY_3_NORMAL);
+    evt->id = msg->data[0];
 
-    txMsg.data[0] = id;
-    size += 1;
+    return TRUE;
+}
 
-    txMsg.data[1] = index;
-    size += 1;
+/**
+ * Parse the "Hangup" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Hangup" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseHangup(vscp_RxMessage const * const msg, vscp_evt_phone_Hangup * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[2] = total;
-    size += 1;
+    if ((VSCP_CLASS_L1_PHONE != msg->vscpClass) || (VSCP_TYPE_PHONE_HANGUP != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
 
-    for(byteIndex = 0; byteIndex < infoSize; ++byteIndex)
+    evt->id = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Giveup" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Giveup" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseGiveup(vscp_RxMessage const * const msg, vscp_evt_phone_Giveup * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
     {
-        txMsg.data[3 + byteIndex] = info[byteIndex];
-        size += 1;
+        return FALSE;
+    }
 
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
+    if ((VSCP_CLASS_L1_PHONE != msg->vscpClass) || (VSCP_TYPE_PHONE_GIVEUP != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
     }
 
-    txMsg.dataSize = size;
+    evt->id = msg->data[0];
 
-    return vscp_core_sendEvent(&txMsg);
+    return TRUE;
+}
+
+/**
+ * Parse the "Transfer" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Transfer" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseTransfer(vscp_RxMessage const * const msg, vscp_evt_phone_Transfer * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PHONE != msg->vscpClass) || (VSCP_TYPE_PHONE_TRANSFER != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->id = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Phone" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parse(vscp_RxMessage const * const msg, vscp_evt_phone_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_PHONE != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_PHONE_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PHONE_RING:
+        status = vscp_evt_phone_parseRing(msg, &evt->data.ring);
+        break;
+
+    case VSCP_TYPE_PHONE_HANGUP:
+        status = vscp_evt_phone_parseHangup(msg, &evt->data.hangup);
+        break;
+
+    case VSCP_TYPE_PHONE_GIVEUP:
+        status = vscp_evt_phone_parseGiveup(msg, &evt->data.giveup);
+        break;
+
+    case VSCP_TYPE_PHONE_TRANSFER:
+        status = vscp_evt_phone_parseTransfer(msg, &evt->data.transfer);
+        break;
+
+    case VSCP_TYPE_PHONE_INCOMING_CALL:
+    case VSCP_TYPE_PHONE_OUTGOING_CALL:
+    case VSCP_TYPE_PHONE_ANSWER:
+    case VSCP_TYPE_PHONE_DATABASE_INFO:
+        status = vscp_evt_phone_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
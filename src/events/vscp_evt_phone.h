@@ -47,6 +47,8 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_type_phone.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +71,62 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t id; /**< id */
+    uint8_t index; /**< Index */
+    uint8_t total; /**< Total */
+    uint8_t info[5]; /**< Info */
+    uint8_t infoSize; /**< Info size */
+
+} vscp_evt_phone_Common;
+
+/** Parameters of the "Ring" event. */
+typedef struct
+{
+    uint8_t id; /**< id */
+
+} vscp_evt_phone_Ring;
+
+/** Parameters of the "Hangup" event. */
+typedef struct
+{
+    uint8_t id; /**< id */
+
+} vscp_evt_phone_Hangup;
+
+/** Parameters of the "Giveup" event. */
+typedef struct
+{
+    uint8_t id; /**< id */
+
+} vscp_evt_phone_Giveup;
+
+/** Parameters of the "Transfer" event. */
+typedef struct
+{
+    uint8_t id; /**< id */
+
+} vscp_evt_phone_Transfer;
+
+/** Parsed event of the "Phone" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_phone_Common common; /**< Parameters of all types, which share the same frame layout */
+        vscp_evt_phone_Ring ring; /**< Parameters of the "Ring" event */
+        vscp_evt_phone_Hangup hangup; /**< Parameters of the "Hangup" event */
+        vscp_evt_phone_Giveup giveup; /**< Parameters of the "Giveup" event */
+        vscp_evt_phone_Transfer transfer; /**< Parameters of the "Transfer" event */
+    } data;
+
+} vscp_evt_phone_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -77,6 +135,21 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] id Id for the call. This is an incremental identity number for each call.
+ * @param[in] index Index of phone event (base = 0). Each call can be broken up into fragments. This
+ * is the fragment number.
+ * @param[in] total Total number of events (fragments) for this call information.
+ * @param[in] info Caller information. Number or real text information. (array[5])
+ * @param[in] infosize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_sendByType(uint8_t vscpType, uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize);
+
 /**
  * General event
  * 
@@ -96,7 +169,10 @@ extern BOOL vscp_evt_phone_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendIncomingCall(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize);
+static inline BOOL vscp_evt_phone_sendIncomingCall(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+{
+    return vscp_evt_phone_sendByType(VSCP_TYPE_PHONE_INCOMING_CALL, id, index, total, info, infoSize);
+}
 
 /**
  * Outgoing call
@@ -110,7 +186,10 @@ extern BOOL vscp_evt_phone_sendIncomingCall(uint8_t id, uint8_t index, uint8_t t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendOutgoingCall(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize);
+static inline BOOL vscp_evt_phone_sendOutgoingCall(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+{
+    return vscp_evt_phone_sendByType(VSCP_TYPE_PHONE_OUTGOING_CALL, id, index, total, info, infoSize);
+}
 
 /**
  * Ring
@@ -133,7 +212,10 @@ extern BOOL vscp_evt_phone_sendRing(uint8_t id);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendAnswer(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize);
+static inline BOOL vscp_evt_phone_sendAnswer(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+{
+    return vscp_evt_phone_sendByType(VSCP_TYPE_PHONE_ANSWER, id, index, total, info, infoSize);
+}
 
 /**
  * Hangup
@@ -174,7 +256,71 @@ extern BOOL vscp_evt_phone_sendTransfer(uint8_t id);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_phone_sendDatabaseInfo(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize);
+static inline BOOL vscp_evt_phone_sendDatabaseInfo(uint8_t id, uint8_t index, uint8_t total, uint8_t const * const info, uint8_t infoSize)
+{
+    return vscp_evt_phone_sendByType(VSCP_TYPE_PHONE_DATABASE_INFO, id, index, total, info, infoSize);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseCommon(vscp_RxMessage const * const msg, vscp_evt_phone_Common * const evt);
+
+/**
+ * Parse the "Ring" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Ring" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseRing(vscp_RxMessage const * const msg, vscp_evt_phone_Ring * const evt);
+
+/**
+ * Parse the "Hangup" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Hangup" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseHangup(vscp_RxMessage const * const msg, vscp_evt_phone_Hangup * const evt);
+
+/**
+ * Parse the "Giveup" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Giveup" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseGiveup(vscp_RxMessage const * const msg, vscp_evt_phone_Giveup * const evt);
+
+/**
+ * Parse the "Transfer" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Transfer" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parseTransfer(vscp_RxMessage const * const msg, vscp_evt_phone_Transfer * const evt);
+
+/**
+ * Parse a received event of the "Phone" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_phone_parse(vscp_RxMessage const * const msg, vscp_evt_phone_Event * const evt);
 
 #ifdef __cplusplus
 }
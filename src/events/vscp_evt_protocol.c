@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_protocol.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -1407,3 +1408,1266 @@ extern BOOL vscp_evt_protocol_sendBootloaderAbortNack(void)
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Segment Controller Heartbeat." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Segment Controller Heartbeat." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseSegmentControllerHeartbeat(vscp_RxMessage const * const msg, vscp_evt_protocol_SegmentControllerHeartbeat * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_SEGCTRL_HEARTBEAT != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->crc = msg->data[0];
+
+    evt->timeAvailable = FALSE;
+    if (5 <= msg->dataSize)
+    {
+        evt->timeAvailable = TRUE;
+        evt->time = VSCP_UTIL_READ_UINT32_BE(&msg->data[1]);
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "New node on line / Probe." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "New node on line / Probe." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNewNodeOnLineProbe(vscp_RxMessage const * const msg, vscp_evt_protocol_NewNodeOnLineProbe * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->targetAddress = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Set nickname-ID for node." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set nickname-ID for node." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseSetNicknameIdForNode(vscp_RxMessage const * const msg, vscp_evt_protocol_SetNicknameIdForNode * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_SET_NICKNAME != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->oldNickname = msg->data[0];
+
+    evt->newNickname = msg->data[1];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Drop nickname-ID / Reset Device." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Drop nickname-ID / Reset Device." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseDropNicknameIdResetDevice(vscp_RxMessage const * const msg, vscp_evt_protocol_DropNicknameIdResetDevice * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_DROP_NICKNAME != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nickname = msg->data[0];
+
+    evt->flagsAvailable = FALSE;
+    if (2 <= msg->dataSize)
+    {
+        evt->flagsAvailable = TRUE;
+        evt->flags = msg->data[1];
+    }
+
+    evt->timeAvailable = FALSE;
+    if (3 <= msg->dataSize)
+    {
+        evt->timeAvailable = TRUE;
+        evt->time = msg->data[2];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Read register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Read register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseReadRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_ReadRegister * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_READ_REGISTER != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    evt->registerAddress = msg->data[1];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Read/Write response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Read/Write response." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseReadWriteResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_ReadWriteResponse * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_RW_RESPONSE != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->registerAddress = msg->data[0];
+
+    evt->registerValue = msg->data[1];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Write register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Write register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseWriteRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_WriteRegister * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_WRITE_REGISTER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    evt->registerAddress = msg->data[1];
+
+    evt->registerValue = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Enter boot loader mode." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Enter boot loader mode." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseEnterBootLoaderMode(vscp_RxMessage const * const msg, vscp_evt_protocol_EnterBootLoaderMode * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    evt->bootloaderAlgorithm = msg->data[1];
+
+    evt->guidByte0 = msg->data[2];
+
+    evt->guidByte3 = msg->data[3];
+
+    evt->guidByte5 = msg->data[4];
+
+    evt->guidByte7 = msg->data[5];
+
+    evt->pageSelect = VSCP_UTIL_READ_UINT16_BE(&msg->data[6]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "ACK boot loader mode." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ACK boot loader mode." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseAckBootLoaderMode(vscp_RxMessage const * const msg, vscp_evt_protocol_AckBootLoaderMode * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->flashBlockSize = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+
+    evt->numberOfBlocks = VSCP_UTIL_READ_UINT32_BE(&msg->data[4]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "NACK boot loader mode." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NACK boot loader mode." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNackBootLoaderMode(vscp_RxMessage const * const msg, vscp_evt_protocol_NackBootLoaderMode * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER != msg->vscpType))
+    {
+        return FALSE;
+    }
+
+    evt->errorCodeAvailable = FALSE;
+    if (4 <= msg->dataSize)
+    {
+        evt->errorCodeAvailable = TRUE;
+        evt->errorCode = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Start block data transfer." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Start block data transfer." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseStartBlockDataTransfer(vscp_RxMessage const * const msg, vscp_evt_protocol_StartBlockDataTransfer * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_START_BLOCK != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->blockNumber = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+
+    evt->memoryTypeAvailable = FALSE;
+    if (5 <= msg->dataSize)
+    {
+        evt->memoryTypeAvailable = TRUE;
+        evt->memoryType = msg->data[4];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Block data." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Block data." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseBlockData(vscp_RxMessage const * const msg, vscp_evt_protocol_BlockData * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_BLOCK_DATA != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    for(byteIndex = 0; (byteIndex < 8) && ((0 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[0 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "ACK data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ACK data block." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseAckDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_AckDataBlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK != msg->vscpType) || (6 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->blockCrc = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    evt->blockToWrite = VSCP_UTIL_READ_UINT32_BE(&msg->data[2]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "NACK data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NACK data block." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNackDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_NackDataBlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->errorCode = msg->data[0];
+
+    evt->blockToWrite = VSCP_UTIL_READ_UINT32_BE(&msg->data[1]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Program data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Program data block." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseProgramDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_ProgramDataBlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->blockNumber = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "ACK program data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ACK program data block." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseAckProgramDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_AckProgramDataBlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->blockNumber = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "NACK program data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NACK program data block." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNackProgramDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_NackProgramDataBlock * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->errorCode = msg->data[0];
+
+    evt->blockNumber = VSCP_UTIL_READ_UINT32_BE(&msg->data[1]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Activate new image." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Activate new image." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseActivateNewImage(vscp_RxMessage const * const msg, vscp_evt_protocol_ActivateNewImage * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->crc = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Page read." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Page read." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parsePageRead(vscp_RxMessage const * const msg, vscp_evt_protocol_PageRead * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_PAGE_READ != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeId = msg->data[0];
+
+    evt->index = msg->data[1];
+
+    evt->numberOfBytes = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Page write." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Page write." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parsePageWrite(vscp_RxMessage const * const msg, vscp_evt_protocol_PageWrite * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_PAGE_WRITE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeId = msg->data[0];
+
+    evt->registerStart = msg->data[1];
+
+    for(byteIndex = 0; (byteIndex < 6) && ((2 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[2 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Read/Write page response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Read/Write page response." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseReadWritePageResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_ReadWritePageResponse * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->sequenceNumber = msg->data[0];
+
+    for(byteIndex = 0; (byteIndex < 7) && ((2 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->data[byteIndex] = msg->data[2 + byteIndex];
+    }
+    evt->dataSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "High end server/service response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "High end server/service response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseHighEndServerServiceResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_HighEndServerServiceResponse * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_RESPONSE != msg->vscpType) || (8 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->capabilityCode = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    for(byteIndex = 0; (byteIndex < 4) && ((2 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->serverIp[byteIndex] = msg->data[2 + byteIndex];
+    }
+    evt->serverIpSize = byteIndex;
+
+    evt->serverPort = VSCP_UTIL_READ_UINT16_BE(&msg->data[6]);
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Increment register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Increment register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseIncrementRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_IncrementRegister * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_INCREMENT_REGISTER != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeId = msg->data[0];
+
+    for(byteIndex = 0; (byteIndex < 7) && ((1 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->registerAddress[byteIndex] = msg->data[1 + byteIndex];
+    }
+    evt->registerAddressSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Decrement register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decrement register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseDecrementRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_DecrementRegister * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_DECREMENT_REGISTER != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeId = msg->data[0];
+
+    for(byteIndex = 0; (byteIndex < 7) && ((1 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->registerAddress[byteIndex] = msg->data[1 + byteIndex];
+    }
+    evt->registerAddressSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Who is there?" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Who is there?" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseWhoIsThere(vscp_RxMessage const * const msg, vscp_evt_protocol_WhoIsThere * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_WHO_IS_THERE != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeId = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Get decision matrix info." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get decision matrix info." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetDecisionMatrixInfo(vscp_RxMessage const * const msg, vscp_evt_protocol_GetDecisionMatrixInfo * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Decision matrix info response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decision matrix info response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseDecisionMatrixInfoResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_DecisionMatrixInfoResponse * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE != msg->vscpType) || (2 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->matrixSize = msg->data[0];
+
+    evt->offset = msg->data[1];
+
+    evt->pageStartAvailable = FALSE;
+    if (4 <= msg->dataSize)
+    {
+        evt->pageStartAvailable = TRUE;
+        evt->pageStart = VSCP_UTIL_READ_UINT16_BE(&msg->data[2]);
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Get embedded MDF." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get embedded MDF." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetEmbeddedMdf(vscp_RxMessage const * const msg, vscp_evt_protocol_GetEmbeddedMdf * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Embedded MDF response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Embedded MDF response." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseEmbeddedMdfResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_EmbeddedMdfResponse * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->mdfDescriptionIndex = VSCP_UTIL_READ_UINT16_BE(&msg->data[0]);
+
+    evt->mdfData = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Extended page read register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Extended page read register." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseExtendedPageReadRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_ExtendedPageReadRegister * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    evt->page = VSCP_UTIL_READ_UINT16_BE(&msg->data[1]);
+
+    evt->offset = msg->data[3];
+
+    evt->numberAvailable = FALSE;
+    if (5 <= msg->dataSize)
+    {
+        evt->numberAvailable = TRUE;
+        evt->number = msg->data[4];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Extended page write register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Extended page write register." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseExtendedPageWriteRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_ExtendedPageWriteRegister * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_WRITE != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    evt->page = VSCP_UTIL_READ_UINT16_BE(&msg->data[1]);
+
+    evt->offset = msg->data[3];
+
+    for(byteIndex = 0; (byteIndex < 4) && ((4 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->value[byteIndex] = msg->data[4 + byteIndex];
+    }
+    evt->valueSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Extended page read/write response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Extended page read/write response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseExtendedPageReadWriteResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_ExtendedPageReadWriteResponse * const evt)
+{
+    uint8_t byteIndex   = 0;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->page = VSCP_UTIL_READ_UINT16_BE(&msg->data[1]);
+
+    evt->offset = msg->data[3];
+
+    for(byteIndex = 0; (byteIndex < 4) && ((4 + byteIndex) < msg->dataSize); ++byteIndex)
+    {
+        evt->value[byteIndex] = msg->data[4 + byteIndex];
+    }
+    evt->valueSize = byteIndex;
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Get event interest." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get event interest." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetEventInterest(vscp_RxMessage const * const msg, vscp_evt_protocol_GetEventInterest * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST != msg->vscpType) || (1 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->nodeAddress = msg->data[0];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Get event interest response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get event interest response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetEventInterestResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_GetEventInterestResponse * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) || (VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE != msg->vscpType) || (5 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->index = msg->data[0];
+
+    evt->class = VSCP_UTIL_READ_UINT16_BE(&msg->data[1]);
+
+    evt->type = VSCP_UTIL_READ_UINT16_BE(&msg->data[3]);
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "VSCP Protocol Functionality" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parse(vscp_RxMessage const * const msg, vscp_evt_protocol_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_PROTOCOL != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_PROTOCOL_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_SEGCTRL_HEARTBEAT:
+        status = vscp_evt_protocol_parseSegmentControllerHeartbeat(msg, &evt->data.segmentControllerHeartbeat);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE:
+        status = vscp_evt_protocol_parseNewNodeOnLineProbe(msg, &evt->data.newNodeOnLineProbe);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PROBE_ACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_SET_NICKNAME:
+        status = vscp_evt_protocol_parseSetNicknameIdForNode(msg, &evt->data.setNicknameIdForNode);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_NICKNAME_ACCEPTED:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_DROP_NICKNAME:
+        status = vscp_evt_protocol_parseDropNicknameIdResetDevice(msg, &evt->data.dropNicknameIdResetDevice);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_READ_REGISTER:
+        status = vscp_evt_protocol_parseReadRegister(msg, &evt->data.readRegister);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_RW_RESPONSE:
+        status = vscp_evt_protocol_parseReadWriteResponse(msg, &evt->data.readWriteResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_WRITE_REGISTER:
+        status = vscp_evt_protocol_parseWriteRegister(msg, &evt->data.writeRegister);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER:
+        status = vscp_evt_protocol_parseEnterBootLoaderMode(msg, &evt->data.enterBootLoaderMode);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER:
+        status = vscp_evt_protocol_parseAckBootLoaderMode(msg, &evt->data.ackBootLoaderMode);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER:
+        status = vscp_evt_protocol_parseNackBootLoaderMode(msg, &evt->data.nackBootLoaderMode);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_START_BLOCK:
+        status = vscp_evt_protocol_parseStartBlockDataTransfer(msg, &evt->data.startBlockDataTransfer);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BLOCK_DATA:
+        status = vscp_evt_protocol_parseBlockData(msg, &evt->data.blockData);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK:
+        status = vscp_evt_protocol_parseAckDataBlock(msg, &evt->data.ackDataBlock);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK:
+        status = vscp_evt_protocol_parseNackDataBlock(msg, &evt->data.nackDataBlock);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA:
+        status = vscp_evt_protocol_parseProgramDataBlock(msg, &evt->data.programDataBlock);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK:
+        status = vscp_evt_protocol_parseAckProgramDataBlock(msg, &evt->data.ackProgramDataBlock);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK:
+        status = vscp_evt_protocol_parseNackProgramDataBlock(msg, &evt->data.nackProgramDataBlock);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE:
+        status = vscp_evt_protocol_parseActivateNewImage(msg, &evt->data.activateNewImage);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PAGE_READ:
+        status = vscp_evt_protocol_parsePageRead(msg, &evt->data.pageRead);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PAGE_WRITE:
+        status = vscp_evt_protocol_parsePageWrite(msg, &evt->data.pageWrite);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE:
+        status = vscp_evt_protocol_parseReadWritePageResponse(msg, &evt->data.readWritePageResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_PROBE:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_RESPONSE:
+        status = vscp_evt_protocol_parseHighEndServerServiceResponse(msg, &evt->data.highEndServerServiceResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_INCREMENT_REGISTER:
+        status = vscp_evt_protocol_parseIncrementRegister(msg, &evt->data.incrementRegister);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_DECREMENT_REGISTER:
+        status = vscp_evt_protocol_parseDecrementRegister(msg, &evt->data.decrementRegister);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_WHO_IS_THERE:
+        status = vscp_evt_protocol_parseWhoIsThere(msg, &evt->data.whoIsThere);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO:
+        status = vscp_evt_protocol_parseGetDecisionMatrixInfo(msg, &evt->data.getDecisionMatrixInfo);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE:
+        status = vscp_evt_protocol_parseDecisionMatrixInfoResponse(msg, &evt->data.decisionMatrixInfoResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF:
+        status = vscp_evt_protocol_parseGetEmbeddedMdf(msg, &evt->data.getEmbeddedMdf);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE:
+        status = vscp_evt_protocol_parseEmbeddedMdfResponse(msg, &evt->data.embeddedMdfResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ:
+        status = vscp_evt_protocol_parseExtendedPageReadRegister(msg, &evt->data.extendedPageReadRegister);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_WRITE:
+        status = vscp_evt_protocol_parseExtendedPageWriteRegister(msg, &evt->data.extendedPageWriteRegister);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE:
+        status = vscp_evt_protocol_parseExtendedPageReadWriteResponse(msg, &evt->data.extendedPageReadWriteResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST:
+        status = vscp_evt_protocol_parseGetEventInterest(msg, &evt->data.getEventInterest);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE:
+        status = vscp_evt_protocol_parseGetEventInterestResponse(msg, &evt->data.getEventInterestResponse);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_START_BLOCK_ACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_START_BLOCK_NACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_NACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BOOT_LOADER_CHECK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_ACK:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_NACK:
+        status = TRUE;
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
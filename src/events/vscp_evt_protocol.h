@@ -53,6 +53,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -75,6 +76,347 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Segment Controller Heartbeat." event. */
+typedef struct
+{
+    uint8_t crc; /**< CRC */
+    uint32_t time; /**< Time */
+    BOOL timeAvailable; /**< Time available */
+
+} vscp_evt_protocol_SegmentControllerHeartbeat;
+
+/** Parameters of the "New node on line / Probe." event. */
+typedef struct
+{
+    uint8_t targetAddress; /**< Target address */
+
+} vscp_evt_protocol_NewNodeOnLineProbe;
+
+/** Parameters of the "Set nickname-ID for node." event. */
+typedef struct
+{
+    uint8_t oldNickname; /**< Old nickname */
+    uint8_t newNickname; /**< New nickname */
+
+} vscp_evt_protocol_SetNicknameIdForNode;
+
+/** Parameters of the "Drop nickname-ID / Reset Device." event. */
+typedef struct
+{
+    uint8_t nickname; /**< Nickname */
+    uint8_t flags; /**< Flags */
+    BOOL flagsAvailable; /**< Flags available */
+    uint8_t time; /**< Time */
+    BOOL timeAvailable; /**< Time available */
+
+} vscp_evt_protocol_DropNicknameIdResetDevice;
+
+/** Parameters of the "Read register." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+    uint8_t registerAddress; /**< Register address */
+
+} vscp_evt_protocol_ReadRegister;
+
+/** Parameters of the "Read/Write response." event. */
+typedef struct
+{
+    uint8_t registerAddress; /**< Register address */
+    uint8_t registerValue; /**< Register value */
+
+} vscp_evt_protocol_ReadWriteResponse;
+
+/** Parameters of the "Write register." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+    uint8_t registerAddress; /**< Register address */
+    uint8_t registerValue; /**< Register value */
+
+} vscp_evt_protocol_WriteRegister;
+
+/** Parameters of the "Enter boot loader mode." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+    uint8_t bootloaderAlgorithm; /**< Bootloader algorithm */
+    uint8_t guidByte0; /**< GUID Byte 0 */
+    uint8_t guidByte3; /**< GUID Byte 3 */
+    uint8_t guidByte5; /**< GUID Byte 5 */
+    uint8_t guidByte7; /**< GUID Byte 7 */
+    uint16_t pageSelect; /**< Page select */
+
+} vscp_evt_protocol_EnterBootLoaderMode;
+
+/** Parameters of the "ACK boot loader mode." event. */
+typedef struct
+{
+    uint32_t flashBlockSize; /**< Flash block size */
+    uint32_t numberOfBlocks; /**< Number of blocks */
+
+} vscp_evt_protocol_AckBootLoaderMode;
+
+/** Parameters of the "NACK boot loader mode." event. */
+typedef struct
+{
+    uint32_t errorCode; /**< Error code */
+    BOOL errorCodeAvailable; /**< Error code available */
+
+} vscp_evt_protocol_NackBootLoaderMode;
+
+/** Parameters of the "Start block data transfer." event. */
+typedef struct
+{
+    uint32_t blockNumber; /**< Block number */
+    uint8_t memoryType; /**< Memory type */
+    BOOL memoryTypeAvailable; /**< Memory type available */
+
+} vscp_evt_protocol_StartBlockDataTransfer;
+
+/** Parameters of the "Block data." event. */
+typedef struct
+{
+    uint8_t data[8]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_protocol_BlockData;
+
+/** Parameters of the "ACK data block." event. */
+typedef struct
+{
+    uint16_t blockCrc; /**< Block CRC */
+    uint32_t blockToWrite; /**< Block to write */
+
+} vscp_evt_protocol_AckDataBlock;
+
+/** Parameters of the "NACK data block." event. */
+typedef struct
+{
+    uint8_t errorCode; /**< Error code */
+    uint32_t blockToWrite; /**< Block to write */
+
+} vscp_evt_protocol_NackDataBlock;
+
+/** Parameters of the "Program data block." event. */
+typedef struct
+{
+    uint32_t blockNumber; /**< Block number */
+
+} vscp_evt_protocol_ProgramDataBlock;
+
+/** Parameters of the "ACK program data block." event. */
+typedef struct
+{
+    uint32_t blockNumber; /**< Block number */
+
+} vscp_evt_protocol_AckProgramDataBlock;
+
+/** Parameters of the "NACK program data block." event. */
+typedef struct
+{
+    uint8_t errorCode; /**< Error code */
+    uint32_t blockNumber; /**< Block number */
+
+} vscp_evt_protocol_NackProgramDataBlock;
+
+/** Parameters of the "Activate new image." event. */
+typedef struct
+{
+    uint16_t crc; /**< CRC */
+
+} vscp_evt_protocol_ActivateNewImage;
+
+/** Parameters of the "Page read." event. */
+typedef struct
+{
+    uint8_t nodeId; /**< Node id */
+    uint8_t index; /**< Index */
+    uint8_t numberOfBytes; /**< Number of bytes */
+
+} vscp_evt_protocol_PageRead;
+
+/** Parameters of the "Page write." event. */
+typedef struct
+{
+    uint8_t nodeId; /**< Node id */
+    uint8_t registerStart; /**< Register start */
+    uint8_t data[6]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_protocol_PageWrite;
+
+/** Parameters of the "Read/Write page response." event. */
+typedef struct
+{
+    uint8_t sequenceNumber; /**< Sequence number */
+    uint8_t data[7]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_protocol_ReadWritePageResponse;
+
+/** Parameters of the "High end server/service response." event. */
+typedef struct
+{
+    uint16_t capabilityCode; /**< Capability code */
+    uint8_t serverIp[4]; /**< Server IP */
+    uint8_t serverIpSize; /**< Server IP size */
+    uint16_t serverPort; /**< Server port */
+
+} vscp_evt_protocol_HighEndServerServiceResponse;
+
+/** Parameters of the "Increment register." event. */
+typedef struct
+{
+    uint8_t nodeId; /**< Node-ID */
+    uint8_t registerAddress[7]; /**< Register address */
+    uint8_t registerAddressSize; /**< Register address size */
+
+} vscp_evt_protocol_IncrementRegister;
+
+/** Parameters of the "Decrement register." event. */
+typedef struct
+{
+    uint8_t nodeId; /**< Node-ID */
+    uint8_t registerAddress[7]; /**< Register address */
+    uint8_t registerAddressSize; /**< Register address size */
+
+} vscp_evt_protocol_DecrementRegister;
+
+/** Parameters of the "Who is there?" event. */
+typedef struct
+{
+    uint8_t nodeId; /**< Node-ID */
+
+} vscp_evt_protocol_WhoIsThere;
+
+/** Parameters of the "Get decision matrix info." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+
+} vscp_evt_protocol_GetDecisionMatrixInfo;
+
+/** Parameters of the "Decision matrix info response." event. */
+typedef struct
+{
+    uint8_t matrixSize; /**< Matrix size */
+    uint8_t offset; /**< Offset */
+    uint16_t pageStart; /**< Page start */
+    BOOL pageStartAvailable; /**< Page start available */
+
+} vscp_evt_protocol_DecisionMatrixInfoResponse;
+
+/** Parameters of the "Get embedded MDF." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+
+} vscp_evt_protocol_GetEmbeddedMdf;
+
+/** Parameters of the "Embedded MDF response." event. */
+typedef struct
+{
+    uint16_t mdfDescriptionIndex; /**< MDF description index */
+    uint8_t mdfData; /**< MDF data */
+
+} vscp_evt_protocol_EmbeddedMdfResponse;
+
+/** Parameters of the "Extended page read register." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+    uint16_t page; /**< Page */
+    uint8_t offset; /**< Offset */
+    uint8_t number; /**< Number */
+    BOOL numberAvailable; /**< Number available */
+
+} vscp_evt_protocol_ExtendedPageReadRegister;
+
+/** Parameters of the "Extended page write register." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+    uint16_t page; /**< Page */
+    uint8_t offset; /**< Offset */
+    uint8_t value[4]; /**< Value */
+    uint8_t valueSize; /**< Value size */
+
+} vscp_evt_protocol_ExtendedPageWriteRegister;
+
+/** Parameters of the "Extended page read/write response." event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint16_t page; /**< Page */
+    uint8_t offset; /**< Offset */
+    uint8_t value[4]; /**< Value */
+    uint8_t valueSize; /**< Value size */
+
+} vscp_evt_protocol_ExtendedPageReadWriteResponse;
+
+/** Parameters of the "Get event interest." event. */
+typedef struct
+{
+    uint8_t nodeAddress; /**< Node address */
+
+} vscp_evt_protocol_GetEventInterest;
+
+/** Parameters of the "Get event interest response." event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint16_t class; /**< Class */
+    uint16_t type; /**< Type */
+
+} vscp_evt_protocol_GetEventInterestResponse;
+
+/** Parsed event of the "VSCP Protocol Functionality" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_protocol_SegmentControllerHeartbeat segmentControllerHeartbeat; /**< Parameters of the "Segment Controller Heartbeat." event */
+        vscp_evt_protocol_NewNodeOnLineProbe newNodeOnLineProbe; /**< Parameters of the "New node on line / Probe." event */
+        vscp_evt_protocol_SetNicknameIdForNode setNicknameIdForNode; /**< Parameters of the "Set nickname-ID for node." event */
+        vscp_evt_protocol_DropNicknameIdResetDevice dropNicknameIdResetDevice; /**< Parameters of the "Drop nickname-ID / Reset Device." event */
+        vscp_evt_protocol_ReadRegister readRegister; /**< Parameters of the "Read register." event */
+        vscp_evt_protocol_ReadWriteResponse readWriteResponse; /**< Parameters of the "Read/Write response." event */
+        vscp_evt_protocol_WriteRegister writeRegister; /**< Parameters of the "Write register." event */
+        vscp_evt_protocol_EnterBootLoaderMode enterBootLoaderMode; /**< Parameters of the "Enter boot loader mode." event */
+        vscp_evt_protocol_AckBootLoaderMode ackBootLoaderMode; /**< Parameters of the "ACK boot loader mode." event */
+        vscp_evt_protocol_NackBootLoaderMode nackBootLoaderMode; /**< Parameters of the "NACK boot loader mode." event */
+        vscp_evt_protocol_StartBlockDataTransfer startBlockDataTransfer; /**< Parameters of the "Start block data transfer." event */
+        vscp_evt_protocol_BlockData blockData; /**< Parameters of the "Block data." event */
+        vscp_evt_protocol_AckDataBlock ackDataBlock; /**< Parameters of the "ACK data block." event */
+        vscp_evt_protocol_NackDataBlock nackDataBlock; /**< Parameters of the "NACK data block." event */
+        vscp_evt_protocol_ProgramDataBlock programDataBlock; /**< Parameters of the "Program data block." event */
+        vscp_evt_protocol_AckProgramDataBlock ackProgramDataBlock; /**< Parameters of the "ACK program data block." event */
+        vscp_evt_protocol_NackProgramDataBlock nackProgramDataBlock; /**< Parameters of the "NACK program data block." event */
+        vscp_evt_protocol_ActivateNewImage activateNewImage; /**< Parameters of the "Activate new image." event */
+        vscp_evt_protocol_PageRead pageRead; /**< Parameters of the "Page read." event */
+        vscp_evt_protocol_PageWrite pageWrite; /**< Parameters of the "Page write." event */
+        vscp_evt_protocol_ReadWritePageResponse readWritePageResponse; /**< Parameters of the "Read/Write page response." event */
+        vscp_evt_protocol_HighEndServerServiceResponse highEndServerServiceResponse; /**< Parameters of the "High end server/service response." event */
+        vscp_evt_protocol_IncrementRegister incrementRegister; /**< Parameters of the "Increment register." event */
+        vscp_evt_protocol_DecrementRegister decrementRegister; /**< Parameters of the "Decrement register." event */
+        vscp_evt_protocol_WhoIsThere whoIsThere; /**< Parameters of the "Who is there?" event */
+        vscp_evt_protocol_GetDecisionMatrixInfo getDecisionMatrixInfo; /**< Parameters of the "Get decision matrix info." event */
+        vscp_evt_protocol_DecisionMatrixInfoResponse decisionMatrixInfoResponse; /**< Parameters of the "Decision matrix info response." event */
+        vscp_evt_protocol_GetEmbeddedMdf getEmbeddedMdf; /**< Parameters of the "Get embedded MDF." event */
+        vscp_evt_protocol_EmbeddedMdfResponse embeddedMdfResponse; /**< Parameters of the "Embedded MDF response." event */
+        vscp_evt_protocol_ExtendedPageReadRegister extendedPageReadRegister; /**< Parameters of the "Extended page read register." event */
+        vscp_evt_protocol_ExtendedPageWriteRegister extendedPageWriteRegister; /**< Parameters of the "Extended page write register." event */
+        vscp_evt_protocol_ExtendedPageReadWriteResponse extendedPageReadWriteResponse; /**< Parameters of the "Extended page read/write response." event */
+        vscp_evt_protocol_GetEventInterest getEventInterest; /**< Parameters of the "Get event interest." event */
+        vscp_evt_protocol_GetEventInterestResponse getEventInterestResponse; /**< Parameters of the "Get event interest response." event */
+    } data;
+
+} vscp_evt_protocol_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -550,6 +892,377 @@ extern BOOL vscp_evt_protocol_sendBootloaderAbortAck(void);
  */
 extern BOOL vscp_evt_protocol_sendBootloaderAbortNack(void);
 
+/**
+ * Parse the "Segment Controller Heartbeat." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Segment Controller Heartbeat." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseSegmentControllerHeartbeat(vscp_RxMessage const * const msg, vscp_evt_protocol_SegmentControllerHeartbeat * const evt);
+
+/**
+ * Parse the "New node on line / Probe." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "New node on line / Probe." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNewNodeOnLineProbe(vscp_RxMessage const * const msg, vscp_evt_protocol_NewNodeOnLineProbe * const evt);
+
+/**
+ * Parse the "Set nickname-ID for node." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Set nickname-ID for node." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseSetNicknameIdForNode(vscp_RxMessage const * const msg, vscp_evt_protocol_SetNicknameIdForNode * const evt);
+
+/**
+ * Parse the "Drop nickname-ID / Reset Device." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Drop nickname-ID / Reset Device." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseDropNicknameIdResetDevice(vscp_RxMessage const * const msg, vscp_evt_protocol_DropNicknameIdResetDevice * const evt);
+
+/**
+ * Parse the "Read register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Read register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseReadRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_ReadRegister * const evt);
+
+/**
+ * Parse the "Read/Write response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Read/Write response." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseReadWriteResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_ReadWriteResponse * const evt);
+
+/**
+ * Parse the "Write register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Write register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseWriteRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_WriteRegister * const evt);
+
+/**
+ * Parse the "Enter boot loader mode." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Enter boot loader mode." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseEnterBootLoaderMode(vscp_RxMessage const * const msg, vscp_evt_protocol_EnterBootLoaderMode * const evt);
+
+/**
+ * Parse the "ACK boot loader mode." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ACK boot loader mode." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseAckBootLoaderMode(vscp_RxMessage const * const msg, vscp_evt_protocol_AckBootLoaderMode * const evt);
+
+/**
+ * Parse the "NACK boot loader mode." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NACK boot loader mode." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNackBootLoaderMode(vscp_RxMessage const * const msg, vscp_evt_protocol_NackBootLoaderMode * const evt);
+
+/**
+ * Parse the "Start block data transfer." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Start block data transfer." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseStartBlockDataTransfer(vscp_RxMessage const * const msg, vscp_evt_protocol_StartBlockDataTransfer * const evt);
+
+/**
+ * Parse the "Block data." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Block data." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseBlockData(vscp_RxMessage const * const msg, vscp_evt_protocol_BlockData * const evt);
+
+/**
+ * Parse the "ACK data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ACK data block." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseAckDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_AckDataBlock * const evt);
+
+/**
+ * Parse the "NACK data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NACK data block." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNackDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_NackDataBlock * const evt);
+
+/**
+ * Parse the "Program data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Program data block." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseProgramDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_ProgramDataBlock * const evt);
+
+/**
+ * Parse the "ACK program data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ACK program data block." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseAckProgramDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_AckProgramDataBlock * const evt);
+
+/**
+ * Parse the "NACK program data block." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "NACK program data block." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseNackProgramDataBlock(vscp_RxMessage const * const msg, vscp_evt_protocol_NackProgramDataBlock * const evt);
+
+/**
+ * Parse the "Activate new image." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Activate new image." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseActivateNewImage(vscp_RxMessage const * const msg, vscp_evt_protocol_ActivateNewImage * const evt);
+
+/**
+ * Parse the "Page read." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Page read." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parsePageRead(vscp_RxMessage const * const msg, vscp_evt_protocol_PageRead * const evt);
+
+/**
+ * Parse the "Page write." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Page write." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parsePageWrite(vscp_RxMessage const * const msg, vscp_evt_protocol_PageWrite * const evt);
+
+/**
+ * Parse the "Read/Write page response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Read/Write page response." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseReadWritePageResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_ReadWritePageResponse * const evt);
+
+/**
+ * Parse the "High end server/service response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "High end server/service response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseHighEndServerServiceResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_HighEndServerServiceResponse * const evt);
+
+/**
+ * Parse the "Increment register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Increment register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseIncrementRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_IncrementRegister * const evt);
+
+/**
+ * Parse the "Decrement register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decrement register." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseDecrementRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_DecrementRegister * const evt);
+
+/**
+ * Parse the "Who is there?" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Who is there?" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseWhoIsThere(vscp_RxMessage const * const msg, vscp_evt_protocol_WhoIsThere * const evt);
+
+/**
+ * Parse the "Get decision matrix info." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get decision matrix info." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetDecisionMatrixInfo(vscp_RxMessage const * const msg, vscp_evt_protocol_GetDecisionMatrixInfo * const evt);
+
+/**
+ * Parse the "Decision matrix info response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Decision matrix info response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseDecisionMatrixInfoResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_DecisionMatrixInfoResponse * const evt);
+
+/**
+ * Parse the "Get embedded MDF." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get embedded MDF." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetEmbeddedMdf(vscp_RxMessage const * const msg, vscp_evt_protocol_GetEmbeddedMdf * const evt);
+
+/**
+ * Parse the "Embedded MDF response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Embedded MDF response." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseEmbeddedMdfResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_EmbeddedMdfResponse * const evt);
+
+/**
+ * Parse the "Extended page read register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Extended page read register." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseExtendedPageReadRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_ExtendedPageReadRegister * const evt);
+
+/**
+ * Parse the "Extended page write register." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Extended page write register." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseExtendedPageWriteRegister(vscp_RxMessage const * const msg, vscp_evt_protocol_ExtendedPageWriteRegister * const evt);
+
+/**
+ * Parse the "Extended page read/write response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Extended page read/write response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseExtendedPageReadWriteResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_ExtendedPageReadWriteResponse * const evt);
+
+/**
+ * Parse the "Get event interest." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get event interest." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetEventInterest(vscp_RxMessage const * const msg, vscp_evt_protocol_GetEventInterest * const evt);
+
+/**
+ * Parse the "Get event interest response." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Get event interest response." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parseGetEventInterestResponse(vscp_RxMessage const * const msg, vscp_evt_protocol_GetEventInterestResponse * const evt);
+
+/**
+ * Parse a received event of the "VSCP Protocol Functionality" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_protocol_parse(vscp_RxMessage const * const msg, vscp_evt_protocol_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
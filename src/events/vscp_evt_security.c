@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_security.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -1204,3 +1205,1272 @@ extern BOOL vscp_evt_security_sendVibration(uint8_t data0, uint8_t zone, uint8_t
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "Motion Detect" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Motion Detect" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseMotionDetect(vscp_RxMessage const * const msg, vscp_evt_security_MotionDetect * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_MOTION != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    evt->statusAvailable = FALSE;
+    if (4 <= msg->dataSize)
+    {
+        evt->statusAvailable = TRUE;
+        evt->status = msg->data[3];
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Glass break" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Glass break" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseGlassBreak(vscp_RxMessage const * const msg, vscp_evt_security_GlassBreak * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_GLASS_BREAK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Beam break" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Beam break" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseBeamBreak(vscp_RxMessage const * const msg, vscp_evt_security_BeamBreak * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_BEAM_BREAK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Sensor tamper" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sensor tamper" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseSensorTamper(vscp_RxMessage const * const msg, vscp_evt_security_SensorTamper * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_SENSOR_TAMPER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Shock sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shock sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseShockSensor(vscp_RxMessage const * const msg, vscp_evt_security_ShockSensor * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_SHOCK_SENSOR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Smoke sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Smoke sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseSmokeSensor(vscp_RxMessage const * const msg, vscp_evt_security_SmokeSensor * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_SMOKE_SENSOR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Heat sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Heat sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseHeatSensor(vscp_RxMessage const * const msg, vscp_evt_security_HeatSensor * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_HEAT_SENSOR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Panic switch" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Panic switch" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePanicSwitch(vscp_RxMessage const * const msg, vscp_evt_security_PanicSwitch * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PANIC_SWITCH != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Door Contact" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Door Contact" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseDoorContact(vscp_RxMessage const * const msg, vscp_evt_security_DoorContact * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_DOOR_OPEN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Window Contact" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Window Contact" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseWindowContact(vscp_RxMessage const * const msg, vscp_evt_security_WindowContact * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_WINDOW_OPEN != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "CO Sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "CO Sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseCoSensor(vscp_RxMessage const * const msg, vscp_evt_security_CoSensor * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_CO_SENSOR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Frost detected" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Frost detected" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseFrostDetected(vscp_RxMessage const * const msg, vscp_evt_security_FrostDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_FROST_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Flame detected" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Flame detected" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseFlameDetected(vscp_RxMessage const * const msg, vscp_evt_security_FlameDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_FLAME_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Oxygen Low" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Oxygen Low" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseOxygenLow(vscp_RxMessage const * const msg, vscp_evt_security_OxygenLow * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_OXYGEN_LOW != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Weight detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Weight detected." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseWeightDetected(vscp_RxMessage const * const msg, vscp_evt_security_WeightDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_WEIGHT_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Water detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Water detected." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseWaterDetected(vscp_RxMessage const * const msg, vscp_evt_security_WaterDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_WATER_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Condensation detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Condensation detected." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_security_parseCondensationDetected(vscp_RxMessage const * const msg, vscp_evt_security_CondensationDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_CONDENSATION_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Noise (sound) detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Noise (sound) detected." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_security_parseNoiseSoundDetected(vscp_RxMessage const * const msg, vscp_evt_security_NoiseSoundDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_SOUND_DETECTED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Harmful sound levels detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Harmful sound levels detected." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseHarmfulSoundLevelsDetected(vscp_RxMessage const * const msg, vscp_evt_security_HarmfulSoundLevelsDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_HARMFUL_SOUND_LEVEL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Tamper detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Tamper detected." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseTamperDetected(vscp_RxMessage const * const msg, vscp_evt_security_TamperDetected * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_TAMPER != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->userData = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Authenticated" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Authenticated" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseAuthenticated(vscp_RxMessage const * const msg, vscp_evt_security_Authenticated * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_AUTHENTICATED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Unauthenticated" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unauthenticated" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseUnauthenticated(vscp_RxMessage const * const msg, vscp_evt_security_Unauthenticated * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_UNAUTHENTICATED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Authorized" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Authorized" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseAuthorized(vscp_RxMessage const * const msg, vscp_evt_security_Authorized * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_AUTHORIZED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Unauthorized" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unauthorized" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseUnauthorized(vscp_RxMessage const * const msg, vscp_evt_security_Unauthorized * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_UNAUTHORIZED != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "ID check" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ID check" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseIdCheck(vscp_RxMessage const * const msg, vscp_evt_security_IdCheck * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_ID_CHECK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Valid pin" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Valid pin" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseValidPin(vscp_RxMessage const * const msg, vscp_evt_security_ValidPin * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PIN_OK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Invalid pin" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Invalid pin" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseInvalidPin(vscp_RxMessage const * const msg, vscp_evt_security_InvalidPin * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PIN_FAIL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Pin warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pin warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePinWarning(vscp_RxMessage const * const msg, vscp_evt_security_PinWarning * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PIN_WARNING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Pin error" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pin error" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePinError(vscp_RxMessage const * const msg, vscp_evt_security_PinError * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PIN_ERROR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Valid password" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Valid password" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseValidPassword(vscp_RxMessage const * const msg, vscp_evt_security_ValidPassword * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PASSWORD_OK != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Invalid password" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Invalid password" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseInvalidPassword(vscp_RxMessage const * const msg, vscp_evt_security_InvalidPassword * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PASSWORD_FAIL != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Password warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Password warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePasswordWarning(vscp_RxMessage const * const msg, vscp_evt_security_PasswordWarning * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PASSWORD_WARNING != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Password error" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Password error" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePasswordError(vscp_RxMessage const * const msg, vscp_evt_security_PasswordError * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_PASSWORD_ERROR != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Gas" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Gas" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseGas(vscp_RxMessage const * const msg, vscp_evt_security_Gas * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_GAS != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "In motion" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "In motion" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseInMotion(vscp_RxMessage const * const msg, vscp_evt_security_InMotion * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_IN_MOTION != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Not in motion" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Not in motion" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseNotInMotion(vscp_RxMessage const * const msg, vscp_evt_security_NotInMotion * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_NOT_IN_MOTION != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse the "Vibration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Vibration" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseVibration(vscp_RxMessage const * const msg, vscp_evt_security_Vibration * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_SECURITY != msg->vscpClass) || (VSCP_TYPE_SECURITY_VIBRATION != msg->vscpType) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->data0 = msg->data[0];
+
+    evt->zone = msg->data[1];
+
+    evt->subZone = msg->data[2];
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Security" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parse(vscp_RxMessage const * const msg, vscp_evt_security_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_SECURITY != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_SECURITY_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_SECURITY_MOTION:
+        status = vscp_evt_security_parseMotionDetect(msg, &evt->data.motionDetect);
+        break;
+
+    case VSCP_TYPE_SECURITY_GLASS_BREAK:
+        status = vscp_evt_security_parseGlassBreak(msg, &evt->data.glassBreak);
+        break;
+
+    case VSCP_TYPE_SECURITY_BEAM_BREAK:
+        status = vscp_evt_security_parseBeamBreak(msg, &evt->data.beamBreak);
+        break;
+
+    case VSCP_TYPE_SECURITY_SENSOR_TAMPER:
+        status = vscp_evt_security_parseSensorTamper(msg, &evt->data.sensorTamper);
+        break;
+
+    case VSCP_TYPE_SECURITY_SHOCK_SENSOR:
+        status = vscp_evt_security_parseShockSensor(msg, &evt->data.shockSensor);
+        break;
+
+    case VSCP_TYPE_SECURITY_SMOKE_SENSOR:
+        status = vscp_evt_security_parseSmokeSensor(msg, &evt->data.smokeSensor);
+        break;
+
+    case VSCP_TYPE_SECURITY_HEAT_SENSOR:
+        status = vscp_evt_security_parseHeatSensor(msg, &evt->data.heatSensor);
+        break;
+
+    case VSCP_TYPE_SECURITY_PANIC_SWITCH:
+        status = vscp_evt_security_parsePanicSwitch(msg, &evt->data.panicSwitch);
+        break;
+
+    case VSCP_TYPE_SECURITY_DOOR_OPEN:
+        status = vscp_evt_security_parseDoorContact(msg, &evt->data.doorContact);
+        break;
+
+    case VSCP_TYPE_SECURITY_WINDOW_OPEN:
+        status = vscp_evt_security_parseWindowContact(msg, &evt->data.windowContact);
+        break;
+
+    case VSCP_TYPE_SECURITY_CO_SENSOR:
+        status = vscp_evt_security_parseCoSensor(msg, &evt->data.coSensor);
+        break;
+
+    case VSCP_TYPE_SECURITY_FROST_DETECTED:
+        status = vscp_evt_security_parseFrostDetected(msg, &evt->data.frostDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_FLAME_DETECTED:
+        status = vscp_evt_security_parseFlameDetected(msg, &evt->data.flameDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_OXYGEN_LOW:
+        status = vscp_evt_security_parseOxygenLow(msg, &evt->data.oxygenLow);
+        break;
+
+    case VSCP_TYPE_SECURITY_WEIGHT_DETECTED:
+        status = vscp_evt_security_parseWeightDetected(msg, &evt->data.weightDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_WATER_DETECTED:
+        status = vscp_evt_security_parseWaterDetected(msg, &evt->data.waterDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_CONDENSATION_DETECTED:
+        status = vscp_evt_security_parseCondensationDetected(msg, &evt->data.condensationDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_SOUND_DETECTED:
+        status = vscp_evt_security_parseNoiseSoundDetected(msg, &evt->data.noiseSoundDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_HARMFUL_SOUND_LEVEL:
+        status = vscp_evt_security_parseHarmfulSoundLevelsDetected(msg, &evt->data.harmfulSoundLevelsDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_TAMPER:
+        status = vscp_evt_security_parseTamperDetected(msg, &evt->data.tamperDetected);
+        break;
+
+    case VSCP_TYPE_SECURITY_AUTHENTICATED:
+        status = vscp_evt_security_parseAuthenticated(msg, &evt->data.authenticated);
+        break;
+
+    case VSCP_TYPE_SECURITY_UNAUTHENTICATED:
+        status = vscp_evt_security_parseUnauthenticated(msg, &evt->data.unauthenticated);
+        break;
+
+    case VSCP_TYPE_SECURITY_AUTHORIZED:
+        status = vscp_evt_security_parseAuthorized(msg, &evt->data.authorized);
+        break;
+
+    case VSCP_TYPE_SECURITY_UNAUTHORIZED:
+        status = vscp_evt_security_parseUnauthorized(msg, &evt->data.unauthorized);
+        break;
+
+    case VSCP_TYPE_SECURITY_ID_CHECK:
+        status = vscp_evt_security_parseIdCheck(msg, &evt->data.idCheck);
+        break;
+
+    case VSCP_TYPE_SECURITY_PIN_OK:
+        status = vscp_evt_security_parseValidPin(msg, &evt->data.validPin);
+        break;
+
+    case VSCP_TYPE_SECURITY_PIN_FAIL:
+        status = vscp_evt_security_parseInvalidPin(msg, &evt->data.invalidPin);
+        break;
+
+    case VSCP_TYPE_SECURITY_PIN_WARNING:
+        status = vscp_evt_security_parsePinWarning(msg, &evt->data.pinWarning);
+        break;
+
+    case VSCP_TYPE_SECURITY_PIN_ERROR:
+        status = vscp_evt_security_parsePinError(msg, &evt->data.pinError);
+        break;
+
+    case VSCP_TYPE_SECURITY_PASSWORD_OK:
+        status = vscp_evt_security_parseValidPassword(msg, &evt->data.validPassword);
+        break;
+
+    case VSCP_TYPE_SECURITY_PASSWORD_FAIL:
+        status = vscp_evt_security_parseInvalidPassword(msg, &evt->data.invalidPassword);
+        break;
+
+    case VSCP_TYPE_SECURITY_PASSWORD_WARNING:
+        status = vscp_evt_security_parsePasswordWarning(msg, &evt->data.passwordWarning);
+        break;
+
+    case VSCP_TYPE_SECURITY_PASSWORD_ERROR:
+        status = vscp_evt_security_parsePasswordError(msg, &evt->data.passwordError);
+        break;
+
+    case VSCP_TYPE_SECURITY_GAS:
+        status = vscp_evt_security_parseGas(msg, &evt->data.gas);
+        break;
+
+    case VSCP_TYPE_SECURITY_IN_MOTION:
+        status = vscp_evt_security_parseInMotion(msg, &evt->data.inMotion);
+        break;
+
+    case VSCP_TYPE_SECURITY_NOT_IN_MOTION:
+        status = vscp_evt_security_parseNotInMotion(msg, &evt->data.notInMotion);
+        break;
+
+    case VSCP_TYPE_SECURITY_VIBRATION:
+        status = vscp_evt_security_parseVibration(msg, &evt->data.vibration);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -47,6 +47,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,390 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "Motion Detect" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t status; /**< Status */
+    BOOL statusAvailable; /**< Status available */
+
+} vscp_evt_security_MotionDetect;
+
+/** Parameters of the "Glass break" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_GlassBreak;
+
+/** Parameters of the "Beam break" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_BeamBreak;
+
+/** Parameters of the "Sensor tamper" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_SensorTamper;
+
+/** Parameters of the "Shock sensor" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_ShockSensor;
+
+/** Parameters of the "Smoke sensor" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_SmokeSensor;
+
+/** Parameters of the "Heat sensor" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_HeatSensor;
+
+/** Parameters of the "Panic switch" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_PanicSwitch;
+
+/** Parameters of the "Door Contact" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_DoorContact;
+
+/** Parameters of the "Window Contact" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_WindowContact;
+
+/** Parameters of the "CO Sensor" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_CoSensor;
+
+/** Parameters of the "Frost detected" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_FrostDetected;
+
+/** Parameters of the "Flame detected" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_FlameDetected;
+
+/** Parameters of the "Oxygen Low" event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_OxygenLow;
+
+/** Parameters of the "Weight detected." event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_WeightDetected;
+
+/** Parameters of the "Water detected." event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_WaterDetected;
+
+/** Parameters of the "Condensation detected." event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_CondensationDetected;
+
+/** Parameters of the "Noise (sound) detected." event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_NoiseSoundDetected;
+
+/** Parameters of the "Harmful sound levels detected." event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_HarmfulSoundLevelsDetected;
+
+/** Parameters of the "Tamper detected." event. */
+typedef struct
+{
+    uint8_t userData; /**< User data */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_TamperDetected;
+
+/** Parameters of the "Authenticated" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_Authenticated;
+
+/** Parameters of the "Unauthenticated" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_Unauthenticated;
+
+/** Parameters of the "Authorized" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_Authorized;
+
+/** Parameters of the "Unauthorized" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_Unauthorized;
+
+/** Parameters of the "ID check" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_IdCheck;
+
+/** Parameters of the "Valid pin" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_ValidPin;
+
+/** Parameters of the "Invalid pin" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_InvalidPin;
+
+/** Parameters of the "Pin warning" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_PinWarning;
+
+/** Parameters of the "Pin error" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_PinError;
+
+/** Parameters of the "Valid password" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_ValidPassword;
+
+/** Parameters of the "Invalid password" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_InvalidPassword;
+
+/** Parameters of the "Password warning" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_PasswordWarning;
+
+/** Parameters of the "Password error" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_PasswordError;
+
+/** Parameters of the "Gas" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_Gas;
+
+/** Parameters of the "In motion" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_InMotion;
+
+/** Parameters of the "Not in motion" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_NotInMotion;
+
+/** Parameters of the "Vibration" event. */
+typedef struct
+{
+    uint8_t data0; /**< Data0 */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_security_Vibration;
+
+/** Parsed event of the "Security" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_security_MotionDetect motionDetect; /**< Parameters of the "Motion Detect" event */
+        vscp_evt_security_GlassBreak glassBreak; /**< Parameters of the "Glass break" event */
+        vscp_evt_security_BeamBreak beamBreak; /**< Parameters of the "Beam break" event */
+        vscp_evt_security_SensorTamper sensorTamper; /**< Parameters of the "Sensor tamper" event */
+        vscp_evt_security_ShockSensor shockSensor; /**< Parameters of the "Shock sensor" event */
+        vscp_evt_security_SmokeSensor smokeSensor; /**< Parameters of the "Smoke sensor" event */
+        vscp_evt_security_HeatSensor heatSensor; /**< Parameters of the "Heat sensor" event */
+        vscp_evt_security_PanicSwitch panicSwitch; /**< Parameters of the "Panic switch" event */
+        vscp_evt_security_DoorContact doorContact; /**< Parameters of the "Door Contact" event */
+        vscp_evt_security_WindowContact windowContact; /**< Parameters of the "Window Contact" event */
+        vscp_evt_security_CoSensor coSensor; /**< Parameters of the "CO Sensor" event */
+        vscp_evt_security_FrostDetected frostDetected; /**< Parameters of the "Frost detected" event */
+        vscp_evt_security_FlameDetected flameDetected; /**< Parameters of the "Flame detected" event */
+        vscp_evt_security_OxygenLow oxygenLow; /**< Parameters of the "Oxygen Low" event */
+        vscp_evt_security_WeightDetected weightDetected; /**< Parameters of the "Weight detected." event */
+        vscp_evt_security_WaterDetected waterDetected; /**< Parameters of the "Water detected." event */
+        vscp_evt_security_CondensationDetected condensationDetected; /**< Parameters of the "Condensation detected." event */
+        vscp_evt_security_NoiseSoundDetected noiseSoundDetected; /**< Parameters of the "Noise (sound) detected." event */
+        vscp_evt_security_HarmfulSoundLevelsDetected harmfulSoundLevelsDetected; /**< Parameters of the "Harmful sound levels detected." event */
+        vscp_evt_security_TamperDetected tamperDetected; /**< Parameters of the "Tamper detected." event */
+        vscp_evt_security_Authenticated authenticated; /**< Parameters of the "Authenticated" event */
+        vscp_evt_security_Unauthenticated unauthenticated; /**< Parameters of the "Unauthenticated" event */
+        vscp_evt_security_Authorized authorized; /**< Parameters of the "Authorized" event */
+        vscp_evt_security_Unauthorized unauthorized; /**< Parameters of the "Unauthorized" event */
+        vscp_evt_security_IdCheck idCheck; /**< Parameters of the "ID check" event */
+        vscp_evt_security_ValidPin validPin; /**< Parameters of the "Valid pin" event */
+        vscp_evt_security_InvalidPin invalidPin; /**< Parameters of the "Invalid pin" event */
+        vscp_evt_security_PinWarning pinWarning; /**< Parameters of the "Pin warning" event */
+        vscp_evt_security_PinError pinError; /**< Parameters of the "Pin error" event */
+        vscp_evt_security_ValidPassword validPassword; /**< Parameters of the "Valid password" event */
+        vscp_evt_security_InvalidPassword invalidPassword; /**< Parameters of the "Invalid password" event */
+        vscp_evt_security_PasswordWarning passwordWarning; /**< Parameters of the "Password warning" event */
+        vscp_evt_security_PasswordError passwordError; /**< Parameters of the "Password error" event */
+        vscp_evt_security_Gas gas; /**< Parameters of the "Gas" event */
+        vscp_evt_security_InMotion inMotion; /**< Parameters of the "In motion" event */
+        vscp_evt_security_NotInMotion notInMotion; /**< Parameters of the "Not in motion" event */
+        vscp_evt_security_Vibration vibration; /**< Parameters of the "Vibration" event */
+    } data;
+
+} vscp_evt_security_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -492,6 +877,390 @@ extern BOOL vscp_evt_security_sendNotInMotion(uint8_t data0, uint8_t zone, uint8
  */
 extern BOOL vscp_evt_security_sendVibration(uint8_t data0, uint8_t zone, uint8_t subZone);
 
+/**
+ * Parse the "Motion Detect" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Motion Detect" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseMotionDetect(vscp_RxMessage const * const msg, vscp_evt_security_MotionDetect * const evt);
+
+/**
+ * Parse the "Glass break" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Glass break" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseGlassBreak(vscp_RxMessage const * const msg, vscp_evt_security_GlassBreak * const evt);
+
+/**
+ * Parse the "Beam break" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Beam break" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseBeamBreak(vscp_RxMessage const * const msg, vscp_evt_security_BeamBreak * const evt);
+
+/**
+ * Parse the "Sensor tamper" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Sensor tamper" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseSensorTamper(vscp_RxMessage const * const msg, vscp_evt_security_SensorTamper * const evt);
+
+/**
+ * Parse the "Shock sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Shock sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseShockSensor(vscp_RxMessage const * const msg, vscp_evt_security_ShockSensor * const evt);
+
+/**
+ * Parse the "Smoke sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Smoke sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseSmokeSensor(vscp_RxMessage const * const msg, vscp_evt_security_SmokeSensor * const evt);
+
+/**
+ * Parse the "Heat sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Heat sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseHeatSensor(vscp_RxMessage const * const msg, vscp_evt_security_HeatSensor * const evt);
+
+/**
+ * Parse the "Panic switch" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Panic switch" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePanicSwitch(vscp_RxMessage const * const msg, vscp_evt_security_PanicSwitch * const evt);
+
+/**
+ * Parse the "Door Contact" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Door Contact" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseDoorContact(vscp_RxMessage const * const msg, vscp_evt_security_DoorContact * const evt);
+
+/**
+ * Parse the "Window Contact" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Window Contact" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseWindowContact(vscp_RxMessage const * const msg, vscp_evt_security_WindowContact * const evt);
+
+/**
+ * Parse the "CO Sensor" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "CO Sensor" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseCoSensor(vscp_RxMessage const * const msg, vscp_evt_security_CoSensor * const evt);
+
+/**
+ * Parse the "Frost detected" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Frost detected" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseFrostDetected(vscp_RxMessage const * const msg, vscp_evt_security_FrostDetected * const evt);
+
+/**
+ * Parse the "Flame detected" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Flame detected" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseFlameDetected(vscp_RxMessage const * const msg, vscp_evt_security_FlameDetected * const evt);
+
+/**
+ * Parse the "Oxygen Low" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Oxygen Low" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseOxygenLow(vscp_RxMessage const * const msg, vscp_evt_security_OxygenLow * const evt);
+
+/**
+ * Parse the "Weight detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Weight detected." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseWeightDetected(vscp_RxMessage const * const msg, vscp_evt_security_WeightDetected * const evt);
+
+/**
+ * Parse the "Water detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Water detected." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseWaterDetected(vscp_RxMessage const * const msg, vscp_evt_security_WaterDetected * const evt);
+
+/**
+ * Parse the "Condensation detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Condensation detected." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_security_parseCondensationDetected(vscp_RxMessage const * const msg, vscp_evt_security_CondensationDetected * const evt);
+
+/**
+ * Parse the "Noise (sound) detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Noise (sound) detected." event, it will return TRUE otherwise
+ * FALSE.
+ */
+extern BOOL vscp_evt_security_parseNoiseSoundDetected(vscp_RxMessage const * const msg, vscp_evt_security_NoiseSoundDetected * const evt);
+
+/**
+ * Parse the "Harmful sound levels detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Harmful sound levels detected." event, it will return TRUE
+ * otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseHarmfulSoundLevelsDetected(vscp_RxMessage const * const msg, vscp_evt_security_HarmfulSoundLevelsDetected * const evt);
+
+/**
+ * Parse the "Tamper detected." event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Tamper detected." event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseTamperDetected(vscp_RxMessage const * const msg, vscp_evt_security_TamperDetected * const evt);
+
+/**
+ * Parse the "Authenticated" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Authenticated" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseAuthenticated(vscp_RxMessage const * const msg, vscp_evt_security_Authenticated * const evt);
+
+/**
+ * Parse the "Unauthenticated" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unauthenticated" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseUnauthenticated(vscp_RxMessage const * const msg, vscp_evt_security_Unauthenticated * const evt);
+
+/**
+ * Parse the "Authorized" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Authorized" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseAuthorized(vscp_RxMessage const * const msg, vscp_evt_security_Authorized * const evt);
+
+/**
+ * Parse the "Unauthorized" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Unauthorized" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseUnauthorized(vscp_RxMessage const * const msg, vscp_evt_security_Unauthorized * const evt);
+
+/**
+ * Parse the "ID check" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "ID check" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseIdCheck(vscp_RxMessage const * const msg, vscp_evt_security_IdCheck * const evt);
+
+/**
+ * Parse the "Valid pin" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Valid pin" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseValidPin(vscp_RxMessage const * const msg, vscp_evt_security_ValidPin * const evt);
+
+/**
+ * Parse the "Invalid pin" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Invalid pin" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseInvalidPin(vscp_RxMessage const * const msg, vscp_evt_security_InvalidPin * const evt);
+
+/**
+ * Parse the "Pin warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pin warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePinWarning(vscp_RxMessage const * const msg, vscp_evt_security_PinWarning * const evt);
+
+/**
+ * Parse the "Pin error" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Pin error" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePinError(vscp_RxMessage const * const msg, vscp_evt_security_PinError * const evt);
+
+/**
+ * Parse the "Valid password" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Valid password" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseValidPassword(vscp_RxMessage const * const msg, vscp_evt_security_ValidPassword * const evt);
+
+/**
+ * Parse the "Invalid password" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Invalid password" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseInvalidPassword(vscp_RxMessage const * const msg, vscp_evt_security_InvalidPassword * const evt);
+
+/**
+ * Parse the "Password warning" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Password warning" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePasswordWarning(vscp_RxMessage const * const msg, vscp_evt_security_PasswordWarning * const evt);
+
+/**
+ * Parse the "Password error" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Password error" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parsePasswordError(vscp_RxMessage const * const msg, vscp_evt_security_PasswordError * const evt);
+
+/**
+ * Parse the "Gas" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Gas" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseGas(vscp_RxMessage const * const msg, vscp_evt_security_Gas * const evt);
+
+/**
+ * Parse the "In motion" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "In motion" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseInMotion(vscp_RxMessage const * const msg, vscp_evt_security_InMotion * const evt);
+
+/**
+ * Parse the "Not in motion" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Not in motion" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseNotInMotion(vscp_RxMessage const * const msg, vscp_evt_security_NotInMotion * const evt);
+
+/**
+ * Parse the "Vibration" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "Vibration" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parseVibration(vscp_RxMessage const * const msg, vscp_evt_security_Vibration * const evt);
+
+/**
+ * Parse a received event of the "Security" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_security_parse(vscp_RxMessage const * const msg, vscp_evt_security_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_setvaluezone.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,2784 +73,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Count
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendCount(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_COUNT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Length/Distance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendLengthDistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_LENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Mass
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendMass(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_MASS, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Time
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_TIME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric Current
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricCurrent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRIC_CURRENT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Temperature
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendTemperature(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_TEMPERATURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Amount of substance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendAmountOfSubstance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_AMOUNT_OF_SUBSTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Intensity (Intensity of light)
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_INTENSITY_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Frequency
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendFrequency(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_FREQUENCY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radioactivity and other random events
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_RADIOACTIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Force
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendForce(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_FORCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pressure
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendPressure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Energy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendEnergy(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Power
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendPower(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Charge
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricalCharge(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CHARGE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Potential (Voltage)
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricalPotentialVoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRICAL_POTENTIAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Capacitance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricalCapacitance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CAPACITANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Resistance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricalResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRICAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electrical Conductance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricalConductance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CONDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Field Strength
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendMagneticFieldStrength(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_MAGNETIC_FIELD_STRENGTH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendMagneticFlux(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_MAGNETIC_FLUX, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Magnetic Flux Density
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendMagneticFluxDensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_MAGNETIC_FLUX_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Inductance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendInductance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_INDUCTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous Flux
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendLuminousFlux(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_FLUX_OF_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Illuminance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendIlluminance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ILLUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiation dose
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendRadiationDose(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_RADIATION_DOSE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Catalytic activity
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendCatalyticActivity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_CATALYTIC_ACITIVITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Volume
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendVolume(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_VOLUME, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound intensity
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendSoundIntensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SOUND_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Angle
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendAngle(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ANGLE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Position WGS 84
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendPositionWgs84(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_POSITION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Speed
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SPEED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Acceleration
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendAcceleration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ACCELERATION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Tension
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendTension(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_TENSION, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Damp/moist (Hygrometer reading)
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendDampMoistHygrometerReading(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_HUMIDITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Flow
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendFlow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_FLOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Thermal resistance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendThermalResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_THERMAL_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Refractive (optical) power
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendRefractiveOpticalPower(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_REFRACTIVE_POWER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Dynamic viscosity
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendDynamicViscosity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_DYNAMIC_VISCOSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound impedance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendSoundImpedance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SOUND_IMPEDANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound resistance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendSoundResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SOUND_RESISTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Electric elastance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendElectricElastance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ELECTRIC_ELASTANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminous energy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendLuminousEnergy(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_LUMINOUS_ENERGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Luminance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendLuminance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_LUMINANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Chemical (molar) concentration
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendChemicalMolarConcentration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_CHEMICAL_CONCENTRATION_MOLAR, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Chemical (mass) concentration" not supported. No frame defined. */
-
-/**
- * Reserved
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendReserved(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_RESERVED47, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/* "Reserved" not supported. No frame defined. */
-
-/**
- * Dew Point
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_DEWPOINT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Relative Level
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendRelativeLevel(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_RELATIVE_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Altitude
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_ALTITUDE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Area
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendArea(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_AREA, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiant intensity
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendRadiantIntensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_RADIANT_INTENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Radiance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendRadiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Irradiance, Exitance, Radiosity
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
@@ -2859,7 +85,7 @@ extern BOOL vscp_evt_setvaluezone_sendRadiance(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+extern BOOL vscp_evt_setvaluezone_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
@@ -2870,7 +96,7 @@ extern BOOL vscp_evt_setvaluezone_sendIrradianceExitanceRadiosity(uint8_t index,
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = index;
     size += 1;
@@ -2901,267 +127,156 @@ extern BOOL vscp_evt_setvaluezone_sendIrradianceExitanceRadiosity(uint8_t index,
 }
 
 /**
- * Spectral radiance
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSpectralRadiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+extern BOOL vscp_evt_setvaluezone_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
-    {
-        return FALSE;
-    }
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SPECTRAL_RADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
 
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = size;
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Spectral irradiance
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
  * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSpectralIrradiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+extern BOOL vscp_evt_setvaluezone_parseCommon(vscp_RxMessage const * const msg, vscp_evt_setvaluezone_Common * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
+    uint8_t byteIndex   = 0;
 
-    if ((NULL == data) || (0 == dataSize))
+    if ((NULL == msg) || (NULL == evt))
     {
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SPECTRAL_IRRADIANCE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound pressure (acoustic pressure)
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendSoundPressureAcousticPressure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
+    if ((VSCP_CLASS_L1_SETVALUEZONE != msg->vscpClass) || (5 > msg->dataSize))
     {
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SOUND_PRESSURE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
+    evt->index = msg->data[0];
 
-    txMsg.data[1] = zone;
-    size += 1;
+    evt->zone = msg->data[1];
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->subZone = msg->data[2];
 
-    txMsg.data[3] = dataCoding;
-    size += 1;
+    evt->dataCoding = msg->data[3];
 
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
+    for(byteIndex = 0; (byteIndex < 4) && ((4 + byteIndex) < msg->dataSize); ++byteIndex)
     {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
+        evt->data[byteIndex] = msg->data[4 + byteIndex];
     }
+    evt->dataSize = byteIndex;
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
+    return TRUE;
 }
 
 /**
- * Sound energy density
+ * Parse a received event of the "Set value with zone" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
  * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundEnergyDensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+extern BOOL vscp_evt_setvaluezone_parse(vscp_RxMessage const * const msg, vscp_evt_setvaluezone_Event * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
+    BOOL    status  = FALSE;
 
-    if ((NULL == data) || (0 == dataSize))
+    if ((NULL == msg) || (NULL == evt))
     {
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SOUND_DENSITY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
-
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
-    {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sound level
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] dataCoding Data coding.
- * @param[in] data Data with format defined by byte 0.  (array[4])
- * @param[in] datasize Size in byte.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_setvaluezone_sendSoundLevel(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-    uint8_t         byteIndex   = 0;
-
-    if ((NULL == data) || (0 == dataSize))
+    if (VSCP_CLASS_L1_SETVALUEZONE != msg->vscpClass)
     {
         return FALSE;
     }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_SETVALUEZONE, VSCP_TYPE_SETVALUEZONE_SOUND_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.data[3] = dataCoding;
-    size += 1;
+    evt->vscpType = msg->vscpType;
 
-    for(byteIndex = 0; byteIndex < dataSize; ++byteIndex)
+    switch(msg->vscpType)
     {
-        txMsg.data[4 + byteIndex] = data[byteIndex];
-        size += 1;
-
-        if (VSCP_L1_DATA_SIZE <= size)
-        {
-            break;
-        }
-    }
-
-    txMsg.dataSize = size;
+    case VSCP_TYPE_SETVALUEZONE_GENERAL:
+        status = TRUE;
+        break;
 
-    return vscp_core_sendEvent(&txMsg);
+    case VSCP_TYPE_SETVALUEZONE_COUNT:
+    case VSCP_TYPE_SETVALUEZONE_LENGTH:
+    case VSCP_TYPE_SETVALUEZONE_MASS:
+    case VSCP_TYPE_SETVALUEZONE_TIME:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRIC_CURRENT:
+    case VSCP_TYPE_SETVALUEZONE_TEMPERATURE:
+    case VSCP_TYPE_SETVALUEZONE_AMOUNT_OF_SUBSTANCE:
+    case VSCP_TYPE_SETVALUEZONE_INTENSITY_OF_LIGHT:
+    case VSCP_TYPE_SETVALUEZONE_FREQUENCY:
+    case VSCP_TYPE_SETVALUEZONE_RADIOACTIVITY:
+    case VSCP_TYPE_SETVALUEZONE_FORCE:
+    case VSCP_TYPE_SETVALUEZONE_PRESSURE:
+    case VSCP_TYPE_SETVALUEZONE_ENERGY:
+    case VSCP_TYPE_SETVALUEZONE_POWER:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CHARGE:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRICAL_POTENTIAL:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CAPACITANCE:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRICAL_RESISTANCE:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CONDUCTANCE:
+    case VSCP_TYPE_SETVALUEZONE_MAGNETIC_FIELD_STRENGTH:
+    case VSCP_TYPE_SETVALUEZONE_MAGNETIC_FLUX:
+    case VSCP_TYPE_SETVALUEZONE_MAGNETIC_FLUX_DENSITY:
+    case VSCP_TYPE_SETVALUEZONE_INDUCTANCE:
+    case VSCP_TYPE_SETVALUEZONE_FLUX_OF_LIGHT:
+    case VSCP_TYPE_SETVALUEZONE_ILLUMINANCE:
+    case VSCP_TYPE_SETVALUEZONE_RADIATION_DOSE:
+    case VSCP_TYPE_SETVALUEZONE_CATALYTIC_ACITIVITY:
+    case VSCP_TYPE_SETVALUEZONE_VOLUME:
+    case VSCP_TYPE_SETVALUEZONE_SOUND_INTENSITY:
+    case VSCP_TYPE_SETVALUEZONE_ANGLE:
+    case VSCP_TYPE_SETVALUEZONE_POSITION:
+    case VSCP_TYPE_SETVALUEZONE_SPEED:
+    case VSCP_TYPE_SETVALUEZONE_ACCELERATION:
+    case VSCP_TYPE_SETVALUEZONE_TENSION:
+    case VSCP_TYPE_SETVALUEZONE_HUMIDITY:
+    case VSCP_TYPE_SETVALUEZONE_FLOW:
+    case VSCP_TYPE_SETVALUEZONE_THERMAL_RESISTANCE:
+    case VSCP_TYPE_SETVALUEZONE_REFRACTIVE_POWER:
+    case VSCP_TYPE_SETVALUEZONE_DYNAMIC_VISCOSITY:
+    case VSCP_TYPE_SETVALUEZONE_SOUND_IMPEDANCE:
+    case VSCP_TYPE_SETVALUEZONE_SOUND_RESISTANCE:
+    case VSCP_TYPE_SETVALUEZONE_ELECTRIC_ELASTANCE:
+    case VSCP_TYPE_SETVALUEZONE_LUMINOUS_ENERGY:
+    case VSCP_TYPE_SETVALUEZONE_LUMINANCE:
+    case VSCP_TYPE_SETVALUEZONE_CHEMICAL_CONCENTRATION_MOLAR:
+    case VSCP_TYPE_SETVALUEZONE_RESERVED47:
+    case VSCP_TYPE_SETVALUEZONE_DEWPOINT:
+    case VSCP_TYPE_SETVALUEZONE_RELATIVE_LEVEL:
+    case VSCP_TYPE_SETVALUEZONE_ALTITUDE:
+    case VSCP_TYPE_SETVALUEZONE_AREA:
+    case VSCP_TYPE_SETVALUEZONE_RADIANT_INTENSITY:
+    case VSCP_TYPE_SETVALUEZONE_RADIANCE:
+    case VSCP_TYPE_SETVALUEZONE_IRRADIANCE:
+    case VSCP_TYPE_SETVALUEZONE_SPECTRAL_RADIANCE:
+    case VSCP_TYPE_SETVALUEZONE_SPECTRAL_IRRADIANCE:
+    case VSCP_TYPE_SETVALUEZONE_SOUND_PRESSURE:
+    case VSCP_TYPE_SETVALUEZONE_SOUND_DENSITY:
+    case VSCP_TYPE_SETVALUEZONE_SOUND_LEVEL:
+        status = vscp_evt_setvaluezone_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
@@ -48,6 +48,8 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_type_setvaluezone.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -70,6 +72,31 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t dataCoding; /**< Data coding */
+    uint8_t data[4]; /**< Data */
+    uint8_t dataSize; /**< Data size */
+
+} vscp_evt_setvaluezone_Common;
+
+/** Parsed event of the "Set value with zone" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_setvaluezone_Common common; /**< Parameters of all types, which share the same frame layout */
+    } data;
+
+} vscp_evt_setvaluezone_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -78,6 +105,21 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index for sensor.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] dataCoding Data coding.
+ * @param[in] data Data with format defined by byte 0.  (array[4])
+ * @param[in] datasize Size in byte.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_setvaluezone_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+
 /**
  * General event
  * 
@@ -97,7 +139,10 @@ extern BOOL vscp_evt_setvaluezone_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendCount(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendCount(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_COUNT, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Length/Distance
@@ -111,7 +156,10 @@ extern BOOL vscp_evt_setvaluezone_sendCount(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendLengthDistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendLengthDistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_LENGTH, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Mass
@@ -125,7 +173,10 @@ extern BOOL vscp_evt_setvaluezone_sendLengthDistance(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendMass(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendMass(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_MASS, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Time
@@ -139,7 +190,10 @@ extern BOOL vscp_evt_setvaluezone_sendMass(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendTime(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_TIME, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electric Current
@@ -153,7 +207,10 @@ extern BOOL vscp_evt_setvaluezone_sendTime(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricCurrent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricCurrent(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRIC_CURRENT, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Temperature
@@ -167,7 +224,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricCurrent(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendTemperature(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendTemperature(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_TEMPERATURE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Amount of substance
@@ -181,7 +241,10 @@ extern BOOL vscp_evt_setvaluezone_sendTemperature(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendAmountOfSubstance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendAmountOfSubstance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_AMOUNT_OF_SUBSTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Luminous Intensity (Intensity of light)
@@ -195,7 +258,10 @@ extern BOOL vscp_evt_setvaluezone_sendAmountOfSubstance(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendLuminousIntensityIntensityOfLight(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_INTENSITY_OF_LIGHT, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Frequency
@@ -209,7 +275,10 @@ extern BOOL vscp_evt_setvaluezone_sendLuminousIntensityIntensityOfLight(uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendFrequency(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendFrequency(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_FREQUENCY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Radioactivity and other random events
@@ -223,7 +292,10 @@ extern BOOL vscp_evt_setvaluezone_sendFrequency(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendRadioactivityAndOtherRandomEvents(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_RADIOACTIVITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Force
@@ -237,7 +309,10 @@ extern BOOL vscp_evt_setvaluezone_sendRadioactivityAndOtherRandomEvents(uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendForce(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendForce(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_FORCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Pressure
@@ -251,7 +326,10 @@ extern BOOL vscp_evt_setvaluezone_sendForce(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendPressure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendPressure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_PRESSURE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Energy
@@ -265,7 +343,10 @@ extern BOOL vscp_evt_setvaluezone_sendPressure(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendEnergy(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendEnergy(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ENERGY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Power
@@ -279,7 +360,10 @@ extern BOOL vscp_evt_setvaluezone_sendEnergy(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendPower(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendPower(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_POWER, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electrical Charge
@@ -293,7 +377,10 @@ extern BOOL vscp_evt_setvaluezone_sendPower(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricalCharge(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricalCharge(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CHARGE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electrical Potential (Voltage)
@@ -307,7 +394,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricalCharge(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricalPotentialVoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricalPotentialVoltage(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRICAL_POTENTIAL, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electrical Capacitance
@@ -321,7 +411,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricalPotentialVoltage(uint8_t index,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricalCapacitance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricalCapacitance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CAPACITANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electrical Resistance
@@ -335,7 +428,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricalCapacitance(uint8_t index, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricalResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricalResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRICAL_RESISTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electrical Conductance
@@ -349,7 +445,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricalResistance(uint8_t index, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricalConductance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricalConductance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRICAL_CONDUCTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Magnetic Field Strength
@@ -363,7 +462,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricalConductance(uint8_t index, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendMagneticFieldStrength(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendMagneticFieldStrength(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_MAGNETIC_FIELD_STRENGTH, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Magnetic Flux
@@ -377,7 +479,10 @@ extern BOOL vscp_evt_setvaluezone_sendMagneticFieldStrength(uint8_t index, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendMagneticFlux(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendMagneticFlux(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_MAGNETIC_FLUX, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Magnetic Flux Density
@@ -391,7 +496,10 @@ extern BOOL vscp_evt_setvaluezone_sendMagneticFlux(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendMagneticFluxDensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendMagneticFluxDensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_MAGNETIC_FLUX_DENSITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Inductance
@@ -405,7 +513,10 @@ extern BOOL vscp_evt_setvaluezone_sendMagneticFluxDensity(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendInductance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendInductance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_INDUCTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Luminous Flux
@@ -419,7 +530,10 @@ extern BOOL vscp_evt_setvaluezone_sendInductance(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendLuminousFlux(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendLuminousFlux(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_FLUX_OF_LIGHT, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Illuminance
@@ -433,7 +547,10 @@ extern BOOL vscp_evt_setvaluezone_sendLuminousFlux(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendIlluminance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendIlluminance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ILLUMINANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Radiation dose
@@ -447,7 +564,10 @@ extern BOOL vscp_evt_setvaluezone_sendIlluminance(uint8_t index, uint8_t zone, u
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendRadiationDose(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendRadiationDose(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_RADIATION_DOSE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Catalytic activity
@@ -461,7 +581,10 @@ extern BOOL vscp_evt_setvaluezone_sendRadiationDose(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendCatalyticActivity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendCatalyticActivity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_CATALYTIC_ACITIVITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Volume
@@ -475,7 +598,10 @@ extern BOOL vscp_evt_setvaluezone_sendCatalyticActivity(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendVolume(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendVolume(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_VOLUME, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Sound intensity
@@ -489,7 +615,10 @@ extern BOOL vscp_evt_setvaluezone_sendVolume(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundIntensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSoundIntensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SOUND_INTENSITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Angle
@@ -503,7 +632,10 @@ extern BOOL vscp_evt_setvaluezone_sendSoundIntensity(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendAngle(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendAngle(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ANGLE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Position WGS 84
@@ -517,7 +649,10 @@ extern BOOL vscp_evt_setvaluezone_sendAngle(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendPositionWgs84(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendPositionWgs84(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_POSITION, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Speed
@@ -531,7 +666,10 @@ extern BOOL vscp_evt_setvaluezone_sendPositionWgs84(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SPEED, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Acceleration
@@ -545,7 +683,10 @@ extern BOOL vscp_evt_setvaluezone_sendSpeed(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendAcceleration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendAcceleration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ACCELERATION, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Tension
@@ -559,7 +700,10 @@ extern BOOL vscp_evt_setvaluezone_sendAcceleration(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendTension(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendTension(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_TENSION, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Damp/moist (Hygrometer reading)
@@ -573,7 +717,10 @@ extern BOOL vscp_evt_setvaluezone_sendTension(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendDampMoistHygrometerReading(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendDampMoistHygrometerReading(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_HUMIDITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Flow
@@ -587,7 +734,10 @@ extern BOOL vscp_evt_setvaluezone_sendDampMoistHygrometerReading(uint8_t index,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendFlow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendFlow(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_FLOW, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Thermal resistance
@@ -601,7 +751,10 @@ extern BOOL vscp_evt_setvaluezone_sendFlow(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendThermalResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendThermalResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_THERMAL_RESISTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Refractive (optical) power
@@ -615,7 +768,10 @@ extern BOOL vscp_evt_setvaluezone_sendThermalResistance(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendRefractiveOpticalPower(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendRefractiveOpticalPower(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_REFRACTIVE_POWER, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Dynamic viscosity
@@ -629,7 +785,10 @@ extern BOOL vscp_evt_setvaluezone_sendRefractiveOpticalPower(uint8_t index, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendDynamicViscosity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendDynamicViscosity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_DYNAMIC_VISCOSITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Sound impedance
@@ -643,7 +802,10 @@ extern BOOL vscp_evt_setvaluezone_sendDynamicViscosity(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundImpedance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSoundImpedance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SOUND_IMPEDANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Sound resistance
@@ -657,7 +819,10 @@ extern BOOL vscp_evt_setvaluezone_sendSoundImpedance(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSoundResistance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SOUND_RESISTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Electric elastance
@@ -671,7 +836,10 @@ extern BOOL vscp_evt_setvaluezone_sendSoundResistance(uint8_t index, uint8_t zon
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendElectricElastance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendElectricElastance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ELECTRIC_ELASTANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Luminous energy
@@ -685,7 +853,10 @@ extern BOOL vscp_evt_setvaluezone_sendElectricElastance(uint8_t index, uint8_t z
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendLuminousEnergy(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendLuminousEnergy(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_LUMINOUS_ENERGY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Luminance
@@ -699,7 +870,10 @@ extern BOOL vscp_evt_setvaluezone_sendLuminousEnergy(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendLuminance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendLuminance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_LUMINANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Chemical (molar) concentration
@@ -713,7 +887,10 @@ extern BOOL vscp_evt_setvaluezone_sendLuminance(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendChemicalMolarConcentration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendChemicalMolarConcentration(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_CHEMICAL_CONCENTRATION_MOLAR, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /* "Chemical (mass) concentration" not supported. No frame defined. */
 
@@ -729,7 +906,10 @@ extern BOOL vscp_evt_setvaluezone_sendChemicalMolarConcentration(uint8_t index,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendReserved(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendReserved(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_RESERVED47, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /* "Reserved" not supported. No frame defined. */
 
@@ -745,7 +925,10 @@ extern BOOL vscp_evt_setvaluezone_sendReserved(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_DEWPOINT, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Relative Level
@@ -759,7 +942,10 @@ extern BOOL vscp_evt_setvaluezone_sendDewPoint(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendRelativeLevel(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendRelativeLevel(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_RELATIVE_LEVEL, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Altitude
@@ -773,7 +959,10 @@ extern BOOL vscp_evt_setvaluezone_sendRelativeLevel(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_ALTITUDE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Area
@@ -787,7 +976,10 @@ extern BOOL vscp_evt_setvaluezone_sendAltitude(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendArea(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendArea(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_AREA, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Radiant intensity
@@ -801,7 +993,10 @@ extern BOOL vscp_evt_setvaluezone_sendArea(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendRadiantIntensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendRadiantIntensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_RADIANT_INTENSITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Radiance
@@ -815,7 +1010,10 @@ extern BOOL vscp_evt_setvaluezone_sendRadiantIntensity(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendRadiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendRadiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_RADIANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Irradiance, Exitance, Radiosity
@@ -829,7 +1027,10 @@ extern BOOL vscp_evt_setvaluezone_sendRadiance(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendIrradianceExitanceRadiosity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_IRRADIANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Spectral radiance
@@ -843,7 +1044,10 @@ extern BOOL vscp_evt_setvaluezone_sendIrradianceExitanceRadiosity(uint8_t index,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSpectralRadiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSpectralRadiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SPECTRAL_RADIANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Spectral irradiance
@@ -857,7 +1061,10 @@ extern BOOL vscp_evt_setvaluezone_sendSpectralRadiance(uint8_t index, uint8_t zo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSpectralIrradiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSpectralIrradiance(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SPECTRAL_IRRADIANCE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Sound pressure (acoustic pressure)
@@ -871,7 +1078,10 @@ extern BOOL vscp_evt_setvaluezone_sendSpectralIrradiance(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundPressureAcousticPressure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSoundPressureAcousticPressure(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SOUND_PRESSURE, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Sound energy density
@@ -885,7 +1095,10 @@ extern BOOL vscp_evt_setvaluezone_sendSoundPressureAcousticPressure(uint8_t inde
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundEnergyDensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSoundEnergyDensity(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SOUND_DENSITY, index, zone, subZone, dataCoding, data, dataSize);
+}
 
 /**
  * Sound level
@@ -899,7 +1112,31 @@ extern BOOL vscp_evt_setvaluezone_sendSoundEnergyDensity(uint8_t index, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_setvaluezone_sendSoundLevel(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize);
+static inline BOOL vscp_evt_setvaluezone_sendSoundLevel(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t dataCoding, uint8_t const * const data, uint8_t dataSize)
+{
+    return vscp_evt_setvaluezone_sendByType(VSCP_TYPE_SETVALUEZONE_SOUND_LEVEL, index, zone, subZone, dataCoding, data, dataSize);
+}
+
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_setvaluezone_parseCommon(vscp_RxMessage const * const msg, vscp_evt_setvaluezone_Common * const evt);
+
+/**
+ * Parse a received event of the "Set value with zone" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_setvaluezone_parse(vscp_RxMessage const * const msg, vscp_evt_setvaluezone_Event * const evt);
 
 #ifdef __cplusplus
 }
@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_weather.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,1386 +73,21 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 
 /**
- * General event
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendGeneralEvent(void)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_GENERAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataSize = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Season winter
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSeasonWinter(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASONS_WINTER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Season spring
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSeasonSpring(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASONS_SPRING, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Season summer
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSeasonSummer(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASONS_SUMMER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Autumn summer
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAutumnSummer(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASONS_AUTUMN, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * No wind
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendNoWind(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WIND_NONE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Low wind
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendLowWind(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WIND_LOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Medium wind
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendMediumWind(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WIND_MEDIUM, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * High wind
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendHighWind(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WIND_HIGH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Very high wind
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendVeryHighWind(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WIND_VERY_HIGH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air foggy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirFoggy(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_FOGGY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air freezing
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirFreezing(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_FREEZING, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air Very cold
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirVeryCold(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_VERY_COLD, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air cold
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirCold(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_COLD, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air normal
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirNormal(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_NORMAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air hot
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirHot(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_HOT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air very hot
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirVeryHot(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_VERY_HOT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pollution low
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendPollutionLow(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pollution medium
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendPollutionMedium(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Pollution high
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendPollutionHigh(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air humid
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirHumid(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_HUMID, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Air dry
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendAirDry(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_DRY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Soil humid
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSoilHumid(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SOIL_HUMID, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Soil dry
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSoilDry(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SOIL_DRY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Rain none
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendRainNone(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_NONE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Rain light
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendRainLight(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Rain heavy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendRainHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_HEAVY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Rain very heavy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendRainVeryHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sun none
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSunNone(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SUN_NONE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sun light
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSunLight(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SUN_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Sun heavy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSunHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SUN_HEAVY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Snow none
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSnowNone(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SNOW_NONE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Snow light
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSnowLight(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SNOW_LIGHT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Snow heavy
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendSnowHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SNOW_HEAVY, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Dew point
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_DEW_POINT, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Storm
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendStorm(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_STORM, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Flood
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendFlood(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_FLOOD, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Earthquake
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendEarthquake(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_EARTHQUAKE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Nuclear disaster
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendNuclearDisaster(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_NUCLEAR_DISASTER, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Fire
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendFire(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_FIRE, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Lightning
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendLightning(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_LIGHTNING, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * UV Radiation low
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendUvRadiationLow(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_LOW, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * UV Radiation medium
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendUvRadiationMedium(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * UV Radiation normal
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendUvRadiationNormal(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * UV Radiation high
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendUvRadiationHigh(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_HIGH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * UV Radiation very high
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendUvRadiationVeryHigh(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
-
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Warning level 1
+ * Generic sender for all types, which share the same frame layout.
  * 
+ * @param[in] vscpType The VSCP type.
  * @param[in] index Index for sensor.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel1(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_weather_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL1, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, vscpType, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = index;
     size += 1;
@@ -1468,50 +104,37 @@ extern BOOL vscp_evt_weather_sendWarningLevel1(uint8_t index, uint8_t zone, uint
 }
 
 /**
- * Warning level 2
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * General event
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel2(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_weather_sendGeneralEvent(void)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL2, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
 
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
-    size += 1;
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_GENERAL, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = size;
+    txMsg.dataSize = 0;
 
     return vscp_core_sendEvent(&txMsg);
 }
 
 /**
- * Warning level 3
+ * UV Index
  * 
  * @param[in] index Index for sensor.
  * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
  * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] uvIndex UV index (0-15)
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel3(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_weather_sendUvIndex(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t uvIndex)
 {
     vscp_TxMessage  txMsg;
     uint8_t         size    = 0;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL3, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_INDEX, VSCP_PRIORITY_3_NORMAL);
 
     txMsg.data[0] = index;
     size += 1;
@@ -1522,34 +145,7 @@ extern BOOL vscp_evt_weather_sendWarningLevel3(uint8_t index, uint8_t zone, uint
     txMsg.data[2] = subZone;
     size += 1;
 
-    txMsg.dataSize = size;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Warning level 4
- * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
- */
-extern BOOL vscp_evt_weather_sendWarningLevel4(uint8_t index, uint8_t zone, uint8_t subZone)
-{
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL4, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
-
-    txMsg.data[2] = subZone;
+    txMsg.data[3] = uvIndex;
     size += 1;
 
     txMsg.dataSize = size;
@@ -1558,96 +154,158 @@ extern BOOL vscp_evt_weather_sendWarningLevel4(uint8_t index, uint8_t zone, uint
 }
 
 /**
- * Warning level 5
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
  * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel5(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_weather_parseCommon(vscp_RxMessage const * const msg, vscp_evt_weather_Common * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL5, VSCP_PRIORITY_3_NORMAL);
+    if ((VSCP_CLASS_L1_WEATHER != msg->vscpClass) || (3 > msg->dataSize))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[0] = index;
-    size += 1;
-
-    txMsg.data[1] = zone;
-    size += 1;
+    evt->index = msg->data[0];
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->zone = msg->data[1];
 
-    txMsg.dataSize = size;
+    evt->subZone = msg->data[2];
 
-    return vscp_core_sendEvent(&txMsg);
+    return TRUE;
 }
 
 /**
- * Armageddon
+ * Parse the "UV Index" event.
  * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the message is a valid "UV Index" event, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendArmageddon(uint8_t index, uint8_t zone, uint8_t subZone)
+extern BOOL vscp_evt_weather_parseUvIndex(vscp_RxMessage const * const msg, vscp_evt_weather_UvIndex * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_ARMAGEDON, VSCP_PRIORITY_3_NORMAL);
+    if ((VSCP_CLASS_L1_WEATHER != msg->vscpClass) || (VSCP_TYPE_WEATHER_UV_INDEX != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[0] = index;
-    size += 1;
+    evt->index = msg->data[0];
 
-    txMsg.data[1] = zone;
-    size += 1;
+    evt->zone = msg->data[1];
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->subZone = msg->data[2];
 
-    txMsg.dataSize = size;
+    evt->uvIndex = msg->data[3];
 
-    return vscp_core_sendEvent(&txMsg);
+    return TRUE;
 }
 
 /**
- * UV Index
+ * Parse a received event of the "Weather" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
  * 
- * @param[in] index Index for sensor.
- * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
- * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
- * @param[in] uvIndex UV index (0-15)
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
  * 
- * @return If event is sent, it will return TRUE otherwise FALSE.
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendUvIndex(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t uvIndex)
+extern BOOL vscp_evt_weather_parse(vscp_RxMessage const * const msg, vscp_evt_weather_Event * const evt)
 {
-    vscp_TxMessage  txMsg;
-    uint8_t         size    = 0;
+    BOOL    status  = FALSE;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_INDEX, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.data[0] = index;
-    size += 1;
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
 
-    txMsg.data[1] = zone;
-    size += 1;
+    if (VSCP_CLASS_L1_WEATHER != msg->vscpClass)
+    {
+        return FALSE;
+    }
 
-    txMsg.data[2] = subZone;
-    size += 1;
+    evt->vscpType = msg->vscpType;
 
-    txMsg.data[3] = uvIndex;
-    size += 1;
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_WEATHER_GENERAL:
+        status = TRUE;
+        break;
 
-    txMsg.dataSize = size;
+    case VSCP_TYPE_WEATHER_UV_INDEX:
+        status = vscp_evt_weather_parseUvIndex(msg, &evt->data.uvIndex);
+        break;
 
-    return vscp_core_sendEvent(&txMsg);
+    case VSCP_TYPE_WEATHER_SEASONS_WINTER:
+    case VSCP_TYPE_WEATHER_SEASONS_SPRING:
+    case VSCP_TYPE_WEATHER_SEASONS_SUMMER:
+    case VSCP_TYPE_WEATHER_SEASONS_AUTUMN:
+    case VSCP_TYPE_WEATHER_WIND_NONE:
+    case VSCP_TYPE_WEATHER_WIND_LOW:
+    case VSCP_TYPE_WEATHER_WIND_MEDIUM:
+    case VSCP_TYPE_WEATHER_WIND_HIGH:
+    case VSCP_TYPE_WEATHER_WIND_VERY_HIGH:
+    case VSCP_TYPE_WEATHER_AIR_FOGGY:
+    case VSCP_TYPE_WEATHER_AIR_FREEZING:
+    case VSCP_TYPE_WEATHER_AIR_VERY_COLD:
+    case VSCP_TYPE_WEATHER_AIR_COLD:
+    case VSCP_TYPE_WEATHER_AIR_NORMAL:
+    case VSCP_TYPE_WEATHER_AIR_HOT:
+    case VSCP_TYPE_WEATHER_AIR_VERY_HOT:
+    case VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW:
+    case VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM:
+    case VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH:
+    case VSCP_TYPE_WEATHER_AIR_HUMID:
+    case VSCP_TYPE_WEATHER_AIR_DRY:
+    case VSCP_TYPE_WEATHER_SOIL_HUMID:
+    case VSCP_TYPE_WEATHER_SOIL_DRY:
+    case VSCP_TYPE_WEATHER_RAIN_NONE:
+    case VSCP_TYPE_WEATHER_RAIN_LIGHT:
+    case VSCP_TYPE_WEATHER_RAIN_HEAVY:
+    case VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY:
+    case VSCP_TYPE_WEATHER_SUN_NONE:
+    case VSCP_TYPE_WEATHER_SUN_LIGHT:
+    case VSCP_TYPE_WEATHER_SUN_HEAVY:
+    case VSCP_TYPE_WEATHER_SNOW_NONE:
+    case VSCP_TYPE_WEATHER_SNOW_LIGHT:
+    case VSCP_TYPE_WEATHER_SNOW_HEAVY:
+    case VSCP_TYPE_WEATHER_DEW_POINT:
+    case VSCP_TYPE_WEATHER_STORM:
+    case VSCP_TYPE_WEATHER_FLOOD:
+    case VSCP_TYPE_WEATHER_EARTHQUAKE:
+    case VSCP_TYPE_WEATHER_NUCLEAR_DISASTER:
+    case VSCP_TYPE_WEATHER_FIRE:
+    case VSCP_TYPE_WEATHER_LIGHTNING:
+    case VSCP_TYPE_WEATHER_UV_RADIATION_LOW:
+    case VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM:
+    case VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL:
+    case VSCP_TYPE_WEATHER_UV_RADIATION_HIGH:
+    case VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH:
+    case VSCP_TYPE_WEATHER_WARNING_LEVEL1:
+    case VSCP_TYPE_WEATHER_WARNING_LEVEL2:
+    case VSCP_TYPE_WEATHER_WARNING_LEVEL3:
+    case VSCP_TYPE_WEATHER_WARNING_LEVEL4:
+    case VSCP_TYPE_WEATHER_WARNING_LEVEL5:
+    case VSCP_TYPE_WEATHER_ARMAGEDON:
+        status = vscp_evt_weather_parseCommon(msg, &evt->data.common);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
 }
 
@@ -47,6 +47,8 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
+#include "vscp_type_weather.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +71,39 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of all types, which share the same frame layout. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+
+} vscp_evt_weather_Common;
+
+/** Parameters of the "UV Index" event. */
+typedef struct
+{
+    uint8_t index; /**< Index */
+    uint8_t zone; /**< Zone */
+    uint8_t subZone; /**< Sub-zone */
+    uint8_t uvIndex; /**< UV index */
+
+} vscp_evt_weather_UvIndex;
+
+/** Parsed event of the "Weather" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_weather_Common common; /**< Parameters of all types, which share the same frame layout */
+        vscp_evt_weather_UvIndex uvIndex; /**< Parameters of the "UV Index" event */
+    } data;
+
+} vscp_evt_weather_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -77,6 +112,18 @@ extern "C"
     FUNCTIONS
 *******************************************************************************/
 
+/**
+ * Generic sender for all types, which share the same frame layout.
+ * 
+ * @param[in] vscpType The VSCP type.
+ * @param[in] index Index for sensor.
+ * @param[in] zone Zone for which event applies to (0-254). 255 is all zones.
+ * @param[in] subZone Sub-zone for which event applies to (0-254). 255 is all sub-zones.
+ * 
+ * @return If event is sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_weather_sendByType(uint8_t vscpType, uint8_t index, uint8_t zone, uint8_t subZone);
+
 /**
  * General event
  * 
@@ -93,7 +140,10 @@ extern BOOL vscp_evt_weather_sendGeneralEvent(void);
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSeasonWinter(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSeasonWinter(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SEASONS_WINTER, index, zone, subZone);
+}
 
 /**
  * Season spring
@@ -104,7 +154,10 @@ extern BOOL vscp_evt_weather_sendSeasonWinter(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSeasonSpring(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSeasonSpring(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SEASONS_SPRING, index, zone, subZone);
+}
 
 /**
  * Season summer
@@ -115,7 +168,10 @@ extern BOOL vscp_evt_weather_sendSeasonSpring(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSeasonSummer(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSeasonSummer(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SEASONS_SUMMER, index, zone, subZone);
+}
 
 /**
  * Autumn summer
@@ -126,7 +182,10 @@ extern BOOL vscp_evt_weather_sendSeasonSummer(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAutumnSummer(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAutumnSummer(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SEASONS_AUTUMN, index, zone, subZone);
+}
 
 /**
  * No wind
@@ -137,7 +196,10 @@ extern BOOL vscp_evt_weather_sendAutumnSummer(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendNoWind(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendNoWind(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WIND_NONE, index, zone, subZone);
+}
 
 /**
  * Low wind
@@ -148,7 +210,10 @@ extern BOOL vscp_evt_weather_sendNoWind(uint8_t index, uint8_t zone, uint8_t sub
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendLowWind(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendLowWind(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WIND_LOW, index, zone, subZone);
+}
 
 /**
  * Medium wind
@@ -159,7 +224,10 @@ extern BOOL vscp_evt_weather_sendLowWind(uint8_t index, uint8_t zone, uint8_t su
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendMediumWind(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendMediumWind(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WIND_MEDIUM, index, zone, subZone);
+}
 
 /**
  * High wind
@@ -170,7 +238,10 @@ extern BOOL vscp_evt_weather_sendMediumWind(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendHighWind(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendHighWind(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WIND_HIGH, index, zone, subZone);
+}
 
 /**
  * Very high wind
@@ -181,7 +252,10 @@ extern BOOL vscp_evt_weather_sendHighWind(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendVeryHighWind(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendVeryHighWind(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WIND_VERY_HIGH, index, zone, subZone);
+}
 
 /**
  * Air foggy
@@ -192,7 +266,10 @@ extern BOOL vscp_evt_weather_sendVeryHighWind(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirFoggy(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirFoggy(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_FOGGY, index, zone, subZone);
+}
 
 /**
  * Air freezing
@@ -203,7 +280,10 @@ extern BOOL vscp_evt_weather_sendAirFoggy(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirFreezing(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirFreezing(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_FREEZING, index, zone, subZone);
+}
 
 /**
  * Air Very cold
@@ -214,7 +294,10 @@ extern BOOL vscp_evt_weather_sendAirFreezing(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirVeryCold(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirVeryCold(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_VERY_COLD, index, zone, subZone);
+}
 
 /**
  * Air cold
@@ -225,7 +308,10 @@ extern BOOL vscp_evt_weather_sendAirVeryCold(uint8_t index, uint8_t zone, uint8_
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirCold(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirCold(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_COLD, index, zone, subZone);
+}
 
 /**
  * Air normal
@@ -236,7 +322,10 @@ extern BOOL vscp_evt_weather_sendAirCold(uint8_t index, uint8_t zone, uint8_t su
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirNormal(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirNormal(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_NORMAL, index, zone, subZone);
+}
 
 /**
  * Air hot
@@ -247,7 +336,10 @@ extern BOOL vscp_evt_weather_sendAirNormal(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirHot(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirHot(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_HOT, index, zone, subZone);
+}
 
 /**
  * Air very hot
@@ -258,7 +350,10 @@ extern BOOL vscp_evt_weather_sendAirHot(uint8_t index, uint8_t zone, uint8_t sub
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirVeryHot(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirVeryHot(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_VERY_HOT, index, zone, subZone);
+}
 
 /**
  * Pollution low
@@ -269,7 +364,10 @@ extern BOOL vscp_evt_weather_sendAirVeryHot(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendPollutionLow(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendPollutionLow(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW, index, zone, subZone);
+}
 
 /**
  * Pollution medium
@@ -280,7 +378,10 @@ extern BOOL vscp_evt_weather_sendPollutionLow(uint8_t index, uint8_t zone, uint8
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendPollutionMedium(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendPollutionMedium(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM, index, zone, subZone);
+}
 
 /**
  * Pollution high
@@ -291,7 +392,10 @@ extern BOOL vscp_evt_weather_sendPollutionMedium(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendPollutionHigh(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendPollutionHigh(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH, index, zone, subZone);
+}
 
 /**
  * Air humid
@@ -302,7 +406,10 @@ extern BOOL vscp_evt_weather_sendPollutionHigh(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirHumid(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirHumid(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_HUMID, index, zone, subZone);
+}
 
 /**
  * Air dry
@@ -313,7 +420,10 @@ extern BOOL vscp_evt_weather_sendAirHumid(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendAirDry(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendAirDry(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_AIR_DRY, index, zone, subZone);
+}
 
 /**
  * Soil humid
@@ -324,7 +434,10 @@ extern BOOL vscp_evt_weather_sendAirDry(uint8_t index, uint8_t zone, uint8_t sub
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSoilHumid(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSoilHumid(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SOIL_HUMID, index, zone, subZone);
+}
 
 /**
  * Soil dry
@@ -335,7 +448,10 @@ extern BOOL vscp_evt_weather_sendSoilHumid(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSoilDry(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSoilDry(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SOIL_DRY, index, zone, subZone);
+}
 
 /**
  * Rain none
@@ -346,7 +462,10 @@ extern BOOL vscp_evt_weather_sendSoilDry(uint8_t index, uint8_t zone, uint8_t su
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendRainNone(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendRainNone(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_RAIN_NONE, index, zone, subZone);
+}
 
 /**
  * Rain light
@@ -357,7 +476,10 @@ extern BOOL vscp_evt_weather_sendRainNone(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendRainLight(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendRainLight(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_RAIN_LIGHT, index, zone, subZone);
+}
 
 /**
  * Rain heavy
@@ -368,7 +490,10 @@ extern BOOL vscp_evt_weather_sendRainLight(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendRainHeavy(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendRainHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_RAIN_HEAVY, index, zone, subZone);
+}
 
 /**
  * Rain very heavy
@@ -379,7 +504,10 @@ extern BOOL vscp_evt_weather_sendRainHeavy(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendRainVeryHeavy(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendRainVeryHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY, index, zone, subZone);
+}
 
 /**
  * Sun none
@@ -390,7 +518,10 @@ extern BOOL vscp_evt_weather_sendRainVeryHeavy(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSunNone(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSunNone(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SUN_NONE, index, zone, subZone);
+}
 
 /**
  * Sun light
@@ -401,7 +532,10 @@ extern BOOL vscp_evt_weather_sendSunNone(uint8_t index, uint8_t zone, uint8_t su
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSunLight(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSunLight(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SUN_LIGHT, index, zone, subZone);
+}
 
 /**
  * Sun heavy
@@ -412,7 +546,10 @@ extern BOOL vscp_evt_weather_sendSunLight(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSunHeavy(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSunHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SUN_HEAVY, index, zone, subZone);
+}
 
 /**
  * Snow none
@@ -423,7 +560,10 @@ extern BOOL vscp_evt_weather_sendSunHeavy(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSnowNone(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSnowNone(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SNOW_NONE, index, zone, subZone);
+}
 
 /**
  * Snow light
@@ -434,7 +574,10 @@ extern BOOL vscp_evt_weather_sendSnowNone(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSnowLight(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSnowLight(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SNOW_LIGHT, index, zone, subZone);
+}
 
 /**
  * Snow heavy
@@ -445,7 +588,10 @@ extern BOOL vscp_evt_weather_sendSnowLight(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendSnowHeavy(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendSnowHeavy(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_SNOW_HEAVY, index, zone, subZone);
+}
 
 /**
  * Dew point
@@ -456,7 +602,10 @@ extern BOOL vscp_evt_weather_sendSnowHeavy(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendDewPoint(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_DEW_POINT, index, zone, subZone);
+}
 
 /**
  * Storm
@@ -467,7 +616,10 @@ extern BOOL vscp_evt_weather_sendDewPoint(uint8_t index, uint8_t zone, uint8_t s
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendStorm(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendStorm(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_STORM, index, zone, subZone);
+}
 
 /**
  * Flood
@@ -478,7 +630,10 @@ extern BOOL vscp_evt_weather_sendStorm(uint8_t index, uint8_t zone, uint8_t subZ
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendFlood(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendFlood(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_FLOOD, index, zone, subZone);
+}
 
 /**
  * Earthquake
@@ -489,7 +644,10 @@ extern BOOL vscp_evt_weather_sendFlood(uint8_t index, uint8_t zone, uint8_t subZ
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendEarthquake(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendEarthquake(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_EARTHQUAKE, index, zone, subZone);
+}
 
 /**
  * Nuclear disaster
@@ -500,7 +658,10 @@ extern BOOL vscp_evt_weather_sendEarthquake(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendNuclearDisaster(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendNuclearDisaster(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_NUCLEAR_DISASTER, index, zone, subZone);
+}
 
 /**
  * Fire
@@ -511,7 +672,10 @@ extern BOOL vscp_evt_weather_sendNuclearDisaster(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendFire(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendFire(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_FIRE, index, zone, subZone);
+}
 
 /**
  * Lightning
@@ -522,7 +686,10 @@ extern BOOL vscp_evt_weather_sendFire(uint8_t index, uint8_t zone, uint8_t subZo
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendLightning(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendLightning(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_LIGHTNING, index, zone, subZone);
+}
 
 /**
  * UV Radiation low
@@ -533,7 +700,10 @@ extern BOOL vscp_evt_weather_sendLightning(uint8_t index, uint8_t zone, uint8_t
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendUvRadiationLow(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendUvRadiationLow(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_UV_RADIATION_LOW, index, zone, subZone);
+}
 
 /**
  * UV Radiation medium
@@ -544,7 +714,10 @@ extern BOOL vscp_evt_weather_sendUvRadiationLow(uint8_t index, uint8_t zone, uin
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendUvRadiationMedium(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendUvRadiationMedium(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM, index, zone, subZone);
+}
 
 /**
  * UV Radiation normal
@@ -555,7 +728,10 @@ extern BOOL vscp_evt_weather_sendUvRadiationMedium(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendUvRadiationNormal(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendUvRadiationNormal(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL, index, zone, subZone);
+}
 
 /**
  * UV Radiation high
@@ -566,7 +742,10 @@ extern BOOL vscp_evt_weather_sendUvRadiationNormal(uint8_t index, uint8_t zone,
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendUvRadiationHigh(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendUvRadiationHigh(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_UV_RADIATION_HIGH, index, zone, subZone);
+}
 
 /**
  * UV Radiation very high
@@ -577,7 +756,10 @@ extern BOOL vscp_evt_weather_sendUvRadiationHigh(uint8_t index, uint8_t zone, ui
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendUvRadiationVeryHigh(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendUvRadiationVeryHigh(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH, index, zone, subZone);
+}
 
 /**
  * Warning level 1
@@ -588,7 +770,10 @@ extern BOOL vscp_evt_weather_sendUvRadiationVeryHigh(uint8_t index, uint8_t zone
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel1(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendWarningLevel1(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WARNING_LEVEL1, index, zone, subZone);
+}
 
 /**
  * Warning level 2
@@ -599,7 +784,10 @@ extern BOOL vscp_evt_weather_sendWarningLevel1(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel2(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendWarningLevel2(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WARNING_LEVEL2, index, zone, subZone);
+}
 
 /**
  * Warning level 3
@@ -610,7 +798,10 @@ extern BOOL vscp_evt_weather_sendWarningLevel2(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel3(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendWarningLevel3(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WARNING_LEVEL3, index, zone, subZone);
+}
 
 /**
  * Warning level 4
@@ -621,7 +812,10 @@ extern BOOL vscp_evt_weather_sendWarningLevel3(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel4(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendWarningLevel4(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WARNING_LEVEL4, index, zone, subZone);
+}
 
 /**
  * Warning level 5
@@ -632,7 +826,10 @@ extern BOOL vscp_evt_weather_sendWarningLevel4(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendWarningLevel5(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendWarningLevel5(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_WARNING_LEVEL5, index, zone, subZone);
+}
 
 /**
  * Armageddon
@@ -643,7 +840,10 @@ extern BOOL vscp_evt_weather_sendWarningLevel5(uint8_t index, uint8_t zone, uint
  * 
  * @return If event is sent, it will return TRUE otherwise FALSE.
  */
-extern BOOL vscp_evt_weather_sendArmageddon(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_evt_weather_sendArmageddon(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_evt_weather_sendByType(VSCP_TYPE_WEATHER_ARMAGEDON, index, zone, subZone);
+}
 
 /**
  * UV Index
@@ -657,6 +857,37 @@ extern BOOL vscp_evt_weather_sendArmageddon(uint8_t index, uint8_t zone, uint8_t
  */
 extern BOOL vscp_evt_weather_sendUvIndex(uint8_t index, uint8_t zone, uint8_t subZone, uint8_t uvIndex);
 
+/**
+ * Parse all types, which share the same frame layout. The VSCP type is not checked.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message contains valid event parameters, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_weather_parseCommon(vscp_RxMessage const * const msg, vscp_evt_weather_Common * const evt);
+
+/**
+ * Parse the "UV Index" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "UV Index" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_weather_parseUvIndex(vscp_RxMessage const * const msg, vscp_evt_weather_UvIndex * const evt);
+
+/**
+ * Parse a received event of the "Weather" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_weather_parse(vscp_RxMessage const * const msg, vscp_evt_weather_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
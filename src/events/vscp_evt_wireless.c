@@ -46,6 +46,7 @@ This file is automatically generated. Don't change it manually.
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_wireless.h"
+#include "vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -112,3 +113,70 @@ extern BOOL vscp_evt_wireless_sendGsmCell(uint32_t count)
     return vscp_core_sendEvent(&txMsg);
 }
 
+/**
+ * Parse the "GSM Cell" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "GSM Cell" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_wireless_parseGsmCell(vscp_RxMessage const * const msg, vscp_evt_wireless_GsmCell * const evt)
+{
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if ((VSCP_CLASS_L1_WIRELESS != msg->vscpClass) || (VSCP_TYPE_WIRELESS_GSM_CELL != msg->vscpType) || (4 > msg->dataSize))
+    {
+        return FALSE;
+    }
+
+    evt->count = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+
+    return TRUE;
+}
+
+/**
+ * Parse a received event of the "Wireless" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_wireless_parse(vscp_RxMessage const * const msg, vscp_evt_wireless_Event * const evt)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == msg) || (NULL == evt))
+    {
+        return FALSE;
+    }
+
+    if (VSCP_CLASS_L1_WIRELESS != msg->vscpClass)
+    {
+        return FALSE;
+    }
+
+    evt->vscpType = msg->vscpType;
+
+    switch(msg->vscpType)
+    {
+    case VSCP_TYPE_WIRELESS_GENERAL:
+        status = TRUE;
+        break;
+
+    case VSCP_TYPE_WIRELESS_GSM_CELL:
+        status = vscp_evt_wireless_parseGsmCell(msg, &evt->data.gsmCell);
+        break;
+
+    default:
+        break;
+    }
+
+    return status;
+}
+
@@ -47,6 +47,7 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_platform.h"
+#include "vscp_types.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -69,6 +70,26 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Parameters of the "GSM Cell" event. */
+typedef struct
+{
+    uint32_t count; /**< Count */
+
+} vscp_evt_wireless_GsmCell;
+
+/** Parsed event of the "Wireless" class. */
+typedef struct
+{
+    uint8_t vscpType; /**< VSCP type */
+
+    /** Event parameters, which depend on the VSCP type. */
+    union
+    {
+        vscp_evt_wireless_GsmCell gsmCell; /**< Parameters of the "GSM Cell" event */
+    } data;
+
+} vscp_evt_wireless_Event;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -93,6 +114,27 @@ extern BOOL vscp_evt_wireless_sendGeneralEvent(void);
  */
 extern BOOL vscp_evt_wireless_sendGsmCell(uint32_t count);
 
+/**
+ * Parse the "GSM Cell" event.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Event parameters.
+ * 
+ * @return If the message is a valid "GSM Cell" event, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_wireless_parseGsmCell(vscp_RxMessage const * const msg, vscp_evt_wireless_GsmCell * const evt);
+
+/**
+ * Parse a received event of the "Wireless" class.
+ * The parser is selected by the VSCP type. Events without parameters are accepted as they are.
+ * 
+ * @param[in] msg Received message.
+ * @param[out] evt Parsed event.
+ * 
+ * @return If the event is valid and supported, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_evt_wireless_parse(vscp_RxMessage const * const msg, vscp_evt_wireless_Event * const evt);
+
 #ifdef __cplusplus
 }
 #endif
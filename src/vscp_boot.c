@@ -0,0 +1,694 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP boot loader engine
+@file   vscp_boot.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_boot.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_boot.h"
+#include "vscp_boot_flash.h"
+#include "vscp_core.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_protocol.h"
+#include "vscp_util.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of block buffers */
+#define VSCP_BOOT_BLOCK_NUM         (2)
+
+/** Invalid block buffer index */
+#define VSCP_BOOT_BLOCK_INVALID     (0xFF)
+
+/** Number of data bytes in a block data event */
+#define VSCP_BOOT_CHUNK_SIZE        (8)
+
+/** Size of the response queue, which holds the responses, refused by the transport layer. */
+#define VSCP_BOOT_RSP_QUEUE_SIZE    (4)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/* A block shall consist of complete block data events. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 == (VSCP_CONFIG_BOOT_BLOCK_SIZE % VSCP_BOOT_CHUNK_SIZE));
+
+/** This type defines the states of a block buffer. */
+typedef enum
+{
+    BLOCK_STATE_FREE = 0,   /**< Block buffer is free */
+    BLOCK_STATE_RECEIVE,    /**< Block data is received */
+    BLOCK_STATE_COMPLETE,   /**< Block is complete and waits for the program command */
+    BLOCK_STATE_PROGRAM     /**< Block waits for programming */
+
+} BLOCK_STATE;
+
+/** This type defines a block buffer. */
+typedef struct
+{
+    BLOCK_STATE state;                              /**< Block buffer state */
+    uint32_t    block;                              /**< Block number */
+    uint8_t     memType;                            /**< Memory type */
+    uint16_t    size;                               /**< Number of received bytes */
+    uint16_t    crc;                                /**< CRC-16 of the received bytes */
+    uint8_t     data[VSCP_CONFIG_BOOT_BLOCK_SIZE];  /**< Block data */
+
+} Block;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_boot_handleStartBlock(vscp_RxMessage const * const msg);
+static void vscp_boot_handleBlockData(vscp_RxMessage const * const msg);
+static void vscp_boot_handleProgramBlockData(vscp_RxMessage const * const msg);
+static void vscp_boot_handleActivateNewImage(vscp_RxMessage const * const msg);
+static void vscp_boot_handleAbort(void);
+static void vscp_boot_sendAckBootLoader(void);
+static void vscp_boot_sendRsp(vscp_TxMessage const * const txMessage);
+static void vscp_boot_flushRsp(void);
+static void vscp_boot_writeUInt32(uint8_t * const buffer, uint32_t value);
+static uint32_t vscp_boot_getWritePointer(Block const * const blockBuffer);
+static void vscp_boot_freeBlocks(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Boot loader engine state */
+static VSCP_BOOT_STATE        vscp_boot_state         = VSCP_BOOT_STATE_INACTIVE;
+
+/** Block buffers */
+static Block                  vscp_boot_blocks[VSCP_BOOT_BLOCK_NUM];
+
+/** Index of the block buffer, which receives the block data */
+static uint8_t                vscp_boot_rxBlock       = VSCP_BOOT_BLOCK_INVALID;
+
+/** Number of received block data events since the last acknowledge */
+static uint8_t                vscp_boot_chunkCnt      = 0;
+
+/** Sum of the CRCs of all programmed blocks */
+static uint16_t               vscp_boot_crcSum        = 0;
+
+/** Next response, which was refused by the transport layer */
+static vscp_TxMessage         vscp_boot_rsp;
+
+/** Is a response pending or not */
+static BOOL                   vscp_boot_isRspPending  = FALSE;
+
+/** Storage of the responses, which are queued after the pending response */
+static vscp_TxMessage         vscp_boot_rspStorage[VSCP_BOOT_RSP_QUEUE_SIZE];
+
+/** Queue of the responses, which are queued after the pending response */
+static vscp_util_CyclicBuffer vscp_boot_rspQueue;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the boot loader engine.
+ */
+extern void vscp_boot_init(void)
+{
+    vscp_boot_flash_init();
+
+    vscp_boot_state         = VSCP_BOOT_STATE_INACTIVE;
+    vscp_boot_isRspPending  = FALSE;
+    vscp_util_cyclicBufferInit(&vscp_boot_rspQueue, vscp_boot_rspStorage, sizeof(vscp_boot_rspStorage), sizeof(vscp_TxMessage));
+    vscp_boot_freeBlocks();
+
+    return;
+}
+
+/**
+ * This function enters the boot loader mode and acknowledges it with the
+ * block size and the number of blocks.
+ */
+extern void vscp_boot_start(void)
+{
+    vscp_boot_state         = VSCP_BOOT_STATE_ACTIVE;
+    vscp_boot_crcSum        = 0;
+    vscp_boot_isRspPending  = FALSE;
+    vscp_util_cyclicBufferInit(&vscp_boot_rspQueue, vscp_boot_rspStorage, sizeof(vscp_boot_rspStorage), sizeof(vscp_TxMessage));
+    vscp_boot_freeBlocks();
+
+    vscp_boot_sendAckBootLoader();
+
+    return;
+}
+
+/**
+ * This function returns the current state of the boot loader engine.
+ * As long as a response is not sent yet, the engine stays active.
+ *
+ * @return Boot loader engine state
+ */
+extern VSCP_BOOT_STATE vscp_boot_getState(void)
+{
+    VSCP_BOOT_STATE state   = vscp_boot_state;
+
+    /* Leave the boot loader mode only after the last response is sent. */
+    if ((VSCP_BOOT_STATE_INACTIVE != state) &&
+        (TRUE == vscp_boot_isRspPending))
+    {
+        state = VSCP_BOOT_STATE_ACTIVE;
+    }
+
+    return state;
+}
+
+/**
+ * This function handles all boot loader specific CLASS1.PROTOCOL events.
+ * It will be called by the VSCP core in boot loader mode.
+ *
+ * @param[in] msg   Received event message
+ */
+extern void vscp_boot_handleEvent(vscp_RxMessage const * const msg)
+{
+    if ((NULL != msg) &&
+        (VSCP_BOOT_STATE_ACTIVE == vscp_boot_state) &&
+        (VSCP_CLASS_L1_PROTOCOL == msg->vscpClass))
+    {
+        switch(msg->vscpType)
+        {
+        /* VSCP specification, chapter Enter boot loader mode. */
+        case VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER:
+            /* The acknowledge may be lost, send it again. */
+            if ((1 <= msg->dataSize) &&
+                (vscp_core_readNicknameId() == msg->data[0]))
+            {
+                vscp_boot_sendAckBootLoader();
+            }
+            break;
+
+        case VSCP_TYPE_PROTOCOL_BOOT_LOADER_CHECK:
+            vscp_boot_sendAckBootLoader();
+            break;
+
+        /* VSCP specification, chapter Start block data transfer. */
+        case VSCP_TYPE_PROTOCOL_START_BLOCK:
+            vscp_boot_handleStartBlock(msg);
+            break;
+
+        /* VSCP specification, chapter Block data. */
+        case VSCP_TYPE_PROTOCOL_BLOCK_DATA:
+            vscp_boot_handleBlockData(msg);
+            break;
+
+        /* VSCP specification, chapter Program data block */
+        case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA:
+            vscp_boot_handleProgramBlockData(msg);
+            break;
+
+        /* VSCP specification, chapter Activate new image */
+        case VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE:
+            vscp_boot_handleActivateNewImage(msg);
+            break;
+
+        case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT:
+            vscp_boot_handleAbort();
+            break;
+
+        /* Not handled type */
+        default:
+            break;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function programs the received blocks and sends pending responses.
+ * It will be called by the VSCP core in boot loader mode every process cycle.
+ */
+extern void vscp_boot_process(void)
+{
+    uint8_t index   = 0;
+
+    vscp_boot_flushRsp();
+
+    /* Program at most one block per process cycle and only if the transport
+     * layer accepts responses again.
+     */
+    while((VSCP_BOOT_BLOCK_NUM > index) && (FALSE == vscp_boot_isRspPending))
+    {
+        Block * const   blockBuffer = &vscp_boot_blocks[index];
+
+        if (BLOCK_STATE_PROGRAM == blockBuffer->state)
+        {
+            vscp_TxMessage  txMessage;
+
+            if (TRUE == vscp_boot_flash_write(blockBuffer->memType, blockBuffer->block, blockBuffer->data, blockBuffer->size))
+            {
+                vscp_boot_crcSum += blockBuffer->crc;
+
+                vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK, VSCP_PRIORITY_3_NORMAL);
+                txMessage.dataSize = 4;
+                vscp_boot_writeUInt32(&txMessage.data[0], blockBuffer->block);
+            }
+            else
+            {
+                vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK, VSCP_PRIORITY_3_NORMAL);
+                txMessage.dataSize = 5;
+                txMessage.data[0]  = VSCP_BOOT_ERR_WRITE;
+                vscp_boot_writeUInt32(&txMessage.data[1], blockBuffer->block);
+            }
+
+            blockBuffer->state = BLOCK_STATE_FREE;
+
+            vscp_boot_sendRsp(&txMessage);
+
+            /* Leave loop */
+            index = VSCP_BOOT_BLOCK_NUM;
+        }
+        else
+        {
+            ++index;
+        }
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Handles the start block data transfer event.
+ * The block is received into the block buffer, which receives already, or
+ * into a free one.
+ *
+ * @param[in] msg   Received event message
+ */
+static void vscp_boot_handleStartBlock(vscp_RxMessage const * const msg)
+{
+    vscp_TxMessage  txMessage;
+    uint8_t         errorCode   = 0;
+
+    if (5 > msg->dataSize)
+    {
+        errorCode = VSCP_BOOT_ERR_INVALID_BLOCK;
+    }
+    else if (FALSE == vscp_boot_flash_isBlockValid(msg->data[4], VSCP_UTIL_READ_UINT32_BE(&msg->data[0])))
+    {
+        errorCode = VSCP_BOOT_ERR_INVALID_BLOCK;
+    }
+    else
+    {
+        /* A block, which is not complete yet or not programmed, will be overwritten. */
+        if ((VSCP_BOOT_BLOCK_INVALID == vscp_boot_rxBlock) ||
+            (BLOCK_STATE_PROGRAM == vscp_boot_blocks[vscp_boot_rxBlock].state))
+        {
+            uint8_t index   = 0;
+
+            vscp_boot_rxBlock = VSCP_BOOT_BLOCK_INVALID;
+
+            for(index = 0; index < VSCP_BOOT_BLOCK_NUM; ++index)
+            {
+                if (BLOCK_STATE_FREE == vscp_boot_blocks[index].state)
+                {
+                    vscp_boot_rxBlock = index;
+                    break;
+                }
+            }
+        }
+
+        if (VSCP_BOOT_BLOCK_INVALID == vscp_boot_rxBlock)
+        {
+            errorCode = VSCP_BOOT_ERR_BUSY;
+        }
+        else
+        {
+            Block * const   blockBuffer = &vscp_boot_blocks[vscp_boot_rxBlock];
+
+            blockBuffer->state      = BLOCK_STATE_RECEIVE;
+            blockBuffer->block      = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+            blockBuffer->memType    = msg->data[4];
+            blockBuffer->size       = 0;
+            blockBuffer->crc        = VSCP_UTIL_CRC16_INIT;
+            vscp_boot_chunkCnt      = 0;
+        }
+    }
+
+    if (0 == errorCode)
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK, VSCP_PRIORITY_3_NORMAL);
+        txMessage.dataSize = 5;
+        vscp_boot_writeUInt32(&txMessage.data[0], vscp_boot_blocks[vscp_boot_rxBlock].block);
+        txMessage.data[4]  = vscp_boot_blocks[vscp_boot_rxBlock].memType;
+    }
+    else
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_START_BLOCK_NACK, VSCP_PRIORITY_3_NORMAL);
+        txMessage.dataSize = 1;
+        txMessage.data[0]  = errorCode;
+    }
+
+    vscp_boot_sendRsp(&txMessage);
+
+    return;
+}
+
+/**
+ * Handles the block data event.
+ * The data is appended to the current block and the CRC is calculated on the
+ * fly. Every VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW events a chunk acknowledge is
+ * sent and after the last event of a block, the block data acknowledge with
+ * the CRC of the whole block.
+ *
+ * @param[in] msg   Received event message
+ */
+static void vscp_boot_handleBlockData(vscp_RxMessage const * const msg)
+{
+    vscp_TxMessage  txMessage;
+    Block *         blockBuffer = NULL;
+
+    if (VSCP_BOOT_BLOCK_INVALID != vscp_boot_rxBlock)
+    {
+        blockBuffer = &vscp_boot_blocks[vscp_boot_rxBlock];
+    }
+
+    if ((NULL == blockBuffer) ||
+        (BLOCK_STATE_RECEIVE != blockBuffer->state))
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, VSCP_PRIORITY_3_NORMAL);
+        txMessage.dataSize = 5;
+        txMessage.data[0]  = VSCP_BOOT_ERR_NO_BLOCK;
+        vscp_boot_writeUInt32(&txMessage.data[1], (NULL == blockBuffer) ? 0 : vscp_boot_getWritePointer(blockBuffer));
+
+        vscp_boot_sendRsp(&txMessage);
+    }
+    else if ((VSCP_CONFIG_BOOT_BLOCK_SIZE - blockBuffer->size) < msg->dataSize)
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_NACK, VSCP_PRIORITY_3_NORMAL);
+        txMessage.dataSize = 5;
+        txMessage.data[0]  = VSCP_BOOT_ERR_OVERFLOW;
+        vscp_boot_writeUInt32(&txMessage.data[1], vscp_boot_getWritePointer(blockBuffer));
+
+        vscp_boot_sendRsp(&txMessage);
+    }
+    else
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < msg->dataSize; ++index)
+        {
+            blockBuffer->data[blockBuffer->size + index] = msg->data[index];
+        }
+
+        blockBuffer->crc   = vscp_util_crc16(blockBuffer->crc, msg->data, msg->dataSize);
+        blockBuffer->size += msg->dataSize;
+        ++vscp_boot_chunkCnt;
+
+        /* Block complete? */
+        if (VSCP_CONFIG_BOOT_BLOCK_SIZE == blockBuffer->size)
+        {
+            blockBuffer->state = BLOCK_STATE_COMPLETE;
+            vscp_boot_chunkCnt = 0;
+
+            vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK, VSCP_PRIORITY_3_NORMAL);
+            txMessage.dataSize = 6;
+            txMessage.data[0]  = VSCP_UTIL_WORD_MSB(blockBuffer->crc);
+            txMessage.data[1]  = VSCP_UTIL_WORD_LSB(blockBuffer->crc);
+            vscp_boot_writeUInt32(&txMessage.data[2], vscp_boot_getWritePointer(blockBuffer));
+
+            vscp_boot_sendRsp(&txMessage);
+        }
+        /* Acknowledge window full? */
+        else if (VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW <= vscp_boot_chunkCnt)
+        {
+            vscp_boot_chunkCnt = 0;
+
+            vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK, VSCP_PRIORITY_3_NORMAL);
+            txMessage.dataSize = 4;
+            vscp_boot_writeUInt32(&txMessage.data[0], vscp_boot_getWritePointer(blockBuffer));
+
+            vscp_boot_sendRsp(&txMessage);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles the program data block event.
+ * The complete block is marked for programming, which is done in the next
+ * process cycle. Meanwhile the next block can be received.
+ *
+ * @param[in] msg   Received event message
+ */
+static void vscp_boot_handleProgramBlockData(vscp_RxMessage const * const msg)
+{
+    if (4 <= msg->dataSize)
+    {
+        uint32_t    block   = VSCP_UTIL_READ_UINT32_BE(&msg->data[0]);
+        BOOL        found   = FALSE;
+        uint8_t     index   = 0;
+
+        for(index = 0; index < VSCP_BOOT_BLOCK_NUM; ++index)
+        {
+            if ((BLOCK_STATE_COMPLETE == vscp_boot_blocks[index].state) &&
+                (block == vscp_boot_blocks[index].block))
+            {
+                vscp_boot_blocks[index].state = BLOCK_STATE_PROGRAM;
+                found = TRUE;
+                break;
+            }
+        }
+
+        if (FALSE == found)
+        {
+            vscp_TxMessage  txMessage;
+
+            vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK, VSCP_PRIORITY_3_NORMAL);
+            txMessage.dataSize = 5;
+            txMessage.data[0]  = VSCP_BOOT_ERR_NO_BLOCK;
+            vscp_boot_writeUInt32(&txMessage.data[1], block);
+
+            vscp_boot_sendRsp(&txMessage);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles the activate new image event.
+ * The new image is activated only, if the sum of the CRCs of all programmed
+ * blocks matches.
+ *
+ * @param[in] msg   Received event message
+ */
+static void vscp_boot_handleActivateNewImage(vscp_RxMessage const * const msg)
+{
+    vscp_TxMessage  txMessage;
+
+    if ((2 <= msg->dataSize) &&
+        (vscp_boot_crcSum == VSCP_UTIL_READ_UINT16_BE(&msg->data[0])) &&
+        (TRUE == vscp_boot_flash_activate()))
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK, VSCP_PRIORITY_3_NORMAL);
+
+        vscp_boot_state = VSCP_BOOT_STATE_ACTIVATED;
+    }
+    else
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK, VSCP_PRIORITY_3_NORMAL);
+    }
+
+    vscp_boot_sendRsp(&txMessage);
+
+    return;
+}
+
+/**
+ * Handles the boot loader abort event.
+ */
+static void vscp_boot_handleAbort(void)
+{
+    vscp_TxMessage  txMessage;
+
+    if (TRUE == vscp_boot_flash_abort())
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_ACK, VSCP_PRIORITY_3_NORMAL);
+
+        vscp_boot_state = VSCP_BOOT_STATE_ABORTED;
+        vscp_boot_freeBlocks();
+    }
+    else
+    {
+        vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_NACK, VSCP_PRIORITY_3_NORMAL);
+    }
+
+    vscp_boot_sendRsp(&txMessage);
+
+    return;
+}
+
+/**
+ * Send the boot loader mode acknowledge with the block size and the number
+ * of blocks.
+ */
+static void vscp_boot_sendAckBootLoader(void)
+{
+    vscp_TxMessage  txMessage;
+
+    vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER, VSCP_PRIORITY_3_NORMAL);
+    txMessage.dataSize = 8;
+    vscp_boot_writeUInt32(&txMessage.data[0], VSCP_CONFIG_BOOT_BLOCK_SIZE);
+    vscp_boot_writeUInt32(&txMessage.data[4], vscp_boot_flash_getBlockCount());
+
+    vscp_boot_sendRsp(&txMessage);
+
+    return;
+}
+
+/**
+ * Send a response. If the transport layer refuses it, it will be sent again
+ * in one of the next process cycles.
+ *
+ * @param[in] txMessage Response
+ */
+static void vscp_boot_sendRsp(vscp_TxMessage const * const txMessage)
+{
+    /* Keep the order of the responses. */
+    vscp_boot_flushRsp();
+
+    if (FALSE == vscp_boot_isRspPending)
+    {
+        if (FALSE == vscp_core_sendEvent(txMessage))
+        {
+            vscp_boot_rsp           = *txMessage;
+            vscp_boot_isRspPending  = TRUE;
+        }
+    }
+    /* Note, if the queue is full, the response is lost. The host will repeat
+     * its request after a timeout.
+     */
+    else
+    {
+        (void)vscp_util_cyclicBufferWrite(&vscp_boot_rspQueue, txMessage, 1);
+    }
+
+    return;
+}
+
+/**
+ * Send the pending responses, as long as the transport layer accepts them.
+ */
+static void vscp_boot_flushRsp(void)
+{
+    while((TRUE == vscp_boot_isRspPending) &&
+          (TRUE == vscp_core_sendEvent(&vscp_boot_rsp)))
+    {
+        /* Next queued response */
+        if (0 == vscp_util_cyclicBufferRead(&vscp_boot_rspQueue, &vscp_boot_rsp, 1))
+        {
+            vscp_boot_isRspPending = FALSE;
+        }
+    }
+
+    return;
+}
+
+/**
+ * Write a 32 bit value in big endian byte order to a byte buffer.
+ *
+ * @param[out]  buffer  Byte buffer (at least 4 byte)
+ * @param[in]   value   Value
+ */
+static void vscp_boot_writeUInt32(uint8_t * const buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)((value >> 24) & 0xff);
+    buffer[1] = (uint8_t)((value >> 16) & 0xff);
+    buffer[2] = (uint8_t)((value >>  8) & 0xff);
+    buffer[3] = (uint8_t)((value >>  0) & 0xff);
+
+    return;
+}
+
+/**
+ * Get the write pointer of a block buffer, which is the address in the image
+ * of the next byte to receive.
+ *
+ * @param[in]   blockBuffer Block buffer
+ * @return Write pointer
+ */
+static uint32_t vscp_boot_getWritePointer(Block const * const blockBuffer)
+{
+    return (blockBuffer->block * VSCP_CONFIG_BOOT_BLOCK_SIZE) + blockBuffer->size;
+}
+
+/**
+ * Release all block buffers.
+ */
+static void vscp_boot_freeBlocks(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_BOOT_BLOCK_NUM; ++index)
+    {
+        vscp_boot_blocks[index].state = BLOCK_STATE_FREE;
+    }
+
+    vscp_boot_rxBlock   = VSCP_BOOT_BLOCK_INVALID;
+    vscp_boot_chunkCnt  = 0;
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
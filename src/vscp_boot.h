@@ -0,0 +1,187 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP boot loader engine
+@file   vscp_boot.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module implements the VSCP boot loader algorithm inside the VSCP stack.
+
+*******************************************************************************/
+/** @defgroup vscp_boot VSCP boot loader engine
+ * The boot loader engine receives a new firmware image with the VSCP boot
+ * loader algorithm (boot loader algorithm 0x00) and programs it via the flash
+ * access driver (see vscp_boot_flash.h) of the user.
+ *
+ * Every block is received into one of two block buffers and verified with a
+ * CRC-16. While a complete block is programmed, the next block can already be
+ * received in the other buffer. The block data events are acknowledged with a
+ * chunk acknowledge after every VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW events,
+ * which allows the host to send them back to back.
+ *
+ * The engine is used by the VSCP core, which enters the boot loader mode in
+ * case the boot loader algorithm of the node (see
+ * vscp_portable_getBootLoaderAlgorithm()) is VSCP_BOOT_ALGORITHM_VSCP.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_BOOT_LOADER_ENGINE
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_BOOT_H__
+#define __VSCP_BOOT_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** VSCP boot loader algorithm, which is implemented by the boot loader engine. */
+#define VSCP_BOOT_ALGORITHM_VSCP        (0x00)
+
+/** Memory type: Program flash */
+#define VSCP_BOOT_MEM_TYPE_PROGRAM      (0x00)
+
+/** Memory type: Data memory (EEPROM) */
+#define VSCP_BOOT_MEM_TYPE_DATA         (0x01)
+
+/** Memory type: Configuration memory */
+#define VSCP_BOOT_MEM_TYPE_CONFIG       (0x02)
+
+/** Memory type: RAM */
+#define VSCP_BOOT_MEM_TYPE_RAM          (0x03)
+
+/** Error code: Invalid block number or memory type */
+#define VSCP_BOOT_ERR_INVALID_BLOCK     (0x01)
+
+/** Error code: No free block buffer, because both blocks wait for programming */
+#define VSCP_BOOT_ERR_BUSY              (0x02)
+
+/** Error code: No block transfer started */
+#define VSCP_BOOT_ERR_NO_BLOCK          (0x03)
+
+/** Error code: Block data exceeds the block size */
+#define VSCP_BOOT_ERR_OVERFLOW          (0x04)
+
+/** Error code: Writing the block to the memory failed */
+#define VSCP_BOOT_ERR_WRITE             (0x05)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the states of the boot loader engine. */
+typedef enum
+{
+    VSCP_BOOT_STATE_INACTIVE = 0,   /**< Boot loader mode not entered */
+    VSCP_BOOT_STATE_ACTIVE,         /**< Firmware update in progress */
+    VSCP_BOOT_STATE_ABORTED,        /**< Firmware update aborted, the current image stays active */
+    VSCP_BOOT_STATE_ACTIVATED       /**< New image activated, a reset is necessary */
+
+} VSCP_BOOT_STATE;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
+/**
+ * This function initializes the boot loader engine.
+ */
+extern void vscp_boot_init(void);
+
+/**
+ * This function enters the boot loader mode and acknowledges it with the
+ * block size and the number of blocks.
+ */
+extern void vscp_boot_start(void);
+
+/**
+ * This function returns the current state of the boot loader engine.
+ * As long as a response is not sent yet, the engine stays active.
+ *
+ * @return Boot loader engine state
+ */
+extern VSCP_BOOT_STATE vscp_boot_getState(void);
+
+/**
+ * This function handles all boot loader specific CLASS1.PROTOCOL events.
+ * It will be called by the VSCP core in boot loader mode.
+ *
+ * @param[in] msg   Received event message
+ */
+extern void vscp_boot_handleEvent(vscp_RxMessage const * const msg);
+
+/**
+ * This function programs the received blocks and sends pending responses.
+ * It will be called by the VSCP core in boot loader mode every process cycle.
+ */
+extern void vscp_boot_process(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_BOOT_H__ */
+
+/** @} */
@@ -79,6 +79,57 @@ extern "C"
 
 #endif  /* VSCP_CONFIG_ENABLE_LOGGER */
 
+#ifndef VSCP_CONFIG_ENABLE_LOGGER_BUFFER
+
+/** Enable the buffered logger. Log messages are stored in a ring buffer and
+ * sent by the VSCP core in the background with low priority, instead of
+ * sending them directly.
+ */
+#define VSCP_CONFIG_ENABLE_LOGGER_BUFFER        VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_LOGGER_BUFFER */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER )
+#error If you use the buffered logger, enable the logger first.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
+#ifndef VSCP_CONFIG_ENABLE_LOGGER_TRACE
+
+/** Enable the binary trace records of the logger. A trace record contains only
+ * a 16-bit message id and its arguments as variable length integers. The
+ * format strings are kept on the host, which decodes the records.
+ */
+#define VSCP_CONFIG_ENABLE_LOGGER_TRACE         VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_LOGGER_TRACE */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER )
+#error If you use the logger trace records, enable the logger first.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
+#ifndef VSCP_CONFIG_ENABLE_PERF_PROBES
+
+/** Enable the performance probes, which measure the execution time of the
+ * hot paths of the stack. The cycle counter has to be provided by the
+ * platform, see vscp_portable_getCycleCount().
+ */
+#define VSCP_CONFIG_ENABLE_PERF_PROBES          VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_PERF_PROBES */
+
+#ifndef VSCP_CONFIG_ENABLE_STATS
+
+/** Enable the runtime statistics, e.g. frame counters, queue high-water marks
+ * and process cycles per second. They are readable via a register page.
+ */
+#define VSCP_CONFIG_ENABLE_STATS                VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_STATS */
+
 #ifndef VSCP_CONFIG_SILENT_NODE
 
 /** Silent node configuration, which is used for e. g. RS-485 connections.
@@ -117,6 +168,24 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE */
 
+#ifndef VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER
+
+/** Enable the node heartbeat jitter. The first heartbeat is sent with a phase
+ * offset, derived from GUID and nickname, and every period gets a random
+ * jitter. If transmit errors occur, the period is increased.
+ * This avoids that all nodes of a segment send their heartbeats at the same
+ * time, e.g. after a power up of the segment.
+ */
+#define VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER     VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_HEARTBEAT_NODE )
+#error If you use the heartbeat jitter, enable the node heartbeat first.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
 #ifndef VSCP_CONFIG_IDLE_CALLOUT
 
 /** Enable idle callout.
@@ -144,6 +213,23 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_BOOT_LOADER_SUPPORTED */
 
+#ifndef VSCP_CONFIG_BOOT_LOADER_ENGINE
+
+/** Enable the in-stack boot loader engine, which implements the VSCP boot loader
+ * algorithm. The node receives and programs the new firmware itself, instead of
+ * jumping to an external boot loader. The flash access is done by the user
+ * layer, see vscp_boot_flash.h.
+ */
+#define VSCP_CONFIG_BOOT_LOADER_ENGINE          VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_BOOT_LOADER_ENGINE */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
+#error If you use the boot loader engine, enable the boot loader support first.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
 #ifndef VSCP_CONFIG_ENABLE_DM
 
 /** Enable decision matrix (standard). */
@@ -235,6 +321,136 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT */
 
+#ifndef VSCP_CONFIG_ENABLE_BULK_WRITE
+
+/**
+ * Enable the bulk configuration write session. A configuration tool streams
+ * the register values of a page with block data events, which are only
+ * acknowledged after a window of events. The received data is written to the
+ * registers with a single CRC checked commit.
+ */
+#define VSCP_CONFIG_ENABLE_BULK_WRITE           VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_BULK_WRITE */
+
+#ifndef VSCP_CONFIG_ENABLE_NICKNAME_MAP
+
+/**
+ * Enable the nickname occupancy map. As long as the node has no nickname, the
+ * originator nickname of every received event is marked as occupied, e.g.
+ * during start up and while waiting for the segment master. The nickname
+ * discovery probes only nicknames, which were not observed yet.
+ */
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_NICKNAME_MAP */
+
+#ifndef VSCP_CONFIG_ENABLE_NICKNAME_GUID_START
+
+/**
+ * Enable the GUID derived start of the nickname discovery. Instead of
+ * VSCP_CONFIG_START_NODE_PROBE_NICKNAME the node starts probing at a nickname,
+ * which is derived from its GUID and wraps around after 254. This way nodes,
+ * which start up together, don't probe the same nicknames.
+ */
+#define VSCP_CONFIG_ENABLE_NICKNAME_GUID_START  VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_NICKNAME_GUID_START */
+
+#ifndef VSCP_CONFIG_ENABLE_NODE_TABLE
+
+/**
+ * Enable the segment node table. Every received event updates the entry of
+ * its originator, e.g. when it was seen last and its node heartbeat period.
+ * The application can ask whether a node is alive, instead of tracking the
+ * nodes by itself.
+ */
+#define VSCP_CONFIG_ENABLE_NODE_TABLE           VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_NODE_TABLE */
+
+#ifndef VSCP_CONFIG_ENABLE_NODE_TABLE_GUID
+
+/**
+ * Enable learning the GUID of the nodes in the segment node table from their
+ * who is there responses. Note, this needs 16 byte more RAM per nickname id.
+ */
+#define VSCP_CONFIG_ENABLE_NODE_TABLE_GUID      VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_NODE_TABLE_GUID */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+#error If you want to learn the GUID, enable the segment node table first.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID ) */
+
+#ifndef VSCP_CONFIG_ENABLE_TIME_SERVICE
+
+/**
+ * Enable the time service, which provides the segment time with millisecond
+ * resolution. It is synchronized to the segment controller heartbeat without
+ * time steps and compensates the drift of the platform clock. The millisecond
+ * counter has to be provided by the platform, see vscp_portable_getMillis().
+ */
+#define VSCP_CONFIG_ENABLE_TIME_SERVICE         VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_TIME_SERVICE */
+
+#ifndef VSCP_CONFIG_ENABLE_RX_TIMESTAMP
+
+/**
+ * Enable the receive timestamp of every event (vscp_Message.timestamp) in us.
+ * It is taken by the transport layer when the event is read from the
+ * transport adapter, but the transport adapter can overwrite it with an
+ * earlier one, e.g. taken in its receive interrupt. The microsecond counter
+ * has to be provided by the platform, see vscp_portable_getMicros().
+ * If the runtime statistics are enabled, the latency between receive
+ * timestamp and processing by the core is determined too.
+ */
+#define VSCP_CONFIG_ENABLE_RX_TIMESTAMP         VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_RX_TIMESTAMP */
+
+#ifndef VSCP_CONFIG_ENABLE_L2
+
+/**
+ * Enable the level 2 event support, e.g. for nodes connected via ethernet.
+ * Level 2 events are addressed by GUID and contain up to
+ * VSCP_CONFIG_L2_DATA_SIZE data bytes. They are read and written via a
+ * separate path of the transport adapter. Level 1 events over level 2, which
+ * are addressed to this node, are handled by the core like level 1 events.
+ * All other level 2 events are provided to the application.
+ */
+#define VSCP_CONFIG_ENABLE_L2                   VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_L2 */
+
+#ifndef VSCP_CONFIG_ENABLE_EMBEDDED_MDF
+
+/**
+ * Enable the embedded MDF, which is streamed with the get embedded MDF
+ * responses. The MDF is stored in flash as compressed blob, which is
+ * generated by tools/scripts/vscp_mdf_compress.py and read via
+ * vscp_portable_readEmbeddedMdf().
+ */
+#define VSCP_CONFIG_ENABLE_EMBEDDED_MDF         VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_EMBEDDED_MDF */
+
+#ifndef VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER
+
+/**
+ * Enable the acceptance filter calculation. The core derives the minimal set
+ * of CAN acceptance filters from the events, which the node needs, and
+ * programs them via vscp_tp_adapter_setAcceptanceFilters() into the CAN
+ * controller. The application registers the events it is interested in with
+ * vscp_filter_subscribe().
+ */
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER */
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
@@ -262,6 +478,27 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_MULTI_MSG_TIMEOUT */
 
+#ifndef VSCP_CONFIG_MULTI_FRAME_RSP_BURST
+
+/** Multi-frame responses (page read, who is there, extended page read): Max.
+ * number of response events, which are sent in one process cycle. The responses
+ * are sent back to back, as long as the transport layer accepts them. Set it to
+ * 1 to send only one response per process cycle.
+ */
+#define VSCP_CONFIG_MULTI_FRAME_RSP_BURST       8
+
+#endif  /* Undefined VSCP_CONFIG_MULTI_FRAME_RSP_BURST */
+
+#ifndef VSCP_CONFIG_MULTI_FRAME_RSP_PACING
+
+/** Multi-frame responses: Pause in ms after every burst of response events,
+ * which gives the other nodes the chance to access the bus. Set it to 0 to
+ * disable it.
+ */
+#define VSCP_CONFIG_MULTI_FRAME_RSP_PACING      ((uint16_t)0)
+
+#endif  /* Undefined VSCP_CONFIG_MULTI_FRAME_RSP_PACING */
+
 #ifndef VSCP_CONFIG_HEARTBEAT_NODE_PERIOD
 
 /** Node heartbeat period in ms (recommended 30s - 60s). */
@@ -269,6 +506,296 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_PERIOD */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_JITTER
+
+/** Max. node heartbeat jitter in ms. The period varies by +/- this value,
+ * limited to the half period.
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_JITTER       ((uint16_t)3000)
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_JITTER */
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX
+
+/** Max. number of node heartbeat period doublings, caused by transmit errors
+ * (max. 16).
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX 3
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
+#ifndef VSCP_CONFIG_BOOT_BLOCK_SIZE
+
+/** Boot loader engine: Block size in byte. It shall be a multiple of 8, because
+ * every block data event carries 8 byte. Two blocks are buffered in RAM, so the
+ * next block can be received while the previous one is programmed.
+ */
+#define VSCP_CONFIG_BOOT_BLOCK_SIZE             ((uint16_t)256)
+
+#endif  /* Undefined VSCP_CONFIG_BOOT_BLOCK_SIZE */
+
+#ifndef VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW
+
+/** Boot loader engine: Number of block data events, which are acknowledged
+ * together with a single chunk acknowledge. The host may send this number of
+ * block data events without waiting for an acknowledge.
+ */
+#define VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW       8
+
+#endif  /* Undefined VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+
+#ifndef VSCP_CONFIG_BULK_WRITE_SIZE
+
+/** Bulk configuration write: Max. number of registers, which can be written
+ * with one session. The received data is buffered in RAM until it is committed.
+ * The max. value is 256 (a whole page).
+ */
+#define VSCP_CONFIG_BULK_WRITE_SIZE             ((uint16_t)128)
+
+#endif  /* Undefined VSCP_CONFIG_BULK_WRITE_SIZE */
+
+#ifndef VSCP_CONFIG_BULK_WRITE_ACK_WINDOW
+
+/** Bulk configuration write: Number of block data events, which are acknowledged
+ * together with a single chunk acknowledge.
+ */
+#define VSCP_CONFIG_BULK_WRITE_ACK_WINDOW       8
+
+#endif  /* Undefined VSCP_CONFIG_BULK_WRITE_ACK_WINDOW */
+
+#ifndef VSCP_CONFIG_BULK_WRITE_TIMEOUT
+
+/** Bulk configuration write: Timeout in s. A session, which is not committed
+ * within this time after the last received event, will be discarded.
+ */
+#define VSCP_CONFIG_BULK_WRITE_TIMEOUT          ((uint8_t)5)
+
+#endif  /* Undefined VSCP_CONFIG_BULK_WRITE_TIMEOUT */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+#ifndef VSCP_CONFIG_LOGGER_BUFFER_NUM
+
+/** Buffered logger: Number of log events, which can be stored in the ring
+ * buffer. Every log event carries 5 byte of a log message. If the ring buffer
+ * is full, the oldest log messages are dropped.
+ */
+#define VSCP_CONFIG_LOGGER_BUFFER_NUM           16
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_BUFFER_NUM */
+
+#ifndef VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE
+
+/** Buffered logger: Max. number of log events, which are sent in one process
+ * cycle.
+ */
+#define VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE     2
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE */
+
+#ifndef VSCP_CONFIG_LOGGER_RATE_LIMIT
+
+/** Buffered logger: Number of log events per second and log level, which are
+ * accepted in average. Log messages above the limit are dropped. Set it to 0
+ * to disable the rate limiting.
+ */
+#define VSCP_CONFIG_LOGGER_RATE_LIMIT           ((uint8_t)10)
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_RATE_LIMIT */
+
+#ifndef VSCP_CONFIG_LOGGER_RATE_BURST
+
+/** Buffered logger: Max. number of log events per log level, which are accepted
+ * back to back, before the rate limit applies.
+ */
+#define VSCP_CONFIG_LOGGER_RATE_BURST           ((uint8_t)20)
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_RATE_BURST */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+
+#ifndef VSCP_CONFIG_LOGGER_TRACE_ID
+
+/** Log message id (byte 0 of CLASS1.LOG Type=1), which marks a trace record.
+ * Don't use it for the other log messages of the application.
+ */
+#define VSCP_CONFIG_LOGGER_TRACE_ID             ((uint8_t)0xFF)
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_TRACE_ID */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+#ifndef VSCP_CONFIG_PERF_PAGE
+
+/** Register page, which contains the statistics of the performance probes.
+ * It hides the application registers of this page.
+ */
+#define VSCP_CONFIG_PERF_PAGE                   ((uint16_t)0xFFF1)
+
+#endif  /* Undefined VSCP_CONFIG_PERF_PAGE */
+
+#ifndef VSCP_CONFIG_PERF_HIST_SHIFT
+
+/** The first histogram class of a performance probe counts the measurements
+ * below 2^VSCP_CONFIG_PERF_HIST_SHIFT cycles.
+ */
+#define VSCP_CONFIG_PERF_HIST_SHIFT             6
+
+#endif  /* Undefined VSCP_CONFIG_PERF_HIST_SHIFT */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+#ifndef VSCP_CONFIG_STATS_PAGE
+
+/** Register page, which contains the runtime statistics.
+ * It hides the application registers of this page.
+ */
+#define VSCP_CONFIG_STATS_PAGE                  ((uint16_t)0xFFF0)
+
+#endif  /* Undefined VSCP_CONFIG_STATS_PAGE */
+
+#ifndef VSCP_CONFIG_STATS_LATENCY_SHIFT
+
+/** Receive latency histogram: The first class counts the latencies below
+ * 2^VSCP_CONFIG_STATS_LATENCY_SHIFT us, every further class doubles the limit.
+ */
+#define VSCP_CONFIG_STATS_LATENCY_SHIFT         8
+
+#endif  /* Undefined VSCP_CONFIG_STATS_LATENCY_SHIFT */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+
+#ifndef VSCP_CONFIG_NODE_TABLE_EXPIRY
+
+/** Time in s, after which a node, which was not seen anymore, is removed from
+ * the segment node table. It should be a multiple of the node heartbeat period.
+ */
+#define VSCP_CONFIG_NODE_TABLE_EXPIRY           ((uint16_t)180)
+
+#endif  /* Undefined VSCP_CONFIG_NODE_TABLE_EXPIRY */
+
+#ifndef VSCP_CONFIG_NODE_TABLE_SWEEP_NUM
+
+/** Number of segment node table entries, which are checked for expiry per
+ * process cycle. All 256 entries are checked after 256 / VSCP_CONFIG_NODE_TABLE_SWEEP_NUM
+ * process cycles.
+ */
+#define VSCP_CONFIG_NODE_TABLE_SWEEP_NUM        4
+
+#endif  /* Undefined VSCP_CONFIG_NODE_TABLE_SWEEP_NUM */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+#ifndef VSCP_CONFIG_L2_DATA_SIZE
+
+/** Max. number of data bytes of a level 2 event. The level 2 events are
+ * limited to 512 byte, but a smaller size reduces the RAM consumption.
+ */
+#define VSCP_CONFIG_L2_DATA_SIZE                512
+
+#endif  /* Undefined VSCP_CONFIG_L2_DATA_SIZE */
+
+#if (512 < VSCP_CONFIG_L2_DATA_SIZE)
+#error The data of a level 2 event is limited to 512 byte.
+#endif  /* (512 < VSCP_CONFIG_L2_DATA_SIZE) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+#ifndef VSCP_CONFIG_TIME_REF_LATENCY
+
+/** Time in ms between the second boundary of the segment controller and the
+ * reception of its heartbeat, e.g. the transmission time of the event.
+ */
+#define VSCP_CONFIG_TIME_REF_LATENCY            1
+
+#endif  /* Undefined VSCP_CONFIG_TIME_REF_LATENCY */
+
+#ifndef VSCP_CONFIG_TIME_STEP_THRESHOLD
+
+/** Offset in ms to the segment controller time, above which the time is set
+ * directly instead of slewing it.
+ */
+#define VSCP_CONFIG_TIME_STEP_THRESHOLD         1000
+
+#endif  /* Undefined VSCP_CONFIG_TIME_STEP_THRESHOLD */
+
+#ifndef VSCP_CONFIG_TIME_SLEW_DIV
+
+/** An offset is slewed by 1 ms per VSCP_CONFIG_TIME_SLEW_DIV ms, which
+ * limits the rate change of the time.
+ */
+#define VSCP_CONFIG_TIME_SLEW_DIV               20
+
+#endif  /* Undefined VSCP_CONFIG_TIME_SLEW_DIV */
+
+#ifndef VSCP_CONFIG_TIME_DRIFT_WINDOW
+
+/** Time in s, which is used to estimate the drift of the platform clock. */
+#define VSCP_CONFIG_TIME_DRIFT_WINDOW           60
+
+#endif  /* Undefined VSCP_CONFIG_TIME_DRIFT_WINDOW */
+
+#ifndef VSCP_CONFIG_TIME_DRIFT_MAX
+
+/** Max. drift of the platform clock in ppm, which is compensated. */
+#define VSCP_CONFIG_TIME_DRIFT_MAX              500
+
+#endif  /* Undefined VSCP_CONFIG_TIME_DRIFT_MAX */
+
+#if (2000 < VSCP_CONFIG_TIME_STEP_THRESHOLD)
+#error The step threshold of the time service is limited to 2000 ms.
+#endif  /* (2000 < VSCP_CONFIG_TIME_STEP_THRESHOLD) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+#ifndef VSCP_CONFIG_ACCEPTANCE_FILTER_NUM
+
+/** Number of acceptance filters, which the transport adapter supports, e.g.
+ * the number of receive mailboxes with individual masks.
+ */
+#define VSCP_CONFIG_ACCEPTANCE_FILTER_NUM       4
+
+#endif  /* Undefined VSCP_CONFIG_ACCEPTANCE_FILTER_NUM */
+
+#ifndef VSCP_CONFIG_ACCEPTANCE_SUBSCRIPTION_NUM
+
+/** Max. number of event subscriptions of the application. */
+#define VSCP_CONFIG_ACCEPTANCE_SUBSCRIPTION_NUM 4
+
+#endif  /* Undefined VSCP_CONFIG_ACCEPTANCE_SUBSCRIPTION_NUM */
+
+#if (0 == VSCP_CONFIG_ACCEPTANCE_FILTER_NUM)
+#error At least one acceptance filter is necessary.
+#endif  /* (0 == VSCP_CONFIG_ACCEPTANCE_FILTER_NUM) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
 #if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
@@ -330,6 +857,8 @@ extern "C"
 /** Number of messages in the loopback cyclic buffer. Note, that if you want to
  * store up to 3 events, you have to configure 4, because of the technical
  * implementation of the cyclic buffer.
+ * The cyclic buffer is limited to 255 byte. Consider that the receive
+ * timestamp (VSCP_CONFIG_ENABLE_RX_TIMESTAMP) increases the message size.
  */
 #define VSCP_CONFIG_LOOPBACK_STORAGE_NUM        4
 
@@ -56,6 +56,14 @@
 #include "vscp_util.h"
 #include "vscp_action.h"
 #include "vscp_logger.h"
+#include "vscp_boot.h"
+#include "vscp_perf.h"
+#include "vscp_stats.h"
+#include "vscp_node_table.h"
+#include "vscp_time.h"
+#include "vscp_l2.h"
+#include "vscp_mdf.h"
+#include "vscp_filter.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -80,6 +88,22 @@
 /** Timer threshold of 1s in ms */
 #define VSCP_CORE_TIMER_THRESHOLD_1S    ((uint16_t)1000)
 
+/** Register region flag: No special handling */
+#define VSCP_CORE_REG_FLAG_NONE             ((uint8_t)0x00)
+
+/** Register region flag: Registers can't be written via VSCP. */
+#define VSCP_CORE_REG_FLAG_READ_ONLY        ((uint8_t)0x01)
+
+/** Register region flag: Registers can only be written, if the application register write protection is disabled. */
+#define VSCP_CORE_REG_FLAG_WRITE_PROTECTED  ((uint8_t)0x04)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+/** Size of the nickname occupancy map in byte, one bit per nickname id */
+#define VSCP_CORE_NICKNAME_MAP_SIZE         (256 / 8)
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -97,6 +121,7 @@ typedef enum
     STATE_ACTIVE,       /**< Node is in working order */
     STATE_IDLE,         /**< Idle state */
     STATE_RESET,        /**< Reset state */
+    STATE_BOOT_LOADER,  /**< Boot loader mode */
     STATE_ERROR         /**< Error state */
 
 } STATE;
@@ -111,18 +136,109 @@ typedef enum
 
 } INIT_STATE;
 
+/** Multi-frame responder jobs */
+typedef enum
+{
+    RSP_JOB_PAGE_READ = 0,  /**< Page read */
+    RSP_JOB_WHO_IS_THERE,   /**< Who is there */
+    RSP_JOB_EXT_PAGE_READ,  /**< Extended page read */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+    RSP_JOB_EMBEDDED_MDF,   /**< Embedded MDF */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+    RSP_JOB_NUM             /**< Number of responder jobs */
+
+} RSP_JOB;
+
 /**
- * This type is used to store all necessary information, used by a extended
- * page read event.
+ * This type is used to store all necessary information of a multi-frame
+ * response, which is sent over one or more process cycles.
  */
-typedef struct
+typedef struct rspJob RspJob;
+
+/**
+ * This type defines a function, which builds the next response frame of a
+ * multi-frame response and advances the job to the following frame.
+ *
+ * @param[in,out]   job         Responder job
+ * @param[out]      txMessage   Response frame
+ */
+typedef void (*RspBuild)(RspJob * const job, vscp_TxMessage * const txMessage);
+
+/**
+ * This type is used to store all necessary information of a multi-frame
+ * response, which is sent over one or more process cycles.
+ */
+struct rspJob
 {
+    RspBuild    build;  /**< Builds the next response frame */
     uint16_t    page;   /**< Page */
-    uint8_t     addr;   /**< Address (offset in page) */
-    uint16_t    count;  /**< Number of registers to read */
-    uint8_t     seq;    /**< Sequence id */
+    uint8_t     addr;   /**< Address (offset in page) of the next response */
+    uint16_t    count;  /**< Number of registers or bytes, which are still to send */
+    uint8_t     seq;    /**< Sequence id of the next response */
+
+};
+
+/**
+ * This type defines a function, which reads one or more consecutive registers
+ * of a register region.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers, which are all part of the region
+ */
+typedef void (*RegRead)(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+
+/**
+ * This type defines a function, which writes a single register of a register
+ * region.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+typedef uint8_t (*RegWrite)(uint16_t page, uint8_t addr, uint8_t value);
+
+/**
+ * This type describes a region of consecutive registers in a page, which are
+ * handled by the same read and write function.
+ */
+typedef struct
+{
+    uint8_t     first;  /**< Address of the first register */
+    uint8_t     last;   /**< Address of the last register */
+    uint8_t     flags;  /**< Flags, see VSCP_CORE_REG_FLAG_xxx */
+    RegRead     read;   /**< Read function, NULL in case of write only registers */
+    RegWrite    write;  /**< Write function, NULL in case of read only registers */
+
+} RegRegion;
 
-} ExtPageRead;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+
+/**
+ * This type contains all necessary information of a bulk configuration write
+ * session.
+ */
+typedef struct
+{
+    BOOL        isActive;   /**< Session started or not */
+    uint8_t     oAddr;      /**< Nickname of the node, which started the session */
+    uint16_t    page;       /**< Page */
+    uint8_t     offset;     /**< Address of the first register */
+    uint16_t    length;     /**< Number of registers to write */
+    uint16_t    received;   /**< Number of received register values */
+    uint8_t     seq;        /**< Expected sequence number of the next block data event */
+    uint8_t     window;     /**< Number of block data events since the last acknowledge */
+    BOOL        isNackSent; /**< Sequence error reported, waiting for the expected sequence number */
+    uint8_t     timeout;    /**< Remaining time in s, until the session is discarded */
+    uint16_t    crc;        /**< CRC-16 of the received register values */
+
+} BulkWrite;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
 
 /*******************************************************************************
     PROTOTYPES
@@ -141,6 +257,12 @@ static void vscp_core_changeToStateIdle(void);
 static void vscp_core_stateIdle(void);
 static void vscp_core_changeToStateReset(uint8_t timeout);
 static void vscp_core_stateReset(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+static void vscp_core_changeToStateBootLoader(void);
+static void vscp_core_stateBootLoader(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
 static void vscp_core_changeToStateError(void);
 static void vscp_core_stateError(void);
 static void vscp_core_handleProtocolClassType(void);
@@ -149,6 +271,28 @@ static void vscp_core_handleProtocolClassType(void);
 static void vscp_core_handleProtocolHeartbeat(void);
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+static void vscp_core_startHeartbeat(void);
+static uint32_t vscp_core_getHeartbeatPeriod(void);
+static void vscp_core_startHeartbeatTimer(uint32_t delay);
+static uint16_t vscp_core_getHeartbeatRandom(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+static uint16_t vscp_core_getGuidCrc(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+static void vscp_core_clearNicknameMap(void);
+static void vscp_core_markNickname(uint8_t nickname);
+static BOOL vscp_core_isNicknameObserved(uint8_t nickname);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+static uint8_t vscp_core_getFirstProbeNickname(void);
+static uint8_t vscp_core_getNextProbeNickname(uint8_t nickname);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
 static void vscp_core_handleProtocolNewNodeOnline(void);
 static void vscp_core_handleProtocolProbeAck(void);
 static void vscp_core_handleProtocolSetNicknameId(void);
@@ -156,7 +300,57 @@ static void vscp_core_handleProtocolDropNicknameId(void);
 static void vscp_core_handleProtocolReadRegister(void);
 static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value);
 static uint8_t vscp_core_readRegister(uint16_t page, uint8_t addr);
+static void vscp_core_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
 static uint8_t vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed);
+static RegRegion const * vscp_core_getRegRegion(uint16_t page, uint8_t addr);
+static RegRegion const * vscp_core_getRegRegionApp(RegRegion const * const appRegion, uint16_t page, uint8_t addr);
+static void vscp_core_clipRegRegion(RegRegion * const region, uint8_t addr, uint8_t first, uint8_t last, RegRead read, RegWrite write);
+static BOOL vscp_core_isRegRegionWriteable(/*@null@*/ RegRegion const * const region);
+static void vscp_core_copyRegisters(uint8_t const * const values, uint8_t offset, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegApp(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegApp(uint16_t page, uint8_t addr, uint8_t value);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+static void vscp_core_readRegDm(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegDm(uint16_t page, uint8_t addr, uint8_t value);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+static void vscp_core_readRegDmNg(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegDmNg(uint16_t page, uint8_t addr, uint8_t value);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+static void vscp_core_readRegAlarmStatus(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegVscpVersion(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegNodeControlFlags(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegNodeControlFlags(uint16_t page, uint8_t addr, uint8_t value);
+static void vscp_core_readRegUserId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegUserId(uint16_t page, uint8_t addr, uint8_t value);
+static void vscp_core_readRegManufacturerDevId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegManufacturerSubDevId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegNicknameId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegPageSelect(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegPageSelect(uint16_t page, uint8_t addr, uint8_t value);
+static void vscp_core_readRegFirmwareVersion(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegBootLoaderAlgorithm(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegBufferSize(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegPagesUsed(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegStdDevFamilyCode(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegStdDevType(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegRestoreStdCfg(uint16_t page, uint8_t addr, uint8_t value);
+static void vscp_core_readRegFirmwareDeviceCode(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegGuid(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static void vscp_core_readRegMdfUrl(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+static void vscp_core_readRegPerf(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_writeRegPerf(uint16_t page, uint8_t addr, uint8_t value);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+static void vscp_core_readRegStats(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
 static void vscp_core_handleProtocolWriteRegister(void);
 static void vscp_core_handleProtocolEnterBootLoaderMode(void);
 static void vscp_core_handleProtocolGuidDropNickname(void);
@@ -167,8 +361,30 @@ static void vscp_core_handleProtocolDecrementRegister(void);
 static void vscp_core_handleProtocolWhoIsThere(void);
 static void vscp_core_handleProtocolGetDecisionMatrixInfo(void);
 static void vscp_core_handleProtocolExtendedPageReadRegister(void);
-static void vscp_core_extendedPageReadRegister(ExtPageRead * const data);
 static void vscp_core_handleProtocolExtendedPageWriteRegister(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+static void vscp_core_handleProtocolGetEmbeddedMdf(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+static void vscp_core_handleProtocolBulkWriteStart(void);
+static void vscp_core_handleProtocolBulkWriteData(void);
+static void vscp_core_handleProtocolBulkWriteCommit(void);
+static uint8_t vscp_core_applyBulkWrite(void);
+static void vscp_core_sendBulkWriteRsp(uint8_t vscpType, uint8_t const * const data, uint8_t dataSize);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
+
+static void vscp_core_rspStart(RSP_JOB id, uint16_t page, uint8_t addr, uint16_t count);
+static BOOL vscp_core_rspProcess(void);
+static void vscp_core_buildPageReadRsp(RspJob * const job, vscp_TxMessage * const txMessage);
+static void vscp_core_buildWhoIsThereRsp(RspJob * const job, vscp_TxMessage * const txMessage);
+static void vscp_core_buildExtPageReadRsp(RspJob * const job, vscp_TxMessage * const txMessage);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+static void vscp_core_buildEmbeddedMdfRsp(RspJob * const job, vscp_TxMessage * const txMessage);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
 static uint8_t vscp_core_getStartUpControl(void);
 static uint8_t vscp_core_getRegAppWriteProtect(void);
 
@@ -200,6 +416,9 @@ static uint8_t          vscp_core_timerIdGuidDropNickname   = VSCP_TIMER_ID_INVA
 /** Timer id, which is used for vscp register 162 multi-frame timeout. */
 static uint8_t          vscp_core_timerIdReg162             = VSCP_TIMER_ID_INVALID;
 
+/** Timer id, which is used for the multi-frame response pacing and timeout. */
+static uint8_t          vscp_core_timerIdRsp                = VSCP_TIMER_ID_INVALID;
+
 /** Timer id, which is used to drive the time since epoch (unix timestamp). */
 static uint8_t          vscp_core_timerIdTimeSinceEpoch     = VSCP_TIMER_ID_INVALID;
 
@@ -222,6 +441,36 @@ static BOOL             vscp_core_isHeartbeatEnabled    = TRUE;
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+
+/** Pseudo random number of the heartbeat jitter, seeded with GUID and nickname */
+static uint16_t         vscp_core_heartbeatRandom       = 1;
+
+/** Heartbeat back off level, every level doubles the heartbeat period */
+static uint8_t          vscp_core_heartbeatBackOff      = 0;
+
+/** Remaining heartbeat delay in ms, which exceeds the timer range */
+static uint32_t         vscp_core_heartbeatDelay        = 0;
+
+/** Free running transmit error counter at the last heartbeat */
+static uint8_t          vscp_core_heartbeatTxErrors     = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+/** Nickname occupancy map, a set bit means the nickname was observed on the bus. */
+static uint8_t          vscp_core_nicknameMap[VSCP_CORE_NICKNAME_MAP_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+/** Nickname id, where the nickname discovery process started */
+static uint8_t          vscp_core_nicknameProbeStart    = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
 /** Register: alarm status */
 static uint8_t          vscp_core_regAlarmStatus    = 0;
 
@@ -232,10 +481,95 @@ static uint16_t         vscp_core_regPageSelect     = 0;
 static BOOL             vscp_core_resetRequested    = FALSE;
 
 /**
- * Extended page read data, which is used to continue a extended page read in
- * the next process cycle.
+ * Multi-frame responder jobs, which are used to continue a response in the next
+ * process cycle. The order corresponds to RSP_JOB.
+ */
+static RspJob           vscp_core_rspJobs[RSP_JOB_NUM]  =
+{
+    { vscp_core_buildPageReadRsp,       0, 0, 0, 0 },
+    { vscp_core_buildWhoIsThereRsp,     0, 0, 0, 0 },
+    { vscp_core_buildExtPageReadRsp,    0, 0, 0, 0 },
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+    { vscp_core_buildEmbeddedMdfRsp,    0, 0, 0, 0 }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+};
+
+/** The transport layer refused the last multi-frame response. */
+static BOOL             vscp_core_rspIsBlocked      = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+
+/** Bulk configuration write session */
+static BulkWrite        vscp_core_bulkWrite;
+
+/** Register values of the bulk configuration write session, until they are committed. */
+static uint8_t          vscp_core_bulkWriteBuffer[VSCP_CONFIG_BULK_WRITE_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
+
+/**
+ * Register map of page 0, which contains the application specific registers
+ * and the VSCP specific registers. It shall be sorted by the register address.
+ * Registers, which are not part of a region, are reserved.
  */
-static ExtPageRead      vscp_core_extPageReadData   = { 0, 0, 0, 0 };
+static const RegRegion  vscp_core_regMapPage0[]   =
+{
+    /* First register                       Last register                           Flags                                                               Read function                           Write function                          */
+    {   VSCP_REGISTER_APP_START_ADDR,       VSCP_REGISTER_APP_END_ADDR,             VSCP_CORE_REG_FLAG_WRITE_PROTECTED,                                 vscp_core_readRegApp,                   vscp_core_writeRegApp                   },
+    {   VSCP_REG_ALARM_STATUS,              VSCP_REG_ALARM_STATUS,                  VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegAlarmStatus,           NULL                                    },
+    {   VSCP_REG_VSCP_VERSION_MAJOR,        VSCP_REG_VSCP_VERSION_MINOR,            VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegVscpVersion,           NULL                                    },
+    {   VSCP_REG_NODE_CONTROL_FLAGS,        VSCP_REG_NODE_CONTROL_FLAGS,            VSCP_CORE_REG_FLAG_NONE,                                            vscp_core_readRegNodeControlFlags,      vscp_core_writeRegNodeControlFlags      },
+    {   VSCP_REG_USER_ID_0,                 VSCP_REG_USER_ID_4,                     VSCP_CORE_REG_FLAG_NONE,                                            vscp_core_readRegUserId,                vscp_core_writeRegUserId                },
+    {   VSCP_REG_MANUFACTURER_DEV_ID_0,     VSCP_REG_MANUFACTURER_DEV_ID_3,         VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegManufacturerDevId,     NULL                                    },
+    {   VSCP_REG_MANUFACTURER_SUB_DEV_ID_0, VSCP_REG_MANUFACTURER_SUB_DEV_ID_3,     VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegManufacturerSubDevId,  NULL                                    },
+    {   VSCP_REG_NICKNAME_ID,               VSCP_REG_NICKNAME_ID,                   VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegNicknameId,            NULL                                    },
+    {   VSCP_REG_PAGE_SELECT_MSB,           VSCP_REG_PAGE_SELECT_LSB,               VSCP_CORE_REG_FLAG_NONE,                                            vscp_core_readRegPageSelect,            vscp_core_writeRegPageSelect            },
+    {   VSCP_REG_FIRMWARE_VERSION_MAJOR,    VSCP_REG_FIRMWARE_VERSION_SUB_MINOR,    VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegFirmwareVersion,       NULL                                    },
+    {   VSCP_REG_BOOT_LOADER_ALGORITHM,     VSCP_REG_BOOT_LOADER_ALGORITHM,         VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegBootLoaderAlgorithm,   NULL                                    },
+    {   VSCP_REG_BUFFER_SIZE,               VSCP_REG_BUFFER_SIZE,                   VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegBufferSize,            NULL                                    },
+    {   VSCP_REG_PAGES_USED,                VSCP_REG_PAGES_USED,                    VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegPagesUsed,             NULL                                    },
+    {   VSCP_REG_STD_DEV_FAMILY_CODE_3,     VSCP_REG_STD_DEV_FAMILY_CODE_0,         VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegStdDevFamilyCode,      NULL                                    },
+    {   VSCP_REG_STD_DEV_TYPE_3,            VSCP_REG_STD_DEV_TYPE_0,                VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegStdDevType,            NULL                                    },
+    {   VSCP_REG_RESTORE_STD_CFG,           VSCP_REG_RESTORE_STD_CFG,               VSCP_CORE_REG_FLAG_NONE,                                            NULL,                                   vscp_core_writeRegRestoreStdCfg         },
+    {   VSCP_REG_FIRMWARE_DEVICE_CODE_MSB,  VSCP_REG_FIRMWARE_DEVICE_CODE_LSB,      VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegFirmwareDeviceCode,    NULL                                    },
+    {   VSCP_REG_GUID_15,                   VSCP_REG_GUID_0,                        VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegGuid,                  NULL                                    },
+    {   VSCP_REG_MDF_URL_BEGIN,             VSCP_REG_MDF_URL_END,                   VSCP_CORE_REG_FLAG_READ_ONLY,                                       vscp_core_readRegMdfUrl,                NULL                                    }
+};
+
+/** Register map of all other pages, which contain only application specific registers. */
+static const RegRegion  vscp_core_regMapPage    =
+{
+    0x00, 0xFF, VSCP_CORE_REG_FLAG_WRITE_PROTECTED, vscp_core_readRegApp, vscp_core_writeRegApp
+};
+
+/**
+ * Register region of the application specific registers, which was resolved
+ * by the last register lookup. The decision matrices are placed in the
+ * application specific register space, but have their own regions.
+ */
+static RegRegion        vscp_core_regRegionApp;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/** Register map of the performance probe page. */
+static const RegRegion  vscp_core_regMapPagePerf    =
+{
+    0x00, (VSCP_PERF_PROBE_NUM * VSCP_PERF_PROBE_REG_NUM) - 1, VSCP_CORE_REG_FLAG_NONE, vscp_core_readRegPerf, vscp_core_writeRegPerf
+};
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+/** Register map of the runtime statistics page. */
+static const RegRegion  vscp_core_regMapPageStats   =
+{
+    0x00, (VSCP_STATS_CNT_NUM * VSCP_STATS_CNT_REG_NUM) - 1, VSCP_CORE_REG_FLAG_READ_ONLY, vscp_core_readRegStats, NULL
+};
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -255,6 +589,20 @@ extern VSCP_CORE_RET vscp_core_init(void)
 {
     VSCP_CORE_RET   ret = VSCP_CORE_RET_OK;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+    /* Initialize performance probes */
+    vscp_perf_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+    /* Initialize runtime statistics */
+    vscp_stats_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
     /* Initialize persistent memory access */
     vscp_ps_init();
 
@@ -301,9 +649,51 @@ extern VSCP_CORE_RET vscp_core_init(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
+    /* Initialize boot loader engine */
+    vscp_boot_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
     /* Initialize utilities module */
     vscp_util_init();
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+
+    /* Initialize segment node table */
+    vscp_node_table_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+    /* Initialize time service */
+    vscp_time_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
+    /* Initialize embedded MDF */
+    vscp_mdf_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+    /* Initialize acceptance filter */
+    vscp_filter_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    /* No nickname observed yet */
+    vscp_core_clearNicknameMap();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
     vscp_core_nickname          = vscp_ps_readNicknameId();
     vscp_core_state             = STATE_STARTUP;
     vscp_core_initState         = INIT_STATE_PROBE;
@@ -343,6 +733,14 @@ extern VSCP_CORE_RET vscp_core_init(void)
         ret = VSCP_CORE_RET_ERROR;
     }
 
+    /* Create a timer for the multi-frame response pacing and timeout. */
+    vscp_core_timerIdRsp = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == vscp_core_timerIdRsp)
+    {
+        /* No timer available. */
+        ret = VSCP_CORE_RET_ERROR;
+    }
+
     /* Create a timer used to drive the internal time since epoch (unix timestamp). */
     vscp_core_timerIdTimeSinceEpoch = vscp_timer_create();
     if (VSCP_TIMER_ID_INVALID == vscp_core_timerIdTimeSinceEpoch)
@@ -402,10 +800,19 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
     vscp_core_regAlarmStatus    = 0;
     vscp_core_regPageSelect     = 0;
 
-    vscp_core_extPageReadData.page  = 0;
-    vscp_core_extPageReadData.addr  = 0;
-    vscp_core_extPageReadData.count = 0;
-    vscp_core_extPageReadData.seq   = 0;
+    /* Abort all pending multi-frame responses */
+    for(index = 0; index < RSP_JOB_NUM; ++index)
+    {
+        vscp_core_rspJobs[index].count = 0;
+    }
+    vscp_core_rspIsBlocked = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+
+    /* Discard a pending bulk configuration write session */
+    vscp_core_bulkWrite.isActive = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
 
     /* Clear nickname id */
     vscp_core_writeNicknameId(VSCP_NICKNAME_NOT_INIT);
@@ -444,6 +851,13 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+    /* The decision matrix changed. */
+    vscp_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
     /* Restore application register factory default settings */
     vscp_app_reg_restoreFactoryDefaultSettings();
 
@@ -468,13 +882,70 @@ extern BOOL vscp_core_process(void)
 {
     BOOL isEventHandled = FALSE;
 
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_CORE_PROCESS);
+
+    VSCP_STATS_INC(VSCP_STATS_CNT_PROCESS_CYCLES);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+    /* Program the acceptance filters, if they are outdated. */
+    vscp_filter_process();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
     /* Get any received message.
      * Note, only in the active state all received messages are processed.
      * In the other ones it depends on their sub state.
      */
     vscp_core_rxMessageValid = vscp_transport_readMessage(&vscp_core_rxMessage);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+    /* Level 1 events over level 2 are handled like level 1 events. */
+    if (FALSE == vscp_core_rxMessageValid)
+    {
+        vscp_core_rxMessageValid = vscp_l2_readMessage(&vscp_core_rxMessage);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
     isEventHandled = vscp_core_rxMessageValid;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+    /* Latency between reception and processing */
+    if (TRUE == vscp_core_rxMessageValid)
+    {
+        VSCP_STATS_LATENCY(vscp_portable_getMicros() - vscp_core_rxMessage.timestamp);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    /* As long as the node has no nickname, note every nickname on the bus. */
+    if ((TRUE == vscp_core_rxMessageValid) &&
+        (STATE_ACTIVE != vscp_core_state))
+    {
+        vscp_core_markNickname(vscp_core_rxMessage.oAddr);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+
+    /* Track the other nodes of the segment. Own events, which are looped back, are skipped. */
+    if ((TRUE == vscp_core_rxMessageValid) &&
+        (vscp_core_nickname != vscp_core_rxMessage.oAddr))
+    {
+        vscp_node_table_update(&vscp_core_rxMessage);
+    }
+
+    /* Remove the nodes, which were not seen for a while. */
+    vscp_node_table_process();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
 
     /* Handle early as possible any kind of log control messages. */
@@ -482,13 +953,56 @@ extern BOOL vscp_core_process(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+    /* The time service keeps the time since epoch with millisecond resolution. */
+    vscp_time_process();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
     /* Handle internal time since epoch (unix timestamp), which increase per second. */
     if ((VSCP_TIMER_ID_INVALID != vscp_core_timerIdTimeSinceEpoch) &&
         (FALSE == vscp_timer_getStatus(vscp_core_timerIdTimeSinceEpoch)))
     {
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
         /* Increase unix timestamp */
         ++vscp_core_timeSinceEpoch;
 
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+        /* Determine the process cycles per second */
+        vscp_stats_process1s();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+
+        /* Time base of the node expiry */
+        vscp_node_table_process1s();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+
+        /* Discard a bulk configuration write session, which is not continued in time. */
+        if (FALSE != vscp_core_bulkWrite.isActive)
+        {
+            if (0 < vscp_core_bulkWrite.timeout)
+            {
+                --vscp_core_bulkWrite.timeout;
+            }
+
+            if (0 == vscp_core_bulkWrite.timeout)
+            {
+                vscp_core_bulkWrite.isActive = FALSE;
+            }
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
+
         /* Restart timer */
         vscp_timer_start(vscp_core_timerIdTimeSinceEpoch, VSCP_CORE_TIMER_THRESHOLD_1S);
     }
@@ -530,6 +1044,15 @@ extern BOOL vscp_core_process(void)
         vscp_core_stateReset();
         break;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
+    /* Node is updated by the boot loader engine */
+    case STATE_BOOT_LOADER:
+        vscp_core_stateBootLoader();
+        break;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
     /* A error happened. */
     case STATE_ERROR:
         vscp_core_stateError();
@@ -542,9 +1065,18 @@ extern BOOL vscp_core_process(void)
         break;
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+    /* Send buffered log events in the background */
+    vscp_logger_process();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
     /* Invalidate received message */
     vscp_core_rxMessageValid = FALSE;
 
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_CORE_PROCESS);
+
     return isEventHandled;
 }
 
@@ -613,7 +1145,15 @@ extern BOOL vscp_core_isActive(void)
  */
 extern uint32_t vscp_core_getTimeSinceEpoch(void)
 {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+    return vscp_time_getTimeSinceEpoch();
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
     return vscp_core_timeSinceEpoch;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
 }
 
 /**
@@ -626,6 +1166,13 @@ extern uint32_t vscp_core_getTimeSinceEpoch(void)
 extern void vscp_core_setTimeSinceEpoch(uint32_t timestamp)
 {
     vscp_core_timeSinceEpoch = timestamp;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+    vscp_time_set(timestamp, 0);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
     return;
 }
 
@@ -816,7 +1363,16 @@ static inline void  vscp_core_changeToStateInit(BOOL probeSegmentMaster)
         if (FALSE == probeSegmentMaster)
         {
             vscp_core_initState = INIT_STATE_PROBE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+            vscp_core_nickname_probe = vscp_core_getFirstProbeNickname();
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
             vscp_core_nickname_probe = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
         }
         else
         {
@@ -881,8 +1437,17 @@ static inline void  vscp_core_stateInit(void)
             /* Start nickname id discovery process */
             vscp_core_initState = INIT_STATE_PROBE;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+            /* Probe shall start with the first nickname id, which was not observed. */
+            vscp_core_nickname_probe = vscp_core_getFirstProbeNickname();
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
             /* Probe shall start with nickname id 1. */
             vscp_core_nickname_probe = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
         }
         /* Valid message received */
         else if (TRUE == vscp_core_rxMessageValid)
@@ -978,8 +1543,16 @@ static inline void  vscp_core_stateInit(void)
                          * See VSCP specification, chapter Level I Events,
                          * CLASS1.PROTOCOL, Type=2 (0x02) New node on line / Probe
                          */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+                        vscp_core_nickname_probe = vscp_core_getNextProbeNickname(vscp_core_nickname_probe);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
                         ++vscp_core_nickname_probe;
 
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
                         vscp_core_initState = INIT_STATE_PROBE;
                     }
                     else
@@ -1083,6 +1656,13 @@ static inline void  vscp_core_changeToStateActive(void)
 
         vscp_core_state = STATE_ACTIVE;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+        /* The observed nicknames get outdated, while the node is active. */
+        vscp_core_clearNicknameMap();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
         txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
         txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE;
         txMessage.priority  = VSCP_PRIORITY_0_HIGH;
@@ -1097,8 +1677,17 @@ static inline void  vscp_core_changeToStateActive(void)
 
         if (FALSE != vscp_core_isHeartbeatEnabled)
         {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+
+            /* Start node heartbeat with a phase offset */
+            vscp_core_startHeartbeat();
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
             /* Start timer for node heartbeat */
             vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
         }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
@@ -1148,14 +1737,18 @@ static inline BOOL  vscp_core_stateActive(void)
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
         /* Execute actions of the decision matrix (standard + extension) */
+        VSCP_PERF_ENTER(VSCP_PERF_PROBE_DM);
         vscp_dm_executeActions(&vscp_core_rxMessage);
+        VSCP_PERF_EXIT(VSCP_PERF_PROBE_DM);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
 
         /* Execute actions of the decision matrix next generation */
+        VSCP_PERF_ENTER(VSCP_PERF_PROBE_DM_NG);
         vscp_dm_ng_executeActions(&vscp_core_rxMessage);
+        VSCP_PERF_EXIT(VSCP_PERF_PROBE_DM_NG);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
@@ -1170,22 +1763,42 @@ static inline BOOL  vscp_core_stateActive(void)
     if ((FALSE != vscp_core_isHeartbeatEnabled) &&
         (FALSE == vscp_timer_getStatus(vscp_core_heartbeatTimerId)))
     {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+
+        /* The heartbeat period exceeds the timer range? */
+        if (0 < vscp_core_heartbeatDelay)
+        {
+            vscp_core_startHeartbeatTimer(vscp_core_heartbeatDelay);
+        }
+        else
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+        {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT )
-        (void)vscp_portable_sendNodeHeartbeatEvent();
+            (void)vscp_portable_sendNodeHeartbeatEvent();
 #else
-        (void)vscp_evt_information_sendNodeHeartbeat(0, vscp_dev_data_getNodeZone(), vscp_dev_data_getNodeSubZone(), NULL, 0);
+            (void)vscp_evt_information_sendNodeHeartbeat(0, vscp_dev_data_getNodeZone(), vscp_dev_data_getNodeSubZone(), NULL, 0);
 #endif
 
-        /* Restart timer */
-        vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+
+            /* Restart timer with the adapted period and jitter */
+            vscp_core_startHeartbeatTimer(vscp_core_getHeartbeatPeriod());
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
+            /* Restart timer */
+            vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+        }
     }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
-    /* Continue a extended page read? */
-    if (0 < vscp_core_extPageReadData.count)
+    /* Continue pending multi-frame responses */
+    if (TRUE == vscp_core_rspProcess())
     {
-        vscp_core_extendedPageReadRegister(&vscp_core_extPageReadData);
         isEventHandled = TRUE;
     }
 
@@ -1204,6 +1817,13 @@ static inline void  vscp_core_changeToStateIdle(void)
 
         vscp_core_state = STATE_IDLE;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+        /* The nickname discovery gave up, start with fresh observations next time. */
+        vscp_core_clearNicknameMap();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT )
 
         /* Notify the application. */
@@ -1225,27 +1845,85 @@ static inline void  vscp_core_stateIdle(void)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
 /**
- * Change to reset state.
- *
- * @param[in]   timeout Time in seconds to wait until reset is requested.
+ * Change to boot loader state.
  */
-static inline void  vscp_core_changeToStateReset(uint8_t timeout)
+static inline void  vscp_core_changeToStateBootLoader(void)
 {
-    if (STATE_RESET != vscp_core_state)
+    if (STATE_BOOT_LOADER != vscp_core_state)
     {
-        /* Disable lamp and show the user that the node is offline. */
-        vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
+        /* Show the user that the node is updated. */
+        vscp_portable_setLampState(VSCP_LAMP_STATE_BLINK_FAST);
 
-        vscp_core_state = STATE_RESET;
+        vscp_core_state = STATE_BOOT_LOADER;
 
-        vscp_core_secCnt = timeout;
+        /* Enter boot loader mode, which is acknowledged by the boot loader engine. */
+        vscp_boot_start();
+    }
 
-        /* Is a timer needed? */
-        if (0 < vscp_core_secCnt)
-        {
-            /* Start timer for a second */
-            vscp_timer_start(vscp_core_timerId, (uint16_t)1000);
+    return;
+}
+
+/**
+ * Handles the boot loader state.
+ * All received protocol events are forwarded to the boot loader engine. Any
+ * other event is ignored, until the firmware update is finished.
+ */
+static inline void  vscp_core_stateBootLoader(void)
+{
+    if ((TRUE == vscp_core_rxMessageValid) &&
+        (VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass))
+    {
+        vscp_boot_handleEvent(&vscp_core_rxMessage);
+    }
+
+    vscp_boot_process();
+
+    switch(vscp_boot_getState())
+    {
+    /* Firmware update aborted, continue with the current image. */
+    case VSCP_BOOT_STATE_ABORTED:
+        vscp_core_changeToStateActive();
+        break;
+
+    /* New image activated, request a reset to start it. */
+    case VSCP_BOOT_STATE_ACTIVATED:
+        vscp_core_changeToStateReset(0);
+        break;
+
+    /* Firmware update in progress */
+    default:
+        break;
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
+/**
+ * Change to reset state.
+ *
+ * @param[in]   timeout Time in seconds to wait until reset is requested.
+ */
+static inline void  vscp_core_changeToStateReset(uint8_t timeout)
+{
+    if (STATE_RESET != vscp_core_state)
+    {
+        /* Disable lamp and show the user that the node is offline. */
+        vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
+
+        vscp_core_state = STATE_RESET;
+
+        vscp_core_secCnt = timeout;
+
+        /* Is a timer needed? */
+        if (0 < vscp_core_secCnt)
+        {
+            /* Start timer for a second */
+            vscp_timer_start(vscp_core_timerId, (uint16_t)1000);
         }
         else
         {
@@ -1398,12 +2076,18 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Start block data transfer. */
     case VSCP_TYPE_PROTOCOL_START_BLOCK:
-        /* Boot loader specific event. Not supported. */
+        /* Boot loader specific event, which starts a bulk configuration write too. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+        vscp_core_handleProtocolBulkWriteStart();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
         break;
 
     /* VSCP specification, chapter Block data. */
     case VSCP_TYPE_PROTOCOL_BLOCK_DATA:
-        /* Boot loader specific event. Not supported. */
+        /* Boot loader specific event, which carries bulk configuration write data too. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+        vscp_core_handleProtocolBulkWriteData();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
         break;
 
     /* VSCP specification, chapter ACK data block. */
@@ -1418,7 +2102,10 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Program data block */
     case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA:
-        /* Boot loader specific event. Not supported. */
+        /* Boot loader specific event, which commits a bulk configuration write too. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+        vscp_core_handleProtocolBulkWriteCommit();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
         break;
 
     /* VSCP specification, chapter ACK program data block */
@@ -1498,12 +2185,15 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Get embedded MDF. */
     case VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF:
-        /* Optional and not supported yet. */
+        /* Optional, supported if an embedded MDF is configured. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+        vscp_core_handleProtocolGetEmbeddedMdf();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
         break;
 
     /* VSCP specification, chapter Get embedded MDF response. */
     case VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE:
-        /* Optional and not supported yet. */
+        /* This event is interesting for node management, but not for a node itself. */
         break;
 
     /* VSCP specification, chapter Extended page read register. */
@@ -1618,6 +2308,13 @@ static inline void  vscp_core_handleProtocolHeartbeat(void)
             vscp_core_timeSinceEpoch |= ((uint32_t)vscp_core_rxMessage.data[3]) <<  8;
             vscp_core_timeSinceEpoch |= ((uint32_t)vscp_core_rxMessage.data[4]) <<  0;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+            /* Slew the local time towards the segment controller time. */
+            vscp_time_sync(vscp_core_timeSinceEpoch);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT )
 
             /* Notify application about a new received timestamp. */
@@ -1632,6 +2329,272 @@ static inline void  vscp_core_handleProtocolHeartbeat(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER )
+
+/**
+ * Start the node heartbeat. The first heartbeat is sent after a phase offset
+ * in the range of one heartbeat period, which is derived from the GUID and the
+ * nickname. This way the nodes of a segment don't send their heartbeats in
+ * lockstep after a common power up.
+ */
+static void vscp_core_startHeartbeat(void)
+{
+    uint16_t    seed    = vscp_core_getGuidCrc();
+
+    seed = vscp_util_crc16(seed, &vscp_core_nickname, 1);
+
+    /* The pseudo random number generator must not start with 0. */
+    if (0 == seed)
+    {
+        seed = 1;
+    }
+
+    vscp_core_heartbeatRandom   = seed;
+    vscp_core_heartbeatBackOff  = 0;
+    vscp_core_heartbeatTxErrors = vscp_transport_getTransmitErrorCounter();
+
+    vscp_core_startHeartbeatTimer(seed % VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+
+    return;
+}
+
+/**
+ * Get the period until the next node heartbeat. If transmit errors occurred
+ * since the last heartbeat, the period is doubled, up to
+ * VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX times. Without transmit errors it is
+ * halved again. A random jitter of +/- VSCP_CONFIG_HEARTBEAT_NODE_JITTER is
+ * added, which doesn't change the average period.
+ *
+ * @return Heartbeat period in ms
+ */
+static uint32_t vscp_core_getHeartbeatPeriod(void)
+{
+    uint8_t     txErrors    = vscp_transport_getTransmitErrorCounter();
+    uint32_t    period      = 0;
+    uint32_t    jitter      = VSCP_CONFIG_HEARTBEAT_NODE_JITTER;
+
+    /* Bus load increased? */
+    if (vscp_core_heartbeatTxErrors != txErrors)
+    {
+        if (VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX > vscp_core_heartbeatBackOff)
+        {
+            ++vscp_core_heartbeatBackOff;
+        }
+    }
+    else if (0 < vscp_core_heartbeatBackOff)
+    {
+        --vscp_core_heartbeatBackOff;
+    }
+
+    vscp_core_heartbeatTxErrors = txErrors;
+
+    period = ((uint32_t)VSCP_CONFIG_HEARTBEAT_NODE_PERIOD) << vscp_core_heartbeatBackOff;
+
+    /* Limit the jitter to the half period. */
+    if ((period / 2) < jitter)
+    {
+        jitter = period / 2;
+    }
+
+    return period - jitter + (vscp_core_getHeartbeatRandom() % (2 * jitter + 1));
+}
+
+/**
+ * Start the heartbeat timer. A delay, which exceeds the timer range, is
+ * continued after the timer elapsed.
+ *
+ * @param[in]   delay   Delay in ms
+ */
+static void vscp_core_startHeartbeatTimer(uint32_t delay)
+{
+    uint16_t    value   = UINT16_MAX;
+
+    if (UINT16_MAX > delay)
+    {
+        value = (uint16_t)delay;
+    }
+
+    vscp_core_heartbeatDelay = delay - value;
+
+    vscp_timer_start(vscp_core_heartbeatTimerId, value);
+
+    return;
+}
+
+/**
+ * Get the next pseudo random number of the heartbeat jitter (16-bit xorshift).
+ *
+ * @return Pseudo random number
+ */
+static uint16_t vscp_core_getHeartbeatRandom(void)
+{
+    uint16_t    random  = vscp_core_heartbeatRandom;
+
+    random ^= (uint16_t)(random << 7);
+    random ^= (uint16_t)(random >> 9);
+    random ^= (uint16_t)(random << 8);
+
+    vscp_core_heartbeatRandom = random;
+
+    return random;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+/**
+ * Calculate the CRC-16 over the GUID of the node.
+ *
+ * @return CRC-16 of the GUID
+ */
+static uint16_t vscp_core_getGuidCrc(void)
+{
+    uint16_t    crc     = VSCP_UTIL_CRC16_INIT;
+    uint8_t     index   = 0;
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        uint8_t guid    = vscp_dev_data_getGUID(index);
+
+        crc = vscp_util_crc16(crc, &guid, 1);
+    }
+
+    return crc;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+/**
+ * Clear the nickname occupancy map.
+ */
+static void vscp_core_clearNicknameMap(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CORE_NICKNAME_MAP_SIZE; ++index)
+    {
+        vscp_core_nicknameMap[index] = 0;
+    }
+
+    return;
+}
+
+/**
+ * Mark a nickname as observed in the nickname occupancy map.
+ *
+ * @param[in]   nickname    Nickname id
+ */
+static void vscp_core_markNickname(uint8_t nickname)
+{
+    vscp_core_nicknameMap[nickname / 8] |= (uint8_t)(1 << (nickname % 8));
+
+    return;
+}
+
+/**
+ * Check whether a nickname was observed.
+ *
+ * @param[in]   nickname    Nickname id
+ * @return Observed or not
+ * @retval FALSE    Nickname not observed
+ * @retval TRUE     Nickname observed
+ */
+static BOOL vscp_core_isNicknameObserved(uint8_t nickname)
+{
+    BOOL    isObserved  = FALSE;
+
+    if (0 != (vscp_core_nicknameMap[nickname / 8] & (uint8_t)(1 << (nickname % 8))))
+    {
+        isObserved = TRUE;
+    }
+
+    return isObserved;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+/**
+ * Get the first nickname id of the nickname discovery process. It starts with
+ * VSCP_CONFIG_START_NODE_PROBE_NICKNAME or with a nickname id derived from the
+ * GUID. If the nickname map is enabled, nickname ids which were observed
+ * already are skipped.
+ *
+ * @return Nickname id to probe or VSCP_NICKNAME_NOT_INIT if no one is left
+ */
+static uint8_t vscp_core_getFirstProbeNickname(void)
+{
+    uint8_t nickname    = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START )
+
+    /* Nickname id in the range of 1 - 254 */
+    nickname = (uint8_t)(1 + (vscp_core_getGuidCrc() % (VSCP_NICKNAME_NOT_INIT - 1)));
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
+    vscp_core_nicknameProbeStart = nickname;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    if (TRUE == vscp_core_isNicknameObserved(nickname))
+    {
+        nickname = vscp_core_getNextProbeNickname(nickname);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+    return nickname;
+}
+
+/**
+ * Get the next nickname id of the nickname discovery process. The nickname ids
+ * 1 - 254 are probed in turn and it wraps around. If the nickname map is
+ * enabled, nickname ids which were observed already are skipped.
+ *
+ * @param[in]   nickname    Last probed nickname id
+ * @return Nickname id to probe or VSCP_NICKNAME_NOT_INIT if all were probed
+ */
+static uint8_t vscp_core_getNextProbeNickname(uint8_t nickname)
+{
+    BOOL    isFound = FALSE;
+
+    while(FALSE == isFound)
+    {
+        if ((VSCP_NICKNAME_NOT_INIT - 1) <= nickname)
+        {
+            nickname = 1;
+        }
+        else
+        {
+            ++nickname;
+        }
+
+        /* All nickname ids probed? */
+        if (vscp_core_nicknameProbeStart == nickname)
+        {
+            nickname = VSCP_NICKNAME_NOT_INIT;
+            isFound = TRUE;
+        }
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+        else if (FALSE == vscp_core_isNicknameObserved(nickname))
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+        else
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+        {
+            isFound = TRUE;
+        }
+    }
+
+    return nickname;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_GUID_START ) */
+
 /**
  * Handles a protocol class new node online / probe event.
  */
@@ -1846,457 +2809,948 @@ static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value)
  */
 static uint8_t  vscp_core_readRegister(uint16_t page, uint8_t addr)
 {
-    uint8_t ret = 0;
+    uint8_t value   = 0;
 
-    /* Page 0 includes the VSCP specific registers. */
-    if ((0 == page) &&
-        (VSCP_REGISTER_VSCP_START_ADDR <= addr) &&
-        (VSCP_REGISTER_VSCP_END_ADDR >= addr))
-    {
-        switch(addr)
-        {
-            case VSCP_REG_ALARM_STATUS:
-                ret = vscp_core_regAlarmStatus;
+    vscp_core_readRegisters(page, addr, &value, 1);
 
-                /* Reset alarm */
-                vscp_core_regAlarmStatus = 0;
-                break;
+    return value;
+}
 
-            case VSCP_REG_VSCP_VERSION_MAJOR:
-                ret = VSCP_CORE_VERSION_MAJOR;
-                break;
+/**
+ * Read one or more consecutive registers. The register region is looked up
+ * only once and all requested registers of it are read by a single call of
+ * the region read function.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers, which shall not exceed the page end
+ */
+static void vscp_core_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
 
-            case VSCP_REG_VSCP_VERSION_MINOR:
-                ret = VSCP_CORE_VERSION_MINOR;
-                break;
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_REG_READ);
 
-            case VSCP_REG_NODE_CONTROL_FLAGS:
-                ret = vscp_ps_readNodeControlFlags();
-                break;
+    while(num > index)
+    {
+        uint8_t             regAddr = addr + index;
+        RegRegion const *   region  = vscp_core_getRegRegion(page, regAddr);
+        uint8_t             count   = 1;
+        uint8_t             offset  = 0;
 
-            case VSCP_REG_USER_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_3:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_4:
-                ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
-                break;
+        if (NULL != region)
+        {
+            uint16_t    available   = ((uint16_t)region->last) - regAddr + 1;
 
-            case VSCP_REG_MANUFACTURER_DEV_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_3:
-                ret = vscp_dev_data_getManufacturerDevId(addr - VSCP_REG_MANUFACTURER_DEV_ID_0);
-                break;
+            /* Read all requested registers, which are part of this region. */
+            count = num - index;
 
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
-                ret = vscp_dev_data_getManufacturerSubDevId(addr - VSCP_REG_MANUFACTURER_SUB_DEV_ID_0);
-                break;
+            if (available < count)
+            {
+                count = (uint8_t)available;
+            }
+        }
 
-            case VSCP_REG_NICKNAME_ID:
-                ret = vscp_core_nickname;
-                break;
+        /* Reserved or write only registers are read as zero. */
+        if ((NULL == region) ||
+            (NULL == region->read))
+        {
+            for(offset = 0; offset < count; ++offset)
+            {
+                buffer[index + offset] = 0;
+            }
+        }
+        else
+        {
+            region->read(page, regAddr, &buffer[index], count);
+        }
 
-            case VSCP_REG_PAGE_SELECT_MSB:
-                ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
-                break;
+        index += count;
+    }
 
-            case VSCP_REG_PAGE_SELECT_LSB:
-                ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
-                break;
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_REG_READ);
 
-            case VSCP_REG_FIRMWARE_VERSION_MAJOR:
-                ret = vscp_dev_data_getFirmwareVersionMajor();
-                break;
+    return;
+}
 
-            case VSCP_REG_FIRMWARE_VERSION_MINOR:
-                ret = vscp_dev_data_getFirmwareVersionMinor();
-                break;
+/**
+ * Write to register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @param[out]  failed  Write error is set to TRUE
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed)
+{
+    uint8_t             ret     = 0;
+    BOOL                error   = TRUE;
+    RegRegion const *   region  = vscp_core_getRegRegion(page, addr);
 
-            case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
-                ret = vscp_dev_data_getFirmwareVersionSubMinor();
-                break;
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_REG_WRITE);
 
-            case VSCP_REG_BOOT_LOADER_ALGORITHM:
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
-                ret = vscp_portable_getBootLoaderAlgorithm();
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
-                ret = 0xFF;
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
-                break;
+    if (TRUE == vscp_core_isRegRegionWriteable(region))
+    {
+        ret     = region->write(page, addr, value);
+        error   = FALSE;
+    }
 
-            case VSCP_REG_BUFFER_SIZE:
-                ret = VSCP_L1_DATA_SIZE;
-                break;
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_REG_WRITE);
 
-            case VSCP_REG_PAGES_USED:
-                ret = vscp_app_reg_getPagesUsed();
-                break;
+    if (NULL != failed)
+    {
+        *failed = error;
+    }
 
-            case VSCP_REG_STD_DEV_FAMILY_CODE_3:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_2:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_1:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_0:
-                ret = vscp_dev_data_getStdDevFamilyCode(3 - (addr - VSCP_REG_STD_DEV_FAMILY_CODE_3));
-                break;
+    return ret;
+}
+
+/**
+ * Get the register region, which contains the given register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register region
+ * @retval  NULL    Register is reserved
+ */
+static RegRegion const *    vscp_core_getRegRegion(uint16_t page, uint8_t addr)
+{
+    RegRegion const *   region  = NULL;
+
+    /* The VSCP specific registers are only part of page 0. */
+    if (0 != page)
+    {
+        region = &vscp_core_regMapPage;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+        /* The statistics of the performance probes have their own page. */
+        if (VSCP_CONFIG_PERF_PAGE == page)
+        {
+            region = &vscp_core_regMapPagePerf;
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+        /* The runtime statistics have their own page. */
+        if (VSCP_CONFIG_STATS_PAGE == page)
+        {
+            region = &vscp_core_regMapPageStats;
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+    }
+    else
+    {
+        uint8_t left    = 0;
+        uint8_t right   = VSCP_UTIL_ARRAY_NUM(vscp_core_regMapPage0);
+
+        /* The register map is sorted by address, therefore a binary search is used. */
+        while((left < right) && (NULL == region))
+        {
+            uint8_t middle  = left + ((right - left) / 2);
+
+            if (vscp_core_regMapPage0[middle].first > addr)
+            {
+                right = middle;
+            }
+            else if (vscp_core_regMapPage0[middle].last < addr)
+            {
+                left = middle + 1;
+            }
+            else
+            {
+                region = &vscp_core_regMapPage0[middle];
+            }
+        }
+    }
+
+    /* The application specific register space contains the decision matrices. */
+    if ((NULL != region) &&
+        (vscp_core_readRegApp == region->read))
+    {
+        region = vscp_core_getRegRegionApp(region, page, addr);
+    }
+
+    return region;
+}
+
+/**
+ * Get the register region in the application specific register space, which
+ * contains the given register. It is either a decision matrix or the part of
+ * the application specific registers around it.
+ * The returned region is only valid until the next register lookup.
+ *
+ * @param[in]   appRegion   Region of the whole application specific register space
+ * @param[in]   page        Page
+ * @param[in]   addr        Register address
+ * @return  Register region
+ */
+static RegRegion const *    vscp_core_getRegRegionApp(RegRegion const * const appRegion, uint16_t page, uint8_t addr)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    uint8_t first   = 0;
+    uint8_t last    = 0;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    vscp_core_regRegionApp = *appRegion;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    if (TRUE == vscp_dm_getRegisterRange(page, &first, &last))
+    {
+        vscp_core_clipRegRegion(&vscp_core_regRegionApp, addr, first, last, vscp_core_readRegDm, vscp_core_writeRegDm);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    if (TRUE == vscp_dm_ng_getRegisterRange(page, &first, &last))
+    {
+        vscp_core_clipRegRegion(&vscp_core_regRegionApp, addr, first, last, vscp_core_readRegDmNg, vscp_core_writeRegDmNg);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    return &vscp_core_regRegionApp;
+}
+
+/**
+ * Clip a register region by a register range, which is placed in it.
+ * If the given register is part of the range, the region is reduced to the
+ * range and gets its read and write functions. Otherwise the region is reduced
+ * to the part before or after the range, which contains the register.
+ *
+ * @param[in,out]   region  Register region, which contains the register
+ * @param[in]       addr    Register address
+ * @param[in]       first   First register of the range
+ * @param[in]       last    Last register of the range
+ * @param[in]       read    Read function of the range
+ * @param[in]       write   Write function of the range
+ */
+static void vscp_core_clipRegRegion(RegRegion * const region, uint8_t addr, uint8_t first, uint8_t last, RegRead read, RegWrite write)
+{
+    /* Only the part of the range, which is inside the region, is considered. */
+    if (region->first > first)
+    {
+        first = region->first;
+    }
+
+    if (region->last < last)
+    {
+        last = region->last;
+    }
+
+    /* Range is outside of the region? */
+    if (first > last)
+    {
+        return;
+    }
+
+    if (first > addr)
+    {
+        region->last = first - 1;
+    }
+    else if (last < addr)
+    {
+        region->first = last + 1;
+    }
+    else
+    {
+        region->first   = first;
+        region->last    = last;
+        region->read    = read;
+        region->write   = write;
+    }
+
+    return;
+}
+
+/**
+ * Check whether the registers of a region can be written via VSCP.
+ * Reserved and read only registers can't be written. Write protected registers
+ * can only be written, if the application register write protection is
+ * disabled.
+ *
+ * @param[in]   region  Register region, NULL in case of reserved registers
+ * @return  Writeable or not
+ * @retval  FALSE   Not writeable
+ * @retval  TRUE    Writeable
+ */
+static BOOL vscp_core_isRegRegionWriteable(/*@null@*/ RegRegion const * const region)
+{
+    BOOL    isWriteable = FALSE;
+
+    if ((NULL != region) &&
+        (NULL != region->write) &&
+        (0 == (region->flags & VSCP_CORE_REG_FLAG_READ_ONLY)))
+    {
+        /* Write protection disabled? */
+        if ((0 == (region->flags & VSCP_CORE_REG_FLAG_WRITE_PROTECTED)) ||
+            (0 != vscp_core_getRegAppWriteProtect()))
+        {
+            isWriteable = TRUE;
+        }
+    }
+
+    return isWriteable;
+}
+
+/**
+ * Copy register values to a buffer.
+ *
+ * @param[in]   values  Values of all registers of the region
+ * @param[in]   offset  Offset of the first register in the region
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_copyRegisters(uint8_t const * const values, uint8_t offset, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = values[offset + index];
+    }
+
+    return;
+}
+
+/**
+ * Read application specific registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegApp(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = vscp_app_reg_readRegister(page, addr + index);
+    }
+
+    return;
+}
+
+/**
+ * Write a application specific register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegApp(uint16_t page, uint8_t addr, uint8_t value)
+{
+    return vscp_app_reg_writeRegister(page, addr, value);
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+/**
+ * Read decision matrix registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegDm(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    vscp_dm_readRegisters(page, addr, buffer, num);
+
+    return;
+}
+
+/**
+ * Write a decision matrix register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegDm(uint16_t page, uint8_t addr, uint8_t value)
+{
+    uint8_t ret = vscp_dm_writeRegister(page, addr, value);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+    vscp_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+    return ret;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+/**
+ * Read decision matrix next generation registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegDmNg(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    vscp_dm_ng_readRegisters(page, addr, buffer, num);
+
+    return;
+}
+
+/**
+ * Write a decision matrix next generation register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegDmNg(uint16_t page, uint8_t addr, uint8_t value)
+{
+    uint8_t ret = vscp_dm_ng_writeRegister(page, addr, value);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+    vscp_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+    return ret;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+/**
+ * Read the alarm status register. The alarm status is cleared after it was
+ * read.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegAlarmStatus(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+    VSCP_UTIL_UNUSED(num);
+
+    buffer[0] = vscp_core_regAlarmStatus;
+    vscp_core_regAlarmStatus = 0;
+
+    return;
+}
+
+/**
+ * Read the VSCP version registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegVscpVersion(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t const   values[]    = { VSCP_CORE_VERSION_MAJOR, VSCP_CORE_VERSION_MINOR };
+
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_core_copyRegisters(values, addr - VSCP_REG_VSCP_VERSION_MAJOR, buffer, num);
+
+    return;
+}
+
+/**
+ * Read the node control flags register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegNodeControlFlags(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+    VSCP_UTIL_UNUSED(num);
+
+    buffer[0] = vscp_ps_readNodeControlFlags();
+
+    return;
+}
+
+/**
+ * Write the node control flags register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegNodeControlFlags(uint16_t page, uint8_t addr, uint8_t value)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+
+    vscp_ps_writeNodeControlFlags(value);
+
+    return vscp_ps_readNodeControlFlags();
+}
+
+/**
+ * Read the user id registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegUserId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    VSCP_UTIL_UNUSED(page);
+
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0 + index);
+    }
+
+    return;
+}
+
+/**
+ * Write a user id register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegUserId(uint16_t page, uint8_t addr, uint8_t value)
+{
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_ps_writeUserId(addr - VSCP_REG_USER_ID_0, value);
+
+    return vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
+}
+
+/**
+ * Read the manufacturer device id registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegManufacturerDevId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    VSCP_UTIL_UNUSED(page);
+
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = vscp_dev_data_getManufacturerDevId(addr - VSCP_REG_MANUFACTURER_DEV_ID_0 + index);
+    }
+
+    return;
+}
+
+/**
+ * Read the manufacturer sub device id registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegManufacturerSubDevId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
 
-            case VSCP_REG_STD_DEV_TYPE_3:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_2:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_1:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_0:
-                ret = vscp_dev_data_getStdDevType(3 - (addr - VSCP_REG_STD_DEV_TYPE_3));
-                break;
+    VSCP_UTIL_UNUSED(page);
 
-            case VSCP_REG_RESTORE_STD_CFG:
-                /* Write only */
-                break;
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = vscp_dev_data_getManufacturerSubDevId(addr - VSCP_REG_MANUFACTURER_SUB_DEV_ID_0 + index);
+    }
 
-            case VSCP_REG_FIRMWARE_DEVICE_CODE_MSB:
-                ret = VSCP_UTIL_WORD_MSB(vscp_dev_data_getFirmwareDeviceCode());
-                break;
-                
-            case VSCP_REG_FIRMWARE_DEVICE_CODE_LSB:
-                ret = VSCP_UTIL_WORD_LSB(vscp_dev_data_getFirmwareDeviceCode());
-                break;
+    return;
+}
 
-            case VSCP_REG_GUID_15:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_14:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_13:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_12:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_11:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_10:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_9:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_8:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_7:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_6:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_5:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_4:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_3:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_0:
-                ret = vscp_dev_data_getGUID(15 - (addr - VSCP_REG_GUID_15));
-                break;
+/**
+ * Read the nickname id register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegNicknameId(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+    VSCP_UTIL_UNUSED(num);
 
-            default:
+    buffer[0] = vscp_core_nickname;
 
-                if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
-                    (VSCP_REG_MDF_URL_END >= addr))
-                {
-                    ret = vscp_dev_data_getMdfUrl(addr - VSCP_REG_MDF_URL_BEGIN);
-                }
+    return;
+}
 
-                break;
-        }
-    }
+/**
+ * Read the page select registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegPageSelect(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t const   values[]    = { VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect), VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect) };
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-    /* Is the addressed register part of the decision matrix? */
-    else if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_core_copyRegisters(values, addr - VSCP_REG_PAGE_SELECT_MSB, buffer, num);
+
+    return;
+}
+
+/**
+ * Write a page select register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegPageSelect(uint16_t page, uint8_t addr, uint8_t value)
+{
+    uint8_t ret = 0;
+
+    VSCP_UTIL_UNUSED(page);
+
+    if (VSCP_REG_PAGE_SELECT_MSB == addr)
     {
-        ret = vscp_dm_readRegister(page, addr);
+        vscp_core_regPageSelect &= 0x00FF;
+        vscp_core_regPageSelect |= ((uint16_t)value) << 8;
+        ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
+    }
+    else
+    {
+        vscp_core_regPageSelect &= 0xFF00;
+        vscp_core_regPageSelect |= ((uint16_t)value) << 0;
+        ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
     }
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-    /* Is the addressed register part of the decision matrix NG? */
-    else if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
+    return ret;
+}
+
+/**
+ * Read the firmware version registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegFirmwareVersion(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t const   values[]    =
+    {
+        vscp_dev_data_getFirmwareVersionMajor(),
+        vscp_dev_data_getFirmwareVersionMinor(),
+        vscp_dev_data_getFirmwareVersionSubMinor()
+    };
+
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_core_copyRegisters(values, addr - VSCP_REG_FIRMWARE_VERSION_MAJOR, buffer, num);
+
+    return;
+}
+
+/**
+ * Read the boot loader algorithm register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegBootLoaderAlgorithm(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+    VSCP_UTIL_UNUSED(num);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
+    buffer[0] = vscp_portable_getBootLoaderAlgorithm();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+    buffer[0] = 0xFF;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+
+    return;
+}
+
+/**
+ * Read the buffer size register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegBufferSize(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+    VSCP_UTIL_UNUSED(num);
+
+    buffer[0] = VSCP_L1_DATA_SIZE;
+
+    return;
+}
+
+/**
+ * Read the pages used register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegPagesUsed(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
+    VSCP_UTIL_UNUSED(num);
+
+    buffer[0] = vscp_app_reg_getPagesUsed();
+
+    return;
+}
+
+/**
+ * Read the standard device family code registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegStdDevFamilyCode(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    VSCP_UTIL_UNUSED(page);
+
+    for(index = 0; index < num; ++index)
     {
-        ret = vscp_dm_ng_readRegister(page, addr);
+        buffer[index] = vscp_dev_data_getStdDevFamilyCode(3 - (addr - VSCP_REG_STD_DEV_FAMILY_CODE_3 + index));
     }
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
-    else
-    /* Application specific register */
+    return;
+}
+
+/**
+ * Read the standard device type registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegStdDevType(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    VSCP_UTIL_UNUSED(page);
+
+    for(index = 0; index < num; ++index)
     {
-        ret = vscp_app_reg_readRegister(page, addr);
+        buffer[index] = vscp_dev_data_getStdDevType(3 - (addr - VSCP_REG_STD_DEV_TYPE_3 + index));
     }
 
-    return ret;
+    return;
 }
 
 /**
- * Write to register.
+ * Write the restore standard configuration register.
  *
  * @param[in]   page    Page
  * @param[in]   addr    Register address
  * @param[in]   value   Value to write
- * @param[out]  failed  Write error is set to TRUE
  * @return  Register value
  */
-static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed)
+static uint8_t  vscp_core_writeRegRestoreStdCfg(uint16_t page, uint8_t addr, uint8_t value)
 {
-    uint8_t ret     = 0;
-    BOOL    error   = TRUE;
-
-    /* Page 0 includes the VSCP specific registers. */
-    if ((0 == page) &&
-        (VSCP_REGISTER_VSCP_START_ADDR <= addr) &&
-        (VSCP_REGISTER_VSCP_END_ADDR >= addr))
-    {
-        switch(addr)
-        {
-        case VSCP_REG_ALARM_STATUS:
-            /* Read only */
-            break;
-
-        case VSCP_REG_VSCP_VERSION_MAJOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_VSCP_VERSION_MINOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_NODE_CONTROL_FLAGS:
-            vscp_ps_writeNodeControlFlags(value);
-            ret = vscp_ps_readNodeControlFlags();
-            error = FALSE;
-            break;
-
-        case VSCP_REG_USER_ID_0:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_3:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_4:
-            vscp_ps_writeUserId(addr - VSCP_REG_USER_ID_0, value);
-            ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
-            error = FALSE;
-            break;
-
-        case VSCP_REG_MANUFACTURER_DEV_ID_0:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_DEV_ID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_DEV_ID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_DEV_ID_3:
-            /* Read only */
-            break;
-
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
-            /* Read only */
-            break;
-
-        case VSCP_REG_NICKNAME_ID:
-            /* Read only */
-            break;
-
-        case VSCP_REG_PAGE_SELECT_MSB:
-            vscp_core_regPageSelect &= 0x00FF;
-            vscp_core_regPageSelect |= ((uint16_t)value) << 8;
-            ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
-            error = FALSE;
-            break;
-
-        case VSCP_REG_PAGE_SELECT_LSB:
-            vscp_core_regPageSelect &= 0xFF00;
-            vscp_core_regPageSelect |= ((uint16_t)value) << 0;
-            ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
-            error = FALSE;
-            break;
-
-        case VSCP_REG_FIRMWARE_VERSION_MAJOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_FIRMWARE_VERSION_MINOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_BOOT_LOADER_ALGORITHM:
-            /* Read only */
-            break;
-
-        case VSCP_REG_BUFFER_SIZE:
-            /* Read only */
-            break;
-
-        case VSCP_REG_PAGES_USED:
-            /* Read only */
-            break;
-
-        case VSCP_REG_STD_DEV_FAMILY_CODE_3:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_FAMILY_CODE_2:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_FAMILY_CODE_1:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_FAMILY_CODE_0:
-            /* Read only */
-            break;
-
-        case VSCP_REG_STD_DEV_TYPE_3:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_TYPE_2:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_TYPE_1:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_TYPE_0:
-            /* Read only */
-            break;
-
-        case VSCP_REG_FIRMWARE_DEVICE_CODE_MSB:
-            /* Read only */
-            break;
-            
-        case VSCP_REG_FIRMWARE_DEVICE_CODE_LSB:
-            /* Read only */
-            break;
-
-        case VSCP_REG_RESTORE_STD_CFG:
-
-            /* 0x55 has to be written first, multi-frame timer is disabled. */
-            if ((0x55 == value) &&
-                (FALSE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
-            {
-                vscp_timer_start(vscp_core_timerIdReg162, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
-            }
-            /* 0xAA has to be written after 0x55 and within a specific time. */
-            else if ((0xAA == value) &&
-                     (TRUE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
-            {
-                vscp_timer_stop(vscp_core_timerIdReg162);
-
-                /* Restore default settings */
-                vscp_core_restoreFactoryDefaultSettings();
-            }
+    VSCP_UTIL_UNUSED(page);
+    VSCP_UTIL_UNUSED(addr);
 
-            error = FALSE;
-            break;
-
-        case VSCP_REG_GUID_15:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_14:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_13:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_12:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_11:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_10:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_9:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_8:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_7:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_6:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_5:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_4:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_3:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_0:
-            /* Read only */
-            break;
-
-        default:
-
-            if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
-                (VSCP_REG_MDF_URL_END >= addr))
-            {
-                /* Read only */
-                ;
-            }
-
-            break;
-        }
+    /* 0x55 has to be written first, multi-frame timer is disabled. */
+    if ((0x55 == value) &&
+        (FALSE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
+    {
+        vscp_timer_start(vscp_core_timerIdReg162, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
     }
-    /* Write protection disabled? */
-    else if (0 != vscp_core_getRegAppWriteProtect())
+    /* 0xAA has to be written after 0x55 and within a specific time. */
+    else if ((0xAA == value) &&
+             (TRUE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
     {
+        vscp_timer_stop(vscp_core_timerIdReg162);
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-        /* Is the addressed register part of the decision matrix? */
-        if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
-        {
-            ret = vscp_dm_writeRegister(page, addr, value);
-        }
-        else
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+        /* Restore default settings */
+        vscp_core_restoreFactoryDefaultSettings();
+    }
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-        /* Is the addressed register part of the decision matrix NG? */
-        if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
-        {
-            ret = vscp_dm_ng_writeRegister(page, addr, value);
-        }
-        else
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+    /* Write only */
+    return 0;
+}
 
-        /* Application specific registers */
-        {
-            ret = vscp_app_reg_writeRegister(page, addr, value);
-        }
+/**
+ * Read the firmware device code registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegFirmwareDeviceCode(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint16_t const  deviceCode  = vscp_dev_data_getFirmwareDeviceCode();
+    uint8_t const   values[]    = { VSCP_UTIL_WORD_MSB(deviceCode), VSCP_UTIL_WORD_LSB(deviceCode) };
+
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_core_copyRegisters(values, addr - VSCP_REG_FIRMWARE_DEVICE_CODE_MSB, buffer, num);
+
+    return;
+}
+
+/**
+ * Read the GUID registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegGuid(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
 
-        error = FALSE;
+    VSCP_UTIL_UNUSED(page);
+
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = vscp_dev_data_getGUID(15 - (addr - VSCP_REG_GUID_15 + index));
     }
 
-    if (NULL != failed)
+    return;
+}
+
+/**
+ * Read the MDF URL registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegMdfUrl(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    VSCP_UTIL_UNUSED(page);
+
+    for(index = 0; index < num; ++index)
     {
-        *failed = error;
+        buffer[index] = vscp_dev_data_getMdfUrl(addr - VSCP_REG_MDF_URL_BEGIN + index);
     }
 
-    return ret;
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/**
+ * Read the statistics registers of the performance probes.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegPerf(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_perf_readRegisters(addr, buffer, num);
+
+    return;
+}
+
+/**
+ * Write a statistics register of a performance probe, which resets the
+ * statistics of this probe.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t vscp_core_writeRegPerf(uint16_t page, uint8_t addr, uint8_t value)
+{
+    VSCP_UTIL_UNUSED(page);
+
+    return vscp_perf_writeRegister(addr, value);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+/**
+ * Read the runtime statistics registers.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+static void vscp_core_readRegStats(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    VSCP_UTIL_UNUSED(page);
+
+    vscp_stats_readRegisters(addr, buffer, num);
+
+    return;
 }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
 /**
  * Handles a protocol class write register event.
  */
@@ -2367,6 +3821,18 @@ static inline void  vscp_core_handleProtocolEnterBootLoaderMode(void)
 
                 (void)vscp_transport_writeMessage(&txMessage);
             }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE )
+
+            /* VSCP boot loader algorithm is handled by the boot loader engine? */
+            else if (VSCP_BOOT_ALGORITHM_VSCP == vscp_portable_getBootLoaderAlgorithm())
+            {
+                /* Boot loader engine will send the acknowledge. */
+                vscp_core_changeToStateBootLoader();
+            }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_ENGINE ) */
+
             else
             {
                 /* Go idle and wait */
@@ -2497,54 +3963,18 @@ static inline void  vscp_core_handleProtocolPageRead(void)
         /* This node? */
         if (vscp_core_nickname == vscp_core_rxMessage.data[0])
         {
-            vscp_TxMessage  txMessage;
-            uint8_t         addr        = vscp_core_rxMessage.data[1];
-            uint8_t         index       = 0;
-            uint8_t         num         = vscp_core_rxMessage.data[2];
-            uint8_t         dataIndex   = 0;
+            uint8_t addr    = vscp_core_rxMessage.data[1];
+            uint8_t num     = vscp_core_rxMessage.data[2];
 
             /* If the number of bytes to read overflows the page, it will be
              * limited to the page end.
              */
             if ((0xFF - num) < addr)
-            {
-                num = 0xFF - addr;
-            }
-
-            /* Prepare tx message */
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataSize  = VSCP_L1_DATA_SIZE;
-
-            /* Sequence number */
-            txMessage.data[dataIndex] = 0;
-            ++dataIndex;
-
-            for(index = 0; index < num; ++index)
-            {
-                txMessage.data[dataIndex] = vscp_core_readRegister(vscp_core_regPageSelect, addr + index);
-                ++dataIndex;
-
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
-
-                    /* Increase sequence number and reset data index */
-                    dataIndex = 0;
-                    ++(txMessage.data[dataIndex]);
-                    ++dataIndex;
-                }
-            }
-
-            if (1 < dataIndex)
-            {
-                txMessage.dataSize = dataIndex;
-
-                (void)vscp_transport_writeMessage(&txMessage);
+            {
+                num = 0xFF - addr;
             }
+
+            vscp_core_rspStart(RSP_JOB_PAGE_READ, vscp_core_regPageSelect, addr, num);
         }
     }
 
@@ -2680,321 +4110,879 @@ static inline void  vscp_core_handleProtocolWhoIsThere(void)
         /* This node? */
         if ((vscp_core_nickname == vscp_core_rxMessage.data[0]) ||
             (VSCP_NICKNAME_NOT_INIT == vscp_core_rxMessage.data[0]))
+        {
+            /* GUID and MDF URL, filled up to 7 complete responses. */
+            vscp_core_rspStart(RSP_JOB_WHO_IS_THERE, 0, 0, 7 * (VSCP_L1_DATA_SIZE - 1));
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles a protocol class get decision matrix info event.
+ */
+static inline void  vscp_core_handleProtocolGetDecisionMatrixInfo(void)
+{
+    /* Check number of parameters. */
+    if (1 == vscp_core_rxMessage.dataSize)
+    {
+        /* This node? */
+        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        {
+            vscp_TxMessage  txMessage;
+            uint8_t         matrixSize      = 0;
+            uint8_t         matrixOffset    = 0;
+            uint16_t        pageStart       = 0;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+            matrixSize      = vscp_dm_getMatrixRows();
+            matrixOffset    = vscp_dm_getMatrixOffset();
+            pageStart       = vscp_dm_getPage();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE;
+            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+            txMessage.oAddr     = vscp_core_nickname;
+            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+            txMessage.dataSize  = 4;
+            txMessage.data[0]   = matrixSize;
+            txMessage.data[1]   = matrixOffset;
+            txMessage.data[2]   = VSCP_UTIL_WORD_MSB(pageStart);
+            txMessage.data[3]   = VSCP_UTIL_WORD_LSB(pageStart);
+            /* Note page end is depreciated (byte 4 and 5) and byte 6 is only for L2 nodes. */
+
+            (void)vscp_transport_writeMessage(&txMessage);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles a protocol class extended page read register event.
+ */
+static inline void  vscp_core_handleProtocolExtendedPageReadRegister(void)
+{
+    /* Check number of parameters. */
+    if (4 <= vscp_core_rxMessage.dataSize)
+    {
+        /* This node? */
+        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        {
+            uint16_t    page    = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
+            uint16_t    count   = 1;
+
+            /* Read more than one register? */
+            if (5 == vscp_core_rxMessage.dataSize)
+            {
+                count = vscp_core_rxMessage.data[4];
+
+                /* Shall 256 registers be read? */
+                if (0 == count)
+                {
+                    count = 256;
+                }
+            }
+
+            vscp_core_rspStart(RSP_JOB_EXT_PAGE_READ, page, vscp_core_rxMessage.data[3], count);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles a protocol class extended page write register event.
+ */
+static inline void  vscp_core_handleProtocolExtendedPageWriteRegister(void)
+{
+    /* Check number of parameters. */
+    if (5 <= vscp_core_rxMessage.dataSize)
+    {
+        /* This node? */
+        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
         {
             vscp_TxMessage  txMessage;
-            int8_t          sIndex      = 0;
-            uint8_t         uIndex      = 0;
+            uint16_t        page        = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
+            uint8_t         addr        = vscp_core_rxMessage.data[3];
+            uint8_t         num         = vscp_core_rxMessage.dataSize - 4;
+            uint8_t         index       = 0;
             uint8_t         dataIndex   = 0;
-            uint8_t         rowIndex    = 0;
 
+            /* If the number of bytes to write overflows the page, it will be
+             * limited to the page end.
+             */
+            if (((0xFF - num) + 1) < addr)
+            {
+                num = (0xFF - addr) + 1;
+            }
+
+            /* Prepare tx message */
             txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
+            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
             txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
             txMessage.oAddr     = vscp_core_nickname;
             txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataSize  = 8;
 
-            /* Row index */
-            txMessage.data[dataIndex] = rowIndex;
-            ++dataIndex;
-            ++rowIndex;
+            /* Sequence number */
+            txMessage.data[0] = 0;
+
+            /* Page and register */
+            txMessage.data[1] = vscp_core_rxMessage.data[1];
+            txMessage.data[2] = vscp_core_rxMessage.data[2];
+            txMessage.data[3] = vscp_core_rxMessage.data[3];
+
+            dataIndex = 4;
+
+            /* Write registers */
+            for(index = 0; index < num; ++index)
+            {
+                txMessage.data[dataIndex] = vscp_core_writeRegister(page, addr + index, vscp_core_rxMessage.data[4 + index], NULL);
+                ++dataIndex;
+            }
+
+            txMessage.dataSize = dataIndex;
+
+            (void)vscp_transport_writeMessage(&txMessage);
+        }
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
+/**
+ * Handles a protocol class get embedded MDF event.
+ * The MDF is streamed with 6 byte per response. The optional frame index
+ * can be used to resume a transfer after a lost response.
+ *
+ * Event data:
+ * - 0: Nickname
+ * - 1: Frame index of the first response MSB (optional)
+ * - 2: Frame index of the first response LSB (optional)
+ */
+static inline void  vscp_core_handleProtocolGetEmbeddedMdf(void)
+{
+    /* Check number of parameters. */
+    if ((1 == vscp_core_rxMessage.dataSize) ||
+        (3 == vscp_core_rxMessage.dataSize))
+    {
+        /* This node? */
+        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        {
+            /* The last response contains less than 6 byte of the MDF, which
+             * marks the end. Without embedded MDF only this one is sent.
+             */
+            uint16_t    frames  = vscp_mdf_getSize() / (VSCP_L1_DATA_SIZE - 2) + 1;
+            uint16_t    index   = 0;
+
+            if (3 == vscp_core_rxMessage.dataSize)
+            {
+                index = ((uint16_t)vscp_core_rxMessage.data[1]) << 8;
+                index |= vscp_core_rxMessage.data[2];
+            }
+
+            if (frames > index)
+            {
+                vscp_core_rspStart(RSP_JOB_EMBEDDED_MDF, index, 0, frames - index);
+            }
+        }
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE )
+
+/**
+ * Handles a protocol class start block data transfer event, which starts a
+ * bulk configuration write session.
+ *
+ * Event data:
+ * - 0: Nickname
+ * - 1: Page MSB
+ * - 2: Page LSB
+ * - 3: Address of the first register
+ * - 4: Memory type (VSCP_CORE_BULK_WRITE_MEM_TYPE)
+ * - 5: Number of registers MSB
+ * - 6: Number of registers LSB
+ *
+ * An already started session is discarded.
+ */
+static inline void  vscp_core_handleProtocolBulkWriteStart(void)
+{
+    /* Check number of parameters, this node and the memory type. */
+    if ((7 == vscp_core_rxMessage.dataSize) &&
+        (vscp_core_nickname == vscp_core_rxMessage.data[0]) &&
+        (VSCP_CORE_BULK_WRITE_MEM_TYPE == vscp_core_rxMessage.data[4]))
+    {
+        uint16_t    page    = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
+        uint8_t     offset  = vscp_core_rxMessage.data[3];
+        uint16_t    length  = (((uint16_t)vscp_core_rxMessage.data[5]) << 8) | (vscp_core_rxMessage.data[6]);
+
+        /* The registers shall fit into the buffer and shall not overflow the page. */
+        if ((0 < length) &&
+            (VSCP_CONFIG_BULK_WRITE_SIZE >= length) &&
+            ((((uint16_t)0x100) - offset) >= length))
+        {
+            vscp_core_bulkWrite.isActive    = TRUE;
+            vscp_core_bulkWrite.oAddr       = vscp_core_rxMessage.oAddr;
+            vscp_core_bulkWrite.page        = page;
+            vscp_core_bulkWrite.offset      = offset;
+            vscp_core_bulkWrite.length      = length;
+            vscp_core_bulkWrite.received    = 0;
+            vscp_core_bulkWrite.seq         = 0;
+            vscp_core_bulkWrite.window      = 0;
+            vscp_core_bulkWrite.isNackSent  = FALSE;
+            vscp_core_bulkWrite.timeout     = VSCP_CONFIG_BULK_WRITE_TIMEOUT;
+            vscp_core_bulkWrite.crc         = VSCP_UTIL_CRC16_INIT;
+
+            /* Acknowledge with page, address, memory type and number of registers. */
+            vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_START_BLOCK_ACK, &vscp_core_rxMessage.data[1], 6);
+        }
+        else
+        {
+            uint8_t error   = VSCP_CORE_BULK_WRITE_ERR_INVALID;
+
+            vscp_core_bulkWrite.isActive = FALSE;
+
+            vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_START_BLOCK_NACK, &error, 1);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles a protocol class block data event, which contains register values
+ * of the bulk configuration write session.
+ *
+ * Event data:
+ * - 0: Nickname
+ * - 1: Sequence number, starting with 0
+ * - 2-7: Register values
+ *
+ * The events are not acknowledged one by one. A chunk acknowledge with the next
+ * expected sequence number is sent after every VSCP_CONFIG_BULK_WRITE_ACK_WINDOW
+ * events and the block data acknowledge with the CRC after the last one.
+ * If an event with an unexpected sequence number is received, a single block data
+ * NACK with the expected sequence number is sent and all further events are
+ * ignored, until the host continues with the expected one.
+ *
+ * Without an active session of the sender, the event is silently ignored,
+ * because block data events are used by the boot loader algorithm too and
+ * may carry firmware data for another node.
+ */
+static inline void  vscp_core_handleProtocolBulkWriteData(void)
+{
+    /* Check number of parameters, this node and the session. */
+    if ((3 <= vscp_core_rxMessage.dataSize) &&
+        (vscp_core_nickname == vscp_core_rxMessage.data[0]) &&
+        (TRUE == vscp_core_bulkWrite.isActive) &&
+        (vscp_core_bulkWrite.oAddr == vscp_core_rxMessage.oAddr))
+    {
+        uint8_t data[4];
+
+        if (vscp_core_bulkWrite.seq != vscp_core_rxMessage.data[1])
+        {
+            /* Report the sequence error only once. */
+            if (FALSE == vscp_core_bulkWrite.isNackSent)
+            {
+                data[0] = VSCP_CORE_BULK_WRITE_ERR_SEQUENCE;
+                data[1] = vscp_core_bulkWrite.seq;
+
+                vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, data, 2);
+
+                vscp_core_bulkWrite.isNackSent  = TRUE;
+                vscp_core_bulkWrite.window      = 0;
+            }
+        }
+        else
+        {
+            uint8_t num = vscp_core_rxMessage.dataSize - 2;
+
+            if ((vscp_core_bulkWrite.length - vscp_core_bulkWrite.received) < num)
+            {
+                data[0] = VSCP_CORE_BULK_WRITE_ERR_OVERFLOW;
+                data[1] = vscp_core_bulkWrite.seq;
+
+                vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, data, 2);
+
+                /* Discard the session, the host has to start again. */
+                vscp_core_bulkWrite.isActive = FALSE;
+            }
+            else
+            {
+                uint8_t index   = 0;
+
+                for(index = 0; index < num; ++index)
+                {
+                    vscp_core_bulkWriteBuffer[vscp_core_bulkWrite.received + index] = vscp_core_rxMessage.data[2 + index];
+                }
+
+                vscp_core_bulkWrite.crc = vscp_util_crc16(vscp_core_bulkWrite.crc, &vscp_core_rxMessage.data[2], num);
+
+                vscp_core_bulkWrite.received    += num;
+                vscp_core_bulkWrite.isNackSent  = FALSE;
+                vscp_core_bulkWrite.timeout     = VSCP_CONFIG_BULK_WRITE_TIMEOUT;
+                ++vscp_core_bulkWrite.seq;
+                ++vscp_core_bulkWrite.window;
+
+                /* All register values received? */
+                if (vscp_core_bulkWrite.length == vscp_core_bulkWrite.received)
+                {
+                    data[0] = (uint8_t)((vscp_core_bulkWrite.crc >> 8) & 0xFF);
+                    data[1] = (uint8_t)((vscp_core_bulkWrite.crc >> 0) & 0xFF);
+                    data[2] = (uint8_t)((vscp_core_bulkWrite.received >> 8) & 0xFF);
+                    data[3] = (uint8_t)((vscp_core_bulkWrite.received >> 0) & 0xFF);
+
+                    vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK, data, 4);
+
+                    vscp_core_bulkWrite.window = 0;
+                }
+                /* Window complete? */
+                else if (VSCP_CONFIG_BULK_WRITE_ACK_WINDOW <= vscp_core_bulkWrite.window)
+                {
+                    data[0] = vscp_core_bulkWrite.seq;
+                    data[1] = (uint8_t)((vscp_core_bulkWrite.received >> 8) & 0xFF);
+                    data[2] = (uint8_t)((vscp_core_bulkWrite.received >> 0) & 0xFF);
+
+                    vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK, data, 3);
+
+                    vscp_core_bulkWrite.window = 0;
+                }
+                else
+                {
+                    /* Continue receiving */
+                    ;
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles a protocol class program data block event, which commits the bulk
+ * configuration write session.
+ *
+ * Event data:
+ * - 0: Nickname
+ * - 1: CRC-16 MSB of all register values
+ * - 2: CRC-16 LSB of all register values
+ *
+ * The registers are only written, if all register values were received, the
+ * CRC matches and every register is writeable. Otherwise no register is
+ * written at all. If a register can't be written, all registers of the
+ * session are restored (see vscp_core_applyBulkWrite()). In any case the
+ * session ends.
+ */
+static inline void  vscp_core_handleProtocolBulkWriteCommit(void)
+{
+    /* Check number of parameters and this node. */
+    if ((3 == vscp_core_rxMessage.dataSize) &&
+        (vscp_core_nickname == vscp_core_rxMessage.data[0]))
+    {
+        uint8_t     error   = 0;
+        uint16_t    crc     = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
+        uint16_t    index   = 0;
+
+        if ((FALSE == vscp_core_bulkWrite.isActive) ||
+            (vscp_core_bulkWrite.oAddr != vscp_core_rxMessage.oAddr))
+        {
+            error = VSCP_CORE_BULK_WRITE_ERR_NO_SESSION;
+        }
+        else if (vscp_core_bulkWrite.length != vscp_core_bulkWrite.received)
+        {
+            error = VSCP_CORE_BULK_WRITE_ERR_INCOMPLETE;
+        }
+        else if (vscp_core_bulkWrite.crc != crc)
+        {
+            error = VSCP_CORE_BULK_WRITE_ERR_CRC;
+        }
+        else
+        {
+            /* Validate all registers, before the first one is written. */
+            for(index = 0; (index < vscp_core_bulkWrite.length) && (0 == error); ++index)
+            {
+                RegRegion const *   region  = vscp_core_getRegRegion(vscp_core_bulkWrite.page, (uint8_t)(vscp_core_bulkWrite.offset + index));
+
+                if (FALSE == vscp_core_isRegRegionWriteable(region))
+                {
+                    error = VSCP_CORE_BULK_WRITE_ERR_WRITE;
+                }
+            }
+        }
+
+        if (0 == error)
+        {
+            error = vscp_core_applyBulkWrite();
+        }
+
+        if (0 != error)
+        {
+            vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK, &error, 1);
+        }
+        else
+        {
+            uint8_t data[5];
+
+            data[0] = (uint8_t)((vscp_core_bulkWrite.page >> 8) & 0xFF);
+            data[1] = (uint8_t)((vscp_core_bulkWrite.page >> 0) & 0xFF);
+            data[2] = vscp_core_bulkWrite.offset;
+            data[3] = (uint8_t)((vscp_core_bulkWrite.length >> 8) & 0xFF);
+            data[4] = (uint8_t)((vscp_core_bulkWrite.length >> 0) & 0xFF);
+
+            vscp_core_sendBulkWriteRsp(VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK, data, 5);
+        }
+
+        vscp_core_bulkWrite.isActive = FALSE;
+    }
+
+    return;
+}
+
+/**
+ * Write all registers of the bulk configuration write session.
+ *
+ * Every register value in the session buffer is exchanged with the previous
+ * register value. A register fails, if it can't be written or if it reads back
+ * a different value than written. In this case all registers, which were
+ * written so far, are restored in reverse order, so the registers and the
+ * persistent memory behind them stay unchanged.
+ *
+ * @return Error
+ * @retval 0                                   Successful
+ * @retval VSCP_CORE_BULK_WRITE_ERR_WRITE      A register failed, all registers restored
+ */
+static uint8_t  vscp_core_applyBulkWrite(void)
+{
+    uint8_t     error   = 0;
+    uint16_t    written = 0;
 
-            /* GUID */
-            for(sIndex = 15; sIndex >= 0; --sIndex)
-            {
-                txMessage.data[dataIndex] = vscp_dev_data_getGUID((uint8_t)sIndex);
-                ++dataIndex;
+    while((vscp_core_bulkWrite.length > written) && (0 == error))
+    {
+        uint8_t             addr    = (uint8_t)(vscp_core_bulkWrite.offset + written);
+        uint8_t             value   = vscp_core_bulkWriteBuffer[written];
+        RegRegion const *   region  = vscp_core_getRegRegion(vscp_core_bulkWrite.page, addr);
+        BOOL                failed  = FALSE;
+        uint8_t             ret     = 0;
 
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
+        /* Keep the previous value for the restore. */
+        vscp_core_bulkWriteBuffer[written] = vscp_core_readRegister(vscp_core_bulkWrite.page, addr);
 
-                    dataIndex = 0;
+        ret = vscp_core_writeRegister(vscp_core_bulkWrite.page, addr, value, &failed);
 
-                    /* Row index */
-                    txMessage.data[dataIndex] = rowIndex;
-                    ++dataIndex;
-                    ++rowIndex;
-                }
-            }
+        /* Write only registers can't be verified. */
+        if ((TRUE == failed) ||
+            ((NULL != region) && (NULL != region->read) && (value != ret)))
+        {
+            error = VSCP_CORE_BULK_WRITE_ERR_WRITE;
+        }
 
-            /* MDF */
-            for(uIndex = 0; uIndex < 32; ++uIndex)
-            {
-                txMessage.data[dataIndex] = vscp_dev_data_getMdfUrl(uIndex);
-                ++dataIndex;
+        /* The failed register is restored too, because it may be partly written. */
+        ++written;
+    }
 
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
+    if (0 != error)
+    {
+        while(0 < written)
+        {
+            uint8_t             addr    = 0;
+            RegRegion const *   region  = NULL;
 
-                    dataIndex = 0;
+            --written;
 
-                    /* Row index */
-                    txMessage.data[dataIndex] = rowIndex;
-                    ++dataIndex;
-                    ++rowIndex;
-                }
-            }
+            addr    = (uint8_t)(vscp_core_bulkWrite.offset + written);
+            region  = vscp_core_getRegRegion(vscp_core_bulkWrite.page, addr);
 
-            /* Fill up */
-            while(VSCP_L1_DATA_SIZE > dataIndex)
+            /* Write only registers have no previous value. */
+            if ((NULL != region) &&
+                (NULL != region->read))
             {
-                txMessage.data[dataIndex] = 0;
-                ++dataIndex;
+                (void)vscp_core_writeRegister(vscp_core_bulkWrite.page, addr, vscp_core_bulkWriteBuffer[written], NULL);
             }
-
-            (void)vscp_transport_writeMessage(&txMessage);
         }
     }
 
-    return;
+    return error;
 }
 
 /**
- * Handles a protocol class get decision matrix info event.
+ * Send a response of the bulk configuration write session.
+ *
+ * @param[in]   vscpType    Protocol class type
+ * @param[in]   data        Event data
+ * @param[in]   dataSize    Event data size in byte
  */
-static inline void  vscp_core_handleProtocolGetDecisionMatrixInfo(void)
+static void vscp_core_sendBulkWriteRsp(uint8_t vscpType, uint8_t const * const data, uint8_t dataSize)
 {
-    /* Check number of parameters. */
-    if (1 == vscp_core_rxMessage.dataSize)
-    {
-        /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
-        {
-            vscp_TxMessage  txMessage;
-            uint8_t         matrixSize      = 0;
-            uint8_t         matrixOffset    = 0;
-            uint16_t        pageStart       = 0;
-
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-
-            matrixSize      = vscp_dm_getMatrixRows();
-            matrixOffset    = vscp_dm_getMatrixOffset();
-            pageStart       = vscp_dm_getPage();
-
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+    vscp_TxMessage  txMessage;
+    uint8_t         index       = 0;
 
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataSize  = 4;
-            txMessage.data[0]   = matrixSize;
-            txMessage.data[1]   = matrixOffset;
-            txMessage.data[2]   = VSCP_UTIL_WORD_MSB(pageStart);
-            txMessage.data[3]   = VSCP_UTIL_WORD_LSB(pageStart);
-            /* Note page end is depreciated (byte 4 and 5) and byte 6 is only for L2 nodes. */
+    txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    txMessage.vscpType  = vscpType;
+    txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+    txMessage.oAddr     = vscp_core_nickname;
+    txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+    txMessage.dataSize  = dataSize;
 
-            (void)vscp_transport_writeMessage(&txMessage);
-        }
+    for(index = 0; index < dataSize; ++index)
+    {
+        txMessage.data[index] = data[index];
     }
 
+    (void)vscp_transport_writeMessage(&txMessage);
+
     return;
 }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_BULK_WRITE ) */
+
 /**
- * Handles a protocol class extended page read register event.
+ * Get start up control information.
+ *
+ * @return  Start-up control information.
+ * @retval  01b Start initialization immediately
+ * @retval  others Wait until initialization is explicit started
  */
-static inline void  vscp_core_handleProtocolExtendedPageReadRegister(void)
+static inline uint8_t   vscp_core_getStartUpControl(void)
 {
-    /* Check number of parameters. */
-    if (4 <= vscp_core_rxMessage.dataSize)
-    {
-        /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
-        {
-            vscp_core_extPageReadData.page  = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
-            vscp_core_extPageReadData.addr  = vscp_core_rxMessage.data[3];
-            vscp_core_extPageReadData.seq   = 0;
+    return (vscp_ps_readNodeControlFlags() >> 6) & 0x03;
+}
 
-            /* Read more than one register? */
-            if (5 == vscp_core_rxMessage.dataSize)
-            {
-                vscp_core_extPageReadData.count = vscp_core_rxMessage.data[4];
+/**
+ * Get application register write protection information.
+ *
+ * @return  Write protection information
+ * @retval  0 Write protected
+ * @retval  1 Write enabled
+ */
+static inline uint8_t   vscp_core_getRegAppWriteProtect(void)
+{
+    return (vscp_ps_readNodeControlFlags() >> 5) & 0x01;
+}
 
-                /* Shall 256 registers be read? */
-                if (0 == vscp_core_extPageReadData.count)
-                {
-                    vscp_core_extPageReadData.count = 256;
-                }
-            }
-            else
-            {
-                vscp_core_extPageReadData.count = 1;
-            }
+/**
+ * This function starts a multi-frame response. A pending response of the same
+ * job is aborted.
+ *
+ * Only a limited burst of responses will be sent now.
+ * If more responses are necessary, they will be sent in the following
+ * process cycles. This avoids that the framework blocks the application
+ * too long. And makes the node more responsive.
+ *
+ * @param[in] id    Responder job id
+ * @param[in] page  Page
+ * @param[in] addr  Address (offset in page) of the first response
+ * @param[in] count Number of registers or bytes to send
+ */
+static void vscp_core_rspStart(RSP_JOB id, uint16_t page, uint8_t addr, uint16_t count)
+{
+    if (RSP_JOB_NUM > id)
+    {
+        vscp_core_rspJobs[id].page  = page;
+        vscp_core_rspJobs[id].addr  = addr;
+        vscp_core_rspJobs[id].count = count;
+        vscp_core_rspJobs[id].seq   = 0;
 
-            /* Only one response will be sent now.
-             * If more responses are necessary, they will be sent in the following
-             * process cycles. This avoids that the framework blocks the application
-             * too long. And makes the node more responsive.
-             */
-            vscp_core_extendedPageReadRegister(&vscp_core_extPageReadData);
-        }
+        (void)vscp_core_rspProcess();
     }
 
     return;
 }
 
 /**
- * This function handles a extended page read register.
+ * This function continues all pending multi-frame responses.
+ * It sends as many responses as the transport layer accepts, but not more than
+ * VSCP_CONFIG_MULTI_FRAME_RSP_BURST. A response, which is refused by the
+ * transport layer, is sent again in the following process cycles. If the
+ * transport layer refuses the responses longer than VSCP_CONFIG_MULTI_MSG_TIMEOUT,
+ * all pending responses are aborted.
  *
- * @param[in] data  Extended page read register data
+ * @return If any response is pending, it will return TRUE otherwise FALSE.
  */
-static void vscp_core_extendedPageReadRegister(ExtPageRead * const data)
+static BOOL vscp_core_rspProcess(void)
 {
-    if ((NULL != data) &&
-        (0 < data->count))
-    {
-        vscp_TxMessage  txMessage;
-        uint8_t         index       = 0;
-        uint8_t         addr        = data->addr;
-        uint16_t        count       = data->count;
-        BOOL            nextPage    = FALSE;
+    BOOL    isPending   = FALSE;
+    uint8_t burst       = 0;
+    uint8_t index       = 0;
 
-        /* Prepare tx message */
-        txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-        txMessage.vscpType  = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
-        txMessage.priority  = VSCP_PRIORITY_7_LOW;
-        txMessage.oAddr     = vscp_core_nickname;
-        txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+    for(index = 0; index < RSP_JOB_NUM; ++index)
+    {
+        if (0 < vscp_core_rspJobs[index].count)
+        {
+            isPending = TRUE;
+        }
+    }
 
-        /* Sequence number */
-        txMessage.data[0] = data->seq;
+    /* Nothing to do or pause between two bursts? */
+    if ((FALSE == isPending) ||
+        ((FALSE == vscp_core_rspIsBlocked) &&
+         (TRUE == vscp_timer_getStatus(vscp_core_timerIdRsp))))
+    {
+        burst = VSCP_CONFIG_MULTI_FRAME_RSP_BURST;
+    }
 
-        /* Page and offset */
-        txMessage.data[1] = (data->page >> 8) & 0xff;
-        txMessage.data[2] = (data->page >> 0) & 0xff;
-        txMessage.data[3] = addr;
+    index = 0;
+    while((VSCP_CONFIG_MULTI_FRAME_RSP_BURST > burst) &&
+          (RSP_JOB_NUM > index))
+    {
+        RspJob  next    = vscp_core_rspJobs[index];
 
-        /* Read registers */
-        index = 4;
-        do
+        /* Job finished? */
+        if (0 == next.count)
         {
-            txMessage.data[index] = vscp_core_readRegister(data->page, addr);
             ++index;
-            --count;
+        }
+        else
+        {
+            vscp_TxMessage  txMessage;
 
-            /* If the read takes place on the next page, a new event shall be used,
-             * because the event parameter contains the page, where all read
-             * registers are located.
+            /* Build the response on a copy of the job, because the job shall
+             * only advance if the transport layer accepts the response.
              */
-            if (0xff > addr)
-            {
-                ++addr;
-            }
-            else
+            next.build(&next, &txMessage);
+
+            if (FALSE == vscp_transport_writeMessage(&txMessage))
             {
-                nextPage = TRUE;
+                /* Transport layer refuses the response the first time? */
+                if (FALSE == vscp_core_rspIsBlocked)
+                {
+                    vscp_core_rspIsBlocked = TRUE;
+                    vscp_timer_start(vscp_core_timerIdRsp, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
+                }
+                /* Timeout, abort all responses. */
+                else if (FALSE == vscp_timer_getStatus(vscp_core_timerIdRsp))
+                {
+                    for(index = 0; index < RSP_JOB_NUM; ++index)
+                    {
+                        vscp_core_rspJobs[index].count = 0;
+                    }
+                    vscp_core_rspIsBlocked = FALSE;
+                }
+
+                break;
             }
-        }
-        while((VSCP_L1_DATA_SIZE > index) && (0 < count) && (FALSE == nextPage));
 
-        /* Set event data size */
-        txMessage.dataSize = index;
+            vscp_core_rspJobs[index] = next;
 
-        if (TRUE == vscp_transport_writeMessage(&txMessage))
-        {
-            /* Continue on the next page? */
-            if (TRUE == nextPage)
+            if (TRUE == vscp_core_rspIsBlocked)
             {
-                ++data->page;
-                data->addr = 0;
+                vscp_core_rspIsBlocked = FALSE;
+                vscp_timer_stop(vscp_core_timerIdRsp);
             }
-            /* Continue on the same page */
-            else
+
+            ++burst;
+
+            /* Pause after the burst, before the remaining responses are sent? */
+            if ((0 < VSCP_CONFIG_MULTI_FRAME_RSP_PACING) &&
+                (VSCP_CONFIG_MULTI_FRAME_RSP_BURST == burst))
             {
-                data->addr = addr;
+                vscp_timer_start(vscp_core_timerIdRsp, VSCP_CONFIG_MULTI_FRAME_RSP_PACING);
             }
-
-            data->count = count;
-            ++data->seq;
         }
     }
 
-    return;
+    return isPending;
 }
 
 /**
- * Handles a protocol class extended page write register event.
+ * This function builds the next read page response.
+ * Every response contains the sequence number and up to 7 registers.
+ *
+ * @param[in,out]   job         Responder job
+ * @param[out]      txMessage   Response frame
  */
-static inline void  vscp_core_handleProtocolExtendedPageWriteRegister(void)
+static void vscp_core_buildPageReadRsp(RspJob * const job, vscp_TxMessage * const txMessage)
 {
-    /* Check number of parameters. */
-    if (5 <= vscp_core_rxMessage.dataSize)
+    uint8_t num = VSCP_L1_DATA_SIZE - 1;
+
+    if (job->count < num)
     {
-        /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
-        {
-            vscp_TxMessage  txMessage;
-            uint16_t        page        = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
-            uint8_t         addr        = vscp_core_rxMessage.data[3];
-            uint8_t         num         = vscp_core_rxMessage.dataSize - 4;
-            uint8_t         index       = 0;
-            uint8_t         dataIndex   = 0;
+        num = (uint8_t)job->count;
+    }
 
-            /* If the number of bytes to write overflows the page, it will be
-             * limited to the page end.
-             */
-            if (((0xFF - num) + 1) < addr)
-            {
-                num = (0xFF - addr) + 1;
-            }
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->vscpType     = VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE;
+    txMessage->priority     = VSCP_PRIORITY_3_NORMAL;
+    txMessage->oAddr        = vscp_core_nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+    txMessage->dataSize     = 1 + num;
 
-            /* Prepare tx message */
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+    /* Sequence number */
+    txMessage->data[0] = job->seq;
 
-            /* Sequence number */
-            txMessage.data[0] = 0;
+    vscp_core_readRegisters(job->page, job->addr, &txMessage->data[1], num);
 
-            /* Page and register */
-            txMessage.data[1] = vscp_core_rxMessage.data[1];
-            txMessage.data[2] = vscp_core_rxMessage.data[2];
-            txMessage.data[3] = vscp_core_rxMessage.data[3];
+    job->addr   += num;
+    job->count  -= num;
+    ++job->seq;
 
-            dataIndex = 4;
+    return;
+}
 
-            /* Write registers */
-            for(index = 0; index < num; ++index)
-            {
-                txMessage.data[dataIndex] = vscp_core_writeRegister(page, addr + index, vscp_core_rxMessage.data[4 + index], NULL);
-                ++dataIndex;
-            }
+/**
+ * This function builds the next who is there response.
+ * The responses contain the GUID (MSB first) and the MDF URL, filled up with
+ * zeros.
+ *
+ * @param[in,out]   job         Responder job
+ * @param[out]      txMessage   Response frame
+ */
+static void vscp_core_buildWhoIsThereRsp(RspJob * const job, vscp_TxMessage * const txMessage)
+{
+    uint8_t index       = 0;
+    uint8_t dataIndex   = job->seq * (VSCP_L1_DATA_SIZE - 1);
 
-            txMessage.dataSize = dataIndex;
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->vscpType     = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
+    txMessage->priority     = VSCP_PRIORITY_3_NORMAL;
+    txMessage->oAddr        = vscp_core_nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+    txMessage->dataSize     = VSCP_L1_DATA_SIZE;
 
-            (void)vscp_transport_writeMessage(&txMessage);
+    /* Row index */
+    txMessage->data[0] = job->seq;
+
+    for(index = 1; index < VSCP_L1_DATA_SIZE; ++index)
+    {
+        /* GUID */
+        if (16 > dataIndex)
+        {
+            txMessage->data[index] = vscp_dev_data_getGUID(15 - dataIndex);
+        }
+        /* MDF */
+        else if ((16 + 32) > dataIndex)
+        {
+            txMessage->data[index] = vscp_dev_data_getMdfUrl(dataIndex - 16);
+        }
+        /* Fill up */
+        else
+        {
+            txMessage->data[index] = 0;
         }
+
+        ++dataIndex;
     }
 
+    job->count -= VSCP_L1_DATA_SIZE - 1;
+    ++job->seq;
+
     return;
 }
 
 /**
- * Get start up control information.
+ * This function builds the next extended page read response.
+ * Every response contains the sequence number, the page, the address and up
+ * to 4 registers.
  *
- * @return  Start-up control information.
- * @retval  01b Start initialization immediately
- * @retval  others Wait until initialization is explicit started
+ * @param[in,out]   job         Responder job
+ * @param[out]      txMessage   Response frame
  */
-static inline uint8_t   vscp_core_getStartUpControl(void)
+static void vscp_core_buildExtPageReadRsp(RspJob * const job, vscp_TxMessage * const txMessage)
 {
-    return (vscp_ps_readNodeControlFlags() >> 6) & 0x03;
+    uint8_t     num         = VSCP_L1_DATA_SIZE - 4;
+    uint16_t    pageRemain  = 0x100 - job->addr;
+
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->vscpType     = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
+    txMessage->priority     = VSCP_PRIORITY_7_LOW;
+    txMessage->oAddr        = vscp_core_nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+
+    /* Sequence number */
+    txMessage->data[0] = job->seq;
+
+    /* Page and offset */
+    txMessage->data[1] = (job->page >> 8) & 0xff;
+    txMessage->data[2] = (job->page >> 0) & 0xff;
+    txMessage->data[3] = job->addr;
+
+    /* Limit to the number of registers, which are still to read. */
+    if (job->count < num)
+    {
+        num = (uint8_t)job->count;
+    }
+
+    /* If the read takes place on the next page, a new event shall be used,
+     * because the event parameter contains the page, where all read
+     * registers are located.
+     */
+    if (pageRemain <= num)
+    {
+        num = (uint8_t)pageRemain;
+    }
+
+    /* Read registers */
+    vscp_core_readRegisters(job->page, job->addr, &txMessage->data[4], num);
+
+    /* Set event data size */
+    txMessage->dataSize = 4 + num;
+
+    /* Continue on the next page? */
+    if (pageRemain <= num)
+    {
+        ++job->page;
+    }
+
+    job->addr   += num;
+    job->count  -= num;
+    ++job->seq;
+
+    return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
 /**
- * Get application register write protection information.
+ * This function builds the next get embedded MDF response.
+ * Every response contains the frame index and up to 6 byte of the MDF. The
+ * page of the job is used as frame index and the count as number of frames.
+ * If no embedded MDF is available, a response with a single zero is sent.
  *
- * @return  Write protection information
- * @retval  0 Write protected
- * @retval  1 Write enabled
+ * @param[in,out]   job         Responder job
+ * @param[out]      txMessage   Response frame
  */
-static inline uint8_t   vscp_core_getRegAppWriteProtect(void)
+static void vscp_core_buildEmbeddedMdfRsp(RspJob * const job, vscp_TxMessage * const txMessage)
 {
-    return (vscp_ps_readNodeControlFlags() >> 5) & 0x01;
+    uint16_t    offset  = job->page * (VSCP_L1_DATA_SIZE - 2);
+    uint8_t     num     = 0;
+
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->vscpType     = VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE;
+    txMessage->priority     = VSCP_PRIORITY_7_LOW;
+    txMessage->oAddr        = vscp_core_nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+
+    /* Frame index */
+    txMessage->data[0] = (job->page >> 8) & 0xff;
+    txMessage->data[1] = (job->page >> 0) & 0xff;
+
+    if (0 == vscp_mdf_getSize())
+    {
+        txMessage->data[2] = 0;
+        num = 1;
+    }
+    else
+    {
+        num = vscp_mdf_read(offset, &txMessage->data[2], VSCP_L1_DATA_SIZE - 2);
+    }
+
+    txMessage->dataSize = 2 + num;
+
+    ++job->page;
+    --job->count;
+
+    return;
 }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
@@ -46,17 +46,31 @@ This module contains the core functionality of VSCP.
  *
  * Supported compile switches:
  * - VSCP_CONFIG_ENABLE_LOGGER
+ * - VSCP_CONFIG_ENABLE_LOGGER_BUFFER
+ * - VSCP_CONFIG_ENABLE_PERF_PROBES
+ * - VSCP_CONFIG_ENABLE_STATS
  * - VSCP_CONFIG_SILENT_NODE
  * - VSCP_CONFIG_HARD_CODED_NODE
  * - VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT
  * - VSCP_CONFIG_HEARTBEAT_NODE
+ * - VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER
  * - VSCP_CONFIG_IDLE_CALLOUT
  * - VSCP_CONFIG_ERROR_CALLOUT
  * - VSCP_CONFIG_BOOT_LOADER_SUPPORTED
+ * - VSCP_CONFIG_BOOT_LOADER_ENGINE
  * - VSCP_CONFIG_ENABLE_DM
  * - VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION
  * - VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT
  * - VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION
+ * - VSCP_CONFIG_ENABLE_BULK_WRITE
+ * - VSCP_CONFIG_ENABLE_NICKNAME_MAP
+ * - VSCP_CONFIG_ENABLE_NICKNAME_GUID_START
+ * - VSCP_CONFIG_ENABLE_NODE_TABLE
+ * - VSCP_CONFIG_ENABLE_TIME_SERVICE
+ * - VSCP_CONFIG_ENABLE_RX_TIMESTAMP
+ * - VSCP_CONFIG_ENABLE_L2
+ * - VSCP_CONFIG_ENABLE_EMBEDDED_MDF
+ * - VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER
  *
  * @{
  */
@@ -104,6 +118,33 @@ extern "C"
 /** VSCP framework version string */
 #define VSCP_CORE_FRAMEWORK_VERSION "v2.3.0"
 
+/** Bulk configuration write: Memory type in the start block event, which
+ * starts a bulk configuration write session instead of a boot loader block
+ * transfer. Memory types above 3 are user defined.
+ */
+#define VSCP_CORE_BULK_WRITE_MEM_TYPE       (0x80)
+
+/** Bulk configuration write error: Invalid page, offset or length */
+#define VSCP_CORE_BULK_WRITE_ERR_INVALID    (0x01)
+
+/** Bulk configuration write error: No session started */
+#define VSCP_CORE_BULK_WRITE_ERR_NO_SESSION (0x02)
+
+/** Bulk configuration write error: Unexpected sequence number */
+#define VSCP_CORE_BULK_WRITE_ERR_SEQUENCE   (0x03)
+
+/** Bulk configuration write error: More data received than announced */
+#define VSCP_CORE_BULK_WRITE_ERR_OVERFLOW   (0x04)
+
+/** Bulk configuration write error: Commit before all data was received */
+#define VSCP_CORE_BULK_WRITE_ERR_INCOMPLETE (0x05)
+
+/** Bulk configuration write error: CRC mismatch */
+#define VSCP_CORE_BULK_WRITE_ERR_CRC        (0x06)
+
+/** Bulk configuration write error: At least one register is not writeable */
+#define VSCP_CORE_BULK_WRITE_ERR_WRITE      (0x07)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
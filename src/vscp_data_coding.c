@@ -41,6 +41,8 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_data_coding.h"
+#include "vscp_util.h"
+#include "vscp_class_l1.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -50,6 +52,12 @@
     CONSTANTS
 *******************************************************************************/
 
+/** Data offset in CLASS1.MEASUREMENT and CLASS1.DATA events. */
+#define VSCP_DATA_CODING_OFFSET_MEASUREMENT     (0)
+
+/** Data offset in CLASS1.MEASUREZONE and CLASS1.SETVALUEZONE events (after index, zone and sub-zone). */
+#define VSCP_DATA_CODING_OFFSET_ZONE            (3)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -58,16 +66,42 @@
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/* The floating point representation is IEEE-754 single precision. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_DATA_CODING_FLOATING_POINT_SIZE == sizeof(float));
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
 static inline uint8_t vscp_data_coding_getNormalizerByte(uint8_t sign, uint8_t magnitude);
+static BOOL vscp_data_coding_decodeNormalizedInteger(uint8_t const * const codedData, uint8_t codedDataSize, int64_t* const data, int8_t* const exp);
+static inline uint8_t vscp_data_coding_getUnsignedSize(uint32_t data);
+static inline uint8_t vscp_data_coding_getSignedSize(int32_t data);
+static uint8_t vscp_data_coding_writeBigEndian(uint32_t data, uint8_t size, uint8_t * const codedData, uint8_t codedDataSize);
+static uint64_t vscp_data_coding_readBigEndian(uint8_t const * const codedData, uint8_t codedDataSize, BOOL isSigned);
+static double vscp_data_coding_getPow10(uint8_t magnitude);
+static void vscp_data_coding_stripTrailingZeros(int32_t* const data, int8_t* const exp);
 
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
+/**
+ * Powers of ten 10^(2^n), used to calculate 10^exp by binary decomposition of
+ * the exponent. Greater powers than 10^32 are not used, because they are not
+ * representable on every platform (e.g. double is 32 bit on AVR).
+ */
+static const double vscp_data_coding_pow10Tbl[] =
+{
+    1e1, 1e2, 1e4, 1e8, 1e16, 1e32
+};
+
+/** Powers of ten 10^n, which fit into a 32 bit value. */
+static const uint32_t vscp_data_coding_pow10Int32Tbl[] =
+{
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -105,6 +139,39 @@ extern uint8_t vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION re
     return formatByte;
 }
 
+/**
+ * This function returns the data representation from the format byte.
+ *
+ * @param[in]   formatByte  Format byte
+ * @return Data representation
+ */
+extern VSCP_DATA_CODING_REPRESENTATION vscp_data_coding_getRepresentation(uint8_t formatByte)
+{
+    return (VSCP_DATA_CODING_REPRESENTATION)((formatByte >> 5) & 0x07);
+}
+
+/**
+ * This function returns the unit from the format byte.
+ *
+ * @param[in]   formatByte  Format byte
+ * @return Unit of the data
+ */
+extern uint8_t vscp_data_coding_getUnit(uint8_t formatByte)
+{
+    return (formatByte >> 3) & 0x03;
+}
+
+/**
+ * This function returns the sensor index from the format byte.
+ *
+ * @param[in]   formatByte  Format byte
+ * @return Sensor index
+ */
+extern uint8_t vscp_data_coding_getIndex(uint8_t formatByte)
+{
+    return (formatByte >> 0) & 0x07;
+}
+
 /**
  * This function returns the data in the normalized integer format.
  * Note, there is not format byte at the head of the coded data. This is
@@ -212,17 +279,346 @@ extern uint8_t vscp_data_coding_int32ToNormalizedInteger(int32_t data, int8_t ex
 }
 
 /**
- * This function returns the normalized integer format in integer form.
- * Note, there is shall not be a format byte at the head of the coded data.
+ * This function returns the data in the shortest normalized integer format.
+ * Trailing decimal zeros of the data value are removed and the exponent is
+ * adjusted accordingly, e.g. 21500 * 10^-3 is coded as 215 * 10^-1.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToNormalizedIntegerShortest(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    vscp_data_coding_stripTrailingZeros(&data, &exp);
+
+    return vscp_data_coding_int32ToNormalizedInteger(data, exp, codedData, codedDataSize);
+}
+
+/**
+ * This function returns the floating point value in the shortest normalized
+ * integer format. The value is rounded to the given number of decimal places.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * - 21.5,   precision 3 => data = 215,  exp = -1
+ * - 21.456, precision 2 => data = 2146, exp = -2
+ *
+ * @param[in]       data            The data value
+ * @param[in]       precision       Number of required decimal places
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_doubleToNormalizedInteger(double data, uint8_t precision, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    double  scaled  = 0.0;
+
+    /* The exponent magnitude is limited to 7 bit. */
+    if (0x7f < precision)
+    {
+        return 0;
+    }
+
+    /* Round half away from zero */
+    scaled = data * vscp_data_coding_getPow10(precision);
+    scaled = (0.0 > scaled) ? (scaled - 0.5) : (scaled + 0.5);
+
+    /* Doesn't fit into 32 bit or is not a number */
+    if (!((double)INT32_MIN <= scaled) ||
+        !((double)INT32_MAX >= scaled))
+    {
+        return 0;
+    }
+
+    return vscp_data_coding_int32ToNormalizedIntegerShortest((int32_t)scaled, -(int8_t)precision, codedData, codedDataSize);
+}
+
+/**
+ * This function returns the data in the bit format. Only the necessary
+ * number of bytes is used, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The bits
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_uint32ToBit(uint32_t data, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    return vscp_data_coding_writeBigEndian(data, vscp_data_coding_getUnsignedSize(data), codedData, codedDataSize);
+}
+
+/**
+ * This function returns the data in the byte format. Only the necessary
+ * number of bytes is used, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The data value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_uint32ToByte(uint32_t data, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    return vscp_data_coding_writeBigEndian(data, vscp_data_coding_getUnsignedSize(data), codedData, codedDataSize);
+}
+
+/**
+ * This function returns the data in the signed integer format. Only the
+ * necessary number of bytes is used, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The data value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToInteger(int32_t data, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    return vscp_data_coding_writeBigEndian((uint32_t)data, vscp_data_coding_getSignedSize(data), codedData, codedDataSize);
+}
+
+/**
+ * This function returns the data in the string format, which is a ASCII
+ * numerical string without string termination.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * -   11, exp =  0 => "11"
+ * -  -22, exp = -1 => "-2.2"
+ * -   33, exp =  1 => "330"
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToString(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    uint8_t     digits[10];     /* Max. number of digits of a 32 bit value, in reverse order */
+    uint8_t     digitCnt        = 0;
+    uint32_t    dataMagnitude   = (0 > data) ? (0 - (uint32_t)data) : (uint32_t)data;
+    uint8_t     fractionDigits  = (0 > exp) ? (uint8_t)(-exp) : 0;
+    uint8_t     trailingZeros   = (0 < exp) ? (uint8_t)exp : 0;
+    uint8_t     leadingZeros    = 0;
+    uint8_t     neededSize      = 0;
+    uint8_t     codedDataIndex  = 0;
+
+    if (NULL == codedData)
+    {
+        return 0;
+    }
+
+    do
+    {
+        digits[digitCnt] = '0' + (uint8_t)(dataMagnitude % 10);
+        dataMagnitude /= 10;
+        ++digitCnt;
+    }
+    while(0 < dataMagnitude);
+
+    /* Value less than 1 needs a leading "0." and maybe further zeros after the decimal point. */
+    if (digitCnt <= fractionDigits)
+    {
+        leadingZeros = fractionDigits - digitCnt + 1;
+    }
+
+    /* Calculate needed coded data size */
+    neededSize = ((0 > data) ? 1 : 0) + leadingZeros + digitCnt + trailingZeros + ((0 < fractionDigits) ? 1 : 0);
+
+    /* Check given coded data size */
+    if (codedDataSize < neededSize)
+    {
+        /* Abort */
+        return 0;
+    }
+
+    if (0 > data)
+    {
+        codedData[codedDataIndex] = '-';
+        ++codedDataIndex;
+    }
+
+    /* Value less than 1? */
+    if (0 < leadingZeros)
+    {
+        codedData[codedDataIndex] = '0';
+        ++codedDataIndex;
+        --leadingZeros;
+
+        codedData[codedDataIndex] = '.';
+        ++codedDataIndex;
+
+        while(0 < leadingZeros)
+        {
+            codedData[codedDataIndex] = '0';
+            ++codedDataIndex;
+            --leadingZeros;
+        }
+    }
+
+    while(0 < digitCnt)
+    {
+        --digitCnt;
+        codedData[codedDataIndex] = digits[digitCnt];
+        ++codedDataIndex;
+
+        /* Decimal point before the fraction digits */
+        if ((0 < fractionDigits) &&
+            (0 < digitCnt) &&
+            (fractionDigits == digitCnt))
+        {
+            codedData[codedDataIndex] = '.';
+            ++codedDataIndex;
+        }
+    }
+
+    while(0 < trailingZeros)
+    {
+        codedData[codedDataIndex] = '0';
+        ++codedDataIndex;
+        --trailingZeros;
+    }
+
+    return codedDataIndex;
+}
+
+/**
+ * This function returns the data in the IEEE-754 single precision floating
+ * point format, MSB first.
+ * Note, there is not format byte at the head of the coded data.
  *
+ * @param[in]       data            The data value
  * @param[in,out]   codedData       The coded data array
  * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_floatToFloatingPoint(float data, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    union
+    {
+        float       value;
+        uint32_t    raw;
+
+    } floatingPoint;
+
+    floatingPoint.value = data;
+
+    return vscp_data_coding_writeBigEndian(floatingPoint.raw, VSCP_DATA_CODING_FLOATING_POINT_SIZE, codedData, codedDataSize);
+}
+
+/**
+ * This function returns the data with leading format byte in the most compact
+ * representation. Depended on the value, it will be coded as signed integer,
+ * byte or normalized integer. A normalized integer is coded in its shortest
+ * form.
+ *
  * @param[in]       data            The data value
  * @param[in]       exp             The data exponent
+ * @param[in]       unit            The unit of the data
+ * @param[in]       index           Sensor index
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size, including the format byte
+ */
+extern uint8_t vscp_data_coding_encodeCompact(int32_t data, int8_t exp, uint8_t unit, uint8_t index, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    VSCP_DATA_CODING_REPRESENTATION representation  = VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER;
+    uint8_t                         size            = 0;
+    int32_t                         value           = data;
+    uint8_t                         neededSize      = 0;
+
+    if ((NULL == codedData) ||
+        (0 == codedDataSize))
+    {
+        return 0;
+    }
+
+    vscp_data_coding_stripTrailingZeros(&data, &exp);
+
+    /* Zero is zero with any exponent, therefore it is coded without normalizer byte. */
+    if (0 == data)
+    {
+        exp = 0;
+    }
+
+    value = data;
+
+    /* Normalized integer: normalizer byte + signed data value */
+    neededSize = 1 + vscp_data_coding_getSignedSize(data);
+
+    /* Without fraction digits the value might be sent without normalizer byte. */
+    if ((0 <= exp) &&
+        (VSCP_UTIL_ARRAY_NUM(vscp_data_coding_pow10Int32Tbl) > (uint8_t)exp))
+    {
+        int64_t scaled  = (int64_t)data * vscp_data_coding_pow10Int32Tbl[exp];
+
+        if ((INT32_MIN <= scaled) &&
+            (INT32_MAX >= scaled))
+        {
+            value = (int32_t)scaled;
+
+            if (neededSize > vscp_data_coding_getSignedSize(value))
+            {
+                representation  = VSCP_DATA_CODING_REPRESENTATION_INTEGER;
+                neededSize      = vscp_data_coding_getSignedSize(value);
+            }
+
+            /* A positive value may need one byte less without sign bit. */
+            if ((0 <= value) &&
+                (neededSize > vscp_data_coding_getUnsignedSize((uint32_t)value)))
+            {
+                representation  = VSCP_DATA_CODING_REPRESENTATION_BYTE;
+                neededSize      = vscp_data_coding_getUnsignedSize((uint32_t)value);
+            }
+        }
+    }
+
+    codedData[0] = vscp_data_coding_getFormatByte(representation, unit, index);
+
+    switch(representation)
+    {
+    case VSCP_DATA_CODING_REPRESENTATION_INTEGER:
+        size = vscp_data_coding_int32ToInteger(value, &codedData[1], codedDataSize - 1);
+        break;
+
+    case VSCP_DATA_CODING_REPRESENTATION_BYTE:
+        size = vscp_data_coding_uint32ToByte((uint32_t)value, &codedData[1], codedDataSize - 1);
+        break;
+
+    default:
+        size = vscp_data_coding_int32ToNormalizedInteger(data, exp, &codedData[1], codedDataSize - 1);
+        break;
+    }
+
+    /* Coding failed? */
+    if (0 == size)
+    {
+        return 0;
+    }
+
+    return 1 + size;
+}
+
+/**
+ * This function returns the normalized integer format in integer form.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ * Values which don't fit into 32 bit are not supported, in this case data
+ * and exponent will be 0.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
  */
 extern void vscp_data_coding_normalizedIntegerToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp)
 {
-    uint8_t codedDataIndex  = 0;
+    int64_t value       = 0;
+    int8_t  valueExp    = 0;
 
     if ((NULL == data) ||
         (NULL == exp))
@@ -230,82 +626,441 @@ extern void vscp_data_coding_normalizedIntegerToInt32(uint8_t const * const code
         return;
     }
 
-    *data = 0;
-    *exp  = 0;
+    /* More than 32 bit values are not supported */
+    if ((5 >= codedDataSize) &&
+        (TRUE == vscp_data_coding_decodeNormalizedInteger(codedData, codedDataSize, &value, &valueExp)))
+    {
+        *data = (int32_t)value;
+        *exp  = valueExp;
+    }
+    else
+    {
+        *data = 0;
+        *exp  = 0;
+    }
+
+    return;
+}
+
+/**
+ * This function returns the normalized integer format in 64 bit integer form.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_normalizedIntegerToInt64(uint8_t const * const codedData, uint8_t codedDataSize, int64_t* const data, int8_t* const exp)
+{
+    BOOL    status  = FALSE;
 
-    if ((1 > codedDataSize) ||  /* Invalid */
-        (5 < codedDataSize))    /* More than 32 bit values are not supported */
+    if ((NULL != data) &&
+        (NULL != exp))
     {
-        return;
+        status = vscp_data_coding_decodeNormalizedInteger(codedData, codedDataSize, data, exp);
     }
 
-    /* Build exponent */
-    *exp = (int8_t)(codedData[codedDataIndex] & 0x7f);
-    if (0 != (codedData[codedDataIndex] & 0x80))
+    return status;
+}
+
+/**
+ * This function returns the normalized integer format as floating point value.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  value           The value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_normalizedIntegerToDouble(uint8_t const * const codedData, uint8_t codedDataSize, double* const value)
+{
+    BOOL    status  = FALSE;
+    int64_t data    = 0;
+    int8_t  exp     = 0;
+
+    if ((NULL != value) &&
+        (TRUE == vscp_data_coding_decodeNormalizedInteger(codedData, codedDataSize, &data, &exp)))
     {
-        *exp *= -1;
+        *value = vscp_data_coding_toDouble(data, exp);
+        status = TRUE;
     }
-    ++codedDataIndex;
 
-    /* 8 bit signed value? */
-    if (2 == codedDataSize)
+    return status;
+}
+
+/**
+ * This function returns the bit format as unsigned integer.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The bits
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_bitToUint64(uint8_t const * const codedData, uint8_t codedDataSize, uint64_t* const data)
+{
+    return vscp_data_coding_byteToUint64(codedData, codedDataSize, data);
+}
+
+/**
+ * This function returns the byte format as unsigned integer.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_byteToUint64(uint8_t const * const codedData, uint8_t codedDataSize, uint64_t* const data)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != codedData) &&
+        (NULL != data) &&
+        (0 < codedDataSize) &&
+        (sizeof(uint64_t) >= codedDataSize))
     {
-        *data = ((int32_t)codedData[codedDataIndex]) << 0;
-        ++codedDataIndex;
+        *data   = vscp_data_coding_readBigEndian(codedData, codedDataSize, FALSE);
+        status  = TRUE;
     }
-    /* 16 bit signed value? */
-    else if (3 == codedDataSize)
+
+    return status;
+}
+
+/**
+ * This function returns the signed integer format as integer.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_integerToInt64(uint8_t const * const codedData, uint8_t codedDataSize, int64_t* const data)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != codedData) &&
+        (NULL != data) &&
+        (0 < codedDataSize) &&
+        (sizeof(int64_t) >= codedDataSize))
     {
-        *data = ((int32_t)codedData[codedDataIndex]) << 8;
-        ++codedDataIndex;
+        *data   = (int64_t)vscp_data_coding_readBigEndian(codedData, codedDataSize, TRUE);
+        status  = TRUE;
+    }
 
-        *data |= ((int32_t)codedData[codedDataIndex]) << 0;
+    return status;
+}
+
+/**
+ * This function returns the string format as integer with exponent.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_stringToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp)
+{
+    BOOL        status          = TRUE;
+    uint8_t     codedDataIndex  = 0;
+    BOOL        isNegative      = FALSE;
+    BOOL        isFraction      = FALSE;
+    uint8_t     digitCnt        = 0;
+    uint32_t    value           = 0;
+    uint32_t    valueMax        = INT32_MAX;
+    int8_t      valueExp        = 0;
+
+    if ((NULL == codedData) ||
+        (NULL == data) ||
+        (NULL == exp))
+    {
+        return FALSE;
+    }
+
+    /* Sign */
+    if ((0 < codedDataSize) &&
+        (('-' == codedData[0]) || ('+' == codedData[0])))
+    {
+        isNegative = ('-' == codedData[0]) ? TRUE : FALSE;
         ++codedDataIndex;
     }
-    /* 24 bit signed value? */
-    else if (4 == codedDataSize)
+
+    /* The smallest negative value has no positive counterpart. */
+    if (TRUE == isNegative)
+    {
+        valueMax = (uint32_t)INT32_MAX + 1u;
+    }
+
+    /* The string may be terminated before the end of the coded data. */
+    while((TRUE == status) &&
+          (codedDataSize > codedDataIndex) &&
+          ('\0' != codedData[codedDataIndex]))
     {
-        /* Handle sign bit */
-        if (0 != (codedData[codedDataIndex] & 0x80))
+        uint8_t character = codedData[codedDataIndex];
+
+        if (('.' == character) &&
+            (FALSE == isFraction))
+        {
+            isFraction = TRUE;
+        }
+        else if (('0' <= character) &&
+                 ('9' >= character) &&
+                 (((valueMax - (uint32_t)(character - '0')) / 10) >= value))
         {
-            *data = (int32_t)0xff000000;
+            value = (value * 10) + (character - '0');
+            ++digitCnt;
+
+            if (TRUE == isFraction)
+            {
+                --valueExp;
+            }
         }
         else
         {
-            *data = 0;
+            status = FALSE;
         }
 
-        *data |= ((int32_t)codedData[codedDataIndex]) << 16;
         ++codedDataIndex;
+    }
 
-        *data |= ((int32_t)codedData[codedDataIndex]) <<  8;
-        ++codedDataIndex;
+    if ((TRUE == status) &&
+        (0 < digitCnt))
+    {
+        if (INT32_MAX < value)
+        {
+            *data = INT32_MIN;
+        }
+        else
+        {
+            *data = (TRUE == isNegative) ? -(int32_t)value : (int32_t)value;
+        }
 
-        *data |= ((int32_t)codedData[codedDataIndex]) <<  0;
-        ++codedDataIndex;
+        *exp = valueExp;
+    }
+    else
+    {
+        status = FALSE;
     }
-    /* 32 bit signed value? */
-    else if (5 == codedDataSize)
+
+    return status;
+}
+
+/**
+ * This function returns the IEEE-754 single precision floating point format
+ * as floating point value.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_floatingPointToFloat(uint8_t const * const codedData, uint8_t codedDataSize, float* const data)
+{
+    BOOL    status  = FALSE;
+    union
     {
-        *data  = ((int32_t)codedData[codedDataIndex]) << 24;
-        ++codedDataIndex;
+        float       value;
+        uint32_t    raw;
 
-        *data |= ((int32_t)codedData[codedDataIndex]) << 16;
-        ++codedDataIndex;
+    } floatingPoint;
 
-        *data |= ((int32_t)codedData[codedDataIndex]) <<  8;
-        ++codedDataIndex;
+    if ((NULL != codedData) &&
+        (NULL != data) &&
+        (VSCP_DATA_CODING_FLOATING_POINT_SIZE == codedDataSize))
+    {
+        floatingPoint.raw   = (uint32_t)vscp_data_coding_readBigEndian(codedData, codedDataSize, FALSE);
+        *data               = floatingPoint.value;
+        status              = TRUE;
+    }
 
-        *data |= ((int32_t)codedData[codedDataIndex]) <<  0;
-        ++codedDataIndex;
+    return status;
+}
+
+/**
+ * This function calculates data * 10^exp. It uses a power of ten table
+ * instead of the pow() function of the math library.
+ *
+ * @param[in]   data    The data value
+ * @param[in]   exp     The data exponent (base 10)
+ * @return Value
+ */
+extern double vscp_data_coding_toDouble(int64_t data, int8_t exp)
+{
+    double  factor  = vscp_data_coding_getPow10((0 > exp) ? (uint8_t)(-exp) : (uint8_t)exp);
+
+    /* Division keeps the result exact for negative exponents, because e.g. 10^-1 is not representable. */
+    return (0 > exp) ? ((double)data / factor) : ((double)data * factor);
+}
+
+/**
+ * This function decodes the coded data, which starts with a format byte.
+ * Representation, unit and sensor index are taken from the format byte.
+ *
+ * Supported representations:
+ * - Bit
+ * - Byte
+ * - String
+ * - Integer
+ * - Normalized integer
+ * - Floating point
+ *
+ * @param[in]   codedData       The coded data array, starting with the format byte
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  value           The decoded value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_decode(uint8_t const * const codedData, uint8_t codedDataSize, vscp_data_coding_Value * const value)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == codedData) ||
+        (NULL == value) ||
+        (0 == codedDataSize))
+    {
+        return FALSE;
+    }
+
+    value->representation   = vscp_data_coding_getRepresentation(codedData[0]);
+    value->unit             = vscp_data_coding_getUnit(codedData[0]);
+    value->index            = vscp_data_coding_getIndex(codedData[0]);
+    value->data             = 0;
+    value->exp              = 0;
+    value->floatingPoint    = 0.0f;
+
+    switch(value->representation)
+    {
+    case VSCP_DATA_CODING_REPRESENTATION_BIT:
+        /*@fallthrough@*/
+    case VSCP_DATA_CODING_REPRESENTATION_BYTE:
+        {
+            uint64_t    data    = 0;
+
+            status = vscp_data_coding_byteToUint64(&codedData[1], codedDataSize - 1, &data);
+            value->data = (int64_t)data;
+        }
+        break;
+
+    case VSCP_DATA_CODING_REPRESENTATION_STRING:
+        {
+            int32_t data    = 0;
+
+            status = vscp_data_coding_stringToInt32(&codedData[1], codedDataSize - 1, &data, &value->exp);
+            value->data = data;
+        }
+        break;
+
+    case VSCP_DATA_CODING_REPRESENTATION_INTEGER:
+        status = vscp_data_coding_integerToInt64(&codedData[1], codedDataSize - 1, &value->data);
+        break;
+
+    case VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER:
+        status = vscp_data_coding_decodeNormalizedInteger(&codedData[1], codedDataSize - 1, &value->data, &value->exp);
+        break;
+
+    case VSCP_DATA_CODING_REPRESENTATION_FLOATING_POINT:
+        status = vscp_data_coding_floatingPointToFloat(&codedData[1], codedDataSize - 1, &value->floatingPoint);
+        break;
+
+    default:
+        /* Not supported */
+        break;
+    }
+
+    return status;
+}
+
+/**
+ * This function returns the decoded value as floating point value,
+ * independent of its representation.
+ *
+ * @param[in]   value   The decoded value
+ * @return Value
+ */
+extern double vscp_data_coding_valueToDouble(vscp_data_coding_Value const * const value)
+{
+    double  result  = 0.0;
+
+    if (NULL == value)
+    {
+        return 0.0;
+    }
+
+    if (VSCP_DATA_CODING_REPRESENTATION_FLOATING_POINT == value->representation)
+    {
+        result = value->floatingPoint;
     }
-    /* Error or not supported */
     else
     {
-        ;
+        result = vscp_data_coding_toDouble(value->data, value->exp);
     }
 
-    return;
+    return result;
+}
+
+/**
+ * This function decodes several received measurement events at once.
+ * Supported are events of the classes CLASS1.MEASUREMENT, CLASS1.DATA,
+ * CLASS1.MEASUREZONE and CLASS1.SETVALUEZONE. Every event, which can not be
+ * decoded, is marked as invalid in the corresponding measurement.
+ *
+ * @param[in]   msgs            Array of received events
+ * @param[in]   num             Number of received events
+ * @param[out]  measurements    Array of measurements, same size as the event array
+ * @return Number of valid decoded measurements
+ */
+extern uint8_t vscp_data_coding_decodeMeasurements(vscp_RxMessage const * const msgs, uint8_t num, vscp_data_coding_Measurement * const measurements)
+{
+    uint8_t validCnt    = 0;
+    uint8_t index       = 0;
+
+    if ((NULL == msgs) ||
+        (NULL == measurements))
+    {
+        return 0;
+    }
+
+    for(index = 0; index < num; ++index)
+    {
+        vscp_RxMessage const * const    msg         = &msgs[index];
+        vscp_data_coding_Measurement*   measurement = &measurements[index];
+        uint8_t                         offset      = VSCP_DATA_CODING_OFFSET_MEASUREMENT;
+
+        measurement->isValid    = FALSE;
+        measurement->vscpClass  = msg->vscpClass;
+        measurement->vscpType   = msg->vscpType;
+        measurement->oAddr      = msg->oAddr;
+
+        if ((VSCP_CLASS_L1_MEASUREZONE == msg->vscpClass) ||
+            (VSCP_CLASS_L1_SETVALUEZONE == msg->vscpClass))
+        {
+            offset = VSCP_DATA_CODING_OFFSET_ZONE;
+        }
+        else if ((VSCP_CLASS_L1_MEASUREMENT != msg->vscpClass) &&
+                 (VSCP_CLASS_L1_DATA != msg->vscpClass))
+        {
+            /* Not supported */
+            continue;
+        }
+
+        if ((offset < msg->dataSize) &&
+            (VSCP_L1_DATA_SIZE >= msg->dataSize))
+        {
+            measurement->isValid = vscp_data_coding_decode(&msg->data[offset], msg->dataSize - offset, &measurement->value);
+
+            if (TRUE == measurement->isValid)
+            {
+                ++validCnt;
+            }
+        }
+    }
+
+    return validCnt;
 }
 
 /*******************************************************************************
@@ -328,3 +1083,182 @@ static inline uint8_t vscp_data_coding_getNormalizerByte(uint8_t sign, uint8_t m
 
     return normalizerByte;
 }
+
+/**
+ * This function decodes a normalized integer, without leading format byte.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_data_coding_decodeNormalizedInteger(uint8_t const * const codedData, uint8_t codedDataSize, int64_t* const data, int8_t* const exp)
+{
+    BOOL        status      = FALSE;
+    uint64_t    value       = 0;
+    uint8_t     magnitude   = 0;
+
+    if ((NULL == codedData) ||
+        (2 > codedDataSize) ||  /* Normalizer byte and at least one data byte */
+        (VSCP_DATA_CODING_NORMALIZED_INTEGER_SIZE_MAX < codedDataSize))
+    {
+        return FALSE;
+    }
+
+    value       = vscp_data_coding_readBigEndian(&codedData[1], codedDataSize - 1, TRUE);
+    magnitude   = codedData[0] & 0x7f;
+
+    *data   = (int64_t)value;
+    *exp    = (0 != (codedData[0] & 0x80)) ? -(int8_t)magnitude : (int8_t)magnitude;
+    status  = TRUE;
+
+    return status;
+}
+
+/**
+ * This function returns the number of bytes, which are necessary to code a
+ * unsigned value.
+ *
+ * @param[in]   data    The data value
+ * @return Number of bytes
+ */
+static inline uint8_t vscp_data_coding_getUnsignedSize(uint32_t data)
+{
+    uint8_t size    = 1;
+
+    while((4 > size) &&
+          (0 != (data >> (size * 8))))
+    {
+        ++size;
+    }
+
+    return size;
+}
+
+/**
+ * This function returns the number of bytes, which are necessary to code a
+ * signed value in two's complement.
+ *
+ * @param[in]   data    The data value
+ * @return Number of bytes
+ */
+static inline uint8_t vscp_data_coding_getSignedSize(int32_t data)
+{
+    /* The inverted negative value has the same number of significant bits as the positive one. */
+    uint32_t    magnitude   = (0 > data) ? ~(uint32_t)data : (uint32_t)data;
+
+    /* One additional bit for the sign. */
+    return vscp_data_coding_getUnsignedSize(magnitude << 1);
+}
+
+/**
+ * This function writes the data in big endian byte order (MSB first).
+ *
+ * @param[in]       data            The data value
+ * @param[in]       size            Number of bytes to write
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+static uint8_t vscp_data_coding_writeBigEndian(uint32_t data, uint8_t size, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    uint8_t index   = 0;
+
+    if ((NULL == codedData) ||
+        (codedDataSize < size))
+    {
+        return 0;
+    }
+
+    for(index = 0; index < size; ++index)
+    {
+        codedData[index] = (uint8_t)((data >> ((size - index - 1) * 8)) & 0xff);
+    }
+
+    return size;
+}
+
+/**
+ * This function reads data in big endian byte order (MSB first).
+ * A signed value is sign extended from its most significant byte,
+ * independent of the number of bytes.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array (1 - 8)
+ * @param[in]   isSigned        Data is a signed value or not
+ * @return Data value
+ */
+static uint64_t vscp_data_coding_readBigEndian(uint8_t const * const codedData, uint8_t codedDataSize, BOOL isSigned)
+{
+    uint64_t    value   = 0;
+    uint8_t     index   = 0;
+
+    /* Sign extension */
+    if ((TRUE == isSigned) &&
+        (0 != (codedData[0] & 0x80)))
+    {
+        value = UINT64_MAX;
+    }
+
+    for(index = 0; index < codedDataSize; ++index)
+    {
+        value = (value << 8) | codedData[index];
+    }
+
+    return value;
+}
+
+/**
+ * This function returns 10^magnitude. It uses a power of ten table instead
+ * of the pow() function of the math library.
+ *
+ * @param[in]   magnitude   Exponent magnitude
+ * @return 10^magnitude
+ */
+static double vscp_data_coding_getPow10(uint8_t magnitude)
+{
+    double  factor  = 1.0;
+    uint8_t index   = 0;
+
+    /* 10^magnitude = product of all 10^(2^n), whose bit n is set in the magnitude. */
+    for(index = 0; index < VSCP_UTIL_ARRAY_NUM(vscp_data_coding_pow10Tbl); ++index)
+    {
+        if (0 != (magnitude & (1 << index)))
+        {
+            factor *= vscp_data_coding_pow10Tbl[index];
+        }
+    }
+
+    /* Remaining bits are multiples of 10^64. */
+    magnitude >>= VSCP_UTIL_ARRAY_NUM(vscp_data_coding_pow10Tbl);
+    while(0 < magnitude)
+    {
+        factor *= vscp_data_coding_pow10Tbl[VSCP_UTIL_ARRAY_NUM(vscp_data_coding_pow10Tbl) - 1];
+        factor *= vscp_data_coding_pow10Tbl[VSCP_UTIL_ARRAY_NUM(vscp_data_coding_pow10Tbl) - 1];
+        --magnitude;
+    }
+
+    return factor;
+}
+
+/**
+ * This function removes the trailing decimal zeros of the data value and
+ * adjusts the exponent accordingly. The value itself doesn't change.
+ *
+ * @param[in,out]   data    The data value
+ * @param[in,out]   exp     The data exponent
+ */
+static void vscp_data_coding_stripTrailingZeros(int32_t* const data, int8_t* const exp)
+{
+    /* The exponent magnitude is limited to 7 bit in the normalizer byte. */
+    while((0 != *data) &&
+          (0 == (*data % 10)) &&
+          (0x7f > *exp))
+    {
+        *data /= 10;
+        ++(*exp);
+    }
+
+    return;
+}
@@ -68,6 +68,12 @@ extern "C"
     CONSTANTS
 *******************************************************************************/
 
+/** Max. size of a normalized integer in byte (normalizer byte + 64 bit value). */
+#define VSCP_DATA_CODING_NORMALIZED_INTEGER_SIZE_MAX    (9)
+
+/** Size of a floating point value in byte (IEEE-754 single precision). */
+#define VSCP_DATA_CODING_FLOATING_POINT_SIZE            (4)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -90,6 +96,29 @@ typedef enum
 
 } VSCP_DATA_CODING_REPRESENTATION;
 
+/** This type contains a decoded value, which was coded with a leading format byte. */
+typedef struct
+{
+    VSCP_DATA_CODING_REPRESENTATION representation; /**< Data representation */
+    uint8_t                         unit;           /**< Unit of the data */
+    uint8_t                         index;          /**< Sensor index */
+    int64_t                         data;           /**< Data value */
+    int8_t                          exp;            /**< Data exponent (base 10) */
+    float                           floatingPoint;  /**< Floating point value (only floating point representation) */
+
+} vscp_data_coding_Value;
+
+/** This type contains a decoded measurement, received via event. */
+typedef struct
+{
+    BOOL                    isValid;    /**< Measurement is valid or not */
+    uint16_t                vscpClass;  /**< VSCP class of the received event */
+    uint8_t                 vscpType;   /**< VSCP type of the received event */
+    uint8_t                 oAddr;      /**< Nickname of the sender */
+    vscp_data_coding_Value  value;      /**< Decoded value */
+
+} vscp_data_coding_Measurement;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -113,6 +142,30 @@ extern void vscp_data_coding_init(void);
  */
 extern uint8_t vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION representation, uint8_t unit, uint8_t index);
 
+/**
+ * This function returns the data representation from the format byte.
+ *
+ * @param[in]   formatByte  Format byte
+ * @return Data representation
+ */
+extern VSCP_DATA_CODING_REPRESENTATION vscp_data_coding_getRepresentation(uint8_t formatByte);
+
+/**
+ * This function returns the unit from the format byte.
+ *
+ * @param[in]   formatByte  Format byte
+ * @return Unit of the data
+ */
+extern uint8_t vscp_data_coding_getUnit(uint8_t formatByte);
+
+/**
+ * This function returns the sensor index from the format byte.
+ *
+ * @param[in]   formatByte  Format byte
+ * @return Sensor index
+ */
+extern uint8_t vscp_data_coding_getIndex(uint8_t formatByte);
+
 /**
  * This function returns the data in the normalized integer format.
  * Note, there is not format byte at the head of the coded data. This is
@@ -135,16 +188,262 @@ extern uint8_t vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION re
 extern uint8_t vscp_data_coding_int32ToNormalizedInteger(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize);
 
 /**
- * This function returns the normalized integer format in integer form.
- * Note, there is shall not be a format byte at the head of the coded data.
+ * This function returns the data in the shortest normalized integer format.
+ * Trailing decimal zeros of the data value are removed and the exponent is
+ * adjusted accordingly, e.g. 21500 * 10^-3 is coded as 215 * 10^-1.
+ * Note, there is not format byte at the head of the coded data.
  *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
  * @param[in,out]   codedData       The coded data array
  * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToNormalizedIntegerShortest(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the floating point value in the shortest normalized
+ * integer format. The value is rounded to the given number of decimal places.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * - 21.5,   precision 3 => data = 215,  exp = -1
+ * - 21.456, precision 2 => data = 2146, exp = -2
+ *
+ * @param[in]       data            The data value
+ * @param[in]       precision       Number of required decimal places
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_doubleToNormalizedInteger(double data, uint8_t precision, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the data in the bit format. Only the necessary
+ * number of bytes is used, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The bits
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_uint32ToBit(uint32_t data, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the data in the byte format. Only the necessary
+ * number of bytes is used, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The data value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_uint32ToByte(uint32_t data, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the data in the signed integer format. Only the
+ * necessary number of bytes is used, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The data value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToInteger(int32_t data, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the data in the string format, which is a ASCII
+ * numerical string without string termination.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * -   11, exp =  0 => "11"
+ * -  -22, exp = -1 => "-2.2"
+ * -   33, exp =  1 => "330"
+ *
  * @param[in]       data            The data value
  * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToString(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the data in the IEEE-754 single precision floating
+ * point format, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       data            The data value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_floatToFloatingPoint(float data, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the data with leading format byte in the most compact
+ * representation. Depended on the value, it will be coded as signed integer,
+ * byte or normalized integer. A normalized integer is coded in its shortest
+ * form.
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in]       unit            The unit of the data
+ * @param[in]       index           Sensor index
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size, including the format byte
+ */
+extern uint8_t vscp_data_coding_encodeCompact(int32_t data, int8_t exp, uint8_t unit, uint8_t index, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the bit format as unsigned integer.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The bits
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_bitToUint64(uint8_t const * const codedData, uint8_t codedDataSize, uint64_t* const data);
+
+/**
+ * This function returns the byte format as unsigned integer.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_byteToUint64(uint8_t const * const codedData, uint8_t codedDataSize, uint64_t* const data);
+
+/**
+ * This function returns the signed integer format as integer.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_integerToInt64(uint8_t const * const codedData, uint8_t codedDataSize, int64_t* const data);
+
+/**
+ * This function returns the string format as integer with exponent.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_stringToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp);
+
+/**
+ * This function returns the IEEE-754 single precision floating point format
+ * as floating point value.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_floatingPointToFloat(uint8_t const * const codedData, uint8_t codedDataSize, float* const data);
+
+/**
+ * This function returns the normalized integer format in integer form.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ * Values which don't fit into 32 bit are not supported, in this case data
+ * and exponent will be 0.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
  */
 extern void vscp_data_coding_normalizedIntegerToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp);
 
+/**
+ * This function returns the normalized integer format in 64 bit integer form.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_normalizedIntegerToInt64(uint8_t const * const codedData, uint8_t codedDataSize, int64_t* const data, int8_t* const exp);
+
+/**
+ * This function returns the normalized integer format as floating point value.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  value           The value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_normalizedIntegerToDouble(uint8_t const * const codedData, uint8_t codedDataSize, double* const value);
+
+/**
+ * This function calculates data * 10^exp. It uses a power of ten table
+ * instead of the pow() function of the math library.
+ *
+ * @param[in]   data    The data value
+ * @param[in]   exp     The data exponent (base 10)
+ * @return Value
+ */
+extern double vscp_data_coding_toDouble(int64_t data, int8_t exp);
+
+/**
+ * This function decodes the coded data, which starts with a format byte.
+ * Representation, unit and sensor index are taken from the format byte.
+ *
+ * Supported representations:
+ * - Bit
+ * - Byte
+ * - String
+ * - Integer
+ * - Normalized integer
+ * - Floating point
+ *
+ * @param[in]   codedData       The coded data array, starting with the format byte
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  value           The decoded value
+ * @return If successful decoded, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_data_coding_decode(uint8_t const * const codedData, uint8_t codedDataSize, vscp_data_coding_Value * const value);
+
+/**
+ * This function returns the decoded value as floating point value,
+ * independent of its representation.
+ *
+ * @param[in]   value   The decoded value
+ * @return Value
+ */
+extern double vscp_data_coding_valueToDouble(vscp_data_coding_Value const * const value);
+
+/**
+ * This function decodes several received measurement events at once.
+ * Supported are events of the classes CLASS1.MEASUREMENT, CLASS1.DATA,
+ * CLASS1.MEASUREZONE and CLASS1.SETVALUEZONE. Every event, which can not be
+ * decoded, is marked as invalid in the corresponding measurement.
+ *
+ * @param[in]   msgs            Array of received events
+ * @param[in]   num             Number of received events
+ * @param[out]  measurements    Array of measurements, same size as the event array
+ * @return Number of valid decoded measurements
+ */
+extern uint8_t vscp_data_coding_decodeMeasurements(vscp_RxMessage const * const msgs, uint8_t num, vscp_data_coding_Measurement * const measurements);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,6 +45,8 @@
 #include "vscp_util.h"
 #include "vscp_dev_data.h"
 #include "vscp_ps.h"
+#include "vscp_stats.h"
+#include "vscp_filter.h"
 
 #include <stddef.h>
 
@@ -153,14 +155,17 @@ static void vscp_dm_readDecisionMatrixExt(vscp_dm_ExtRow * const row, uint8_t ro
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
 
 static BOOL vscp_dm_isDecisionMatrixPagedFeature(uint16_t page, uint8_t addr);
+static BOOL vscp_dm_getRegisterRangePagedFeature(uint16_t page, uint8_t * const first, uint8_t * const last);
 static uint8_t  vscp_dm_readRegisterPagedFeature(uint16_t page, uint8_t addr);
 static uint8_t  vscp_dm_writeRegisterPagedFeature(uint16_t page, uint8_t addr, uint8_t value);
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
 
 static BOOL vscp_dm_isDecisionMatrixStd(uint16_t page, uint8_t addr);
+static BOOL vscp_dm_getRegisterRangeStd(uint16_t page, uint8_t * const first, uint8_t * const last);
 static uint8_t  vscp_dm_readRegisterStd(uint16_t page, uint8_t addr);
 static uint8_t  vscp_dm_writeRegisterStd(uint16_t page, uint8_t addr, uint8_t value);
+static void vscp_dm_readRegistersStd(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
 
 static BOOL vscp_dm_calculateMatrixIndex(uint8_t* index, uint8_t* offset, uint16_t page, uint8_t addr);
 
@@ -323,6 +328,71 @@ extern uint8_t  vscp_dm_writeRegister(uint16_t page, uint8_t addr, uint8_t value
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
 }
 
+/**
+ * Get the range of the decision matrix registers in the given page.
+ *
+ * @param[in]   page    Page
+ * @param[out]  first   Address of the first decision matrix register
+ * @param[out]  last    Address of the last decision matrix register
+ * @return  Page contains decision matrix registers or not.
+ * @retval  FALSE   Page contains no decision matrix registers.
+ * @retval  TRUE    Page contains decision matrix registers.
+ */
+extern BOOL vscp_dm_getRegisterRange(uint16_t page, uint8_t * const first, uint8_t * const last)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != first) &&
+        (NULL != last))
+    {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
+
+        status = vscp_dm_getRegisterRangePagedFeature(page, first, last);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
+        status = vscp_dm_getRegisterRangeStd(page, first, last);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+    }
+
+    return status;
+}
+
+/**
+ * Read several registers of the decision matrix. All of them shall be in the
+ * range, which is provided by vscp_dm_getRegisterRange().
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers to read
+ */
+extern void vscp_dm_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    if (NULL == buffer)
+    {
+        return;
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < num; ++index)
+        {
+            buffer[index] = vscp_dm_readRegisterPagedFeature(page, addr + index);
+        }
+    }
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
+    vscp_dm_readRegistersStd(page, addr, buffer, num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
+    return;
+}
+
 /**
  * This function check the decision matrix and executes their actions if
  * applicable.
@@ -373,6 +443,8 @@ extern void vscp_dm_executeActions(vscp_RxMessage const * const msg)
             continue;
         }
 
+        VSCP_STATS_INC(VSCP_STATS_CNT_DM_ROWS);
+
         /* Check originating address? */
         if (0 != (row.flags & VSCP_DM_FLAG_CHECK_OADDR))
         {
@@ -563,17 +635,23 @@ extern void vscp_dm_executeActions(vscp_RxMessage const * const msg)
             }
 
             /* Execute action */
+            VSCP_STATS_INC(VSCP_STATS_CNT_DM_MATCHES);
+            VSCP_STATS_INC(VSCP_STATS_CNT_ACTIONS);
             vscp_action_execute(extRow.action, extRow.actionPar, msg);
         }
         else
         {
             /* Execute action */
+            VSCP_STATS_INC(VSCP_STATS_CNT_DM_MATCHES);
+            VSCP_STATS_INC(VSCP_STATS_CNT_ACTIONS);
             vscp_action_execute(row.action, row.actionPar, msg);
         }
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
         /* Execute action */
+        VSCP_STATS_INC(VSCP_STATS_CNT_DM_MATCHES);
+        VSCP_STATS_INC(VSCP_STATS_CNT_ACTIONS);
         vscp_action_execute(row.action, row.actionPar, msg);
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
@@ -582,6 +660,80 @@ extern void vscp_dm_executeActions(vscp_RxMessage const * const msg)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function gets the acceptance filter of a decision matrix row, which
+ * passes every event the row may trigger on.
+ *
+ * @param[in]   rowIndex    Row index
+ * @param[out]  filter      Acceptance filter
+ *
+ * @return Filter available or not
+ * @retval FALSE    Row is disabled or has no action
+ * @retval TRUE     Filter available
+ */
+extern BOOL vscp_dm_getAcceptanceFilter(uint8_t rowIndex, vscp_AcceptanceFilter * const filter)
+{
+    vscp_dm_MatrixRow   row         = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    uint16_t            classMask   = 0;
+    uint16_t            classFilter = 0;
+
+    if ((NULL == filter) ||
+        (VSCP_CONFIG_DM_ROWS <= rowIndex))
+    {
+        return FALSE;
+    }
+
+    if (FALSE == vscp_dm_isDecisionMatrixRowEnabled(rowIndex))
+    {
+        return FALSE;
+    }
+
+    vscp_dm_readDecisionMatrix(&row, rowIndex);
+
+    if (VSCP_DM_ACTION_NO_OPERATION == row.action)
+    {
+        return FALSE;
+    }
+
+    /* Build class mask and filter */
+    classMask   = row.classMask;
+
+    if (0 != (row.flags & VSCP_DM_FLAG_CLASS_MASK_BIT8))
+    {
+        classMask |= (uint16_t)0x0100;
+    }
+
+    classFilter = row.classFilter;
+
+    if (0 != (row.flags & VSCP_DM_FLAG_CLASS_FILTER_BIT8))
+    {
+        classFilter |= (uint16_t)0x0100;
+    }
+
+    filter->mask    = VSCP_FILTER_CLASS(classMask) | VSCP_FILTER_TYPE(row.typeMask);
+    filter->id      = VSCP_FILTER_CLASS(classFilter) | VSCP_FILTER_TYPE(row.typeFilter);
+
+    if (0 != (row.flags & VSCP_DM_FLAG_CHECK_OADDR))
+    {
+        filter->mask    |= VSCP_FILTER_OADDR(0xFF);
+        filter->id      |= VSCP_FILTER_OADDR(row.oaddr);
+    }
+
+    if (0 != (row.flags & VSCP_DM_FLAG_HARDCODED))
+    {
+        filter->mask    |= VSCP_FILTER_HARD_CODED;
+        filter->id      |= VSCP_FILTER_HARD_CODED;
+    }
+
+    filter->id &= filter->mask;
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -671,6 +823,30 @@ static inline BOOL vscp_dm_isDecisionMatrixPagedFeature(uint16_t page, uint8_t a
     return status;
 }
 
+/**
+ * Get the range of the decision matrix registers in the given page.
+ *
+ * @param[in]   page    Page
+ * @param[out]  first   Address of the first decision matrix register
+ * @param[out]  last    Address of the last decision matrix register
+ * @return  Page contains decision matrix registers or not.
+ * @retval  FALSE   Page contains no decision matrix registers.
+ * @retval  TRUE    Page contains decision matrix registers.
+ */
+static inline BOOL vscp_dm_getRegisterRangePagedFeature(uint16_t page, uint8_t * const first, uint8_t * const last)
+{
+    BOOL    status  = FALSE;
+
+    if (0 == page)
+    {
+        *first = VSCP_DM_PAGED_INDEX;
+        *last  = VSCP_DM_PAGED_VALUE;
+        status = TRUE;
+    }
+
+    return status;
+}
+
 /**
  * Read register and return its value.
  *
@@ -767,6 +943,34 @@ static inline uint8_t   vscp_dm_writeRegisterPagedFeature(uint16_t page, uint8_t
  * @retval  TRUE    Is part of the decision matrix.
  */
 static inline BOOL vscp_dm_isDecisionMatrixStd(uint16_t page, uint8_t addr)
+{
+    BOOL    status  = FALSE;
+    uint8_t first   = 0;
+    uint8_t last    = 0;
+
+    if (TRUE == vscp_dm_getRegisterRangeStd(page, &first, &last))
+    {
+        if ((first <= addr) &&
+            (last >= addr))
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Get the range of the decision matrix registers in the given page.
+ *
+ * @param[in]   page    Page
+ * @param[out]  first   Address of the first decision matrix register
+ * @param[out]  last    Address of the last decision matrix register
+ * @return  Page contains decision matrix registers or not.
+ * @retval  FALSE   Page contains no decision matrix registers.
+ * @retval  TRUE    Page contains decision matrix registers.
+ */
+static inline BOOL vscp_dm_getRegisterRangeStd(uint16_t page, uint8_t * const first, uint8_t * const last)
 {
     BOOL    status  = FALSE;
 
@@ -776,36 +980,34 @@ static inline BOOL vscp_dm_isDecisionMatrixStd(uint16_t page, uint8_t addr)
         /* Page is equal to the first decision matrix page? */
         if (VSCP_DM_START_PAGE == page)
         {
-            /* Address is greater or equal than the decision matrix offset? */
-            if (VSCP_DM_START_OFFSET <= addr)
+            *first = VSCP_DM_START_OFFSET;
+
+            /* Decision matrix spans more than one page? */
+            if (VSCP_DM_START_PAGE < VSCP_DM_LAST_PAGE)
             {
-                /* Decision matrix spans more than one page? */
-                if (VSCP_DM_START_PAGE < VSCP_DM_LAST_PAGE)
-                {
-                    status = TRUE;
-                }
-                /* Decision matrix has only one page.
-                 * Is the address lower or equal than the last decision matrix offset?
-                 */
-                else if (VSCP_DM_LAST_OFFSET >= addr)
-                {
-                    status = TRUE;
-                }
+                *last = 0xFF;
+            }
+            /* Decision matrix has only one page. */
+            else
+            {
+                *last = VSCP_DM_LAST_OFFSET;
             }
+
+            status = TRUE;
         }
         /* Page is equal to the last decision matrix page? */
         else if (VSCP_DM_LAST_PAGE == page)
         {
-            /* Address is lower or equal than the last decision matrix offset? */
-            if (VSCP_DM_START_OFFSET >= addr)
-            {
-                status = TRUE;
-            }
+            *first = 0x00;
+            *last  = VSCP_DM_START_OFFSET;
+            status = TRUE;
         }
         /* Page is between first and last decision matrix page? */
         else if ((VSCP_DM_START_PAGE < page) &&
                  (VSCP_DM_LAST_PAGE > page))
         {
+            *first = 0x00;
+            *last  = 0xFF;
             status = TRUE;
         }
     }
@@ -864,6 +1066,44 @@ static inline uint8_t   vscp_dm_writeRegisterStd(uint16_t page, uint8_t addr, ui
     return value;
 }
 
+/**
+ * Read several registers of the decision matrix, which are all in the same
+ * page.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers to read
+ */
+static inline void vscp_dm_readRegistersStd(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t rowIndex    = 0;
+    uint8_t rowOffset   = 0;
+    uint8_t index       = 0;
+
+    /* The registers of a page are consecutive in the persistent memory,
+     * therefore the index is calculated only once.
+     */
+    if (TRUE == vscp_dm_calculateMatrixIndex(&rowIndex, &rowOffset, page, addr))
+    {
+        uint16_t    psIndex = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow) + (uint16_t)rowOffset;
+
+        for(index = 0; index < num; ++index)
+        {
+            buffer[index] = vscp_ps_readDM(psIndex + index);
+        }
+    }
+    else
+    {
+        for(index = 0; index < num; ++index)
+        {
+            buffer[index] = 0;
+        }
+    }
+
+    return;
+}
+
 /**
  * This function calculates the row index and offset in the decision matrix,
  * according to the given page and address.
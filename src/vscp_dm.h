@@ -252,6 +252,29 @@ extern uint8_t  vscp_dm_readRegister(uint16_t page, uint8_t addr);
  */
 extern uint8_t  vscp_dm_writeRegister(uint16_t page, uint8_t addr, uint8_t value);
 
+/**
+ * Get the range of the decision matrix registers in the given page.
+ *
+ * @param[in]   page    Page
+ * @param[out]  first   Address of the first decision matrix register
+ * @param[out]  last    Address of the last decision matrix register
+ * @return  Page contains decision matrix registers or not.
+ * @retval  FALSE   Page contains no decision matrix registers.
+ * @retval  TRUE    Page contains decision matrix registers.
+ */
+extern BOOL vscp_dm_getRegisterRange(uint16_t page, uint8_t * const first, uint8_t * const last);
+
+/**
+ * Read several registers of the decision matrix. All of them shall be in the
+ * range, which is provided by vscp_dm_getRegisterRange().
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers to read
+ */
+extern void vscp_dm_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+
 /**
  * This function check the decision matrix and executes their actions if
  * applicable.
@@ -260,6 +283,23 @@ extern uint8_t  vscp_dm_writeRegister(uint16_t page, uint8_t addr, uint8_t value
  */
 extern void vscp_dm_executeActions(vscp_RxMessage const * const msg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function gets the acceptance filter of a decision matrix row, which
+ * passes every event the row may trigger on.
+ *
+ * @param[in]   rowIndex    Row index
+ * @param[out]  filter      Acceptance filter
+ *
+ * @return Filter available or not
+ * @retval FALSE    Row is disabled or has no action
+ * @retval TRUE     Filter available
+ */
+extern BOOL vscp_dm_getAcceptanceFilter(uint8_t rowIndex, vscp_AcceptanceFilter * const filter);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
 #ifdef __cplusplus
@@ -44,6 +44,7 @@
 #include "vscp_util.h"
 #include "vscp_action.h"
 #include "vscp_ps.h"
+#include "vscp_stats.h"
 #include <stdint.h>
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
@@ -299,6 +300,78 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
     return value;
 }
 
+/**
+ * Get the range of the decision matrix registers in the given page.
+ *
+ * @param[in]   page    Page
+ * @param[out]  first   Address of the first decision matrix register
+ * @param[out]  last    Address of the last decision matrix register
+ * @return  Page contains decision matrix registers or not.
+ * @retval  FALSE   Page contains no decision matrix registers.
+ * @retval  TRUE    Page contains decision matrix registers.
+ */
+extern BOOL vscp_dm_ng_getRegisterRange(uint16_t page, uint8_t * const first, uint8_t * const last)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != first) &&
+        (NULL != last) &&
+        (0 < VSCP_CONFIG_DM_NG_RULE_SET_SIZE))
+    {
+        /* Page is inside? */
+        if ((VSCP_DM_NG_START_PAGE <= page) &&
+            (VSCP_DM_NG_LAST_PAGE >= page))
+        {
+            *first = 0x00;
+
+            /* Page is equal to the last decision matrix NG page? */
+            if (VSCP_DM_NG_LAST_PAGE == page)
+            {
+                *last = VSCP_DM_NG_LAST_PAGE_OFFSET;
+            }
+            else
+            {
+                *last = 0xFF;
+            }
+
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Read several registers of the decision matrix. All of them shall be in the
+ * range, which is provided by vscp_dm_ng_getRegisterRange().
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers to read
+ */
+extern void vscp_dm_ng_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t     index   = 0;
+    uint16_t    psIndex = 0;
+
+    if ((NULL == buffer) ||
+        (VSCP_DM_NG_START_PAGE > page))
+    {
+        return;
+    }
+
+    /* The rule set is consecutive in the persistent memory. */
+    psIndex = (page - VSCP_DM_NG_START_PAGE) * 256 + addr;
+
+    for(index = 0; index < num; ++index)
+    {
+        buffer[index] = vscp_ps_readDMNextGeneration(psIndex + index);
+    }
+
+    return;
+}
+
 /**
  * This function process all configured rules and if any action regarding the
  * received message takes place, it will call the corresponding action.
@@ -351,6 +424,8 @@ extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
              */
             if (VSCP_DM_NG_ACTION_NO_OPERATION != actionId)
             {
+                VSCP_STATS_INC(VSCP_STATS_CNT_DM_NG_RULES);
+
                 /* Get the decision result. Note, the decision result is the
                  * same as the condition result or the combination of several
                  * condition results.
@@ -359,6 +434,8 @@ extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
 
                 if (TRUE == decisionResult)
                 {
+                    VSCP_STATS_INC(VSCP_STATS_CNT_DM_NG_MATCHES);
+                    VSCP_STATS_INC(VSCP_STATS_CNT_ACTIONS);
                     vscp_action_execute(actionId, actionPar, rxMsg);
                 }
             }
@@ -402,6 +479,23 @@ extern BOOL vscp_dm_ng_getError(uint8_t * const rule, uint8_t * const pos)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function checks whether the rule set is empty.
+ *
+ * @return Empty or not
+ * @retval FALSE    Rule set contains rules
+ * @retval TRUE     Rule set is empty
+ */
+extern BOOL vscp_dm_ng_isRuleSetEmpty(void)
+{
+    /* The first byte contains the number of rules. */
+    return (0 == vscp_ps_readDMNextGeneration(0)) ? TRUE : FALSE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
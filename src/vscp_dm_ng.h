@@ -211,6 +211,29 @@ extern uint8_t  vscp_dm_ng_readRegister(uint16_t page, uint8_t addr);
  */
 extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t value);
 
+/**
+ * Get the range of the decision matrix registers in the given page.
+ *
+ * @param[in]   page    Page
+ * @param[out]  first   Address of the first decision matrix register
+ * @param[out]  last    Address of the last decision matrix register
+ * @return  Page contains decision matrix registers or not.
+ * @retval  FALSE   Page contains no decision matrix registers.
+ * @retval  TRUE    Page contains decision matrix registers.
+ */
+extern BOOL vscp_dm_ng_getRegisterRange(uint16_t page, uint8_t * const first, uint8_t * const last);
+
+/**
+ * Read several registers of the decision matrix. All of them shall be in the
+ * range, which is provided by vscp_dm_ng_getRegisterRange().
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers to read
+ */
+extern void vscp_dm_ng_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+
 /**
  * This function process all configured rules and if any action regarding the
  * received message takes place, it will call the corresponding action.
@@ -219,6 +242,19 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
  */
 extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function checks whether the rule set is empty.
+ *
+ * @return Empty or not
+ * @retval FALSE    Rule set contains rules
+ * @retval TRUE     Rule set is empty
+ */
+extern BOOL vscp_dm_ng_isRuleSetEmpty(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
 
 /**
@@ -0,0 +1,485 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP acceptance filter
+@file   vscp_filter.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_filter.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_filter.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+#include <stddef.h>
+#include "vscp_transport.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_information.h"
+#include "vscp_dm.h"
+#include "vscp_dm_ng.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Mask of the whole class */
+#define VSCP_FILTER_MASK_CLASS          VSCP_FILTER_CLASS(0x01FF)
+
+/** Mask of the whole type */
+#define VSCP_FILTER_MASK_TYPE           VSCP_FILTER_TYPE(0x00FF)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static uint8_t vscp_filter_add(vscp_AcceptanceFilter * const filters, uint8_t num, uint8_t max, uint32_t id, uint32_t mask);
+static BOOL vscp_filter_covers(vscp_AcceptanceFilter const * const filter, vscp_AcceptanceFilter const * const other);
+static uint8_t vscp_filter_remove(vscp_AcceptanceFilter * const filters, uint8_t num, uint8_t index);
+static uint8_t vscp_filter_removeCovered(vscp_AcceptanceFilter * const filters, uint8_t num, vscp_AcceptanceFilter const * const filter);
+static void vscp_filter_merge(vscp_AcceptanceFilter * const merged, vscp_AcceptanceFilter const * const filter, vscp_AcceptanceFilter const * const other);
+static uint8_t vscp_filter_countBits(uint32_t value);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Subscriptions of the application */
+static vscp_AcceptanceFilter    vscp_filter_subscriptions[VSCP_CONFIG_ACCEPTANCE_SUBSCRIPTION_NUM];
+
+/** Number of subscriptions */
+static uint8_t                  vscp_filter_subscriptionNum = 0;
+
+/** Calculated acceptance filters */
+static vscp_AcceptanceFilter    vscp_filter_filters[VSCP_CONFIG_ACCEPTANCE_FILTER_NUM];
+
+/** Are the programmed filters outdated? */
+static BOOL                     vscp_filter_isOutdated      = TRUE;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module. All subscriptions are removed and
+ * the filters will be programmed with the next vscp_filter_process() call.
+ */
+extern void vscp_filter_init(void)
+{
+    vscp_filter_subscriptionNum = 0;
+    vscp_filter_isOutdated      = TRUE;
+
+    return;
+}
+
+/**
+ * This function subscribes the application to events. A set bit in the
+ * mask means, that the corresponding bit of the class or type shall match.
+ *
+ * @param[in]   vscpClass   Class
+ * @param[in]   classMask   Class mask (0: any class)
+ * @param[in]   vscpType    Type
+ * @param[in]   typeMask    Type mask (0: any type)
+ *
+ * @return Subscribed or not
+ * @retval FALSE    No subscription available anymore
+ * @retval TRUE     Subscribed
+ */
+extern BOOL vscp_filter_subscribe(uint16_t vscpClass, uint16_t classMask, uint8_t vscpType, uint8_t typeMask)
+{
+    vscp_AcceptanceFilter * subscription    = NULL;
+
+    if (VSCP_CONFIG_ACCEPTANCE_SUBSCRIPTION_NUM <= vscp_filter_subscriptionNum)
+    {
+        return FALSE;
+    }
+
+    subscription = &vscp_filter_subscriptions[vscp_filter_subscriptionNum];
+
+    subscription->mask  = VSCP_FILTER_CLASS(classMask) | VSCP_FILTER_TYPE(typeMask);
+    subscription->id    = (VSCP_FILTER_CLASS(vscpClass) | VSCP_FILTER_TYPE(vscpType)) & subscription->mask;
+
+    ++vscp_filter_subscriptionNum;
+    vscp_filter_isOutdated = TRUE;
+
+    return TRUE;
+}
+
+/**
+ * This function removes all subscriptions of the application.
+ */
+extern void vscp_filter_unsubscribeAll(void)
+{
+    vscp_filter_subscriptionNum = 0;
+    vscp_filter_isOutdated      = TRUE;
+
+    return;
+}
+
+/**
+ * This function marks the filters as outdated, e.g. after the decision
+ * matrix was changed. They will be calculated again and programmed with
+ * the next vscp_filter_process() call.
+ */
+extern void vscp_filter_invalidate(void)
+{
+    vscp_filter_isOutdated = TRUE;
+
+    return;
+}
+
+/**
+ * This function calculates the minimal set of acceptance filters.
+ *
+ * @param[out]  filters Filter buffer
+ * @param[in]   num     Number of filters, the buffer can hold
+ *
+ * @return Number of calculated filters
+ */
+extern uint8_t vscp_filter_calculate(vscp_AcceptanceFilter * const filters, uint8_t num)
+{
+    uint8_t filterNum   = 0;
+    uint8_t index       = 0;
+
+    if ((NULL == filters) ||
+        (0 == num))
+    {
+        return 0;
+    }
+
+    /* The protocol class is always necessary. */
+    filterNum = vscp_filter_add(filters, filterNum, num, VSCP_FILTER_CLASS(VSCP_CLASS_L1_PROTOCOL), VSCP_FILTER_MASK_CLASS);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    /* The other nodes are seen by their heartbeat. */
+    filterNum = vscp_filter_add(filters, filterNum, num,
+                                VSCP_FILTER_CLASS(VSCP_CLASS_L1_INFORMATION) | VSCP_FILTER_TYPE(VSCP_TYPE_INFORMATION_NODE_HEARTBEAT),
+                                VSCP_FILTER_MASK_CLASS | VSCP_FILTER_MASK_TYPE);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
+
+    /* The logger is controlled by log events. */
+    filterNum = vscp_filter_add(filters, filterNum, num, VSCP_FILTER_CLASS(VSCP_CLASS_L1_LOG), VSCP_FILTER_MASK_CLASS);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    for(index = 0; index < VSCP_CONFIG_DM_ROWS; ++index)
+    {
+        vscp_AcceptanceFilter   rowFilter   = { 0, 0 };
+
+        if (FALSE != vscp_dm_getAcceptanceFilter(index, &rowFilter))
+        {
+            filterNum = vscp_filter_add(filters, filterNum, num, rowFilter.id, rowFilter.mask);
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    /* The rules of the decision matrix next generation may match any event. */
+    if (FALSE == vscp_dm_ng_isRuleSetEmpty())
+    {
+        filterNum = vscp_filter_add(filters, filterNum, num, 0, 0);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    for(index = 0; index < vscp_filter_subscriptionNum; ++index)
+    {
+        filterNum = vscp_filter_add(filters, filterNum, num, vscp_filter_subscriptions[index].id, vscp_filter_subscriptions[index].mask);
+    }
+
+    return filterNum;
+}
+
+/**
+ * This function calculates the filters and programs them via the transport
+ * layer, in case they are outdated. It will be called by the VSCP core.
+ */
+extern void vscp_filter_process(void)
+{
+    if (FALSE != vscp_filter_isOutdated)
+    {
+        uint8_t num = vscp_filter_calculate(vscp_filter_filters, VSCP_CONFIG_ACCEPTANCE_FILTER_NUM);
+
+        vscp_transport_setAcceptanceFilters(vscp_filter_filters, num);
+
+        vscp_filter_isOutdated = FALSE;
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function adds a filter to the set. Filters, which are covered by
+ * another one, are removed. If the set is full, the pair of filters is
+ * merged, whose merged mask keeps the most bits.
+ *
+ * @param[in,out]   filters Filter set
+ * @param[in]       num     Number of filters in the set
+ * @param[in]       max     Max. number of filters in the set
+ * @param[in]       id      Identifier of the new filter
+ * @param[in]       mask    Mask of the new filter
+ *
+ * @return Number of filters in the set
+ */
+static uint8_t vscp_filter_add(vscp_AcceptanceFilter * const filters, uint8_t num, uint8_t max, uint32_t id, uint32_t mask)
+{
+    vscp_AcceptanceFilter   filter  = { 0, 0 };
+    BOOL                    isAdded = FALSE;
+
+    filter.id   = id & mask;
+    filter.mask = mask;
+
+    while(FALSE == isAdded)
+    {
+        uint8_t index       = 0;
+        BOOL    isCovered   = FALSE;
+
+        for(index = 0; (index < num) && (FALSE == isCovered); ++index)
+        {
+            isCovered = vscp_filter_covers(&filters[index], &filter);
+        }
+
+        if (FALSE != isCovered)
+        {
+            isAdded = TRUE;
+        }
+        else
+        {
+            num = vscp_filter_removeCovered(filters, num, &filter);
+
+            if (max > num)
+            {
+                filters[num] = filter;
+                ++num;
+
+                isAdded = TRUE;
+            }
+            /* Merge the pair, which loses the least mask bits.
+             * Index num stands for the new filter.
+             */
+            else
+            {
+                vscp_AcceptanceFilter   merged      = { 0, 0 };
+                vscp_AcceptanceFilter   candidate   = { 0, 0 };
+                uint8_t                 bestBits    = 0;
+                uint8_t                 bestFirst   = 0;
+                uint8_t                 bestSecond  = 0;
+                uint8_t                 first       = 0;
+                uint8_t                 second      = 0;
+
+                for(first = 0; first < num; ++first)
+                {
+                    for(second = first + 1; second <= num; ++second)
+                    {
+                        uint8_t bits    = 0;
+
+                        vscp_filter_merge(&candidate, &filters[first], (num == second) ? &filter : &filters[second]);
+                        bits = vscp_filter_countBits(candidate.mask);
+
+                        if (((0 == first) && (1 == second)) ||
+                            (bestBits < bits))
+                        {
+                            merged      = candidate;
+                            bestBits    = bits;
+                            bestFirst   = first;
+                            bestSecond  = second;
+                        }
+                    }
+                }
+
+                /* The new filter is part of the merged one? */
+                if (num == bestSecond)
+                {
+                    num = vscp_filter_remove(filters, num, bestFirst);
+                }
+                /* Keep the new filter in the set, the merged one is added
+                 * next, which removes it again, if it is covered.
+                 */
+                else
+                {
+                    num = vscp_filter_remove(filters, num, bestSecond);
+                    num = vscp_filter_remove(filters, num, bestFirst);
+
+                    filters[num] = filter;
+                    ++num;
+                }
+
+                filter = merged;
+            }
+        }
+    }
+
+    return num;
+}
+
+/**
+ * This function checks whether a filter passes every event, which the other
+ * filter passes.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   other   Other filter
+ *
+ * @return Other filter covered or not
+ * @retval FALSE    Not covered
+ * @retval TRUE     Covered
+ */
+static BOOL vscp_filter_covers(vscp_AcceptanceFilter const * const filter, vscp_AcceptanceFilter const * const other)
+{
+    BOOL    isCovered   = FALSE;
+
+    if ((0 == (filter->mask & ~other->mask)) &&
+        (0 == ((filter->id ^ other->id) & filter->mask)))
+    {
+        isCovered = TRUE;
+    }
+
+    return isCovered;
+}
+
+/**
+ * This function removes a filter from the set.
+ *
+ * @param[in,out]   filters Filter set
+ * @param[in]       num     Number of filters in the set
+ * @param[in]       index   Index of the filter, which to remove
+ *
+ * @return Number of filters in the set
+ */
+static uint8_t vscp_filter_remove(vscp_AcceptanceFilter * const filters, uint8_t num, uint8_t index)
+{
+    --num;
+
+    for(; index < num; ++index)
+    {
+        filters[index] = filters[index + 1];
+    }
+
+    return num;
+}
+
+/**
+ * This function removes all filters from the set, which are covered by the
+ * given filter.
+ *
+ * @param[in,out]   filters Filter set
+ * @param[in]       num     Number of filters in the set
+ * @param[in]       filter  Filter
+ *
+ * @return Number of filters in the set
+ */
+static uint8_t vscp_filter_removeCovered(vscp_AcceptanceFilter * const filters, uint8_t num, vscp_AcceptanceFilter const * const filter)
+{
+    uint8_t index   = 0;
+
+    while(index < num)
+    {
+        if (FALSE != vscp_filter_covers(filter, &filters[index]))
+        {
+            num = vscp_filter_remove(filters, num, index);
+        }
+        else
+        {
+            ++index;
+        }
+    }
+
+    return num;
+}
+
+/**
+ * This function merges two filters to the filter, which passes the events
+ * of both.
+ *
+ * @param[out]  merged  Merged filter
+ * @param[in]   filter  Filter
+ * @param[in]   other   Other filter
+ */
+static void vscp_filter_merge(vscp_AcceptanceFilter * const merged, vscp_AcceptanceFilter const * const filter, vscp_AcceptanceFilter const * const other)
+{
+    merged->mask    = filter->mask & other->mask & ~(filter->id ^ other->id);
+    merged->id      = filter->id & merged->mask;
+
+    return;
+}
+
+/**
+ * This function counts the set bits.
+ *
+ * @param[in]   value   Value
+ *
+ * @return Number of set bits
+ */
+static uint8_t vscp_filter_countBits(uint32_t value)
+{
+    uint8_t bits    = 0;
+
+    while(0 != value)
+    {
+        value &= value - 1;
+        ++bits;
+    }
+
+    return bits;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
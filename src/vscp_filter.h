@@ -0,0 +1,184 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP acceptance filter
+@file   vscp_filter.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module calculates the CAN acceptance filters of the node.
+
+*******************************************************************************/
+/** @defgroup vscp_filter VSCP acceptance filter
+ * Without acceptance filters every event on the bus is received and handled
+ * by the VSCP core, which costs CPU time on a busy segment. This module
+ * calculates the minimal set of acceptance filters, which pass every event
+ * the node needs:
+ * - The protocol class.
+ * - The node heartbeat, in case the node table or the nickname map is used.
+ * - The log class, in case the logger is used.
+ * - The events of all enabled decision matrix rows with an action.
+ * - Every event, in case the decision matrix next generation contains rules.
+ * - The events, which the application subscribed.
+ *
+ * If the transport adapter supports less filters than necessary, the filters
+ * are merged. A merged filter passes more events than necessary, but never
+ * less. The pair of filters, whose merged filter keeps the most mask bits, is
+ * merged first.
+ *
+ * The filters are calculated again by vscp_filter_process() after the
+ * decision matrix or the subscriptions were changed, and are programmed via
+ * the transport layer into the CAN controller.
+ *
+ * Note, with acceptance filters the node table and the nickname map only see
+ * the nodes, which send heartbeats or protocol events.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_FILTER_H__
+#define __VSCP_FILTER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Hard-coded bit in the CAN identifier */
+#define VSCP_FILTER_HARD_CODED          ((uint32_t)0x02000000)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Class bits in the CAN identifier */
+#define VSCP_FILTER_CLASS(__vscpClass)  ((((uint32_t)(__vscpClass)) & 0x01FF) << 16)
+
+/** Type bits in the CAN identifier */
+#define VSCP_FILTER_TYPE(__vscpType)    ((((uint32_t)(__vscpType)) & 0x00FF) << 8)
+
+/** Originator nickname bits in the CAN identifier */
+#define VSCP_FILTER_OADDR(__oAddr)      (((uint32_t)(__oAddr)) & 0x00FF)
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function initializes the module. All subscriptions are removed and
+ * the filters will be programmed with the next vscp_filter_process() call.
+ */
+extern void vscp_filter_init(void);
+
+/**
+ * This function subscribes the application to events. A set bit in the
+ * mask means, that the corresponding bit of the class or type shall match.
+ *
+ * @param[in]   vscpClass   Class
+ * @param[in]   classMask   Class mask (0: any class)
+ * @param[in]   vscpType    Type
+ * @param[in]   typeMask    Type mask (0: any type)
+ *
+ * @return Subscribed or not
+ * @retval FALSE    No subscription available anymore
+ * @retval TRUE     Subscribed
+ */
+extern BOOL vscp_filter_subscribe(uint16_t vscpClass, uint16_t classMask, uint8_t vscpType, uint8_t typeMask);
+
+/**
+ * This function removes all subscriptions of the application.
+ */
+extern void vscp_filter_unsubscribeAll(void);
+
+/**
+ * This function marks the filters as outdated, e.g. after the decision
+ * matrix was changed. They will be calculated again and programmed with
+ * the next vscp_filter_process() call.
+ */
+extern void vscp_filter_invalidate(void);
+
+/**
+ * This function calculates the minimal set of acceptance filters.
+ *
+ * @param[out]  filters Filter buffer
+ * @param[in]   num     Number of filters, the buffer can hold
+ *
+ * @return Number of calculated filters
+ */
+extern uint8_t vscp_filter_calculate(vscp_AcceptanceFilter * const filters, uint8_t num);
+
+/**
+ * This function calculates the filters and programs them via the transport
+ * layer, in case they are outdated. It will be called by the VSCP core.
+ */
+extern void vscp_filter_process(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_FILTER_H__ */
+
+/** @} */
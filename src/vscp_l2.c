@@ -0,0 +1,316 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP level 2 events
+@file   vscp_l2.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_l2.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_l2.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+#include "vscp_transport.h"
+#include "vscp_dev_data.h"
+#include "vscp_portable.h"
+#include "vscp_class_l1_l2.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** First class, which is not a level 1 class over level 2 anymore. */
+#define VSCP_L2_CLASS_L1_L2_END     (VSCP_CLASS_L1_L2_BASE * 2)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_l2_copyData(uint8_t * const dst, uint8_t const * const src, uint16_t size);
+static void vscp_l2_getGuid(uint8_t * const guid);
+static BOOL vscp_l2_isOwnGuid(uint8_t const * const guid);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Level 2 receive message storage, which is too large for the stack. */
+static vscp_L2RxMessage vscp_l2_rxMessage;
+
+/** Level 2 transmit message storage, which is too large for the stack. */
+static vscp_L2TxMessage vscp_l2_txMessage;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function reads a level 2 event from the transport layer. If it can be
+ * handled as level 1 event, it will be converted. Otherwise it is provided to
+ * the application.
+ *
+ * @param[out]  msg Level 1 message storage
+ * @return  Level 1 message received or not
+ * @retval  FALSE   No level 1 message received
+ * @retval  TRUE    Level 1 message received
+ */
+extern BOOL vscp_l2_readMessage(vscp_RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL == msg)
+    {
+        return FALSE;
+    }
+
+    if (FALSE != vscp_transport_readL2Message(&vscp_l2_rxMessage))
+    {
+        status = vscp_l2_toL1(msg, &vscp_l2_rxMessage);
+
+        if (FALSE == status)
+        {
+            vscp_portable_provideL2Event(&vscp_l2_rxMessage);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function sends a level 2 event with the GUID of this node.
+ *
+ * @param[in] vscpClass VSCP class
+ * @param[in] vscpType  VSCP type
+ * @param[in] priority  Priority
+ * @param[in] data      Data (may be NULL, if no data is sent)
+ * @param[in] dataSize  Number of data bytes
+ * @return  Event sent or not
+ * @retval  FALSE   Failed, e.g. too much data
+ * @retval  TRUE    Successful sent
+ */
+extern BOOL vscp_l2_sendEvent(uint16_t vscpClass, uint16_t vscpType, VSCP_PRIORITY priority, uint8_t const * const data, uint16_t dataSize)
+{
+    if ((VSCP_CONFIG_L2_DATA_SIZE < dataSize) ||
+        ((NULL == data) && (0 < dataSize)))
+    {
+        return FALSE;
+    }
+
+    vscp_l2_txMessage.priority  = priority;
+    vscp_l2_txMessage.vscpClass = vscpClass;
+    vscp_l2_txMessage.vscpType  = vscpType;
+    vscp_l2_txMessage.dataSize  = dataSize;
+
+    vscp_l2_getGuid(vscp_l2_txMessage.guid);
+    vscp_l2_copyData(vscp_l2_txMessage.data, data, dataSize);
+
+    return vscp_transport_writeL2Message(&vscp_l2_txMessage);
+}
+
+/**
+ * This function converts a level 1 event to a level 2 event with the GUID of
+ * this node.
+ *
+ * @param[out]  l2Msg   Level 2 message
+ * @param[in]   l1Msg   Level 1 message
+ */
+extern void vscp_l2_fromL1(vscp_L2Message * const l2Msg, vscp_Message const * const l1Msg)
+{
+    if ((NULL == l2Msg) ||
+        (NULL == l1Msg))
+    {
+        return;
+    }
+
+    l2Msg->priority     = l1Msg->priority;
+    l2Msg->vscpClass    = l1Msg->vscpClass;
+    l2Msg->vscpType     = l1Msg->vscpType;
+    l2Msg->dataSize     = (VSCP_L1_DATA_SIZE < l1Msg->dataSize) ? VSCP_L1_DATA_SIZE : l1Msg->dataSize;
+
+    vscp_l2_getGuid(l2Msg->guid);
+    vscp_l2_copyData(l2Msg->data, l1Msg->data, l2Msg->dataSize);
+
+    return;
+}
+
+/**
+ * This function converts a level 2 event to a level 1 event, if possible.
+ * See the module description for the supported level 2 events.
+ *
+ * @param[out]  l1Msg   Level 1 message
+ * @param[in]   l2Msg   Level 2 message
+ * @return  Converted or not
+ * @retval  FALSE   Not a level 1 event or not addressed to this node
+ * @retval  TRUE    Converted
+ */
+extern BOOL vscp_l2_toL1(vscp_Message * const l1Msg, vscp_L2Message const * const l2Msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL == l1Msg) ||
+        (NULL == l2Msg) ||
+        (UINT8_MAX < l2Msg->vscpType))
+    {
+        return FALSE;
+    }
+
+    /* Level 1 event over level 2, the first data bytes contain the destination GUID. */
+    if ((VSCP_CLASS_L1_L2_BASE <= l2Msg->vscpClass) &&
+        (VSCP_L2_CLASS_L1_L2_END > l2Msg->vscpClass))
+    {
+        if ((VSCP_GUID_SIZE <= l2Msg->dataSize) &&
+            ((VSCP_GUID_SIZE + VSCP_L1_DATA_SIZE) >= l2Msg->dataSize) &&
+            (TRUE == vscp_l2_isOwnGuid(l2Msg->data)))
+        {
+            l1Msg->vscpClass    = l2Msg->vscpClass - VSCP_CLASS_L1_L2_BASE;
+            l1Msg->oAddr        = VSCP_NICKNAME_SEGMENT_MASTER;
+            l1Msg->dataSize     = (uint8_t)(l2Msg->dataSize - VSCP_GUID_SIZE);
+
+            vscp_l2_copyData(l1Msg->data, &l2Msg->data[VSCP_GUID_SIZE], l1Msg->dataSize);
+
+            status = TRUE;
+        }
+    }
+    /* Level 1 class, which fits into a level 1 event */
+    else if ((VSCP_CLASS_L1_L2_BASE > l2Msg->vscpClass) &&
+             (VSCP_L1_DATA_SIZE >= l2Msg->dataSize))
+    {
+        l1Msg->vscpClass    = l2Msg->vscpClass;
+        l1Msg->oAddr        = l2Msg->guid[VSCP_GUID_SIZE - 1];
+        l1Msg->dataSize     = (uint8_t)l2Msg->dataSize;
+
+        vscp_l2_copyData(l1Msg->data, l2Msg->data, l1Msg->dataSize);
+
+        status = TRUE;
+    }
+
+    if (TRUE == status)
+    {
+        l1Msg->priority     = l2Msg->priority;
+        l1Msg->vscpType     = (uint8_t)l2Msg->vscpType;
+        l1Msg->hardCoded    = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+        l1Msg->timestamp    = l2Msg->timestamp;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Copy data bytes.
+ *
+ * @param[out]  dst     Destination
+ * @param[in]   src     Source
+ * @param[in]   size    Number of bytes
+ */
+static void vscp_l2_copyData(uint8_t * const dst, uint8_t const * const src, uint16_t size)
+{
+    uint16_t    index   = 0;
+
+    for(index = 0; index < size; ++index)
+    {
+        dst[index] = src[index];
+    }
+
+    return;
+}
+
+/**
+ * Get the GUID of this node, MSB first.
+ *
+ * @param[out]  guid    GUID buffer
+ */
+static void vscp_l2_getGuid(uint8_t * const guid)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        guid[index] = vscp_dev_data_getGUID(VSCP_GUID_SIZE - 1 - index);
+    }
+
+    return;
+}
+
+/**
+ * Checks whether the GUID is the GUID of this node.
+ *
+ * @param[in]   guid    GUID, MSB first
+ * @return  Own GUID or not
+ * @retval  FALSE   Other GUID
+ * @retval  TRUE    Own GUID
+ */
+static BOOL vscp_l2_isOwnGuid(uint8_t const * const guid)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        if (vscp_dev_data_getGUID(VSCP_GUID_SIZE - 1 - index) != guid[index])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
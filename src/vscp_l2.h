@@ -0,0 +1,169 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP level 2 events
+@file   vscp_l2.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module handles the level 2 events, which are used e.g. by nodes connected
+via ethernet.
+
+*******************************************************************************/
+/** @defgroup vscp_l2 VSCP level 2 events
+ * Level 2 events are addressed by the GUID of the originator instead of a
+ * nickname, have a 16 bit type and up to 512 data bytes. Bulk data can be
+ * sent therefore in one event instead of many level 1 events.
+ *
+ * The core reads one level 2 event per process cycle via
+ * vscp_l2_readMessage():
+ * - A level 1 event over level 2 (class 512 - 1023), which is addressed to
+ *   this node by the GUID in the first 16 data bytes, is converted to a
+ *   level 1 event from the segment master and handled by the core, e.g. a
+ *   register read.
+ * - A level 2 event with a level 1 class (< 512), a type < 256 and up to
+ *   8 data bytes is converted to a level 1 event. The nickname is the GUID
+ *   LSB. It is handled by the core, the decision matrix and the application
+ *   like every other level 1 event.
+ * - All other level 2 events are provided to the application via
+ *   vscp_portable_provideL2Event().
+ *
+ * The responses of the core are still sent as level 1 events. Use
+ * vscp_l2_fromL1() in the transport adapter, if they shall be sent as level 2
+ * events.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_L2
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_L2_H__
+#define __VSCP_L2_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/**
+ * This function reads a level 2 event from the transport layer. If it can be
+ * handled as level 1 event, it will be converted. Otherwise it is provided to
+ * the application.
+ *
+ * @param[out]  msg Level 1 message storage
+ * @return  Level 1 message received or not
+ * @retval  FALSE   No level 1 message received
+ * @retval  TRUE    Level 1 message received
+ */
+extern BOOL vscp_l2_readMessage(vscp_RxMessage * const msg);
+
+/**
+ * This function sends a level 2 event with the GUID of this node.
+ *
+ * @param[in] vscpClass VSCP class
+ * @param[in] vscpType  VSCP type
+ * @param[in] priority  Priority
+ * @param[in] data      Data (may be NULL, if no data is sent)
+ * @param[in] dataSize  Number of data bytes
+ * @return  Event sent or not
+ * @retval  FALSE   Failed, e.g. too much data
+ * @retval  TRUE    Successful sent
+ */
+extern BOOL vscp_l2_sendEvent(uint16_t vscpClass, uint16_t vscpType, VSCP_PRIORITY priority, uint8_t const * const data, uint16_t dataSize);
+
+/**
+ * This function converts a level 1 event to a level 2 event with the GUID of
+ * this node.
+ *
+ * @param[out]  l2Msg   Level 2 message
+ * @param[in]   l1Msg   Level 1 message
+ */
+extern void vscp_l2_fromL1(vscp_L2Message * const l2Msg, vscp_Message const * const l1Msg);
+
+/**
+ * This function converts a level 2 event to a level 1 event, if possible.
+ * See the module description for the supported level 2 events.
+ *
+ * @param[out]  l1Msg   Level 1 message
+ * @param[in]   l2Msg   Level 2 message
+ * @return  Converted or not
+ * @retval  FALSE   Not a level 1 event or not addressed to this node
+ * @retval  TRUE    Converted
+ */
+extern BOOL vscp_l2_toL1(vscp_Message * const l1Msg, vscp_L2Message const * const l2Msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_L2_H__ */
+
+/** @} */
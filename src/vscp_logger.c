@@ -45,6 +45,7 @@
 #include "vscp_class_l1.h"
 #include "vscp_type_log.h"
 #include "vscp_ps.h"
+#include "vscp_stats.h"
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
 
@@ -56,6 +57,15 @@
     CONSTANTS
 *******************************************************************************/
 
+/** Number of log levels */
+#define VSCP_LOGGER_LVL_NUM         (8)
+
+/** Number of log message bytes in a single log event */
+#define VSCP_LOGGER_EVENT_MSG_SIZE  (VSCP_L1_DATA_SIZE - 3)
+
+/** Max. size of a variable length encoded 32-bit argument in bytes */
+#define VSCP_LOGGER_VARINT_SIZE     (5)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -68,6 +78,21 @@
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+static void vscp_logger_store(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size);
+static BOOL vscp_logger_takeTokens(uint8_t level, uint8_t num);
+static void vscp_logger_dropOldest(void);
+static void vscp_logger_sendStored(uint8_t maxNum);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+
+static uint8_t vscp_logger_encodeVarUInt(uint8_t * const buffer, uint32_t value);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -78,6 +103,28 @@ static BOOL     vscp_logger_isEnabled   = FALSE;
 /** Current log level bitfield */
 static uint8_t  vscp_logger_logLevel    = 0;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+/** Ring buffer with the data of the log events, which are not sent yet. */
+static uint8_t  vscp_logger_buffer[VSCP_CONFIG_LOGGER_BUFFER_NUM][VSCP_L1_DATA_SIZE];
+
+/** Ring buffer index of the oldest log event */
+static uint8_t  vscp_logger_readIndex   = 0;
+
+/** Number of log events in the ring buffer */
+static uint8_t  vscp_logger_count       = 0;
+
+/** Number of dropped log messages */
+static uint16_t vscp_logger_dropCount   = 0;
+
+/** Rate limit: Available log events (tokens) per log level */
+static uint8_t  vscp_logger_tokens[VSCP_LOGGER_LVL_NUM];
+
+/** Rate limit: Time since epoch in s of the last token refill */
+static uint32_t vscp_logger_refillTime  = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -91,7 +138,21 @@ static uint8_t  vscp_logger_logLevel    = 0;
  */
 extern void vscp_logger_init(void)
 {
-    /* Nothing to do */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+    uint8_t index   = 0;
+
+    vscp_logger_readIndex   = 0;
+    vscp_logger_count       = 0;
+    vscp_logger_dropCount   = 0;
+    vscp_logger_refillTime  = vscp_core_getTimeSinceEpoch();
+
+    for(index = 0; index < VSCP_LOGGER_LVL_NUM; ++index)
+    {
+        vscp_logger_tokens[index] = VSCP_CONFIG_LOGGER_RATE_BURST;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
 
     return;
 }
@@ -141,7 +202,11 @@ extern void vscp_logger_log(uint8_t id, VSCP_LOGGER_LVL level, uint8_t const * c
     {
         if (0 != (vscp_logger_logLevel & (1 << level)))
         {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+            vscp_logger_store(id, level, msg, size);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
             (void)vscp_logger_sendLogEvent(id, level, msg, size);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
         }
     }
 
@@ -165,6 +230,54 @@ extern void vscp_logger_logUInt32(uint8_t id, VSCP_LOGGER_LVL level, uint32_t va
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+
+/**
+ * This function sends a trace record, depended on the active log level.
+ * The arguments are encoded only, if the log level is active.
+ * A record with more than VSCP_LOGGER_TRACE_ARGS_MAX arguments is ignored.
+ *
+ * @param[in] id    Trace message id
+ * @param[in] level Log level
+ * @param[in] args  Arguments (signed ones zigzag encoded, see VSCP_LOGGER_TRACE_SINT())
+ * @param[in] num   Number of arguments
+ */
+extern void vscp_logger_trace(uint16_t id, VSCP_LOGGER_LVL level, uint32_t const * const args, uint8_t num)
+{
+    uint8_t buffer[2 + VSCP_LOGGER_TRACE_ARGS_MAX * VSCP_LOGGER_VARINT_SIZE];
+    uint8_t size    = 0;
+    uint8_t index   = 0;
+
+    /* Skip the encoding, if the record won't be logged anyway. */
+    if ((FALSE == vscp_logger_isEnabled) ||
+        (0 == (vscp_logger_logLevel & (1 << level))))
+    {
+        return;
+    }
+
+    if ((VSCP_LOGGER_TRACE_ARGS_MAX < num) ||
+        ((0 < num) && (NULL == args)))
+    {
+        return;
+    }
+
+    buffer[size] = (uint8_t)((id >> 8) & 0xFF);
+    ++size;
+    buffer[size] = (uint8_t)((id >> 0) & 0xFF);
+    ++size;
+
+    for(index = 0; index < num; ++index)
+    {
+        size += vscp_logger_encodeVarUInt(&buffer[size], args[index]);
+    }
+
+    vscp_logger_log(VSCP_CONFIG_LOGGER_TRACE_ID, level, buffer, size);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
 /**
  * This function handles all CLASS1.Log events, which controls the logging functionality.
  * It will be called by the VSCP core.
@@ -220,6 +333,53 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+/**
+ * This function sends up to VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE buffered log
+ * events. It will be called by the VSCP core every process cycle.
+ */
+extern void vscp_logger_process(void)
+{
+    vscp_logger_sendStored(VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE);
+
+    return;
+}
+
+/**
+ * This function sends all buffered log events immediately, e.g. before a reset.
+ *
+ * @return Status
+ * @retval FALSE    The transport layer refused a log event, the rest is still buffered.
+ * @retval TRUE     All log events sent
+ */
+extern BOOL vscp_logger_flush(void)
+{
+    BOOL    status  = FALSE;
+
+    vscp_logger_sendStored(VSCP_CONFIG_LOGGER_BUFFER_NUM);
+
+    if (0 == vscp_logger_count)
+    {
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function returns the number of dropped log messages, because the ring
+ * buffer was full or the rate limit of the log level was exceeded.
+ *
+ * @return Number of dropped log messages (saturated)
+ */
+extern uint16_t vscp_logger_getDropCount(void)
+{
+    return vscp_logger_dropCount;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
 /**
@@ -285,3 +445,243 @@ extern BOOL vscp_logger_sendLogEvent(uint8_t id, uint8_t level, uint8_t const *
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+/**
+ * Store a log message in the ring buffer. The message is split into log events
+ * like in vscp_logger_sendLogEvent(). If necessary, the oldest log messages are
+ * dropped. If the message exceeds the rate limit of its log level or doesn't
+ * fit into the ring buffer at all, it will be dropped.
+ *
+ * @param[in] id    Message id
+ * @param[in] level Log level
+ * @param[in] msg   Message
+ * @param[in] size  Message size in bytes
+ */
+static void vscp_logger_store(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size)
+{
+    uint8_t num = 1;
+
+    if ((NULL != msg) &&
+        (VSCP_LOGGER_EVENT_MSG_SIZE < size))
+    {
+        num = (uint8_t)((size + (VSCP_LOGGER_EVENT_MSG_SIZE - 1)) / VSCP_LOGGER_EVENT_MSG_SIZE);
+    }
+
+    if ((VSCP_CONFIG_LOGGER_BUFFER_NUM < num) ||
+        (FALSE == vscp_logger_takeTokens(level, num)))
+    {
+        if (0xFFFF > vscp_logger_dropCount)
+        {
+            ++vscp_logger_dropCount;
+        }
+    }
+    else
+    {
+        uint8_t eventIndex  = 0;
+        uint8_t msgIndex    = 0;
+
+        /* Make room for the whole message */
+        while((VSCP_CONFIG_LOGGER_BUFFER_NUM - vscp_logger_count) < num)
+        {
+            vscp_logger_dropOldest();
+        }
+
+        for(eventIndex = 0; eventIndex < num; ++eventIndex)
+        {
+            uint8_t     writeIndex  = (uint8_t)((vscp_logger_readIndex + vscp_logger_count) % VSCP_CONFIG_LOGGER_BUFFER_NUM);
+            uint8_t*    data        = vscp_logger_buffer[writeIndex];
+            uint8_t     index       = 0;
+
+            data[0] = id;
+            data[1] = level;
+            data[2] = eventIndex;
+
+            for(index = 3; index < VSCP_L1_DATA_SIZE; ++index)
+            {
+                if ((NULL != msg) &&
+                    (size > msgIndex))
+                {
+                    data[index] = msg[msgIndex];
+                    ++msgIndex;
+                }
+                /* Fill the rest of the log event with zeros. */
+                else
+                {
+                    data[index] = 0;
+                }
+            }
+
+            ++vscp_logger_count;
+        }
+
+        VSCP_STATS_MAX(VSCP_STATS_CNT_LOGGER_HWM, vscp_logger_count);
+    }
+
+    return;
+}
+
+/**
+ * Take the tokens for a number of log events from the token bucket of a log
+ * level. The buckets are refilled every second with VSCP_CONFIG_LOGGER_RATE_LIMIT
+ * tokens, up to VSCP_CONFIG_LOGGER_RATE_BURST.
+ *
+ * @param[in] level Log level
+ * @param[in] num   Number of log events
+ * @return Rate limit exceeded or not
+ * @retval FALSE    Rate limit exceeded
+ * @retval TRUE     Tokens taken
+ */
+static BOOL vscp_logger_takeTokens(uint8_t level, uint8_t num)
+{
+    BOOL        status  = FALSE;
+    uint32_t    now     = vscp_core_getTimeSinceEpoch();
+
+    if (0 == VSCP_CONFIG_LOGGER_RATE_LIMIT)
+    {
+        status = TRUE;
+    }
+    else
+    {
+        /* Refill the buckets. If the time since epoch was set back, it is
+         * handled like one second elapsed.
+         */
+        if (vscp_logger_refillTime != now)
+        {
+            uint32_t    elapsed = 1;
+            uint16_t    refill  = 0;
+            uint8_t     index   = 0;
+
+            if (vscp_logger_refillTime < now)
+            {
+                elapsed = now - vscp_logger_refillTime;
+            }
+
+            /* After this time all buckets are full anyway. */
+            if (VSCP_CONFIG_LOGGER_RATE_BURST < elapsed)
+            {
+                elapsed = VSCP_CONFIG_LOGGER_RATE_BURST;
+            }
+
+            refill = (uint16_t)(elapsed * VSCP_CONFIG_LOGGER_RATE_LIMIT);
+
+            for(index = 0; index < VSCP_LOGGER_LVL_NUM; ++index)
+            {
+                if ((VSCP_CONFIG_LOGGER_RATE_BURST - vscp_logger_tokens[index]) < refill)
+                {
+                    vscp_logger_tokens[index] = VSCP_CONFIG_LOGGER_RATE_BURST;
+                }
+                else
+                {
+                    vscp_logger_tokens[index] += (uint8_t)refill;
+                }
+            }
+
+            vscp_logger_refillTime = now;
+        }
+
+        if ((VSCP_LOGGER_LVL_NUM > level) &&
+            (num <= vscp_logger_tokens[level]))
+        {
+            vscp_logger_tokens[level] -= num;
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Drop the oldest log message in the ring buffer, including all of its log
+ * events.
+ */
+static void vscp_logger_dropOldest(void)
+{
+    /* Remove the first log event and all following, which continue the same
+     * log message (log event index not 0).
+     */
+    do
+    {
+        vscp_logger_readIndex = (uint8_t)((vscp_logger_readIndex + 1) % VSCP_CONFIG_LOGGER_BUFFER_NUM);
+        --vscp_logger_count;
+    }
+    while((0 < vscp_logger_count) && (0 != vscp_logger_buffer[vscp_logger_readIndex][2]));
+
+    if (0xFFFF > vscp_logger_dropCount)
+    {
+        ++vscp_logger_dropCount;
+    }
+
+    return;
+}
+
+/**
+ * Send buffered log events with low priority. A log event is removed from the
+ * ring buffer only after the transport layer accepted it.
+ *
+ * @param[in] maxNum    Max. number of log events to send
+ */
+static void vscp_logger_sendStored(uint8_t maxNum)
+{
+    BOOL    status  = TRUE;
+    uint8_t sent    = 0;
+
+    while((0 < vscp_logger_count) && (maxNum > sent) && (TRUE == status))
+    {
+        vscp_TxMessage  txMsg;
+        uint8_t         index   = 0;
+
+        vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_MESSAGE, VSCP_PRIORITY_7_LOW);
+
+        txMsg.dataSize = VSCP_L1_DATA_SIZE;
+
+        for(index = 0; index < VSCP_L1_DATA_SIZE; ++index)
+        {
+            txMsg.data[index] = vscp_logger_buffer[vscp_logger_readIndex][index];
+        }
+
+        status = vscp_core_sendEvent(&txMsg);
+
+        if (TRUE == status)
+        {
+            vscp_logger_readIndex = (uint8_t)((vscp_logger_readIndex + 1) % VSCP_CONFIG_LOGGER_BUFFER_NUM);
+            --vscp_logger_count;
+            ++sent;
+        }
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+
+/**
+ * This function encodes a value as variable length unsigned integer. Every
+ * byte contains 7 bit of the value, least significant group first. Bit 7 is
+ * set, if another byte follows.
+ *
+ * @param[out]  buffer  Buffer with at least VSCP_LOGGER_VARINT_SIZE bytes
+ * @param[in]   value   Value
+ * @return Number of written bytes
+ */
+static uint8_t vscp_logger_encodeVarUInt(uint8_t * const buffer, uint32_t value)
+{
+    uint8_t size    = 0;
+
+    while(0x7F < value)
+    {
+        buffer[size] = (uint8_t)((value & 0x7F) | 0x80);
+        value >>= 7;
+        ++size;
+    }
+
+    buffer[size] = (uint8_t)value;
+    ++size;
+
+    return size;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
@@ -45,8 +45,31 @@ level.
  * Parts of a message means, if the message is defragmented in several VSCP
  * events, it can happen that a event will be lost.
  *
+ * If the buffered logger is enabled, the log events are stored in a ring
+ * buffer instead and the VSCP core sends them in the background with low
+ * priority (see vscp_logger_process()). Logging doesn't block the caller and
+ * a log event, which the transport layer refuses, is sent again later.
+ * If the ring buffer is full, the oldest log messages are dropped. Every log
+ * level has its own rate limit (token bucket), so a flood of log messages of
+ * one level can't displace the others. The number of dropped log messages is
+ * available via vscp_logger_getDropCount().
+ *
+ * If the trace records are enabled, the application can log a 16-bit message
+ * id with up to VSCP_LOGGER_TRACE_ARGS_MAX arguments (see LOG_TRACE0() ...
+ * LOG_TRACE4()), instead of formatting a text on the target. The record is
+ * sent with the log message id VSCP_CONFIG_LOGGER_TRACE_ID:
+ * - Byte 0-1: Message id (MSB first)
+ * - Byte 2-n: Arguments as variable length unsigned integers (7 bit per byte,
+ *   least significant group first, bit 7 set if another byte follows)
+ *
+ * Signed arguments shall be zigzag encoded with VSCP_LOGGER_TRACE_SINT(), so
+ * small negative values keep short too. The host decodes the records with the
+ * table of the format strings, see tools/scripts/vscp_trace_decoder.py.
+ *
  * Supported compile switches:
  * - VSCP_CONFIG_ENABLE_LOGGER
+ * - VSCP_CONFIG_ENABLE_LOGGER_BUFFER
+ * - VSCP_CONFIG_ENABLE_LOGGER_TRACE
  *
  * @{
  */
@@ -79,10 +102,74 @@ extern "C"
     CONSTANTS
 *******************************************************************************/
 
+/** Max. number of arguments of a trace record */
+#define VSCP_LOGGER_TRACE_ARGS_MAX  (4)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Zigzag encoding of a signed 32-bit trace argument. */
+#define VSCP_LOGGER_TRACE_SINT(__value) ((((uint32_t)(int32_t)(__value)) << 1) ^ ((0 > (int32_t)(__value)) ? 0xFFFFFFFFu : 0u))
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+
+/** Log trace record with id and no argument. */
+#define LOG_TRACE0(__id, __level)   vscp_logger_trace((__id), (__level), NULL, 0)
+
+/** Log trace record with id and one argument. */
+#define LOG_TRACE1(__id, __level, __arg0)                                   \
+    do{                                                                     \
+        uint32_t const __args[1] = { (uint32_t)(__arg0) };                  \
+        vscp_logger_trace((__id), (__level), __args, 1);                    \
+    }while(0)
+
+/** Log trace record with id and two arguments. */
+#define LOG_TRACE2(__id, __level, __arg0, __arg1)                           \
+    do{                                                                     \
+        uint32_t const __args[2] = { (uint32_t)(__arg0),                    \
+                                     (uint32_t)(__arg1) };                  \
+        vscp_logger_trace((__id), (__level), __args, 2);                    \
+    }while(0)
+
+/** Log trace record with id and three arguments. */
+#define LOG_TRACE3(__id, __level, __arg0, __arg1, __arg2)                   \
+    do{                                                                     \
+        uint32_t const __args[3] = { (uint32_t)(__arg0),                    \
+                                     (uint32_t)(__arg1),                    \
+                                     (uint32_t)(__arg2) };                  \
+        vscp_logger_trace((__id), (__level), __args, 3);                    \
+    }while(0)
+
+/** Log trace record with id and four arguments. */
+#define LOG_TRACE4(__id, __level, __arg0, __arg1, __arg2, __arg3)           \
+    do{                                                                     \
+        uint32_t const __args[4] = { (uint32_t)(__arg0),                    \
+                                     (uint32_t)(__arg1),                    \
+                                     (uint32_t)(__arg2),                    \
+                                     (uint32_t)(__arg3) };                  \
+        vscp_logger_trace((__id), (__level), __args, 4);                    \
+    }while(0)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
+/** Log trace record with id and no argument. */
+#define LOG_TRACE0(__id, __level)
+
+/** Log trace record with id and one argument. */
+#define LOG_TRACE1(__id, __level, __arg0)
+
+/** Log trace record with id and two arguments. */
+#define LOG_TRACE2(__id, __level, __arg0, __arg1)
+
+/** Log trace record with id and three arguments. */
+#define LOG_TRACE3(__id, __level, __arg0, __arg1, __arg2)
+
+/** Log trace record with id and four arguments. */
+#define LOG_TRACE4(__id, __level, __arg0, __arg1, __arg2, __arg3)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
 
 /** Log INFO message with id. */
@@ -250,6 +337,22 @@ extern void vscp_logger_log(uint8_t id, VSCP_LOGGER_LVL level, uint8_t const * c
  */
 extern void vscp_logger_logUInt32(uint8_t id, VSCP_LOGGER_LVL level, uint32_t value);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE )
+
+/**
+ * This function sends a trace record, depended on the active log level.
+ * The arguments are encoded only, if the log level is active.
+ * A record with more than VSCP_LOGGER_TRACE_ARGS_MAX arguments is ignored.
+ *
+ * @param[in] id    Trace message id
+ * @param[in] level Log level
+ * @param[in] args  Arguments (signed ones zigzag encoded, see VSCP_LOGGER_TRACE_SINT())
+ * @param[in] num   Number of arguments
+ */
+extern void vscp_logger_trace(uint16_t id, VSCP_LOGGER_LVL level, uint32_t const * const args, uint8_t num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_TRACE ) */
+
 /**
  * This function handles all CLASS1.Log events, which controls the logging functionality.
  * It will be called by the VSCP core.
@@ -260,6 +363,33 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER )
+
+/**
+ * This function sends up to VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE buffered log
+ * events. It will be called by the VSCP core every process cycle.
+ */
+extern void vscp_logger_process(void);
+
+/**
+ * This function sends all buffered log events immediately, e.g. before a reset.
+ *
+ * @return Status
+ * @retval FALSE    The transport layer refused a log event, the rest is still buffered.
+ * @retval TRUE     All log events sent
+ */
+extern BOOL vscp_logger_flush(void);
+
+/**
+ * This function returns the number of dropped log messages, because the ring
+ * buffer was full or the rate limit of the log level was exceeded.
+ *
+ * @return Number of dropped log messages (saturated)
+ */
+extern uint16_t vscp_logger_getDropCount(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_BUFFER ) */
+
 /**
  * Message for Log. Several frames have to be sent for a event that take up more the
  * five bytes which is the maximum for each frame. In this case the zero based index
@@ -0,0 +1,301 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP embedded MDF
+@file   vscp_mdf.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_mdf.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_mdf.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
+#include "vscp_portable.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Blob index of the decoded MDF size (MSB first) */
+#define VSCP_MDF_BLOB_SIZE          (0)
+
+/** Blob index of the coded stream index (MSB first) */
+#define VSCP_MDF_BLOB_STREAM        (2)
+
+/** Blob index of the dictionary entry indices (MSB first, 2 byte each) */
+#define VSCP_MDF_BLOB_DICT          (5)
+
+/** Token, which escapes a literal above 0x7F */
+#define VSCP_MDF_TOKEN_ESCAPE       (0x80)
+
+/** Token of the first dictionary entry */
+#define VSCP_MDF_TOKEN_DICT         (0x81)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static uint16_t vscp_mdf_readUInt16(uint16_t index);
+static void vscp_mdf_restart(void);
+static uint8_t vscp_mdf_decode(void);
+static void vscp_mdf_skip(uint16_t offset);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Size of the decoded MDF */
+static uint16_t vscp_mdf_size           = 0;
+
+/** Position in the decoded MDF */
+static uint16_t vscp_mdf_pos            = 0;
+
+/** Blob index of the next token */
+static uint16_t vscp_mdf_streamIndex    = 0;
+
+/** Blob index of the next character of the current dictionary entry */
+static uint16_t vscp_mdf_entryIndex     = 0;
+
+/** Number of characters of the current dictionary entry, which are not decoded yet */
+static uint8_t  vscp_mdf_entryRemain    = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module and restarts the decoder.
+ */
+extern void vscp_mdf_init(void)
+{
+    vscp_mdf_size = vscp_mdf_readUInt16(VSCP_MDF_BLOB_SIZE);
+
+    vscp_mdf_restart();
+
+    return;
+}
+
+/**
+ * This function returns the size of the decoded MDF.
+ *
+ * @return Size in byte (0: No embedded MDF available)
+ */
+extern uint16_t vscp_mdf_getSize(void)
+{
+    return vscp_mdf_size;
+}
+
+/**
+ * This function reads a part of the decoded MDF.
+ *
+ * @param[in]   offset  Offset in the decoded MDF
+ * @param[out]  buffer  Buffer
+ * @param[in]   size    Buffer size in byte
+ *
+ * @return Number of read bytes, which is less than the buffer size at the end of the MDF
+ */
+extern uint8_t vscp_mdf_read(uint16_t offset, uint8_t * const buffer, uint8_t size)
+{
+    uint8_t num = 0;
+
+    if ((NULL == buffer) ||
+        (vscp_mdf_size <= offset))
+    {
+        return 0;
+    }
+
+    /* Not continued at the last position? */
+    if (offset != vscp_mdf_pos)
+    {
+        vscp_mdf_skip(offset);
+    }
+
+    while((size > num) && (vscp_mdf_size > vscp_mdf_pos))
+    {
+        buffer[num] = vscp_mdf_decode();
+        ++num;
+    }
+
+    return num;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function reads a 16 bit value (MSB first) from the blob.
+ *
+ * @param[in] index Blob index
+ *
+ * @return Value
+ */
+static uint16_t vscp_mdf_readUInt16(uint16_t index)
+{
+    uint16_t    value   = ((uint16_t)vscp_portable_readEmbeddedMdf(index)) << 8;
+
+    value |= vscp_portable_readEmbeddedMdf(index + 1);
+
+    return value;
+}
+
+/**
+ * This function restarts the decoder at the beginning of the MDF.
+ */
+static void vscp_mdf_restart(void)
+{
+    vscp_mdf_pos            = 0;
+    vscp_mdf_streamIndex    = vscp_mdf_readUInt16(VSCP_MDF_BLOB_STREAM);
+    vscp_mdf_entryIndex     = 0;
+    vscp_mdf_entryRemain    = 0;
+
+    return;
+}
+
+/**
+ * This function decodes the next byte of the MDF.
+ *
+ * @return Decoded byte
+ */
+static uint8_t vscp_mdf_decode(void)
+{
+    uint8_t value   = 0;
+
+    /* Next token? */
+    if (0 == vscp_mdf_entryRemain)
+    {
+        value = vscp_portable_readEmbeddedMdf(vscp_mdf_streamIndex);
+        ++vscp_mdf_streamIndex;
+
+        if (VSCP_MDF_TOKEN_ESCAPE == value)
+        {
+            value = vscp_portable_readEmbeddedMdf(vscp_mdf_streamIndex);
+            ++vscp_mdf_streamIndex;
+        }
+        else if (VSCP_MDF_TOKEN_DICT <= value)
+        {
+            uint16_t    entry   = VSCP_MDF_BLOB_DICT + 2 * (value - VSCP_MDF_TOKEN_DICT);
+
+            vscp_mdf_entryIndex     = vscp_mdf_readUInt16(entry);
+            vscp_mdf_entryRemain    = vscp_portable_readEmbeddedMdf(vscp_mdf_entryIndex);
+            ++vscp_mdf_entryIndex;
+        }
+    }
+
+    /* Continue with the current dictionary entry? */
+    if (0 < vscp_mdf_entryRemain)
+    {
+        value = vscp_portable_readEmbeddedMdf(vscp_mdf_entryIndex);
+        ++vscp_mdf_entryIndex;
+        --vscp_mdf_entryRemain;
+    }
+
+    ++vscp_mdf_pos;
+
+    return value;
+}
+
+/**
+ * This function moves the decoder to the given offset in the MDF. Complete
+ * dictionary entries are skipped without decoding their characters.
+ *
+ * @param[in] offset    Offset in the decoded MDF
+ */
+static void vscp_mdf_skip(uint16_t offset)
+{
+    if (offset < vscp_mdf_pos)
+    {
+        vscp_mdf_restart();
+    }
+
+    /* Skip the rest of the current dictionary entry, if possible. */
+    if ((0 < vscp_mdf_entryRemain) &&
+        (vscp_mdf_entryRemain <= (offset - vscp_mdf_pos)))
+    {
+        vscp_mdf_pos            += vscp_mdf_entryRemain;
+        vscp_mdf_entryRemain    = 0;
+    }
+
+    while(offset > vscp_mdf_pos)
+    {
+        BOOL    isSkipped   = FALSE;
+
+        /* Skip a complete dictionary entry? */
+        if (0 == vscp_mdf_entryRemain)
+        {
+            uint8_t token   = vscp_portable_readEmbeddedMdf(vscp_mdf_streamIndex);
+
+            if (VSCP_MDF_TOKEN_DICT <= token)
+            {
+                uint16_t    entry   = VSCP_MDF_BLOB_DICT + 2 * (token - VSCP_MDF_TOKEN_DICT);
+                uint8_t     length  = vscp_portable_readEmbeddedMdf(vscp_mdf_readUInt16(entry));
+
+                if (length <= (offset - vscp_mdf_pos))
+                {
+                    vscp_mdf_pos += length;
+                    ++vscp_mdf_streamIndex;
+                    isSkipped = TRUE;
+                }
+            }
+        }
+
+        if (FALSE == isSkipped)
+        {
+            (void)vscp_mdf_decode();
+        }
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
@@ -0,0 +1,138 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP embedded MDF
+@file   vscp_mdf.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides the embedded module description file (MDF).
+
+*******************************************************************************/
+/** @defgroup vscp_mdf VSCP embedded MDF
+ * The embedded MDF is stored in flash as blob, which is generated at build
+ * time by tools/scripts/vscp_mdf_compress.py. The blob is read byte by byte
+ * via vscp_portable_readEmbeddedMdf().
+ *
+ * The MDF is dictionary coded, which is decoded on the fly and needs only a
+ * few bytes of RAM. The decoder continues at the last position, therefore
+ * sequential reads are fast. Reading any other position decodes the blob
+ * from the beginning again.
+ *
+ * The VSCP core streams the MDF with the get embedded MDF responses. Every
+ * response contains the frame index (MSB first) and up to 6 byte of the MDF.
+ * The last response contains less than 6 byte of the MDF, which marks the
+ * end. A get embedded MDF request may contain the frame index (MSB first)
+ * after the nickname, to resume after a lost response.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_EMBEDDED_MDF
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_MDF_H__
+#define __VSCP_MDF_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
+/**
+ * This function initializes the module and restarts the decoder.
+ */
+extern void vscp_mdf_init(void);
+
+/**
+ * This function returns the size of the decoded MDF.
+ *
+ * @return Size in byte (0: No embedded MDF available)
+ */
+extern uint16_t vscp_mdf_getSize(void);
+
+/**
+ * This function reads a part of the decoded MDF.
+ *
+ * @param[in]   offset  Offset in the decoded MDF
+ * @param[out]  buffer  Buffer
+ * @param[in]   size    Buffer size in byte
+ *
+ * @return Number of read bytes, which is less than the buffer size at the end of the MDF
+ */
+extern uint8_t vscp_mdf_read(uint16_t offset, uint8_t * const buffer, uint8_t size);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_MDF_H__ */
+
+/** @} */
@@ -0,0 +1,426 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP segment node table
+@file   vscp_node_table.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_node_table.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_node_table.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+
+#include "vscp_core.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_information.h"
+#include "vscp_type_protocol.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of node table entries, one per nickname id */
+#define VSCP_NODE_TABLE_SIZE                (256)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID )
+
+/** Internal flags: Received who is there response rows, which contain the GUID */
+#define VSCP_NODE_TABLE_FLAG_GUID_ROWS      ((uint8_t)0x70)
+
+/** Internal flag: First who is there response row, which contains the GUID */
+#define VSCP_NODE_TABLE_FLAG_GUID_ROW0      ((uint8_t)0x10)
+
+/** Number of who is there response rows, which contain the GUID */
+#define VSCP_NODE_TABLE_GUID_ROWS           (3)
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID ) */
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID )
+static void vscp_node_table_learnGuid(vscp_node_table_Entry * const entry, vscp_RxMessage const * const msg);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID ) */
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Node table, indexed by the nickname id */
+static vscp_node_table_Entry    vscp_node_table_entries[VSCP_NODE_TABLE_SIZE];
+
+/** Number of known nodes */
+static uint8_t                  vscp_node_table_num         = 0;
+
+/** Next entry, which is checked for expiry */
+static uint8_t                  vscp_node_table_sweepIndex  = 0;
+
+/** Time in s since initialization. It is independent of the time since epoch,
+ * which may be set or stepped by the segment master at any time.
+ */
+static uint32_t                 vscp_node_table_time        = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module and clears the node table.
+ */
+extern void vscp_node_table_init(void)
+{
+    uint16_t    index   = 0;
+
+    for(index = 0; index < VSCP_NODE_TABLE_SIZE; ++index)
+    {
+        vscp_node_table_entries[index].flags = 0;
+    }
+
+    vscp_node_table_num         = 0;
+    vscp_node_table_sweepIndex  = 0;
+    vscp_node_table_time        = 0;
+
+    return;
+}
+
+/**
+ * This function updates the node table with a received event.
+ * It will be called by the VSCP core for every received event.
+ *
+ * @param[in] msg   Received event message
+ */
+extern void vscp_node_table_update(vscp_RxMessage const * const msg)
+{
+    vscp_node_table_Entry * entry   = NULL;
+    uint32_t                now     = vscp_node_table_time;
+
+    if (NULL == msg)
+    {
+        return;
+    }
+
+    /* Nodes without nickname id are not tracked. */
+    if (VSCP_NICKNAME_NOT_INIT == msg->oAddr)
+    {
+        return;
+    }
+
+    entry = &vscp_node_table_entries[msg->oAddr];
+
+    if (0 == (entry->flags & VSCP_NODE_TABLE_FLAG_VALID))
+    {
+        entry->flags            = VSCP_NODE_TABLE_FLAG_VALID;
+        entry->heartbeatPeriod  = 0;
+        ++vscp_node_table_num;
+    }
+
+    entry->lastSeen = now;
+
+    if (FALSE == msg->hardCoded)
+    {
+        entry->flags &= ~VSCP_NODE_TABLE_FLAG_HARD_CODED;
+    }
+    else
+    {
+        entry->flags |= VSCP_NODE_TABLE_FLAG_HARD_CODED;
+    }
+
+    if (VSCP_CLASS_L1_INFORMATION == msg->vscpClass)
+    {
+        if (VSCP_TYPE_INFORMATION_NODE_HEARTBEAT == msg->vscpType)
+        {
+            if (0 != (entry->flags & VSCP_NODE_TABLE_FLAG_HEARTBEAT))
+            {
+                uint32_t    period  = now - entry->lastHeartbeat;
+
+                /* Several heartbeats within one second don't change the period. */
+                if (0 < period)
+                {
+                    entry->heartbeatPeriod = (UINT16_MAX < period) ? UINT16_MAX : (uint16_t)period;
+                }
+            }
+
+            entry->lastHeartbeat = now;
+            entry->flags |= VSCP_NODE_TABLE_FLAG_HEARTBEAT;
+        }
+    }
+    else if (VSCP_CLASS_L1_PROTOCOL == msg->vscpClass)
+    {
+        /* Node started up again? Forget everything, which was learned. */
+        if ((VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE == msg->vscpType) &&
+            (1 <= msg->dataSize) &&
+            (msg->oAddr == msg->data[0]))
+        {
+            entry->flags &= VSCP_NODE_TABLE_FLAG_VALID | VSCP_NODE_TABLE_FLAG_HARD_CODED;
+            entry->heartbeatPeriod = 0;
+        }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID )
+
+        else if (VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE == msg->vscpType)
+        {
+            vscp_node_table_learnGuid(entry, msg);
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID ) */
+
+    }
+
+    return;
+}
+
+/**
+ * This function checks a part of the node table for expired nodes.
+ * It will be called by the VSCP core every process cycle.
+ */
+extern void vscp_node_table_process(void)
+{
+    uint8_t     count   = 0;
+    uint32_t    now     = vscp_node_table_time;
+
+    for(count = 0; count < VSCP_CONFIG_NODE_TABLE_SWEEP_NUM; ++count)
+    {
+        vscp_node_table_Entry * entry   = &vscp_node_table_entries[vscp_node_table_sweepIndex];
+
+        if ((0 != (entry->flags & VSCP_NODE_TABLE_FLAG_VALID)) &&
+            (VSCP_CONFIG_NODE_TABLE_EXPIRY < (now - entry->lastSeen)))
+        {
+            entry->flags = 0;
+            --vscp_node_table_num;
+        }
+
+        /* Wraps around after the last entry. */
+        ++vscp_node_table_sweepIndex;
+    }
+
+    return;
+}
+
+/**
+ * This function shall be called once per second. It increases the time,
+ * which the node table is based on.
+ */
+extern void vscp_node_table_process1s(void)
+{
+    ++vscp_node_table_time;
+
+    return;
+}
+
+/**
+ * This function returns the time in s since initialization, which is used for
+ * the last seen and the last heartbeat time of the entries.
+ *
+ * @return Time in s
+ */
+extern uint32_t vscp_node_table_getTime(void)
+{
+    return vscp_node_table_time;
+}
+
+/**
+ * This function removes a node from the node table.
+ *
+ * @param[in] nickname  Nickname id of the node
+ */
+extern void vscp_node_table_remove(uint8_t nickname)
+{
+    if (0 != (vscp_node_table_entries[nickname].flags & VSCP_NODE_TABLE_FLAG_VALID))
+    {
+        vscp_node_table_entries[nickname].flags = 0;
+        --vscp_node_table_num;
+    }
+
+    return;
+}
+
+/**
+ * This function returns whether a node is known, because it was seen on the
+ * bus and is not expired yet.
+ *
+ * @param[in] nickname  Nickname id of the node
+ * @return Node known or not
+ * @retval FALSE    Node unknown
+ * @retval TRUE     Node known
+ */
+extern BOOL vscp_node_table_isAlive(uint8_t nickname)
+{
+    BOOL    isAlive = FALSE;
+
+    if (0 != (vscp_node_table_entries[nickname].flags & VSCP_NODE_TABLE_FLAG_VALID))
+    {
+        isAlive = TRUE;
+    }
+
+    return isAlive;
+}
+
+/**
+ * This function returns the number of known nodes.
+ *
+ * @return Number of known nodes
+ */
+extern uint8_t vscp_node_table_getNum(void)
+{
+    return vscp_node_table_num;
+}
+
+/**
+ * This function copies the node table entry of a node.
+ *
+ * @param[in]   nickname    Nickname id of the node
+ * @param[out]  entry       Node table entry
+ * @return Node known or not
+ * @retval FALSE    Node unknown
+ * @retval TRUE     Node known, entry is valid
+ */
+extern BOOL vscp_node_table_getEntry(uint8_t nickname, vscp_node_table_Entry * const entry)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != entry) &&
+        (TRUE == vscp_node_table_isAlive(nickname)))
+    {
+        *entry = vscp_node_table_entries[nickname];
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function gets the next known node. Start the iteration with
+ * VSCP_NICKNAME_NOT_INIT.
+ *
+ * @param[in,out]   nickname    Nickname id of the last node, updated with the next one
+ * @return Next node found or not
+ * @retval FALSE    No further node
+ * @retval TRUE     Next node found
+ */
+extern BOOL vscp_node_table_getNext(uint8_t * const nickname)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL == nickname)
+    {
+        return FALSE;
+    }
+
+    /* VSCP_NICKNAME_NOT_INIT starts with the first nickname id. */
+    ++(*nickname);
+
+    while((FALSE == status) && (VSCP_NICKNAME_NOT_INIT != *nickname))
+    {
+        if (TRUE == vscp_node_table_isAlive(*nickname))
+        {
+            status = TRUE;
+        }
+        else
+        {
+            ++(*nickname);
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID )
+
+/**
+ * Learn the GUID of a node from its who is there response. The first rows
+ * contain the GUID, starting with the MSB.
+ *
+ * @param[in,out]   entry   Node table entry
+ * @param[in]       msg     Who is there response
+ */
+static void vscp_node_table_learnGuid(vscp_node_table_Entry * const entry, vscp_RxMessage const * const msg)
+{
+    uint8_t index       = 0;
+    uint8_t dataIndex   = 0;
+
+    if ((1 > msg->dataSize) ||
+        (VSCP_NODE_TABLE_GUID_ROWS <= msg->data[0]))
+    {
+        return;
+    }
+
+    dataIndex = msg->data[0] * (VSCP_L1_DATA_SIZE - 1);
+
+    for(index = 1; index < msg->dataSize; ++index)
+    {
+        if (VSCP_GUID_SIZE > dataIndex)
+        {
+            entry->guid[VSCP_GUID_SIZE - 1 - dataIndex] = msg->data[index];
+        }
+
+        ++dataIndex;
+    }
+
+    entry->flags |= (uint8_t)(VSCP_NODE_TABLE_FLAG_GUID_ROW0 << msg->data[0]);
+
+    if (VSCP_NODE_TABLE_FLAG_GUID_ROWS == (entry->flags & VSCP_NODE_TABLE_FLAG_GUID_ROWS))
+    {
+        entry->flags |= VSCP_NODE_TABLE_FLAG_GUID;
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
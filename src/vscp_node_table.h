@@ -0,0 +1,235 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP segment node table
+@file   vscp_node_table.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module keeps track of the other nodes of the segment, which are seen on
+the bus.
+
+*******************************************************************************/
+/** @defgroup vscp_node_table VSCP segment node table
+ * The core updates the node table with every received event. The table is
+ * indexed by the nickname id of the originator, so updating it takes constant
+ * time, independent of the number of nodes.
+ *
+ * Every entry contains the time (see vscp_node_table_getTime()), when the
+ * node was seen last, whether it is a hard-coded node and the observed
+ * period of its node heartbeats. If VSCP_CONFIG_ENABLE_NODE_TABLE_GUID is
+ * enabled, the GUID is learned from the who is there responses too.
+ *
+ * A node, which was not seen for VSCP_CONFIG_NODE_TABLE_EXPIRY seconds, is
+ * removed from the table. The expiry check runs incrementally with
+ * VSCP_CONFIG_NODE_TABLE_SWEEP_NUM entries per process cycle. The time is
+ * counted in seconds since initialization, so setting the time since epoch
+ * doesn't expire any node.
+ *
+ * Iterate over all known nodes in the following way:
+ * @code
+ * uint8_t nickname = VSCP_NICKNAME_NOT_INIT;
+ *
+ * while(TRUE == vscp_node_table_getNext(&nickname))
+ * {
+ *     ...
+ * }
+ * @endcode
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_NODE_TABLE
+ * - VSCP_CONFIG_ENABLE_NODE_TABLE_GUID
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_NODE_TABLE_H__
+#define __VSCP_NODE_TABLE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Node table entry flag: Node is known */
+#define VSCP_NODE_TABLE_FLAG_VALID          ((uint8_t)0x01)
+
+/** Node table entry flag: Node is a hard-coded node */
+#define VSCP_NODE_TABLE_FLAG_HARD_CODED     ((uint8_t)0x02)
+
+/** Node table entry flag: At least one node heartbeat was received */
+#define VSCP_NODE_TABLE_FLAG_HEARTBEAT      ((uint8_t)0x04)
+
+/** Node table entry flag: GUID is complete */
+#define VSCP_NODE_TABLE_FLAG_GUID           ((uint8_t)0x08)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type contains the information about a node of the segment. */
+typedef struct
+{
+    uint32_t    lastSeen;               /**< Time in s, when the node was seen last */
+    uint32_t    lastHeartbeat;          /**< Time in s of the last node heartbeat */
+    uint16_t    heartbeatPeriod;        /**< Observed node heartbeat period in s (0: unknown) */
+    uint8_t     flags;                  /**< Flags, see VSCP_NODE_TABLE_FLAG_... */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID )
+
+    uint8_t     guid[VSCP_GUID_SIZE];   /**< GUID, same byte order as vscp_dev_data_getGUID() */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE_GUID ) */
+
+} vscp_node_table_Entry;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE )
+
+/**
+ * This function initializes the module and clears the node table.
+ */
+extern void vscp_node_table_init(void);
+
+/**
+ * This function updates the node table with a received event.
+ * It will be called by the VSCP core for every received event.
+ *
+ * @param[in] msg   Received event message
+ */
+extern void vscp_node_table_update(vscp_RxMessage const * const msg);
+
+/**
+ * This function checks a part of the node table for expired nodes.
+ * It will be called by the VSCP core every process cycle.
+ */
+extern void vscp_node_table_process(void);
+
+/**
+ * This function shall be called once per second. It increases the time,
+ * which the node table is based on.
+ */
+extern void vscp_node_table_process1s(void);
+
+/**
+ * This function returns the time in s since initialization, which is used for
+ * the last seen and the last heartbeat time of the entries.
+ *
+ * @return Time in s
+ */
+extern uint32_t vscp_node_table_getTime(void);
+
+/**
+ * This function removes a node from the node table.
+ *
+ * @param[in] nickname  Nickname id of the node
+ */
+extern void vscp_node_table_remove(uint8_t nickname);
+
+/**
+ * This function returns whether a node is known, because it was seen on the
+ * bus and is not expired yet.
+ *
+ * @param[in] nickname  Nickname id of the node
+ * @return Node known or not
+ * @retval FALSE    Node unknown
+ * @retval TRUE     Node known
+ */
+extern BOOL vscp_node_table_isAlive(uint8_t nickname);
+
+/**
+ * This function returns the number of known nodes.
+ *
+ * @return Number of known nodes
+ */
+extern uint8_t vscp_node_table_getNum(void);
+
+/**
+ * This function copies the node table entry of a node.
+ *
+ * @param[in]   nickname    Nickname id of the node
+ * @param[out]  entry       Node table entry
+ * @return Node known or not
+ * @retval FALSE    Node unknown
+ * @retval TRUE     Node known, entry is valid
+ */
+extern BOOL vscp_node_table_getEntry(uint8_t nickname, vscp_node_table_Entry * const entry);
+
+/**
+ * This function gets the next known node. Start the iteration with
+ * VSCP_NICKNAME_NOT_INIT.
+ *
+ * @param[in,out]   nickname    Nickname id of the last node, updated with the next one
+ * @return Next node found or not
+ * @retval FALSE    No further node
+ * @retval TRUE     Next node found
+ */
+extern BOOL vscp_node_table_getNext(uint8_t * const nickname);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NODE_TABLE ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_NODE_TABLE_H__ */
+
+/** @} */
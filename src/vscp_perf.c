@@ -0,0 +1,370 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP performance probes
+@file   vscp_perf.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_perf.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_perf.h"
+#include "vscp_portable.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Register offset of the number of measurements */
+#define VSCP_PERF_REG_OFFSET_COUNT  (0)
+
+/** Register offset of the min. cycles */
+#define VSCP_PERF_REG_OFFSET_MIN    (4)
+
+/** Register offset of the max. cycles */
+#define VSCP_PERF_REG_OFFSET_MAX    (8)
+
+/** Register offset of the sum of cycles */
+#define VSCP_PERF_REG_OFFSET_SUM    (12)
+
+/** Register offset of the histogram */
+#define VSCP_PERF_REG_OFFSET_HIST   (16)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static uint8_t vscp_perf_getHistClass(uint32_t cycles);
+static uint8_t vscp_perf_readRegister(VSCP_PERF_PROBE probe, uint8_t offset);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Statistics of all probes */
+static vscp_perf_Stats  vscp_perf_stats[VSCP_PERF_PROBE_NUM];
+
+/** Cycle counter value at the start of the current measurement */
+static uint32_t         vscp_perf_start[VSCP_PERF_PROBE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module and resets all statistics.
+ */
+extern void vscp_perf_init(void)
+{
+    uint8_t probe   = 0;
+
+    for(probe = 0; probe < VSCP_PERF_PROBE_NUM; ++probe)
+    {
+        vscp_perf_reset((VSCP_PERF_PROBE)probe);
+        vscp_perf_start[probe] = 0;
+    }
+
+    return;
+}
+
+/**
+ * This function starts a measurement.
+ *
+ * @param[in] probe Probe
+ */
+extern void vscp_perf_enter(VSCP_PERF_PROBE probe)
+{
+    if (VSCP_PERF_PROBE_NUM > probe)
+    {
+        vscp_perf_start[probe] = vscp_portable_getCycleCount();
+    }
+
+    return;
+}
+
+/**
+ * This function stops a measurement and updates the statistics.
+ *
+ * @param[in] probe Probe
+ */
+extern void vscp_perf_exit(VSCP_PERF_PROBE probe)
+{
+    if (VSCP_PERF_PROBE_NUM > probe)
+    {
+        /* A single overflow of the cycle counter is handled by the unsigned arithmetic. */
+        uint32_t            cycles      = vscp_portable_getCycleCount() - vscp_perf_start[probe];
+        vscp_perf_Stats *   stats       = &vscp_perf_stats[probe];
+        uint8_t             histClass   = vscp_perf_getHistClass(cycles);
+
+        if (UINT32_MAX > stats->count)
+        {
+            ++stats->count;
+        }
+
+        if (stats->min > cycles)
+        {
+            stats->min = cycles;
+        }
+
+        if (stats->max < cycles)
+        {
+            stats->max = cycles;
+        }
+
+        if ((UINT32_MAX - stats->sum) < cycles)
+        {
+            stats->sum = UINT32_MAX;
+        }
+        else
+        {
+            stats->sum += cycles;
+        }
+
+        if (UINT16_MAX > stats->hist[histClass])
+        {
+            ++stats->hist[histClass];
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function gets the statistics of a probe.
+ *
+ * @param[in]   probe   Probe
+ * @param[out]  stats   Statistics
+ * @return Status
+ * @retval FALSE    Invalid parameter
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_perf_getStats(VSCP_PERF_PROBE probe, vscp_perf_Stats * const stats)
+{
+    BOOL    status  = FALSE;
+
+    if ((VSCP_PERF_PROBE_NUM > probe) &&
+        (NULL != stats))
+    {
+        *stats = vscp_perf_stats[probe];
+
+        /* No measurement yet */
+        if (0 == stats->count)
+        {
+            stats->min = 0;
+        }
+
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function resets the statistics of a probe.
+ *
+ * @param[in] probe Probe
+ */
+extern void vscp_perf_reset(VSCP_PERF_PROBE probe)
+{
+    if (VSCP_PERF_PROBE_NUM > probe)
+    {
+        vscp_perf_Stats *   stats       = &vscp_perf_stats[probe];
+        uint8_t             histClass   = 0;
+
+        stats->count    = 0;
+        stats->min      = UINT32_MAX;
+        stats->max      = 0;
+        stats->sum      = 0;
+
+        for(histClass = 0; histClass < VSCP_PERF_HIST_NUM; ++histClass)
+        {
+            stats->hist[histClass] = 0;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function reads one or more consecutive registers of the performance
+ * probe register page.
+ *
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+extern void vscp_perf_readRegisters(uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    if (NULL == buffer)
+    {
+        return;
+    }
+
+    for(index = 0; index < num; ++index)
+    {
+        uint16_t    regAddr = (uint16_t)addr + index;
+        uint16_t    probe   = regAddr / VSCP_PERF_PROBE_REG_NUM;
+
+        if (VSCP_PERF_PROBE_NUM > probe)
+        {
+            buffer[index] = vscp_perf_readRegister((VSCP_PERF_PROBE)probe, (uint8_t)(regAddr % VSCP_PERF_PROBE_REG_NUM));
+        }
+        else
+        {
+            buffer[index] = 0;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function writes a register of the performance probe register page,
+ * which resets the statistics of the corresponding probe.
+ *
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return Register value
+ */
+extern uint8_t vscp_perf_writeRegister(uint8_t addr, uint8_t value)
+{
+    uint8_t probe   = addr / VSCP_PERF_PROBE_REG_NUM;
+    uint8_t ret     = 0;
+
+    (void)value;
+
+    if (VSCP_PERF_PROBE_NUM > probe)
+    {
+        vscp_perf_reset((VSCP_PERF_PROBE)probe);
+
+        ret = vscp_perf_readRegister((VSCP_PERF_PROBE)probe, addr % VSCP_PERF_PROBE_REG_NUM);
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function determines the histogram class of a measurement.
+ *
+ * @param[in] cycles    Measured cycles
+ * @return Histogram class
+ */
+static uint8_t vscp_perf_getHistClass(uint32_t cycles)
+{
+    uint32_t    value   = cycles >> VSCP_CONFIG_PERF_HIST_SHIFT;
+    uint8_t     histClass   = 0;
+
+    while((0 < value) && ((VSCP_PERF_HIST_NUM - 1) > histClass))
+    {
+        value >>= 1;
+        ++histClass;
+    }
+
+    return histClass;
+}
+
+/**
+ * This function reads a single register of a probe.
+ *
+ * @param[in] probe     Probe
+ * @param[in] offset    Register offset in the probe registers
+ * @return Register value
+ */
+static uint8_t vscp_perf_readRegister(VSCP_PERF_PROBE probe, uint8_t offset)
+{
+    vscp_perf_Stats stats;
+    uint32_t        value   = 0;
+    uint8_t         shift   = 0;
+
+    (void)vscp_perf_getStats(probe, &stats);
+
+    if (VSCP_PERF_REG_OFFSET_HIST <= offset)
+    {
+        uint8_t histClass   = (offset - VSCP_PERF_REG_OFFSET_HIST) / 2;
+
+        value = stats.hist[histClass];
+        shift = (0 == (offset % 2)) ? 8 : 0;
+    }
+    else
+    {
+        if (VSCP_PERF_REG_OFFSET_SUM <= offset)
+        {
+            value = stats.sum;
+        }
+        else if (VSCP_PERF_REG_OFFSET_MAX <= offset)
+        {
+            value = stats.max;
+        }
+        else if (VSCP_PERF_REG_OFFSET_MIN <= offset)
+        {
+            value = stats.min;
+        }
+        else
+        {
+            value = stats.count;
+        }
+
+        /* MSB first */
+        shift = (3 - (offset % 4)) * 8;
+    }
+
+    return (uint8_t)((value >> shift) & 0xFF);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
@@ -0,0 +1,229 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP performance probes
+@file   vscp_perf.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module measures the execution time of the hot paths of the VSCP stack.
+
+*******************************************************************************/
+/** @defgroup vscp_perf VSCP performance probes
+ * A probe measures the execution time of a code section in cycles of a
+ * platform specific counter (see vscp_portable_getCycleCount()). The stack
+ * marks the sections with VSCP_PERF_ENTER() and VSCP_PERF_EXIT(). If the
+ * probes are disabled, the macros are empty and cost nothing.
+ *
+ * Every probe keeps the number of measurements, the min., max. and sum of
+ * the cycles and a histogram with VSCP_PERF_HIST_NUM classes. Class 0 counts
+ * the measurements below 2^VSCP_CONFIG_PERF_HIST_SHIFT cycles, every further
+ * class doubles the limit and the last class counts all others.
+ *
+ * The statistics are available via vscp_perf_getStats() and via the register
+ * page VSCP_CONFIG_PERF_PAGE. Every probe occupies VSCP_PERF_PROBE_REG_NUM
+ * registers, starting at probe * VSCP_PERF_PROBE_REG_NUM (all values MSB
+ * first):
+ * - Offset 0-3: Number of measurements
+ * - Offset 4-7: Min. cycles
+ * - Offset 8-11: Max. cycles
+ * - Offset 12-15: Sum of cycles (saturated)
+ * - Offset 16-31: Histogram, 16 bit per class (saturated)
+ *
+ * Writing any register of a probe resets its statistics.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_PERF_PROBES
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_PERF_H__
+#define __VSCP_PERF_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of histogram classes per probe */
+#define VSCP_PERF_HIST_NUM          (8)
+
+/** Number of registers per probe in the register page */
+#define VSCP_PERF_PROBE_REG_NUM     (32)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/** Start a measurement of the given probe. */
+#define VSCP_PERF_ENTER(__probe)    vscp_perf_enter(__probe)
+
+/** Stop a measurement of the given probe. */
+#define VSCP_PERF_EXIT(__probe)     vscp_perf_exit(__probe)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+/** Start a measurement of the given probe. */
+#define VSCP_PERF_ENTER(__probe)
+
+/** Stop a measurement of the given probe. */
+#define VSCP_PERF_EXIT(__probe)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the probes. */
+typedef enum
+{
+    VSCP_PERF_PROBE_CORE_PROCESS = 0,   /**< vscp_core_process() */
+    VSCP_PERF_PROBE_TP_READ,            /**< vscp_transport_readMessage() */
+    VSCP_PERF_PROBE_TP_WRITE,           /**< vscp_transport_writeMessage() */
+    VSCP_PERF_PROBE_DM,                 /**< vscp_dm_executeActions() */
+    VSCP_PERF_PROBE_DM_NG,              /**< vscp_dm_ng_executeActions() */
+    VSCP_PERF_PROBE_REG_READ,           /**< Register read */
+    VSCP_PERF_PROBE_REG_WRITE,          /**< Register write */
+    VSCP_PERF_PROBE_PS,                 /**< Persistent storage access */
+    VSCP_PERF_PROBE_NUM                 /**< Number of probes */
+
+} VSCP_PERF_PROBE;
+
+/** This type contains the statistics of a probe. */
+typedef struct
+{
+    uint32_t    count;                      /**< Number of measurements (saturated) */
+    uint32_t    min;                        /**< Min. cycles */
+    uint32_t    max;                        /**< Max. cycles */
+    uint32_t    sum;                        /**< Sum of cycles (saturated) */
+    uint16_t    hist[VSCP_PERF_HIST_NUM];   /**< Histogram (saturated) */
+
+} vscp_perf_Stats;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/**
+ * This function initializes the module and resets all statistics.
+ */
+extern void vscp_perf_init(void);
+
+/**
+ * This function starts a measurement.
+ *
+ * @param[in] probe Probe
+ */
+extern void vscp_perf_enter(VSCP_PERF_PROBE probe);
+
+/**
+ * This function stops a measurement and updates the statistics.
+ *
+ * @param[in] probe Probe
+ */
+extern void vscp_perf_exit(VSCP_PERF_PROBE probe);
+
+/**
+ * This function gets the statistics of a probe.
+ *
+ * @param[in]   probe   Probe
+ * @param[out]  stats   Statistics
+ * @return Status
+ * @retval FALSE    Invalid parameter
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_perf_getStats(VSCP_PERF_PROBE probe, vscp_perf_Stats * const stats);
+
+/**
+ * This function resets the statistics of a probe.
+ *
+ * @param[in] probe Probe
+ */
+extern void vscp_perf_reset(VSCP_PERF_PROBE probe);
+
+/**
+ * This function reads one or more consecutive registers of the performance
+ * probe register page.
+ *
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+extern void vscp_perf_readRegisters(uint8_t addr, uint8_t * const buffer, uint8_t num);
+
+/**
+ * This function writes a register of the performance probe register page,
+ * which resets the statistics of the corresponding probe.
+ *
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return Register value
+ */
+extern uint8_t vscp_perf_writeRegister(uint8_t addr, uint8_t value);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_PERF_H__ */
+
+/** @} */
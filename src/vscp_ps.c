@@ -42,6 +42,8 @@
 *******************************************************************************/
 #include "vscp_ps.h"
 #include "vscp_ps_access.h"
+#include "vscp_perf.h"
+#include "vscp_stats.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -63,6 +65,11 @@
     PROTOTYPES
 *******************************************************************************/
 
+static inline uint8_t vscp_ps_read8(uint16_t addr);
+static inline void vscp_ps_write8(uint16_t addr, uint8_t value);
+static inline void vscp_ps_readMultiple(uint16_t addr, uint8_t* const buffer, uint8_t size);
+static inline void vscp_ps_writeMultiple(uint16_t addr, const uint8_t* const buffer, uint8_t size);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -97,7 +104,7 @@ extern void vscp_ps_init(void)
  */
 extern uint8_t  vscp_ps_readBootFlag(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_BOOT_FLAG);
+    return vscp_ps_read8(VSCP_PS_ADDR_BOOT_FLAG);
 }
 
 /**
@@ -107,7 +114,7 @@ extern uint8_t  vscp_ps_readBootFlag(void)
  */
 extern void vscp_ps_writeBootFlag(uint8_t bootFlag)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_BOOT_FLAG, bootFlag);
+    vscp_ps_write8(VSCP_PS_ADDR_BOOT_FLAG, bootFlag);
     return;
 }
 
@@ -120,7 +127,7 @@ extern void vscp_ps_writeBootFlag(uint8_t bootFlag)
  */
 extern uint8_t  vscp_ps_readNicknameId(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NICKNAME);
+    return vscp_ps_read8(VSCP_PS_ADDR_NICKNAME);
 }
 
 /**
@@ -130,7 +137,7 @@ extern uint8_t  vscp_ps_readNicknameId(void)
  */
 extern void vscp_ps_writeNicknameId(uint8_t nickname)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NICKNAME, nickname);
+    vscp_ps_write8(VSCP_PS_ADDR_NICKNAME, nickname);
     return;
 }
 
@@ -143,7 +150,7 @@ extern void vscp_ps_writeNicknameId(uint8_t nickname)
  */
 extern uint8_t  vscp_ps_readSegmentControllerCRC(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC);
+    return vscp_ps_read8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC);
 }
 
 /**
@@ -153,7 +160,7 @@ extern uint8_t  vscp_ps_readSegmentControllerCRC(void)
  */
 extern void vscp_ps_writeSegmentControllerCRC(uint8_t crc)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC, crc);
+    vscp_ps_write8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC, crc);
     return;
 }
 
@@ -166,7 +173,7 @@ extern void vscp_ps_writeSegmentControllerCRC(uint8_t crc)
  */
 extern uint8_t  vscp_ps_readNodeControlFlags(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS);
+    return vscp_ps_read8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS);
 }
 
 /**
@@ -176,7 +183,7 @@ extern uint8_t  vscp_ps_readNodeControlFlags(void)
  */
 extern void vscp_ps_writeNodeControlFlags(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS, value);
+    vscp_ps_write8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS, value);
     return;
 }
 
@@ -193,7 +200,7 @@ extern uint8_t  vscp_ps_readUserId(uint8_t index)
 
     if (VSCP_PS_SIZE_USER_ID > index)
     {
-        data = vscp_ps_access_read8(VSCP_PS_ADDR_USER_ID + index);
+        data = vscp_ps_read8(VSCP_PS_ADDR_USER_ID + index);
     }
 
     return data;
@@ -210,7 +217,7 @@ extern void vscp_ps_writeUserId(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_USER_ID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_USER_ID + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_USER_ID + index, value);
     }
 
     return;
@@ -231,7 +238,7 @@ extern uint8_t  vscp_ps_readGUID(uint8_t index)
 
     if (VSCP_PS_SIZE_GUID > index)
     {
-        data = vscp_ps_access_read8(VSCP_PS_ADDR_GUID + index);
+        data = vscp_ps_read8(VSCP_PS_ADDR_GUID + index);
     }
 
     return data;
@@ -248,7 +255,7 @@ extern void vscp_ps_writeGUID(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_GUID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_GUID + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_GUID + index, value);
     }
 
     return;
@@ -265,7 +272,7 @@ extern void vscp_ps_writeGUID(uint8_t index, uint8_t value)
  */
 extern uint8_t  vscp_ps_readNodeZone(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NODE_ZONE);
+    return vscp_ps_read8(VSCP_PS_ADDR_NODE_ZONE);
 }
 
 /**
@@ -275,7 +282,7 @@ extern uint8_t  vscp_ps_readNodeZone(void)
  */
 extern void vscp_ps_writeNodeZone(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NODE_ZONE, value);
+    vscp_ps_write8(VSCP_PS_ADDR_NODE_ZONE, value);
     return;
 }
 
@@ -290,7 +297,7 @@ extern void vscp_ps_writeNodeZone(uint8_t value)
  */
 extern uint8_t  vscp_ps_readNodeSubZone(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NODE_SUB_ZONE);
+    return vscp_ps_read8(VSCP_PS_ADDR_NODE_SUB_ZONE);
 }
 
 /**
@@ -300,7 +307,7 @@ extern uint8_t  vscp_ps_readNodeSubZone(void)
  */
 extern void vscp_ps_writeNodeSubZone(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NODE_SUB_ZONE, value);
+    vscp_ps_write8(VSCP_PS_ADDR_NODE_SUB_ZONE, value);
     return;
 }
 
@@ -321,7 +328,7 @@ extern uint8_t  vscp_ps_readManufacturerDevId(uint8_t index)
 
     if (VSCP_PS_SIZE_MANUFACTURER_DEV_ID > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index);
     }
 
     return value;
@@ -338,7 +345,7 @@ extern void vscp_ps_writeManufacturerDevId(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_MANUFACTURER_DEV_ID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index, value);
     }
 
     return;
@@ -361,7 +368,7 @@ extern uint8_t  vscp_ps_readManufacturerSubDevId(uint8_t index)
 
     if (VSCP_PS_SIZE_MANUFACTURER_SUB_DEV_ID > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index);
     }
 
     return value;
@@ -378,7 +385,7 @@ extern void vscp_ps_writeManufacturerSubDevId(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_MANUFACTURER_SUB_DEV_ID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index, value);
     }
 
     return;
@@ -400,7 +407,7 @@ extern uint8_t  vscp_ps_readMdfUrl(uint8_t index)
 
     if (VSCP_PS_SIZE_MDF_URL > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_MDF_URL + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_MDF_URL + index);
     }
 
     return value;
@@ -417,7 +424,7 @@ extern void vscp_ps_writeMdfUrl(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_MDF_URL > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_MDF_URL + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_MDF_URL + index, value);
     }
 
     return;
@@ -440,7 +447,7 @@ extern uint8_t  vscp_ps_readStdDevFamilyCode(uint8_t index)
 
     if (VSCP_PS_SIZE_STD_DEV_FAMILY_CODE > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index);
     }
 
     return value;
@@ -457,7 +464,7 @@ extern void vscp_ps_writeStdDevFamilyCode(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_STD_DEV_FAMILY_CODE > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index, value);
     }
 
     return;
@@ -480,7 +487,7 @@ extern uint8_t  vscp_ps_readStdDevType(uint8_t index)
 
     if (VSCP_PS_SIZE_STD_DEV_TYPE > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_STD_DEV_TYPE + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_STD_DEV_TYPE + index);
     }
 
     return value;
@@ -497,7 +504,7 @@ extern void vscp_ps_writeStdDevType(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_STD_DEV_TYPE > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_STD_DEV_TYPE + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_STD_DEV_TYPE + index, value);
     }
 
     return;
@@ -514,7 +521,7 @@ extern void vscp_ps_writeStdDevType(uint8_t index, uint8_t value)
  */
 extern uint8_t  vscp_ps_readLogId(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_LOG_ID);
+    return vscp_ps_read8(VSCP_PS_ADDR_LOG_ID);
 }
 
 /**
@@ -524,7 +531,7 @@ extern uint8_t  vscp_ps_readLogId(void)
  */
 extern void vscp_ps_writeLogId(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_LOG_ID, value);
+    vscp_ps_write8(VSCP_PS_ADDR_LOG_ID, value);
     return;
 }
 
@@ -544,7 +551,7 @@ extern uint8_t  vscp_ps_readDM(uint16_t index)
 
     if (VSCP_PS_SIZE_DM > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_DM + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_DM + index);
     }
 
     return value;
@@ -560,7 +567,7 @@ extern void vscp_ps_writeDM(uint16_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_DM > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_DM + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_DM + index, value);
     }
 
     return;
@@ -580,7 +587,7 @@ extern void vscp_ps_readDMMultiple(uint16_t index, uint8_t* const buffer, uint8_
     {
         if (VSCP_PS_SIZE_DM >= (index + size))
         {
-            vscp_ps_access_readMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
+            vscp_ps_readMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
         }
     }
 
@@ -601,7 +608,7 @@ extern void vscp_ps_writeDMMultiple(uint16_t index, const uint8_t* const buffer,
     {
         if (VSCP_PS_SIZE_DM >= (index + size))
         {
-            vscp_ps_access_writeMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
+            vscp_ps_writeMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
         }
     }
 
@@ -622,7 +629,7 @@ extern uint8_t  vscp_ps_readDMExtension(uint16_t index)
 
     if (VSCP_PS_SIZE_DM_EXTENSION > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_DM_EXTENSION + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_DM_EXTENSION + index);
     }
 
     return value;
@@ -638,7 +645,7 @@ extern void vscp_ps_writeDMExtension(uint16_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_DM_EXTENSION > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_DM_EXTENSION + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_DM_EXTENSION + index, value);
     }
 
     return;
@@ -655,7 +662,7 @@ extern void vscp_ps_readDMExtensionMultiple(uint16_t index, uint8_t* const buffe
 {
     if (VSCP_PS_SIZE_DM_EXTENSION >= (index + size))
     {
-        vscp_ps_access_readMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
+        vscp_ps_readMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
     }
 
     return;
@@ -672,7 +679,7 @@ extern void vscp_ps_writeDMExtensionMultiple(uint16_t index, const uint8_t* cons
 {
     if (VSCP_PS_SIZE_DM_EXTENSION >= (index + size))
     {
-        vscp_ps_access_writeMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
+        vscp_ps_writeMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
     }
 
     return;
@@ -696,7 +703,7 @@ extern uint8_t  vscp_ps_readDMNextGeneration(uint16_t index)
 
     if (VSCP_PS_SIZE_DM_NEXT_GENERATION > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index);
+        value = vscp_ps_read8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index);
     }
 
     return value;
@@ -712,7 +719,7 @@ extern void vscp_ps_writeDMNextGeneration(uint16_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_DM_NEXT_GENERATION > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index, value);
+        vscp_ps_write8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index, value);
     }
 
     return;
@@ -723,3 +730,75 @@ extern void vscp_ps_writeDMNextGeneration(uint16_t index, uint8_t value)
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+/**
+ * Read a single byte from the persistent memory.
+ *
+ * @param[in]   addr    Address
+ * @return  Value
+ */
+static inline uint8_t vscp_ps_read8(uint16_t addr)
+{
+    uint8_t value   = 0;
+
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_PS);
+    value = vscp_ps_access_read8(addr);
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_PS);
+
+    VSCP_STATS_INC(VSCP_STATS_CNT_PS_READS);
+
+    return value;
+}
+
+/**
+ * Write a single byte to the persistent memory.
+ *
+ * @param[in]   addr    Address
+ * @param[in]   value   Value to write
+ */
+static inline void vscp_ps_write8(uint16_t addr, uint8_t value)
+{
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_PS);
+    vscp_ps_access_write8(addr, value);
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_PS);
+
+    VSCP_STATS_INC(VSCP_STATS_CNT_PS_WRITES);
+
+    return;
+}
+
+/**
+ * Read several bytes from the persistent memory.
+ *
+ * @param[in]   addr    Address
+ * @param[out]  buffer  Buffer which to read in
+ * @param[in]   size    Number of bytes to read
+ */
+static inline void vscp_ps_readMultiple(uint16_t addr, uint8_t* const buffer, uint8_t size)
+{
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_PS);
+    vscp_ps_access_readMultiple(addr, buffer, size);
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_PS);
+
+    VSCP_STATS_ADD(VSCP_STATS_CNT_PS_READS, size);
+
+    return;
+}
+
+/**
+ * Write several bytes to the persistent memory.
+ *
+ * @param[in]   addr    Address
+ * @param[in]   buffer  Buffer which to write
+ * @param[in]   size    Number of bytes to write
+ */
+static inline void vscp_ps_writeMultiple(uint16_t addr, const uint8_t* const buffer, uint8_t size)
+{
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_PS);
+    vscp_ps_access_writeMultiple(addr, buffer, size);
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_PS);
+
+    VSCP_STATS_ADD(VSCP_STATS_CNT_PS_WRITES, size);
+
+    return;
+}
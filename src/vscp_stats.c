@@ -0,0 +1,253 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP runtime statistics
+@file   vscp_stats.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_stats.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_stats.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Counters */
+static uint32_t vscp_stats_counters[VSCP_STATS_CNT_NUM];
+
+/** Snapshot of all counters, which is read via the register page */
+static uint32_t vscp_stats_snapshot[VSCP_STATS_CNT_NUM];
+
+/** Number of process cycles at the beginning of the current second */
+static uint32_t vscp_stats_processCycles1s  = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module and resets all counters.
+ */
+extern void vscp_stats_init(void)
+{
+    uint8_t cnt = 0;
+
+    for(cnt = 0; cnt < VSCP_STATS_CNT_NUM; ++cnt)
+    {
+        vscp_stats_counters[cnt] = 0;
+        vscp_stats_snapshot[cnt] = 0;
+    }
+
+    vscp_stats_processCycles1s = 0;
+
+    return;
+}
+
+/**
+ * This function increases a counter.
+ *
+ * @param[in] cnt   Counter
+ * @param[in] value Value to add
+ */
+extern void vscp_stats_add(VSCP_STATS_CNT cnt, uint32_t value)
+{
+    if (VSCP_STATS_CNT_NUM > cnt)
+    {
+        vscp_stats_counters[cnt] += value;
+    }
+
+    return;
+}
+
+/**
+ * This function updates a high-water mark.
+ *
+ * @param[in] cnt   Counter
+ * @param[in] value Current value
+ */
+extern void vscp_stats_max(VSCP_STATS_CNT cnt, uint32_t value)
+{
+    if (VSCP_STATS_CNT_NUM > cnt)
+    {
+        if (vscp_stats_counters[cnt] < value)
+        {
+            vscp_stats_counters[cnt] = value;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function counts the latency of a received event in the histogram
+ * and updates the max. latency.
+ *
+ * @param[in] latency   Latency in us
+ */
+extern void vscp_stats_latency(uint32_t latency)
+{
+    uint32_t    value       = latency >> VSCP_CONFIG_STATS_LATENCY_SHIFT;
+    uint8_t     histClass   = 0;
+
+    while((0 < value) && ((VSCP_STATS_LATENCY_HIST_NUM - 1) > histClass))
+    {
+        value >>= 1;
+        ++histClass;
+    }
+
+    ++vscp_stats_counters[VSCP_STATS_CNT_RX_LATENCY_HIST + histClass];
+
+    if (vscp_stats_counters[VSCP_STATS_CNT_RX_LATENCY_MAX] < latency)
+    {
+        vscp_stats_counters[VSCP_STATS_CNT_RX_LATENCY_MAX] = latency;
+    }
+
+    return;
+}
+
+/**
+ * This function shall be called once per second. It determines the number
+ * of process cycles in the last second.
+ */
+extern void vscp_stats_process1s(void)
+{
+    uint32_t    processCycles   = vscp_stats_counters[VSCP_STATS_CNT_PROCESS_CYCLES];
+
+    /* A wrap around of the process cycle counter is handled by the unsigned arithmetic. */
+    vscp_stats_counters[VSCP_STATS_CNT_PROCESS_CYCLES_1S] = processCycles - vscp_stats_processCycles1s;
+    vscp_stats_processCycles1s = processCycles;
+
+    return;
+}
+
+/**
+ * This function returns the current value of a counter.
+ *
+ * @param[in] cnt   Counter
+ * @return Counter value
+ */
+extern uint32_t vscp_stats_getCounter(VSCP_STATS_CNT cnt)
+{
+    uint32_t    value   = 0;
+
+    if (VSCP_STATS_CNT_NUM > cnt)
+    {
+        value = vscp_stats_counters[cnt];
+    }
+
+    return value;
+}
+
+/**
+ * This function reads one or more consecutive registers of the statistics
+ * register page. Reading register 0 takes a snapshot of all counters.
+ *
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+extern void vscp_stats_readRegisters(uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    if (NULL == buffer)
+    {
+        return;
+    }
+
+    if (0 == addr)
+    {
+        uint8_t cnt = 0;
+
+        for(cnt = 0; cnt < VSCP_STATS_CNT_NUM; ++cnt)
+        {
+            vscp_stats_snapshot[cnt] = vscp_stats_getCounter((VSCP_STATS_CNT)cnt);
+        }
+    }
+
+    for(index = 0; index < num; ++index)
+    {
+        uint16_t    regAddr = (uint16_t)addr + index;
+        uint16_t    cnt     = regAddr / VSCP_STATS_CNT_REG_NUM;
+
+        if (VSCP_STATS_CNT_NUM > cnt)
+        {
+            /* MSB first */
+            uint8_t shift   = (uint8_t)((VSCP_STATS_CNT_REG_NUM - 1 - (regAddr % VSCP_STATS_CNT_REG_NUM)) * 8);
+
+            buffer[index] = (uint8_t)((vscp_stats_snapshot[cnt] >> shift) & 0xFF);
+        }
+        else
+        {
+            buffer[index] = 0;
+        }
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
@@ -0,0 +1,234 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP runtime statistics
+@file   vscp_stats.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module counts the runtime events of the VSCP stack, e.g. the number of
+received and transmitted frames.
+
+*******************************************************************************/
+/** @defgroup vscp_stats VSCP runtime statistics
+ * The stack counts its runtime events with VSCP_STATS_INC() and
+ * VSCP_STATS_ADD() and tracks the queue fill levels with VSCP_STATS_MAX().
+ * If the statistics are disabled, the macros are empty and cost nothing.
+ *
+ * All counters are 32 bit wide and wrap around. The statistics are available
+ * via vscp_stats_getCounter() and via the register page
+ * VSCP_CONFIG_STATS_PAGE. Every counter occupies VSCP_STATS_CNT_REG_NUM
+ * registers, starting at counter * VSCP_STATS_CNT_REG_NUM (MSB first).
+ *
+ * Reading register 0 takes a snapshot of all counters and every register
+ * returns the value of the last snapshot. Therefore read the page always from
+ * register 0 on, to get consistent values, independent of how many frames
+ * are necessary for the response.
+ *
+ * With receive timestamps (VSCP_CONFIG_ENABLE_RX_TIMESTAMP) the latency
+ * between reception and processing by the core is counted in a histogram
+ * with VSCP_STATS_LATENCY_HIST_NUM classes. The first class counts the
+ * latencies below 2^VSCP_CONFIG_STATS_LATENCY_SHIFT us, every further class
+ * doubles the limit and the last class counts all remaining ones.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_STATS
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_STATS_H__
+#define __VSCP_STATS_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of registers per counter in the register page */
+#define VSCP_STATS_CNT_REG_NUM      (4)
+
+/** Number of receive latency histogram classes */
+#define VSCP_STATS_LATENCY_HIST_NUM (8)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+/** Increase a counter by one. */
+#define VSCP_STATS_INC(__cnt)           vscp_stats_add((__cnt), 1)
+
+/** Increase a counter by the given value. */
+#define VSCP_STATS_ADD(__cnt, __value)  vscp_stats_add((__cnt), (__value))
+
+/** Update a high-water mark with the given value. */
+#define VSCP_STATS_MAX(__cnt, __value)  vscp_stats_max((__cnt), (__value))
+
+/** Count a receive latency in us. */
+#define VSCP_STATS_LATENCY(__latency)   vscp_stats_latency(__latency)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+/** Increase a counter by one. */
+#define VSCP_STATS_INC(__cnt)
+
+/** Increase a counter by the given value. */
+#define VSCP_STATS_ADD(__cnt, __value)
+
+/** Update a high-water mark with the given value. */
+#define VSCP_STATS_MAX(__cnt, __value)
+
+/** Count a receive latency in us. */
+#define VSCP_STATS_LATENCY(__latency)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the counters. */
+typedef enum
+{
+    VSCP_STATS_CNT_RX_FRAMES = 0,       /**< Received frames */
+    VSCP_STATS_CNT_TX_FRAMES,           /**< Transmitted frames */
+    VSCP_STATS_CNT_RX_DROPS,            /**< Received frames, dropped because a receive queue is full */
+    VSCP_STATS_CNT_TX_ERRORS,           /**< Frames refused by the transport adapter */
+    VSCP_STATS_CNT_LOOPBACK_HWM,        /**< High-water mark of the loopback queue */
+    VSCP_STATS_CNT_LOGGER_HWM,          /**< High-water mark of the logger buffer */
+    VSCP_STATS_CNT_DM_ROWS,             /**< Evaluated decision matrix rows */
+    VSCP_STATS_CNT_DM_MATCHES,          /**< Matched decision matrix rows */
+    VSCP_STATS_CNT_DM_NG_RULES,         /**< Evaluated decision matrix next generation rules */
+    VSCP_STATS_CNT_DM_NG_MATCHES,       /**< Matched decision matrix next generation rules */
+    VSCP_STATS_CNT_ACTIONS,             /**< Actions executed by the decision matrices */
+    VSCP_STATS_CNT_PS_READS,            /**< Bytes read from the persistent memory */
+    VSCP_STATS_CNT_PS_WRITES,           /**< Bytes written to the persistent memory */
+    VSCP_STATS_CNT_PROCESS_CYCLES,      /**< vscp_core_process() calls */
+    VSCP_STATS_CNT_PROCESS_CYCLES_1S,   /**< vscp_core_process() calls in the last second */
+    VSCP_STATS_CNT_RX_LATENCY_MAX,      /**< Max. receive latency in us */
+    VSCP_STATS_CNT_RX_LATENCY_HIST,     /**< First receive latency histogram class */
+    VSCP_STATS_CNT_RX_LATENCY_HIST_END  = VSCP_STATS_CNT_RX_LATENCY_HIST + VSCP_STATS_LATENCY_HIST_NUM - 1, /**< Last receive latency histogram class */
+    VSCP_STATS_CNT_NUM                  /**< Number of counters */
+
+} VSCP_STATS_CNT;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS )
+
+/**
+ * This function initializes the module and resets all counters.
+ */
+extern void vscp_stats_init(void);
+
+/**
+ * This function increases a counter.
+ *
+ * @param[in] cnt   Counter
+ * @param[in] value Value to add
+ */
+extern void vscp_stats_add(VSCP_STATS_CNT cnt, uint32_t value);
+
+/**
+ * This function updates a high-water mark.
+ *
+ * @param[in] cnt   Counter
+ * @param[in] value Current value
+ */
+extern void vscp_stats_max(VSCP_STATS_CNT cnt, uint32_t value);
+
+/**
+ * This function counts the latency of a received event in the histogram
+ * and updates the max. latency.
+ * @param[in] latency   Latency in us
+ */
+extern void vscp_stats_latency(uint32_t latency);
+
+/**
+ * This function shall be called once per second. It determines the number
+ * of process cycles in the last second.
+ */
+extern void vscp_stats_process1s(void);
+
+/**
+ * This function returns the current value of a counter.
+ *
+ * @param[in] cnt   Counter
+ * @return Counter value
+ */
+extern uint32_t vscp_stats_getCounter(VSCP_STATS_CNT cnt);
+
+/**
+ * This function reads one or more consecutive registers of the statistics
+ * register page. Reading register 0 takes a snapshot of all counters.
+ *
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers
+ */
+extern void vscp_stats_readRegisters(uint8_t addr, uint8_t * const buffer, uint8_t num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_STATS ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_STATS_H__ */
+
+/** @} */
@@ -0,0 +1,423 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP time service
+@file   vscp_time.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_time.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_time.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+#include "vscp_portable.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of ms per second */
+#define VSCP_TIME_MS_PER_S      (1000)
+
+/** Parts per million */
+#define VSCP_TIME_PPM           ((int32_t)1000000)
+
+/** Only this part of an estimated drift is compensated at once, which filters the jitter of the reference. */
+#define VSCP_TIME_DRIFT_GAIN    (2)
+
+/** Limit of the error, which is accumulated for the drift estimation in ms */
+#define VSCP_TIME_DRIFT_ERR_MAX ((int32_t)2000)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_time_update(void);
+static void vscp_time_step(uint32_t timestamp, uint16_t ms);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Time since epoch in s */
+static uint32_t vscp_time_sec           = 0;
+
+/** Milliseconds of the current second */
+static uint16_t vscp_time_ms            = 0;
+
+/** Millisecond counter of the platform at the last update */
+static uint32_t vscp_time_localLast     = 0;
+
+/** Offset in ms, which is not corrected yet */
+static int32_t  vscp_time_slew          = 0;
+
+/** Elapsed ms, which were not used for slewing yet */
+static uint32_t vscp_time_slewElapsed   = 0;
+
+/** Frequency error of the platform clock in ppm */
+static int32_t  vscp_time_drift         = 0;
+
+/** Accumulated drift compensation in ppm * ms */
+static int32_t  vscp_time_driftAcc      = 0;
+
+/** Error in ms, which was accumulated in the current drift estimation window */
+static int32_t  vscp_time_driftErr      = 0;
+
+/** Elapsed ms of the current drift estimation window */
+static uint32_t vscp_time_driftWindow   = 0;
+
+/** Offset of the last synchronization in ms */
+static int32_t  vscp_time_offset        = 0;
+
+/** Clock synchronized at least once or not */
+static BOOL     vscp_time_isSynced      = FALSE;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the time service. The clock starts at 0 and
+ * is not synchronized.
+ */
+extern void vscp_time_init(void)
+{
+    vscp_time_localLast = vscp_portable_getMillis();
+    vscp_time_drift     = 0;
+    vscp_time_driftAcc  = 0;
+    vscp_time_offset    = 0;
+    vscp_time_isSynced  = FALSE;
+
+    vscp_time_step(0, 0);
+
+    return;
+}
+
+/**
+ * This function updates the clock. It will be called by the VSCP core every
+ * process cycle.
+ */
+extern void vscp_time_process(void)
+{
+    vscp_time_update();
+
+    return;
+}
+
+/**
+ * This function synchronizes the clock with a reference time, e.g. of the
+ * segment controller heartbeat.
+ *
+ * @param[in] timestamp Reference time since epoch in s
+ */
+extern void vscp_time_sync(uint32_t timestamp)
+{
+    int32_t diffSec = 0;
+    int32_t offset  = 0;
+
+    vscp_time_update();
+
+    diffSec = (int32_t)(timestamp - vscp_time_sec);
+
+    /* Avoid an overflow of the offset calculation. */
+    if ((VSCP_CONFIG_TIME_STEP_THRESHOLD / VSCP_TIME_MS_PER_S + 1) < diffSec)
+    {
+        diffSec = VSCP_CONFIG_TIME_STEP_THRESHOLD / VSCP_TIME_MS_PER_S + 1;
+    }
+    else if (-(VSCP_CONFIG_TIME_STEP_THRESHOLD / VSCP_TIME_MS_PER_S + 1) > diffSec)
+    {
+        diffSec = -(VSCP_CONFIG_TIME_STEP_THRESHOLD / VSCP_TIME_MS_PER_S + 1);
+    }
+
+    offset = diffSec * VSCP_TIME_MS_PER_S + (int32_t)VSCP_CONFIG_TIME_REF_LATENCY - (int32_t)vscp_time_ms;
+
+    if ((FALSE == vscp_time_isSynced) ||
+        (VSCP_CONFIG_TIME_STEP_THRESHOLD < offset) ||
+        (-VSCP_CONFIG_TIME_STEP_THRESHOLD > offset))
+    {
+        vscp_time_step(timestamp, VSCP_CONFIG_TIME_REF_LATENCY);
+        vscp_time_offset    = 0;
+        vscp_time_isSynced  = TRUE;
+    }
+    else
+    {
+        /* The pending correction is still applied, only the rest is new. */
+        vscp_time_driftErr += offset - vscp_time_slew;
+
+        if (VSCP_TIME_DRIFT_ERR_MAX < vscp_time_driftErr)
+        {
+            vscp_time_driftErr = VSCP_TIME_DRIFT_ERR_MAX;
+        }
+        else if (-VSCP_TIME_DRIFT_ERR_MAX > vscp_time_driftErr)
+        {
+            vscp_time_driftErr = -VSCP_TIME_DRIFT_ERR_MAX;
+        }
+
+        vscp_time_slew      = offset;
+        vscp_time_offset    = offset;
+
+        /* End of the drift estimation window? */
+        if (((uint32_t)VSCP_CONFIG_TIME_DRIFT_WINDOW * VSCP_TIME_MS_PER_S) <= vscp_time_driftWindow)
+        {
+            int32_t drift   = (vscp_time_driftErr * (VSCP_TIME_PPM / VSCP_TIME_MS_PER_S)) / (int32_t)(vscp_time_driftWindow / VSCP_TIME_MS_PER_S);
+
+            vscp_time_drift += drift / VSCP_TIME_DRIFT_GAIN;
+
+            if (VSCP_CONFIG_TIME_DRIFT_MAX < vscp_time_drift)
+            {
+                vscp_time_drift = VSCP_CONFIG_TIME_DRIFT_MAX;
+            }
+            else if (-VSCP_CONFIG_TIME_DRIFT_MAX > vscp_time_drift)
+            {
+                vscp_time_drift = -VSCP_CONFIG_TIME_DRIFT_MAX;
+            }
+
+            vscp_time_driftErr      = 0;
+            vscp_time_driftWindow   = 0;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function sets the clock directly.
+ *
+ * @param[in] timestamp Time since epoch in s
+ * @param[in] ms        Milliseconds of the current second
+ */
+extern void vscp_time_set(uint32_t timestamp, uint16_t ms)
+{
+    vscp_time_update();
+    vscp_time_step(timestamp, ms);
+
+    return;
+}
+
+/**
+ * This function gets the current time.
+ *
+ * @param[out] timestamp    Time since epoch in s
+ * @param[out] ms           Milliseconds of the current second
+ */
+extern void vscp_time_get(uint32_t * const timestamp, uint16_t * const ms)
+{
+    vscp_time_update();
+
+    if (NULL != timestamp)
+    {
+        *timestamp = vscp_time_sec;
+    }
+
+    if (NULL != ms)
+    {
+        *ms = vscp_time_ms;
+    }
+
+    return;
+}
+
+/**
+ * This function gets the current time since epoch in s.
+ *
+ * @return Time since epoch in s
+ */
+extern uint32_t vscp_time_getTimeSinceEpoch(void)
+{
+    vscp_time_update();
+
+    return vscp_time_sec;
+}
+
+/**
+ * This function gets a millisecond timestamp of the current time. It's the
+ * time since epoch in ms, truncated to 32 bit, which overflows after
+ * ~49 days.
+ *
+ * @return Timestamp in ms
+ */
+extern uint32_t vscp_time_getTimestamp(void)
+{
+    vscp_time_update();
+
+    return vscp_time_sec * VSCP_TIME_MS_PER_S + vscp_time_ms;
+}
+
+/**
+ * This function returns whether the clock was synchronized at least once.
+ *
+ * @return Synchronized or not
+ * @retval FALSE    Not synchronized
+ * @retval TRUE     Synchronized
+ */
+extern BOOL vscp_time_isSynchronized(void)
+{
+    return vscp_time_isSynced;
+}
+
+/**
+ * This function returns the offset to the reference time, measured at the
+ * last synchronization, which was corrected by slewing.
+ *
+ * @return Offset in ms (positive: the clock was late)
+ */
+extern int32_t vscp_time_getOffset(void)
+{
+    return vscp_time_offset;
+}
+
+/**
+ * This function returns the estimated frequency error of the platform clock,
+ * which is compensated.
+ *
+ * @return Drift in ppm (positive: the platform clock is slow)
+ */
+extern int32_t vscp_time_getDrift(void)
+{
+    return vscp_time_drift;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Advance the clock by the elapsed time of the platform clock, incl. the
+ * drift compensation and the slewing.
+ */
+static void vscp_time_update(void)
+{
+    uint32_t    now         = vscp_portable_getMillis();
+    uint32_t    elapsed     = now - vscp_time_localLast;
+    int32_t     delta       = 0;
+    int32_t     correction  = 0;
+
+    if (0 == elapsed)
+    {
+        return;
+    }
+
+    vscp_time_localLast     = now;
+    vscp_time_driftWindow  += elapsed;
+    delta                   = (int32_t)elapsed;
+
+    /* Drift compensation */
+    vscp_time_driftAcc += delta * vscp_time_drift;
+    correction          = vscp_time_driftAcc / VSCP_TIME_PPM;
+    vscp_time_driftAcc -= correction * VSCP_TIME_PPM;
+    delta              += correction;
+
+    /* Slewing */
+    if (0 != vscp_time_slew)
+    {
+        vscp_time_slewElapsed  += elapsed;
+        correction              = (int32_t)(vscp_time_slewElapsed / VSCP_CONFIG_TIME_SLEW_DIV);
+        vscp_time_slewElapsed  -= (uint32_t)correction * VSCP_CONFIG_TIME_SLEW_DIV;
+
+        if (0 < vscp_time_slew)
+        {
+            if (vscp_time_slew < correction)
+            {
+                correction = vscp_time_slew;
+            }
+
+            vscp_time_slew -= correction;
+            delta          += correction;
+        }
+        else
+        {
+            if (-vscp_time_slew < correction)
+            {
+                correction = -vscp_time_slew;
+            }
+
+            vscp_time_slew += correction;
+            delta          -= correction;
+        }
+    }
+    else
+    {
+        vscp_time_slewElapsed = 0;
+    }
+
+    /* The clock never runs backwards. */
+    if (0 < delta)
+    {
+        delta += vscp_time_ms;
+
+        vscp_time_sec  += (uint32_t)delta / VSCP_TIME_MS_PER_S;
+        vscp_time_ms    = (uint16_t)((uint32_t)delta % VSCP_TIME_MS_PER_S);
+    }
+
+    return;
+}
+
+/**
+ * Set the clock directly and discard a pending correction.
+ *
+ * @param[in] timestamp Time since epoch in s
+ * @param[in] ms        Milliseconds of the current second
+ */
+static void vscp_time_step(uint32_t timestamp, uint16_t ms)
+{
+    vscp_time_sec           = timestamp + ms / VSCP_TIME_MS_PER_S;
+    vscp_time_ms            = ms % VSCP_TIME_MS_PER_S;
+    vscp_time_slew          = 0;
+    vscp_time_slewElapsed   = 0;
+    vscp_time_driftErr      = 0;
+    vscp_time_driftWindow   = 0;
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
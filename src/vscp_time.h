@@ -0,0 +1,198 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP time service
+@file   vscp_time.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides the segment time with millisecond resolution.
+
+*******************************************************************************/
+/** @defgroup vscp_time VSCP time service
+ * The time service runs a clock with millisecond resolution, which is driven
+ * by the free running millisecond counter of the platform (see
+ * vscp_portable_getMillis()). It is independent of the process cycle of the
+ * core, therefore no drift is accumulated by the main loop latency.
+ *
+ * The segment controller heartbeat is used as reference. Its time since epoch
+ * is taken as the begin of the second plus VSCP_CONFIG_TIME_REF_LATENCY ms,
+ * so the segment controller shall send it at the second boundary.
+ *
+ * - The first reference and every offset above VSCP_CONFIG_TIME_STEP_THRESHOLD
+ *   ms set the clock directly (step).
+ * - Smaller offsets are corrected by slewing: the clock runs up to
+ *   1 / VSCP_CONFIG_TIME_SLEW_DIV faster or slower, until the offset is
+ *   compensated. The clock never runs backwards.
+ * - The offsets of VSCP_CONFIG_TIME_DRIFT_WINDOW s are used to estimate the
+ *   frequency error of the platform clock, which is compensated continuously
+ *   afterwards (max. +/- VSCP_CONFIG_TIME_DRIFT_MAX ppm).
+ *
+ * vscp_time_getTimestamp() is cheap enough to timestamp every received event.
+ * All functions shall be called in the same context as vscp_core_process().
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_TIME_SERVICE
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_TIME_H__
+#define __VSCP_TIME_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+/**
+ * This function initializes the time service. The clock starts at 0 and
+ * is not synchronized.
+ */
+extern void vscp_time_init(void);
+
+/**
+ * This function updates the clock. It will be called by the VSCP core every
+ * process cycle.
+ */
+extern void vscp_time_process(void);
+
+/**
+ * This function synchronizes the clock with a reference time, e.g. of the
+ * segment controller heartbeat.
+ *
+ * @param[in] timestamp Reference time since epoch in s
+ */
+extern void vscp_time_sync(uint32_t timestamp);
+
+/**
+ * This function sets the clock directly.
+ *
+ * @param[in] timestamp Time since epoch in s
+ * @param[in] ms        Milliseconds of the current second
+ */
+extern void vscp_time_set(uint32_t timestamp, uint16_t ms);
+
+/**
+ * This function gets the current time.
+ *
+ * @param[out] timestamp    Time since epoch in s
+ * @param[out] ms           Milliseconds of the current second
+ */
+extern void vscp_time_get(uint32_t * const timestamp, uint16_t * const ms);
+
+/**
+ * This function gets the current time since epoch in s.
+ *
+ * @return Time since epoch in s
+ */
+extern uint32_t vscp_time_getTimeSinceEpoch(void);
+
+/**
+ * This function gets a millisecond timestamp of the current time. It's the
+ * time since epoch in ms, truncated to 32 bit, which overflows after
+ * ~49 days.
+ *
+ * @return Timestamp in ms
+ */
+extern uint32_t vscp_time_getTimestamp(void);
+
+/**
+ * This function returns whether the clock was synchronized at least once.
+ *
+ * @return Synchronized or not
+ * @retval FALSE    Not synchronized
+ * @retval TRUE     Synchronized
+ */
+extern BOOL vscp_time_isSynchronized(void);
+
+/**
+ * This function returns the offset to the reference time, measured at the
+ * last synchronization, which was corrected by slewing.
+ *
+ * @return Offset in ms (positive: the clock was late)
+ */
+extern int32_t vscp_time_getOffset(void);
+
+/**
+ * This function returns the estimated frequency error of the platform clock,
+ * which is compensated.
+ *
+ * @return Drift in ppm (positive: the platform clock is slow)
+ */
+extern int32_t vscp_time_getDrift(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_TIME_H__ */
+
+/** @} */
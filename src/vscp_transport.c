@@ -45,6 +45,9 @@
 #include "vscp_config.h"
 #include "vscp_util.h"
 #include "vscp_class_l1.h"
+#include "vscp_perf.h"
+#include "vscp_stats.h"
+#include "vscp_portable.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -66,6 +69,12 @@
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+static inline void vscp_transport_writeLoopBack(void const * const msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -73,6 +82,9 @@
 /** Transmit error counter, counts every message, which couldn't be sent. */
 static uint8_t                  vscp_txErrorCnt = 0;
 
+/** Free running transmit error counter, which wraps around. */
+static uint8_t                  vscp_txErrorCounter = 0;
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
 /** Cyclic buffer instance for VSCP event loopback. */
@@ -124,6 +136,8 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
 {
     BOOL    status  = FALSE;
 
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_TP_READ);
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
     if (NULL != msg)
@@ -148,11 +162,20 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
         {
             /* Write any received message from the lower layer to the loopback. */
             vscp_RxMessage  rxMsg;
-            BOOL            received = vscp_tp_adapter_readMessage(&rxMsg);
+            BOOL            received = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+            /* The transport adapter may overwrite it with an earlier timestamp. */
+            rxMsg.timestamp = vscp_portable_getMicros();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+            received = vscp_tp_adapter_readMessage(&rxMsg);
 
             if (TRUE == received)
             {
-                (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, &rxMsg, 1);
+                vscp_transport_writeLoopBack(&rxMsg);
             }
 
             status = TRUE;
@@ -160,6 +183,13 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
         else
         /* No message in the loopback, maybe one is received from lower layer. */
         {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+            /* The transport adapter may overwrite it with an earlier timestamp. */
+            msg->timestamp = vscp_portable_getMicros();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
             status = vscp_tp_adapter_readMessage(msg);
         }
 
@@ -167,10 +197,27 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+    if (NULL != msg)
+    {
+        /* The transport adapter may overwrite it with an earlier timestamp. */
+        msg->timestamp = vscp_portable_getMicros();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
     status = vscp_tp_adapter_readMessage(msg);
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
+    if (FALSE != status)
+    {
+        VSCP_STATS_INC(VSCP_STATS_CNT_RX_FRAMES);
+    }
+
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_TP_READ);
+
     return status;
 }
 
@@ -186,6 +233,8 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
 {
     BOOL    status  = FALSE;
 
+    VSCP_PERF_ENTER(VSCP_PERF_PROBE_TP_WRITE);
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
     if ((NULL != msg) &&                        /* Message shall exists */
@@ -198,7 +247,19 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
         if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) &&
             (VSCP_CLASS_L1_LOG != msg->vscpClass))
         {
-            (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, msg, 1);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+            /* The looped back event is received now. */
+            vscp_RxMessage  rxMsg   = *msg;
+
+            rxMsg.timestamp = vscp_portable_getMicros();
+            vscp_transport_writeLoopBack(&rxMsg);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+            vscp_transport_writeLoopBack(msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
         }
 
         status = vscp_tp_adapter_writeMessage(msg);
@@ -217,11 +278,125 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
         {
             ++vscp_txErrorCnt;
         }
+
+        ++vscp_txErrorCounter;
+
+        VSCP_STATS_INC(VSCP_STATS_CNT_TX_ERRORS);
+    }
+    else
+    {
+        VSCP_STATS_INC(VSCP_STATS_CNT_TX_FRAMES);
+    }
+
+    VSCP_PERF_EXIT(VSCP_PERF_PROBE_TP_WRITE);
+
+    return status;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/**
+ * This function reads a level 2 message from the transport layer.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_transport_readL2Message(vscp_L2RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL != msg)
+    {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+        /* The transport adapter may overwrite it with an earlier timestamp. */
+        msg->timestamp = vscp_portable_getMicros();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+        status = vscp_tp_adapter_readL2Message(msg);
+
+        /* Number of data bytes is limited */
+        if ((FALSE != status) &&
+            (VSCP_CONFIG_L2_DATA_SIZE < msg->dataSize))
+        {
+            status = FALSE;
+        }
+    }
+
+    if (FALSE != status)
+    {
+        VSCP_STATS_INC(VSCP_STATS_CNT_RX_FRAMES);
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a level 2 message to the transport layer.
+ * Note, level 2 messages are not looped back.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_transport_writeL2Message(vscp_L2TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&                                /* Message shall exists */
+        (VSCP_CONFIG_L2_DATA_SIZE >= msg->dataSize))    /* Number of data bytes is limited */
+    {
+        status = vscp_tp_adapter_writeL2Message(msg);
+    }
+
+    /* Count every transmit error */
+    if (FALSE == status)
+    {
+        if (255 > vscp_txErrorCnt)
+        {
+            ++vscp_txErrorCnt;
+        }
+
+        ++vscp_txErrorCounter;
+
+        VSCP_STATS_INC(VSCP_STATS_CNT_TX_ERRORS);
+    }
+    else
+    {
+        VSCP_STATS_INC(VSCP_STATS_CNT_TX_FRAMES);
     }
 
     return status;
 }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the CAN controller.
+ * An event is accepted, if it passes any of the filters.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_transport_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    if ((NULL != filters) ||
+        (0 == num))
+    {
+        vscp_tp_adapter_setAcceptanceFilters(filters, num);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /**
  * This function returns the number of transmit errors.
  * Note, that calling this function clears the transmit error counter.
@@ -237,6 +412,42 @@ extern uint8_t  vscp_transport_getTransmitErrors(void)
     return num;
 }
 
+/**
+ * This function returns the free running transmit error counter. In contrast
+ * to vscp_transport_getTransmitErrors() it is not cleared, but wraps around.
+ * Use the difference of two calls to determine the transmit errors in between.
+ *
+ * @return Free running transmit error counter
+ */
+extern uint8_t  vscp_transport_getTransmitErrorCounter(void)
+{
+    return vscp_txErrorCounter;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+/**
+ * Write a message to the loopback. If the loopback is full, the message is
+ * dropped.
+ *
+ * @param[in]   msg Message
+ */
+static inline void vscp_transport_writeLoopBack(void const * const msg)
+{
+    if (0 == vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, msg, 1))
+    {
+        VSCP_STATS_INC(VSCP_STATS_CNT_RX_DROPS);
+    }
+    else
+    {
+        VSCP_STATS_MAX(VSCP_STATS_CNT_LOOPBACK_HWM, vscp_util_cyclicBufferGetNum(&vscp_transport_loopBackCyclicBuffer));
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
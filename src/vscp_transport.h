@@ -124,6 +124,44 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg);
  */
 extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/**
+ * This function reads a level 2 message from the transport layer.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_transport_readL2Message(vscp_L2RxMessage * const msg);
+
+/**
+ * This function writes a level 2 message to the transport layer.
+ * Note, level 2 messages are not looped back.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_transport_writeL2Message(vscp_L2TxMessage const * const msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the CAN controller.
+ * An event is accepted, if it passes any of the filters.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_transport_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /**
  * This function returns the number of transmit errors.
  * Note, that calling this function clears the transmit error counter.
@@ -132,6 +170,15 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg);
  */
 extern uint8_t  vscp_transport_getTransmitErrors(void);
 
+/**
+ * This function returns the free running transmit error counter. In contrast
+ * to vscp_transport_getTransmitErrors() it is not cleared, but wraps around.
+ * Use the difference of two calls to determine the transmit errors in between.
+ *
+ * @return Free running transmit error counter
+ */
+extern uint8_t  vscp_transport_getTransmitErrorCounter(void);
+
 #ifdef __cplusplus
 }
 #endif
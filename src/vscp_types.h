@@ -54,6 +54,7 @@ This module contains VSCP specific type, structure and constant definitions.
 #include <stdint.h>
 #include <stdlib.h>
 #include "vscp_platform.h"
+#include "vscp_config.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -312,6 +313,12 @@ typedef struct
     /*@reldef@*/
     uint8_t         data[VSCP_L1_DATA_SIZE];    /**< Data */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+    uint32_t        timestamp;                  /**< Receive timestamp in us (only receive messages) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
 } vscp_Message;
 
 /** This type defines a VSCP receive message. */
@@ -320,6 +327,50 @@ typedef vscp_Message vscp_RxMessage;
 /** This type defines a VSCP transmit message. */
 typedef vscp_Message vscp_TxMessage;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/** This type defines a VSCP level 2 message. */
+typedef struct
+{
+    VSCP_PRIORITY   priority;                           /**< Message priority */
+    uint16_t        vscpClass;                          /**< VSCP class */
+    uint16_t        vscpType;                           /**< VSCP type */
+    uint8_t         guid[VSCP_GUID_SIZE];               /**< GUID of the originator, MSB first */
+    uint16_t        dataSize;                           /**< Number used of data bytes */
+    uint8_t         data[VSCP_CONFIG_L2_DATA_SIZE];     /**< Data */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+    uint32_t        timestamp;                          /**< Receive timestamp in us (only receive messages) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+} vscp_L2Message;
+
+/** This type defines a VSCP level 2 receive message. */
+typedef vscp_L2Message vscp_L2RxMessage;
+
+/** This type defines a VSCP level 2 transmit message. */
+typedef vscp_L2Message vscp_L2TxMessage;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/** This type defines an acceptance filter for the 29 bit CAN identifier of a
+ * VSCP event: priority (bit 26-28), hard-coded (bit 25), class (bit 16-24),
+ * type (bit 8-15) and originator nickname (bit 0-7). An event is accepted,
+ * if (identifier & mask) == id.
+ */
+typedef struct
+{
+    uint32_t    id;     /**< Identifier, only the bits set in the mask are valid */
+    uint32_t    mask;   /**< Mask, a set bit shall match */
+
+} vscp_AcceptanceFilter;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /** This type defines the different information lamp states. */
 typedef enum
 {
@@ -314,6 +314,64 @@ extern uint8_t vscp_util_cyclicBufferWrite(vscp_util_CyclicBuffer * const cbuffe
     return written;
 }
 
+/**
+ * This function returns the number of elements in a cyclic buffer.
+ *
+ * @param[in]   cbuffer     Cyclic buffer context
+ * @return Number of elements
+ */
+extern uint8_t vscp_util_cyclicBufferGetNum(vscp_util_CyclicBuffer const * const cbuffer)
+{
+    uint8_t num = 0;
+
+    if ((NULL != cbuffer) &&
+        (0 < cbuffer->num))
+    {
+        num = (uint8_t)((cbuffer->writeIndex + cbuffer->num - cbuffer->readIndex) % cbuffer->num);
+    }
+
+    return num;
+}
+
+/**
+ * This function calculates a CRC-16 (CCITT, polynom 0x1021) over a buffer.
+ * The calculation can be done stepwise, by passing the result of the previous
+ * call as start value. Start with VSCP_UTIL_CRC16_INIT.
+ *
+ * @param[in]   crc     Start value
+ * @param[in]   data    Data buffer
+ * @param[in]   size    Data buffer size in byte
+ * @return CRC-16
+ */
+extern uint16_t vscp_util_crc16(uint16_t crc, uint8_t const * const data, uint16_t size)
+{
+    if (NULL != data)
+    {
+        uint16_t    index   = 0;
+
+        for(index = 0; index < size; ++index)
+        {
+            uint8_t bit = 0;
+
+            crc ^= ((uint16_t)data[index]) << 8;
+
+            for(bit = 0; bit < 8; ++bit)
+            {
+                if (0 != (crc & 0x8000))
+                {
+                    crc = (uint16_t)((crc << 1) ^ 0x1021);
+                }
+                else
+                {
+                    crc = (uint16_t)(crc << 1);
+                }
+            }
+        }
+    }
+
+    return crc;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
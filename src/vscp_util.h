@@ -70,6 +70,9 @@ extern "C"
     CONSTANTS
 *******************************************************************************/
 
+/** Initial value of a CRC-16 calculation, see vscp_util_crc16(). */
+#define VSCP_UTIL_CRC16_INIT                    ((uint16_t)0xFFFF)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -89,6 +92,16 @@ extern "C"
 /** LSB of a word */
 #define VSCP_UTIL_WORD_LSB(__word)              ((uint8_t)(((__word) >> 0) & 0xff))
 
+/** Read a 16 bit value in big endian byte order from a byte buffer. */
+#define VSCP_UTIL_READ_UINT16_BE(__buffer)      ((uint16_t)(((uint16_t)(__buffer)[0] << 8) | \
+                                                            ((uint16_t)(__buffer)[1] << 0)))
+
+/** Read a 32 bit value in big endian byte order from a byte buffer. */
+#define VSCP_UTIL_READ_UINT32_BE(__buffer)      ((uint32_t)(((uint32_t)(__buffer)[0] << 24) | \
+                                                            ((uint32_t)(__buffer)[1] << 16) | \
+                                                            ((uint32_t)(__buffer)[2] <<  8) | \
+                                                            ((uint32_t)(__buffer)[3] <<  0)))
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -161,6 +174,26 @@ extern uint8_t vscp_util_cyclicBufferRead(vscp_util_CyclicBuffer * const cbuffer
  */
 extern uint8_t vscp_util_cyclicBufferWrite(vscp_util_CyclicBuffer * const cbuffer, void const * const elem, uint8_t maxNum);
 
+/**
+ * This function returns the number of elements in a cyclic buffer.
+ *
+ * @param[in]   cbuffer     Cyclic buffer context
+ * @return Number of elements
+ */
+extern uint8_t vscp_util_cyclicBufferGetNum(vscp_util_CyclicBuffer const * const cbuffer);
+
+/**
+ * This function calculates a CRC-16 (CCITT, polynom 0x1021) over a buffer.
+ * The calculation can be done stepwise, by passing the result of the previous
+ * call as start value. Start with VSCP_UTIL_CRC16_INIT.
+ *
+ * @param[in]   crc     Start value
+ * @param[in]   data    Data buffer
+ * @param[in]   size    Data buffer size in byte
+ * @return CRC-16
+ */
+extern uint16_t vscp_util_crc16(uint16_t crc, uint8_t const * const data, uint16_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,157 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP boot loader flash access driver
+@file   vscp_boot_flash.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the flash access driver, which is used by the boot loader
+engine.
+
+*******************************************************************************/
+/** @defgroup vscp_boot_flash Boot loader flash access driver
+ * The boot loader engine uses the flash access driver to write the received
+ * blocks to the memory and to activate the new image.
+ *
+ * Because this is usually device specific, the flash access has to be
+ * implemented by the user.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_BOOT_FLASH_H__
+#define __VSCP_BOOT_FLASH_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the flash access driver.
+ * It doesn't write anything in the flash! It only initializes the module that
+ * write access is possible.
+ */
+extern void vscp_boot_flash_init(void);
+
+/**
+ * Get the number of blocks, which are available for the new image.
+ * The block size is VSCP_CONFIG_BOOT_BLOCK_SIZE.
+ *
+ * @return Number of blocks
+ */
+extern uint32_t vscp_boot_flash_getBlockCount(void);
+
+/**
+ * Check whether a block can be programmed.
+ *
+ * @param[in]   memType Memory type (see VSCP_BOOT_MEM_TYPE_xxx)
+ * @param[in]   block   Block number
+ * @return Valid or not
+ * @retval FALSE    Invalid block
+ * @retval TRUE     Valid block
+ */
+extern BOOL vscp_boot_flash_isBlockValid(uint8_t memType, uint32_t block);
+
+/**
+ * Write a complete block to the memory. If necessary, the memory area shall
+ * be erased before.
+ *
+ * @param[in]   memType Memory type (see VSCP_BOOT_MEM_TYPE_xxx)
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block data size in byte
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_write(uint8_t memType, uint32_t block, uint8_t const * const data, uint16_t size);
+
+/**
+ * Activate the new image. It will be started after the next reset, which is
+ * requested by the VSCP core.
+ *
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_activate(void);
+
+/**
+ * Abort the firmware update. The current image shall stay active.
+ *
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_abort(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_BOOT_FLASH_H__ */
+
+/** @} */
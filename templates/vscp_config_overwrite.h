@@ -78,12 +78,16 @@ extern "C"
 
 #define VSCP_CONFIG_HEARTBEAT_NODE              VSCP_CONFIG_BASE_ENABLED
 
+#define VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER     VSCP_CONFIG_BASE_DISABLED
+
 #define VSCP_CONFIG_IDLE_CALLOUT                VSCP_CONFIG_BASE_DISABLED
 
 #define VSCP_CONFIG_ERROR_CALLOUT               VSCP_CONFIG_BASE_DISABLED
 
 #define VSCP_CONFIG_BOOT_LOADER_SUPPORTED       VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_BOOT_LOADER_ENGINE          VSCP_CONFIG_BASE_DISABLED
+
 #define VSCP_CONFIG_ENABLE_DM                   VSCP_CONFIG_BASE_ENABLED
 
 #define VSCP_CONFIG_DM_PAGED_FEATURE            VSCP_CONFIG_BASE_DISABLED
@@ -100,6 +104,34 @@ extern "C"
 
 #define VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT     VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_ENABLE_BULK_WRITE           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_GUID_START  VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE_GUID      VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_TIME_SERVICE         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_RX_TIMESTAMP         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_L2                   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_EMBEDDED_MDF         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_BUFFER        VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_TRACE         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_PERF_PROBES          VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_STATS                VSCP_CONFIG_BASE_DISABLED
+
 */
 
 /*******************************************************************************
@@ -116,8 +148,64 @@ extern "C"
 
 #define VSCP_CONFIG_MULTI_MSG_TIMEOUT           ((uint16_t)1000)
 
+#define VSCP_CONFIG_MULTI_FRAME_RSP_BURST       8
+
+#define VSCP_CONFIG_MULTI_FRAME_RSP_PACING      ((uint16_t)0)
+
 #define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
 
+#define VSCP_CONFIG_HEARTBEAT_NODE_JITTER       ((uint16_t)3000)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX 3
+
+#define VSCP_CONFIG_BOOT_BLOCK_SIZE             ((uint16_t)256)
+
+#define VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW       8
+
+#define VSCP_CONFIG_BULK_WRITE_SIZE             ((uint16_t)128)
+
+#define VSCP_CONFIG_BULK_WRITE_ACK_WINDOW       8
+
+#define VSCP_CONFIG_BULK_WRITE_TIMEOUT          ((uint8_t)5)
+
+#define VSCP_CONFIG_LOGGER_BUFFER_NUM           16
+
+#define VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE     2
+
+#define VSCP_CONFIG_LOGGER_RATE_LIMIT           ((uint8_t)10)
+
+#define VSCP_CONFIG_LOGGER_RATE_BURST           ((uint8_t)20)
+
+#define VSCP_CONFIG_LOGGER_TRACE_ID             ((uint8_t)0xFF)
+
+#define VSCP_CONFIG_PERF_PAGE                   ((uint16_t)0xFFF1)
+
+#define VSCP_CONFIG_PERF_HIST_SHIFT             6
+
+#define VSCP_CONFIG_STATS_PAGE                  ((uint16_t)0xFFF0)
+
+#define VSCP_CONFIG_STATS_LATENCY_SHIFT         8
+
+#define VSCP_CONFIG_NODE_TABLE_EXPIRY           ((uint16_t)180)
+
+#define VSCP_CONFIG_NODE_TABLE_SWEEP_NUM        4
+
+#define VSCP_CONFIG_L2_DATA_SIZE                512
+
+#define VSCP_CONFIG_TIME_REF_LATENCY            1
+
+#define VSCP_CONFIG_TIME_STEP_THRESHOLD         1000
+
+#define VSCP_CONFIG_TIME_SLEW_DIV               20
+
+#define VSCP_CONFIG_TIME_DRIFT_WINDOW           60
+
+#define VSCP_CONFIG_TIME_DRIFT_MAX              500
+
+#define VSCP_CONFIG_ACCEPTANCE_FILTER_NUM       4
+
+#define VSCP_CONFIG_ACCEPTANCE_SUBSCRIPTION_NUM 4
+
 #define VSCP_CONFIG_DM_PAGE                     1
 
 #define VSCP_CONFIG_DM_OFFSET                   0
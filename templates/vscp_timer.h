@@ -42,6 +42,10 @@ This module implements the VSCP timers.
  * timers. If the timers are handled in an interrupt service routine or a
  * different task, than the one which calls vscp_core_process(), don't forget
  * to make the timer functions reentrant.
+ *
+ * The core creates 5 timers during initialization and one more, if the node
+ * heartbeat (VSCP_CONFIG_HEARTBEAT_NODE) is enabled. The driver has to provide
+ * at least this number of timers, otherwise the core initialization fails.
  * @{
  */
 
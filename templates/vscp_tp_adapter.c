@@ -87,6 +87,11 @@ extern void vscp_tp_adapter_init(void)
 /**
  * This function reads a message from the transport layer.
  *
+ * If receive timestamps are enabled (VSCP_CONFIG_ENABLE_RX_TIMESTAMP), the
+ * timestamp of the message storage is already set to the current time.
+ * Overwrite it, if the message was received earlier, e.g. with the timestamp
+ * taken in the receive interrupt (see vscp_portable_getMicros()).
+ *
  * @param[out]  msg Message storage
  * @return  Message received or not
  * @retval  FALSE   No message received
@@ -127,6 +132,75 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
     return status;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/**
+ * This function reads a level 2 message from the transport layer.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_tp_adapter_readL2Message(vscp_L2RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL != msg)
+    {
+        /* Implement your code here ... */
+
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a level 2 message to the transport layer.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_tp_adapter_writeL2Message(vscp_L2TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL != msg)
+    {
+        /* Implement your code here ... */
+
+    }
+
+    return status;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER )
+
+/**
+ * This function programs the acceptance filters into the CAN controller.
+ * An event is accepted, if it passes any of the filters.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_tp_adapter_setAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    if ((NULL != filters) ||
+        (0 == num))
+    {
+        /* Implement your code here ... */
+
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
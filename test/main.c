@@ -145,6 +145,11 @@ int main(int argc, char* argv[])
         (void)CU_add_test(pSuite, "Enter boot loader (wrong data)", vscp_test_active16);
         (void)CU_add_test(pSuite, "Enter boot loader", vscp_test_active17);
 
+        pSuite  = CU_add_suite("Boot loader engine", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Pipelined block transfer and abort", vscp_test_active40);
+        (void)CU_add_test(pSuite, "Program block and activate new image", vscp_test_active41);
+
         pSuite  = CU_add_suite("GUID drop nickname part 1", vscp_test_initActive, NULL);
         (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
         (void)CU_add_test(pSuite, "Drop nickname and reset", vscp_test_active18);
@@ -155,6 +160,12 @@ int main(int argc, char* argv[])
         (void)CU_add_test(pSuite, "Read page (7 byte)", vscp_test_active20);
         (void)CU_add_test(pSuite, "Read page (8 byte)", vscp_test_active21);
         (void)CU_add_test(pSuite, "Write page (4 byte)", vscp_test_active22);
+        (void)CU_add_test(pSuite, "Read page across register regions", vscp_test_active36);
+
+        pSuite  = CU_add_suite("Bulk configuration write", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Stream and commit decision matrix NG", vscp_test_active42);
+        (void)CU_add_test(pSuite, "Sequence error and refused commit", vscp_test_active43);
 
         pSuite  = CU_add_suite("Increment/Decrement register", NULL, NULL);
         (void)CU_add_test(pSuite, "Increment register", vscp_test_active23);
@@ -163,6 +174,7 @@ int main(int argc, char* argv[])
         pSuite  = CU_add_suite("Who is there?", NULL, NULL);
         (void)CU_add_test(pSuite, "Who is there? (all)", vscp_test_active25);
         (void)CU_add_test(pSuite, "Who is there? (node addressed)", vscp_test_active26);
+        (void)CU_add_test(pSuite, "Who is there? (blocked transport layer)", vscp_test_active39);
 
         pSuite  = CU_add_suite("Decision matrix access", NULL, NULL);
         (void)CU_add_test(pSuite, "Get decision matrix info (matrix exists)", vscp_test_active28);
@@ -183,21 +195,79 @@ int main(int argc, char* argv[])
         (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
         (void)CU_add_test(pSuite, "Extended page read", vscp_test_active31);
         (void)CU_add_test(pSuite, "Extended page write", vscp_test_active32);
+        (void)CU_add_test(pSuite, "Extended page read in a burst", vscp_test_active37);
+        (void)CU_add_test(pSuite, "Extended page read with blocked transport layer", vscp_test_active38);
+        (void)CU_add_test(pSuite, "Extended page read across the decision matrices", vscp_test_active46);
 
         pSuite  = CU_add_suite("Node heartbeat", vscp_test_initActive, NULL);
         (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
         (void)CU_add_test(pSuite, "Node heartbeat", vscp_test_active33);
 
+        pSuite  = CU_add_suite("Node heartbeat jitter", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Node heartbeat jitter and back off", vscp_test_active44);
+
         pSuite  = CU_add_suite("Transparent sending of events", NULL, NULL);
         (void)CU_add_test(pSuite, "Prepare tx message and send event", vscp_test_active34);
 
         pSuite  = CU_add_suite("Application gets events from the core", NULL, NULL);
         (void)CU_add_test(pSuite, "Receive transparent events", vscp_test_active35);
 
+        pSuite  = CU_add_suite("Nickname occupancy map", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Probe only nicknames, which were not observed", vscp_test_active45);
+
+        pSuite  = CU_add_suite("Buffered logger", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Send log messages in the background", vscp_test_logger01);
+        (void)CU_add_test(pSuite, "Drop, rate limit and flush log messages", vscp_test_logger02);
+        (void)CU_add_test(pSuite, "Send binary trace records", vscp_test_logger03);
+
+        pSuite  = CU_add_suite("Performance probes", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Measure, read and reset probes", vscp_test_perf01);
+
+        pSuite  = CU_add_suite("Runtime statistics", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Count and read statistics", vscp_test_stats01);
+        (void)CU_add_test(pSuite, "Receive latency histogram", vscp_test_stats02);
+
+        pSuite  = CU_add_suite("Segment node table", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Track the nodes of the segment", vscp_test_nodeTable01);
+
+        pSuite  = CU_add_suite("Time service", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Slew and compensate drift", vscp_test_time01);
+
+        pSuite  = CU_add_suite("Level 2 events", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Receive and send level 2 events", vscp_test_l2_01);
+
+        pSuite  = CU_add_suite("Embedded MDF", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Stream the compressed embedded MDF", vscp_test_mdf01);
+
+        pSuite  = CU_add_suite("Acceptance filter", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Calculate and program the acceptance filters", vscp_test_filter01);
+
         pSuite  = CU_add_suite("Decision matrix next generation", vscp_test_initDMNG, NULL);
         (void)CU_add_test(pSuite, "Send class information, type button event with parameter \"all released\".", vscp_test_dmNG01);
         (void)CU_add_test(pSuite, "Send class information, type button event with parameter \"pressed\".", vscp_test_dmNG02);
 
+        pSuite  = CU_add_suite("Data coding", NULL, NULL);
+        (void)CU_add_test(pSuite, "Decode normalized integer", vscp_test_dataCoding01);
+        (void)CU_add_test(pSuite, "Decode normalized integer to floating point", vscp_test_dataCoding02);
+        (void)CU_add_test(pSuite, "Decode several measurement events", vscp_test_dataCoding03);
+        (void)CU_add_test(pSuite, "Encode and decode all representations", vscp_test_dataCoding04);
+        (void)CU_add_test(pSuite, "Encode most compact representation", vscp_test_dataCoding05);
+        (void)CU_add_test(pSuite, "Encode shortest normalized integer", vscp_test_dataCoding06);
+
+        pSuite  = CU_add_suite("Event parser", NULL, NULL);
+        (void)CU_add_test(pSuite, "Parse information events", vscp_test_evtParse01);
+        (void)CU_add_test(pSuite, "Parse measurement events with common frame layout", vscp_test_evtParse02);
+
         CU_basic_set_mode(CU_BRM_VERBOSE);
         
         if (CUE_SUCCESS != CU_basic_run_tests())
@@ -0,0 +1,237 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP boot loader flash access driver
+@file   vscp_boot_flash.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_boot_flash.h
+
+The flash is emulated by a file, which is located in the current working
+directory.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_boot_flash.h"
+#include "vscp_boot.h"
+#include "vscp_config.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Temporary file which emulates the flash, it is removed at program exit. */
+static FILE*    vscp_boot_flash_file    = NULL;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the flash access driver.
+ * It doesn't write anything in the flash! It only initializes the module that
+ * write access is possible.
+ */
+extern void vscp_boot_flash_init(void)
+{
+    if (NULL != vscp_boot_flash_file)
+    {
+        (void)fclose(vscp_boot_flash_file);
+    }
+
+    /* Start always with an empty flash. */
+    vscp_boot_flash_file = tmpfile();
+
+    return;
+}
+
+/**
+ * Get the number of blocks, which are available for the new image.
+ * The block size is VSCP_CONFIG_BOOT_BLOCK_SIZE.
+ *
+ * @return Number of blocks
+ */
+extern uint32_t vscp_boot_flash_getBlockCount(void)
+{
+    return VSCP_BOOT_FLASH_BLOCK_COUNT;
+}
+
+/**
+ * Check whether a block can be programmed.
+ *
+ * @param[in]   memType Memory type (see VSCP_BOOT_MEM_TYPE_xxx)
+ * @param[in]   block   Block number
+ * @return Valid or not
+ * @retval FALSE    Invalid block
+ * @retval TRUE     Valid block
+ */
+extern BOOL vscp_boot_flash_isBlockValid(uint8_t memType, uint32_t block)
+{
+    BOOL    isValid = FALSE;
+
+    if ((VSCP_BOOT_MEM_TYPE_PROGRAM == memType) &&
+        (VSCP_BOOT_FLASH_BLOCK_COUNT > block))
+    {
+        isValid = TRUE;
+    }
+
+    return isValid;
+}
+
+/**
+ * Write a complete block to the memory. If necessary, the memory area shall
+ * be erased before.
+ *
+ * @param[in]   memType Memory type (see VSCP_BOOT_MEM_TYPE_xxx)
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block data size in byte
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_write(uint8_t memType, uint32_t block, uint8_t const * const data, uint16_t size)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != vscp_boot_flash_file) &&
+        (NULL != data) &&
+        (TRUE == vscp_boot_flash_isBlockValid(memType, block)))
+    {
+        long    offset  = (long)block * VSCP_CONFIG_BOOT_BLOCK_SIZE;
+
+        if ((0 == fseek(vscp_boot_flash_file, offset, SEEK_SET)) &&
+            (size == fwrite(data, 1, size, vscp_boot_flash_file)) &&
+            (0 == fflush(vscp_boot_flash_file)))
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Activate the new image. It will be started after the next reset, which is
+ * requested by the VSCP core.
+ *
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_activate(void)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL != vscp_boot_flash_file)
+    {
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * Abort the firmware update. The current image shall stay active.
+ *
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_abort(void)
+{
+    return TRUE;
+}
+
+/**
+ * Read a complete block from the emulated flash.
+ * This function is only used by the tests to verify the written blocks.
+ *
+ * @param[in]   block   Block number
+ * @param[out]  data    Block data buffer
+ * @param[in]   size    Block data buffer size in byte
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_boot_flash_read(uint32_t block, uint8_t * const data, uint16_t size)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != vscp_boot_flash_file) &&
+        (NULL != data) &&
+        (VSCP_BOOT_FLASH_BLOCK_COUNT > block))
+    {
+        long    offset  = (long)block * VSCP_CONFIG_BOOT_BLOCK_SIZE;
+
+        if ((0 == fseek(vscp_boot_flash_file, offset, SEEK_SET)) &&
+            (size == fread(data, 1, size, vscp_boot_flash_file)))
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
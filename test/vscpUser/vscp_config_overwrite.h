@@ -77,12 +77,16 @@ extern "C"
 
 #define VSCP_CONFIG_HEARTBEAT_NODE              VSCP_CONFIG_BASE_ENABLED
 
+#define VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER     VSCP_CONFIG_BASE_ENABLED
+
 #define VSCP_CONFIG_IDLE_CALLOUT                VSCP_CONFIG_BASE_ENABLED
 
 #define VSCP_CONFIG_ERROR_CALLOUT               VSCP_CONFIG_BASE_ENABLED
 
 #define VSCP_CONFIG_BOOT_LOADER_SUPPORTED       VSCP_CONFIG_BASE_ENABLED
 
+#define VSCP_CONFIG_BOOT_LOADER_ENGINE          VSCP_CONFIG_BASE_ENABLED
+
 #define VSCP_CONFIG_ENABLE_DM                   VSCP_CONFIG_BASE_ENABLED
 
 #define VSCP_CONFIG_DM_PAGED_FEATURE            VSCP_CONFIG_BASE_DISABLED
@@ -97,6 +101,32 @@ extern "C"
 
 #define VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_ENABLE_BULK_WRITE           VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE           VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE_GUID      VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_TIME_SERVICE         VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_RX_TIMESTAMP         VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_L2                   VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_EMBEDDED_MDF         VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_BUFFER        VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_TRACE         VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_PERF_PROBES          VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_STATS                VSCP_CONFIG_BASE_ENABLED
+
 /*
 #define VSCP_CONFIG_ENABLE_LOGGER               VSCP_CONFIG_BASE_DISABLED
 
@@ -108,12 +138,16 @@ extern "C"
 
 #define VSCP_CONFIG_HEARTBEAT_NODE              VSCP_CONFIG_BASE_ENABLED
 
+#define VSCP_CONFIG_ENABLE_HEARTBEAT_JITTER     VSCP_CONFIG_BASE_DISABLED
+
 #define VSCP_CONFIG_IDLE_CALLOUT                VSCP_CONFIG_BASE_DISABLED
 
 #define VSCP_CONFIG_ERROR_CALLOUT               VSCP_CONFIG_BASE_DISABLED
 
 #define VSCP_CONFIG_BOOT_LOADER_SUPPORTED       VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_BOOT_LOADER_ENGINE          VSCP_CONFIG_BASE_DISABLED
+
 #define VSCP_CONFIG_ENABLE_DM                   VSCP_CONFIG_BASE_ENABLED
 
 #define VSCP_CONFIG_DM_PAGED_FEATURE            VSCP_CONFIG_BASE_DISABLED
@@ -130,6 +164,34 @@ extern "C"
 
 #define VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT     VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_ENABLE_BULK_WRITE           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NICKNAME_GUID_START  VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_NODE_TABLE_GUID      VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_TIME_SERVICE         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_RX_TIMESTAMP         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_L2                   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_EMBEDDED_MDF         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_ACCEPTANCE_FILTER    VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_BUFFER        VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_TRACE         VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_PERF_PROBES          VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_STATS                VSCP_CONFIG_BASE_DISABLED
+
 */
 
 /*******************************************************************************
@@ -146,6 +208,10 @@ extern "C"
 
 #define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
 
+#define VSCP_CONFIG_HEARTBEAT_NODE_JITTER       ((uint16_t)3000)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_BACK_OFF_MAX 3
+
 #define VSCP_CONFIG_DM_PAGE                     1
 
 #define VSCP_CONFIG_DM_OFFSET                   250
@@ -158,6 +224,10 @@ extern "C"
 
 #define VSCP_CONFIG_LOOPBACK_STORAGE_NUM        10
 
+#define VSCP_CONFIG_NODE_TABLE_EXPIRY           ((uint16_t)5)
+
+#define VSCP_CONFIG_TIME_DRIFT_WINDOW           10
+
 /*
 
 #define VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT   ((uint16_t)5000)
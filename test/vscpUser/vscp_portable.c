@@ -40,9 +40,16 @@
 /*******************************************************************************
     INCLUDES
 *******************************************************************************/
+
+/* clock_gettime() is part of POSIX. */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif  /* _POSIX_C_SOURCE */
+
 #include "vscp_portable.h"
 #include "vscp_core.h"
 #include "vscp_stubs.h"
+#include <time.h>
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -191,6 +198,24 @@ extern void vscp_portable_provideEvent(vscp_RxMessage const * const msg)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 )
+
+/**
+ * This function provides received level 2 events, which are not handled by
+ * the core, e.g. because they are not level 1 events over level 2 addressed
+ * to this node.
+ *
+ * @param[in]   msg Level 2 message
+ */
+extern void vscp_portable_provideL2Event(vscp_L2RxMessage const * const msg)
+{
+    vscp_test_portableProvideL2Event(msg);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_L2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION )
 
 /**
@@ -273,6 +298,75 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent() {
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES )
+
+/**
+ * Get the current value of a free running cycle counter, which is used by the
+ * performance probes. It shall have the highest available resolution and may
+ * overflow.
+ *
+ * @return Cycle counter value
+ */
+extern uint32_t vscp_portable_getCycleCount(void)
+{
+    struct timespec now;
+
+    /* Nanoseconds are used instead of cycles. */
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((uint32_t)now.tv_sec * 1000000000u + (uint32_t)now.tv_nsec);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PERF_PROBES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE )
+
+/**
+ * Get the current value of a free running millisecond counter, which drives
+ * the time service. It may overflow.
+ *
+ * @return Millisecond counter value
+ */
+extern uint32_t vscp_portable_getMillis(void)
+{
+    return vscp_test_portableGetMillis();
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TIME_SERVICE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP )
+
+/**
+ * Get the current value of a free running microsecond counter, which is used
+ * for the receive timestamps. It may overflow.
+ *
+ * @return Microsecond counter value
+ */
+extern uint32_t vscp_portable_getMicros(void)
+{
+    return vscp_test_portableGetMicros();
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_RX_TIMESTAMP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF )
+
+/**
+ * Read a byte of the embedded MDF blob, which is generated by
+ * tools/scripts/vscp_mdf_compress.py and usually stored in flash.
+ * If no embedded MDF is available, 0 shall be returned.
+ *
+ * @param[in] index Index in the blob
+ *
+ * @return Value
+ */
+extern uint8_t vscp_portable_readEmbeddedMdf(uint16_t index)
+{
+    return vscp_test_portableReadEmbeddedMdf(index);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EMBEDDED_MDF ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -91,6 +91,9 @@ extern void vscp_test_appRegInit(void);
 extern void vscp_test_tpAdatperInit(void);
 extern BOOL vscp_test_tpAdatperReadMessage(vscp_RxMessage * const msg);
 extern BOOL vscp_test_tpAdatperWriteMessage(vscp_TxMessage const * const msg);
+extern BOOL vscp_test_tpAdatperReadL2Message(vscp_L2RxMessage * const msg);
+extern BOOL vscp_test_tpAdatperWriteL2Message(vscp_L2TxMessage const * const msg);
+extern void vscp_test_tpAdatperSetAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num);
 
 extern void vscp_test_portableInit(void);
 extern void vscp_test_portableRestoreFactoryDefaultSettings(void);
@@ -107,8 +110,12 @@ extern uint8_t  vscp_test_portableGetPagesUsed(void);
 extern void vscp_test_portableBootLoaderRequest(void);
 extern uint8_t  vscp_test_portableGetMdfUrl(uint8_t index);
 extern void vscp_test_portableProvideEvent(vscp_RxMessage const * const msg);
+extern void vscp_test_portableProvideL2Event(vscp_L2RxMessage const * const msg);
 extern void vscp_test_portableUpdateTimeSinceEpoch(uint32_t timestamp);
 extern void vscp_test_portableSetLampState(VSCP_LAMP_STATE state);
+extern uint8_t  vscp_test_portableReadEmbeddedMdf(uint16_t index);
+extern uint32_t vscp_test_portableGetMillis(void);
+extern uint32_t vscp_test_portableGetMicros(void);
 
 extern void vscp_test_actionInit(void);
 extern void vscp_test_actionExecute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg);
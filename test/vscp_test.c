@@ -43,9 +43,11 @@
 #include "vscp_test.h"
 #include <stdint.h>
 #include <string.h>
+#include <math.h>
 #include "CUnit.h"
 #include "vscp_core.h"
 #include "vscp_ps.h"
+#include "vscp_transport.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_protocol.h"
 #include "vscp_type_information.h"
@@ -53,6 +55,22 @@
 #include "vscp_dev_data.h"
 #include "vscp_dm_ng.h"
 #include "vscp_timer.h"
+#include "vscp_data_coding.h"
+#include "vscp_evt_information.h"
+#include "vscp_evt_measurement.h"
+#include "vscp_util.h"
+#include "vscp_boot.h"
+#include "vscp_boot_flash.h"
+#include "vscp_logger.h"
+#include "vscp_type_log.h"
+#include "vscp_perf.h"
+#include "vscp_stats.h"
+#include "vscp_node_table.h"
+#include "vscp_time.h"
+#include "vscp_l2.h"
+#include "vscp_mdf.h"
+#include "vscp_filter.h"
+#include "vscp_class_l1_l2.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -155,6 +173,8 @@ typedef enum
     VSCP_TEST_CALL_COUNTER_TP_ADAPTER_INIT,
     VSCP_TEST_CALL_COUNTER_TP_ADAPTER_READ_MESSAGE,
     VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE,
+    VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_L2_MESSAGE,
+    VSCP_TEST_CALL_COUNTER_TP_ADAPTER_SET_ACCEPTANCE_FILTERS,
 
     VSCP_TEST_CALL_COUNTER_PORTABLE_INIT,
     VSCP_TEST_CALL_COUNTER_PORTABLE_CREATE_TIMER,
@@ -166,6 +186,7 @@ typedef enum
     VSCP_TEST_CALL_COUNTER_PORTABLE_BOOT_LOADER_REQUEST,
     VSCP_TEST_CALL_COUNTER_PORTABLE_SET_LAMP_STATE,
     VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_EVENT,
+    VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_L2_EVENT,
     VSCP_TEST_CALL_COUNTER_PORTABLE_UPDATE_TIME_SINCE_EPOCH,
 
     VSCP_TEST_CALL_COUNTER_PS_ACCESS_INIT,
@@ -184,6 +205,7 @@ typedef enum
     VSCP_TEST_TIMER_2,
     VSCP_TEST_TIMER_3,
     VSCP_TEST_TIMER_4,
+    VSCP_TEST_TIMER_5,
 
     VSCP_TEST_TIMER_SIZE
 
@@ -215,9 +237,13 @@ typedef struct
 
 static void vscp_test_initTestCase(void);
 static void vscp_test_waitForTxMessage(uint8_t min, uint16_t max);
+static uint32_t vscp_test_waitForHeartbeat(uint32_t max);
 static void vscp_test_processTimers(void);
 static uint8_t  vscp_test_readRegister(uint8_t addr);
 static uint8_t  vscp_test_writeRegister(uint8_t addr, uint8_t value, BOOL readOnly);
+static void vscp_test_receiveSegCtrlHeartbeat(uint32_t timestamp);
+static uint16_t vscp_test_receiveEmbeddedMdf(uint8_t * const buffer, uint16_t size, uint16_t index);
+static BOOL vscp_test_isAccepted(vscp_AcceptanceFilter const * const filters, uint8_t num, uint16_t vscpClass, uint8_t vscpType, uint8_t oAddr);
 
 static uint8_t  vscp_test_getAlarmStatus(uint8_t value);
 static uint8_t  vscp_test_getControlFlags(uint8_t value);
@@ -243,6 +269,12 @@ static vscp_TxMessage   vscp_test_txMessage[VSCP_TEST_TX_MSG_NUM];
 /** Transmit message counter */
 static uint8_t          vscp_test_txMessageCnt      = 0;
 
+/** If set, the transport layer adapter refuses all transmit messages. */
+static BOOL             vscp_test_isTxBlocked       = FALSE;
+
+/** Boot loader algorithm of the node */
+static uint8_t          vscp_test_bootLoaderAlgorithm   = VSCP_TEST_BOOT_LOADER_ALGORITHM;
+
 /** Timer values */
 static uint16_t         vscp_test_timerValues[VSCP_TEST_TIMER_SIZE];
 
@@ -339,6 +371,60 @@ static BOOL                 vscp_test_noMoreTimers      = FALSE;
 
 static uint32_t             vscp_test_timeSinceEpoch    = 0;
 
+/** Free running millisecond counter, which is increased every timer processing. */
+static uint32_t             vscp_test_millis            = 0;
+
+/** Level 2 receive message storage */
+static vscp_L2RxMessage     vscp_test_rxL2Message;
+
+/** Level 2 receive message is valid or not */
+static BOOL                 vscp_test_rxL2MessageValid  = FALSE;
+
+/** Last sent level 2 message */
+static vscp_L2TxMessage     vscp_test_txL2Message;
+
+/** Last level 2 message, which was provided to the application */
+static vscp_L2RxMessage     vscp_test_providedL2Message;
+
+/** Embedded MDF, which is read by the portable layer (NULL: not available) */
+static uint8_t const *      vscp_test_embeddedMdf       = NULL;
+
+/** Size of the embedded MDF blob */
+static uint16_t             vscp_test_embeddedMdfSize   = 0;
+
+/** Acceptance filters, which are programmed by the transport layer */
+static vscp_AcceptanceFilter    vscp_test_acceptanceFilters[VSCP_CONFIG_ACCEPTANCE_FILTER_NUM];
+
+/** Number of programmed acceptance filters */
+static uint8_t              vscp_test_acceptanceFilterNum   = 0;
+
+/** Decoded test MDF */
+static char const           vscp_test_mdf[]             =
+    "<vscp><module><name>Test</name><model>Test</model>"
+    "<register page=\"0\" offset=\"0\"><name>Temperature</name><description>Temperature in \xB0" "C</description></register>"
+    "<register page=\"0\" offset=\"1\"><name>Humidity</name></register></module></vscp>";
+
+/** Test MDF, compressed by vscp_mdf_compress.py */
+static uint8_t const        vscp_test_mdfBlob[]         =
+{
+    0x00, 0xED, 0x00, 0x6A, 0x07, 0x00, 0x13, 0x00, 0x30, 0x00, 0x36, 0x00,
+    0x43, 0x00, 0x4F, 0x00, 0x5A, 0x00, 0x63, 0x1C, 0x3E, 0x3C, 0x72, 0x65,
+    0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D,
+    0x22, 0x30, 0x22, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x22,
+    0x05, 0x6E, 0x61, 0x6D, 0x65, 0x3E, 0x0C, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0B, 0x54, 0x65, 0x6D, 0x70,
+    0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x3C, 0x2F, 0x72, 0x65,
+    0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x08, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+    0x65, 0x3E, 0x3C, 0x06, 0x54, 0x65, 0x73, 0x74, 0x3C, 0x2F, 0x3C, 0x76,
+    0x73, 0x63, 0x70, 0x3E, 0x3C, 0x86, 0x82, 0x87, 0x82, 0x3C, 0x6D, 0x6F,
+    0x64, 0x65, 0x6C, 0x3E, 0x87, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x81, 0x30,
+    0x22, 0x3E, 0x3C, 0x82, 0x84, 0x3C, 0x2F, 0x82, 0x3C, 0x83, 0x84, 0x20,
+    0x69, 0x6E, 0x20, 0x80, 0xB0, 0x43, 0x3C, 0x2F, 0x83, 0x85, 0x81, 0x31,
+    0x22, 0x3E, 0x3C, 0x82, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79,
+    0x3C, 0x2F, 0x82, 0x85, 0x3E, 0x3C, 0x2F, 0x86, 0x2F, 0x76, 0x73, 0x63,
+    0x70, 0x3E
+};
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -1571,6 +1657,7 @@ extern void vscp_test_active14(void)
  *  - All registers can be read and return the correct value.
  *  - All read/write registers can be written.
  *  - All read only registers can not be written.
+ *  - The alarm status register is cleared after it was read.
  */
 extern void vscp_test_active15(void)
 {
@@ -1655,6 +1742,11 @@ extern void vscp_test_active15(void)
         }
     }
 
+    /* Alarm status shall be cleared after it was read. */
+    vscp_core_setAlarm(0x89);
+    CU_ASSERT_EQUAL(vscp_test_readRegister(VSCP_REG_ALARM_STATUS), 0x89);
+    CU_ASSERT_EQUAL(vscp_test_readRegister(VSCP_REG_ALARM_STATUS), 0);
+
     return;
 }
 
@@ -2688,11 +2780,18 @@ extern int vscp_test_initDM(void)
  *
  * Expectation:
  *  - Action 1 is executed.
+ *  - The match and the executed action are counted.
  */
 extern void vscp_test_dm01(void)
 {
+    uint32_t    matches = 0;
+    uint32_t    actions = 0;
+
     vscp_test_initTestCase();
 
+    matches = vscp_stats_getCounter(VSCP_STATS_CNT_DM_MATCHES);
+    actions = vscp_stats_getCounter(VSCP_STATS_CNT_ACTIONS);
+
     vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
     vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_BUTTON;
     vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
@@ -2713,6 +2812,8 @@ extern void vscp_test_dm01(void)
 
     /* Only one action shall be executed */
     CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_ACTION_EXECUTE], 1);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_DM_MATCHES), matches + 1);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_ACTIONS), actions + 1);
 
     /* Check action */
     CU_ASSERT_EQUAL(vscp_test_action, 1);
@@ -3124,14 +3225,18 @@ extern void vscp_test_dmNG01(void)
  *
  * Expectation:
  *  - Action 1 is executed.
+ *  - The executed action is counted.
  */
 extern void vscp_test_dmNG02(void)
 {
-    uint8_t rule    = 0;
-    uint8_t pos     = 0;
+    uint8_t     rule    = 0;
+    uint8_t     pos     = 0;
+    uint32_t    actions = 0;
 
     vscp_test_initTestCase();
 
+    actions = vscp_stats_getCounter(VSCP_STATS_CNT_ACTIONS);
+
     vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
     vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_BUTTON;
     vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
@@ -3152,6 +3257,7 @@ extern void vscp_test_dmNG02(void)
 
     /* No action shall be executed */
     CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_ACTION_EXECUTE], 1);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_ACTIONS), actions + 1);
 
     /* Check last action */
     CU_ASSERT_EQUAL(vscp_test_action, 1);
@@ -3370,151 +3476,2879 @@ extern void vscp_test_active35(void)
     return;
 }
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Read page, which spans several register regions and reserved registers.
+ *
+ * Expectation:
+ *  - Page shall be read, reserved registers are read as zero.
+ */
+extern void vscp_test_active36(void)
+{
+    vscp_test_initTestCase();
 
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_REG_FIRMWARE_DEVICE_CODE_LSB;
+    vscp_test_rxMessage.data[2]     = 3;
 
-/* -------------------------------------------------------------------------- */
-/*      Stubs                                                                 */
-/* -------------------------------------------------------------------------- */
+    vscp_test_waitForTxMessage(1, 10);
 
-extern void vscp_test_psAccessInit(void)
-{
-    vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PS_ACCESS_INIT]++;
-    return;
-}
+    /* Node shall send a responses */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
 
-extern uint8_t  vscp_test_psAccessRead8(uint16_t addr)
-{
-    uint8_t value   = 0;
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 4);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], (VSCP_TEST_FIRMWARE_DEVICE_CODE >> 0) & 0xff);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], 0);
 
-    /* Check address out of bounce. */
-    if (VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) <= addr)
-    {
-        CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) > addr);
-    }
-    else
-    {
-        value = vscp_test_persistentMemory[addr];
-    }
+    vscp_test_initTestCase();
 
-    return value;
-}
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_REG_GUID_1;
+    vscp_test_rxMessage.data[2]     = 4;
 
-extern void vscp_test_psAccessWrite8(uint16_t addr, uint8_t value)
-{
-    /* Check address out of bounce. */
-    if (VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) <= addr)
-    {
-        CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) > addr);
-    }
-    else
-    {
-        vscp_test_persistentMemory[addr] = value;
-    }
+    vscp_test_waitForTxMessage(1, 10);
 
-    return;
-}
+    /* Node shall send a responses */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
 
-extern void vscp_test_appRegInit(void)
-{
-    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_APP_REG_INIT];
-    return;
-}
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 5);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], (VSCP_TEST_GUID_0 >> 8) & 0xff);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], (VSCP_TEST_GUID_0 >> 0) & 0xff);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], vscp_test_portableGetMdfUrl(0));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], vscp_test_portableGetMdfUrl(1));
 
-extern void vscp_test_tpAdatperInit(void)
-{
-    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_INIT];
     return;
 }
 
-extern BOOL vscp_test_tpAdatperReadMessage(vscp_RxMessage * const msg)
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read of 12 registers.
+ *
+ * Expectation:
+ *  - All 3 responses are sent in the same process cycle.
+ */
+extern void vscp_test_active37(void)
 {
-    BOOL    status  = FALSE;
+    uint8_t index   = 0;
 
-    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
+    vscp_test_initTestCase();
 
-    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_READ_MESSAGE];
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = VSCP_REG_GUID_15;
+    vscp_test_rxMessage.data[4]     = 12;
 
-    *msg = vscp_test_rxMessage;
+    vscp_test_waitForTxMessage(1, 10);
 
-    if (0 != vscp_test_rxMessage.vscpType)
+    /* Node shall send all responses at once */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 3);
+
+    for(index = 0; index < 3; ++index)
     {
-        status = TRUE;
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].oAddr, VSCP_TEST_NICKNAME);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].dataSize, 8);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[0], index);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[1], 0);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[2], 0);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[3], VSCP_REG_GUID_15 + 4 * index);
     }
 
-    /* Make message invalid */
-    vscp_test_rxMessage.vscpType = 0;
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], (VSCP_TEST_GUID_3 >> 24) & 0xff);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[4], (VSCP_TEST_GUID_2 >> 24) & 0xff);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[4], (VSCP_TEST_GUID_1 >> 24) & 0xff);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[7], (VSCP_TEST_GUID_1 >> 0) & 0xff);
 
-    return status;
+    return;
 }
 
-extern BOOL vscp_test_tpAdatperWriteMessage(vscp_TxMessage const * const msg)
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read, while the transport layer refuses all events.
+ *  - Transport layer accepts the events again before the timeout.
+ *  - Extended page read, while the transport layer refuses all events.
+ *  - Transport layer accepts the events again after the timeout.
+ *
+ * Expectation:
+ *  - After the short blocking, all responses are sent.
+ *  - After the timeout, the extended page read is aborted.
+ */
+extern void vscp_test_active38(void)
 {
-    BOOL    status  = TRUE;
+    vscp_test_initTestCase();
 
-    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
-    CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_txMessage) > vscp_test_txMessageCnt);
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = VSCP_REG_GUID_15;
+    vscp_test_rxMessage.data[4]     = 8;
 
-    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE];
+    vscp_test_isTxBlocked = TRUE;
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
 
-    vscp_test_txMessage[vscp_test_txMessageCnt] = *msg;
-    ++vscp_test_txMessageCnt;
+    /* Node shall send the pending responses now */
+    vscp_test_isTxBlocked = FALSE;
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], VSCP_REG_GUID_15);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[0], 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[3], VSCP_REG_GUID_11);
 
-    return status;
-}
+    vscp_test_initTestCase();
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = VSCP_REG_GUID_15;
+    vscp_test_rxMessage.data[4]     = 8;
+
+    vscp_test_isTxBlocked = TRUE;
+    vscp_test_waitForTxMessage(1, VSCP_CONFIG_MULTI_MSG_TIMEOUT + 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* Extended page read is aborted, no response shall be sent anymore */
+    vscp_test_isTxBlocked = FALSE;
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
 
-extern void vscp_test_portableInit(void)
-{
-    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_INIT];
     return;
 }
 
-extern void vscp_test_portableRestoreFactoryDefaultSettings(void)
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Who is there? (node addressed), while the transport layer refuses all events.
+ *  - Transport layer accepts the events again.
+ *
+ * Expectation:
+ *  - No response is lost, all responses are sent in order.
+ */
+extern void vscp_test_active39(void)
 {
-    uint8_t index   = 0;
-    uint8_t part    = 0;
-
-    vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_APP_RESTORE_FACTORY_DEFAULTS]++;
+    uint8_t index    = 0;
 
-    /* Restore GUID */
-    for(part = 0; part < 4; ++part)
-    {
-        uint32_t    guidPart    = 0;
+    vscp_test_initTestCase();
 
-        if (0 == part)
-        {
-            guidPart = VSCP_TEST_GUID_0;
-        }
-        else if (1 == part)
-        {
-            guidPart = VSCP_TEST_GUID_1;
-        }
-        else if (2 == part)
-        {
-            guidPart = VSCP_TEST_GUID_2;
-        }
-        else
-        {
-            guidPart = VSCP_TEST_GUID_3;
-        }
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_WHO_IS_THERE;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 1;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
 
-        for(index = 0; index < 4; ++index)
-        {
-            uint8_t     value   = ((uint8_t*)&guidPart)[index];
+    vscp_test_isTxBlocked = TRUE;
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
 
-            vscp_ps_writeGUID((part * 4) + index, value);
-        }
-    }
+    /* Node shall send all pending responses now */
+    vscp_test_isTxBlocked = FALSE;
+    vscp_test_waitForTxMessage(7, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 7);
 
-    /* Restore manufacturer device id */
-    for(index = 0; index < sizeof(VSCP_TEST_MANUFACTURER_DEV_ID); ++index)
+    for(index = 0; index < 7; ++index)
     {
-        uint32_t    manufacturerDevId   = VSCP_TEST_MANUFACTURER_DEV_ID;
-        uint8_t     value               = ((uint8_t*)&manufacturerDevId)[index];
-
-        vscp_ps_writeManufacturerDevId(index, value);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpType, VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].dataSize, 8);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[0], index);
     }
 
-    /* Restore manufacturer sub device id */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], vscp_dev_data_getGUID(15));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[2], vscp_dev_data_getGUID(0));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[6].data[6], vscp_test_portableGetMdfUrl(31));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[6].data[7], 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Boot loader algorithm is the VSCP boot loader algorithm.
+ *
+ * Action:
+ *  - Enter boot loader mode.
+ *  - Transfer block 0 and program it, while the transport layer refuses all events.
+ *  - Transfer the first part of block 1.
+ *  - Transport layer accepts the events again.
+ *  - Abort the firmware update.
+ *
+ * Expectation:
+ *  - Boot loader engine acknowledges with block size and number of blocks.
+ *  - Block data is acknowledged every VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW events.
+ *  - Block 1 is received, while block 0 is programmed. No response is lost.
+ *  - After the abort, the node is active again.
+ */
+extern void vscp_test_active40(void)
+{
+    uint8_t     chunkAckNum = ((VSCP_CONFIG_BOOT_BLOCK_SIZE / 8) - 1) / VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW;
+    uint16_t    index       = 0;
+
+    vscp_test_initTestCase();
+    vscp_test_bootLoaderAlgorithm = VSCP_BOOT_ALGORITHM_VSCP;
+
+    /* Enter boot loader mode */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 8;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_BOOT_ALGORITHM_VSCP;
+    vscp_test_rxMessage.data[2]     = (VSCP_TEST_GUID_3 >> 24) & 0xff;  /* Byte 0 */
+    vscp_test_rxMessage.data[3]     = (VSCP_TEST_GUID_3 >>  0) & 0xff;  /* Byte 3 */
+    vscp_test_rxMessage.data[4]     = (VSCP_TEST_GUID_2 >> 16) & 0xff;  /* Byte 5 */
+    vscp_test_rxMessage.data[5]     = (VSCP_TEST_GUID_2 >>  0) & 0xff;  /* Byte 7 */
+    vscp_test_rxMessage.data[6]     = 0;
+    vscp_test_rxMessage.data[7]     = 0;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[0].data[0]), VSCP_CONFIG_BOOT_BLOCK_SIZE);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[0].data[4]), VSCP_BOOT_FLASH_BLOCK_COUNT);
+
+    /* The boot loader engine handles the firmware update, not the external boot loader. */
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_BOOT_LOADER_REQUEST], 0);
+    CU_ASSERT_EQUAL(vscp_core_isActive(), FALSE);
+
+    /* Start block 0 */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = 0;
+    vscp_test_rxMessage.data[4]     = VSCP_BOOT_MEM_TYPE_PROGRAM;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[0].data[0]), 0);
+
+    /* Send block data back to back, without waiting for any acknowledge. */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+
+    for(index = 0; index < VSCP_CONFIG_BOOT_BLOCK_SIZE; index += 8)
+    {
+        uint8_t dataIndex   = 0;
+
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+        vscp_test_rxMessage.dataSize    = 8;
+
+        for(dataIndex = 0; dataIndex < 8; ++dataIndex)
+        {
+            vscp_test_rxMessage.data[dataIndex] = (uint8_t)(index + dataIndex);
+        }
+
+        (void)vscp_core_process();
+    }
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, chunkAckNum + 1);
+
+    for(index = 0; index < chunkAckNum; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK);
+        CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[index].data[0]), (uint32_t)(index + 1) * VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW * 8);
+    }
+
+    CU_ASSERT_EQUAL(vscp_test_txMessage[chunkAckNum].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[chunkAckNum].dataSize, 6);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[chunkAckNum].data[2]), VSCP_CONFIG_BOOT_BLOCK_SIZE);
+
+    /* Program block 0, but the transport layer refuses the acknowledge. */
+    vscp_test_isTxBlocked = TRUE;
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 4;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = 0;
+
+    vscp_test_waitForTxMessage(1, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* Start block 1 and send the first data */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[3]     = 1;
+    vscp_test_rxMessage.data[4]     = VSCP_BOOT_MEM_TYPE_PROGRAM;
+
+    vscp_test_waitForTxMessage(1, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    for(index = 0; index < VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW; ++index)
+    {
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+        vscp_test_rxMessage.dataSize    = 8;
+        memset(vscp_test_rxMessage.data, 0xA5, 8);
+
+        vscp_test_waitForTxMessage(1, 1);
+        CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+    }
+
+    /* Node shall send all pending responses now in order. */
+    vscp_test_isTxBlocked = FALSE;
+    vscp_test_waitForTxMessage(3, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 3);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[0].data[0]), 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[1].data[0]), 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[2].data[0]), VSCP_CONFIG_BOOT_BLOCK_SIZE + VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW * 8);
+
+    /* Abort firmware update */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT;
+    vscp_test_rxMessage.dataSize    = 0;
+
+    vscp_test_waitForTxMessage(2, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_ACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_core_isActive(), TRUE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Boot loader algorithm is the VSCP boot loader algorithm.
+ *
+ * Action:
+ *  - Enter boot loader mode.
+ *  - Transfer block 1 and program it.
+ *  - Activate the new image with a wrong and with the right CRC.
+ *
+ * Expectation:
+ *  - Block data acknowledge contains the CRC-16 of the block.
+ *  - Block is written to the flash.
+ *  - New image is activated only with the right CRC and a reset is requested.
+ */
+extern void vscp_test_active41(void)
+{
+    uint8_t     image[VSCP_CONFIG_BOOT_BLOCK_SIZE];
+    uint8_t     flash[VSCP_CONFIG_BOOT_BLOCK_SIZE];
+    uint16_t    crc     = 0;
+    uint16_t    index   = 0;
+
+    vscp_test_initTestCase();
+    vscp_test_bootLoaderAlgorithm = VSCP_BOOT_ALGORITHM_VSCP;
+
+    /* CRC-16 (CCITT) check value */
+    CU_ASSERT_EQUAL(vscp_util_crc16(VSCP_UTIL_CRC16_INIT, (uint8_t const *)"123456789", 9), 0x29B1);
+
+    for(index = 0; index < VSCP_CONFIG_BOOT_BLOCK_SIZE; ++index)
+    {
+        image[index] = (uint8_t)(index * 7 + 3);
+    }
+
+    crc = vscp_util_crc16(VSCP_UTIL_CRC16_INIT, image, VSCP_CONFIG_BOOT_BLOCK_SIZE);
+
+    /* Enter boot loader mode */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 8;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_BOOT_ALGORITHM_VSCP;
+    vscp_test_rxMessage.data[2]     = (VSCP_TEST_GUID_3 >> 24) & 0xff;  /* Byte 0 */
+    vscp_test_rxMessage.data[3]     = (VSCP_TEST_GUID_3 >>  0) & 0xff;  /* Byte 3 */
+    vscp_test_rxMessage.data[4]     = (VSCP_TEST_GUID_2 >> 16) & 0xff;  /* Byte 5 */
+    vscp_test_rxMessage.data[5]     = (VSCP_TEST_GUID_2 >>  0) & 0xff;  /* Byte 7 */
+    vscp_test_rxMessage.data[6]     = 0;
+    vscp_test_rxMessage.data[7]     = 0;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER);
+
+    /* Block number out of range */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = (uint8_t)VSCP_BOOT_FLASH_BLOCK_COUNT;
+    vscp_test_rxMessage.data[4]     = VSCP_BOOT_MEM_TYPE_PROGRAM;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_NACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_BOOT_ERR_INVALID_BLOCK);
+
+    /* Start block 1 */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.data[3]     = 1;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+
+    /* Send block data */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+
+    for(index = 0; index < VSCP_CONFIG_BOOT_BLOCK_SIZE; index += 8)
+    {
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+        vscp_test_rxMessage.dataSize    = 8;
+        memcpy(vscp_test_rxMessage.data, &image[index], 8);
+
+        (void)vscp_core_process();
+    }
+
+    CU_ASSERT_NOT_EQUAL(vscp_test_txMessageCnt, 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[vscp_test_txMessageCnt - 1].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[vscp_test_txMessageCnt - 1].data[0]), crc);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[vscp_test_txMessageCnt - 1].data[2]), 2 * VSCP_CONFIG_BOOT_BLOCK_SIZE);
+
+    /* Program block 1 */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 4;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = 1;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT32_BE(&vscp_test_txMessage[0].data[0]), 1);
+
+    /* Block shall be in the flash */
+    memset(flash, 0, sizeof(flash));
+    CU_ASSERT_EQUAL(vscp_boot_flash_read(1, flash, sizeof(flash)), TRUE);
+    CU_ASSERT_EQUAL(memcmp(flash, image, sizeof(image)), 0);
+
+    /* Activate new image with wrong CRC */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE;
+    vscp_test_rxMessage.dataSize    = 2;
+    vscp_test_rxMessage.data[0]     = VSCP_UTIL_WORD_MSB(crc + 1);
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_LSB(crc + 1);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK);
+
+    /* Activate new image */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE;
+    vscp_test_rxMessage.data[0]     = VSCP_UTIL_WORD_MSB(crc);
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_LSB(crc);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK);
+
+    /* Reset shall be requested to start the new image. */
+    vscp_test_waitForTxMessage(1, 2);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_RESET_REQUEST], 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Application register write protection is disabled.
+ *
+ * Action:
+ *  - Start a bulk configuration write session for the decision matrix NG.
+ *  - Stream the block data events without waiting for a response.
+ *  - Commit the session with the right CRC.
+ *
+ * Expectation:
+ *  - Block data is acknowledged every VSCP_CONFIG_BULK_WRITE_ACK_WINDOW events.
+ *  - Block data acknowledge contains the CRC-16 of all register values.
+ *  - No register is written before the commit.
+ *  - A single program block data acknowledge is sent and all registers are written.
+ */
+extern void vscp_test_active42(void)
+{
+    uint8_t     config[VSCP_CONFIG_DM_NG_RULE_SET_SIZE];
+    uint8_t     backup[VSCP_CONFIG_DM_NG_RULE_SET_SIZE];
+    uint8_t     frameNum    = (VSCP_CONFIG_DM_NG_RULE_SET_SIZE + 5) / 6;
+    uint8_t     chunkAckNum = (frameNum - 1) / VSCP_CONFIG_BULK_WRITE_ACK_WINDOW;
+    uint16_t    crc         = 0;
+    uint16_t    index       = 0;
+    uint8_t     seq         = 0;
+
+    vscp_test_initTestCase();
+
+    /* Disable application register write protection */
+    vscp_ps_writeNodeControlFlags(0x60);
+
+    for(index = 0; index < VSCP_CONFIG_DM_NG_RULE_SET_SIZE; ++index)
+    {
+        backup[index] = vscp_ps_readDMNextGeneration(index);
+        config[index] = (uint8_t)(index * 5 + 1);
+        vscp_ps_writeDMNextGeneration(index, 0);
+    }
+
+    crc = vscp_util_crc16(VSCP_UTIL_CRC16_INIT, config, VSCP_CONFIG_DM_NG_RULE_SET_SIZE);
+
+    /* Start session */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 7;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(VSCP_CONFIG_DM_NG_PAGE);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(VSCP_CONFIG_DM_NG_PAGE);
+    vscp_test_rxMessage.data[3]     = 0;
+    vscp_test_rxMessage.data[4]     = VSCP_CORE_BULK_WRITE_MEM_TYPE;
+    vscp_test_rxMessage.data[5]     = VSCP_UTIL_WORD_MSB(VSCP_CONFIG_DM_NG_RULE_SET_SIZE);
+    vscp_test_rxMessage.data[6]     = VSCP_UTIL_WORD_LSB(VSCP_CONFIG_DM_NG_RULE_SET_SIZE);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 6);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[0].data[0]), VSCP_CONFIG_DM_NG_PAGE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], VSCP_CORE_BULK_WRITE_MEM_TYPE);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[0].data[4]), VSCP_CONFIG_DM_NG_RULE_SET_SIZE);
+
+    /* Send block data back to back, without waiting for any acknowledge. */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+
+    for(index = 0; index < VSCP_CONFIG_DM_NG_RULE_SET_SIZE; index += 6)
+    {
+        uint8_t num = 6;
+
+        if ((VSCP_CONFIG_DM_NG_RULE_SET_SIZE - index) < num)
+        {
+            num = (uint8_t)(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - index);
+        }
+
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+        vscp_test_rxMessage.dataSize    = 2 + num;
+        vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+        vscp_test_rxMessage.data[1]     = seq;
+        memcpy(&vscp_test_rxMessage.data[2], &config[index], num);
+        ++seq;
+
+        (void)vscp_core_process();
+    }
+
+    CU_ASSERT_EQUAL(seq, frameNum);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, chunkAckNum + 1);
+
+    for(index = 0; index < chunkAckNum; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].dataSize, 3);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[0], (index + 1) * VSCP_CONFIG_BULK_WRITE_ACK_WINDOW);
+        CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[index].data[1]), (index + 1) * VSCP_CONFIG_BULK_WRITE_ACK_WINDOW * 6);
+    }
+
+    CU_ASSERT_EQUAL(vscp_test_txMessage[chunkAckNum].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[chunkAckNum].dataSize, 4);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[chunkAckNum].data[0]), crc);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[chunkAckNum].data[2]), VSCP_CONFIG_DM_NG_RULE_SET_SIZE);
+
+    /* No register shall be written before the commit. */
+    for(index = 0; index < VSCP_CONFIG_DM_NG_RULE_SET_SIZE; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_ps_readDMNextGeneration(index), 0);
+    }
+
+    /* Commit */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(crc);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(crc);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 5);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[0].data[0]), VSCP_CONFIG_DM_NG_PAGE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], 0);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[0].data[3]), VSCP_CONFIG_DM_NG_RULE_SET_SIZE);
+
+    for(index = 0; index < VSCP_CONFIG_DM_NG_RULE_SET_SIZE; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_ps_readDMNextGeneration(index), config[index]);
+
+        /* Restore decision matrix NG for the following tests */
+        vscp_ps_writeDMNextGeneration(index, backup[index]);
+    }
+
+    /* Enable application register write protection again */
+    vscp_ps_writeNodeControlFlags(0x40);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Start a bulk configuration write session, which overflows the page.
+ *  - Send block data without a session.
+ *  - Send block data with an unexpected sequence number twice.
+ *  - Commit the session with a wrong CRC and commit again.
+ *  - Commit a session, which contains read only registers.
+ *  - Commit a session, whose last registers don't accept the written values.
+ *
+ * Expectation:
+ *  - Session is not started.
+ *  - Block data without a session is ignored.
+ *  - Only a single block data NACK with the expected sequence number is sent.
+ *  - Commit is refused with the corresponding error and no register is written.
+ *  - Registers, which were written before the failed one, are restored.
+ */
+extern void vscp_test_active43(void)
+{
+    uint8_t     config[VSCP_PS_SIZE_USER_ID + 4];
+    uint8_t     userId[VSCP_PS_SIZE_USER_ID];
+    uint8_t     ruleSet[8];
+    uint8_t     backup[4];
+    uint16_t    crc     = 0;
+    uint8_t     index   = 0;
+
+    vscp_test_initTestCase();
+
+    for(index = 0; index < VSCP_PS_SIZE_USER_ID; ++index)
+    {
+        userId[index] = vscp_ps_readUserId(index);
+    }
+
+    /* User id and the read only manufacturer device id */
+    for(index = 0; index < sizeof(config); ++index)
+    {
+        config[index] = (uint8_t)(0xA0 + index);
+    }
+
+    crc = vscp_util_crc16(VSCP_UTIL_CRC16_INIT, config, sizeof(config));
+
+    /* Start session, which overflows the page */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 7;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = 0xFF;
+    vscp_test_rxMessage.data[4]     = VSCP_CORE_BULK_WRITE_MEM_TYPE;
+    vscp_test_rxMessage.data[5]     = 0;
+    vscp_test_rxMessage.data[6]     = 2;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_NACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CORE_BULK_WRITE_ERR_INVALID);
+
+    /* Block data without session, e.g. firmware data for another node */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 8;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    memcpy(&vscp_test_rxMessage.data[2], config, 6);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    /* Node shall send nothing. */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* Start session */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.dataSize    = 7;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = VSCP_REG_USER_ID_0;
+    vscp_test_rxMessage.data[4]     = VSCP_CORE_BULK_WRITE_MEM_TYPE;
+    vscp_test_rxMessage.data[5]     = 0;
+    vscp_test_rxMessage.data[6]     = sizeof(config);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+
+    /* The first block data event is lost, the second one is received twice. */
+    for(index = 0; index < 2; ++index)
+    {
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+        vscp_test_rxMessage.dataSize    = 2 + sizeof(config) - 6;
+        vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+        vscp_test_rxMessage.data[1]     = 1;
+        memcpy(&vscp_test_rxMessage.data[2], &config[6], sizeof(config) - 6);
+
+        vscp_test_waitForTxMessage(1, 10);
+
+        if (0 == index)
+        {
+            CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+            CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK);
+            CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 2);
+            CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CORE_BULK_WRITE_ERR_SEQUENCE);
+            CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], 0);
+        }
+        else
+        {
+            CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+        }
+    }
+
+    /* Continue with the expected sequence number */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 8;
+    vscp_test_rxMessage.data[1]     = 0;
+    memcpy(&vscp_test_rxMessage.data[2], &config[0], 6);
+
+    vscp_test_waitForTxMessage(1, 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 2 + sizeof(config) - 6;
+    vscp_test_rxMessage.data[1]     = 1;
+    memcpy(&vscp_test_rxMessage.data[2], &config[6], sizeof(config) - 6);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK);
+    CU_ASSERT_EQUAL(VSCP_UTIL_READ_UINT16_BE(&vscp_test_txMessage[0].data[0]), crc);
+
+    /* Commit with wrong CRC */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(crc + 1);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(crc + 1);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CORE_BULK_WRITE_ERR_CRC);
+
+    /* The session ended with the commit. */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(crc);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(crc);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CORE_BULK_WRITE_ERR_NO_SESSION);
+
+    /* Transfer again and commit with the right CRC */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.dataSize    = 7;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = VSCP_REG_USER_ID_0;
+    vscp_test_rxMessage.data[4]     = VSCP_CORE_BULK_WRITE_MEM_TYPE;
+    vscp_test_rxMessage.data[5]     = 0;
+    vscp_test_rxMessage.data[6]     = sizeof(config);
+
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 8;
+    vscp_test_rxMessage.data[1]     = 0;
+    memcpy(&vscp_test_rxMessage.data[2], &config[0], 6);
+    (void)vscp_core_process();
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 2 + sizeof(config) - 6;
+    vscp_test_rxMessage.data[1]     = 1;
+    memcpy(&vscp_test_rxMessage.data[2], &config[6], sizeof(config) - 6);
+
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK);
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(crc);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(crc);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    /* The manufacturer device id is read only, therefore nothing is written. */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CORE_BULK_WRITE_ERR_WRITE);
+
+    for(index = 0; index < VSCP_PS_SIZE_USER_ID; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_ps_readUserId(index), userId[index]);
+    }
+
+    /* Disable application register write protection */
+    vscp_ps_writeNodeControlFlags(0x60);
+
+    /* The last 4 registers of the decision matrix NG and the following 4
+     * application registers. The application registers read always 0, so
+     * they fail in the middle of the block.
+     */
+    for(index = 0; index < sizeof(backup); ++index)
+    {
+        backup[index] = vscp_ps_readDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 4 + index);
+        vscp_ps_writeDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 4 + index, 0x11);
+    }
+
+    for(index = 0; index < sizeof(ruleSet); ++index)
+    {
+        ruleSet[index] = (uint8_t)(0xC0 + index);
+    }
+
+    crc = vscp_util_crc16(VSCP_UTIL_CRC16_INIT, ruleSet, sizeof(ruleSet));
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_START_BLOCK;
+    vscp_test_rxMessage.dataSize    = 7;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(VSCP_CONFIG_DM_NG_PAGE);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(VSCP_CONFIG_DM_NG_PAGE);
+    vscp_test_rxMessage.data[3]     = VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 4;
+    vscp_test_rxMessage.data[4]     = VSCP_CORE_BULK_WRITE_MEM_TYPE;
+    vscp_test_rxMessage.data[5]     = 0;
+    vscp_test_rxMessage.data[6]     = sizeof(ruleSet);
+
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK);
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 8;
+    vscp_test_rxMessage.data[1]     = 0;
+    memcpy(&vscp_test_rxMessage.data[2], &ruleSet[0], 6);
+    (void)vscp_core_process();
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 2 + sizeof(ruleSet) - 6;
+    vscp_test_rxMessage.data[1]     = 1;
+    memcpy(&vscp_test_rxMessage.data[2], &ruleSet[6], sizeof(ruleSet) - 6);
+
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK);
+
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(crc);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(crc);
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CORE_BULK_WRITE_ERR_WRITE);
+
+    /* The decision matrix NG in the persistent memory is unchanged. */
+    for(index = 0; index < sizeof(backup); ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_ps_readDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 4 + index), 0x11);
+
+        /* Restore decision matrix NG for the following tests */
+        vscp_ps_writeDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 4 + index, backup[index]);
+    }
+
+    /* Enable application register write protection again */
+    vscp_ps_writeNodeControlFlags(0x40);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Wait for several node heartbeats.
+ *  - Block the transport layer during one heartbeat.
+ *
+ * Expectation:
+ *  - The first heartbeat is sent within one period.
+ *  - The heartbeats are sent with the period +/- jitter.
+ *  - After the transmit error, the period is doubled once and afterwards
+ *    halved again.
+ */
+extern void vscp_test_active44(void)
+{
+    uint32_t    elapsed = 0;
+
+    vscp_test_initTestCase();
+
+    /* First heartbeat with phase offset */
+    elapsed = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT);
+    CU_ASSERT(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD >= elapsed);
+
+    /* Heartbeat with jitter */
+    elapsed = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER + 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER) <= elapsed);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER) >= elapsed);
+
+    /* Heartbeat is refused by the transport layer */
+    vscp_test_isTxBlocked = TRUE;
+    elapsed = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER + 1);
+    vscp_test_isTxBlocked = FALSE;
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER) <= elapsed);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER) >= elapsed);
+
+    /* Period is doubled */
+    elapsed = vscp_test_waitForHeartbeat(2 * VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER + 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT);
+    CU_ASSERT((2 * VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER) <= elapsed);
+    CU_ASSERT((2 * VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER) >= elapsed);
+
+    /* No transmit error anymore, period is halved again */
+    elapsed = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER + 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER) <= elapsed);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_JITTER) >= elapsed);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Start the node segment initialization.
+ *  - Other nodes send events, while the node waits for the segment master.
+ *  - Another node sends an event, while the first nickname is probed, which
+ *    is acknowledged.
+ *
+ * Expectation:
+ *  - The nickname discovery probes only nicknames, which were not observed.
+ */
+extern void vscp_test_active45(void)
+{
+    uint8_t id  = 0;
+
+    vscp_test_initTestCase();
+
+    /* Request initialization */
+    vscp_core_startNodeSegmentInit();
+
+    /* Process core */
+    vscp_test_waitForTxMessage(1, 10);
+
+    /* Probe event shall be sent to segment master */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_NICKNAME_SEGMENT_MASTER);
+
+    /* The nodes 1 - 3 send events, while the node waits for the segment master. */
+    for(id = 1; id <= 3; ++id)
+    {
+        vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_ON;
+        vscp_test_rxMessage.priority    = VSCP_PRIORITY_3_NORMAL;
+        vscp_test_rxMessage.oAddr       = id;
+        vscp_test_rxMessage.hardCoded   = FALSE;
+        vscp_test_rxMessage.dataSize    = 3;
+        vscp_test_rxMessage.data[0]     = 0;
+        vscp_test_rxMessage.data[1]     = 0;
+        vscp_test_rxMessage.data[2]     = 0;
+
+        (void)vscp_core_process();
+    }
+
+    /* Wait for at least 1 event */
+    vscp_test_waitForTxMessage(1, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT + 1);
+
+    /* Probe event shall be sent with the first nickname id, which was not observed. */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_NICKNAME_NOT_INIT);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 4);
+
+    /* The node 5 sends an event. */
+    vscp_test_rxMessage.oAddr       = 5;
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_ON;
+    (void)vscp_core_process();
+
+    /* The node 4 acknowledges the probe. */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROBE_ACK;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = 4;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 0;
+
+    vscp_test_waitForTxMessage(1, 2);
+
+    /* Probe event shall be sent with nickname id 6. */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_NICKNAME_NOT_INIT);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 6);
+
+    /* No acknowledge, the node uses the nickname id 6. */
+    vscp_test_waitForTxMessage(1, VSCP_CONFIG_PROBE_ACK_TIMEOUT + 1);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, 6);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_0_HIGH);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 6);
+    CU_ASSERT_EQUAL(vscp_ps_readNicknameId(), 6);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read across the begin of the decision matrix.
+ *  - Extended page read across the end of the decision matrix NG.
+ *
+ * Expectation:
+ *  - Decision matrix registers are read from the persistent memory,
+ *    application specific registers from the application.
+ */
+extern void vscp_test_active46(void)
+{
+    uint8_t backup[2];
+    uint8_t index   = 0;
+
+    /* Begin of the decision matrix */
+    for(index = 0; index < 2; ++index)
+    {
+        backup[index] = vscp_ps_readDM(index);
+        vscp_ps_writeDM(index, 0xA1 + index);
+    }
+
+    vscp_test_initTestCase();
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(VSCP_CONFIG_DM_PAGE);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(VSCP_CONFIG_DM_PAGE);
+    vscp_test_rxMessage.data[3]     = VSCP_CONFIG_DM_OFFSET - 2;
+    vscp_test_rxMessage.data[4]     = 4;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], VSCP_CONFIG_DM_OFFSET - 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[5], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[6], 0xA1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[7], 0xA2);
+
+    for(index = 0; index < 2; ++index)
+    {
+        vscp_ps_writeDM(index, backup[index]);
+    }
+
+    /* End of the decision matrix NG */
+    for(index = 0; index < 2; ++index)
+    {
+        backup[index] = vscp_ps_readDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 2 + index);
+        vscp_ps_writeDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 2 + index, 0xB1 + index);
+    }
+
+    vscp_test_initTestCase();
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = VSCP_UTIL_WORD_MSB(VSCP_CONFIG_DM_NG_PAGE);
+    vscp_test_rxMessage.data[2]     = VSCP_UTIL_WORD_LSB(VSCP_CONFIG_DM_NG_PAGE);
+    vscp_test_rxMessage.data[3]     = VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 2;
+    vscp_test_rxMessage.data[4]     = 4;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], 0xB1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[5], 0xB2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[6], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[7], 0);
+
+    for(index = 0; index < 2; ++index)
+    {
+        vscp_ps_writeDMNextGeneration(VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 2 + index, backup[index]);
+    }
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled for the debug level.
+ *
+ * Action:
+ *  - Log a message, which needs 3 log events, and a message with a disabled level.
+ *  - Process the core.
+ *  - Log a message, while the transport layer refuses all events.
+ *
+ * Expectation:
+ *  - No log event is sent directly by the log function.
+ *  - Max. VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE log events are sent per process cycle with low priority.
+ *  - Refused log events are sent later.
+ */
+extern void vscp_test_logger01(void)
+{
+    uint8_t msg[12];
+    uint8_t index   = 0;
+
+    vscp_test_initTestCase();
+
+    for(index = 0; index < sizeof(msg); ++index)
+    {
+        msg[index] = (uint8_t)(0x30 + index);
+    }
+
+    vscp_logger_enable(TRUE);
+    vscp_logger_setLogLevel(1 << VSCP_LOGGER_LVL_DEBUG);
+
+    vscp_logger_log(7, VSCP_LOGGER_LVL_DEBUG, msg, sizeof(msg));
+    vscp_logger_log(8, VSCP_LOGGER_LVL_INFO, msg, sizeof(msg));
+
+    /* Nothing shall be sent directly. */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    (void)vscp_core_process();
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE);
+
+    vscp_test_waitForTxMessage(3 - VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 3 - VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE);
+
+    /* The last log event contains the rest of the message and is filled with zeros. */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_LOG);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_LOG_MESSAGE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_7_LOW);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 7);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], VSCP_LOGGER_LVL_DEBUG);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], msg[10]);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], msg[11]);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[5], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[6], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[7], 0);
+
+    /* The transport layer refuses the log event. */
+    vscp_test_isTxBlocked = TRUE;
+
+    vscp_logger_log(9, VSCP_LOGGER_LVL_DEBUG, msg, 5);
+
+    vscp_test_waitForTxMessage(1, 5);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    vscp_test_isTxBlocked = FALSE;
+
+    vscp_test_waitForTxMessage(1, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 9);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], 0);
+    CU_ASSERT_EQUAL(memcmp(&vscp_test_txMessage[0].data[3], msg, 5), 0);
+
+    vscp_logger_enable(FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled for all levels.
+ *
+ * Action:
+ *  - Log more messages than the ring buffer can hold.
+ *  - Log more messages of one level than the rate limit allows.
+ *  - Log a message, which needs several log events, and overwrite it.
+ *  - Flush the log messages with and without refused log events.
+ *
+ * Expectation:
+ *  - The oldest log messages are dropped completely and counted.
+ *  - Messages above the rate limit of a level are dropped, other levels are not affected.
+ *  - Flush sends all log events or reports the refused ones.
+ */
+extern void vscp_test_logger02(void)
+{
+    uint8_t     msg[12];
+    uint16_t    dropCount   = vscp_logger_getDropCount();
+    uint8_t     index       = 0;
+
+    vscp_test_initTestCase();
+
+    memset(msg, 0x55, sizeof(msg));
+
+    vscp_logger_enable(TRUE);
+    vscp_logger_setLogLevel(0xFF);
+
+    /* Refill all rate limit buckets */
+    vscp_core_setTimeSinceEpoch(vscp_core_getTimeSinceEpoch() + 100);
+
+    /* Overflow the ring buffer */
+    for(index = 0; index < 20; ++index)
+    {
+        vscp_logger_log(index, VSCP_LOGGER_LVL_INFO, &index, 1);
+    }
+
+    CU_ASSERT_EQUAL(vscp_logger_getDropCount(), dropCount + 20 - VSCP_CONFIG_LOGGER_BUFFER_NUM);
+
+    /* Exceed the rate limit of the info level */
+    vscp_logger_log(20, VSCP_LOGGER_LVL_INFO, NULL, 0);
+    CU_ASSERT_EQUAL(vscp_logger_getDropCount(), dropCount + 20 - VSCP_CONFIG_LOGGER_BUFFER_NUM + 1);
+
+    /* Other levels are not limited, but the oldest message is dropped. */
+    vscp_logger_log(21, VSCP_LOGGER_LVL_WARNING, NULL, 0);
+    CU_ASSERT_EQUAL(vscp_logger_getDropCount(), dropCount + 20 - VSCP_CONFIG_LOGGER_BUFFER_NUM + 2);
+
+    vscp_test_waitForTxMessage(10, 10 / VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 10);
+
+    for(index = 0; index < 10; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[0], 20 - VSCP_CONFIG_LOGGER_BUFFER_NUM + 1 + index);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[1], VSCP_LOGGER_LVL_INFO);
+    }
+
+    vscp_test_waitForTxMessage(VSCP_CONFIG_LOGGER_BUFFER_NUM - 10, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, VSCP_CONFIG_LOGGER_BUFFER_NUM - 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[VSCP_CONFIG_LOGGER_BUFFER_NUM - 11].data[0], 21);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[VSCP_CONFIG_LOGGER_BUFFER_NUM - 11].data[1], VSCP_LOGGER_LVL_WARNING);
+
+    /* A message with several log events is dropped completely. */
+    vscp_core_setTimeSinceEpoch(vscp_core_getTimeSinceEpoch() + 100);
+    dropCount = vscp_logger_getDropCount();
+
+    vscp_logger_log(100, VSCP_LOGGER_LVL_DEBUG, msg, sizeof(msg));
+
+    for(index = 0; index < (VSCP_CONFIG_LOGGER_BUFFER_NUM - 2); ++index)
+    {
+        vscp_logger_log(index, VSCP_LOGGER_LVL_INFO, NULL, 0);
+    }
+
+    CU_ASSERT_EQUAL(vscp_logger_getDropCount(), dropCount + 1);
+
+    vscp_test_waitForTxMessage(10, 10 / VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], VSCP_LOGGER_LVL_INFO);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], 0);
+
+    vscp_test_waitForTxMessage(VSCP_CONFIG_LOGGER_BUFFER_NUM - 12, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, VSCP_CONFIG_LOGGER_BUFFER_NUM - 12);
+
+    /* Flush, while the transport layer refuses the log events. */
+    vscp_logger_log(30, VSCP_LOGGER_LVL_ERROR, NULL, 0);
+    vscp_logger_log(31, VSCP_LOGGER_LVL_ERROR, NULL, 0);
+
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+    vscp_test_isTxBlocked = TRUE;
+
+    CU_ASSERT_EQUAL(vscp_logger_flush(), FALSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    vscp_test_isTxBlocked = FALSE;
+
+    CU_ASSERT_EQUAL(vscp_logger_flush(), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 30);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[0], 31);
+
+    vscp_logger_enable(FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled for the debug level.
+ *
+ * Action:
+ *  - Log a trace record with four arguments.
+ *  - Log a trace record with a disabled level and one with too many arguments.
+ *
+ * Expectation:
+ *  - The trace record is sent with the trace log message id, the 16-bit
+ *    message id and the variable length encoded arguments.
+ *  - The other trace records are not sent.
+ */
+extern void vscp_test_logger03(void)
+{
+    uint32_t const  args[VSCP_LOGGER_TRACE_ARGS_MAX + 1]    = { 0, 1, 2, 3, 4 };
+    uint8_t const   record[]    =
+    {
+        0x12, 0x34,                     /* Message id */
+        0x05,                           /* 5 */
+        0xAC, 0x02,                     /* 300 */
+        0xFF, 0xFF, 0xFF, 0xFF, 0x0F,   /* 0xFFFFFFFF */
+        0x03                            /* -2 */
+    };
+    uint8_t         index       = 0;
+
+    vscp_test_initTestCase();
+
+    vscp_logger_enable(TRUE);
+    vscp_logger_setLogLevel(1 << VSCP_LOGGER_LVL_DEBUG);
+
+    /* Refill all rate limit buckets */
+    vscp_core_setTimeSinceEpoch(vscp_core_getTimeSinceEpoch() + 100);
+
+    LOG_TRACE4(0x1234, VSCP_LOGGER_LVL_DEBUG, 5, 300, 0xFFFFFFFF, VSCP_LOGGER_TRACE_SINT(-2));
+    LOG_TRACE0(0x1235, VSCP_LOGGER_LVL_INFO);
+    vscp_logger_trace(0x1236, VSCP_LOGGER_LVL_DEBUG, args, VSCP_LOGGER_TRACE_ARGS_MAX + 1);
+
+    vscp_test_waitForTxMessage(3, 10);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 3);
+
+    for(index = 0; index < vscp_test_txMessageCnt; ++index)
+    {
+        uint8_t offset  = index * 5;
+        uint8_t left    = sizeof(record) - offset;
+
+        if (5 < left)
+        {
+            left = 5;
+        }
+
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpClass, VSCP_CLASS_L1_LOG);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpType, VSCP_TYPE_LOG_MESSAGE);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[0], VSCP_CONFIG_LOGGER_TRACE_ID);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[1], VSCP_LOGGER_LVL_DEBUG);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[2], index);
+        CU_ASSERT_EQUAL(memcmp(&vscp_test_txMessage[index].data[3], &record[offset], left), 0);
+    }
+
+    /* Nothing else shall be sent. */
+    vscp_test_waitForTxMessage(1, 5);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    vscp_logger_enable(FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Process the core several times.
+ *  - Read a register and read the statistics of the register read probe via the
+ *    performance probe page.
+ *  - Write a register of the performance probe page.
+ *
+ * Expectation:
+ *  - Every process cycle is measured.
+ *  - The statistics are consistent and can be read via the register page.
+ *  - Writing to the register page resets the statistics of the probe.
+ */
+extern void vscp_test_perf01(void)
+{
+    vscp_perf_Stats before;
+    vscp_perf_Stats after;
+    uint32_t        histSum = 0;
+    uint8_t         index   = 0;
+
+    vscp_test_initTestCase();
+
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_NUM, &before), FALSE);
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_CORE_PROCESS, NULL), FALSE);
+
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_CORE_PROCESS, &before), TRUE);
+
+    for(index = 0; index < 3; ++index)
+    {
+        (void)vscp_core_process();
+    }
+
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_CORE_PROCESS, &after), TRUE);
+    CU_ASSERT_EQUAL(after.count, before.count + 3);
+    CU_ASSERT(after.min <= after.max);
+    CU_ASSERT(after.sum >= after.max);
+
+    for(index = 0; index < VSCP_PERF_HIST_NUM; ++index)
+    {
+        histSum += after.hist[index];
+    }
+
+    CU_ASSERT_EQUAL(histSum, after.count);
+
+    /* Every process cycle reads the transport layer. */
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_TP_READ, &after), TRUE);
+    CU_ASSERT(after.count >= 3);
+
+    /* A single register read is measured once. */
+    vscp_perf_reset(VSCP_PERF_PROBE_REG_READ);
+    (void)vscp_test_readRegister(VSCP_REG_NICKNAME_ID);
+
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_REG_READ, &after), TRUE);
+    CU_ASSERT_EQUAL(after.count, 1);
+
+    /* Read the number of register read measurements via the performance probe page.
+     * The read itself is still in progress and therefore not counted.
+     */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = (uint8_t)((VSCP_CONFIG_PERF_PAGE >> 8) & 0xFF);
+    vscp_test_rxMessage.data[2]     = (uint8_t)((VSCP_CONFIG_PERF_PAGE >> 0) & 0xFF);
+    vscp_test_rxMessage.data[3]     = VSCP_PERF_PROBE_REG_READ * VSCP_PERF_PROBE_REG_NUM;
+    vscp_test_rxMessage.data[4]     = 4;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], (uint8_t)((VSCP_CONFIG_PERF_PAGE >> 8) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], (uint8_t)((VSCP_CONFIG_PERF_PAGE >> 0) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], VSCP_PERF_PROBE_REG_READ * VSCP_PERF_PROBE_REG_NUM);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[5], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[6], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[7], 1);
+
+    /* Reset the register write probe via the performance probe page.
+     * The write itself is still in progress and therefore not counted.
+     */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_WRITE;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = (uint8_t)((VSCP_CONFIG_PERF_PAGE >> 8) & 0xFF);
+    vscp_test_rxMessage.data[2]     = (uint8_t)((VSCP_CONFIG_PERF_PAGE >> 0) & 0xFF);
+    vscp_test_rxMessage.data[3]     = VSCP_PERF_PROBE_REG_WRITE * VSCP_PERF_PROBE_REG_NUM + 3;
+    vscp_test_rxMessage.data[4]     = 0xAA;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 5);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], 0);
+
+    CU_ASSERT_EQUAL(vscp_perf_getStats(VSCP_PERF_PROBE_REG_WRITE, &after), TRUE);
+    CU_ASSERT_EQUAL(after.count, 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Process the core several times and determine the process cycles per second.
+ *  - Read a register.
+ *  - Read the frame counters via the statistics page, with and without taking
+ *    a snapshot.
+ *
+ * Expectation:
+ *  - Every process cycle, received and transmitted frame is counted.
+ *  - The registers return the values of the last snapshot, which is taken by
+ *    reading register 0.
+ */
+extern void vscp_test_stats01(void)
+{
+    uint32_t    processCycles   = 0;
+    uint32_t    rxFrames        = 0;
+    uint32_t    txFrames        = 0;
+    uint8_t     index           = 0;
+
+    vscp_test_initTestCase();
+
+    processCycles = vscp_stats_getCounter(VSCP_STATS_CNT_PROCESS_CYCLES);
+    vscp_stats_process1s();
+
+    for(index = 0; index < 3; ++index)
+    {
+        (void)vscp_core_process();
+    }
+
+    vscp_stats_process1s();
+
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_PROCESS_CYCLES), processCycles + 3);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_PROCESS_CYCLES_1S), 3);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_NUM), 0);
+
+    /* A register read is one received and one transmitted frame. */
+    rxFrames = vscp_stats_getCounter(VSCP_STATS_CNT_RX_FRAMES);
+    txFrames = vscp_stats_getCounter(VSCP_STATS_CNT_TX_FRAMES);
+
+    (void)vscp_test_readRegister(VSCP_REG_NICKNAME_ID);
+
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_RX_FRAMES), rxFrames + 1);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_TX_FRAMES), txFrames + 1);
+
+    /* Read the received and transmitted frames via the statistics page.
+     * Register 0 is read, which takes a snapshot. The read request is already
+     * counted, but not its response.
+     */
+    rxFrames = vscp_stats_getCounter(VSCP_STATS_CNT_RX_FRAMES) + 1;
+    txFrames = vscp_stats_getCounter(VSCP_STATS_CNT_TX_FRAMES);
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = (uint8_t)((VSCP_CONFIG_STATS_PAGE >> 8) & 0xFF);
+    vscp_test_rxMessage.data[2]     = (uint8_t)((VSCP_CONFIG_STATS_PAGE >> 0) & 0xFF);
+    vscp_test_rxMessage.data[3]     = VSCP_STATS_CNT_RX_FRAMES * VSCP_STATS_CNT_REG_NUM;
+    vscp_test_rxMessage.data[4]     = 8;
+
+    vscp_test_waitForTxMessage(2, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], (uint8_t)((rxFrames >> 24) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[5], (uint8_t)((rxFrames >> 16) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[6], (uint8_t)((rxFrames >>  8) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[7], (uint8_t)((rxFrames >>  0) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[3], VSCP_STATS_CNT_TX_FRAMES * VSCP_STATS_CNT_REG_NUM);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[4], (uint8_t)((txFrames >> 24) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[5], (uint8_t)((txFrames >> 16) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[6], (uint8_t)((txFrames >>  8) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[7], (uint8_t)((txFrames >>  0) & 0xFF));
+
+    /* Without reading register 0, the transmitted frames of the last snapshot are read. */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = (uint8_t)((VSCP_CONFIG_STATS_PAGE >> 8) & 0xFF);
+    vscp_test_rxMessage.data[2]     = (uint8_t)((VSCP_CONFIG_STATS_PAGE >> 0) & 0xFF);
+    vscp_test_rxMessage.data[3]     = VSCP_STATS_CNT_TX_FRAMES * VSCP_STATS_CNT_REG_NUM;
+    vscp_test_rxMessage.data[4]     = 4;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 8);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[7], (uint8_t)((txFrames >> 0) & 0xFF));
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_TX_FRAMES), txFrames + 3);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive an event, which was received by the transport adapter 5 ms ago.
+ *  - Receive an event, which was received by the transport adapter just now.
+ *
+ * Expectation:
+ *  - The receive latencies are counted in the corresponding histogram class.
+ *  - The max. receive latency is updated.
+ */
+extern void vscp_test_stats02(void)
+{
+    uint32_t    hist5ms = vscp_stats_getCounter(VSCP_STATS_CNT_RX_LATENCY_HIST + 5);
+    uint32_t    hist0   = vscp_stats_getCounter(VSCP_STATS_CNT_RX_LATENCY_HIST);
+
+    vscp_test_initTestCase();
+
+    /* 5000 us is in class 5: 4096 us <= latency < 8192 us */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_ON;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_3_NORMAL;
+    vscp_test_rxMessage.oAddr       = 0x10;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.timestamp   = vscp_test_portableGetMicros() - 5000;
+
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_RX_LATENCY_HIST + 5), hist5ms + 1);
+    CU_ASSERT(5000 <= vscp_stats_getCounter(VSCP_STATS_CNT_RX_LATENCY_MAX));
+
+    /* No latency */
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_OFF;
+    vscp_test_rxMessage.timestamp   = vscp_test_portableGetMicros();
+
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_RX_LATENCY_HIST), hist0 + 1);
+    CU_ASSERT_EQUAL(vscp_stats_getCounter(VSCP_STATS_CNT_RX_LATENCY_HIST + 5), hist5ms + 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive node heartbeats and who is there responses of other nodes.
+ *  - Iterate over the node table.
+ *  - Set the time since epoch forwards and backwards.
+ *  - Wait until a node expires.
+ *  - Receive a new node online event and remove a node.
+ *
+ * Expectation:
+ *  - Every node is tracked with last seen time, hard-coded flag, heartbeat
+ *    period and GUID.
+ *  - Setting the time since epoch doesn't expire any node.
+ *  - Nodes, which are not seen anymore, are removed.
+ */
+extern void vscp_test_nodeTable01(void)
+{
+    vscp_node_table_Entry   entry;
+    uint8_t                 nickname    = VSCP_NICKNAME_NOT_INIT;
+    uint8_t                 index       = 0;
+    uint32_t                timestamp   = 0;
+
+    vscp_test_initTestCase();
+
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 0);
+
+    /* Node heartbeat of a hard-coded node */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_NODE_HEARTBEAT;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = 0x10;
+    vscp_test_rxMessage.hardCoded   = TRUE;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+
+    timestamp = vscp_node_table_getTime();
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 1);
+    CU_ASSERT_EQUAL(vscp_node_table_isAlive(0x10), TRUE);
+    CU_ASSERT_EQUAL(vscp_node_table_getEntry(0x10, &entry), TRUE);
+    CU_ASSERT_EQUAL(entry.flags, VSCP_NODE_TABLE_FLAG_VALID | VSCP_NODE_TABLE_FLAG_HARD_CODED | VSCP_NODE_TABLE_FLAG_HEARTBEAT);
+    CU_ASSERT_EQUAL(entry.lastSeen, timestamp);
+    CU_ASSERT_EQUAL(entry.heartbeatPeriod, 0);
+
+    /* Next node heartbeat after 3 s */
+    vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 3000);
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_NODE_HEARTBEAT;
+    vscp_test_rxMessage.oAddr       = 0x10;
+    vscp_test_rxMessage.hardCoded   = TRUE;
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_node_table_getEntry(0x10, &entry), TRUE);
+    CU_ASSERT_EQUAL(entry.lastSeen, vscp_node_table_getTime());
+    CU_ASSERT_EQUAL(entry.heartbeatPeriod, vscp_node_table_getTime() - timestamp);
+    CU_ASSERT(2 <= entry.heartbeatPeriod);
+    CU_ASSERT(3 >= entry.heartbeatPeriod);
+
+    /* Who is there response of another node, the first 3 rows contain the GUID. */
+    for(index = 0; index < 7; ++index)
+    {
+        uint8_t dataIndex   = 0;
+
+        vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
+        vscp_test_rxMessage.priority    = VSCP_PRIORITY_3_NORMAL;
+        vscp_test_rxMessage.oAddr       = 0x20;
+        vscp_test_rxMessage.hardCoded   = FALSE;
+        vscp_test_rxMessage.dataSize    = 8;
+        vscp_test_rxMessage.data[0]     = index;
+
+        for(dataIndex = 1; dataIndex < 8; ++dataIndex)
+        {
+            /* GUID MSB first, afterwards the MDF URL */
+            vscp_test_rxMessage.data[dataIndex] = 0xF0 - (index * 7) - dataIndex;
+        }
+
+        (void)vscp_core_process();
+
+        CU_ASSERT_EQUAL(vscp_node_table_getEntry(0x20, &entry), TRUE);
+
+        if (2 > index)
+        {
+            CU_ASSERT_EQUAL(entry.flags & VSCP_NODE_TABLE_FLAG_GUID, 0);
+        }
+        else
+        {
+            CU_ASSERT_EQUAL(entry.flags & VSCP_NODE_TABLE_FLAG_GUID, VSCP_NODE_TABLE_FLAG_GUID);
+        }
+    }
+
+    CU_ASSERT_EQUAL(entry.flags & VSCP_NODE_TABLE_FLAG_HARD_CODED, 0);
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        CU_ASSERT_EQUAL(entry.guid[index], 0xF0 - 16 + index);
+    }
+
+    /* Iterate over all nodes */
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 2);
+    CU_ASSERT_EQUAL(vscp_node_table_getNext(&nickname), TRUE);
+    CU_ASSERT_EQUAL(nickname, 0x10);
+    CU_ASSERT_EQUAL(vscp_node_table_getNext(&nickname), TRUE);
+    CU_ASSERT_EQUAL(nickname, 0x20);
+    CU_ASSERT_EQUAL(vscp_node_table_getNext(&nickname), FALSE);
+
+    /* Time steps of the segment master don't expire any node. */
+    vscp_core_setTimeSinceEpoch(vscp_core_getTimeSinceEpoch() + 100000);
+    vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 300);
+
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 2);
+
+    vscp_core_setTimeSinceEpoch(vscp_core_getTimeSinceEpoch() - 200000);
+    vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 300);
+
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 2);
+
+    /* The node 0x20 is seen again in the middle of the expiry time. */
+    vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 4000);
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_ON;
+    vscp_test_rxMessage.oAddr       = 0x20;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = 0;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    (void)vscp_core_process();
+
+    vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 3000);
+
+    /* Node 0x10 expired. */
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 1);
+    CU_ASSERT_EQUAL(vscp_node_table_isAlive(0x10), FALSE);
+    CU_ASSERT_EQUAL(vscp_node_table_getEntry(0x10, &entry), FALSE);
+    CU_ASSERT_EQUAL(vscp_node_table_isAlive(0x20), TRUE);
+
+    /* Node 0x20 starts up again, the GUID is not valid anymore. */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_0_HIGH;
+    vscp_test_rxMessage.oAddr       = 0x20;
+    vscp_test_rxMessage.dataSize    = 1;
+    vscp_test_rxMessage.data[0]     = 0x20;
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_node_table_getEntry(0x20, &entry), TRUE);
+    CU_ASSERT_EQUAL(entry.flags, VSCP_NODE_TABLE_FLAG_VALID);
+
+    /* Remove the last node */
+    vscp_node_table_remove(0x20);
+
+    CU_ASSERT_EQUAL(vscp_node_table_getNum(), 0);
+    nickname = VSCP_NICKNAME_NOT_INIT;
+    CU_ASSERT_EQUAL(vscp_node_table_getNext(&nickname), FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive the first segment controller heartbeat.
+ *  - Receive a segment controller heartbeat 50 ms too early.
+ *  - Receive a segment controller heartbeat with a time jump.
+ *  - Receive segment controller heartbeats for 60 s, while the platform clock
+ *    is 400 ppm slow.
+ *
+ * Expectation:
+ *  - The first heartbeat sets the time.
+ *  - A small offset is slewed, the time never runs backwards.
+ *  - A time jump sets the time.
+ *  - The drift of the platform clock is estimated and compensated.
+ */
+extern void vscp_test_time01(void)
+{
+    uint32_t    timestamp   = 0;
+    uint32_t    prevWait    = 0;
+    uint16_t    index       = 0;
+    uint16_t    ms          = 0;
+
+    vscp_test_initTestCase();
+
+    CU_ASSERT_EQUAL(vscp_time_isSynchronized(), FALSE);
+
+    /* The first heartbeat sets the time. */
+    vscp_test_receiveSegCtrlHeartbeat(1000);
+
+    CU_ASSERT_EQUAL(vscp_time_isSynchronized(), TRUE);
+    CU_ASSERT_EQUAL(vscp_time_getTimestamp(), 1000 * 1000 + VSCP_CONFIG_TIME_REF_LATENCY);
+    CU_ASSERT_EQUAL(vscp_core_getTimeSinceEpoch(), 1000);
+
+    /* The next heartbeat is 50 ms too early, which shall be slewed. */
+    vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 950);
+    vscp_test_receiveSegCtrlHeartbeat(1001);
+
+    CU_ASSERT_EQUAL(vscp_time_getOffset(), 50);
+    CU_ASSERT_EQUAL(vscp_time_getTimestamp(), 1000 * 1000 + VSCP_CONFIG_TIME_REF_LATENCY + 950);
+
+    timestamp = vscp_time_getTimestamp();
+
+    for(index = 0; index < (50 * VSCP_CONFIG_TIME_SLEW_DIV); ++index)
+    {
+        vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, 1);
+
+        /* Never backwards and never more than doubled */
+        CU_ASSERT(timestamp < vscp_time_getTimestamp());
+        CU_ASSERT((timestamp + 2) >= vscp_time_getTimestamp());
+
+        timestamp = vscp_time_getTimestamp();
+    }
+
+    CU_ASSERT_EQUAL(vscp_time_getTimestamp(), 1001 * 1000 + VSCP_CONFIG_TIME_REF_LATENCY + 50 * VSCP_CONFIG_TIME_SLEW_DIV);
+
+    /* A time jump sets the time. */
+    vscp_test_receiveSegCtrlHeartbeat(2000);
+
+    vscp_time_get(&timestamp, &ms);
+    CU_ASSERT_EQUAL(timestamp, 2000);
+    CU_ASSERT_EQUAL(ms, VSCP_CONFIG_TIME_REF_LATENCY);
+    CU_ASSERT_EQUAL(vscp_time_getOffset(), 0);
+    CU_ASSERT_EQUAL(vscp_time_getDrift(), 0);
+
+    /* The platform clock is 400 ppm slow. */
+    for(index = 1; index <= 60; ++index)
+    {
+        uint32_t    wait    = ((uint32_t)index * 9996) / 10;
+
+        vscp_test_initTestCase();
+        vscp_test_waitForTxMessage(VSCP_TEST_TX_MSG_NUM, (uint16_t)(wait - prevWait));
+        prevWait = wait;
+
+        vscp_test_receiveSegCtrlHeartbeat(2000 + index);
+
+        /* Agreement better than 10 ms */
+        CU_ASSERT(10 > vscp_time_getOffset());
+        CU_ASSERT(-10 < vscp_time_getOffset());
+    }
+
+    CU_ASSERT(200 < vscp_time_getDrift());
+    CU_ASSERT(500 >= vscp_time_getDrift());
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive a level 1 register read over level 2, addressed to this node.
+ *  - Receive a level 1 register read over level 2, addressed to another node.
+ *  - Receive a level 2 event with 300 data bytes.
+ *  - Receive a level 2 event with a level 1 class.
+ *  - Send a level 2 event with 400 and with too many data bytes.
+ *
+ * Expectation:
+ *  - The register read addressed to this node is answered.
+ *  - The level 2 events, which are not handled by the core, are provided to
+ *    the application.
+ *  - The level 2 event with a level 1 class is provided as level 1 event.
+ *  - The level 2 event is sent with the GUID of the node, too many data
+ *    bytes are refused.
+ */
+extern void vscp_test_l2_01(void)
+{
+    uint8_t     guid[VSCP_GUID_SIZE];
+    uint8_t     data[VSCP_CONFIG_L2_DATA_SIZE + 1];
+    uint16_t    index   = 0;
+
+    vscp_test_initTestCase();
+
+    /* GUID of the node, MSB first */
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        guid[index] = vscp_dev_data_getGUID(VSCP_GUID_SIZE - 1 - index);
+    }
+
+    /* Register read over level 2, addressed to this node */
+    vscp_test_rxL2Message.vscpClass = VSCP_CLASS_L1_L2_PROTOCOL;
+    vscp_test_rxL2Message.vscpType  = VSCP_TYPE_PROTOCOL_READ_REGISTER;
+    vscp_test_rxL2Message.priority  = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxL2Message.dataSize  = VSCP_GUID_SIZE + 2;
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        vscp_test_rxL2Message.guid[index] = 0x10 + index;
+        vscp_test_rxL2Message.data[index] = guid[index];
+    }
+
+    vscp_test_rxL2Message.data[VSCP_GUID_SIZE + 0]  = VSCP_TEST_NICKNAME;
+    vscp_test_rxL2Message.data[VSCP_GUID_SIZE + 1]  = VSCP_REG_GUID_15;
+    vscp_test_rxL2MessageValid                      = TRUE;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_RW_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_REG_GUID_15);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], guid[0]);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_L2_EVENT], 0);
+
+    /* Register read over level 2, addressed to another node */
+    vscp_test_initTestCase();
+    vscp_test_rxL2Message.data[0]   = guid[0] ^ 0xFF;
+    vscp_test_rxL2MessageValid      = TRUE;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_L2_EVENT], 1);
+    CU_ASSERT_EQUAL(vscp_test_providedL2Message.vscpClass, VSCP_CLASS_L1_L2_PROTOCOL);
+
+    /* Level 2 event with 300 data bytes */
+    vscp_test_initTestCase();
+    vscp_test_rxL2Message.vscpClass = 1040;
+    vscp_test_rxL2Message.vscpType  = 0x1234;
+    vscp_test_rxL2Message.dataSize  = 300;
+
+    for(index = 0; index < vscp_test_rxL2Message.dataSize; ++index)
+    {
+        vscp_test_rxL2Message.data[index] = (uint8_t)index;
+    }
+
+    vscp_test_rxL2MessageValid = TRUE;
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_L2_EVENT], 1);
+    CU_ASSERT_EQUAL(vscp_test_providedL2Message.vscpClass, 1040);
+    CU_ASSERT_EQUAL(vscp_test_providedL2Message.vscpType, 0x1234);
+    CU_ASSERT_EQUAL(vscp_test_providedL2Message.dataSize, 300);
+    CU_ASSERT_EQUAL(vscp_test_providedL2Message.data[299], (uint8_t)299);
+    CU_ASSERT_EQUAL(vscp_test_providedL2Message.guid[VSCP_GUID_SIZE - 1], 0x1F);
+
+    /* Level 2 event with a level 1 class */
+    vscp_test_initTestCase();
+    vscp_test_rxL2Message.vscpClass = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxL2Message.vscpType  = VSCP_TYPE_INFORMATION_ON;
+    vscp_test_rxL2Message.dataSize  = 3;
+    vscp_test_rxL2MessageValid      = TRUE;
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_L2_EVENT], 0);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_EVENT], 1);
+
+    /* Send level 2 event */
+    for(index = 0; index < sizeof(data); ++index)
+    {
+        data[index] = (uint8_t)(index * 3);
+    }
+
+    CU_ASSERT_EQUAL(vscp_l2_sendEvent(1040, 0x4321, VSCP_PRIORITY_3_NORMAL, data, 400), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_L2_MESSAGE], 1);
+    CU_ASSERT_EQUAL(vscp_test_txL2Message.vscpClass, 1040);
+    CU_ASSERT_EQUAL(vscp_test_txL2Message.vscpType, 0x4321);
+    CU_ASSERT_EQUAL(vscp_test_txL2Message.priority, VSCP_PRIORITY_3_NORMAL);
+    CU_ASSERT_EQUAL(vscp_test_txL2Message.dataSize, 400);
+    CU_ASSERT_EQUAL(vscp_test_txL2Message.data[399], data[399]);
+    CU_ASSERT_EQUAL(memcmp(vscp_test_txL2Message.guid, guid, VSCP_GUID_SIZE), 0);
+
+    /* Too many data bytes */
+    CU_ASSERT_EQUAL(vscp_l2_sendEvent(1040, 0x4321, VSCP_PRIORITY_3_NORMAL, data, sizeof(data)), FALSE);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_L2_MESSAGE], 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Get embedded MDF, without embedded MDF.
+ *  - Get embedded MDF, with a compressed embedded MDF.
+ *  - Get embedded MDF, resumed at frame index 5.
+ *  - Get embedded MDF, resumed behind the last frame.
+ *
+ * Expectation:
+ *  - Without embedded MDF, a single response with index 0 and a zero is sent.
+ *  - The decoded MDF is sent with incrementing frame index, the last response
+ *    contains less than 6 byte.
+ *  - The resumed transfer starts at the requested frame.
+ *  - Behind the last frame, no response is sent.
+ */
+extern void vscp_test_mdf01(void)
+{
+    uint8_t     buffer[sizeof(vscp_test_mdf)];
+    uint16_t    size    = sizeof(vscp_test_mdf) - 1;
+    uint16_t    frames  = size / (VSCP_L1_DATA_SIZE - 2) + 1;
+
+    vscp_test_initTestCase();
+
+    /* Without embedded MDF */
+    vscp_test_embeddedMdf       = NULL;
+    vscp_test_embeddedMdfSize   = 0;
+    vscp_mdf_init();
+
+    CU_ASSERT_EQUAL(vscp_mdf_getSize(), 0);
+    CU_ASSERT_EQUAL(vscp_test_receiveEmbeddedMdf(buffer, sizeof(buffer), 0), 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataSize, 3);
+    CU_ASSERT_EQUAL(buffer[0], 0);
+
+    /* With compressed embedded MDF */
+    vscp_test_embeddedMdf       = vscp_test_mdfBlob;
+    vscp_test_embeddedMdfSize   = sizeof(vscp_test_mdfBlob);
+    vscp_mdf_init();
+
+    CU_ASSERT_EQUAL(vscp_mdf_getSize(), size);
+    CU_ASSERT_EQUAL(vscp_test_receiveEmbeddedMdf(buffer, sizeof(buffer), 0), size);
+    CU_ASSERT_EQUAL(memcmp(buffer, vscp_test_mdf, size), 0);
+
+    /* Resumed at frame index 5 */
+    CU_ASSERT_EQUAL(vscp_test_receiveEmbeddedMdf(buffer, sizeof(buffer), 5), size - 5 * (VSCP_L1_DATA_SIZE - 2));
+    CU_ASSERT_EQUAL(memcmp(buffer, &vscp_test_mdf[5 * (VSCP_L1_DATA_SIZE - 2)], size - 5 * (VSCP_L1_DATA_SIZE - 2)), 0);
+
+    /* Resumed behind the last frame */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = (frames >> 8) & 0xff;
+    vscp_test_rxMessage.data[2]     = (frames >> 0) & 0xff;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    vscp_test_embeddedMdf       = NULL;
+    vscp_test_embeddedMdfSize   = 0;
+    vscp_mdf_init();
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Process the core with an empty decision matrix.
+ *  - Subscribe a class and enable a decision matrix row, which is covered by
+ *    the subscription.
+ *  - Calculate the filters with only two filters available.
+ *  - Add a rule to the decision matrix next generation.
+ *
+ * Expectation:
+ *  - The protocol class and the node heartbeat are programmed, other
+ *    events are rejected.
+ *  - The subscription adds a filter, the covered row adds none.
+ *  - The filters are merged, all necessary events still pass.
+ *  - A single filter, which passes every event, is calculated.
+ */
+extern void vscp_test_filter01(void)
+{
+    vscp_AcceptanceFilter   filters[2];
+    uint8_t                 num     = 0;
+
+    vscp_test_initTestCase();
+
+    /* Empty decision matrix */
+    memset(vscp_test_dmStorage, 0, VSCP_PS_SIZE_DM);
+    vscp_test_dmNG[0] = 0;
+
+    vscp_filter_init();
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_SET_ACCEPTANCE_FILTERS], 1);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(vscp_test_acceptanceFilters, vscp_test_acceptanceFilterNum, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_READ_REGISTER, VSCP_NICKNAME_SEGMENT_MASTER), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(vscp_test_acceptanceFilters, vscp_test_acceptanceFilterNum, VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT, VSCP_TEST_NICKNAME_REMOTE), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(vscp_test_acceptanceFilters, vscp_test_acceptanceFilterNum, VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_BUTTON, VSCP_TEST_NICKNAME_REMOTE), FALSE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(vscp_test_acceptanceFilters, vscp_test_acceptanceFilterNum, VSCP_CLASS_L1_MEASUREMENT, 6, VSCP_TEST_NICKNAME_REMOTE), FALSE);
+
+    /* Filters are programmed only, if they are outdated. */
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_SET_ACCEPTANCE_FILTERS], 1);
+
+    /* Subscribe all measurements */
+    num = vscp_test_acceptanceFilterNum;
+    CU_ASSERT_EQUAL(vscp_filter_subscribe(VSCP_CLASS_L1_MEASUREMENT, 0x01ff, 0, 0), TRUE);
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_SET_ACCEPTANCE_FILTERS], 2);
+    CU_ASSERT_EQUAL(vscp_test_acceptanceFilterNum, num + 1);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(vscp_test_acceptanceFilters, vscp_test_acceptanceFilterNum, VSCP_CLASS_L1_MEASUREMENT, 6, VSCP_TEST_NICKNAME_REMOTE), TRUE);
+
+    /* Decision matrix row, which is covered by the subscription */
+    vscp_test_dmStorage[0].flags        = VSCP_DM_FLAG_ENABLE | VSCP_DM_FLAG_CHECK_OADDR;
+    vscp_test_dmStorage[0].oaddr        = VSCP_TEST_NICKNAME_REMOTE;
+    vscp_test_dmStorage[0].classMask    = 0xff;
+    vscp_test_dmStorage[0].classFilter  = VSCP_CLASS_L1_MEASUREMENT;
+    vscp_test_dmStorage[0].typeMask     = 0xff;
+    vscp_test_dmStorage[0].typeFilter   = 6;
+    vscp_test_dmStorage[0].action       = 1;
+    vscp_filter_invalidate();
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_SET_ACCEPTANCE_FILTERS], 3);
+    CU_ASSERT_EQUAL(vscp_test_acceptanceFilterNum, num + 1);
+
+    /* Decision matrix row for a button of a single node */
+    vscp_test_dmStorage[1].flags        = VSCP_DM_FLAG_ENABLE | VSCP_DM_FLAG_CHECK_OADDR;
+    vscp_test_dmStorage[1].oaddr        = VSCP_TEST_NICKNAME_REMOTE;
+    vscp_test_dmStorage[1].classMask    = 0xff;
+    vscp_test_dmStorage[1].classFilter  = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_dmStorage[1].typeMask     = 0xff;
+    vscp_test_dmStorage[1].typeFilter   = VSCP_TYPE_INFORMATION_BUTTON;
+    vscp_test_dmStorage[1].action       = 1;
+
+    /* Only two filters available */
+    CU_ASSERT_EQUAL(vscp_filter_calculate(filters, VSCP_TEST_ARRAY_NUM(filters)), 2);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(filters, 2, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_READ_REGISTER, VSCP_NICKNAME_SEGMENT_MASTER), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(filters, 2, VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT, VSCP_TEST_NICKNAME_REMOTE), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(filters, 2, VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_BUTTON, VSCP_TEST_NICKNAME_REMOTE), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(filters, 2, VSCP_CLASS_L1_MEASUREMENT, 6, VSCP_TEST_NICKNAME_REMOTE), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_isAccepted(filters, 2, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_START, VSCP_TEST_NICKNAME_REMOTE), TRUE);
+
+    /* Decision matrix next generation with a rule */
+    vscp_test_dmNG[0] = 1;
+
+    CU_ASSERT_EQUAL(vscp_filter_calculate(filters, VSCP_TEST_ARRAY_NUM(filters)), 1);
+    CU_ASSERT_EQUAL(filters[0].mask, 0);
+
+    /* Clean up */
+    vscp_test_dmNG[0] = 0;
+    memset(vscp_test_dmStorage, 0, VSCP_PS_SIZE_DM);
+    vscp_filter_unsubscribeAll();
+    (void)vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_acceptanceFilterNum, num);
+
+    return;
+}
+
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Decode normalized integers with different sizes and signs.
+ *
+ * Expectation:
+ *  - Data value is sign extended and exponent is correct.
+ */
+extern void vscp_test_dataCoding01(void)
+{
+    uint8_t codedData1[]    = { 0x81, 0xea };               /* -22 * 10^-1 */
+    uint8_t codedData2[]    = { 0x02, 0xfe, 0xd4 };         /* -300 * 10^2 */
+    uint8_t codedData3[]    = { 0x00, 0x7f, 0xff };         /* 32767 */
+    uint8_t codedData4[]    = { 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe }; /* -2 * 10^-3 */
+    int32_t data32          = 0;
+    int64_t data64          = 0;
+    int8_t  exp             = 0;
+
+    vscp_data_coding_normalizedIntegerToInt32(codedData1, sizeof(codedData1), &data32, &exp);
+    CU_ASSERT_EQUAL(data32, -22);
+    CU_ASSERT_EQUAL(exp, -1);
+
+    vscp_data_coding_normalizedIntegerToInt32(codedData2, sizeof(codedData2), &data32, &exp);
+    CU_ASSERT_EQUAL(data32, -300);
+    CU_ASSERT_EQUAL(exp, 2);
+
+    vscp_data_coding_normalizedIntegerToInt32(codedData3, sizeof(codedData3), &data32, &exp);
+    CU_ASSERT_EQUAL(data32, 32767);
+    CU_ASSERT_EQUAL(exp, 0);
+
+    /* 64 bit values are not supported by the 32 bit decoder */
+    vscp_data_coding_normalizedIntegerToInt32(codedData4, sizeof(codedData4), &data32, &exp);
+    CU_ASSERT_EQUAL(data32, 0);
+    CU_ASSERT_EQUAL(exp, 0);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_normalizedIntegerToInt64(codedData4, sizeof(codedData4), &data64, &exp), TRUE);
+    CU_ASSERT_EQUAL(data64, -2);
+    CU_ASSERT_EQUAL(exp, -3);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_normalizedIntegerToInt64(codedData1, 1, &data64, &exp), FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Decode normalized integers to floating point values.
+ *
+ * Expectation:
+ *  - Value is scaled by the exponent.
+ */
+extern void vscp_test_dataCoding02(void)
+{
+    uint8_t codedData1[]    = { 0x81, 0xea };       /* -22 * 10^-1 */
+    uint8_t codedData2[]    = { 0x02, 0xfe, 0xd4 }; /* -300 * 10^2 */
+    double  value           = 0.0;
+
+    CU_ASSERT_EQUAL(vscp_data_coding_normalizedIntegerToDouble(codedData1, sizeof(codedData1), &value), TRUE);
+    CU_ASSERT_DOUBLE_EQUAL(value, -2.2, 0.000001);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_normalizedIntegerToDouble(codedData2, sizeof(codedData2), &value), TRUE);
+    CU_ASSERT_DOUBLE_EQUAL(value, -30000.0, 0.000001);
+
+    CU_ASSERT_DOUBLE_EQUAL(vscp_data_coding_toDouble(5, 100), 5e100, 1e88);
+    CU_ASSERT_DOUBLE_EQUAL(vscp_data_coding_toDouble(5, -100), 5e-100, 1e-112);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Decode several received measurement events at once.
+ *
+ * Expectation:
+ *  - Measurement events are decoded, all other events are marked as invalid.
+ */
+extern void vscp_test_dataCoding03(void)
+{
+    vscp_RxMessage                  msgs[3];
+    vscp_data_coding_Measurement    measurements[VSCP_TEST_ARRAY_NUM(msgs)];
+
+    memset(msgs, 0, sizeof(msgs));
+
+    msgs[0].vscpClass   = VSCP_CLASS_L1_MEASUREMENT;
+    msgs[0].vscpType    = 6;    /* Temperature */
+    msgs[0].oAddr       = VSCP_TEST_NICKNAME_REMOTE;
+    msgs[0].dataSize    = 3;
+    msgs[0].data[0]     = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, 1, 2);
+    msgs[0].data[1]     = 0x81;
+    msgs[0].data[2]     = 0xea;
+
+    msgs[1].vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    msgs[1].vscpType    = VSCP_TYPE_INFORMATION_ALIVE;
+    msgs[1].oAddr       = VSCP_TEST_NICKNAME_REMOTE;
+    msgs[1].dataSize    = 0;
+
+    msgs[2].vscpClass   = VSCP_CLASS_L1_MEASUREZONE;
+    msgs[2].vscpType    = 6;    /* Temperature */
+    msgs[2].oAddr       = VSCP_TEST_NICKNAME_REMOTE;
+    msgs[2].dataSize    = 6;
+    msgs[2].data[0]     = 0;
+    msgs[2].data[1]     = VSCP_TEST_HEARTBEAT_ZONE;
+    msgs[2].data[2]     = VSCP_TEST_HEARTBEAT_SUB_ZONE;
+    msgs[2].data[3]     = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, 0, 0);
+    msgs[2].data[4]     = 0x01;
+    msgs[2].data[5]     = 0x21;
+
+    CU_ASSERT_EQUAL(vscp_data_coding_decodeMeasurements(msgs, VSCP_TEST_ARRAY_NUM(msgs), measurements), 2);
+
+    CU_ASSERT_EQUAL(measurements[0].isValid, TRUE);
+    CU_ASSERT_EQUAL(measurements[0].vscpClass, VSCP_CLASS_L1_MEASUREMENT);
+    CU_ASSERT_EQUAL(measurements[0].oAddr, VSCP_TEST_NICKNAME_REMOTE);
+    CU_ASSERT_EQUAL(measurements[0].value.representation, VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER);
+    CU_ASSERT_EQUAL(measurements[0].value.unit, 1);
+    CU_ASSERT_EQUAL(measurements[0].value.index, 2);
+    CU_ASSERT_EQUAL(measurements[0].value.data, -22);
+    CU_ASSERT_EQUAL(measurements[0].value.exp, -1);
+
+    CU_ASSERT_EQUAL(measurements[1].isValid, FALSE);
+
+    CU_ASSERT_EQUAL(measurements[2].isValid, TRUE);
+    CU_ASSERT_EQUAL(measurements[2].value.data, 33);
+    CU_ASSERT_EQUAL(measurements[2].value.exp, 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode values in bit, byte, integer, string and floating point representation.
+ *  - Decode them again.
+ *
+ * Expectation:
+ *  - Only the necessary number of bytes is used and the decoded values are equal.
+ */
+extern void vscp_test_dataCoding04(void)
+{
+    uint8_t     codedData[VSCP_L1_DATA_SIZE];
+    uint64_t    dataU64     = 0;
+    int64_t     data64      = 0;
+    int32_t     data32      = 0;
+    int8_t      exp         = 0;
+    float       dataFloat   = 0.0f;
+
+    CU_ASSERT_EQUAL(vscp_data_coding_uint32ToBit(0x0180, codedData, sizeof(codedData)), 2);
+    CU_ASSERT_EQUAL(codedData[0], 0x01);
+    CU_ASSERT_EQUAL(codedData[1], 0x80);
+    CU_ASSERT_EQUAL(vscp_data_coding_bitToUint64(codedData, 2, &dataU64), TRUE);
+    CU_ASSERT_EQUAL(dataU64, 0x0180);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_uint32ToByte(200, codedData, sizeof(codedData)), 1);
+    CU_ASSERT_EQUAL(vscp_data_coding_byteToUint64(codedData, 1, &dataU64), TRUE);
+    CU_ASSERT_EQUAL(dataU64, 200);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToInteger(-128, codedData, sizeof(codedData)), 1);
+    CU_ASSERT_EQUAL(codedData[0], 0x80);
+    CU_ASSERT_EQUAL(vscp_data_coding_integerToInt64(codedData, 1, &data64), TRUE);
+    CU_ASSERT_EQUAL(data64, -128);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToInteger(128, codedData, sizeof(codedData)), 2);
+    CU_ASSERT_EQUAL(vscp_data_coding_integerToInt64(codedData, 2, &data64), TRUE);
+    CU_ASSERT_EQUAL(data64, 128);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToString(-22, -1, codedData, sizeof(codedData)), 4);
+    CU_ASSERT_NSTRING_EQUAL(codedData, "-2.2", 4);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32(codedData, 4, &data32, &exp), TRUE);
+    CU_ASSERT_EQUAL(data32, -22);
+    CU_ASSERT_EQUAL(exp, -1);
+
+    /* Limits of a 32 bit signed integer */
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"2147483647", 10, &data32, &exp), TRUE);
+    CU_ASSERT_EQUAL(data32, INT32_MAX);
+    CU_ASSERT_EQUAL(exp, 0);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"2147483648", 10, &data32, &exp), FALSE);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"2147483649", 10, &data32, &exp), FALSE);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"-2147483648", 11, &data32, &exp), TRUE);
+    CU_ASSERT_EQUAL(data32, INT32_MIN);
+    CU_ASSERT_EQUAL(exp, 0);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"-2147483649", 11, &data32, &exp), FALSE);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToString(5, -2, codedData, sizeof(codedData)), 4);
+    CU_ASSERT_NSTRING_EQUAL(codedData, "0.05", 4);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToString(33, 1, codedData, sizeof(codedData)), 3);
+    CU_ASSERT_NSTRING_EQUAL(codedData, "330", 3);
+
+    /* Doesn't fit */
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToString(-12345678, 0, codedData, 7), 0);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_floatToFloatingPoint(-1.5f, codedData, sizeof(codedData)), 4);
+    CU_ASSERT_EQUAL(codedData[0], 0xbf);
+    CU_ASSERT_EQUAL(codedData[1], 0xc0);
+    CU_ASSERT_EQUAL(codedData[2], 0x00);
+    CU_ASSERT_EQUAL(codedData[3], 0x00);
+    CU_ASSERT_EQUAL(vscp_data_coding_floatingPointToFloat(codedData, 4, &dataFloat), TRUE);
+    CU_ASSERT_DOUBLE_EQUAL(dataFloat, -1.5, 0.000001);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode values in the most compact representation.
+ *
+ * Expectation:
+ *  - The representation with the smallest size is used.
+ */
+extern void vscp_test_dataCoding05(void)
+{
+    uint8_t                 codedData[VSCP_L1_DATA_SIZE];
+    vscp_data_coding_Value  value;
+
+    /* Integer */
+    CU_ASSERT_EQUAL(vscp_data_coding_encodeCompact(-5, 0, 1, 2, codedData, sizeof(codedData)), 2);
+    CU_ASSERT_EQUAL(vscp_data_coding_getRepresentation(codedData[0]), VSCP_DATA_CODING_REPRESENTATION_INTEGER);
+    CU_ASSERT_EQUAL(vscp_data_coding_decode(codedData, 2, &value), TRUE);
+    CU_ASSERT_EQUAL(value.unit, 1);
+    CU_ASSERT_EQUAL(value.index, 2);
+    CU_ASSERT_EQUAL(value.data, -5);
+
+    /* Byte, because a positive value doesn't need the sign bit */
+    CU_ASSERT_EQUAL(vscp_data_coding_encodeCompact(200, 0, 0, 0, codedData, sizeof(codedData)), 2);
+    CU_ASSERT_EQUAL(vscp_data_coding_getRepresentation(codedData[0]), VSCP_DATA_CODING_REPRESENTATION_BYTE);
+    CU_ASSERT_EQUAL(vscp_data_coding_decode(codedData, 2, &value), TRUE);
+    CU_ASSERT_EQUAL(value.data, 200);
+
+    /* Integer, scaled by the positive exponent */
+    CU_ASSERT_EQUAL(vscp_data_coding_encodeCompact(1, 2, 0, 0, codedData, sizeof(codedData)), 2);
+    CU_ASSERT_EQUAL(vscp_data_coding_getRepresentation(codedData[0]), VSCP_DATA_CODING_REPRESENTATION_INTEGER);
+    CU_ASSERT_EQUAL(codedData[1], 100);
+
+    /* Normalized integer, because of the fraction */
+    CU_ASSERT_EQUAL(vscp_data_coding_encodeCompact(-22, -1, 0, 0, codedData, sizeof(codedData)), 3);
+    CU_ASSERT_EQUAL(vscp_data_coding_getRepresentation(codedData[0]), VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER);
+    CU_ASSERT_EQUAL(vscp_data_coding_decode(codedData, 3, &value), TRUE);
+    CU_ASSERT_DOUBLE_EQUAL(vscp_data_coding_valueToDouble(&value), -2.2, 0.000001);
+
+    /* Integer, because zero doesn't need the fraction */
+    CU_ASSERT_EQUAL(vscp_data_coding_encodeCompact(0, -2, 0, 0, codedData, sizeof(codedData)), 2);
+    CU_ASSERT_EQUAL(vscp_data_coding_getRepresentation(codedData[0]), VSCP_DATA_CODING_REPRESENTATION_INTEGER);
+    CU_ASSERT_EQUAL(codedData[1], 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode integer and floating point values in the shortest normalized integer format.
+ *
+ * Expectation:
+ *  - Trailing decimal zeros are removed and the exponent is adjusted.
+ */
+extern void vscp_test_dataCoding06(void)
+{
+    uint8_t codedData[VSCP_L1_DATA_SIZE];
+    int32_t data32  = 0;
+    int8_t  exp     = 0;
+
+    /* 21500 * 10^-3 => 215 * 10^-1 */
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToNormalizedIntegerShortest(21500, -3, codedData, sizeof(codedData)), 3);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, 3, &data32, &exp);
+    CU_ASSERT_EQUAL(data32, 215);
+    CU_ASSERT_EQUAL(exp, -1);
+
+    /* Zero has no trailing zeros */
+    CU_ASSERT_EQUAL(vscp_data_coding_int32ToNormalizedIntegerShortest(0, -3, codedData, sizeof(codedData)), 2);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, 2, &data32, &exp);
+    CU_ASSERT_EQUAL(data32, 0);
+    CU_ASSERT_EQUAL(exp, -3);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_doubleToNormalizedInteger(21.5, 3, codedData, sizeof(codedData)), 3);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, 3, &data32, &exp);
+    CU_ASSERT_EQUAL(data32, 215);
+    CU_ASSERT_EQUAL(exp, -1);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_doubleToNormalizedInteger(-21.456, 2, codedData, sizeof(codedData)), 3);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, 3, &data32, &exp);
+    CU_ASSERT_EQUAL(data32, -2146);
+    CU_ASSERT_EQUAL(exp, -2);
+
+    /* Doesn't fit into 32 bit */
+    CU_ASSERT_EQUAL(vscp_data_coding_doubleToNormalizedInteger(1e12, 0, codedData, sizeof(codedData)), 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Parse information class button events with and without the optional code page.
+ *  - Parse a too short event and an event with a different type.
+ *
+ * Expectation:
+ *  - The parameters are decoded in big endian byte order.
+ *  - Invalid events are rejected.
+ */
+extern void vscp_test_evtParse01(void)
+{
+    vscp_RxMessage                  rxMsg;
+    vscp_evt_information_Button     button;
+    vscp_evt_information_Event      evt;
+
+    memset(&rxMsg, 0, sizeof(rxMsg));
+    rxMsg.vscpClass = VSCP_CLASS_L1_INFORMATION;
+    rxMsg.vscpType  = VSCP_TYPE_INFORMATION_BUTTON;
+    rxMsg.dataSize  = 5;
+    rxMsg.data[0]   = 0x01;
+    rxMsg.data[1]   = 0x02;
+    rxMsg.data[2]   = 0x03;
+    rxMsg.data[3]   = 0x12;
+    rxMsg.data[4]   = 0x34;
+    rxMsg.data[5]   = 0x56;
+    rxMsg.data[6]   = 0x78;
+
+    CU_ASSERT_EQUAL(vscp_evt_information_parseButton(&rxMsg, &button), TRUE);
+    CU_ASSERT_EQUAL(button.buttonState, 0x01);
+    CU_ASSERT_EQUAL(button.zone, 0x02);
+    CU_ASSERT_EQUAL(button.subZone, 0x03);
+    CU_ASSERT_EQUAL(button.buttonCode, 0x1234);
+    CU_ASSERT_EQUAL(button.codePageAvailable, FALSE);
+
+    rxMsg.dataSize = 7;
+    CU_ASSERT_EQUAL(vscp_evt_information_parse(&rxMsg, &evt), TRUE);
+    CU_ASSERT_EQUAL(evt.vscpType, VSCP_TYPE_INFORMATION_BUTTON);
+    CU_ASSERT_EQUAL(evt.data.button.buttonCode, 0x1234);
+    CU_ASSERT_EQUAL(evt.data.button.codePageAvailable, TRUE);
+    CU_ASSERT_EQUAL(evt.data.button.codePage, 0x5678);
+
+    /* Too short */
+    rxMsg.dataSize = 4;
+    CU_ASSERT_EQUAL(vscp_evt_information_parseButton(&rxMsg, &button), FALSE);
+    CU_ASSERT_EQUAL(vscp_evt_information_parse(&rxMsg, &evt), FALSE);
+
+    /* Different type */
+    rxMsg.dataSize = 5;
+    rxMsg.vscpType = VSCP_TYPE_INFORMATION_MOUSE;
+    CU_ASSERT_EQUAL(vscp_evt_information_parseButton(&rxMsg, &button), FALSE);
+
+    /* Event without parameters */
+    rxMsg.vscpType = VSCP_TYPE_INFORMATION_GENERAL;
+    rxMsg.dataSize = 0;
+    CU_ASSERT_EQUAL(vscp_evt_information_parse(&rxMsg, &evt), TRUE);
+
+    /* Different class */
+    rxMsg.vscpClass = VSCP_CLASS_L1_MEASUREMENT;
+    CU_ASSERT_EQUAL(vscp_evt_information_parse(&rxMsg, &evt), FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Parse measurement class events of different types, which share a common frame layout.
+ *
+ * Expectation:
+ *  - The common parser is selected and the value is decoded.
+ */
+extern void vscp_test_evtParse02(void)
+{
+    vscp_RxMessage                  rxMsg;
+    vscp_evt_measurement_Event      evt;
+
+    memset(&rxMsg, 0, sizeof(rxMsg));
+    rxMsg.vscpClass = VSCP_CLASS_L1_MEASUREMENT;
+    rxMsg.vscpType  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+    rxMsg.dataSize  = 1 + vscp_data_coding_int32ToNormalizedInteger(215, -1, &rxMsg.data[1], VSCP_L1_DATA_SIZE - 1);
+    rxMsg.data[0]   = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, 1, 2);
+
+    CU_ASSERT_EQUAL(vscp_evt_measurement_parse(&rxMsg, &evt), TRUE);
+    CU_ASSERT_EQUAL(evt.vscpType, VSCP_TYPE_MEASUREMENT_TEMPERATURE);
+    CU_ASSERT_EQUAL(evt.data.common.unit, 1);
+    CU_ASSERT_EQUAL(evt.data.common.index, 2);
+    CU_ASSERT_EQUAL(evt.data.common.data, 215);
+    CU_ASSERT_EQUAL(evt.data.common.exp, -1);
+
+    rxMsg.vscpType = VSCP_TYPE_MEASUREMENT_HUMIDITY;
+    CU_ASSERT_EQUAL(vscp_evt_measurement_parse(&rxMsg, &evt), TRUE);
+    CU_ASSERT_EQUAL(evt.vscpType, VSCP_TYPE_MEASUREMENT_HUMIDITY);
+    CU_ASSERT_EQUAL(evt.data.common.data, 215);
+
+    /* No data */
+    rxMsg.dataSize = 0;
+    CU_ASSERT_EQUAL(vscp_evt_measurement_parse(&rxMsg, &evt), FALSE);
+
+    return;
+}
+
+
+/* -------------------------------------------------------------------------- */
+/*      Stubs                                                                 */
+/* -------------------------------------------------------------------------- */
+
+extern void vscp_test_psAccessInit(void)
+{
+    vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PS_ACCESS_INIT]++;
+    return;
+}
+
+extern uint8_t  vscp_test_psAccessRead8(uint16_t addr)
+{
+    uint8_t value   = 0;
+
+    /* Check address out of bounce. */
+    if (VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) <= addr)
+    {
+        CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) > addr);
+    }
+    else
+    {
+        value = vscp_test_persistentMemory[addr];
+    }
+
+    return value;
+}
+
+extern void vscp_test_psAccessWrite8(uint16_t addr, uint8_t value)
+{
+    /* Check address out of bounce. */
+    if (VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) <= addr)
+    {
+        CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_persistentMemory) > addr);
+    }
+    else
+    {
+        vscp_test_persistentMemory[addr] = value;
+    }
+
+    return;
+}
+
+extern void vscp_test_appRegInit(void)
+{
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_APP_REG_INIT];
+    return;
+}
+
+extern void vscp_test_tpAdatperInit(void)
+{
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_INIT];
+    return;
+}
+
+extern BOOL vscp_test_tpAdatperReadMessage(vscp_RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
+
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_READ_MESSAGE];
+
+    *msg = vscp_test_rxMessage;
+
+    if (0 != vscp_test_rxMessage.vscpType)
+    {
+        status = TRUE;
+    }
+
+    /* Make message invalid */
+    vscp_test_rxMessage.vscpType = 0;
+
+    return status;
+}
+
+extern BOOL vscp_test_tpAdatperReadL2Message(vscp_L2RxMessage * const msg)
+{
+    BOOL    status  = vscp_test_rxL2MessageValid;
+
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
+
+    if (TRUE == status)
+    {
+        *msg = vscp_test_rxL2Message;
+    }
+
+    /* Make message invalid */
+    vscp_test_rxL2MessageValid = FALSE;
+
+    return status;
+}
+
+extern BOOL vscp_test_tpAdatperWriteL2Message(vscp_L2TxMessage const * const msg)
+{
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
+
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_L2_MESSAGE];
+
+    vscp_test_txL2Message = *msg;
+
+    return (FALSE == vscp_test_isTxBlocked) ? TRUE : FALSE;
+}
+
+extern void vscp_test_tpAdatperSetAcceptanceFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_acceptanceFilters) >= num);
+
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_SET_ACCEPTANCE_FILTERS];
+
+    memcpy(vscp_test_acceptanceFilters, filters, num * sizeof(vscp_AcceptanceFilter));
+    vscp_test_acceptanceFilterNum = num;
+
+    return;
+}
+
+extern BOOL vscp_test_tpAdatperWriteMessage(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = TRUE;
+
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
+    CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_txMessage) > vscp_test_txMessageCnt);
+
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE];
+
+    if (TRUE == vscp_test_isTxBlocked)
+    {
+        status = FALSE;
+    }
+    else
+    {
+        vscp_test_txMessage[vscp_test_txMessageCnt] = *msg;
+        ++vscp_test_txMessageCnt;
+    }
+
+    return status;
+}
+
+extern void vscp_test_portableInit(void)
+{
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_INIT];
+    return;
+}
+
+extern void vscp_test_portableRestoreFactoryDefaultSettings(void)
+{
+    uint8_t index   = 0;
+    uint8_t part    = 0;
+
+    vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_APP_RESTORE_FACTORY_DEFAULTS]++;
+
+    /* Restore GUID */
+    for(part = 0; part < 4; ++part)
+    {
+        uint32_t    guidPart    = 0;
+
+        if (0 == part)
+        {
+            guidPart = VSCP_TEST_GUID_0;
+        }
+        else if (1 == part)
+        {
+            guidPart = VSCP_TEST_GUID_1;
+        }
+        else if (2 == part)
+        {
+            guidPart = VSCP_TEST_GUID_2;
+        }
+        else
+        {
+            guidPart = VSCP_TEST_GUID_3;
+        }
+
+        for(index = 0; index < 4; ++index)
+        {
+            uint8_t     value   = ((uint8_t*)&guidPart)[index];
+
+            vscp_ps_writeGUID((part * 4) + index, value);
+        }
+    }
+
+    /* Restore manufacturer device id */
+    for(index = 0; index < sizeof(VSCP_TEST_MANUFACTURER_DEV_ID); ++index)
+    {
+        uint32_t    manufacturerDevId   = VSCP_TEST_MANUFACTURER_DEV_ID;
+        uint8_t     value               = ((uint8_t*)&manufacturerDevId)[index];
+
+        vscp_ps_writeManufacturerDevId(index, value);
+    }
+
+    /* Restore manufacturer sub device id */
     for(index = 0; index < sizeof(VSCP_TEST_MANUFACTURER_SUB_DEV_ID); ++index)
     {
         uint32_t    manufacturerSubDevId    = VSCP_TEST_MANUFACTURER_SUB_DEV_ID;
@@ -3647,7 +6481,7 @@ extern void vscp_test_portableErrorStateEntered(void)
 
 extern uint8_t  vscp_test_portableGetBootLoaderAlgorithm(void)
 {
-    return VSCP_TEST_BOOT_LOADER_ALGORITHM;
+    return vscp_test_bootLoaderAlgorithm;
 }
 
 extern uint8_t  vscp_test_portableGetPagesUsed(void)
@@ -3683,6 +6517,15 @@ extern void vscp_test_portableProvideEvent(vscp_RxMessage const * const msg)
     return;
 }
 
+extern void vscp_test_portableProvideL2Event(vscp_L2RxMessage const * const msg)
+{
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_L2_EVENT];
+
+    vscp_test_providedL2Message = *msg;
+
+    return;
+}
+
 extern void vscp_test_portableUpdateTimeSinceEpoch(uint32_t timestamp)
 {
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_UPDATE_TIME_SINCE_EPOCH];
@@ -3701,6 +6544,29 @@ extern void vscp_test_portableSetLampState(VSCP_LAMP_STATE state)
     return;
 }
 
+extern uint8_t vscp_test_portableReadEmbeddedMdf(uint16_t index)
+{
+    uint8_t value   = 0;
+
+    if ((NULL != vscp_test_embeddedMdf) &&
+        (vscp_test_embeddedMdfSize > index))
+    {
+        value = vscp_test_embeddedMdf[index];
+    }
+
+    return value;
+}
+
+extern uint32_t vscp_test_portableGetMillis(void)
+{
+    return vscp_test_millis;
+}
+
+extern uint32_t vscp_test_portableGetMicros(void)
+{
+    return vscp_test_millis * 1000;
+}
+
 extern void vscp_test_actionInit(void)
 {
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_ACTION_INIT];
@@ -3730,6 +6596,12 @@ static void vscp_test_initTestCase(void)
     /* Reset tx message buffer */
     vscp_test_txMessageCnt = 0;
 
+    /* Transport layer accepts all messages */
+    vscp_test_isTxBlocked = FALSE;
+
+    /* Node jumps to the external boot loader */
+    vscp_test_bootLoaderAlgorithm = VSCP_TEST_BOOT_LOADER_ALGORITHM;
+
     return;
 }
 
@@ -3752,6 +6624,30 @@ static void vscp_test_waitForTxMessage(uint8_t min, uint16_t max)
     return;
 }
 
+static uint32_t vscp_test_waitForHeartbeat(uint32_t max)
+{
+    uint32_t    elapsed     = 0;
+    uint8_t     txErrors    = vscp_transport_getTransmitErrorCounter();
+
+    /* Clear transmit message buffers */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+
+    /* Wait until a message is sent or refused by the transport layer */
+    while((0 == vscp_test_txMessageCnt) &&
+          (txErrors == vscp_transport_getTransmitErrorCounter()) &&
+          (max > elapsed))
+    {
+        /* Process core */
+        vscp_test_processTimers();
+        (void)vscp_core_process();
+
+        ++elapsed;
+    }
+
+    return elapsed;
+}
+
 static void vscp_test_processTimers(void)
 {
     uint8_t index   = 0;
@@ -3764,6 +6660,8 @@ static void vscp_test_processTimers(void)
         }
     }
 
+    ++vscp_test_millis;
+
     return;
 }
 
@@ -3830,6 +6728,105 @@ static uint8_t  vscp_test_writeRegister(uint8_t addr, uint8_t value, BOOL readOn
     return value;
 }
 
+static void vscp_test_receiveSegCtrlHeartbeat(uint32_t timestamp)
+{
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_SEGCTRL_HEARTBEAT;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 5;
+    vscp_test_rxMessage.data[0]     = vscp_ps_readSegmentControllerCRC();
+    vscp_test_rxMessage.data[1]     = (timestamp >> 24) & 0xff;    /* Time since epoch */
+    vscp_test_rxMessage.data[2]     = (timestamp >> 16) & 0xff;    /* Time since epoch */
+    vscp_test_rxMessage.data[3]     = (timestamp >>  8) & 0xff;    /* Time since epoch */
+    vscp_test_rxMessage.data[4]     = (timestamp >>  0) & 0xff;    /* Time since epoch */
+
+    (void)vscp_core_process();
+
+    return;
+}
+
+static uint16_t vscp_test_receiveEmbeddedMdf(uint8_t * const buffer, uint16_t size, uint16_t index)
+{
+    uint16_t    received    = 0;
+    uint16_t    max         = 100;
+    BOOL        isEnd       = FALSE;
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataSize    = 3;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = (index >> 8) & 0xff;
+    vscp_test_rxMessage.data[2]     = (index >> 0) & 0xff;
+
+    /* The transport layer refuses the first responses, which limits the
+     * responses to one burst per process cycle.
+     */
+    vscp_test_isTxBlocked = TRUE;
+    vscp_test_txMessageCnt = 0;
+    (void)vscp_core_process();
+    vscp_test_isTxBlocked = FALSE;
+
+    while((FALSE == isEnd) && (0 < max))
+    {
+        uint8_t msgIndex    = 0;
+
+        vscp_test_waitForTxMessage(1, 1);
+
+        for(msgIndex = 0; msgIndex < vscp_test_txMessageCnt; ++msgIndex)
+        {
+            vscp_TxMessage const * const    msg     = &vscp_test_txMessage[msgIndex];
+            uint8_t                         num     = msg->dataSize - 2;
+
+            CU_ASSERT_EQUAL(msg->vscpClass, VSCP_CLASS_L1_PROTOCOL);
+            CU_ASSERT_EQUAL(msg->vscpType, VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE);
+            CU_ASSERT_FATAL(2 <= msg->dataSize);
+
+            /* Frame index */
+            CU_ASSERT_EQUAL((msg->data[0] << 8) | msg->data[1], index);
+            CU_ASSERT_FATAL(size >= (received + num));
+
+            memcpy(&buffer[received], &msg->data[2], num);
+            received += num;
+            ++index;
+
+            /* Last response */
+            if ((VSCP_L1_DATA_SIZE - 2) > num)
+            {
+                CU_ASSERT_EQUAL(msgIndex + 1, vscp_test_txMessageCnt);
+                isEnd = TRUE;
+            }
+        }
+
+        --max;
+    }
+
+    CU_ASSERT_EQUAL(isEnd, TRUE);
+
+    return received;
+}
+
+static BOOL vscp_test_isAccepted(vscp_AcceptanceFilter const * const filters, uint8_t num, uint16_t vscpClass, uint8_t vscpType, uint8_t oAddr)
+{
+    uint32_t    id          = VSCP_FILTER_CLASS(vscpClass) | VSCP_FILTER_TYPE(vscpType) | VSCP_FILTER_OADDR(oAddr);
+    uint8_t     index       = 0;
+    BOOL        isAccepted  = FALSE;
+
+    for(index = 0; index < num; ++index)
+    {
+        if (filters[index].id == (id & filters[index].mask))
+        {
+            isAccepted = TRUE;
+        }
+    }
+
+    return isAccepted;
+}
+
 static uint8_t  vscp_test_getAlarmStatus(uint8_t value)
 {
     /* Prepare alarm status */
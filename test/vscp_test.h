@@ -403,6 +403,7 @@ extern void vscp_test_active14(void);
  *  - All registers can be read and return the correct value.
  *  - All read/write registers can be written.
  *  - All read only registers can not be written.
+ *  - The alarm status register is cleared after it was read.
  */
 extern void vscp_test_active15(void);
 
@@ -592,6 +593,7 @@ extern int vscp_test_initDM(void);
  *
  * Expectation:
  *  - Action 1 is executed.
+ *  - The match and the executed action are counted.
  */
 extern void vscp_test_dm01(void);
 
@@ -714,6 +716,7 @@ extern void vscp_test_dmNG01(void);
  *
  * Expectation:
  *  - Action 1 is executed.
+ *  - The executed action is counted.
  */
 extern void vscp_test_dmNG02(void);
 
@@ -781,6 +784,474 @@ extern void vscp_test_active34(void);
  */
 extern void vscp_test_active35(void);
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Read page, which spans several register regions and reserved registers.
+ *
+ * Expectation:
+ *  - Page shall be read, reserved registers are read as zero.
+ */
+extern void vscp_test_active36(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read of 12 registers.
+ *
+ * Expectation:
+ *  - All 3 responses are sent in the same process cycle.
+ */
+extern void vscp_test_active37(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read, while the transport layer refuses all events.
+ *  - Transport layer accepts the events again before the timeout.
+ *  - Extended page read, while the transport layer refuses all events.
+ *  - Transport layer accepts the events again after the timeout.
+ *
+ * Expectation:
+ *  - After the short blocking, all responses are sent.
+ *  - After the timeout, the extended page read is aborted.
+ */
+extern void vscp_test_active38(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Who is there? (node addressed), while the transport layer refuses all events.
+ *  - Transport layer accepts the events again.
+ *
+ * Expectation:
+ *  - No response is lost, all responses are sent in order.
+ */
+extern void vscp_test_active39(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Boot loader algorithm is the VSCP boot loader algorithm.
+ *
+ * Action:
+ *  - Enter boot loader mode.
+ *  - Transfer block 0 and program it, while the transport layer refuses all events.
+ *  - Transfer the first part of block 1.
+ *  - Transport layer accepts the events again.
+ *  - Abort the firmware update.
+ *
+ * Expectation:
+ *  - Boot loader engine acknowledges with block size and number of blocks.
+ *  - Block data is acknowledged every VSCP_CONFIG_BOOT_CHUNK_ACK_WINDOW events.
+ *  - Block 1 is received, while block 0 is programmed. No response is lost.
+ *  - After the abort, the node is active again.
+ */
+extern void vscp_test_active40(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Boot loader algorithm is the VSCP boot loader algorithm.
+ *
+ * Action:
+ *  - Enter boot loader mode.
+ *  - Transfer block 1 and program it.
+ *  - Activate the new image with a wrong and with the right CRC.
+ *
+ * Expectation:
+ *  - Block data acknowledge contains the CRC-16 of the block.
+ *  - Block is written to the flash.
+ *  - New image is activated only with the right CRC and a reset is requested.
+ */
+extern void vscp_test_active41(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Application register write protection is disabled.
+ *
+ * Action:
+ *  - Start a bulk configuration write session for the decision matrix NG.
+ *  - Stream the block data events without waiting for a response.
+ *  - Commit the session with the right CRC.
+ *
+ * Expectation:
+ *  - Block data is acknowledged every VSCP_CONFIG_BULK_WRITE_ACK_WINDOW events.
+ *  - Block data acknowledge contains the CRC-16 of all register values.
+ *  - No register is written before the commit.
+ *  - A single program block data acknowledge is sent and all registers are written.
+ */
+extern void vscp_test_active42(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Start a bulk configuration write session, which overflows the page.
+ *  - Send block data without a session.
+ *  - Send block data with an unexpected sequence number twice.
+ *  - Commit the session with a wrong CRC and commit again.
+ *  - Commit a session, which contains read only registers.
+ *  - Commit a session, whose last registers don't accept the written values.
+ *
+ * Expectation:
+ *  - Session is not started.
+ *  - Block data without a session is ignored.
+ *  - Only a single block data NACK with the expected sequence number is sent.
+ *  - Commit is refused with the corresponding error and no register is written.
+ *  - Registers, which were written before the failed one, are restored.
+ */
+extern void vscp_test_active43(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Wait for several node heartbeats.
+ *  - Block the transport layer during one heartbeat.
+ *
+ * Expectation:
+ *  - The first heartbeat is sent within one period.
+ *  - The heartbeats are sent with the period +/- jitter.
+ *  - After the transmit error, the period is doubled once and afterwards
+ *    halved again.
+ */
+extern void vscp_test_active44(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Start the node segment initialization.
+ *  - Other nodes send events, while the node waits for the segment master.
+ *  - Another node sends an event, while the first nickname is probed, which
+ *    is acknowledged.
+ *
+ * Expectation:
+ *  - The nickname discovery probes only nicknames, which were not observed.
+ */
+extern void vscp_test_active45(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read across the begin of the decision matrix.
+ *  - Extended page read across the end of the decision matrix NG.
+ *
+ * Expectation:
+ *  - Decision matrix registers are read from the persistent memory,
+ *    application specific registers from the application.
+ */
+extern void vscp_test_active46(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled for the debug level.
+ *
+ * Action:
+ *  - Log a message, which needs 3 log events, and a message with a disabled level.
+ *  - Process the core.
+ *  - Log a message, while the transport layer refuses all events.
+ *
+ * Expectation:
+ *  - No log event is sent directly by the log function.
+ *  - Max. VSCP_CONFIG_LOGGER_EVENTS_PER_CYCLE log events are sent per process cycle with low priority.
+ *  - Refused log events are sent later.
+ */
+extern void vscp_test_logger01(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled for all levels.
+ *
+ * Action:
+ *  - Log more messages than the ring buffer can hold.
+ *  - Log more messages of one level than the rate limit allows.
+ *  - Log a message, which needs several log events, and overwrite it.
+ *  - Flush the log messages with and without refused log events.
+ *
+ * Expectation:
+ *  - The oldest log messages are dropped completely and counted.
+ *  - Messages above the rate limit of a level are dropped, other levels are not affected.
+ *  - Flush sends all log events or reports the refused ones.
+ */
+extern void vscp_test_logger02(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled for the debug level.
+ *
+ * Action:
+ *  - Log a trace record with four arguments.
+ *  - Log a trace record with a disabled level and one with too many arguments.
+ *
+ * Expectation:
+ *  - The trace record is sent with the trace log message id, the 16-bit
+ *    message id and the variable length encoded arguments.
+ *  - The other trace records are not sent.
+ */
+extern void vscp_test_logger03(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Process the core several times.
+ *  - Read a register and read the statistics of the register read probe via the
+ *    performance probe page.
+ *  - Write a register of the performance probe page.
+ *
+ * Expectation:
+ *  - Every process cycle is measured.
+ *  - The statistics are consistent and can be read via the register page.
+ *  - Writing to the register page resets the statistics of the probe.
+ */
+extern void vscp_test_perf01(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Process the core several times and determine the process cycles per second.
+ *  - Read a register.
+ *  - Read the frame counters via the statistics page, with and without taking
+ *    a snapshot.
+ *
+ * Expectation:
+ *  - Every process cycle, received and transmitted frame is counted.
+ *  - The registers return the values of the last snapshot, which is taken by
+ *    reading register 0.
+ */
+extern void vscp_test_stats01(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive an event, which was received by the transport adapter 5 ms ago.
+ *  - Receive an event, which was received by the transport adapter just now.
+ *
+ * Expectation:
+ *  - The receive latencies are counted in the corresponding histogram class.
+ *  - The max. receive latency is updated.
+ */
+extern void vscp_test_stats02(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive node heartbeats and who is there responses of other nodes.
+ *  - Iterate over the node table.
+ *  - Wait until a node expires.
+ *  - Receive a new node online event and remove a node.
+ *
+ * Expectation:
+ *  - Every node is tracked with last seen time, hard-coded flag, heartbeat
+ *    period and GUID.
+ *  - Nodes, which are not seen anymore, are removed.
+ */
+extern void vscp_test_nodeTable01(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive the first segment controller heartbeat.
+ *  - Receive a segment controller heartbeat 50 ms too early.
+ *  - Receive a segment controller heartbeat with a time jump.
+ *  - Receive segment controller heartbeats for 60 s, while the platform clock
+ *    is 400 ppm slow.
+ *
+ * Expectation:
+ *  - The first heartbeat sets the time.
+ *  - A small offset is slewed, the time never runs backwards.
+ *  - A time jump sets the time.
+ *  - The drift of the platform clock is estimated and compensated.
+ */
+extern void vscp_test_time01(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Receive a level 1 register read over level 2, addressed to this node.
+ *  - Receive a level 1 register read over level 2, addressed to another node.
+ *  - Receive a level 2 event with 300 data bytes.
+ *  - Receive a level 2 event with a level 1 class.
+ *  - Send a level 2 event with 400 and with too many data bytes.
+ *
+ * Expectation:
+ *  - The register read addressed to this node is answered.
+ *  - The level 2 events, which are not handled by the core, are provided to
+ *    the application.
+ *  - The level 2 event with a level 1 class is provided as level 1 event.
+ *  - The level 2 event is sent with the GUID of the node, too many data
+ *    bytes are refused.
+ */
+extern void vscp_test_l2_01(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Get embedded MDF, without embedded MDF.
+ *  - Get embedded MDF, with a compressed embedded MDF.
+ *  - Get embedded MDF, resumed at frame index 5.
+ *  - Get embedded MDF, resumed behind the last frame.
+ *
+ * Expectation:
+ *  - Without embedded MDF, a single response with index 0 and a zero is sent.
+ *  - The decoded MDF is sent with incrementing frame index, the last response
+ *    contains less than 6 byte.
+ *  - The resumed transfer starts at the requested frame.
+ *  - Behind the last frame, no response is sent.
+ */
+extern void vscp_test_mdf01(void);
+
+/**
+ * Precondition:
+ *  - Node is in active state.
+ *
+ * Action:
+ *  - Process the core with an empty decision matrix.
+ *  - Subscribe a class and enable a decision matrix row, which is covered by
+ *    the subscription.
+ *  - Calculate the filters with only two filters available.
+ *  - Add a rule to the decision matrix next generation.
+ *
+ * Expectation:
+ *  - The protocol class and the node heartbeat are programmed, other
+ *    events are rejected.
+ *  - The subscription adds a filter, the covered row adds none.
+ *  - The filters are merged, all necessary events still pass.
+ *  - A single filter, which passes every event, is calculated.
+ */
+extern void vscp_test_filter01(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Decode normalized integers with different sizes and signs.
+ *
+ * Expectation:
+ *  - Data value is sign extended and exponent is correct.
+ */
+extern void vscp_test_dataCoding01(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Decode normalized integers to floating point values.
+ *
+ * Expectation:
+ *  - Value is scaled by the exponent.
+ */
+extern void vscp_test_dataCoding02(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Decode several received measurement events at once.
+ *
+ * Expectation:
+ *  - Measurement events are decoded, all other events are marked as invalid.
+ */
+extern void vscp_test_dataCoding03(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode values in bit, byte, integer, string and floating point representation.
+ *  - Decode them again.
+ *
+ * Expectation:
+ *  - Only the necessary number of bytes is used and the decoded values are equal.
+ */
+extern void vscp_test_dataCoding04(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode values in the most compact representation.
+ *
+ * Expectation:
+ *  - The representation with the smallest size is used.
+ */
+extern void vscp_test_dataCoding05(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode integer and floating point values in the shortest normalized integer format.
+ *
+ * Expectation:
+ *  - Trailing decimal zeros are removed and the exponent is adjusted.
+ */
+extern void vscp_test_dataCoding06(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Parse information class button events with and without the optional code page.
+ *  - Parse a too short event and an event with a different type.
+ *
+ * Expectation:
+ *  - The parameters are decoded in big endian byte order.
+ *  - Invalid events are rejected.
+ */
+extern void vscp_test_evtParse01(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Parse measurement class events of different types, which share a common frame layout.
+ *
+ * Expectation:
+ *  - The common parser is selected and the value is decoded.
+ */
+extern void vscp_test_evtParse02(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -104,6 +104,93 @@ This transformation script generates the VSCP event modules.
         </xsl:analyze-string>
     </xsl:function>
 
+    <!-- Returns the frame reference, which is used by the most types of the VSCP class.
+         All these types share the same frame layout and are sent by one generic sender.
+         If no frame reference is used by more than one type, an empty string is returned. -->
+    <xsl:function name="local:getTableRef" as="xs:string">
+        <xsl:param name="vscpClass" />
+        <xsl:variable name="frameRefs" as="xs:string*">
+            <xsl:for-each-group select="$vscpClass/vscp-types/vscp-type[token]/frames-ref" group-by="string(.)">
+                <xsl:sort select="count(current-group())" order="descending" />
+                <xsl:if test="count(current-group()) &gt; 1">
+                    <xsl:sequence select="current-grouping-key()" />
+                </xsl:if>
+            </xsl:for-each-group>
+        </xsl:variable>
+        <xsl:sequence select="if (empty($frameRefs)) then '' else $frameRefs[1]" />
+    </xsl:function>
+
+    <!-- Returns whether the VSCP type is sent table driven by the generic sender of its class. -->
+    <xsl:function name="local:isTableDriven" as="xs:boolean">
+        <xsl:param name="vscpType" />
+        <xsl:variable name="tableRef" select="local:getTableRef($vscpType/../..)" />
+        <xsl:variable name="frameClassId" select="string(local:getVscpClassId($tableRef))" />
+        <xsl:variable name="frameTypeId" select="string(local:getVscpTypeId($tableRef))" />
+        <xsl:sequence select="($tableRef != '') and
+                              (count(root($vscpType)/specification/vscp-classes/vscp-class[@id = $frameClassId]/vscp-types/vscp-type[@id = $frameTypeId]/frames/frame) = 1) and
+                              ((string($vscpType/frames-ref) = $tableRef) or
+                               (concat('specification/vscp-classes/', $vscpType/../../@id, '/vscp-types/', $vscpType/@id, '/frames') = $tableRef))" />
+    </xsl:function>
+
+    <!-- Returns the argument list of a function parameter list, e.g. "uint8_t a, uint8_t const * const b" results in "a, b". -->
+    <xsl:function name="local:argumentList" as="xs:string">
+        <xsl:param name="parameter" />
+        <xsl:sequence select="string-join(for $p in tokenize($parameter, ',\s*') return replace($p, '^.*[ *](\w+)$', '$1'), ', ')" />
+    </xsl:function>
+
+    <!-- Returns the frame of the VSCP type. It may be the own frame or the referenced one.
+         If the type has no frame or more than one, nothing is returned. -->
+    <xsl:function name="local:getFrame" as="element()?">
+        <xsl:param name="vscpType" />
+        <xsl:choose>
+            <xsl:when test="count($vscpType/frames/frame) = 1">
+                <xsl:sequence select="$vscpType/frames/frame" />
+            </xsl:when>
+            <xsl:when test="empty($vscpType/frames) and $vscpType/frames-ref">
+                <xsl:variable name="frameClassId" select="string(local:getVscpClassId($vscpType/frames-ref))" />
+                <xsl:variable name="frameTypeId" select="string(local:getVscpTypeId($vscpType/frames-ref))" />
+                <xsl:variable name="frames" select="root($vscpType)/specification/vscp-classes/vscp-class[@id = $frameClassId]/vscp-types/vscp-type[@id = $frameTypeId]/frames/frame" />
+                <xsl:if test="count($frames) = 1">
+                    <xsl:sequence select="$frames" />
+                </xsl:if>
+            </xsl:when>
+        </xsl:choose>
+    </xsl:function>
+
+    <!-- Returns whether the event parameters of the VSCP type are coded by the data coding module. -->
+    <xsl:function name="local:isDataCoded" as="xs:boolean">
+        <xsl:param name="vscpType" />
+        <xsl:sequence select="(($vscpType/../../@id = 10) or ($vscpType/../../@id = 15) or ($vscpType/../../@id = 65)) and ($vscpType/@id &gt; 0)" />
+    </xsl:function>
+
+    <!-- Returns whether a parser is generated for the VSCP type. -->
+    <xsl:function name="local:hasParser" as="xs:boolean">
+        <xsl:param name="vscpType" />
+        <xsl:variable name="frame" select="local:getFrame($vscpType)" />
+        <xsl:sequence select="exists($frame) and (local:isDataCoded($vscpType) or exists($frame/elements/element))" />
+    </xsl:function>
+
+    <!-- Returns the type name of the VSCP type, e.g. "Alarm occurred" results in "AlarmOccurred". -->
+    <xsl:function name="local:getTypeName" as="xs:string">
+        <xsl:param name="vscpType" />
+        <xsl:sequence select="substring(local:hungarianForm(concat('x ', $vscpType/name[@lang='en'])), 2)" />
+    </xsl:function>
+
+    <!-- Returns the data size, which is at least necessary to parse the frame. Optional parameters are not considered. -->
+    <xsl:function name="local:getMinDataSize" as="xs:integer">
+        <xsl:param name="frame" />
+        <xsl:variable name="sizes" as="xs:integer*">
+            <xsl:for-each select="$frame/elements/element[not(@optional = 'true')]">
+                <xsl:variable name="type" select="@type" />
+                <xsl:variable name="typeDefinition" select="root(.)/specification/type-definitions/type-definition[name = $type]" />
+                <xsl:if test="$typeDefinition">
+                    <xsl:sequence select="xs:integer(@pos) + (if (@length &gt; 1) then 1 else xs:integer($typeDefinition/size))" />
+                </xsl:if>
+            </xsl:for-each>
+        </xsl:variable>
+        <xsl:sequence select="if (empty($sizes)) then 0 else max($sizes)" />
+    </xsl:function>
+
     <!--
     ****************************************************************************
         ROOT TEMPLATE
@@ -311,6 +398,11 @@ This transformation script generates the VSCP event modules.
             </xsl:call-template>
             <xsl:text>#include &lt;stdint.h&gt;&LF;</xsl:text>
             <xsl:text>#include "vscp_platform.h"&LF;</xsl:text>
+            <xsl:text>#include "vscp_types.h"&LF;</xsl:text>
+            <!-- The parsers of the measurement classes decode the data coding. -->
+            <xsl:if test="(@id = 10) or (@id = 15) or (@id = 65)">
+                <xsl:text>#include "vscp_data_coding.h"&LF;</xsl:text>
+            </xsl:if>
             <!-- Exception handling for special classes. -->
             <xsl:choose>
                 <xsl:when test="@id = 60">
@@ -325,6 +417,12 @@ This transformation script generates the VSCP event modules.
                 <xsl:otherwise>
                 </xsl:otherwise>
             </xsl:choose>
+            <!-- The inline wrappers of the table driven types need the VSCP types. -->
+            <xsl:if test="local:getTableRef(.) != ''">
+                <xsl:text>#include "vscp_type_</xsl:text>
+                <xsl:value-of select="$baseName" />
+                <xsl:text>.h"&LF;</xsl:text>
+            </xsl:if>
             <xsl:text>&LF;</xsl:text>
             
             <xsl:call-template name="ctools.externCBegin">
@@ -362,6 +460,11 @@ This transformation script generates the VSCP event modules.
                 </xsl:with-param>
             </xsl:call-template>
             <xsl:text>&LF;</xsl:text>
+            <xsl:call-template name="parseStructures">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+            </xsl:call-template>
 
             <!-- Global variables -->
             <xsl:call-template name="ctools.generalBlock">
@@ -378,11 +481,27 @@ This transformation script generates the VSCP event modules.
                 </xsl:with-param>
             </xsl:call-template>
             <xsl:text>&LF;</xsl:text>
+            <xsl:call-template name="genericFunction">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="mode">
+                    <xsl:text>h</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
             <xsl:apply-templates select="vscp-types/vscp-type[token]" mode="h">
                 <xsl:with-param name="baseName">
                     <xsl:value-of select="$baseName" />
                 </xsl:with-param>
             </xsl:apply-templates>
+            <xsl:call-template name="parseFunctions">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="mode">
+                    <xsl:text>h</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
 
             <xsl:call-template name="ctools.externCEnd">
             </xsl:call-template>
@@ -446,6 +565,7 @@ This transformation script generates the VSCP event modules.
             <xsl:text>#include "vscp_type_</xsl:text>
             <xsl:value-of select="$baseName" />
             <xsl:text>.h"&LF;</xsl:text>
+            <xsl:text>#include "vscp_util.h"&LF;</xsl:text>
             <!-- Exception handling for special classes. -->
             <xsl:choose>
                 <xsl:when test="@id = 10">
@@ -493,6 +613,11 @@ This transformation script generates the VSCP event modules.
                 </xsl:with-param>
             </xsl:call-template>
             <xsl:text>&LF;</xsl:text>
+            <xsl:call-template name="parseStructures">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+            </xsl:call-template>
 
             <!-- Global variables -->
             <xsl:call-template name="ctools.generalBlock">
@@ -509,11 +634,27 @@ This transformation script generates the VSCP event modules.
                 </xsl:with-param>
             </xsl:call-template>
             <xsl:text>&LF;</xsl:text>
+            <xsl:call-template name="genericFunction">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="mode">
+                    <xsl:text>c</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
             <xsl:apply-templates select="vscp-types/vscp-type[token]" mode="c">
                 <xsl:with-param name="baseName">
                     <xsl:value-of select="$baseName" />
                 </xsl:with-param>
             </xsl:apply-templates>
+            <xsl:call-template name="parseFunctions">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="mode">
+                    <xsl:text>c</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
 
             <!-- Footer -->
             <xsl:call-template name="ctools.cFooterBlock">
@@ -534,15 +675,32 @@ This transformation script generates the VSCP event modules.
         <xsl:param name="vscpTypeId" />
         <xsl:param name="vscpClassIdForParameters" />
         <xsl:param name="vscpTypeIdForParameters" />
+        <xsl:param name="compact" select="'false'" />
+        <xsl:param name="generic" select="'false'" />
 
-        <xsl:value-of select="/specification/vscp-classes/vscp-class[@id = $vscpClassId]/vscp-types/vscp-type[@id = $vscpTypeId]/name[@lang='en']" />
+        <xsl:choose>
+            <xsl:when test="$generic = 'true'">
+                <xsl:text>Generic sender for all types, which share the same frame layout.</xsl:text>
+            </xsl:when>
+            <xsl:otherwise>
+                <xsl:value-of select="/specification/vscp-classes/vscp-class[@id = $vscpClassId]/vscp-types/vscp-type[@id = $vscpTypeId]/name[@lang='en']" />
+            </xsl:otherwise>
+        </xsl:choose>
         <xsl:text>&LF;</xsl:text>
 
+        <xsl:if test="$compact = 'true'">
+            <xsl:text>&LF;</xsl:text>
+            <xsl:text>The data is sent in the most compact data coding representation.&LF;</xsl:text>
+        </xsl:if>
+
         <xsl:choose>
 
             <!-- Handle measurement class exceptional -->
             <xsl:when test="(../../@id = 10) and ($vscpTypeId &gt; 0)">
                 <xsl:text>&LF;</xsl:text>
+                <xsl:if test="$generic = 'true'">
+                    <xsl:text>@param[in] vscpType The VSCP type.&LF;</xsl:text>
+                </xsl:if>
                 <xsl:text>@param[in] index Index for sensor.&LF;</xsl:text>
                 <xsl:text>@param[in] unit The unit of the data.&LF;</xsl:text>
                 <xsl:text>@param[in] data The data as signed integer.&LF;</xsl:text>
@@ -552,6 +710,9 @@ This transformation script generates the VSCP event modules.
             <!-- Handle data class exceptional -->
             <xsl:when test="(../../@id = 15) and ($vscpTypeId &gt; 0)">
                 <xsl:text>&LF;</xsl:text>
+                <xsl:if test="$generic = 'true'">
+                    <xsl:text>@param[in] vscpType The VSCP type.&LF;</xsl:text>
+                </xsl:if>
                 <xsl:text>@param[in] index Index for sensor.&LF;</xsl:text>
                 <xsl:text>@param[in] unit The unit of the data.&LF;</xsl:text>
                 <xsl:text>@param[in] data The data as signed integer.&LF;</xsl:text>
@@ -561,6 +722,9 @@ This transformation script generates the VSCP event modules.
             <!-- Handle measurezone class exceptional -->
             <xsl:when test="(../../@id = 65) and ($vscpTypeId &gt; 0)">
                 <xsl:text>&LF;</xsl:text>
+                <xsl:if test="$generic = 'true'">
+                    <xsl:text>@param[in] vscpType The VSCP type.&LF;</xsl:text>
+                </xsl:if>
                 <xsl:text>@param[in] index Index for sensor.&LF;</xsl:text>
                 <xsl:text>@param[in] zone Zone for which event applies to (0-255). 255 is all zones.&LF;</xsl:text>
                 <xsl:text>@param[in] subZone Sub-zone for which event applies to (0-255). 255 is all sub-zones.&LF;</xsl:text>
@@ -572,6 +736,9 @@ This transformation script generates the VSCP event modules.
                 <!-- Any parameter? -->
                 <xsl:if test="/specification/vscp-classes/vscp-class[@id = $vscpClassIdForParameters]/vscp-types/vscp-type[@id = $vscpTypeIdForParameters]/frames/frame/elements/element">
                     <xsl:text>&LF;</xsl:text>
+                    <xsl:if test="$generic = 'true'">
+                        <xsl:text>@param[in] vscpType The VSCP type.&LF;</xsl:text>
+                    </xsl:if>
 
                     <!-- Generate comment per parameter -->
                     <xsl:for-each select="/specification/vscp-classes/vscp-class[@id = $vscpClassIdForParameters]/vscp-types/vscp-type[@id = $vscpTypeIdForParameters]/frames/frame/elements/element">
@@ -597,6 +764,11 @@ This transformation script generates the VSCP event modules.
                     </xsl:for-each>
                     <xsl:text>&LF;</xsl:text>
                 </xsl:if>
+                <!-- Generic sender without further parameters -->
+                <xsl:if test="($generic = 'true') and not(/specification/vscp-classes/vscp-class[@id = $vscpClassIdForParameters]/vscp-types/vscp-type[@id = $vscpTypeIdForParameters]/frames/frame/elements/element)">
+                    <xsl:text>&LF;</xsl:text>
+                    <xsl:text>@param[in] vscpType The VSCP type.&LF;</xsl:text>
+                </xsl:if>
             </xsl:otherwise>
 
         </xsl:choose>
@@ -670,9 +842,30 @@ This transformation script generates the VSCP event modules.
     <xsl:template name="funcBody">
         <xsl:param name="vscpClassId" />
         <xsl:param name="vscpTypeId" />
+        <xsl:param name="compact" select="'false'" />
+        <xsl:param name="typeToken" select="token" />
 
         <xsl:choose>
 
+            <!-- Measurement and data class with most compact data coding -->
+            <xsl:when test="$compact = 'true'">
+                <!-- Function variables -->
+                <xsl:text>&TAB;vscp_TxMessage&TAB;txMsg;&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+
+                <!-- Prepare tx message -->
+                <xsl:text>&TAB;vscp_core_prepareTxMessage(&amp;txMsg, </xsl:text>
+                <xsl:value-of select="../../token" />
+                <xsl:text>, </xsl:text>
+                <xsl:value-of select="$typeToken" />
+                <xsl:text>, VSCP_PRIORITY_3_NORMAL);&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+
+                <xsl:text>&TAB;txMsg.dataSize = vscp_data_coding_encodeCompact(data, exp, unit, index, &amp;txMsg.data[0], VSCP_L1_DATA_SIZE);&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>&TAB;return vscp_core_sendEvent(&amp;txMsg);&LF;</xsl:text>
+            </xsl:when>
+
             <!-- Handle measurement class exceptional -->
             <xsl:when test="(../../@id = 10) and ($vscpTypeId &gt; 0)">
                 <!-- Function variables -->
@@ -683,7 +876,7 @@ This transformation script generates the VSCP event modules.
                 <xsl:text>&TAB;vscp_core_prepareTxMessage(&amp;txMsg, </xsl:text>
                 <xsl:value-of select="../../token" />
                 <xsl:text>, </xsl:text>
-                <xsl:value-of select="token" />
+                <xsl:value-of select="$typeToken" />
                 <xsl:text>, VSCP_PRIORITY_3_NORMAL);&LF;</xsl:text>
                 <xsl:text>&LF;</xsl:text>
 
@@ -705,7 +898,7 @@ This transformation script generates the VSCP event modules.
                 <xsl:text>&TAB;vscp_core_prepareTxMessage(&amp;txMsg, </xsl:text>
                 <xsl:value-of select="../../token" />
                 <xsl:text>, </xsl:text>
-                <xsl:value-of select="token" />
+                <xsl:value-of select="$typeToken" />
                 <xsl:text>, VSCP_PRIORITY_3_NORMAL);&LF;</xsl:text>
                 <xsl:text>&LF;</xsl:text>
 
@@ -727,7 +920,7 @@ This transformation script generates the VSCP event modules.
                 <xsl:text>&TAB;vscp_core_prepareTxMessage(&amp;txMsg, </xsl:text>
                 <xsl:value-of select="../../token" />
                 <xsl:text>, </xsl:text>
-                <xsl:value-of select="token" />
+                <xsl:value-of select="$typeToken" />
                 <xsl:text>, VSCP_PRIORITY_3_NORMAL);&LF;</xsl:text>
                 <xsl:text>&LF;</xsl:text>
 
@@ -778,7 +971,7 @@ This transformation script generates the VSCP event modules.
                 <xsl:text>&TAB;vscp_core_prepareTxMessage(&amp;txMsg, </xsl:text>
                 <xsl:value-of select="../../token" />
                 <xsl:text>, </xsl:text>
-                <xsl:value-of select="token" />
+                <xsl:value-of select="$typeToken" />
                 <xsl:text>, VSCP_PRIORITY_3_NORMAL);&LF;</xsl:text>
                 <xsl:text>&LF;</xsl:text>
 
@@ -1071,6 +1264,21 @@ This transformation script generates the VSCP event modules.
         <xsl:param name="vscpTypeId" />
         <xsl:param name="vscpClassIdForParameters" />
         <xsl:param name="vscpTypeIdForParameters" />
+        <xsl:param name="compact" select="'false'" />
+        <xsl:param name="generic" select="'false'" />
+        <xsl:param name="wrapper" select="'false'" />
+
+        <!-- Function parameters -->
+        <xsl:variable name="parameter">
+            <xsl:call-template name="funcParameter">
+                <xsl:with-param name="vscpClassId">
+                    <xsl:value-of select="$vscpClassIdForParameters" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpTypeId">
+                    <xsl:value-of select="$vscpTypeIdForParameters" />
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:variable>
 
         <xsl:call-template name="ctools.function">
 
@@ -1089,12 +1297,25 @@ This transformation script generates the VSCP event modules.
                     <xsl:with-param name="vscpTypeIdForParameters">
                         <xsl:value-of select="$vscpTypeIdForParameters" />
                     </xsl:with-param>
+                    <xsl:with-param name="compact">
+                        <xsl:value-of select="$compact" />
+                    </xsl:with-param>
+                    <xsl:with-param name="generic">
+                        <xsl:value-of select="$generic" />
+                    </xsl:with-param>
                 </xsl:call-template>
             </xsl:with-param>
 
             <!-- Return type -->
             <xsl:with-param name="returnType">
-                <xsl:text>extern BOOL</xsl:text>
+                <xsl:choose>
+                    <xsl:when test="$wrapper = 'true'">
+                        <xsl:text>static inline BOOL</xsl:text>
+                    </xsl:when>
+                    <xsl:otherwise>
+                        <xsl:text>extern BOOL</xsl:text>
+                    </xsl:otherwise>
+                </xsl:choose>
             </xsl:with-param>
 
             <!-- Module name -->
@@ -1105,27 +1326,201 @@ This transformation script generates the VSCP event modules.
             
             <!-- Name -->
             <xsl:with-param name="name">
-                <xsl:text>send </xsl:text>
-                <xsl:value-of select="local:normalize(name[@lang='en'])" />
+                <xsl:call-template name="funcName">
+                    <xsl:with-param name="compact">
+                        <xsl:value-of select="$compact" />
+                    </xsl:with-param>
+                    <xsl:with-param name="generic">
+                        <xsl:value-of select="$generic" />
+                    </xsl:with-param>
+                </xsl:call-template>
             </xsl:with-param>
 
             <!-- Parameter -->
             <xsl:with-param name="parameter">
-                <xsl:call-template name="funcParameter">
-                    <xsl:with-param name="vscpClassId">
-                        <xsl:value-of select="$vscpClassIdForParameters" />
-                    </xsl:with-param>
-                    <xsl:with-param name="vscpTypeId">
-                        <xsl:value-of select="$vscpTypeIdForParameters" />
-                    </xsl:with-param>
-                </xsl:call-template>
+                <xsl:if test="$generic = 'true'">
+                    <xsl:text>uint8_t vscpType</xsl:text>
+                    <xsl:if test="$parameter != 'void'">
+                        <xsl:text>, </xsl:text>
+                    </xsl:if>
+                </xsl:if>
+                <xsl:if test="($generic = 'false') or ($parameter != 'void')">
+                    <xsl:value-of select="$parameter" />
+                </xsl:if>
             </xsl:with-param>
 
             <!-- Body -->
             <xsl:with-param name="body">
+                <!-- A wrapper calls the generic sender with its VSCP type. -->
+                <xsl:if test="$wrapper = 'true'">
+                    <xsl:text>&TAB;return vscp_evt_</xsl:text>
+                    <xsl:value-of select="$baseName" />
+                    <xsl:text>_</xsl:text>
+                    <xsl:call-template name="funcName">
+                        <xsl:with-param name="compact">
+                            <xsl:value-of select="$compact" />
+                        </xsl:with-param>
+                        <xsl:with-param name="generic">
+                            <xsl:text>true</xsl:text>
+                        </xsl:with-param>
+                    </xsl:call-template>
+                    <xsl:text>(</xsl:text>
+                    <xsl:value-of select="token" />
+                    <xsl:if test="$parameter != 'void'">
+                        <xsl:text>, </xsl:text>
+                        <xsl:value-of select="local:argumentList($parameter)" />
+                    </xsl:if>
+                    <xsl:text>);&LF;</xsl:text>
+                </xsl:if>
             </xsl:with-param>
 
         </xsl:call-template>
+
+        <!-- Measurement and data class events are additionally available with the most compact data coding. -->
+        <xsl:if test="($compact = 'false') and ((../../@id = 10) or (../../@id = 15)) and ($vscpTypeId &gt; 0)">
+            <xsl:text>&LF;</xsl:text>
+            <xsl:call-template name="funcDeclaration">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpClassId">
+                    <xsl:value-of select="$vscpClassId" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpTypeId">
+                    <xsl:value-of select="$vscpTypeId" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpClassIdForParameters">
+                    <xsl:value-of select="$vscpClassIdForParameters" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpTypeIdForParameters">
+                    <xsl:value-of select="$vscpTypeIdForParameters" />
+                </xsl:with-param>
+                <xsl:with-param name="compact">
+                    <xsl:text>true</xsl:text>
+                </xsl:with-param>
+                <xsl:with-param name="generic">
+                    <xsl:value-of select="$generic" />
+                </xsl:with-param>
+                <xsl:with-param name="wrapper">
+                    <xsl:value-of select="$wrapper" />
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:if>
+    </xsl:template>
+
+    <!-- Function name -->
+    <xsl:template name="funcName">
+        <xsl:param name="compact" select="'false'" />
+        <xsl:param name="generic" select="'false'" />
+
+        <xsl:text>send </xsl:text>
+        <xsl:choose>
+            <xsl:when test="$generic = 'true'">
+                <xsl:text>by type</xsl:text>
+            </xsl:when>
+            <xsl:otherwise>
+                <xsl:value-of select="local:normalize(name[@lang='en'])" />
+            </xsl:otherwise>
+        </xsl:choose>
+        <xsl:if test="$compact = 'true'">
+            <xsl:text> compact</xsl:text>
+        </xsl:if>
+    </xsl:template>
+
+    <!-- Output generic sender of all table driven types, in the context of the VSCP class. -->
+    <xsl:template name="genericFunction">
+        <xsl:param name="baseName" />
+        <xsl:param name="mode" />
+
+        <xsl:variable name="tableRef">
+            <xsl:value-of select="local:getTableRef(.)" />
+        </xsl:variable>
+
+        <xsl:for-each select="(vscp-types/vscp-type[token][local:isTableDriven(.)])[1]">
+            <xsl:choose>
+                <xsl:when test="$mode = 'h'">
+                    <xsl:call-template name="funcDeclaration">
+                        <xsl:with-param name="baseName">
+                            <xsl:value-of select="$baseName" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpClassId">
+                            <xsl:value-of select="../../@id" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpTypeId">
+                            <xsl:value-of select="@id" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpClassIdForParameters">
+                            <xsl:value-of select="local:getVscpClassId($tableRef)" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpTypeIdForParameters">
+                            <xsl:value-of select="local:getVscpTypeId($tableRef)" />
+                        </xsl:with-param>
+                        <xsl:with-param name="generic">
+                            <xsl:text>true</xsl:text>
+                        </xsl:with-param>
+                    </xsl:call-template>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:call-template name="funcDefinition">
+                        <xsl:with-param name="baseName">
+                            <xsl:value-of select="$baseName" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpClassId">
+                            <xsl:value-of select="../../@id" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpTypeId">
+                            <xsl:value-of select="@id" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpClassIdForParameters">
+                            <xsl:value-of select="local:getVscpClassId($tableRef)" />
+                        </xsl:with-param>
+                        <xsl:with-param name="vscpTypeIdForParameters">
+                            <xsl:value-of select="local:getVscpTypeId($tableRef)" />
+                        </xsl:with-param>
+                        <xsl:with-param name="generic">
+                            <xsl:text>true</xsl:text>
+                        </xsl:with-param>
+                    </xsl:call-template>
+                </xsl:otherwise>
+            </xsl:choose>
+            <xsl:text>&LF;</xsl:text>
+        </xsl:for-each>
+    </xsl:template>
+
+    <!-- Table driven types are declared as inline wrapper of the generic sender. -->
+    <xsl:template match="vscp-type[local:isTableDriven(.)]" mode="h" priority="2">
+        <xsl:param name="baseName" />
+
+        <xsl:variable name="tableRef">
+            <xsl:value-of select="local:getTableRef(../..)" />
+        </xsl:variable>
+
+        <xsl:call-template name="funcDeclaration">
+            <xsl:with-param name="baseName">
+                <xsl:value-of select="$baseName" />
+            </xsl:with-param>
+            <xsl:with-param name="vscpClassId">
+                <xsl:value-of select="../../@id" />
+            </xsl:with-param>
+            <xsl:with-param name="vscpTypeId">
+                <xsl:value-of select="@id" />
+            </xsl:with-param>
+            <xsl:with-param name="vscpClassIdForParameters">
+                <xsl:value-of select="local:getVscpClassId($tableRef)" />
+            </xsl:with-param>
+            <xsl:with-param name="vscpTypeIdForParameters">
+                <xsl:value-of select="local:getVscpTypeId($tableRef)" />
+            </xsl:with-param>
+            <xsl:with-param name="wrapper">
+                <xsl:text>true</xsl:text>
+            </xsl:with-param>
+        </xsl:call-template>
+
+        <xsl:text>&LF;</xsl:text>
+    </xsl:template>
+
+    <!-- Table driven types are sent by the generic sender, therefore no function definition. -->
+    <xsl:template match="vscp-type[local:isTableDriven(.)]" mode="c" priority="2">
     </xsl:template>
 
     <!-- Create function prototype for vscp-type  -->
@@ -1226,6 +1621,20 @@ This transformation script generates the VSCP event modules.
         <xsl:param name="vscpTypeId" />
         <xsl:param name="vscpClassIdForParameters" />
         <xsl:param name="vscpTypeIdForParameters" />
+        <xsl:param name="compact" select="'false'" />
+        <xsl:param name="generic" select="'false'" />
+
+        <!-- Function parameters -->
+        <xsl:variable name="parameter">
+            <xsl:call-template name="funcParameter">
+                <xsl:with-param name="vscpClassId">
+                    <xsl:value-of select="$vscpClassIdForParameters" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpTypeId">
+                    <xsl:value-of select="$vscpTypeIdForParameters" />
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:variable>
 
         <xsl:call-template name="ctools.function">
             
@@ -1244,12 +1653,25 @@ This transformation script generates the VSCP event modules.
                     <xsl:with-param name="vscpTypeIdForParameters">
                         <xsl:value-of select="$vscpTypeIdForParameters" />
                     </xsl:with-param>
+                    <xsl:with-param name="compact">
+                        <xsl:value-of select="$compact" />
+                    </xsl:with-param>
+                    <xsl:with-param name="generic">
+                        <xsl:value-of select="$generic" />
+                    </xsl:with-param>
                 </xsl:call-template>
             </xsl:with-param>
 
             <!-- Return type -->
             <xsl:with-param name="returnType">
-                <xsl:text>extern BOOL</xsl:text>
+                <xsl:choose>
+                    <xsl:when test="$wrapper = 'true'">
+                        <xsl:text>static inline BOOL</xsl:text>
+                    </xsl:when>
+                    <xsl:otherwise>
+                        <xsl:text>extern BOOL</xsl:text>
+                    </xsl:otherwise>
+                </xsl:choose>
             </xsl:with-param>
 
             <!-- Module name -->
@@ -1260,20 +1682,27 @@ This transformation script generates the VSCP event modules.
             
             <!-- Name -->
             <xsl:with-param name="name">
-                <xsl:text>send </xsl:text>
-                <xsl:value-of select="local:normalize(name[@lang='en'])" />
+                <xsl:call-template name="funcName">
+                    <xsl:with-param name="compact">
+                        <xsl:value-of select="$compact" />
+                    </xsl:with-param>
+                    <xsl:with-param name="generic">
+                        <xsl:value-of select="$generic" />
+                    </xsl:with-param>
+                </xsl:call-template>
             </xsl:with-param>
 
             <!-- Parameter -->
             <xsl:with-param name="parameter">
-                <xsl:call-template name="funcParameter">
-                    <xsl:with-param name="vscpClassId">
-                        <xsl:value-of select="$vscpClassIdForParameters" />
-                    </xsl:with-param>
-                    <xsl:with-param name="vscpTypeId">
-                        <xsl:value-of select="$vscpTypeIdForParameters" />
-                    </xsl:with-param>
-                </xsl:call-template>
+                <xsl:if test="$generic = 'true'">
+                    <xsl:text>uint8_t vscpType</xsl:text>
+                    <xsl:if test="$parameter != 'void'">
+                        <xsl:text>, </xsl:text>
+                    </xsl:if>
+                </xsl:if>
+                <xsl:if test="($generic = 'false') or ($parameter != 'void')">
+                    <xsl:value-of select="$parameter" />
+                </xsl:if>
             </xsl:with-param>
 
             <!-- Body -->
@@ -1285,10 +1714,51 @@ This transformation script generates the VSCP event modules.
                     <xsl:with-param name="vscpTypeId">
                         <xsl:value-of select="$vscpTypeIdForParameters" />
                     </xsl:with-param>
+                    <xsl:with-param name="compact">
+                        <xsl:value-of select="$compact" />
+                    </xsl:with-param>
+                    <xsl:with-param name="typeToken">
+                        <xsl:choose>
+                            <xsl:when test="$generic = 'true'">
+                                <xsl:text>vscpType</xsl:text>
+                            </xsl:when>
+                            <xsl:otherwise>
+                                <xsl:value-of select="token" />
+                            </xsl:otherwise>
+                        </xsl:choose>
+                    </xsl:with-param>
                 </xsl:call-template>
             </xsl:with-param>
 
         </xsl:call-template>
+
+        <!-- Measurement and data class events are additionally available with the most compact data coding. -->
+        <xsl:if test="($compact = 'false') and ((../../@id = 10) or (../../@id = 15)) and ($vscpTypeId &gt; 0)">
+            <xsl:text>&LF;</xsl:text>
+            <xsl:call-template name="funcDefinition">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpClassId">
+                    <xsl:value-of select="$vscpClassId" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpTypeId">
+                    <xsl:value-of select="$vscpTypeId" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpClassIdForParameters">
+                    <xsl:value-of select="$vscpClassIdForParameters" />
+                </xsl:with-param>
+                <xsl:with-param name="vscpTypeIdForParameters">
+                    <xsl:value-of select="$vscpTypeIdForParameters" />
+                </xsl:with-param>
+                <xsl:with-param name="compact">
+                    <xsl:text>true</xsl:text>
+                </xsl:with-param>
+                <xsl:with-param name="generic">
+                    <xsl:value-of select="$generic" />
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:if>
     </xsl:template>
 
     <!-- Create function for vscp-type  -->
@@ -1382,6 +1852,646 @@ This transformation script generates the VSCP event modules.
         <xsl:text>&LF;</xsl:text>
     </xsl:template>
 
+    <!--
+    ****************************************************************************
+        PARSER TEMPLATES
+    ****************************************************************************
+    -->
+
+    <!-- Output the parameter structures of all parsed types and the event structure, in the context of the VSCP class. -->
+    <xsl:template name="parseStructures">
+        <xsl:param name="baseName" />
+
+        <xsl:variable name="moduleName">
+            <xsl:text>vscp_evt_</xsl:text>
+            <xsl:value-of select="$baseName" />
+        </xsl:variable>
+
+        <!-- All table driven types share one parameter structure. -->
+        <xsl:for-each select="(vscp-types/vscp-type[token][local:isTableDriven(.)][local:hasParser(.)])[1]">
+            <xsl:call-template name="parseStructure">
+                <xsl:with-param name="moduleName">
+                    <xsl:value-of select="$moduleName" />
+                </xsl:with-param>
+                <xsl:with-param name="typeName">
+                    <xsl:text>Common</xsl:text>
+                </xsl:with-param>
+                <xsl:with-param name="comment">
+                    <xsl:text>Parameters of all types, which share the same frame layout.</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:for-each>
+
+        <xsl:for-each select="vscp-types/vscp-type[token][not(local:isTableDriven(.))][local:hasParser(.)]">
+            <xsl:call-template name="parseStructure">
+                <xsl:with-param name="moduleName">
+                    <xsl:value-of select="$moduleName" />
+                </xsl:with-param>
+                <xsl:with-param name="typeName">
+                    <xsl:value-of select="local:getTypeName(.)" />
+                </xsl:with-param>
+                <xsl:with-param name="comment">
+                    <xsl:text>Parameters of the "</xsl:text>
+                    <xsl:value-of select="name[@lang='en']" />
+                    <xsl:text>" event.</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:for-each>
+
+        <!-- Event structure -->
+        <xsl:text>/** Parsed event of the "</xsl:text>
+        <xsl:value-of select="name[@lang='en']" />
+        <xsl:text>" class. */&LF;</xsl:text>
+        <xsl:text>typedef struct&LF;</xsl:text>
+        <xsl:text>{&LF;</xsl:text>
+        <xsl:text>&TAB;uint8_t vscpType; /**&lt; VSCP type */&LF;</xsl:text>
+        <xsl:if test="vscp-types/vscp-type[token][local:hasParser(.)]">
+            <xsl:text>&LF;</xsl:text>
+            <xsl:text>&TAB;/** Event parameters, which depend on the VSCP type. */&LF;</xsl:text>
+            <xsl:text>&TAB;union&LF;</xsl:text>
+            <xsl:text>&TAB;{&LF;</xsl:text>
+            <xsl:if test="vscp-types/vscp-type[token][local:isTableDriven(.)][local:hasParser(.)]">
+                <xsl:text>&TAB;&TAB;</xsl:text>
+                <xsl:value-of select="$moduleName" />
+                <xsl:text>_Common common; /**&lt; Parameters of all types, which share the same frame layout */&LF;</xsl:text>
+            </xsl:if>
+            <xsl:for-each select="vscp-types/vscp-type[token][not(local:isTableDriven(.))][local:hasParser(.)]">
+                <xsl:variable name="typeName" select="local:getTypeName(.)" />
+                <xsl:text>&TAB;&TAB;</xsl:text>
+                <xsl:value-of select="$moduleName" />
+                <xsl:text>_</xsl:text>
+                <xsl:value-of select="$typeName" />
+                <xsl:text> </xsl:text>
+                <xsl:value-of select="concat(lower-case(substring($typeName, 1, 1)), substring($typeName, 2))" />
+                <xsl:text>; /**&lt; Parameters of the "</xsl:text>
+                <xsl:value-of select="name[@lang='en']" />
+                <xsl:text>" event */&LF;</xsl:text>
+            </xsl:for-each>
+            <xsl:text>&TAB;} data;&LF;</xsl:text>
+        </xsl:if>
+        <xsl:text>&LF;</xsl:text>
+        <xsl:text>} </xsl:text>
+        <xsl:value-of select="$moduleName" />
+        <xsl:text>_Event;&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+    </xsl:template>
+
+    <!-- Output the parameter structure of a VSCP type. -->
+    <xsl:template name="parseStructure">
+        <xsl:param name="moduleName" />
+        <xsl:param name="typeName" />
+        <xsl:param name="comment" />
+
+        <xsl:text>/** </xsl:text>
+        <xsl:value-of select="$comment" />
+        <xsl:text> */&LF;</xsl:text>
+
+        <xsl:choose>
+
+            <!-- Handle measurement and data class exceptional -->
+            <xsl:when test="((../../@id = 10) or (../../@id = 15)) and (@id &gt; 0)">
+                <xsl:text>typedef vscp_data_coding_Value </xsl:text>
+                <xsl:value-of select="$moduleName" />
+                <xsl:text>_</xsl:text>
+                <xsl:value-of select="$typeName" />
+                <xsl:text>;&LF;</xsl:text>
+            </xsl:when>
+
+            <xsl:otherwise>
+                <xsl:text>typedef struct&LF;</xsl:text>
+                <xsl:text>{&LF;</xsl:text>
+
+                <xsl:choose>
+                    <!-- Handle measurezone class exceptional -->
+                    <xsl:when test="(../../@id = 65) and (@id &gt; 0)">
+                        <xsl:text>&TAB;uint8_t index; /**&lt; Index for sensor */&LF;</xsl:text>
+                        <xsl:text>&TAB;uint8_t zone; /**&lt; Zone */&LF;</xsl:text>
+                        <xsl:text>&TAB;uint8_t subZone; /**&lt; Sub-zone */&LF;</xsl:text>
+                        <xsl:text>&TAB;vscp_data_coding_Value value; /**&lt; Value */&LF;</xsl:text>
+                    </xsl:when>
+
+                    <xsl:otherwise>
+                        <!-- Generate member per parameter -->
+                        <xsl:for-each select="local:getFrame(.)/elements/element">
+                            <xsl:text>&TAB;</xsl:text>
+                            <xsl:value-of select="@type" />
+                            <xsl:text>_t </xsl:text>
+                            <xsl:value-of select="local:hungarianForm(name[@lang='en'])" />
+                            <xsl:if test="@length &gt; 1">
+                                <xsl:text>[</xsl:text>
+                                <xsl:value-of select="@length" />
+                                <xsl:text>]</xsl:text>
+                            </xsl:if>
+                            <xsl:text>; /**&lt; </xsl:text>
+                            <xsl:value-of select="name[@lang='en']" />
+                            <xsl:text> */&LF;</xsl:text>
+
+                            <xsl:choose>
+                                <!-- Arrays contain only the received bytes. -->
+                                <xsl:when test="@length &gt; 1">
+                                    <xsl:text>&TAB;uint8_t </xsl:text>
+                                    <xsl:value-of select="local:hungarianForm(concat(name[@lang='en'], ' size'))" />
+                                    <xsl:text>; /**&lt; </xsl:text>
+                                    <xsl:value-of select="name[@lang='en']" />
+                                    <xsl:text> size */&LF;</xsl:text>
+                                </xsl:when>
+                                <!-- Optional parameters may be missing. -->
+                                <xsl:when test="@optional = 'true'">
+                                    <xsl:text>&TAB;BOOL </xsl:text>
+                                    <xsl:value-of select="local:hungarianForm(concat(name[@lang='en'], ' available'))" />
+                                    <xsl:text>; /**&lt; </xsl:text>
+                                    <xsl:value-of select="name[@lang='en']" />
+                                    <xsl:text> available */&LF;</xsl:text>
+                                </xsl:when>
+                            </xsl:choose>
+                        </xsl:for-each>
+                    </xsl:otherwise>
+                </xsl:choose>
+
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>} </xsl:text>
+                <xsl:value-of select="$moduleName" />
+                <xsl:text>_</xsl:text>
+                <xsl:value-of select="$typeName" />
+                <xsl:text>;&LF;</xsl:text>
+            </xsl:otherwise>
+
+        </xsl:choose>
+
+        <xsl:text>&LF;</xsl:text>
+    </xsl:template>
+
+    <!-- Output all parser functions and the parser of the whole class, in the context of the VSCP class. -->
+    <xsl:template name="parseFunctions">
+        <xsl:param name="baseName" />
+        <xsl:param name="mode" />
+
+        <!-- All table driven types share one parser. -->
+        <xsl:for-each select="(vscp-types/vscp-type[token][local:isTableDriven(.)][local:hasParser(.)])[1]">
+            <xsl:call-template name="parseFunction">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="mode">
+                    <xsl:value-of select="$mode" />
+                </xsl:with-param>
+                <xsl:with-param name="generic">
+                    <xsl:text>true</xsl:text>
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:for-each>
+
+        <xsl:for-each select="vscp-types/vscp-type[token][not(local:isTableDriven(.))][local:hasParser(.)]">
+            <xsl:call-template name="parseFunction">
+                <xsl:with-param name="baseName">
+                    <xsl:value-of select="$baseName" />
+                </xsl:with-param>
+                <xsl:with-param name="mode">
+                    <xsl:value-of select="$mode" />
+                </xsl:with-param>
+            </xsl:call-template>
+        </xsl:for-each>
+
+        <xsl:call-template name="ctools.function">
+
+            <!-- Comment -->
+            <xsl:with-param name="comment">
+                <xsl:text>Parse a received event of the "</xsl:text>
+                <xsl:value-of select="name[@lang='en']" />
+                <xsl:text>" class.&LF;</xsl:text>
+                <xsl:text>The parser is selected by the VSCP type. Events without parameters are accepted as they are.&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>@param[in] msg Received message.&LF;</xsl:text>
+                <xsl:text>@param[out] evt Parsed event.&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>@return If the event is valid and supported, it will return TRUE otherwise FALSE.</xsl:text>
+            </xsl:with-param>
+
+            <!-- Return type -->
+            <xsl:with-param name="returnType">
+                <xsl:text>extern BOOL</xsl:text>
+            </xsl:with-param>
+
+            <!-- Module name -->
+            <xsl:with-param name="moduleName">
+                <xsl:text>vscp_evt_</xsl:text>
+                <xsl:value-of select="$baseName" />
+            </xsl:with-param>
+
+            <!-- Name -->
+            <xsl:with-param name="name">
+                <xsl:text>parse</xsl:text>
+            </xsl:with-param>
+
+            <!-- Parameter -->
+            <xsl:with-param name="parameter">
+                <xsl:text>vscp_RxMessage const * const msg, vscp_evt_</xsl:text>
+                <xsl:value-of select="$baseName" />
+                <xsl:text>_Event * const evt</xsl:text>
+            </xsl:with-param>
+
+            <!-- Body -->
+            <xsl:with-param name="body">
+                <xsl:if test="$mode = 'c'">
+                    <xsl:call-template name="parseDispatcherBody">
+                        <xsl:with-param name="baseName">
+                            <xsl:value-of select="$baseName" />
+                        </xsl:with-param>
+                    </xsl:call-template>
+                </xsl:if>
+            </xsl:with-param>
+
+        </xsl:call-template>
+
+        <xsl:text>&LF;</xsl:text>
+    </xsl:template>
+
+    <!-- Output parser function of a VSCP type. -->
+    <xsl:template name="parseFunction">
+        <xsl:param name="baseName" />
+        <xsl:param name="mode" />
+        <xsl:param name="generic" select="'false'" />
+
+        <xsl:call-template name="ctools.function">
+
+            <!-- Comment -->
+            <xsl:with-param name="comment">
+                <xsl:choose>
+                    <xsl:when test="$generic = 'true'">
+                        <xsl:text>Parse all types, which share the same frame layout. The VSCP type is not checked.&LF;</xsl:text>
+                    </xsl:when>
+                    <xsl:otherwise>
+                        <xsl:text>Parse the "</xsl:text>
+                        <xsl:value-of select="name[@lang='en']" />
+                        <xsl:text>" event.&LF;</xsl:text>
+                    </xsl:otherwise>
+                </xsl:choose>
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>@param[in] msg Received message.&LF;</xsl:text>
+                <xsl:text>@param[out] evt Event parameters.&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+                <xsl:choose>
+                    <xsl:when test="$generic = 'true'">
+                        <xsl:text>@return If the message contains valid event parameters, it will return TRUE otherwise FALSE.</xsl:text>
+                    </xsl:when>
+                    <xsl:otherwise>
+                        <xsl:text>@return If the message is a valid "</xsl:text>
+                        <xsl:value-of select="name[@lang='en']" />
+                        <xsl:text>" event, it will return TRUE otherwise FALSE.</xsl:text>
+                    </xsl:otherwise>
+                </xsl:choose>
+            </xsl:with-param>
+
+            <!-- Return type -->
+            <xsl:with-param name="returnType">
+                <xsl:text>extern BOOL</xsl:text>
+            </xsl:with-param>
+
+            <!-- Module name -->
+            <xsl:with-param name="moduleName">
+                <xsl:text>vscp_evt_</xsl:text>
+                <xsl:value-of select="$baseName" />
+            </xsl:with-param>
+
+            <!-- Name -->
+            <xsl:with-param name="name">
+                <xsl:text>parse </xsl:text>
+                <xsl:choose>
+                    <xsl:when test="$generic = 'true'">
+                        <xsl:text>common</xsl:text>
+                    </xsl:when>
+                    <xsl:otherwise>
+                        <xsl:value-of select="local:normalize(name[@lang='en'])" />
+                    </xsl:otherwise>
+                </xsl:choose>
+            </xsl:with-param>
+
+            <!-- Parameter -->
+            <xsl:with-param name="parameter">
+                <xsl:text>vscp_RxMessage const * const msg, vscp_evt_</xsl:text>
+                <xsl:value-of select="$baseName" />
+                <xsl:text>_</xsl:text>
+                <xsl:choose>
+                    <xsl:when test="$generic = 'true'">
+                        <xsl:text>Common</xsl:text>
+                    </xsl:when>
+                    <xsl:otherwise>
+                        <xsl:value-of select="local:getTypeName(.)" />
+                    </xsl:otherwise>
+                </xsl:choose>
+                <xsl:text> * const evt</xsl:text>
+            </xsl:with-param>
+
+            <!-- Body -->
+            <xsl:with-param name="body">
+                <xsl:if test="$mode = 'c'">
+                    <xsl:call-template name="parseBody">
+                        <xsl:with-param name="generic">
+                            <xsl:value-of select="$generic" />
+                        </xsl:with-param>
+                    </xsl:call-template>
+                </xsl:if>
+            </xsl:with-param>
+
+        </xsl:call-template>
+
+        <xsl:text>&LF;</xsl:text>
+    </xsl:template>
+
+    <!-- Parser function body -->
+    <xsl:template name="parseBody">
+        <xsl:param name="generic" select="'false'" />
+
+        <xsl:variable name="frame" select="local:getFrame(.)" />
+
+        <!-- Data size, which is at least necessary. -->
+        <xsl:variable name="minDataSize">
+            <xsl:choose>
+                <xsl:when test="((../../@id = 10) or (../../@id = 15)) and (@id &gt; 0)">
+                    <xsl:text>0</xsl:text>
+                </xsl:when>
+                <xsl:when test="(../../@id = 65) and (@id &gt; 0)">
+                    <xsl:text>4</xsl:text>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:value-of select="local:getMinDataSize($frame)" />
+                </xsl:otherwise>
+            </xsl:choose>
+        </xsl:variable>
+
+        <!-- Conditions, which reject the message. -->
+        <xsl:variable name="conditions" as="xs:string*">
+            <xsl:sequence select="concat(../../token, ' != msg-&gt;vscpClass')" />
+            <xsl:if test="$generic = 'false'">
+                <xsl:sequence select="concat(token, ' != msg-&gt;vscpType')" />
+            </xsl:if>
+            <xsl:if test="$minDataSize &gt; 0">
+                <xsl:sequence select="concat($minDataSize, ' &gt; msg-&gt;dataSize')" />
+            </xsl:if>
+        </xsl:variable>
+
+        <!-- Function variables -->
+        <xsl:if test="not(local:isDataCoded(.)) and $frame/elements/element[@length &gt; 1]">
+            <xsl:text>&TAB;uint8_t&TAB;byteIndex&TAB;= 0;&LF;</xsl:text>
+            <xsl:text>&LF;</xsl:text>
+        </xsl:if>
+
+        <!-- Pointer checks -->
+        <xsl:text>&TAB;if ((NULL == msg) || (NULL == evt))&LF;</xsl:text>
+        <xsl:text>&TAB;{&LF;</xsl:text>
+        <xsl:text>&TAB;&TAB;return FALSE;&LF;</xsl:text>
+        <xsl:text>&TAB;}&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+
+        <!-- Message checks -->
+        <xsl:text>&TAB;if (</xsl:text>
+        <xsl:choose>
+            <xsl:when test="count($conditions) = 1">
+                <xsl:value-of select="$conditions" />
+            </xsl:when>
+            <xsl:otherwise>
+                <xsl:value-of select="string-join(for $condition in $conditions return concat('(', $condition, ')'), ' || ')" />
+            </xsl:otherwise>
+        </xsl:choose>
+        <xsl:text>)&LF;</xsl:text>
+        <xsl:text>&TAB;{&LF;</xsl:text>
+        <xsl:text>&TAB;&TAB;return FALSE;&LF;</xsl:text>
+        <xsl:text>&TAB;}&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+
+        <xsl:choose>
+
+            <!-- Handle measurement and data class exceptional -->
+            <xsl:when test="((../../@id = 10) or (../../@id = 15)) and (@id &gt; 0)">
+                <xsl:text>&TAB;return vscp_data_coding_decode(&amp;msg-&gt;data[0], msg-&gt;dataSize, evt);&LF;</xsl:text>
+            </xsl:when>
+
+            <!-- Handle measurezone class exceptional -->
+            <xsl:when test="(../../@id = 65) and (@id &gt; 0)">
+                <xsl:text>&TAB;evt-&gt;index = msg-&gt;data[0];&LF;</xsl:text>
+                <xsl:text>&TAB;evt-&gt;zone = msg-&gt;data[1];&LF;</xsl:text>
+                <xsl:text>&TAB;evt-&gt;subZone = msg-&gt;data[2];&LF;</xsl:text>
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>&TAB;return vscp_data_coding_decode(&amp;msg-&gt;data[3], msg-&gt;dataSize - 3, &amp;evt-&gt;value);&LF;</xsl:text>
+            </xsl:when>
+
+            <xsl:otherwise>
+                <!-- Handle each parameter -->
+                <xsl:for-each select="$frame/elements/element">
+
+                    <!-- Every parameter section is separated with a empty line. -->
+                    <xsl:if test="position() &gt; 1">
+                        <xsl:text>&LF;</xsl:text>
+                    </xsl:if>
+
+                    <xsl:choose>
+                        <!-- Array, which contains only the received bytes. -->
+                        <xsl:when test="@length &gt; 1">
+                            <xsl:text>&TAB;for(byteIndex = 0; (byteIndex &lt; </xsl:text>
+                            <xsl:value-of select="@length" />
+                            <xsl:text>) &amp;&amp; ((</xsl:text>
+                            <xsl:value-of select="@pos + 0" />
+                            <xsl:text> + byteIndex) &lt; msg-&gt;dataSize); ++byteIndex)&LF;</xsl:text>
+                            <xsl:text>&TAB;{&LF;</xsl:text>
+                            <xsl:text>&TAB;&TAB;evt-&gt;</xsl:text>
+                            <xsl:value-of select="local:hungarianForm(name[@lang='en'])" />
+                            <xsl:text>[byteIndex] = msg-&gt;data[</xsl:text>
+                            <xsl:value-of select="@pos + 0" />
+                            <xsl:text> + byteIndex];&LF;</xsl:text>
+                            <xsl:text>&TAB;}&LF;</xsl:text>
+                            <xsl:text>&TAB;evt-&gt;</xsl:text>
+                            <xsl:value-of select="local:hungarianForm(concat(name[@lang='en'], ' size'))" />
+                            <xsl:text> = byteIndex;&LF;</xsl:text>
+                        </xsl:when>
+
+                        <!-- Optional parameter -->
+                        <xsl:when test="@optional = 'true'">
+                            <xsl:variable name="type" select="@type" />
+                            <xsl:variable name="availableName" select="local:hungarianForm(concat(name[@lang='en'], ' available'))" />
+
+                            <xsl:text>&TAB;evt-&gt;</xsl:text>
+                            <xsl:value-of select="$availableName" />
+                            <xsl:text> = FALSE;&LF;</xsl:text>
+                            <xsl:text>&TAB;if (</xsl:text>
+                            <xsl:value-of select="@pos + (/specification/type-definitions/type-definition[name = $type]/size, 1)[1]" />
+                            <xsl:text> &lt;= msg-&gt;dataSize)&LF;</xsl:text>
+                            <xsl:text>&TAB;{&LF;</xsl:text>
+                            <xsl:text>&TAB;&TAB;evt-&gt;</xsl:text>
+                            <xsl:value-of select="$availableName" />
+                            <xsl:text> = TRUE;&LF;</xsl:text>
+                            <xsl:call-template name="parseElement">
+                                <xsl:with-param name="indent">
+                                    <xsl:text>&TAB;&TAB;</xsl:text>
+                                </xsl:with-param>
+                            </xsl:call-template>
+                            <xsl:text>&TAB;}&LF;</xsl:text>
+                        </xsl:when>
+
+                        <xsl:otherwise>
+                            <xsl:call-template name="parseElement">
+                                <xsl:with-param name="indent">
+                                    <xsl:text>&TAB;</xsl:text>
+                                </xsl:with-param>
+                            </xsl:call-template>
+                        </xsl:otherwise>
+                    </xsl:choose>
+
+                </xsl:for-each>
+
+                <xsl:text>&LF;</xsl:text>
+                <xsl:text>&TAB;return TRUE;&LF;</xsl:text>
+            </xsl:otherwise>
+
+        </xsl:choose>
+    </xsl:template>
+
+    <!-- Parse a single parameter, in the context of the element. -->
+    <xsl:template name="parseElement">
+        <xsl:param name="indent" />
+
+        <xsl:variable name="element" select="." />
+        <xsl:variable name="varName" select="local:hungarianForm(name[@lang='en'])" />
+
+        <xsl:choose>
+            <xsl:when test="@type = 'uint8'">
+                <xsl:value-of select="$indent" />
+                <xsl:text>evt-&gt;</xsl:text>
+                <xsl:value-of select="$varName" />
+                <xsl:text> = msg-&gt;data[</xsl:text>
+                <xsl:value-of select="@pos + 0" />
+                <xsl:text>];&LF;</xsl:text>
+            </xsl:when>
+            <xsl:when test="@type = 'uint16'">
+                <xsl:value-of select="$indent" />
+                <xsl:text>evt-&gt;</xsl:text>
+                <xsl:value-of select="$varName" />
+                <xsl:text> = VSCP_UTIL_READ_UINT16_BE(&amp;msg-&gt;data[</xsl:text>
+                <xsl:value-of select="@pos + 0" />
+                <xsl:text>]);&LF;</xsl:text>
+            </xsl:when>
+            <xsl:when test="@type = 'uint32'">
+                <xsl:value-of select="$indent" />
+                <xsl:text>evt-&gt;</xsl:text>
+                <xsl:value-of select="$varName" />
+                <xsl:text> = VSCP_UTIL_READ_UINT32_BE(&amp;msg-&gt;data[</xsl:text>
+                <xsl:value-of select="@pos + 0" />
+                <xsl:text>]);&LF;</xsl:text>
+            </xsl:when>
+            <xsl:when test="@type = 'float'">
+                <xsl:for-each select="0 to 3">
+                    <xsl:value-of select="$indent" />
+                    <xsl:text>((uint8_t*)&amp;evt-&gt;</xsl:text>
+                    <xsl:value-of select="$varName" />
+                    <xsl:text>)[</xsl:text>
+                    <xsl:value-of select="3 - ." />
+                    <xsl:text>] = msg-&gt;data[</xsl:text>
+                    <xsl:value-of select="$element/@pos + ." />
+                    <xsl:text>];&LF;</xsl:text>
+                </xsl:for-each>
+            </xsl:when>
+            <xsl:when test="@type = 'double'">
+                <xsl:for-each select="0 to 7">
+                    <xsl:value-of select="$indent" />
+                    <xsl:text>((uint8_t*)&amp;evt-&gt;</xsl:text>
+                    <xsl:value-of select="$varName" />
+                    <xsl:text>)[</xsl:text>
+                    <xsl:value-of select="7 - ." />
+                    <xsl:text>] = msg-&gt;data[</xsl:text>
+                    <xsl:value-of select="$element/@pos + ." />
+                    <xsl:text>];&LF;</xsl:text>
+                </xsl:for-each>
+            </xsl:when>
+            <xsl:otherwise>
+                <xsl:value-of select="$indent" />
+                <xsl:text>/* </xsl:text>
+                <xsl:value-of select="$varName" />
+                <xsl:text> not supported! */&LF;</xsl:text>
+            </xsl:otherwise>
+        </xsl:choose>
+    </xsl:template>
+
+    <!-- Parser function body of the whole class, in the context of the VSCP class. -->
+    <xsl:template name="parseDispatcherBody">
+        <xsl:param name="baseName" />
+
+        <!-- Function variables -->
+        <xsl:text>&TAB;BOOL&TAB;status&TAB;= FALSE;&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+
+        <!-- Pointer checks -->
+        <xsl:text>&TAB;if ((NULL == msg) || (NULL == evt))&LF;</xsl:text>
+        <xsl:text>&TAB;{&LF;</xsl:text>
+        <xsl:text>&TAB;&TAB;return FALSE;&LF;</xsl:text>
+        <xsl:text>&TAB;}&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+
+        <!-- Class check -->
+        <xsl:text>&TAB;if (</xsl:text>
+        <xsl:value-of select="token" />
+        <xsl:text> != msg-&gt;vscpClass)&LF;</xsl:text>
+        <xsl:text>&TAB;{&LF;</xsl:text>
+        <xsl:text>&TAB;&TAB;return FALSE;&LF;</xsl:text>
+        <xsl:text>&TAB;}&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+
+        <xsl:text>&TAB;evt-&gt;vscpType = msg-&gt;vscpType;&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+
+        <!-- The VSCP type selects the parser. -->
+        <xsl:text>&TAB;switch(msg-&gt;vscpType)&LF;</xsl:text>
+        <xsl:text>&TAB;{&LF;</xsl:text>
+
+        <xsl:for-each select="vscp-types/vscp-type[token][not(local:isTableDriven(.))][exists(local:getFrame(.))]">
+            <xsl:text>&TAB;case </xsl:text>
+            <xsl:value-of select="token" />
+            <xsl:text>:&LF;</xsl:text>
+            <xsl:choose>
+                <xsl:when test="local:hasParser(.)">
+                    <xsl:variable name="typeName" select="local:getTypeName(.)" />
+                    <xsl:text>&TAB;&TAB;status = vscp_evt_</xsl:text>
+                    <xsl:value-of select="$baseName" />
+                    <xsl:text>_parse</xsl:text>
+                    <xsl:value-of select="$typeName" />
+                    <xsl:text>(msg, &amp;evt-&gt;data.</xsl:text>
+                    <xsl:value-of select="concat(lower-case(substring($typeName, 1, 1)), substring($typeName, 2))" />
+                    <xsl:text>);&LF;</xsl:text>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:text>&TAB;&TAB;status = TRUE;&LF;</xsl:text>
+                </xsl:otherwise>
+            </xsl:choose>
+            <xsl:text>&TAB;&TAB;break;&LF;</xsl:text>
+            <xsl:text>&LF;</xsl:text>
+        </xsl:for-each>
+
+        <!-- All table driven types are handled by one parser. -->
+        <xsl:if test="vscp-types/vscp-type[token][local:isTableDriven(.)]">
+            <xsl:for-each select="vscp-types/vscp-type[token][local:isTableDriven(.)]">
+                <xsl:text>&TAB;case </xsl:text>
+                <xsl:value-of select="token" />
+                <xsl:text>:&LF;</xsl:text>
+            </xsl:for-each>
+            <xsl:choose>
+                <xsl:when test="local:hasParser((vscp-types/vscp-type[token][local:isTableDriven(.)])[1])">
+                    <xsl:text>&TAB;&TAB;status = vscp_evt_</xsl:text>
+                    <xsl:value-of select="$baseName" />
+                    <xsl:text>_parseCommon(msg, &amp;evt-&gt;data.common);&LF;</xsl:text>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:text>&TAB;&TAB;status = TRUE;&LF;</xsl:text>
+                </xsl:otherwise>
+            </xsl:choose>
+            <xsl:text>&TAB;&TAB;break;&LF;</xsl:text>
+            <xsl:text>&LF;</xsl:text>
+        </xsl:if>
+
+        <xsl:text>&TAB;default:&LF;</xsl:text>
+        <xsl:text>&TAB;&TAB;break;&LF;</xsl:text>
+        <xsl:text>&TAB;}&LF;</xsl:text>
+        <xsl:text>&LF;</xsl:text>
+        <xsl:text>&TAB;return status;&LF;</xsl:text>
+    </xsl:template>
+
     <!-- Garbage collector -->
     <xsl:template match="text()">
     </xsl:template>
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+# ********************************************************************************
+# Author: Andreas Merkle, http://www.blue-andi.de
+# ********************************************************************************
+"""Compressor for the embedded MDF of a VSCP node.
+
+The MDF is dictionary coded, which the node decodes on the fly with a few bytes
+of RAM, while it streams the MDF via CLASS1.PROTOCOL Type=36 events (see
+vscp_mdf.h). The blob is stored in flash and read by the node with
+vscp_portable_readEmbeddedMdf().
+
+Blob format, all multi-byte values are MSB first:
+    [0..1]  Size of the uncompressed MDF
+    [2..3]  Index of the coded stream
+    [4]     Number of dictionary entries (max. 127)
+    [5..]   Index of every dictionary entry, 2 byte each
+    ...     Dictionary entries: length byte, followed by the characters
+    ...     Coded stream:
+            0x00 - 0x7F   Literal character
+            0x80          Escape, the following byte is a literal
+            0x81 - 0xFF   Dictionary entry 0 - 126
+
+Generate the C source of the blob, e.g. for an AVR, where it shall be placed
+in the program memory:
+    vscp_mdf_compress.py --strip --include avr/pgmspace.h --attribute PROGMEM \\
+        -o vscp_mdf_blob.c mdf/exp01.xml
+"""
+
+import argparse
+import re
+import sys
+from collections import Counter
+
+# Max. number of dictionary entries
+DICT_MAX = 127
+
+# Min. and max. length of a dictionary entry
+ENTRY_LEN_MIN = 3
+ENTRY_LEN_MAX = 32
+
+# Escape token for literals above 0x7F
+ESCAPE = 0x80
+
+# Token of the first dictionary entry
+DICT_TOKEN = 0x81
+
+# Header size, without the dictionary entry indices
+HEADER_SIZE = 5
+
+
+def strip_xml(data):
+    """Remove the whitespace between the XML elements and the line breaks."""
+    return re.sub(rb">\s+<", b"><", data).strip()
+
+
+def literal_runs(tokens):
+    """Yield the runs of literals (int < 256) in the token list."""
+    run = []
+
+    for token in tokens:
+        if 256 > token:
+            run.append(token)
+        else:
+            if run:
+                yield bytes(run)
+            run = []
+
+    if run:
+        yield bytes(run)
+
+
+def best_entry(tokens):
+    """Find the substring, which saves the most bytes if it is put into the dictionary."""
+    counter = Counter()
+
+    for run in literal_runs(tokens):
+        for length in range(ENTRY_LEN_MIN, min(ENTRY_LEN_MAX, len(run)) + 1):
+            for index in range(len(run) - length + 1):
+                counter[run[index:index + length]] += 1
+
+    best = None
+    best_saving = 0
+
+    for entry, count in counter.items():
+        # Every occurrence is replaced by one token, the entry costs its
+        # characters, the length byte and its index.
+        saving = count * (len(entry) - 1) - (len(entry) + 3)
+
+        if best_saving < saving:
+            best = entry
+            best_saving = saving
+
+    return best
+
+
+def replace_entry(tokens, entry, token):
+    """Replace all non-overlapping occurrences of the entry in the literal runs."""
+    result = []
+    index = 0
+    length = len(entry)
+    pattern = list(entry)
+
+    while len(tokens) > index:
+        # Dictionary tokens are never equal to a literal.
+        if tokens[index:index + length] == pattern:
+            result.append(token)
+            index += length
+        else:
+            result.append(tokens[index])
+            index += 1
+
+    return result
+
+
+def compress(data, dict_max=DICT_MAX):
+    """Compress the MDF and return the blob."""
+    if 0xFFFF < len(data):
+        raise ValueError("The MDF is limited to 65535 byte.")
+
+    tokens = list(data)
+    entries = []
+
+    while dict_max > len(entries):
+        entry = best_entry(tokens)
+
+        if entry is None:
+            break
+
+        tokens = replace_entry(tokens, entry, 256 + len(entries))
+        entries.append(entry)
+
+    blob = bytearray()
+    index = HEADER_SIZE + 2 * len(entries)
+    indices = bytearray()
+    dictionary = bytearray()
+
+    for entry in entries:
+        indices += bytes([(index >> 8) & 0xFF, index & 0xFF])
+        dictionary += bytes([len(entry)]) + entry
+        index += 1 + len(entry)
+
+    stream = bytearray()
+
+    for token in tokens:
+        if 256 <= token:
+            stream.append(DICT_TOKEN + token - 256)
+        elif ESCAPE <= token:
+            stream += bytes([ESCAPE, token])
+        else:
+            stream.append(token)
+
+    if 0xFFFF < index + len(stream):
+        raise ValueError("The blob is limited to 65535 byte.")
+
+    blob += bytes([(len(data) >> 8) & 0xFF, len(data) & 0xFF])
+    blob += bytes([(index >> 8) & 0xFF, index & 0xFF])
+    blob.append(len(entries))
+    blob += indices + dictionary + stream
+
+    return bytes(blob)
+
+
+def decompress(blob):
+    """Decompress the blob, like the node does it."""
+    size = (blob[0] << 8) | blob[1]
+    index = (blob[2] << 8) | blob[3]
+    data = bytearray()
+
+    while size > len(data):
+        token = blob[index]
+        index += 1
+
+        if ESCAPE > token:
+            data.append(token)
+        elif ESCAPE == token:
+            data.append(blob[index])
+            index += 1
+        else:
+            entry = token - DICT_TOKEN
+            entry_index = (blob[HEADER_SIZE + 2 * entry] << 8) | blob[HEADER_SIZE + 2 * entry + 1]
+            data += blob[entry_index + 1:entry_index + 1 + blob[entry_index]]
+
+    return bytes(data)
+
+
+def to_c_source(blob, name, source, include, attribute):
+    """Generate the C source of the blob."""
+    lines = []
+
+    lines.append("/* Embedded MDF, generated by vscp_mdf_compress.py from %s, don't edit. */" % source)
+    lines.append("#include <stdint.h>")
+
+    if include:
+        lines.append("#include <%s>" % include)
+
+    lines.append("")
+    lines.append("/** Embedded MDF (%u byte) */" % len(blob))
+    lines.append("const uint8_t %s[%u]%s =" % (name, len(blob), (" " + attribute) if attribute else ""))
+    lines.append("{")
+
+    for index in range(0, len(blob), 16):
+        chunk = blob[index:index + 16]
+        line = "    " + ", ".join("0x%02X" % value for value in chunk)
+
+        if len(blob) > index + 16:
+            line += ","
+
+        lines.append(line)
+
+    lines.append("};")
+    lines.append("")
+
+    return "\n".join(lines)
+
+
+def main():
+    """Main entry point."""
+    parser = argparse.ArgumentParser(description="VSCP embedded MDF compressor")
+    parser.add_argument("mdf", help="Module description file (XML)")
+    parser.add_argument("-o", "--output", default="vscp_mdf_blob.c", help="Generated C source")
+    parser.add_argument("-n", "--name", default="vscp_mdf_blob", help="Name of the C array")
+    parser.add_argument("--include", help="Additional include, e.g. avr/pgmspace.h")
+    parser.add_argument("--attribute", help="Attribute of the C array, e.g. PROGMEM")
+    parser.add_argument("--strip", action="store_true", help="Remove the whitespace between the XML elements")
+    parser.add_argument("--no-dict", action="store_true", help="Store the MDF without dictionary")
+
+    args = parser.parse_args()
+
+    with open(args.mdf, "rb") as file:
+        data = file.read()
+
+    if args.strip:
+        data = strip_xml(data)
+
+    blob = compress(data, 0 if args.no_dict else DICT_MAX)
+
+    if data != decompress(blob):
+        raise ValueError("Verification of the compressed MDF failed.")
+
+    with open(args.output, "w", encoding="utf-8") as file:
+        file.write(to_c_source(blob, args.name, args.mdf.replace("\\", "/"), args.include, args.attribute))
+
+    print("%s: %u byte, compressed %u byte (%u%%)" %
+          (args.mdf, len(data), len(blob), (100 * len(blob)) // max(1, len(data))))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+# ********************************************************************************
+# Author: Andreas Merkle, http://www.blue-andi.de
+# ********************************************************************************
+"""Decoder for the binary trace records of the VSCP logger.
+
+The trace message ids are defined by the application in a C header. The format
+string follows in a doxygen comment with the @trace tag, e.g.
+
+    #define APP_TRACE_TEMPERATURE   ((uint16_t)0x0010)  /**< @trace Temperature %d degC */
+
+Signed arguments (%d, %i) are zigzag decoded, all others are unsigned.
+
+Generate the table from the headers:
+    vscp_trace_decoder.py generate -o trace_table.json app_trace.h
+
+Decode the log events. Every line of the input contains the data bytes of one
+CLASS1.LOG Type=1 event in hex, e.g. "FF 00 00 00 10 03":
+    vscp_trace_decoder.py decode trace_table.json log.txt
+"""
+
+import argparse
+import json
+import re
+import sys
+
+# Log message id, which marks a trace record (VSCP_CONFIG_LOGGER_TRACE_ID)
+TRACE_ID = 0xFF
+
+# Log level names, see VSCP_LOGGER_LVL
+LEVELS = ["INFO", "DEBUG", "WARNING", "ERROR", "FATAL", "USER1", "USER2", "USER3"]
+
+# Trace id definition with format string
+DEFINE_PATTERN = re.compile(
+    r"#define\s+(\w+)\s+\(*(?:\(\s*uint16_t\s*\))?\s*(0[xX][0-9a-fA-F]+|\d+)\s*\)*"
+    r"\s*/\*\*<\s*@trace\s+(.*?)\s*\*/")
+
+# printf conversion specifications
+CONVERSION_PATTERN = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?([diuxXoc%])")
+
+
+def generate_table(headers):
+    """Collect the trace ids and their format strings from the C headers."""
+    table = {}
+
+    for header in headers:
+        with open(header, "r", encoding="utf-8") as file:
+            for match in DEFINE_PATTERN.finditer(file.read()):
+                trace_id = int(match.group(2), 0)
+
+                if str(trace_id) in table:
+                    raise ValueError("Trace id 0x%04X used twice (%s)." % (trace_id, match.group(1)))
+
+                table[str(trace_id)] = {"name": match.group(1), "format": match.group(3)}
+
+    return table
+
+
+def decode_var_uints(data):
+    """Decode variable length unsigned integers, 7 bit per byte, LSB group first."""
+    values = []
+    value = 0
+    shift = 0
+
+    for byte in data:
+        value |= (byte & 0x7F) << shift
+        shift += 7
+
+        if 0 == (byte & 0x80):
+            values.append(value)
+            value = 0
+            shift = 0
+
+    return values
+
+
+def format_record(table, level, record):
+    """Format a complete trace record with the table."""
+    trace_id = (record[0] << 8) | record[1]
+    args = decode_var_uints(record[2:])
+    entry = table.get(str(trace_id))
+
+    if entry is None:
+        return "%s: Unknown trace 0x%04X %s" % (LEVELS[level & 0x07], trace_id, args)
+
+    values = []
+    conversions = [conv for conv in CONVERSION_PATTERN.findall(entry["format"]) if "%" != conv]
+
+    for index, conv in enumerate(conversions):
+        value = args[index] if index < len(args) else 0
+
+        if conv in "di":
+            value = (value >> 1) ^ -(value & 1)
+
+        values.append(value)
+
+    return "%s: %s" % (LEVELS[level & 0x07], entry["format"] % tuple(values))
+
+
+def decode(table, lines):
+    """Reassemble the trace records from the log events and format them."""
+    record = None
+    level = 0
+    next_index = 0
+
+    for line in lines:
+        line = line.strip()
+
+        if not line:
+            continue
+
+        data = [int(byte, 16) for byte in line.replace(",", " ").split()]
+
+        if (3 > len(data)) or (TRACE_ID != data[0]):
+            continue
+
+        # Index 0 starts a new record.
+        if 0 == data[2]:
+            if (record is not None) and (2 <= len(record)):
+                yield format_record(table, level, record)
+            record = []
+            level = data[1]
+        # Lost log event? Skip the rest of the record.
+        elif next_index != data[2]:
+            record = None
+
+        if record is not None:
+            record.extend(data[3:])
+            next_index = data[2] + 1
+
+    if (record is not None) and (2 <= len(record)):
+        yield format_record(table, level, record)
+
+
+def main():
+    """Main entry point."""
+    parser = argparse.ArgumentParser(description="VSCP logger trace record decoder")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    generate_parser = commands.add_parser("generate", help="Generate the trace table from C headers.")
+    generate_parser.add_argument("headers", nargs="+", help="C headers with the trace ids")
+    generate_parser.add_argument("-o", "--output", default="trace_table.json", help="Trace table")
+
+    decode_parser = commands.add_parser("decode", help="Decode log events.")
+    decode_parser.add_argument("table", help="Trace table")
+    decode_parser.add_argument("log", nargs="?", help="Log events, default is stdin")
+
+    args = parser.parse_args()
+
+    if "generate" == args.command:
+        with open(args.output, "w", encoding="utf-8") as file:
+            json.dump(generate_table(args.headers), file, indent=4, sort_keys=True)
+    else:
+        with open(args.table, "r", encoding="utf-8") as file:
+            table = json.load(file)
+
+        lines = open(args.log, "r", encoding="utf-8") if args.log else sys.stdin
+
+        for text in decode(table, lines):
+            print(text)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())